@@ -27,6 +27,8 @@
 #include "pwiz/utility/misc/Std.hpp"
 #include "ChromatogramList_XICGenerator.hpp"
 #include "pwiz/data/vendor_readers/Thermo/ChromatogramList_Thermo.hpp"
+#include <boost/thread/locks.hpp>
+#include <boost/cstdint.hpp>
 
 
 namespace pwiz {
@@ -38,6 +40,218 @@ using namespace msdata::detail;
 //using namespace pwiz::util;
 
 
+namespace {
+
+// the index keeps the peaks of this many consecutive spectra in a tile,
+// and each tile has an offset table for finding its peaks in steps of this much m/z
+const size_t spectraPerTile = 64;
+const double mzPerTileStep = 10;
+
+struct Peak
+{
+    double mz;
+    float intensity;
+    boost::uint32_t spectrum; // by ascending scan time
+
+    Peak(double mz, float intensity, boost::uint32_t spectrum) : mz(mz), intensity(intensity), spectrum(spectrum) {}
+};
+
+struct PeakMzLessThan
+{
+    bool operator() (const Peak& lhs, const Peak& rhs) const {return lhs.mz < rhs.mz;}
+    bool operator() (const Peak& lhs, double rhs) const {return lhs.mz < rhs;}
+};
+
+struct PeakSpectrumLessThan
+{
+    bool operator() (const Peak& lhs, const Peak& rhs) const {return lhs.spectrum < rhs.spectrum;}
+};
+
+int getMSLevel(const Spectrum& s)
+{
+    CVParam msLevel = s.cvParam(MS_ms_level);
+    if (!msLevel.empty())
+        return msLevel.valueAs<int>();
+    return s.hasCVParam(MS_MS1_spectrum) ? 1 : 0;
+}
+
+// returns the array's values, unpacking a copy of the array into buffer if it is packed
+const vector<double>& getValues(const BinaryDataArray& array, vector<double>& buffer)
+{
+    if (!array.isPacked())
+        return array.data;
+
+    BinaryDataArray unpacked(array);
+    unpacked.unpack();
+    buffer.swap(unpacked.data);
+    return buffer;
+}
+
+} // namespace
+
+
+class ChromatogramList_XICGenerator::Index
+{
+    public:
+
+    /// reads the spectra of the MS level in one pass
+    Index(const SpectrumList& spectra, int msLevel)
+    {
+        vector<Peak> tilePeaks;
+        vector<double> mzBuffer, intensityBuffer;
+        bool inTimeOrder = true;
+        for (size_t i = 0; i < spectra.size(); ++i)
+        {
+            SpectrumPtr s = spectra.spectrum(i, false);
+            if (getMSLevel(*s) != msLevel || s->scanList.scans.empty())
+                continue;
+
+            CVParam scanStartTime = s->scanList.scans[0].cvParam(MS_scan_start_time);
+            if (scanStartTime.empty())
+                continue;
+            double time = scanStartTime.timeInSeconds() / 60;
+            inTimeOrder = inTimeOrder && (times_.empty() || time >= times_.back());
+
+            s = spectra.spectrum(i, true);
+            BinaryDataArrayPtr mzArray = s->getMZArray();
+            BinaryDataArrayPtr intensityArray = s->getIntensityArray();
+            if (mzArray.get() && intensityArray.get())
+            {
+                const vector<double>& mz = getValues(*mzArray, mzBuffer);
+                const vector<double>& intensity = getValues(*intensityArray, intensityBuffer);
+                for (size_t j = 0, end = min(mz.size(), intensity.size()); j < end; ++j)
+                    if (intensity[j] != 0)
+                        tilePeaks.push_back(Peak(mz[j], intensity[j], times_.size()));
+            }
+            times_.push_back(time);
+
+            if (times_.size() % spectraPerTile == 0)
+                addTile(tilePeaks);
+        }
+
+        if (times_.size() % spectraPerTile > 0)
+            addTile(tilePeaks);
+
+        if (!inTimeOrder)
+            sortByTime();
+    }
+
+    /// sums the peaks within massRanges for each spectrum in the time range
+    void xic(double startTime, double endTime, const boost::icl::interval_set<double>& massRanges,
+             vector<double>& times, vector<double>& intensities) const
+    {
+        size_t first = lower_bound(times_.begin(), times_.end(), startTime) - times_.begin();
+        size_t last = upper_bound(times_.begin(), times_.end(), endTime) - times_.begin();
+        if (first >= last)
+        {
+            times.clear();
+            intensities.clear();
+            return;
+        }
+
+        times.assign(times_.begin() + first, times_.begin() + last);
+        intensities.assign(last - first, 0);
+
+        for (size_t t = first / spectraPerTile; t <= (last - 1) / spectraPerTile; ++t)
+        {
+            const Tile& tile = tiles_[t];
+            BOOST_FOREACH(const boost::icl::interval_set<double>::interval_type& range, massRanges)
+            {
+                for (vector<Peak>::const_iterator itr = lowerBound(tile, range.lower());
+                     itr != tile.peaks.end() && itr->mz <= range.upper(); ++itr)
+                {
+                    if (itr->spectrum >= first && itr->spectrum < last && boost::icl::contains(range, itr->mz))
+                        intensities[itr->spectrum - first] += itr->intensity;
+                }
+            }
+        }
+    }
+
+    private:
+
+    struct Tile
+    {
+        vector<Peak> peaks; // sorted by m/z
+        vector<boost::uint32_t> mzStepOffsets; // the index of the first peak at or above each multiple of mzPerTileStep
+    };
+
+    vector<double> times_; // ascending
+    vector<Tile> tiles_; // tile t has the peaks of spectra [t*spectraPerTile, (t+1)*spectraPerTile)
+
+    // takes the peaks and adds them as the next tile
+    void addTile(vector<Peak>& peaks)
+    {
+        tiles_.push_back(Tile());
+        Tile& tile = tiles_.back();
+        tile.peaks.swap(peaks);
+        stable_sort(tile.peaks.begin(), tile.peaks.end(), PeakMzLessThan());
+
+        size_t steps = tile.peaks.empty() ? 0 : (size_t) max(0.0, tile.peaks.back().mz / mzPerTileStep) + 1;
+        for (size_t i = 0; i <= steps; ++i)
+            tile.mzStepOffsets.push_back(lower_bound(tile.peaks.begin(), tile.peaks.end(), i * mzPerTileStep, PeakMzLessThan()) - tile.peaks.begin());
+    }
+
+    // the first peak in the tile at or above mz
+    vector<Peak>::const_iterator lowerBound(const Tile& tile, double mz) const
+    {
+        if (tile.peaks.empty() || !(mz > 0))
+            return lower_bound(tile.peaks.begin(), tile.peaks.end(), mz, PeakMzLessThan());
+
+        size_t step = (size_t) min(mz / mzPerTileStep, (double) tile.mzStepOffsets.size() - 1);
+        while (step > 0 && step * mzPerTileStep > mz)
+            --step;
+        if (step + 1 >= tile.mzStepOffsets.size())
+            return tile.peaks.end();
+
+        return lower_bound(tile.peaks.begin() + tile.mzStepOffsets[step],
+                           tile.peaks.begin() + tile.mzStepOffsets[step + 1],
+                           mz, PeakMzLessThan());
+    }
+
+    // renumbers the spectra by ascending scan time and builds the tiles again
+    void sortByTime()
+    {
+        vector<pair<double, boost::uint32_t> > timeOrder;
+        for (size_t i = 0; i < times_.size(); ++i)
+            timeOrder.push_back(make_pair(times_[i], (boost::uint32_t) i));
+        stable_sort(timeOrder.begin(), timeOrder.end());
+
+        vector<boost::uint32_t> rank(times_.size());
+        for (size_t i = 0; i < timeOrder.size(); ++i)
+        {
+            rank[timeOrder[i].second] = i;
+            times_[i] = timeOrder[i].first;
+        }
+
+        vector<Peak> peaks;
+        BOOST_FOREACH(Tile& tile, tiles_)
+        {
+            BOOST_FOREACH(Peak& peak, tile.peaks)
+                peaks.push_back(Peak(peak.mz, peak.intensity, rank[peak.spectrum]));
+            vector<Peak>().swap(tile.peaks);
+        }
+        tiles_.clear();
+        stable_sort(peaks.begin(), peaks.end(), PeakSpectrumLessThan());
+
+        vector<Peak> tilePeaks;
+        for (vector<Peak>::const_iterator itr = peaks.begin(); itr != peaks.end();)
+        {
+            boost::uint32_t tileEnd = (tiles_.size() + 1) * spectraPerTile;
+            vector<Peak>::const_iterator end = itr;
+            while (end != peaks.end() && end->spectrum < tileEnd)
+                ++end;
+            tilePeaks.assign(itr, end);
+            addTile(tilePeaks);
+            itr = end;
+        }
+
+        tilePeaks.clear();
+        while (tiles_.size() * spectraPerTile < times_.size())
+            addTile(tilePeaks);
+    }
+};
+
+
 PWIZ_API_DECL ChromatogramList_XICGenerator::ChromatogramList_XICGenerator(const msdata::ChromatogramListPtr& inner)
 :   ChromatogramListWrapper(inner)
 {
@@ -45,6 +259,12 @@ PWIZ_API_DECL ChromatogramList_XICGenerator::ChromatogramList_XICGenerator(const
 }
 
 
+PWIZ_API_DECL ChromatogramList_XICGenerator::ChromatogramList_XICGenerator(const msdata::ChromatogramListPtr& inner, const msdata::SpectrumListPtr& spectra)
+:   ChromatogramListWrapper(inner), spectra_(spectra)
+{
+}
+
+
 PWIZ_API_DECL bool ChromatogramList_XICGenerator::accept(const msdata::ChromatogramListPtr& inner)
 {
     return true;
@@ -54,13 +274,43 @@ PWIZ_API_DECL bool ChromatogramList_XICGenerator::accept(const msdata::Chromatog
 PWIZ_API_DECL ChromatogramPtr ChromatogramList_XICGenerator::xic(double startTime, double endTime, const boost::icl::interval_set<double>& massRanges, int msLevel)
 {
     ChromatogramList_Thermo* thermo = dynamic_cast<ChromatogramList_Thermo*>(inner_.get());
-    if (thermo == NULL)
-        throw runtime_error("[ChromatogramList_XICGenerator] only works directly on Thermo ChromatogramLists");
 #ifdef PWIZ_READER_THERMO
-    return thermo->xic(startTime, endTime, massRanges, msLevel);
-#else
-    throw runtime_error("[ChromatogramList_XICGenerator] only works directly on Thermo ChromatogramLists, and only when ProteoWizard is built with windows DLL vendor support.");
+    if (thermo != NULL)
+        return thermo->xic(startTime, endTime, massRanges, msLevel);
 #endif
+
+    if (!spectra_.get())
+    {
+        if (thermo != NULL)
+            throw runtime_error("[ChromatogramList_XICGenerator] Thermo ChromatogramLists need ProteoWizard built with windows DLL vendor support, or a SpectrumList to index.");
+        throw runtime_error("[ChromatogramList_XICGenerator] only works directly on Thermo ChromatogramLists, or on a SpectrumList passed to the constructor");
+    }
+
+    boost::shared_ptr<Index> index;
+    {
+        boost::lock_guard<boost::mutex> lock(indexMutex_);
+        boost::shared_ptr<Index>& msLevelIndex = indexByMSLevel_[msLevel];
+        if (!msLevelIndex.get())
+            msLevelIndex.reset(new Index(*spectra_, msLevel));
+        index = msLevelIndex;
+    }
+
+    vector<double> times, intensities;
+    index->xic(startTime, endTime, massRanges, times, intensities);
+
+    ostringstream massRangesString;
+    BOOST_FOREACH(const boost::icl::interval_set<double>::interval_type& range, massRanges)
+        massRangesString << (massRangesString.tellp() > 0 ? "," : "") << range.lower() << "-" << range.upper();
+
+    // the same level filter as ChromatogramList_Thermo::xic()
+    string msLevelFilter("ms");
+    if (msLevel > 1)
+        msLevelFilter += lexical_cast<string>(msLevel);
+
+    ChromatogramPtr result(new Chromatogram);
+    result->id = (boost::format("XIC %1% %2% [%3%-%4%]") % msLevelFilter % massRangesString.str() % startTime % endTime).str();
+    result->setTimeIntensityArrays(times, intensities, UO_minute, MS_number_of_detector_counts);
+    return result;
 }
 
 
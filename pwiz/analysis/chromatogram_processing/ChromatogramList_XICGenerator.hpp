@@ -28,6 +28,7 @@
 #include "pwiz/utility/misc/Export.hpp"
 #include <boost/icl/interval_set.hpp>
 #include <boost/icl/continuous_interval.hpp>
+#include <boost/thread/mutex.hpp>
 #include "ChromatogramListWrapper.hpp"
 
 
@@ -35,16 +36,31 @@ namespace pwiz {
 namespace analysis {
 
 
-/// ChromatogramList implementation to return native centroided chromatogram data
+/// ChromatogramList implementation to return native centroided chromatogram data;
+/// XICs come from the Thermo API for Thermo ChromatogramLists, otherwise from an index of the file's spectra
 class PWIZ_API_DECL ChromatogramList_XICGenerator : public ChromatogramListWrapper
 {
     public:
 
     ChromatogramList_XICGenerator(const msdata::ChromatogramListPtr& inner);
 
+    /// unless inner is a Thermo ChromatogramList, xic() reads the spectra of each MS level into an index
+    /// of tiles of consecutive spectra and m/z ranges the first time it is called for that MS level;
+    /// the following calls for that MS level don't read the spectra again
+    ChromatogramList_XICGenerator(const msdata::ChromatogramListPtr& inner, const msdata::SpectrumListPtr& spectra);
+
     static bool accept(const msdata::ChromatogramListPtr& inner);
 
+    /// returns the summed intensity within massRanges of each msLevel spectrum with a scan start time
+    /// between startTime and endTime (in minutes)
     virtual msdata::ChromatogramPtr xic(double startTime, double endTime, const boost::icl::interval_set<double>& massRanges, int msLevel);
+
+    private:
+
+    class Index;
+    msdata::SpectrumListPtr spectra_;
+    std::map<int, boost::shared_ptr<Index> > indexByMSLevel_;
+    boost::mutex indexMutex_;
 };
 
 
@@ -0,0 +1,200 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#include "ChromatogramList_XICGenerator.hpp"
+#include "pwiz/utility/misc/unit.hpp"
+#include "pwiz/utility/misc/Std.hpp"
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+
+
+using namespace pwiz::analysis;
+using namespace pwiz::cv;
+using namespace pwiz::msdata;
+using namespace pwiz::util;
+using boost::icl::interval_set;
+using boost::icl::continuous_interval;
+
+
+ostream* os_ = 0;
+boost::random::mt19937 rng;
+
+
+int random(int min, int max) {return boost::random::uniform_int_distribution<>(min, max)(rng);}
+
+
+// MS1 and MS2 spectra one second apart, or in a shuffled order; intensities are integers, so sums are exact
+SpectrumListSimplePtr createSpectra(size_t count, bool shuffled)
+{
+    vector<size_t> order;
+    for (size_t i=0; i < count; ++i)
+        order.push_back(i);
+    if (shuffled)
+        for (size_t i=count-1; i > 0; --i)
+            swap(order[i], order[random(0, i)]);
+
+    SpectrumListSimplePtr sl(new SpectrumListSimple);
+    BOOST_FOREACH(size_t i, order)
+    {
+        SpectrumPtr s(new Spectrum);
+        s->index = sl->spectra.size();
+        s->id = "scan=" + lexical_cast<string>(i+1);
+        s->set(MS_ms_level, i % 4 == 3 ? 2 : 1);
+        s->scanList.scans.push_back(Scan());
+        s->scanList.scans.back().set(MS_scan_start_time, i, UO_second);
+
+        vector<double> mz, intensity;
+        for (double m = 300 + random(0, 100) / 100.0; m < 2000; m += random(1, 2000) / 100.0)
+        {
+            mz.push_back(m);
+            intensity.push_back(random(0, 1000));
+        }
+        if (i % 10 == 0) // peaks on the bounds of the test's mass ranges
+        {
+            mz.push_back(500); intensity.push_back(7);
+            mz.push_back(510); intensity.push_back(11);
+        }
+        if (i % 50 == 7) // no peaks
+            mz.clear(), intensity.clear();
+
+        s->setMZIntensityArrays(mz, intensity, MS_number_of_detector_counts);
+        sl->spectra.push_back(s);
+    }
+    return sl;
+}
+
+
+// the XIC summed from every spectrum
+void bruteForceXIC(const SpectrumList& sl, double startTime, double endTime, const interval_set<double>& massRanges, int msLevel,
+                   vector<double>& times, vector<double>& intensities)
+{
+    vector<pair<double, double> > points;
+    for (size_t i=0; i < sl.size(); ++i)
+    {
+        SpectrumPtr s = sl.spectrum(i, true);
+        double time = s->scanList.scans[0].cvParam(MS_scan_start_time).timeInSeconds() / 60;
+        if (s->cvParam(MS_ms_level).valueAs<int>() != msLevel || time < startTime || time > endTime)
+            continue;
+
+        double sum = 0;
+        const vector<double>& mz = s->getMZArray()->data;
+        const vector<double>& intensity = s->getIntensityArray()->data;
+        for (size_t j=0; j < mz.size(); ++j)
+            if (boost::icl::contains(massRanges, mz[j]))
+                sum += intensity[j];
+        points.push_back(make_pair(time, sum));
+    }
+    sort(points.begin(), points.end());
+
+    times.clear(); intensities.clear();
+    for (size_t i=0; i < points.size(); ++i)
+    {
+        times.push_back(points[i].first);
+        intensities.push_back(points[i].second);
+    }
+}
+
+
+void testXIC(ChromatogramList_XICGenerator& generator, const SpectrumList& sl,
+             double startTime, double endTime, const interval_set<double>& massRanges, int msLevel)
+{
+    if (os_) *os_ << "xic ms" << msLevel << " " << massRanges << " [" << startTime << "-" << endTime << "]" << endl;
+
+    ChromatogramPtr c = generator.xic(startTime, endTime, massRanges, msLevel);
+    vector<double> expectedTimes, expectedIntensities;
+    bruteForceXIC(sl, startTime, endTime, massRanges, msLevel, expectedTimes, expectedIntensities);
+
+    unit_assert(c.get());
+    unit_assert_operator_equal(expectedTimes.size(), c->getTimeArray()->data.size());
+    unit_assert(expectedTimes == c->getTimeArray()->data);
+    unit_assert(expectedIntensities == c->getIntensityArray()->data);
+    unit_assert_operator_equal(UO_minute, c->getTimeArray()->cvParam(MS_time_array).units);
+    unit_assert(bal::starts_with(c->id, msLevel == 1 ? "XIC ms " : "XIC ms" + lexical_cast<string>(msLevel) + " "));
+}
+
+
+void test(bool shuffled)
+{
+    if (os_) *os_ << "test(" << (shuffled ? "shuffled" : "ordered") << ")" << endl;
+
+    SpectrumListSimplePtr sl = createSpectra(1000, shuffled);
+    ChromatogramListPtr cl(new ChromatogramListSimple);
+
+    // without a SpectrumList, only Thermo ChromatogramLists are supported
+    {
+        ChromatogramList_XICGenerator generator(cl);
+        unit_assert_throws(generator.xic(0, 1, interval_set<double>(continuous_interval<double>::closed(500, 510)), 1), runtime_error);
+    }
+
+    ChromatogramList_XICGenerator generator(cl, sl);
+
+    interval_set<double> closed(continuous_interval<double>::closed(500, 510));
+    interval_set<double> rightOpen(continuous_interval<double>::right_open(500, 510));
+    interval_set<double> ranges;
+    ranges += continuous_interval<double>::closed(400.5, 400.52);
+    ranges += continuous_interval<double>::closed(899.999, 1015);
+    ranges += continuous_interval<double>::open(1999, 2500);
+
+    testXIC(generator, *sl, 0, 1000, closed, 1);
+    testXIC(generator, *sl, 0, 1000, rightOpen, 1);
+    testXIC(generator, *sl, 2.5, 3.5, ranges, 1);
+    testXIC(generator, *sl, 2.5, 3.5, ranges, 2);
+    testXIC(generator, *sl, 100, 200, ranges, 1); // after the last spectrum
+    testXIC(generator, *sl, 0, 1000, interval_set<double>(continuous_interval<double>::closed(0, 10000)), 2);
+    unit_assert_operator_equal("XIC ms 500-510 [0-1000]", generator.xic(0, 1000, closed, 1)->id);
+
+    for (int i=0; i < 20; ++i)
+    {
+        double startTime = random(-100, 1000) / 60.0;
+        double endTime = startTime + random(0, 300) / 60.0;
+        interval_set<double> massRanges;
+        for (int j = random(1, 3); j > 0; --j)
+        {
+            double mz = random(2500, 21000) / 10.0;
+            massRanges += continuous_interval<double>::closed(mz, mz + random(1, 3000) / 100.0);
+        }
+        testXIC(generator, *sl, startTime, endTime, massRanges, random(1, 2));
+    }
+}
+
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(argc, argv)
+
+    try
+    {
+        if (argc>1 && !strcmp(argv[1],"-v")) os_ = &cout;
+        test(false);
+        test(true);
+    }
+    catch (exception& e)
+    {
+        TEST_FAILED(e.what())
+    }
+    catch (...)
+    {
+        TEST_FAILED("Caught unknown exception.")
+    }
+
+    TEST_EPILOG
+}
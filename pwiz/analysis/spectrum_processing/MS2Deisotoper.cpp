@@ -74,16 +74,16 @@ vector<pair<double, int> > GetPrecursors(const SpectrumPtr spectrum)
             int charge = 0;
             if (selectedIon.hasCVParam(MS_m_z))
             {
-                mz = selectedIon.cvParam(MS_m_z).valueAs<double>();
+                mz = selectedIon.cvParamValueOrDefault(MS_m_z, 0.0);
             }
             else if (selectedIon.hasCVParam(MS_selected_ion_m_z))
             {
-                mz = selectedIon.cvParam(MS_selected_ion_m_z).valueAs<double>();
+                mz = selectedIon.cvParamValueOrDefault(MS_selected_ion_m_z, 0.0);
             }
 
             if (selectedIon.hasCVParam(MS_charge_state))
             {
-                charge = selectedIon.cvParam(MS_charge_state).valueAs<int>();
+                charge = selectedIon.cvParamValueOrDefault(MS_charge_state, 0);
             }
 
             precursorList.push_back(pair<double, int>(mz, charge));
@@ -374,7 +374,7 @@ void MS2Deisotoper::describe(ProcessingMethod& method) const
 
 void MS2Deisotoper::operator () (const SpectrumPtr spectrum) const
 {
-    if (spectrum->cvParam(MS_ms_level).valueAs<int>() > 1 &&
+    if (spectrum->cvParamValueOrDefault(MS_ms_level, 0) > 1 &&
         spectrum->cvParam(MS_MSn_spectrum).empty() == false &&
         spectrum->precursors.empty() == false &&
         spectrum->precursors[0].empty() == false &&
@@ -96,11 +96,11 @@ void FilterSpectrum::RetrievePrecursorMass()
         {
             if (selectedIon.hasCVParam(MS_m_z))
             {
-                precursorMZ = selectedIon.cvParam(MS_m_z).valueAs<double>();
+                precursorMZ = selectedIon.cvParamValueOrDefault(MS_m_z, 0.0);
             }
             else if (selectedIon.hasCVParam(MS_selected_ion_m_z))
             {
-                precursorMZ = selectedIon.cvParam(MS_selected_ion_m_z).valueAs<double>();
+                precursorMZ = selectedIon.cvParamValueOrDefault(MS_selected_ion_m_z, 0.0);
             }
             else
             {
@@ -110,7 +110,7 @@ void FilterSpectrum::RetrievePrecursorMass()
 
             if (selectedIon.hasCVParam(MS_charge_state))
             {
-                precursorCharge = selectedIon.cvParam(MS_charge_state).valueAs<int>();
+                precursorCharge = selectedIon.cvParamValueOrDefault(MS_charge_state, 0);
             }
             else
             {
@@ -146,7 +146,7 @@ FilterSpectrum::FilterSpectrum(const MS2NoiseFilter::Config& params_,
     {
         if (spectrum->hasCVParam(MS_highest_observed_m_z))
         {
-            windowWidth = spectrum->cvParam(MS_highest_observed_m_z).valueAs<double>();
+            windowWidth = spectrum->cvParamValueOrDefault(MS_highest_observed_m_z, 0.0);
         }
         else
         {
@@ -237,7 +237,7 @@ PWIZ_API_DECL void MS2NoiseFilter::describe(ProcessingMethod& method) const
 
 PWIZ_API_DECL void MS2NoiseFilter::operator () (const SpectrumPtr spectrum) const
 {
-    if (spectrum->cvParam(MS_ms_level).valueAs<int>() > 1 &&
+    if (spectrum->cvParamValueOrDefault(MS_ms_level, 0) > 1 &&
         spectrum->cvParam(MS_MSn_spectrum).empty() == false &&
         spectrum->precursors[0].empty() == false &&
         spectrum->precursors[0].selectedIons.empty() == false &&
@@ -94,7 +94,7 @@ void PrecursorMassFilter::Impl::filter(const SpectrumPtr& spectrum) const
     double upperMassRange = 10000.;
     if (spectrum->hasCVParam(MS_highest_observed_m_z))
     {
-        upperMassRange = spectrum->cvParam(MS_highest_observed_m_z).valueAs<double>();
+        upperMassRange = spectrum->cvParamValueOrDefault(MS_highest_observed_m_z, 0.0);
     }
     
     int precursorCharge = 0;
@@ -110,11 +110,11 @@ void PrecursorMassFilter::Impl::filter(const SpectrumPtr& spectrum) const
         for (size_t j=0; j < precursor.selectedIons.size(); ++j)
         {
             const SelectedIon& selectedIon = precursor.selectedIons[j];
-            precursorMZ = selectedIon.cvParam(MS_selected_ion_m_z).valueAs<double>();
+            precursorMZ = selectedIon.cvParamValueOrDefault(MS_selected_ion_m_z, 0.0);
             if (precursorMZ == 0)
             {
                 // support legacy data
-                precursorMZ = selectedIon.cvParam(MS_m_z).valueAs<double>();
+                precursorMZ = selectedIon.cvParamValueOrDefault(MS_m_z, 0.0);
 
                 if (precursorMZ == 0)
                     //TODO: log warning, unable to read precursor mz
@@ -124,7 +124,7 @@ void PrecursorMassFilter::Impl::filter(const SpectrumPtr& spectrum) const
             if (params.removePrecursor)
                 filterMassList.push_back(PrecursorReferenceMass(PrecursorReferenceMass::Precursor, precursorMZ, 0));
 
-            precursorCharge = selectedIon.cvParam(MS_charge_state).valueAs<int>();
+            precursorCharge = selectedIon.cvParamValueOrDefault(MS_charge_state, 0);
             if (precursorCharge != 0)
             {
                 int charge = precursorCharge;
@@ -253,7 +253,7 @@ PWIZ_API_DECL void PrecursorMassFilter::describe(ProcessingMethod& method) const
 PWIZ_API_DECL void PrecursorMassFilter::operator () (const SpectrumPtr spectrum) const
 {
     if (spectrum->defaultArrayLength > 0 &&
-        spectrum->cvParam(MS_ms_level).valueAs<int>() > 1 &&
+        spectrum->cvParamValueOrDefault(MS_ms_level, 0) > 1 &&
         spectrum->hasCVParam(MS_MSn_spectrum) &&
         !spectrum->precursors.empty() &&
         !spectrum->precursors[0].selectedIons.empty() &&
@@ -115,7 +115,7 @@ PWIZ_API_DECL SpectrumPtr SpectrumList_ChargeFromIsotope::spectrum(size_t index,
 
     // return MS1 as-is
     if (!s->hasCVParam(MS_ms_level) ||
-        s->cvParam(MS_ms_level).valueAs<int>() < 2)
+        s->cvParamValueOrDefault(MS_ms_level, 0) < 2)
         return s;
 
     // return peakless spectrum as-is
@@ -157,17 +157,17 @@ PWIZ_API_DECL SpectrumPtr SpectrumList_ChargeFromIsotope::spectrum(size_t index,
         }
     }
 
-    double precursorMZ = selectedIon.cvParam(MS_selected_ion_m_z).valueAs<double>();
+    double precursorMZ = selectedIon.cvParamValueOrDefault(MS_selected_ion_m_z, 0.0);
     int nPossibleChargeStates = maxCharge_ - minCharge_ + 1;
     int nIsotopePeakPossibilities = maxIsotopePeaks - minIsotopePeaks + 1;
 
     // Get the upper/lower bounds of the precursor isolation window.
     // Of the data I've tested, only Thermo lists isolation window info.
-    double upperIsoWidth = precursor.isolationWindow.cvParam(MS_isolation_window_upper_offset).valueAs<double>(); 
+    double upperIsoWidth = precursor.isolationWindow.cvParamValueOrDefault(MS_isolation_window_upper_offset, 0.0); 
     upperIsoWidth = upperIsoWidth > 0.0 ? upperIsoWidth : defaultIsolationWidth_;
-    double lowerIsoWidth = precursor.isolationWindow.cvParam(MS_isolation_window_lower_offset).valueAs<double>();
+    double lowerIsoWidth = precursor.isolationWindow.cvParamValueOrDefault(MS_isolation_window_lower_offset, 0.0);
     lowerIsoWidth = lowerIsoWidth > 0.0 ? lowerIsoWidth : defaultIsolationWidth_; 
-    double targetIsoMZ = precursor.isolationWindow.cvParam(MS_isolation_window_target_m_z).valueAs<double>();
+    double targetIsoMZ = precursor.isolationWindow.cvParamValueOrDefault(MS_isolation_window_target_m_z, 0.0);
     targetIsoMZ = targetIsoMZ > 0.0 ? targetIsoMZ : precursorMZ;
 
     vector <int> parentIndex;
@@ -518,10 +518,10 @@ void SpectrumList_ChargeFromIsotope::getMS1RetentionTimes()
         {
             throw runtime_error("SpectrumList_chargeFromIsotope: no scanEvent present in raw data!");
         }
-        int scanConfig = s->scanList.scans[0].cvParam(MS_preset_scan_configuration).valueAs<int>();
+        int scanConfig = s->scanList.scans[0].cvParamValueOrDefault(MS_preset_scan_configuration, 0);
         if ( scanConfig == 0 )
         {
-            int level = s->cvParam(MS_ms_level).valueAs<int>();
+            int level = s->cvParamValueOrDefault(MS_ms_level, 0);
             if ( level != 1 ) continue;
         }
         else if ( scanConfig != 1 ) continue; 
@@ -102,7 +102,7 @@ PWIZ_API_DECL SpectrumPtr SpectrumList_ChargeStateCalculator::spectrum(size_t in
 
     // return MS1 as-is
     if (!s->hasCVParam(MS_ms_level) ||
-        s->cvParam(MS_ms_level).valueAs<int>() < 2)
+        s->cvParamValueOrDefault(MS_ms_level, 0) < 2)
         return s;
 
     // return peakless spectrum as-is
@@ -149,7 +149,7 @@ PWIZ_API_DECL SpectrumPtr SpectrumList_ChargeStateCalculator::spectrum(size_t in
         }
     }
 
-    double precursorMZ = selectedIon.cvParam(MS_selected_ion_m_z).valueAs<double>();
+    double precursorMZ = selectedIon.cvParamValueOrDefault(MS_selected_ion_m_z, 0.0);
 
     vector<MZIntensityPair> mzIntensityPairs;
     s->getMZIntensityPairs(mzIntensityPairs);
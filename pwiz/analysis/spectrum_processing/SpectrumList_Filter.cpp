@@ -235,9 +235,9 @@ PWIZ_API_DECL boost::logic::tribool SpectrumList_FilterPredicate_ScanEventSet::a
 {
     Scan dummy;
     const Scan& scan = spectrum.scanList.scans.empty() ? dummy : spectrum.scanList.scans[0];
-    CVParam param = scan.cvParam(MS_preset_scan_configuration);
-    if (param.cvid == CVID_Unknown) return boost::logic::indeterminate;
-    int scanEvent = lexical_cast<int>(param.value);
+    const CVParam* param = scan.findCVParam(MS_preset_scan_configuration);
+    if (!param) return boost::logic::indeterminate;
+    int scanEvent = lexical_cast<int>(param->value);
     bool result = scanEventSet_.contains(scanEvent);
     return result;
 }
@@ -264,9 +264,9 @@ PWIZ_API_DECL boost::logic::tribool SpectrumList_FilterPredicate_ScanTimeRange::
 {
     Scan dummy;
     const Scan& scan = spectrum.scanList.scans.empty() ? dummy : spectrum.scanList.scans[0];
-    CVParam param = scan.cvParam(MS_scan_start_time);
-    if (param.cvid == CVID_Unknown) return boost::logic::indeterminate;
-    double time = param.timeInSeconds();
+    const CVParam* param = scan.findCVParam(MS_scan_start_time);
+    if (!param) return boost::logic::indeterminate;
+    double time = param->timeInSeconds();
 
     return (time>=scanTimeLow_ && time<=scanTimeHigh_);
 }
@@ -284,13 +284,13 @@ PWIZ_API_DECL SpectrumList_FilterPredicate_MSLevelSet::SpectrumList_FilterPredic
 
 PWIZ_API_DECL boost::logic::tribool SpectrumList_FilterPredicate_MSLevelSet::accept(const msdata::Spectrum& spectrum) const
 {
-    CVParam param = spectrum.cvParamChild(MS_spectrum_type);
-    if (param.cvid == CVID_Unknown) return boost::logic::indeterminate;
-    if (!cvIsA(param.cvid, MS_mass_spectrum))
+    const CVParam* param = spectrum.findCVParamChild(MS_spectrum_type);
+    if (!param) return boost::logic::indeterminate;
+    if (!cvIsA(param->cvid, MS_mass_spectrum))
         return true; // MS level filter doesn't affect non-MS spectra
-    param = spectrum.cvParam(MS_ms_level);
-    if (param.cvid == CVID_Unknown) return boost::logic::indeterminate;
-    int msLevel = param.valueAs<int>();
+    param = spectrum.findCVParam(MS_ms_level);
+    if (!param) return boost::logic::indeterminate;
+    int msLevel = param->valueAs<int>();
     bool result = msLevelSet_.contains(msLevel);
     return result;
 }
@@ -308,13 +308,13 @@ PWIZ_API_DECL SpectrumList_FilterPredicate_ChargeStateSet::SpectrumList_FilterPr
 
 PWIZ_API_DECL boost::logic::tribool SpectrumList_FilterPredicate_ChargeStateSet::accept(const msdata::Spectrum& spectrum) const
 {
-    CVParam param = spectrum.cvParamChild(MS_spectrum_type);
-    if (param.cvid == CVID_Unknown) return boost::logic::indeterminate;
-    if (!cvIsA(param.cvid, MS_mass_spectrum))
+    const CVParam* param = spectrum.findCVParamChild(MS_spectrum_type);
+    if (!param) return boost::logic::indeterminate;
+    if (!cvIsA(param->cvid, MS_mass_spectrum))
         return true; // charge state filter doesn't affect non-MS spectra
-    param = spectrum.cvParam(MS_ms_level);
-    if (param.cvid == CVID_Unknown) return boost::logic::indeterminate;
-    int msLevel = param.valueAs<int>();
+    param = spectrum.findCVParam(MS_ms_level);
+    if (!param) return boost::logic::indeterminate;
+    int msLevel = param->valueAs<int>();
     if (msLevel == 1 || // MS1s don't have charge state
         spectrum.precursors.empty()) // can't do much without a precursor
         return false;
@@ -362,9 +362,9 @@ PWIZ_API_DECL boost::logic::tribool SpectrumList_FilterPredicate_PrecursorMzSet:
     double precursorMz = getPrecursorMz(spectrum);
     if (precursorMz == 0)
     {
-        CVParam param = spectrum.cvParam(MS_ms_level);
-        if (param.cvid == CVID_Unknown) return boost::logic::indeterminate;
-        int msLevel = param.valueAs<int>();
+        const CVParam* param = spectrum.findCVParam(MS_ms_level);
+        if (!param) return boost::logic::indeterminate;
+        int msLevel = param->valueAs<int>();
         // If not level 1, then it should have a precursor, so request more meta data.
         if (msLevel != 1) return boost::logic::indeterminate;
     }
@@ -384,9 +384,9 @@ PWIZ_API_DECL double SpectrumList_FilterPredicate_PrecursorMzSet::getPrecursorMz
     {
         for (size_t j = 0; j < spectrum.precursors[i].selectedIons.size(); j++)
         {
-            CVParam param = spectrum.precursors[i].selectedIons[j].cvParam(MS_selected_ion_m_z);
-            if (param.cvid != CVID_Unknown)
-                return lexical_cast<double>(param.value);
+            const CVParam* param = spectrum.precursors[i].selectedIons[j].findCVParam(MS_selected_ion_m_z);
+            if (param)
+                return lexical_cast<double>(param->value);
         }
     }
     return 0;
@@ -432,14 +432,14 @@ PWIZ_API_DECL SpectrumList_FilterPredicate_ActivationType::SpectrumList_FilterPr
 
 PWIZ_API_DECL boost::logic::tribool SpectrumList_FilterPredicate_ActivationType::accept(const msdata::Spectrum& spectrum) const
 {
-    CVParam param = spectrum.cvParamChild(MS_spectrum_type);
-    if (param.cvid == CVID_Unknown) return boost::logic::indeterminate;
-    if (!cvIsA(param.cvid, MS_mass_spectrum))
+    const CVParam* param = spectrum.findCVParamChild(MS_spectrum_type);
+    if (!param) return boost::logic::indeterminate;
+    if (!cvIsA(param->cvid, MS_mass_spectrum))
         return true; // activation filter doesn't affect non-MS spectra
 
-    param = spectrum.cvParam(MS_ms_level);
-    if (param.cvid == CVID_Unknown) return boost::logic::indeterminate;
-    int msLevel = param.valueAs<int>();
+    param = spectrum.findCVParam(MS_ms_level);
+    if (!param) return boost::logic::indeterminate;
+    int msLevel = param->valueAs<int>();
 
     if (msLevel == 1)
         return true; // activation filter doesn't affect MS1 spectra
@@ -525,10 +525,10 @@ PWIZ_API_DECL SpectrumList_FilterPredicate_Polarity::SpectrumList_FilterPredicat
 
 PWIZ_API_DECL boost::logic::tribool SpectrumList_FilterPredicate_Polarity::accept(const msdata::Spectrum& spectrum) const
 {
-    CVParam param = spectrum.cvParamChild(MS_scan_polarity);
-    if (param.cvid == CVID_Unknown)
+    const CVParam* param = spectrum.findCVParamChild(MS_scan_polarity);
+    if (!param)
         return boost::logic::indeterminate;
-    return param.cvid == polarity;
+    return param->cvid == polarity;
 }
 
 
@@ -1996,7 +1996,7 @@ void SpectrumList_MZRefiner::Impl::getMSDataData(const MSData& msd, pwiz::util::
         }
         else if (s->hasCVParam(MS_ms_level))
         {
-            msLevel = s->cvParam(MS_ms_level).valueAs<int>();
+            msLevel = s->cvParamValueOrDefault(MS_ms_level, 0);
         }
         while (s->id == datum->nativeID)
         {
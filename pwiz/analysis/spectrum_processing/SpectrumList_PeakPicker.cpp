@@ -165,7 +165,7 @@ PWIZ_API_DECL SpectrumPtr SpectrumList_PeakPicker::spectrum(size_t index, bool g
             break;
     }
 
-    if (!getBinaryData || !msLevelsToPeakPick_.contains(s->cvParam(MS_ms_level).valueAs<int>()))
+    if (!getBinaryData || !msLevelsToPeakPick_.contains(s->cvParamValueOrDefault(MS_ms_level, 0)))
         return s;
 
     vector<CVParam>& cvParams = s->cvParams;
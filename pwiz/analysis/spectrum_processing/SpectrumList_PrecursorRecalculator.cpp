@@ -151,8 +151,8 @@ PrecursorRecalculator::PrecursorInfo getInitialEstimate(const Spectrum& spectrum
     if (precursor.selectedIons.empty()) return result;
 
     const SelectedIon& selectedIon = precursor.selectedIons[0];
-    result.mz = selectedIon.cvParam(MS_selected_ion_m_z).valueAs<double>();
-    result.charge = selectedIon.cvParam(MS_charge_state).valueAs<int>();
+    result.mz = selectedIon.cvParamValueOrDefault(MS_selected_ion_m_z, 0.0);
+    result.charge = selectedIon.cvParamValueOrDefault(MS_charge_state, 0);
     return result;
 }
 
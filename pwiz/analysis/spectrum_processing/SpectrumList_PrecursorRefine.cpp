@@ -147,12 +147,12 @@ PWIZ_API_DECL SpectrumPtr SpectrumList_PrecursorRefine::spectrum(size_t index, b
 
     if (originalSpectrum->precursors.size() == 0 || 
         originalSpectrum->precursors[0].selectedIons.size() == 0 ||
-        originalSpectrum->precursors[0].selectedIons[0].cvParam(MS_selected_ion_m_z).valueAs<double>() == 0.0)
+        originalSpectrum->precursors[0].selectedIons[0].cvParamValueOrDefault(MS_selected_ion_m_z, 0.0) == 0.0)
         return originalSpectrum;
 
     BOOST_FOREACH(SelectedIon& selectedIon, originalSpectrum->precursors[0].selectedIons)
     {
-        double refined = RefineMassVal(selectedIon.cvParam(MS_selected_ion_m_z).valueAs<double>(), index);
+        double refined = RefineMassVal(selectedIon.cvParamValueOrDefault(MS_selected_ion_m_z, 0.0), index);
         selectedIon.set(MS_selected_ion_m_z, refined);
     }
 
@@ -264,8 +264,8 @@ PWIZ_API_DECL SpectrumList_ScanSummer::SpectrumList_ScanSummer(const SpectrumLis
 
         if (ms2cnt==1) // set some parameters
         {
-            lowerMZlimit = s->scanList.scans[0].scanWindows[0].cvParam(MS_scan_window_lower_limit).valueAs<double>();
-            upperMZlimit = s->scanList.scans[0].scanWindows[0].cvParam(MS_scan_window_upper_limit).valueAs<double>();
+            lowerMZlimit = s->scanList.scans[0].scanWindows[0].cvParamValueOrDefault(MS_scan_window_lower_limit, 0.0);
+            upperMZlimit = s->scanList.scans[0].scanWindows[0].cvParamValueOrDefault(MS_scan_window_upper_limit, 0.0);
             TotalDaltons = upperMZlimit - lowerMZlimit;
         }
 
@@ -382,7 +382,7 @@ PWIZ_API_DECL SpectrumPtr SpectrumList_ScanSummer::spectrum(size_t index, Detail
     size_t summedScanIndex = indexMap.at(index);
     SpectrumPtr summedSpectrum = inner_->spectrum(summedScanIndex, detailLevel);
     
-    if (summedSpectrum->cvParam(MS_ms_level).valueAs<int>() > 1) // MS/MS scan
+    if (summedSpectrum->cvParamValueOrDefault(MS_ms_level, 0) > 1) // MS/MS scan
     {
 
         try
@@ -76,7 +76,7 @@ PWIZ_API_DECL SpectrumPtr SpectrumList_ZeroSamplesFilter::spectrum(size_t index,
 {
     SpectrumPtr s = inner_->spectrum(index, true);
 
-    if (!msLevelsToFilter_.contains(s->cvParam(MS_ms_level).valueAs<int>()))
+    if (!msLevelsToFilter_.contains(s->cvParamValueOrDefault(MS_ms_level, 0)))
         return s;
 
     try
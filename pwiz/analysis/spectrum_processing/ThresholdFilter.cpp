@@ -133,7 +133,7 @@ PWIZ_API_DECL void ThresholdFilter::describe(ProcessingMethod& method) const
 
 PWIZ_API_DECL void ThresholdFilter::operator () (const SpectrumPtr s) const
 {
-    if (!msLevelsToThreshold.contains(s->cvParam(MS_ms_level).valueAs<int>()))
+    if (!msLevelsToThreshold.contains(s->cvParamValueOrDefault(MS_ms_level, 0)))
         return;
 
     // do nothing to empty spectra
@@ -241,8 +241,10 @@ class BinaryIndexStream::Impl
         EntryReader(boost::uint64_t maxIdLength = 0) : maxIdLength_(maxIdLength) {}
         istream& operator() (istream& is, Entry& entry) const
         {
-            is >> entry.id;
-            is.seekg(maxIdLength_ - entry.id.length(), std::ios::cur);
+            // read the whole padded id so that ids with spaces in them (e.g. mzML nativeIDs) survive
+            entry.id.resize(maxIdLength_);
+            is.read(&entry.id[0], maxIdLength_);
+            entry.id.erase(entry.id.find_last_not_of(' ') + 1);
             is.read(reinterpret_cast<char*>(&entry.index), sizeof(entry.index));
             is.read(reinterpret_cast<char*>(&entry.offset), sizeof(entry.offset));
             return is;
@@ -142,6 +142,47 @@ void test()
 }
 
 
+void testIdsWithSpaces()
+{
+    if (os_) cout << "Testing BinaryIndexStream (ids with spaces)" << endl;
+
+    shared_ptr<stringstream> indexStreamPtr(new stringstream);
+
+    vector<Index::Entry> entries;
+    for (size_t i=0; i < 10; ++i)
+    {
+        Index::Entry entry;
+        entry.id = "controllerType=0 controllerNumber=1 scan=" + lexical_cast<string>(i+1);
+        entry.index = i;
+        entry.offset = i*100;
+        entries.push_back(entry);
+    }
+
+    BinaryIndexStream index(indexStreamPtr);
+    index.create(entries);
+    unit_assert(index.size() == 10);
+
+    for (size_t i=0; i < 10; ++i)
+    {
+        string id = "controllerType=0 controllerNumber=1 scan=" + lexical_cast<string>(i+1);
+
+        Index::EntryPtr entryPtr = index.find(i);
+        unit_assert(entryPtr.get());
+        unit_assert_operator_equal(id, entryPtr->id);
+        unit_assert(entryPtr->index == i);
+
+        entryPtr = index.find(id);
+        unit_assert(entryPtr.get());
+        unit_assert_operator_equal(id, entryPtr->id);
+        unit_assert(entryPtr->index == i);
+        unit_assert(entryPtr->offset == Index::stream_offset(i*100));
+    }
+
+    unit_assert(!index.find("controllerType=0 controllerNumber=1").get());
+    unit_assert(!index.find("controllerType=0 controllerNumber=1 scan=42").get());
+}
+
+
 void testThreadSafetyWorker(boost::barrier* testBarrier, BinaryIndexStream* testIndex)
 {
     testBarrier->wait(); // wait until all threads have started
@@ -216,6 +257,7 @@ int main(int argc, char* argv[])
     {
         if (argc>1 && !strcmp(argv[1],"-v")) os_ = &cout;
         test();
+        testIdsWithSpaces();
         testThreadSafety();
     }
     catch (exception& e)
@@ -74,6 +74,21 @@ double timeInSecondsHelper(CVID units, double value)
     return 0; 
 }
 
+PWIZ_API_DECL void CVParam::cacheNumericValue()
+{
+    numericTextLength_ = NoNumericValue;
+    if (value.empty() || value.length() > MaxNumericTextLength)
+        return;
+
+    // the same conversion as the optimized lexical_cast<double>, which throws if nothing could be converted
+    const char* text = value.c_str();
+    char* end = const_cast<char*>(text);
+    double number = STRTOD(text, &end);
+    if (number == 0.0 && end == text)
+        return;
+    setNumericValue(number);
+}
+
 PWIZ_API_DECL double CVParam::timeInSeconds() const
 {
     return timeInSecondsHelper(units, valueAs<double>());
@@ -177,61 +192,72 @@ PWIZ_API_DECL bool UserParam::operator!=(const UserParam& that) const
 //
 
 
-PWIZ_API_DECL CVParam ParamContainer::cvParam(CVID cvid) const
+PWIZ_API_DECL const CVParam* ParamContainer::findCVParam(CVID cvid) const
 {
     // first look in our own cvParams
 
     vector<CVParam>::const_iterator it = 
         find_if(cvParams.begin(), cvParams.end(), CVParamIs(cvid));
    
-    if (it!=cvParams.end()) return *it;
+    if (it!=cvParams.end()) return &*it;
 
     // then recurse into paramGroupPtrs
 
     for (vector<ParamGroupPtr>::const_iterator jt=paramGroupPtrs.begin();
          jt!=paramGroupPtrs.end(); ++jt)
     {
-        CVParam result = jt->get() ? (*jt)->cvParam(cvid) : CVParam();
-        if (result.cvid != CVID_Unknown)
+        const CVParam* result = jt->get() ? (*jt)->findCVParam(cvid) : 0;
+        if (result)
             return result;
     }
 
-    return CVParam();
+    return 0;
 }
 
 
-PWIZ_API_DECL CVParam ParamContainer::cvParamChild(CVID cvid) const
+PWIZ_API_DECL const CVParam* ParamContainer::findCVParamChild(CVID cvid) const
 {
     // first look in our own cvParams
 
     vector<CVParam>::const_iterator it = 
         find_if(cvParams.begin(), cvParams.end(), CVParamIsChildOf(cvid));
    
-    if (it!=cvParams.end()) return *it;
+    if (it!=cvParams.end()) return &*it;
 
     // then recurse into paramGroupPtrs
 
     for (vector<ParamGroupPtr>::const_iterator jt=paramGroupPtrs.begin();
          jt!=paramGroupPtrs.end(); ++jt)
     {
-        CVParam result = jt->get() ? (*jt)->cvParamChild(cvid) : CVParam();
-        if (result.cvid != CVID_Unknown)
+        const CVParam* result = jt->get() ? (*jt)->findCVParamChild(cvid) : 0;
+        if (result)
             return result;
     }
 
-    return CVParam();
+    return 0;
 }
 
 
-PWIZ_API_DECL vector<CVParam> ParamContainer::cvParamChildren(CVID cvid) const
+PWIZ_API_DECL CVParam ParamContainer::cvParam(CVID cvid) const
 {
-    vector<CVParam> results;
+    const CVParam* result = findCVParam(cvid);
+    return result ? *result : CVParam();
+}
 
-    // first look in our own cvParams
 
-    vector<CVParam>::const_iterator it;
+PWIZ_API_DECL CVParam ParamContainer::cvParamChild(CVID cvid) const
+{
+    const CVParam* result = findCVParamChild(cvid);
+    return result ? *result : CVParam();
+}
+
 
-    BOOST_FOREACH(const CVParam& cvParam, cvParams)
+namespace {
+void appendCVParamChildren(const ParamContainer& pc, CVID cvid, vector<CVParam>& results)
+{
+    // first look in our own cvParams
+
+    BOOST_FOREACH(const CVParam& cvParam, pc.cvParams)
     {
         if (cvIsA(cvParam.cvid, cvid))
             results.push_back(cvParam);
@@ -239,27 +265,29 @@ PWIZ_API_DECL vector<CVParam> ParamContainer::cvParamChildren(CVID cvid) const
 
     // then recurse into paramGroupPtrs
 
-    BOOST_FOREACH(const ParamGroupPtr& paramGroupPtr, paramGroupPtrs)
-    {
-        vector<CVParam> pgResults = paramGroupPtr->cvParamChildren(cvid);
-        results.insert(results.end(), pgResults.begin(), pgResults.end());
-    }
+    BOOST_FOREACH(const ParamGroupPtr& paramGroupPtr, pc.paramGroupPtrs)
+        appendCVParamChildren(*paramGroupPtr, cvid, results);
+}
+} // namespace
+
 
+PWIZ_API_DECL vector<CVParam> ParamContainer::cvParamChildren(CVID cvid) const
+{
+    vector<CVParam> results;
+    appendCVParamChildren(*this, cvid, results);
     return results;
 }
 
 
 PWIZ_API_DECL bool ParamContainer::hasCVParam(CVID cvid) const
 {
-    CVParam param = cvParam(cvid);
-    return (param.cvid != CVID_Unknown);
+    return findCVParam(cvid) != 0;
 }
 
 
 PWIZ_API_DECL bool ParamContainer::hasCVParamChild(CVID cvid) const
 {
-    CVParam param = cvParamChild(cvid);
-    return (param.cvid != CVID_Unknown);
+    return findCVParamChild(cvid) != 0;
 }
 
 
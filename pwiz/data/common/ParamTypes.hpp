@@ -51,58 +51,60 @@ struct PWIZ_API_DECL CVParam
     :   cvid(_cvid), 
         value(boost::lexical_cast<std::string>(_value)),
         units(_units)
-    {}
+    {cacheNumericValue();}
 
     CVParam(CVID _cvid, double _value, CVID _units = CVID_Unknown)
     :   cvid(_cvid), 
         value(boost::lexical_cast<std::string>(_value)),
         units(_units)
-    {}
+    {setNumericValue(_value);}
 
     CVParam(CVID _cvid, int _value, CVID _units = CVID_Unknown)
     :   cvid(_cvid), 
         value(boost::lexical_cast<std::string>(_value)),
         units(_units)
-    {}
+    {setNumericValue(_value);}
 
     CVParam(CVID _cvid, long _value, CVID _units = CVID_Unknown)
     :   cvid(_cvid), 
         value(boost::lexical_cast<std::string>(_value)),
         units(_units)
-    {}
+    {setNumericValue((double) _value);}
 
     CVParam(CVID _cvid, unsigned int _value, CVID _units = CVID_Unknown)
     :   cvid(_cvid), 
         value(boost::lexical_cast<std::string>(_value)),
         units(_units)
-    {}
+    {setNumericValue(_value);}
 
     CVParam(CVID _cvid, unsigned long _value, CVID _units = CVID_Unknown)
     :   cvid(_cvid), 
         value(boost::lexical_cast<std::string>(_value)),
         units(_units)
-    {}
+    {setNumericValue((double) _value);}
 
     CVParam(CVID _cvid, std::string _value, CVID _units = CVID_Unknown)
     :   cvid(_cvid), 
         value(_value),
-        units(_units)
+        units(_units),
+        numericTextLength_(NoNumericValue)
     {}
 
     CVParam(CVID _cvid, const char* _value, CVID _units = CVID_Unknown)
     :   cvid(_cvid), 
         value(_value),
-        units(_units)
+        units(_units),
+        numericTextLength_(NoNumericValue)
     {}
 
     /// special case for bool (no lexical_cast)
     CVParam(CVID _cvid, bool _value, CVID _units = CVID_Unknown)
-    :   cvid(_cvid), value(_value ? "true" : "false"), units(_units)
+    :   cvid(_cvid), value(_value ? "true" : "false"), units(_units), numericTextLength_(NoNumericValue)
     {}
 
     /// constructor for non-valued CVParams
     CVParam(CVID _cvid = CVID_Unknown)
-    :   cvid(_cvid), units(CVID_Unknown)
+    :   cvid(_cvid), units(CVID_Unknown), numericTextLength_(NoNumericValue)
     {}
 
     ~CVParam();
@@ -140,6 +142,39 @@ struct PWIZ_API_DECL CVParam
     }
 
     bool empty() const {return cvid==CVID_Unknown && value.empty() && units==CVID_Unknown;}
+
+    /// parses the value text as a number once and keeps the number, so that valueAs<double>() and
+    /// valueAs<float>() don't parse it on every call (until value is changed);
+    /// the numeric constructors keep their number without parsing the text
+    void cacheNumericValue();
+
+    /// returns true iff valueAs<double>() returns a kept number for the current value text
+    bool hasNumericValue() const
+    {
+        return numericTextLength_ <= MaxNumericTextLength && numericTextLength_ == value.length() &&
+               std::char_traits<char>::compare(numericText_, value.data(), numericTextLength_) == 0;
+    }
+
+    private:
+
+    // the kept number and the value text it belongs to; the text is stored inline so that checking
+    // it against value doesn't allocate (longer values are parsed on every call)
+    enum {MaxNumericTextLength = 23, NoNumericValue = 0xFF};
+    double numericValue_;
+    char numericText_[MaxNumericTextLength];
+    unsigned char numericTextLength_;
+
+    void setNumericValue(double number)
+    {
+        if (value.empty() || value.length() > MaxNumericTextLength)
+        {
+            numericTextLength_ = NoNumericValue;
+            return;
+        }
+        numericValue_ = number;
+        value.copy(numericText_, value.length());
+        numericTextLength_ = (unsigned char) value.length();
+    }
 };
 
 
@@ -178,6 +213,25 @@ inline bool CVParam::valueAs<bool>() const
 }
 
 
+/// special cases for floating point: the number kept by cacheNumericValue() (or a numeric constructor) is used if
+/// it belongs to the current value text
+template<>
+inline double CVParam::valueAs<double>() const
+{
+    if (hasNumericValue())
+        return numericValue_;
+    return !value.empty() ? boost::lexical_cast<double>(value) : 0.0;
+}
+
+template<>
+inline float CVParam::valueAs<float>() const
+{
+    if (hasNumericValue())
+        return (float) numericValue_;
+    return !value.empty() ? boost::lexical_cast<float>(value) : 0.0f;
+}
+
+
 PWIZ_API_DECL std::ostream& operator<<(std::ostream& os, const CVParam& param);
 
 
@@ -276,6 +330,40 @@ struct PWIZ_API_DECL ParamContainer
     /// returns true iff cvParams contains a child (is_a) of cvid (recursive)
     bool hasCVParamChild(CVID cvid) const;
 
+    /// finds cvid in the container without copying it:
+    /// - returns a pointer to the first CVParam result such that (result.cvid == cvid)
+    /// - if not found, returns NULL
+    /// - recursive: looks into paramGroupPtrs
+    const CVParam* findCVParam(CVID cvid) const;
+
+    /// finds child of cvid in the container without copying it:
+    /// - returns a pointer to the first CVParam result such that (result.cvid is_a cvid)
+    /// - if not found, returns NULL
+    /// - recursive: looks into paramGroupPtrs
+    const CVParam* findCVParamChild(CVID cvid) const;
+
+    /// finds cvid in the container:
+    /// - returns first CVParam result's value (as with valueAs) such that (result.cvid == cvid)
+    /// - if not found, returns defaultValue
+    /// - recursive: looks into paramGroupPtrs
+    template <typename value_type>
+    value_type cvParamValueOrDefault(CVID cvid, value_type defaultValue) const
+    {
+        const CVParam* param = findCVParam(cvid);
+        return param ? param->valueAs<value_type>() : defaultValue;
+    }
+
+    /// finds child of cvid in the container:
+    /// - returns first CVParam result's value (as with valueAs) such that (result.cvid is_a cvid)
+    /// - if not found, returns defaultValue
+    /// - recursive: looks into paramGroupPtrs
+    template <typename value_type>
+    value_type cvParamChildValueOrDefault(CVID cvid, value_type defaultValue) const
+    {
+        const CVParam* param = findCVParamChild(cvid);
+        return param ? param->valueAs<value_type>() : defaultValue;
+    }
+
     /// finds UserParam with specified name 
     /// - returns UserParam() if name not found 
     /// - not recursive: looks only at local userParams
@@ -257,6 +257,102 @@ void testParamContainer()
 }
 
 
+void testParamContainerFind()
+{
+    ParamContainer pc;
+    pc.cvParams.push_back(MS_MSn_spectrum);
+    pc.cvParams.push_back(CVParam(MS_ms_level, 2));
+    pc.cvParams.push_back(CVParam(MS_base_peak_m_z, 445.12));
+
+    ParamGroupPtr pg(new ParamGroup);
+    pg->cvParams.push_back(CVParam(MS_scan_start_time, 1.5, UO_minute));
+    pg->cvParams.push_back(MS_positive_scan);
+    pc.paramGroupPtrs.push_back(pg);
+
+    // finds point into the container, including its param groups
+    unit_assert(pc.findCVParam(MS_ms_level) == &pc.cvParams[1]);
+    unit_assert(pc.findCVParam(MS_scan_start_time) == &pg->cvParams[0]);
+    unit_assert(pc.findCVParam(MS_total_ion_current) == 0);
+    unit_assert(pc.findCVParamChild(MS_spectrum_type) == &pc.cvParams[0]);
+    unit_assert(pc.findCVParamChild(MS_scan_polarity) == &pg->cvParams[1]);
+    unit_assert(pc.findCVParamChild(MS_dissociation_method) == 0);
+
+    unit_assert_operator_equal(2, pc.cvParamValueOrDefault(MS_ms_level, 0));
+    unit_assert_operator_equal(445.12, pc.cvParamValueOrDefault(MS_base_peak_m_z, 0.0));
+    unit_assert_operator_equal(1.5, pc.cvParamValueOrDefault(MS_scan_start_time, 0.0));
+    unit_assert_operator_equal(-1, pc.cvParamValueOrDefault(MS_charge_state, -1));
+    unit_assert_operator_equal("445.12", pc.cvParamValueOrDefault(MS_base_peak_m_z, string()));
+    unit_assert_operator_equal(2, pc.cvParamChildValueOrDefault(MS_ms_level, 0));
+    unit_assert_operator_equal(42.0, pc.cvParamChildValueOrDefault(MS_dissociation_method, 42.0));
+
+    // a param without a value gives valueAs's result, not the default
+    unit_assert_operator_equal(0, pc.cvParamValueOrDefault(MS_MSn_spectrum, 7));
+}
+
+
+void testNumericValue()
+{
+    // numeric constructors keep their number, and it's the number the value text parses to
+    double values[] = {2000.012345, 1.0/3, -0.0, 1e-300, 123456789.123456789};
+    for (size_t i=0; i < sizeof(values) / sizeof(double); ++i)
+    {
+        CVParam param(MS_base_peak_m_z, values[i]);
+        unit_assert(param.hasNumericValue());
+        unit_assert_operator_equal(boost::lexical_cast<double>(param.value), param.valueAs<double>());
+        unit_assert_operator_equal((float) values[i], param.valueAs<float>());
+    }
+
+    CVParam floatParam(MS_base_peak_m_z, 0.1f);
+    unit_assert(floatParam.hasNumericValue());
+    unit_assert_operator_equal(boost::lexical_cast<double>(floatParam.value), floatParam.valueAs<double>());
+    unit_assert_operator_equal(0.1f, floatParam.valueAs<float>());
+
+    CVParam intParam(MS_ms_level, 2);
+    unit_assert(intParam.hasNumericValue());
+    unit_assert_operator_equal(2.0, intParam.valueAs<double>());
+    unit_assert_operator_equal(2, intParam.valueAs<int>());
+
+    // changing the value text leaves the kept number behind
+    CVParam param(MS_scan_start_time, 1.5, UO_minute);
+    param.value = "2.5";
+    unit_assert(!param.hasNumericValue());
+    unit_assert_operator_equal(2.5, param.valueAs<double>());
+    unit_assert_operator_equal(150.0, param.timeInSeconds());
+    param.value[0] = '3';
+    unit_assert_operator_equal(3.5, param.valueAs<double>());
+
+    // text values are parsed on request, and then kept
+    CVParam textParam(MS_scan_start_time, "5.890500", UO_minute);
+    unit_assert(!textParam.hasNumericValue());
+    unit_assert_operator_equal(5.8905, textParam.valueAs<double>());
+    textParam.cacheNumericValue();
+    unit_assert(textParam.hasNumericValue());
+    unit_assert_operator_equal(5.8905, textParam.valueAs<double>());
+    unit_assert(textParam == CVParam(MS_scan_start_time, "5.890500", UO_minute));
+
+    // a copy keeps the number
+    CVParam copy = textParam;
+    unit_assert(copy.hasNumericValue());
+    unit_assert_operator_equal(5.8905, copy.valueAs<double>());
+
+    // values that aren't numbers (or too long to keep) behave as before
+    CVParam goober(MS_m_z, "goober");
+    goober.cacheNumericValue();
+    unit_assert(!goober.hasNumericValue());
+    unit_assert_throws(goober.valueAs<double>(), boost::bad_lexical_cast);
+
+    CVParam empty(MS_m_z);
+    empty.cacheNumericValue();
+    unit_assert(!empty.hasNumericValue());
+    unit_assert_operator_equal(0.0, empty.valueAs<double>());
+
+    CVParam longText(MS_m_z, "1.00000000000000000000000000000000000001");
+    longText.cacheNumericValue();
+    unit_assert(!longText.hasNumericValue());
+    unit_assert_operator_equal(1.0, longText.valueAs<double>());
+}
+
+
 int main(int argc, char* argv[])
 {
     TEST_PROLOG(argc, argv)
@@ -268,6 +364,8 @@ int main(int argc, char* argv[])
         testIs();
         testIsChildOf();
         testParamContainer();
+        testParamContainerFind();
+        testNumericValue();
     }
     catch (exception& e)
     {
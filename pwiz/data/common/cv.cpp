@@ -33,6 +33,9 @@
 #include "cv.hpp"
 #include "pwiz/utility/misc/Std.hpp"
 #include "pwiz/utility/misc/Singleton.hpp"
+#include "pwiz/utility/misc/Once.hpp"
+#include <boost/cstdint.hpp>
+#include <boost/bind.hpp>
 
 
 namespace pwiz {
@@ -21479,37 +21482,8625 @@ PropertyValuePair propertyValue_[] =
 const size_t propertyValueSize_ = sizeof(propertyValue_)/sizeof(PropertyValuePair);
 
 
+// all the IsA ancestors of each term (in termInfos_ order), sorted by CVID
+const CVID isAClosure_[] =
+{
+    MS_object_attribute, MS_sample_attribute,
+    MS_object_attribute, MS_sample_attribute,
+    MS_object_attribute, MS_sample_attribute,
+    MS_object_attribute, MS_sample_attribute,
+    MS_object_attribute, MS_sample_attribute,
+    MS_object_attribute, MS_sample_attribute,
+    MS_scan_attribute, MS_object_attribute,
+    MS_measurement_method,
+    MS_mass_analyzer_attribute,
+    MS_scan_attribute, MS_object_attribute,
+    MS_scan_attribute, MS_object_attribute, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_mass_analyzer_attribute,
+    MS_mass_analyzer_attribute,
+    MS_mass_analyzer_attribute,
+    MS_mass_analyzer_attribute,
+    MS_detector_attribute,
+    MS_detector_attribute,
+    MS_instrument_attribute, MS_object_attribute,
+    MS_data_transformation, MS_data_processing_action,
+    MS_data_transformation, MS_data_processing_action,
+    MS_data_transformation, MS_data_processing_action,
+    MS_ion_selection_attribute, MS_object_attribute,
+    MS_ion_selection_attribute, MS_object_attribute,
+    MS_precursor_activation_attribute,
+    MS_sample_state, MS_object_attribute, MS_sample_attribute,
+    MS_sample_state, MS_object_attribute, MS_sample_attribute,
+    MS_sample_state, MS_object_attribute, MS_sample_attribute,
+    MS_sample_state, MS_object_attribute, MS_sample_attribute,
+    MS_sample_state, MS_object_attribute, MS_sample_attribute,
+    MS_sample_state, MS_object_attribute, MS_sample_attribute,
+    MS_object_attribute, MS_sample_attribute,
+    MS_inlet_type,
+    MS_inlet_type,
+    MS_inlet_type,
+    MS_inlet_type,
+    MS_inlet_type,
+    MS_inlet_type,
+    MS_inlet_type,
+    MS_inlet_type,
+    MS_inlet_type,
+    MS_inlet_type,
+    MS_inlet_type,
+    MS_inlet_type,
+    MS_inlet_type,
+    MS_inlet_type,
+    MS_inlet_type,
+    MS_ionization_type, MS_atmospheric_pressure_ionization,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_ionization_type, MS_desorption_ionization,
+    MS_ion_trap, MS_linear_ion_trap, MS_mass_analyzer_type,
+    MS_mass_analyzer_type,
+    MS_mass_analyzer_type,
+    MS_mass_analyzer_type,
+    MS_ion_trap, MS_mass_analyzer_type,
+    MS_ion_trap, MS_linear_ion_trap, MS_mass_analyzer_type,
+    MS_mass_analyzer_type,
+    MS_resolution_measurement_method, MS_measurement_method,
+    MS_resolution_measurement_method, MS_measurement_method,
+    MS_resolution_measurement_method, MS_measurement_method,
+    MS_scan_direction,
+    MS_scan_direction,
+    MS_scan_law,
+    MS_scan_law,
+    MS_scan_law,
+    MS_reflectron_state, MS_mass_analyzer_attribute,
+    MS_reflectron_state, MS_mass_analyzer_attribute,
+    MS_detector_type,
+    MS_detector_type, MS_conversion_dynode,
+    MS_detector_type, MS_conversion_dynode,
+    MS_detector_type,
+    MS_detector_type, MS_electron_multiplier,
+    MS_detector_type,
+    MS_detector_type, MS_focal_plane_collector,
+    MS_detector_type, MS_array_detector,
+    MS_detector_type,
+    MS_detector_type,
+    MS_detector_acquisition_mode,
+    MS_detector_acquisition_mode,
+    MS_detector_acquisition_mode,
+    MS_detector_acquisition_mode,
+    MS_instrument_model,
+    MS_instrument_model,
+    MS_instrument_model, MS_Varian_instrument_model,
+    MS_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model,
+    MS_spectrum_representation,
+    MS_spectrum_representation,
+    MS_scan_polarity, MS_object_attribute, MS_chromatogram_attribute,
+    MS_scan_polarity, MS_object_attribute, MS_chromatogram_attribute,
+    MS_intensity_unit,
+    MS_intensity_unit,
+    MS_dissociation_method,
+    MS_dissociation_method,
+    MS_dissociation_method,
+    MS_dissociation_method,
+    MS_precursor_activation_attribute,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_Applied_Biosystems_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_apex_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_apex_series,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_flex_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_flex_series,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_BioTOF_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_BioTOF_series,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_esquire_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_esquire_series,
+    MS_instrument_model, MS_IonSpec_instrument_model, MS_Varian_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_HCT_Series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_HCT_Series,
+    MS_instrument_model, MS_IonSpec_instrument_model, MS_Varian_instrument_model,
+    MS_instrument_model, MS_IonSpec_instrument_model, MS_Varian_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Finnigan_MAT_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Finnigan_MAT_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Finnigan_MAT_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Finnigan_MAT_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Finnigan_MAT_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_flex_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_micrOTOF_series,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_IonSpec_instrument_model, MS_Varian_instrument_model,
+    MS_instrument_model, MS_IonSpec_instrument_model, MS_Varian_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_flex_series,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_IonSpec_instrument_model, MS_Varian_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_flex_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_flex_series,
+    MS_instrument_model, MS_Applied_Biosystems_instrument_model,
+    MS_instrument_model, MS_Applied_Biosystems_instrument_model,
+    MS_measurement_method,
+    MS_measurement_method,
+    MS_peak,
+    MS_ion_optics, MS_ion_optics_attribute,
+    MS_ion_optics, MS_ion_optics_type,
+    MS_ionization_type,
+    MS_data_file_content, MS_chromatogram_type, MS_mass_chromatogram,
+    MS_instrument_attribute, MS_object_attribute,
+    MS_ionization_type, MS_atmospheric_pressure_ionization,
+    MS_ionization_type,
+    MS_dissociation_method,
+    MS_precursor_activation_attribute,
+    MS_ion_optics, MS_ion_optics_type,
+    MS_ionization_type,
+    MS_inlet_type,
+    MS_inlet_type,
+    MS_dissociation_method,
+    MS_detector_type,
+    MS_mass_analyzer_type,
+    MS_ionization_type,
+    MS_ionization_type, MS_desorption_ionization,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_dissociation_method,
+    MS_mass_analyzer_type,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_ion_optics, MS_ion_optics_type,
+    MS_ionization_type,
+    MS_ionization_type, MS_surface_ionization,
+    MS_ionization_type, MS_surface_ionization,
+    MS_ion_optics, MS_ion_optics_type,
+    MS_dissociation_method,
+    MS_mass_analyzer_type,
+    MS_spectrum_attribute, MS_object_attribute,
+    MS_ion_optics, MS_ion_optics_type,
+    MS_mass_analyzer_type,
+    MS_ion_trap, MS_mass_analyzer_type,
+    MS_data_file_content, MS_spectrum_type,
+    MS_ion_optics, MS_ion_optics_type,
+    MS_ion_optics, MS_ion_optics_attribute,
+    MS_ion_optics, MS_ion_optics_type,
+    MS_ion_optics, MS_ion_optics_attribute,
+    MS_ion_optics, MS_ion_optics_type,
+    MS_ion_optics, MS_ion_optics_type,
+    MS_ion_optics, MS_ion_optics_type,
+    MS_ion_optics, MS_ion_optics_attribute,
+    MS_ion_optics, MS_ion_optics_type,
+    MS_mass_spectrum, MS_data_file_content, MS_spectrum_type,
+    MS_mass_spectrum, MS_data_file_content, MS_spectrum_type,
+    MS_mass_spectrum, MS_data_file_content, MS_spectrum_type,
+    MS_mass_spectrum, MS_data_file_content, MS_spectrum_type,
+    MS_modification_parameters,
+    MS_mass_spectrum, MS_data_file_content, MS_spectrum_type,
+    MS_mass_spectrum, MS_data_file_content, MS_spectrum_type,
+    MS_detector_type,
+    MS_detector_type,
+    MS_detector_type,
+    MS_detector_type,
+    MS_detector_type,
+    MS_detector_type,
+    MS_detector_type,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_ionization_type, MS_atmospheric_pressure_ionization,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_ionization_type, MS_desorption_ionization,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_source_attribute,
+    MS_ionization_type, MS_desorption_ionization,
+    MS_ionization_type,
+    MS_inlet_type,
+    MS_ionization_type, MS_electrospray_ionization,
+    MS_ionization_type, MS_electrospray_ionization,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_ionization_type, MS_desorption_ionization,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_ionization_type,
+    MS_precursor_activation_attribute,
+    MS_precursor_activation_attribute,
+    MS_dissociation_method, MS_collision_induced_dissociation,
+    MS_dissociation_method,
+    MS_dissociation_method,
+    MS_ionization_type,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_object_attribute,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model,
+    MS_mass_analyzer_type,
+    MS_inlet_type, MS_electrospray_inlet,
+    MS_source_attribute,
+    MS_ion_optics,
+    MS_instrument_model,
+    MS_instrument_model,
+    MS_instrument_model,
+    MS_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model,
+    MS_object_attribute,
+    MS_spectrum_attribute, MS_object_attribute,
+    MS_object_attribute,
+    MS_object_attribute, MS_selection_window_attribute,
+    MS_object_attribute, MS_selection_window_attribute,
+    MS_scan_attribute, MS_object_attribute,
+    MS_object_attribute,
+    MS_spectrum_attribute, MS_object_attribute,
+    MS_spectrum_attribute, MS_object_attribute,
+    MS_precursor_activation_attribute,
+    MS_spectrum_attribute, MS_object_attribute,
+    MS_scan_attribute, MS_object_attribute,
+    MS_binary_data_array,
+    MS_binary_data_array,
+    MS_binary_data_array,
+    MS_binary_data_array,
+    MS_binary_data_type,
+    MS_binary_data_type,
+    MS_binary_data_type,
+    MS_binary_data_type,
+    MS_binary_data_type,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_spectrum_attribute, MS_object_attribute, MS_chromatogram_attribute,
+    MS_spectrum_attribute, MS_object_attribute, MS_chromatogram_attribute,
+    MS_instrument_attribute, MS_object_attribute,
+    MS_data_transformation,
+    MS_software, MS_Thermo_Finnigan_software, MS_acquisition_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Thermo_Finnigan_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Waters_software, MS_acquisition_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Bruker_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Applied_Biosystems_software, MS_acquisition_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Applied_Biosystems_software, MS_acquisition_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_data_processing_software,
+    MS_software, MS_Applied_Biosystems_software, MS_acquisition_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Bruker_software, MS_acquisition_software,
+    MS_software, MS_data_processing_software,
+    MS_software, MS_data_processing_software,
+    MS_data_transformation,
+    MS_data_transformation, MS_file_format_conversion,
+    MS_data_transformation, MS_file_format_conversion,
+    MS_data_transformation, MS_file_format_conversion,
+    MS_object_attribute,
+    MS_object_attribute,
+    MS_software, MS_SCIEX_software, MS_acquisition_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_data_processing_software,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_file_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_data_file_checksum_type,
+    MS_data_file_checksum_type,
+    MS_spectra_combination,
+    MS_spectra_combination,
+    MS_binary_data_compression_type,
+    MS_spectra_combination,
+    MS_binary_data_compression_type,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_mass_spectrum, MS_data_file_content, MS_spectrum_type,
+    MS_mass_spectrum, MS_data_file_content, MS_spectrum_type,
+    MS_mass_spectrum, MS_data_file_content, MS_spectrum_type,
+    MS_mass_spectrum, MS_data_file_content, MS_spectrum_type,
+    MS_mass_spectrum, MS_data_file_content, MS_spectrum_type,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_object_attribute,
+    MS_object_attribute, MS_contact_attribute,
+    MS_object_attribute, MS_contact_attribute,
+    MS_object_attribute, MS_contact_attribute,
+    MS_object_attribute, MS_contact_attribute,
+    MS_object_attribute, MS_contact_attribute,
+    MS_software, MS_data_processing_software,
+    MS_data_transformation, MS_data_processing_action,
+    MS_data_transformation, MS_data_processing_action,
+    MS_data_transformation, MS_data_processing_action, MS_data_filtering,
+    MS_binary_data_array,
+    MS_ion_optics,
+    MS_dissociation_method,
+    MS_dissociation_method,
+    MS_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Waters_software, MS_analysis_software, MS_data_processing_software,
+    MS_instrument_model, MS_Shimadzu_instrument_model,
+    MS_instrument_model, MS_Shimadzu_instrument_model,
+    MS_instrument_model, MS_Shimadzu_instrument_model, MS_Shimadzu_Scientific_Instruments_instrument_model,
+    MS_instrument_model, MS_Shimadzu_instrument_model, MS_Shimadzu_Scientific_Instruments_instrument_model,
+    MS_instrument_model, MS_Shimadzu_instrument_model, MS_Shimadzu_Scientific_Instruments_instrument_model,
+    MS_instrument_model, MS_Shimadzu_instrument_model, MS_Shimadzu_MALDI_TOF_instrument_model,
+    MS_instrument_model, MS_Shimadzu_instrument_model, MS_Shimadzu_MALDI_TOF_instrument_model,
+    MS_instrument_model, MS_Shimadzu_instrument_model, MS_Shimadzu_MALDI_TOF_instrument_model,
+    MS_instrument_model, MS_Shimadzu_instrument_model, MS_Shimadzu_MALDI_TOF_instrument_model,
+    MS_instrument_model, MS_Shimadzu_instrument_model, MS_Shimadzu_MALDI_TOF_instrument_model,
+    MS_instrument_model, MS_Shimadzu_instrument_model, MS_Shimadzu_MALDI_TOF_instrument_model,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_software, MS_analysis_software, MS_data_processing_software,
+    MS_scan_attribute, MS_object_attribute,
+    MS_binary_data_array,
+    MS_spectrum_attribute, MS_object_attribute, MS_chromatogram_attribute,
+    MS_spectrum_attribute, MS_object_attribute, MS_chromatogram_attribute,
+    MS_data_file_content, MS_spectrum_type,
+    MS_detector_type, MS_array_detector,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_detector_type,
+    MS_data_file_content, MS_chromatogram_type, MS_mass_chromatogram,
+    MS_data_file_content, MS_chromatogram_type, MS_mass_chromatogram,
+    MS_data_processing_parameter,
+    MS_data_processing_parameter,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_ion_selection_attribute, MS_object_attribute,
+    MS_instrument_model, MS_Thermo_Finnigan_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_software, MS_Thermo_Finnigan_software, MS_analysis_software, MS_data_processing_software,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_Applied_Biosystems_instrument_model,
+    MS_software, MS_SCIEX_software, MS_acquisition_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_SCIEX_software, MS_acquisition_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_SCIEX_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_SCIEX_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_SCIEX_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_SCIEX_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_SCIEX_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_SCIEX_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_SCIEX_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_SCIEX_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_SCIEX_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_SCIEX_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_SCIEX_software,
+    MS_software, MS_SCIEX_software,
+    MS_software, MS_SCIEX_software, MS_analysis_software, MS_data_processing_software,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_software, MS_Agilent_software, MS_acquisition_software,
+    MS_software, MS_Agilent_software, MS_acquisition_software,
+    MS_software, MS_Agilent_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Agilent_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Agilent_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Agilent_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Agilent_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Agilent_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Agilent_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Agilent_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Agilent_software, MS_acquisition_software, MS_analysis_software, MS_data_processing_software,
+    MS_software,
+    MS_software,
+    MS_software,
+    MS_software,
+    MS_software,
+    MS_software,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_apex_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_flex_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_HCT_Series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_HCT_Series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_HCT_Series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_flex_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_micrOTOF_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_micrOTOF_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_micrOTOF_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_flex_series,
+    MS_software, MS_Bruker_software, MS_acquisition_software,
+    MS_software, MS_Bruker_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Bruker_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Bruker_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Bruker_software,
+    MS_software, MS_Bruker_software,
+    MS_software, MS_Bruker_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Bruker_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Bruker_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Bruker_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Bruker_software,
+    MS_software, MS_Bruker_software, MS_data_processing_software,
+    MS_software, MS_Bruker_software, MS_data_processing_software,
+    MS_software, MS_Bruker_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Bruker_software, MS_acquisition_software,
+    MS_software, MS_Bruker_software, MS_acquisition_software,
+    MS_software, MS_Bruker_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Bruker_software,
+    MS_software, MS_Bruker_software,
+    MS_software, MS_Bruker_software, MS_acquisition_software,
+    MS_software, MS_Bruker_software, MS_acquisition_software,
+    MS_software, MS_Bruker_software,
+    MS_software, MS_Bruker_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Bruker_software,
+    MS_software, MS_Bruker_software,
+    MS_software, MS_Bruker_software,
+    MS_software, MS_Bruker_software,
+    MS_software, MS_Bruker_software,
+    MS_software, MS_Bruker_software, MS_analysis_software,
+    MS_software, MS_Bruker_software,
+    MS_software, MS_Bruker_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Bruker_software, MS_acquisition_software,
+    MS_software, MS_Bruker_software,
+    MS_software, MS_Bruker_software, MS_quantification_information, MS_quantitation_software_name,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_data_transformation, MS_file_format_conversion,
+    MS_mass_spectrometer_file_format, MS_intermediate_analysis_format, MS_file_format,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_ion_selection_attribute, MS_object_attribute,
+    MS_data_transformation, MS_data_processing_action,
+    MS_data_transformation, MS_data_processing_action, MS_data_filtering,
+    MS_data_processing_parameter,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Finnigan_MAT_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Finnigan_MAT_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Finnigan_MAT_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_native_spectrum_identifier_format,
+    MS_native_spectrum_identifier_format,
+    MS_native_spectrum_identifier_format,
+    MS_native_spectrum_identifier_format,
+    MS_native_spectrum_identifier_format,
+    MS_native_spectrum_identifier_format,
+    MS_native_spectrum_identifier_format,
+    MS_native_spectrum_identifier_format,
+    MS_native_spectrum_identifier_format,
+    MS_native_spectrum_identifier_format,
+    MS_data_transformation, MS_data_processing_action,
+    MS_data_transformation, MS_data_processing_action, MS_charge_state_calculation,
+    MS_data_transformation, MS_data_processing_action,
+    MS_data_transformation, MS_data_processing_action, MS_precursor_recalculation,
+    MS_data_transformation, MS_data_processing_action, MS_smoothing,
+    MS_data_transformation, MS_data_processing_action, MS_smoothing,
+    MS_data_transformation, MS_data_processing_action, MS_smoothing,
+    MS_data_transformation, MS_data_processing_action, MS_smoothing,
+    MS_binary_data_array,
+    MS_data_processing_parameter,
+    MS_data_processing_parameter,
+    MS_mass_spectrum, MS_data_file_content, MS_spectrum_type, MS_MS1_spectrum,
+    MS_mass_spectrum, MS_data_file_content, MS_spectrum_type, MS_MSn_spectrum,
+    MS_object_attribute,
+    MS_object_attribute, MS_isolation_window_attribute,
+    MS_object_attribute, MS_isolation_window_attribute,
+    MS_spectra_combination,
+    MS_spectrum_attribute, MS_object_attribute, MS_spectrum_identification_result_details,
+    MS_spectrum_attribute, MS_object_attribute, MS_spectrum_identification_result_details,
+    MS_spectrum_attribute, MS_object_attribute, MS_spectrum_identification_result_details,
+    MS_software,
+    MS_scan_attribute, MS_object_attribute,
+    MS_peak_picking, MS_data_transformation, MS_data_processing_action,
+    MS_peak_picking, MS_data_transformation, MS_data_processing_action,
+    MS_scan_attribute, MS_object_attribute,
+    MS_data_file_content, MS_spectrum_type,
+    MS_data_file_content, MS_spectrum_type,
+    MS_data_file_content, MS_spectrum_type,
+    MS_object_attribute,
+    MS_object_attribute, MS_chromatogram_attribute,
+    MS_data_file_content, MS_chromatogram_type,
+    MS_data_file_content, MS_chromatogram_type,
+    MS_data_file_content, MS_chromatogram_type, MS_electromagnetic_radiation_chromatogram,
+    MS_data_file_content, MS_chromatogram_type, MS_electromagnetic_radiation_chromatogram,
+    MS_intensity_unit,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_software, MS_Bruker_software,
+    MS_detector_type, MS_instrument_model, MS_Waters_instrument_model, MS_array_detector, MS_photodiode_array_detector,
+    MS_detector_type, MS_instrument_model, MS_Waters_instrument_model, MS_fluorescence_detector,
+    MS_binary_data_array,
+    MS_binary_data_array,
+    MS_binary_data_array,
+    MS_native_spectrum_identifier_format,
+    MS_native_spectrum_identifier_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_scan_attribute, MS_object_attribute,
+    MS_object_attribute, MS_isolation_window_attribute,
+    MS_object_attribute, MS_isolation_window_attribute,
+    MS_object_attribute, MS_isolation_window_attribute,
+    MS_object_attribute,
+    MS_MALDI_matrix_application,
+    MS_MALDI_matrix_application,
+    MS_matrix_application_type,
+    MS_matrix_application_type,
+    MS_matrix_application_type,
+    MS_matrix_application_type, MS_sample_plate_type,
+    MS_laser_attribute,
+    MS_laser_attribute,
+    MS_laser_attribute,
+    MS_laser_attribute,
+    MS_laser_attribute,
+    MS_laser_attribute,
+    MS_laser_attribute,
+    MS_laser_type,
+    MS_laser_type,
+    MS_laser_type,
+    MS_laser_type,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_object_attribute,
+    MS_object_attribute, MS_run_attribute,
+    MS_chemical_compound,
+    MS_chemical_compound_attribute,
+    MS_chemical_compound_attribute, MS_isoelectric_point,
+    MS_chemical_compound_formula,
+    MS_chemical_compound_formula,
+    MS_chemical_compound_formula,
+    MS_chemical_compound_formula,
+    MS_precursor_activation_attribute,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_software,
+    MS_software, MS_SRM_software,
+    MS_software,
+    MS_software, MS_peptide_attribute_calculation_software,
+    MS_source_attribute,
+    MS_source_attribute,
+    MS_source_attribute,
+    MS_external_reference_identifier,
+    MS_scan_attribute, MS_object_attribute,
+    MS_chemical_compound,
+    MS_protein_attribute, MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_protein_attribute, MS_quantification_information, MS_quantification_object_attribute,
+    MS_protein_attribute, MS_quantification_information, MS_quantification_object_attribute,
+    MS_peptide_attribute,
+    MS_peptide_attribute,
+    MS_peptide_attribute,
+    MS_peptide_attribute, MS_peptide_labeling_state,
+    MS_peptide_attribute, MS_peptide_labeling_state,
+    MS_peptide_attribute,
+    MS_peptide_attribute,
+    MS_peptide_attribute, MS_retention_time,
+    MS_peptide_attribute, MS_retention_time,
+    MS_peptide_attribute, MS_retention_time,
+    MS_standard,
+    MS_standard,
+    MS_standard,
+    MS_standard, MS_retention_time_normalization_standard,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_intensity_unit,
+    MS_ion_selection_attribute, MS_object_attribute,
+    MS_ion_selection_attribute, MS_object_attribute,
+    MS_transition_validation_method,
+    MS_transition_validation_method,
+    MS_transition_validation_method,
+    MS_transition_validation_method,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_retention_time_window_attribute,
+    MS_retention_time_window_attribute,
+    MS_target_inclusion_exclusion_priority,
+    MS_target_inclusion_exclusion_priority,
+    MS_software, MS_SRM_software, MS_quantification_information, MS_quantitation_software_name,
+    MS_software, MS_SRM_software,
+    MS_software, MS_SRM_software,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_scan_attribute, MS_object_attribute,
+    MS_spectrum_type,
+    MS_native_spectrum_identifier_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_protein_attribute, MS_quantification_information, MS_quantification_object_attribute,
+    MS_protein_attribute, MS_quantification_information, MS_quantification_object_attribute,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_search_type, MS_search_input_details,
+    MS_search_input_details,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_database_details, MS_database_filtering, MS_search_input_details, MS_Sequence_database_filter_types,
+    MS_search_database_details, MS_database_filtering, MS_search_input_details, MS_Sequence_database_filter_types,
+    MS_search_database_details, MS_database_filtering, MS_search_input_details, MS_Sequence_database_filter_types,
+    MS_search_database_details, MS_database_filtering, MS_search_input_details, MS_Sequence_database_filter_types,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_search_database_details, MS_database_filtering, MS_search_input_details, MS_Sequence_database_filter_types,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_database_details, MS_search_input_details, MS_spectrum_identification_result_details,
+    MS_search_type, MS_search_input_details,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_search_statistics, MS_spectrum_identification_result_details,
+    MS_search_statistics, MS_spectrum_identification_result_details,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_ViewCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_file_format,
+    MS_SEQUEST_ViewCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_search_input_details,
+    MS_cleavage_agent_details, MS_search_input_details,
+    MS_SEQUEST_ViewCV, MS_SEQUEST_sortCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_ViewCV, MS_SEQUEST_sortCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_ViewCV, MS_SEQUEST_sortCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_ViewCV, MS_SEQUEST_sortCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_ViewCV, MS_SEQUEST_sortCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_ViewCV, MS_SEQUEST_sortCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_ViewCV, MS_SEQUEST_sortCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_modification_parameters,
+    MS_modification_parameters,
+    MS_quality_estimation_method_details, MS_search_input_details,
+    MS_SEQUEST_ViewCV, MS_SEQUEST_sortCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_search_input_details,
+    MS_modification_parameters,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_search_input_details,
+    MS_search_input_details,
+    MS_SEQUEST_ViewCV, MS_SEQUEST_sortCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_ViewCV, MS_SEQUEST_sortCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_ViewCV, MS_SEQUEST_sortCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_ViewCV, MS_SEQUEST_sortCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_ViewCV, MS_SEQUEST_sortCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_search_database_details, MS_database_type, MS_search_input_details,
+    MS_search_database_details, MS_database_type, MS_search_input_details,
+    MS_search_input_details,
+    MS_search_type, MS_search_input_details,
+    MS_search_type, MS_search_input_details,
+    MS_search_type, MS_search_input_details,
+    MS_search_database_details, MS_database_name, MS_search_input_details,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_SEQUEST_ViewCV, MS_SEQUEST_sortCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_search_database_details, MS_protein_level_identification_attribute, MS_search_input_details, MS_database_sequence_details, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_database_details, MS_database_filtering, MS_protein_level_identification_attribute, MS_search_input_details, MS_database_sequence_details, MS_spectrum_identification_result_details, MS_Sequence_database_filters, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_database_details, MS_database_filtering, MS_protein_level_identification_attribute, MS_molecule_taxonomy, MS_search_input_details, MS_database_sequence_details, MS_spectrum_identification_result_details, MS_Sequence_database_filters, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_SEQUEST_ViewCV, MS_SEQUEST_sortCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_ProcessCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_ProcessCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_protein_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_SEQUEST_ViewCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_ViewCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_search_database_details, MS_database_name, MS_search_input_details, MS_database_UniProtKB,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_SEQUEST_ProcessCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_SEQUEST_ProcessCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_modeCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_SEQUEST_modeCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_SEQUEST_modeCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_software, MS_quantification_information,
+    MS_quantification_information,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_search_database_details, MS_database_name, MS_search_input_details,
+    MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_SEQUEST_selectCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_SEQUEST_selectCV, MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_SEQUEST_input_parameter,
+    MS_ions_series_considered_in_search, MS_search_input_details,
+    MS_protein_level_identification_attribute, MS_search_engine_specific_score, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_ions_series_considered_in_search, MS_search_input_details,
+    MS_ions_series_considered_in_search, MS_search_input_details,
+    MS_ions_series_considered_in_search, MS_search_input_details,
+    MS_ions_series_considered_in_search, MS_search_input_details,
+    MS_ions_series_considered_in_search, MS_search_input_details,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_engine_specific_score, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_engine_specific_score, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_search_engine_specific_score_for_proteins, MS_search_engine_specific_score_for_protein_groups, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_search_engine_specific_score_for_proteins, MS_search_engine_specific_score_for_protein_groups, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_peptide_sharing_details, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_search_statistics, MS_spectrum_identification_result_details,
+    MS_search_database_details, MS_database_type, MS_database_type_nucleotide, MS_search_input_details,
+    MS_regular_expression,
+    MS_spectrum_identification_result_details,
+    MS_modification_parameters, MS_modification_specificity_rule,
+    MS_modification_parameters, MS_modification_specificity_rule,
+    MS_protein_level_identification_attribute, MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_single_protein_identification_statistic, MS_protein_identification_confidence_metric, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_quality_estimation_method_details, MS_search_input_details,
+    MS_search_database_details, MS_search_input_details, MS_decoy_DB_details,
+    MS_search_database_details, MS_search_input_details, MS_decoy_DB_details,
+    MS_search_database_details, MS_search_input_details, MS_decoy_DB_details,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_search_database_details, MS_database_filtering, MS_search_input_details, MS_Sequence_database_filters,
+    MS_search_database_details, MS_database_filtering, MS_search_input_details, MS_Sequence_database_filters,
+    MS_search_database_details, MS_database_filtering, MS_search_input_details, MS_Sequence_database_filters,
+    MS_search_database_details, MS_database_filtering, MS_search_input_details, MS_Sequence_database_filters,
+    MS_software, MS_analysis_software,
+    MS_software, MS_analysis_software,
+    MS_software, MS_analysis_software,
+    MS_search_input_details,
+    MS_mass_type_settings, MS_search_input_details,
+    MS_mass_type_settings, MS_search_input_details,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute, MS_protein_level_result_list_attribute, MS_protein_level_result_list_statistic,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_protein_level_identification_attribute, MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_search_database_details, MS_database_source, MS_search_input_details,
+    MS_search_database_details, MS_database_source, MS_search_input_details,
+    MS_search_database_details, MS_database_source, MS_search_input_details,
+    MS_mass_type_settings, MS_search_input_details,
+    MS_mass_type_settings, MS_search_input_details,
+    MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_object_attribute, MS_contact_attribute,
+    MS_object_attribute, MS_contact_attribute, MS_role_type,
+    MS_object_attribute, MS_contact_attribute, MS_role_type,
+    MS_object_attribute, MS_contact_attribute, MS_role_type,
+    MS_object_attribute, MS_contact_attribute, MS_role_type,
+    MS_object_attribute, MS_contact_attribute, MS_role_type,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_search_database_details, MS_search_input_details, MS_decoy_DB_details,
+    MS_search_database_details, MS_search_input_details, MS_decoy_DB_details,
+    MS_search_database_details, MS_database_name, MS_search_input_details,
+    MS_search_database_details, MS_database_name, MS_search_input_details,
+    MS_search_database_details, MS_database_name, MS_search_input_details,
+    MS_search_database_details, MS_database_name, MS_search_input_details,
+    MS_search_database_details, MS_database_name, MS_search_input_details,
+    MS_search_database_details, MS_database_name, MS_search_input_details,
+    MS_protein_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_input_details, MS_search_engine_input_parameter,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_database_details, MS_search_input_details, MS_database_sequence_details,
+    MS_search_database_details, MS_search_input_details, MS_database_sequence_details,
+    MS_mass_table_options,
+    MS_mass_table_source, MS_mass_table_options,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_database_details, MS_search_input_details, MS_database_file_formats,
+    MS_search_database_details, MS_search_input_details, MS_database_file_formats,
+    MS_search_database_details, MS_search_input_details, MS_database_file_formats,
+    MS_search_database_details, MS_search_input_details, MS_database_file_formats,
+    MS_search_database_details, MS_search_input_details, MS_database_file_formats,
+    MS_search_database_details, MS_search_input_details, MS_database_file_formats,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_input_details,
+    MS_search_input_details, MS_spectrum_descriptions,
+    MS_search_input_details, MS_spectrum_descriptions, MS_spectrum_quality_descriptions,
+    MS_ambiguous_residues,
+    MS_ambiguous_residues,
+    MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_peptide_sharing_details, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute, MS_peptide_sequence_level_result_list_attribute, MS_peptide_sequence_level_result_list_statistic,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Phenyx_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Phenyx_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Phenyx_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Phenyx_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Phenyx_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Phenyx_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Phenyx_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Phenyx_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Phenyx_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Phenyx_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Phenyx_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Phenyx_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Phenyx_input_parameter,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_search_engine_specific_peptide_sequence_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_input_details,
+    MS_search_input_details, MS_search_tolerance_specification,
+    MS_search_input_details, MS_search_tolerance_specification,
+    MS_spectrum_identification_result_details,
+    MS_spectrum_identification_result_details,
+    MS_spectrum_identification_result_details,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_quality_estimation_method_details, MS_search_input_details, MS_statistical_threshold, MS_protein_level_statistical_threshold, MS_protein_detection_statistical_threshold,
+    MS_quality_estimation_method_details, MS_search_input_details, MS_statistical_threshold, MS_peptide_level_statistical_threshold, MS_spectrum_identification_statistical_threshold,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_OMSSA_input_parameter,
+    MS_search_database_details, MS_search_input_details,
+    MS_search_database_details, MS_search_input_details, MS_decoy_DB_details,
+    MS_search_database_details, MS_search_input_details, MS_decoy_DB_details,
+    MS_search_database_details, MS_search_input_details, MS_decoy_DB_details,
+    MS_quality_estimation_method_details, MS_search_input_details,
+    MS_software,
+    MS_software,
+    MS_software,
+    MS_peptide_modification_details,
+    MS_software, MS_analysis_software,
+    MS_search_database_details, MS_search_input_details, MS_database_file_formats,
+    MS_mass_spectrometer_file_format, MS_intermediate_analysis_format, MS_file_format,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_search_database_details, MS_database_filtering, MS_protein_level_identification_attribute, MS_molecule_taxonomy, MS_search_input_details, MS_database_sequence_details, MS_spectrum_identification_result_details, MS_Sequence_database_filters, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_database_details, MS_database_filtering, MS_protein_level_identification_attribute, MS_molecule_taxonomy, MS_search_input_details, MS_database_sequence_details, MS_spectrum_identification_result_details, MS_Sequence_database_filters, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_database_details, MS_database_filtering, MS_protein_level_identification_attribute, MS_molecule_taxonomy, MS_search_input_details, MS_database_sequence_details, MS_spectrum_identification_result_details, MS_Sequence_database_filters, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_database_details, MS_database_filtering, MS_protein_level_identification_attribute, MS_molecule_taxonomy, MS_search_input_details, MS_database_sequence_details, MS_spectrum_identification_result_details, MS_Sequence_database_filters, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_data_file_content, MS_chromatogram_type, MS_mass_chromatogram,
+    MS_data_file_content, MS_chromatogram_type, MS_mass_chromatogram,
+    MS_data_file_content, MS_chromatogram_type, MS_mass_chromatogram,
+    MS_software, MS_analysis_software,
+    MS_software, MS_analysis_software,
+    MS_software, MS_analysis_software,
+    MS_software, MS_analysis_software,
+    MS_binary_data_type,
+    MS_native_spectrum_identifier_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_software, MS_SCIEX_software, MS_acquisition_software, MS_analysis_software, MS_data_processing_software,
+    MS_data_transformation, MS_data_processing_action,
+    MS_data_transformation, MS_data_processing_action,
+    MS_data_transformation, MS_data_processing_action,
+    MS_software, MS_Bruker_software, MS_analysis_software,
+    MS_software, MS_quantification_information, MS_quantitation_software_name, MS_analysis_software,
+    MS_software, MS_analysis_software,
+    MS_software, MS_analysis_software,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_quality_estimation_method_details, MS_search_input_details, MS_statistical_threshold,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_native_spectrum_identifier_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_search_database_details, MS_database_filtering, MS_search_input_details,
+    MS_search_database_details, MS_database_filtering, MS_search_input_details,
+    MS_search_database_details, MS_database_filtering, MS_search_input_details, MS_Sequence_database_filters,
+    MS_search_database_details, MS_database_filtering, MS_search_input_details, MS_Sequence_database_filters,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_modification_details,
+    MS_peptide_modification_details,
+    MS_native_spectrum_identifier_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_native_spectrum_identifier_format, MS_spectrum_identification_result_details,
+    MS_search_input_details,
+    MS_search_input_details, MS_spectra_data_details,
+    MS_native_spectrum_identifier_format, MS_search_input_details, MS_spectra_data_details,
+    MS_native_spectrum_identifier_format, MS_search_input_details, MS_spectra_data_details,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_BioTOF_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_BioTOF_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_BioTOF_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_micrOTOF_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_maXis_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_amaZon_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_flex_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_flex_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_amaZon_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_solarix_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_flex_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_flex_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_flex_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_flex_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model,
+    MS_software,
+    MS_software, MS_acquisition_software, MS_analysis_software, MS_data_processing_software, MS_Shimadzu_Corporation_software,
+    MS_native_spectrum_identifier_format,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_software, MS_analysis_software,
+    MS_native_spectrum_identifier_format,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_quality_estimation_method_details, MS_search_input_details,
+    MS_search_input_details, MS_software_input_parameter, MS_software_specific_input_parameter, MS_Scaffold_input_parameter,
+    MS_search_input_details, MS_software_input_parameter, MS_software_specific_input_parameter, MS_Scaffold_input_parameter,
+    MS_search_input_details, MS_software_input_parameter, MS_software_specific_input_parameter, MS_Scaffold_input_parameter,
+    MS_search_input_details, MS_search_engine_input_parameter, MS_common_search_engine_input_parameter,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_scan_attribute, MS_object_attribute,
+    MS_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_quantification_information, MS_quantitation_software_name, MS_analysis_software,
+    MS_search_type, MS_search_input_details,
+    MS_software, MS_analysis_software,
+    MS_software, MS_analysis_software,
+    MS_software, MS_analysis_software,
+    MS_software, MS_analysis_software,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_object_attribute, MS_contact_attribute,
+    MS_object_attribute, MS_contact_attribute,
+    MS_object_attribute, MS_contact_attribute,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_search_input_details, MS_software_input_parameter, MS_software_specific_input_parameter, MS_Percolator_input_parameter,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_software, MS_Waters_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_Waters_software, MS_analysis_software, MS_data_processing_software,
+    MS_software,
+    MS_software, MS_acquisition_software, MS_analysis_software, MS_data_processing_software, MS_LECO_software,
+    MS_instrument_model,
+    MS_instrument_model, MS_LECO_instrument_model,
+    MS_instrument_model, MS_LECO_instrument_model,
+    MS_instrument_model, MS_LECO_instrument_model,
+    MS_instrument_model, MS_LECO_instrument_model,
+    MS_quantification_information,
+    MS_quantification_information,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_study_variable_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_study_variable_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_study_variable_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_study_variable_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_study_variable_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_study_variable_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_study_variable_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_study_variable_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_study_variable_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_raw_file_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_raw_file_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_raw_file_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_raw_file_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_raw_file_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_raw_files_group_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_feature_list_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_feature_list_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_feature_attribute,
+    MS_software, MS_quantification_information, MS_quantitation_software_name,
+    MS_software, MS_TOPP_software, MS_quantification_information, MS_quantitation_software_name, MS_analysis_software, MS_data_processing_software,
+    MS_quantification_information,
+    MS_quantification_information,
+    MS_quantification_information, MS_quantitation_analysis_summary,
+    MS_quantification_information, MS_quantitation_analysis_summary,
+    MS_quantification_information, MS_quantitation_analysis_summary,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_isobaric_label_quantitation_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary,
+    MS_quantification_information, MS_quantitation_analysis_summary,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype, MS_ratio_calculation_method,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype, MS_p_value,
+    MS_quantification_information, MS_quantification_datatype, MS_p_value,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_data_processing,
+    MS_quantification_data_processing,
+    MS_quantification_data_processing,
+    MS_quantification_data_processing,
+    MS_quantification_data_processing,
+    MS_quantification_data_processing,
+    MS_quality_estimation_method_details, MS_search_input_details, MS_statistical_threshold, MS_peptide_level_statistical_threshold, MS_spectrum_identification_statistical_threshold,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_search_engine_specific_score, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_modification_parameters, MS_modification_specificity_rule,
+    MS_modification_parameters, MS_modification_specificity_rule,
+    MS_software, MS_acquisition_software, MS_analysis_software, MS_data_processing_software, MS_LECO_software,
+    MS_software, MS_acquisition_software, MS_analysis_software, MS_data_processing_software, MS_Shimadzu_Corporation_software, MS_MALDI_Solutions,
+    MS_source_attribute,
+    MS_dissociation_method,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_transition_validation_attribute,
+    MS_transition_validation_attribute,
+    MS_data_processing_parameter,
+    MS_software, MS_analysis_software, MS_data_processing_software,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_retention_time_window_attribute,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_software, MS_Thermo_Finnigan_software, MS_analysis_software, MS_data_processing_software,
+    MS_source_attribute,
+    MS_software, MS_data_processing_software,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_external_reference_identifier,
+    MS_external_reference_identifier,
+    MS_external_reference_identifier,
+    MS_external_reference_identifier,
+    MS_external_reference_identifier, MS_external_reference_keyword,
+    MS_external_reference_identifier, MS_external_reference_keyword,
+    MS_external_reference_identifier, MS_external_reference_keyword,
+    MS_external_reference_identifier,
+    MS_external_reference_identifier,
+    MS_external_reference_identifier,
+    MS_external_reference_identifier,
+    MS_sample_plate_type,
+    MS_sample_plate_type,
+    MS_electrospray_supply_type,
+    MS_electrospray_supply_type,
+    MS_precursor_activation_attribute,
+    MS_instrument_model, MS_LECO_instrument_model,
+    MS_software, MS_quantification_information, MS_quantitation_software_name, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_quantification_information, MS_quantitation_software_name, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_quantification_information, MS_quantitation_software_name, MS_analysis_software, MS_data_processing_software,
+    MS_software,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_cleavage_agent_details, MS_cleavage_agent_name, MS_search_input_details,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_Cleavage_agent_regular_expression, MS_regular_expression,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Mascot_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinExtractor_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinScape_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteinScape_input_parameter,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_ion_selection_attribute, MS_object_attribute, MS_SRM_transition_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details, MS_PTM_localization_PSM_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details, MS_PTM_localization_PSM_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details, MS_PTM_localization_PSM_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_peptide_modification_details,
+    MS_software, MS_analysis_software,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PTM_localization_PSM_level_statistic, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details,
+    MS_spectrum_identification_result_details,
+    MS_software, MS_analysis_software,
+    MS_spectrum_identification_result_details, MS_PTM_localization_PSM_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details, MS_PTM_localization_PSM_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details, MS_PTM_localization_PSM_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details, MS_PTM_localization_PSM_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details, MS_PTM_localization_PSM_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details, MS_PTM_localization_PSM_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_software, MS_analysis_software,
+    MS_spectrum_identification_result_details, MS_PTM_localization_PSM_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details, MS_PTM_localization_PSM_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_matrix_application_type,
+    MS_matrix_application_type,
+    MS_matrix_application_type,
+    MS_matrix_application_type,
+    MS_matrix_application_type,
+    MS_matrix_application_type,
+    MS_matrix_application_type,
+    MS_data_transformation, MS_data_processing_action, MS_baseline_reduction,
+    MS_data_transformation, MS_data_processing_action, MS_baseline_reduction,
+    MS_data_transformation, MS_data_processing_action, MS_baseline_reduction,
+    MS_data_transformation, MS_data_processing_action, MS_smoothing,
+    MS_peak_picking, MS_data_transformation, MS_data_processing_action, MS_area_peak_picking,
+    MS_data_transformation, MS_data_processing_action, MS_intensity_normalization,
+    MS_dissociation_method,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_MS1_label_based_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_MS1_label_based_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_MS1_label_based_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_MS1_label_based_analysis,
+    MS_standard, MS_retention_time_normalization_standard,
+    MS_SRM_transition_type,
+    MS_SRM_transition_type,
+    MS_quantification_information, MS_quantitation_analysis_summary,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_isobaric_label_quantitation_analysis,
+    MS_ionization_type, MS_atmospheric_pressure_ionization,
+    MS_spectrum_identification_result_details, MS_PTM_localization_PSM_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_collision_energy, MS_precursor_activation_attribute,
+    MS_collision_energy, MS_precursor_activation_attribute,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_spectral_counting_quantitation_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_spectral_counting_quantitation_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_spectral_counting_quantitation_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_LC_MS_label_free_quantitation_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_LC_MS_label_free_quantitation_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_LC_MS_label_free_quantitation_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_LC_MS_label_free_quantitation_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_MS2_tag_based_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_MS2_tag_based_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_MS2_tag_based_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_MS2_tag_based_analysis,
+    MS_peptide_modification_details,
+    MS_peptide_modification_details,
+    MS_peptide_modification_details,
+    MS_external_reference_identifier,
+    MS_external_reference_identifier,
+    MS_object_attribute, MS_contact_attribute,
+    MS_object_attribute, MS_contact_attribute, MS_contact_role,
+    MS_object_attribute, MS_contact_attribute, MS_contact_role,
+    MS_object_attribute, MS_contact_attribute, MS_contact_role,
+    MS_object_attribute, MS_contact_attribute, MS_contact_role,
+    MS_object_attribute, MS_sample_attribute,
+    MS_object_attribute,
+    MS_source_attribute, MS_object_attribute, MS_inlet_attribute,
+    MS_source_attribute,
+    MS_object_attribute, MS_run_attribute,
+    MS_software, MS_analysis_software,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_generation_information,
+    MS_software, MS_analysis_software,
+    MS_software, MS_analysis_software,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_PSM_level_e_value, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_PSM_level_e_value, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_PSM_level_q_value, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_modification_parameters, MS_modification_specificity_rule,
+    MS_modification_parameters, MS_modification_specificity_rule,
+    MS_software, MS_quantification_information, MS_quantitation_software_name,
+    MS_search_database_details, MS_database_name, MS_search_input_details, MS_database_UniProtKB,
+    MS_modification_parameters,
+    MS_software, MS_quantification_information, MS_quantitation_software_name,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_modification_parameters,
+    MS_modification_parameters,
+    MS_quantification_data_processing,
+    MS_quantification_data_processing,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_file_format,
+    MS_file_format, MS_quantification_file_format,
+    MS_software, MS_analysis_software,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_micrOTOF_series,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_scan_attribute, MS_object_attribute,
+    MS_scan_attribute, MS_object_attribute,
+    MS_object_attribute, MS_run_attribute,
+    MS_object_attribute, MS_run_attribute, MS_multidimensional_chromatography_modulation_description,
+    MS_object_attribute, MS_run_attribute, MS_multidimensional_chromatography_modulation_description,
+    MS_object_attribute, MS_run_attribute, MS_multidimensional_chromatography_modulation_description,
+    MS_object_attribute, MS_run_attribute, MS_multidimensional_chromatography_modulation_description,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_input_parameter, MS_common_search_engine_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_software_input_parameter, MS_software_specific_input_parameter, MS_Percolator_input_parameter,
+    MS_search_input_details,
+    MS_search_input_details, MS_search_engine_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter,
+    MS_search_input_details,
+    MS_search_input_details, MS_software_input_parameter,
+    MS_search_input_details, MS_software_input_parameter,
+    MS_search_input_details, MS_software_input_parameter, MS_software_specific_input_parameter,
+    MS_search_input_details, MS_software_input_parameter, MS_software_specific_input_parameter,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_feature_attribute,
+    MS_quantification_information, MS_quantification_object_attribute, MS_feature_list_attribute,
+    MS_software, MS_quantification_information, MS_quantitation_software_name,
+    MS_software, MS_quantification_information, MS_quantitation_software_name,
+    MS_PSM_level_search_engine_specific_statistic, MS_search_engine_specific_score, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_database_details, MS_database_name, MS_search_input_details,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_file_format,
+    MS_software, MS_TOPP_software, MS_quantification_information, MS_quantitation_software_name, MS_analysis_software, MS_data_processing_software,
+    MS_file_format,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_noise_filter,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_noise_filter,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_peak_picker,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_peak_picker,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_spectra_filter,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_spectra_filter,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_spectra_filter,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_spectra_filter,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_spectra_filter,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_spectra_filter,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_spectra_filter,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_spectra_filter,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_spectra_filter,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_map_aligner,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_map_aligner,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_map_aligner,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_object_attribute,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_feature_finder,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_feature_finder,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_feature_finder,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_feature_finder,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_feature_finder,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_feature_linker,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_feature_linker,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_feature_linker,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_software_adaptor,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_software_adaptor,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_software_adaptor,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_software_adaptor,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_software_adaptor,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_software_adaptor,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_OpenSwath_component,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_OpenSwath_component,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_OpenSwath_component,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_OpenSwath_component,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software, MS_TOPP_OpenSwath_component,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_ProteoWizard_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_ProteoWizard_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_ProteoWizard_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_ProteoWizard_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_ProteoWizard_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_quantification_information, MS_quantitation_software_name, MS_analysis_software,
+    MS_quantification_data_processing,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_isobaric_label_quantitation_analysis,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_protein_inference_confidence_category, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_protein_inference_confidence_category, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_protein_inference_confidence_category, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_protein_inference_confidence_category, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_normalized_collision_energy, MS_precursor_activation_attribute,
+    MS_normalized_collision_energy, MS_precursor_activation_attribute,
+    MS_software, MS_SRM_software,
+    MS_protein_level_identification_attribute, MS_peptide_sequence_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_ion_selection_attribute, MS_object_attribute,
+    MS_ion_selection_attribute, MS_object_attribute, MS_SRM_transition_attribute,
+    MS_ion_selection_attribute, MS_object_attribute, MS_SRM_transition_attribute,
+    MS_product_ion_attribute, MS_product_ion_intensity, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_product_ion_intensity, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_ion_selection_attribute, MS_object_attribute, MS_SRM_transition_attribute,
+    MS_ion_selection_attribute, MS_object_attribute, MS_SRM_transition_attribute,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_regular_expression,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_ion_selection_attribute, MS_object_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_search_engine_specific_score_for_protein_groups, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_software, MS_analysis_software,
+    MS_software, MS_analysis_software, MS_mzidLib,
+    MS_software, MS_analysis_software, MS_mzidLib,
+    MS_software, MS_analysis_software, MS_mzidLib,
+    MS_software, MS_analysis_software, MS_mzidLib,
+    MS_software, MS_analysis_software, MS_mzidLib,
+    MS_software, MS_analysis_software, MS_mzidLib,
+    MS_software, MS_analysis_software, MS_mzidLib,
+    MS_software, MS_analysis_software, MS_mzidLib,
+    MS_software, MS_analysis_software, MS_mzidLib,
+    MS_software, MS_analysis_software, MS_mzidLib,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_software, MS_analysis_software,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_engine_specific_score, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_quality_estimation_method_details, MS_search_input_details, MS_statistical_threshold, MS_PSM_level_statistical_threshold, MS_spectrum_identification_statistical_threshold,
+    MS_software, MS_analysis_software,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_search_engine_specific_score, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_object_attribute, MS_run_attribute,
+    MS_object_attribute, MS_run_attribute, MS_chromatography_separation,
+    MS_object_attribute, MS_run_attribute, MS_chromatography_separation,
+    MS_detector_attribute,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_Waters_instrument_model,
+    MS_instrument_model, MS_LECO_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_maXis_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_micrOTOF_series,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_SRM_quantitation_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_SRM_quantitation_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_SRM_quantitation_analysis,
+    MS_quantification_information, MS_quantitation_analysis_summary, MS_SRM_quantitation_analysis,
+    MS_software, MS_analysis_software,
+    MS_software, MS_analysis_software,
+    MS_software, MS_analysis_software, MS_Trans_Proteomic_Pipeline_software,
+    MS_software, MS_analysis_software, MS_Trans_Proteomic_Pipeline_software,
+    MS_software, MS_analysis_software, MS_Trans_Proteomic_Pipeline_software,
+    MS_software, MS_analysis_software, MS_Trans_Proteomic_Pipeline_software,
+    MS_software, MS_analysis_software, MS_Trans_Proteomic_Pipeline_software,
+    MS_software, MS_analysis_software, MS_Trans_Proteomic_Pipeline_software,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_SCION_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_SCION_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_EVOQ_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_EVOQ_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_micrOTOF_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_amaZon_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_amaZon_series,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_native_spectrum_identifier_format,
+    MS_domain_range,
+    MS_domain_range,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_detector_type,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_binary_data_compression_type,
+    MS_binary_data_compression_type,
+    MS_binary_data_compression_type,
+    MS_spectrum_identification_result_details,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_object_attribute, MS_contact_attribute, MS_contact_role,
+    MS_software, MS_data_processing_software,
+    MS_software, MS_data_processing_software, MS_conversion_software,
+    MS_software, MS_data_processing_software, MS_conversion_software,
+    MS_software, MS_analysis_software,
+    MS_software, MS_analysis_software,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details,
+    MS_external_reference_identifier,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_software, MS_analysis_software, MS_data_processing_software,
+    MS_software, MS_analysis_software, MS_data_processing_software,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_domain_range,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute, MS_PSM_level_result_list_attribute, MS_PSM_level_result_list_statistic,
+    MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_peptide_sequence_level_identification_statistic, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_peptide_sequence_level_identification_statistic, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_protein_group_level_result_list_attribute, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute, MS_protein_group_level_result_list_statistic,
+    MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_search_engine_specific_score_for_protein_groups, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_search_engine_specific_score_for_protein_groups, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_spectrum_identification_result_details,
+    MS_software, MS_acquisition_software, MS_analysis_software, MS_data_processing_software, MS_Shimadzu_Corporation_software,
+    MS_instrument_model, MS_Shimadzu_instrument_model, MS_Shimadzu_MALDI_TOF_instrument_model,
+    MS_software,
+    MS_software, MS_analysis_software, MS_data_processing_software, MS_SCiLS_software,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_software, MS_data_processing_software,
+    MS_software, MS_analysis_software, MS_data_processing_software, MS_postprocessing_software,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_software_input_parameter, MS_software_specific_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_software_input_parameter, MS_software_specific_input_parameter, MS_PIA_workflow_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_software_input_parameter, MS_software_specific_input_parameter, MS_PIA_workflow_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_software_input_parameter, MS_software_specific_input_parameter, MS_PIA_workflow_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_software_input_parameter, MS_software_specific_input_parameter, MS_PIA_workflow_parameter,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_software_input_parameter, MS_software_specific_input_parameter, MS_PIA_workflow_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_software_input_parameter, MS_software_specific_input_parameter, MS_PIA_workflow_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_software_input_parameter, MS_software_specific_input_parameter, MS_PIA_workflow_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_software_input_parameter, MS_software_specific_input_parameter, MS_PIA_workflow_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_software_input_parameter, MS_software_specific_input_parameter, MS_PIA_workflow_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_software_input_parameter, MS_software_specific_input_parameter, MS_PIA_workflow_parameter,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute, MS_protein_level_result_list_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute,
+    MS_spectrum_identification_result_details, MS_protein_group_level_result_list_attribute, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute, MS_protein_cluster_identification_attribute,
+    MS_spectrum_identification_result_details, MS_protein_group_level_result_list_attribute, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_software, MS_SRM_software, MS_quantification_information, MS_quantitation_software_name,
+    MS_file_format, MS_method_file_format,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_software, MS_data_processing_software,
+    MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_external_reference_identifier,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Paragon_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Paragon_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Paragon_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Paragon_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Paragon_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Paragon_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Paragon_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Paragon_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Paragon_input_parameter,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Paragon_input_parameter,
+    MS_search_input_details,
+    MS_search_input_details, MS_search_engine_specific_input_metadata,
+    MS_search_input_details,
+    MS_data_processing_parameter,
+    MS_search_input_details,
+    MS_search_database_details, MS_search_input_details,
+    MS_spectrum_identification_list_result_details,
+    MS_spectrum_identification_list_result_details,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_file_format,
+    MS_file_format, MS_chromatograph_file_format,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_instrument_model, MS_Agilent_instrument_model,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_Paragon_input_parameter,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_ions_series_considered_in_search, MS_search_input_details,
+    MS_ions_series_considered_in_search, MS_search_input_details,
+    MS_software, MS_analysis_software, MS_data_processing_software,
+    MS_search_input_details, MS_search_engine_input_parameter, MS_common_search_engine_input_parameter,
+    MS_search_input_details, MS_search_engine_input_parameter, MS_common_search_engine_input_parameter,
+    MS_neutral_loss, MS_modification_parameters, MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_neutral_loss, MS_modification_parameters, MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_neutral_loss, MS_modification_parameters, MS_search_input_details, MS_ion_series_considered_in_search,
+    MS_software, MS_analysis_software,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_spectrum_identification_result_details, MS_protein_group_level_result_list_attribute, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute, MS_protein_group_level_result_list_statistic,
+    MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute, MS_peptide_sequence_level_result_list_attribute, MS_peptide_sequence_level_result_list_statistic,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute, MS_peptide_sequence_level_result_list_attribute, MS_peptide_sequence_level_result_list_statistic,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute, MS_PSM_level_result_list_attribute, MS_PSM_level_result_list_statistic,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute, MS_PSM_level_result_list_attribute, MS_PSM_level_result_list_statistic,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_peptide_sequence_level_identification_statistic, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_search_engine_specific_score_for_proteins, MS_search_engine_specific_score_for_protein_groups, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_dissociation_method, MS_collision_induced_dissociation,
+    MS_search_input_details,
+    MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_search_engine_specific_score_for_protein_groups, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_search_engine_specific_score_for_protein_groups, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_ion_selection_attribute, MS_object_attribute,
+    MS_binary_data_array,
+    MS_binary_data_array,
+    MS_regular_expression,
+    MS_dissociation_method, MS_collision_induced_dissociation, MS_beam_type_collision_induced_dissociation,
+    MS_quality_estimation_method_details, MS_search_input_details,
+    MS_quality_estimation_method_details, MS_search_input_details, MS_statistical_threshold, MS_spectrum_identification_statistical_threshold,
+    MS_quality_estimation_method_details, MS_search_input_details, MS_statistical_threshold, MS_spectrum_identification_statistical_threshold,
+    MS_quality_estimation_method_details, MS_search_input_details, MS_statistical_threshold, MS_protein_detection_statistical_threshold,
+    MS_quality_estimation_method_details, MS_search_input_details, MS_statistical_threshold, MS_protein_detection_statistical_threshold,
+    MS_external_reference_identifier,
+    MS_external_reference_identifier,
+    MS_search_type, MS_search_input_details,
+    MS_search_type, MS_search_input_details, MS_special_processing,
+    MS_search_type, MS_search_input_details, MS_special_processing,
+    MS_search_type, MS_search_input_details, MS_special_processing,
+    MS_search_type, MS_search_input_details, MS_special_processing,
+    MS_search_type, MS_search_input_details, MS_special_processing,
+    MS_search_type, MS_search_input_details, MS_special_processing,
+    MS_identification_parameter,
+    MS_identification_parameter,
+    MS_identification_parameter,
+    MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_search_engine_specific_peptide_sequence_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute, MS_PSM_level_result_list_attribute, MS_PSM_level_result_list_statistic,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_modification_parameters,
+    MS_regular_expression,
+    MS_modification_parameters,
+    MS_modification_parameters, MS_modification_position_score,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_cross_linking_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_cross_linking_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_cross_linking_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_search_engine_specific_score_for_proteins, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantitation_analysis_summary,
+    MS_quantification_information, MS_quantitation_software_comment_or_customizations,
+    MS_quantification_information, MS_quantitation_software_comment_or_customizations,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_object_attribute, MS_run_attribute,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_software, MS_data_processing_software,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_scan_attribute, MS_object_attribute,
+    MS_scan_attribute, MS_object_attribute, MS_instrument_specific_scan_attribute,
+    MS_binary_data_array,
+    MS_binary_data_array,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_native_spectrum_identifier_format,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_PTM_localization_PSM_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details, MS_PTM_localization_PSM_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details,
+    MS_spectrum_identification_result_details, MS_PTM_localization_confidence_metric,
+    MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_statistic, MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_search_engine_specific_peptide_sequence_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_single_protein_identification_statistic, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_software, MS_analysis_software,
+    MS_software, MS_analysis_software,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_software, MS_quantification_information, MS_quantitation_software_name, MS_analysis_software,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_quantification_information, MS_quantification_datatype,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details, MS_PTM_localization_distinct_peptide_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details, MS_PTM_localization_distinct_peptide_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details, MS_PTM_localization_distinct_peptide_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details, MS_PTM_localization_distinct_peptide_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details, MS_PTM_localization_distinct_peptide_level_statistic, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_single_result_statistic,
+    MS_spectrum_identification_result_details,
+    MS_spectrum_identification_result_details, MS_PTM_localization_score_threshold,
+    MS_spectrum_identification_result_details, MS_PTM_localization_score_threshold,
+    MS_spectrum_identification_result_details, MS_PTM_localization_score_threshold,
+    MS_spectrum_identification_result_details, MS_PTM_localization_score_threshold,
+    MS_spectrum_identification_result_details, MS_PTM_localization_score_threshold,
+    MS_spectrum_identification_result_details, MS_PTM_localization_score_threshold,
+    MS_spectrum_identification_result_details, MS_PTM_localization_score_threshold,
+    MS_spectrum_identification_result_details, MS_PTM_localization_score_threshold,
+    MS_spectrum_identification_result_details, MS_PTM_localization_score_threshold,
+    MS_spectrum_identification_result_details, MS_PTM_localization_score_threshold,
+    MS_spectrum_identification_result_details, MS_PTM_localization_score_threshold,
+    MS_spectrum_identification_result_details, MS_PTM_localization_score_threshold,
+    MS_spectrum_identification_result_details, MS_PTM_localization_score_threshold,
+    MS_search_input_details, MS_search_engine_specific_input_parameter, MS_search_engine_input_parameter, MS_ProteomeDiscoverer_input_parameter,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_protein_level_identification_attribute, MS_protein_group_or_subset_relationship, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_quality_estimation_method_details, MS_search_input_details, MS_statistical_threshold,
+    MS_quality_estimation_method_details, MS_search_input_details, MS_statistical_threshold,
+    MS_software, MS_analysis_software, MS_Trans_Proteomic_Pipeline_software,
+    MS_software, MS_analysis_software,
+    MS_intermediate_analysis_format, MS_file_format,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_software, MS_analysis_software,
+    MS_mass_spectrometer_file_format, MS_file_format,
+    MS_software, MS_analysis_software,
+    MS_spectrum_identification_result_details,
+    MS_spectrum_identification_result_details, MS_file_format, MS_identification_file_format,
+    MS_tab_delimited_text_format, MS_intermediate_analysis_format, MS_file_format,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_ICAT_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_ICAT_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_ICPL_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_ICPL_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_ICPL_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_ICPL_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_SILAC_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_SILAC_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_SILAC_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_TMT_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_TMT_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_TMT_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_TMT_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_TMT_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_TMT_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_iTRAQ_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_iTRAQ_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_iTRAQ_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_iTRAQ_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_iTRAQ_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_iTRAQ_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_iTRAQ_reagent,
+    MS_object_attribute, MS_sample_attribute, MS_quantification_information, MS_quantification_object_attribute, MS_assay_label_attribute, MS_quantification_reagent, MS_iTRAQ_reagent,
+    MS_dissociation_method,
+    MS_external_reference_identifier,
+    MS_external_reference_identifier,
+    MS_instrument_model, MS_Thermo_Fisher_Scientific_instrument_model, MS_Thermo_Scientific_instrument_model,
+    MS_search_type, MS_search_input_details, MS_special_processing,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_proteogenomics_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_proteogenomics_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_proteogenomics_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_proteogenomics_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_proteogenomics_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_proteogenomics_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_proteogenomics_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_peptide_sequence_level_identification_attribute, MS_spectrum_identification_result_details, MS_proteogenomics_attribute, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_software, MS_analysis_software, MS_data_processing_software,
+    MS_native_spectrum_identifier_format__combined_spectra,
+    MS_native_spectrum_identifier_format__combined_spectra,
+    MS_native_spectrum_identifier_format__combined_spectra,
+    MS_native_spectrum_identifier_format__combined_spectra,
+    MS_native_spectrum_identifier_format__combined_spectra,
+    MS_native_spectrum_identifier_format__combined_spectra,
+    MS_native_spectrum_identifier_format__combined_spectra,
+    MS_native_spectrum_identifier_format__combined_spectra,
+    MS_native_spectrum_identifier_format__combined_spectra,
+    MS_native_spectrum_identifier_format__combined_spectra,
+    MS_native_spectrum_identifier_format__combined_spectra,
+    MS_search_database_details, MS_search_input_details, MS_database_file_formats,
+    MS_search_database_details, MS_search_input_details, MS_database_file_formats,
+    MS_software, MS_analysis_software,
+    MS_PSM_level_search_engine_specific_statistic, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_protein_group_level_identification_attribute, MS_protein_group_level_identification_statistic, MS_search_engine_specific_score_for_protein_groups, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_cross_linking_result_details,
+    MS_regular_expression,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_micrOTOF_series,
+    MS_instrument_model, MS_Bruker_Daltonics_instrument_model, MS_Bruker_Daltonics_micrOTOF_series,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_PTM_localization_score_threshold,
+    MS_software, MS_TOPP_software, MS_analysis_software, MS_data_processing_software,
+    MS_instrument_model, MS_SCIEX_instrument_model,
+    MS_interaction_score_derived_from_cross_linking, MS_cross_linking_result_details,
+    MS_interaction_score_derived_from_cross_linking, MS_cross_linking_result_details,
+    MS_dissociation_method, MS_collision_induced_dissociation, MS_beam_type_collision_induced_dissociation,
+    MS_dissociation_method,
+    MS_precursor_activation_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_search_engine_specific_score, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_search_engine_specific_score, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_search_engine_specific_score, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_search_engine_specific_score, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_search_engine_specific_score, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_PSM_level_search_engine_specific_statistic, MS_search_engine_specific_score, MS_spectrum_identification_result_details, MS_PSM_level_attribute, MS_PSM_level_identification_statistic, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details,
+    MS_spectrum_identification_result_details, MS_analysis_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_PTM_localization_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_PTM_localization_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_result_list_statistic,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_PTM_localization_attribute, MS_PTM_localization_result_list_statistic,
+    MS_spectrum_identification_result_details, MS_analysis_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_product_ion_attribute, MS_spectrum_identification_result_details, MS_fragmentation_ion_type, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_single_identification_result_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute, MS_PSM_level_result_list_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute, MS_peptide_sequence_level_result_list_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute,
+    MS_spectrum_identification_result_details, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute, MS_protein_level_result_list_attribute,
+    MS_spectrum_identification_result_details, MS_protein_group_level_result_list_attribute, MS_analysis_attribute, MS_identification_attribute, MS_result_list_attribute,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UNIMOD_unimod_root_node,
+    UO_unit,
+    UO_unit,
+    UO_unit,
+    UO_unit,
+    UO_unit,
+    UO_unit,
+    UO_unit, UO_light_unit,
+    UO_unit, UO_length_unit, UO_base_unit,
+    UO_unit, UO_mass_unit, UO_base_unit,
+    UO_unit, UO_time_unit, UO_base_unit,
+    UO_unit, UO_electric_current_unit, UO_base_unit,
+    UO_unit, UO_temperature_unit, UO_base_unit,
+    UO_unit, UO_substance_unit, UO_base_unit,
+    UO_unit, UO_luminous_intensity_unit, UO_base_unit, UO_light_unit,
+    UO_unit, UO_length_unit,
+    UO_unit, UO_length_unit,
+    UO_unit, UO_length_unit,
+    UO_unit, UO_length_unit,
+    UO_unit, UO_length_unit,
+    UO_unit, UO_length_unit,
+    UO_unit, UO_mass_unit,
+    UO_unit, UO_mass_unit,
+    UO_unit, UO_mass_unit,
+    UO_unit, UO_mass_unit,
+    UO_unit, UO_mass_unit,
+    UO_unit, UO_mass_unit,
+    UO_unit, UO_temperature_unit,
+    UO_unit, UO_time_unit,
+    UO_unit, UO_time_unit,
+    UO_unit, UO_time_unit,
+    UO_unit, UO_time_unit,
+    UO_unit, UO_time_unit,
+    UO_unit, UO_time_unit,
+    UO_unit, UO_time_unit,
+    UO_unit, UO_time_unit,
+    UO_unit, UO_time_unit,
+    UO_unit, UO_electric_current_unit,
+    UO_unit, UO_electric_current_unit,
+    UO_unit, UO_substance_unit,
+    UO_unit, UO_substance_unit,
+    UO_unit, UO_substance_unit,
+    UO_unit, UO_substance_unit,
+    UO_unit, UO_substance_unit,
+    UO_unit, UO_substance_unit,
+    UO_unit,
+    UO_unit,
+    UO_unit,
+    UO_unit,
+    UO_unit,
+    UO_unit,
+    UO_unit, UO_density_unit,
+    UO_unit, UO_light_unit,
+    UO_unit, UO_density_unit,
+    UO_unit, UO_mass_unit,
+    UO_unit, UO_volume_unit,
+    UO_unit,
+    UO_unit, UO_frequency_unit,
+    UO_unit, UO_volume_unit,
+    UO_unit,
+    UO_unit, UO_concentration_unit,
+    UO_unit, UO_concentration_unit, UO_unit_of_molarity,
+    UO_unit, UO_concentration_unit, UO_unit_of_molarity,
+    UO_unit, UO_concentration_unit, UO_unit_of_molarity,
+    UO_unit, UO_concentration_unit, UO_unit_of_molarity,
+    UO_unit, UO_concentration_unit, UO_unit_of_molarity,
+    UO_unit, UO_concentration_unit,
+    UO_unit, UO_concentration_unit, UO_unit_of_molality,
+    UO_unit, UO_concentration_unit, UO_unit_of_molality,
+    UO_unit, UO_concentration_unit, UO_unit_of_molality,
+    UO_unit, UO_concentration_unit, UO_unit_of_molality,
+    UO_unit, UO_concentration_unit, UO_unit_of_molality,
+    UO_unit, UO_concentration_unit, UO_unit_of_molarity,
+    UO_unit, UO_concentration_unit,
+    UO_unit, UO_concentration_unit, UO_unit_of_normality,
+    UO_unit, UO_concentration_unit, UO_dimensionless_unit, UO_ratio, UO_fraction,
+    UO_unit, UO_acceleration_unit,
+    UO_unit, UO_angular_acceleration_unit,
+    UO_unit, UO_angular_velocity_unit,
+    UO_unit, UO_area_unit,
+    UO_unit, UO_area_unit,
+    UO_unit, UO_area_unit,
+    UO_unit, UO_mass_density_unit, UO_density_unit,
+    UO_unit, UO_mass_density_unit, UO_density_unit,
+    UO_unit, UO_luminance_unit, UO_light_unit,
+    UO_unit, UO_area_density_unit, UO_density_unit,
+    UO_unit, UO_mass_unit, UO_molar_mass_unit,
+    UO_unit, UO_mass_unit, UO_molar_mass_unit,
+    UO_unit, UO_molar_volume_unit, UO_volume_unit,
+    UO_unit, UO_molar_volume_unit, UO_volume_unit,
+    UO_unit, UO_momentum_unit,
+    UO_unit, UO_rotational_frequency_unit, UO_frequency_unit,
+    UO_unit, UO_specific_volume_unit, UO_volume_unit,
+    UO_unit, UO_speed_velocity_unit,
+    UO_unit,
+    UO_unit, UO_volume_unit,
+    UO_unit, UO_volume_unit,
+    UO_unit, UO_volume_unit,
+    UO_unit, UO_volume_unit,
+    UO_unit, UO_volume_unit,
+    UO_unit, UO_volume_unit,
+    UO_unit, UO_volume_unit,
+    UO_unit, UO_volume_unit,
+    UO_unit, UO_volume_unit,
+    UO_unit,
+    UO_unit, UO_frequency_unit,
+    UO_unit,
+    UO_unit, UO_force_unit,
+    UO_unit,
+    UO_unit, UO_pressure_unit,
+    UO_unit,
+    UO_unit, UO_energy_unit,
+    UO_unit,
+    UO_unit, UO_power_unit,
+    UO_unit, UO_light_unit,
+    UO_unit, UO_illuminance_unit, UO_light_unit,
+    UO_unit, UO_light_unit,
+    UO_unit, UO_luminous_flux_unit, UO_light_unit,
+    UO_unit,
+    UO_unit, UO_catalytic_activity_unit,
+    UO_unit,
+    UO_unit, UO_angle_unit,
+    UO_unit, UO_angle_unit, UO_plane_angle_unit,
+    UO_unit, UO_angle_unit,
+    UO_unit, UO_angle_unit, UO_solid_angle_unit,
+    UO_unit,
+    UO_unit, UO_radiation_unit,
+    UO_unit, UO_radiation_unit,
+    UO_unit, UO_radiation_unit,
+    UO_unit, UO_radiation_unit,
+    UO_unit, UO_radiation_unit, UO_activity__of_a_radionuclide__unit,
+    UO_unit, UO_radiation_unit, UO_activity__of_a_radionuclide__unit,
+    UO_unit, UO_radiation_unit, UO_absorbed_dose_unit,
+    UO_unit, UO_radiation_unit, UO_absorbed_dose_unit,
+    UO_unit, UO_radiation_unit, UO_exposure_unit,
+    UO_unit, UO_radiation_unit, UO_dose_equivalent_unit,
+    UO_unit, UO_radiation_unit, UO_dose_equivalent_unit,
+    UO_unit, UO_radiation_unit, UO_dose_equivalent_unit,
+    UO_unit, UO_radiation_unit, UO_dose_equivalent_unit,
+    UO_unit, UO_radiation_unit, UO_absorbed_dose_unit,
+    UO_unit, UO_radiation_unit, UO_absorbed_dose_unit,
+    UO_unit, UO_radiation_unit, UO_absorbed_dose_unit,
+    UO_unit, UO_radiation_unit, UO_dose_equivalent_unit,
+    UO_unit, UO_radiation_unit, UO_activity__of_a_radionuclide__unit,
+    UO_unit, UO_radiation_unit, UO_activity__of_a_radionuclide__unit,
+    UO_unit, UO_radiation_unit, UO_activity__of_a_radionuclide__unit,
+    UO_unit, UO_radiation_unit, UO_activity__of_a_radionuclide__unit,
+    UO_unit, UO_time_unit,
+    UO_unit, UO_time_unit,
+    UO_unit, UO_time_unit,
+    UO_unit, UO_illuminance_unit, UO_light_unit,
+    UO_unit, UO_light_unit,
+    UO_unit, UO_irradiance_unit, UO_light_unit,
+    UO_unit, UO_irradiance_unit, UO_light_unit,
+    UO_unit,
+    UO_unit, UO_light_unit, UO_radiance_unit,
+    UO_unit, UO_light_unit,
+    UO_unit, UO_irradiance_unit, UO_light_unit,
+    UO_unit, UO_light_unit,
+    UO_unit, UO_light_unit, UO_radiant_intensity_unit,
+    UO_unit, UO_concentration_unit, UO_dimensionless_unit, UO_percent, UO_ratio,
+    UO_unit, UO_concentration_unit, UO_dimensionless_unit, UO_percent, UO_ratio,
+    UO_unit, UO_concentration_unit, UO_dimensionless_unit, UO_percent, UO_ratio, UO_volume_per_unit_volume,
+    UO_unit, UO_dimensionless_unit,
+    UO_unit, UO_parts_per_notation_unit, UO_dimensionless_unit,
+    UO_unit, UO_parts_per_notation_unit, UO_dimensionless_unit,
+    UO_unit, UO_parts_per_notation_unit, UO_dimensionless_unit,
+    UO_unit, UO_parts_per_notation_unit, UO_dimensionless_unit,
+    UO_unit, UO_parts_per_notation_unit, UO_dimensionless_unit,
+    UO_unit, UO_parts_per_notation_unit, UO_dimensionless_unit,
+    UO_unit, UO_mass_density_unit, UO_density_unit,
+    UO_unit, UO_mass_density_unit, UO_density_unit,
+    UO_unit, UO_mass_density_unit, UO_density_unit,
+    UO_unit, UO_mass_density_unit, UO_density_unit,
+    UO_unit, UO_concentration_unit,
+    UO_unit, UO_concentration_unit, UO_unit_per_volume_unit,
+    UO_unit, UO_concentration_unit, UO_unit_per_volume_unit,
+    UO_unit, UO_concentration_unit,
+    UO_unit, UO_catalytic_activity_unit,
+    UO_unit,
+    UO_unit, UO_density_unit,
+    UO_unit, UO_density_unit, UO_linear_density_unit,
+    UO_unit, UO_angle_unit, UO_plane_angle_unit,
+    UO_unit,
+    UO_unit, UO_dimensionless_unit, UO_ratio,
+    UO_unit, UO_dimensionless_unit,
+    UO_unit, UO_dimensionless_unit,
+    UO_unit, UO_dimensionless_unit,
+    UO_unit, UO_dimensionless_unit, UO_ratio,
+    UO_unit, UO_dimensionless_unit, UO_count_unit,
+    UO_unit, UO_dimensionless_unit, UO_percent, UO_ratio,
+    UO_unit, UO_dimensionless_unit, UO_percent, UO_ratio,
+    UO_unit, UO_temperature_unit,
+    UO_unit, UO_concentration_unit, UO_dimensionless_unit,
+    UO_unit, UO_specific_volume_unit, UO_volume_unit,
+    UO_unit, UO_specific_volume_unit, UO_volume_unit,
+    UO_unit, UO_specific_volume_unit, UO_volume_unit,
+    UO_unit, UO_concentration_unit,
+    UO_unit, UO_concentration_unit, UO_cell_concentration_unit,
+    UO_unit, UO_concentration_unit,
+    UO_unit, UO_concentration_unit, UO_catalytic__activity__concentration_unit,
+    UO_unit, UO_concentration_unit, UO_catalytic__activity__concentration_unit,
+    UO_unit, UO_concentration_unit,
+    UO_unit, UO_concentration_unit, UO_volume_per_unit_volume,
+    UO_unit, UO_concentration_unit, UO_volume_per_unit_volume,
+    UO_unit, UO_mass_density_unit, UO_density_unit,
+    UO_unit, UO_volume_unit,
+    UO_unit, UO_dimensionless_unit, UO_count_unit,
+    UO_unit, UO_dimensionless_unit, UO_count_unit,
+    UO_unit, UO_concentration_unit,
+    UO_unit, UO_concentration_unit, UO_colony_forming_unit_per_volume,
+    UO_unit, UO_concentration_unit,
+    UO_unit, UO_concentration_unit, UO_plaque_forming_unit_per_volume,
+    UO_unit, UO_radiation_unit, UO_activity__of_a_radionuclide__unit,
+    UO_unit,
+    UO_unit, UO_electric_potential_difference_unit,
+    UO_unit,
+    UO_unit, UO_electric_charge,
+    UO_unit, UO_mass_unit,
+    UO_unit, UO_mass_unit,
+    UO_unit, UO_energy_unit,
+    UO_unit, UO_energy_unit,
+    UO_unit,
+    UO_unit, UO_magnetic_flux_unit,
+    UO_unit,
+    UO_unit, UO_magnetic_flux_density_unit,
+    UO_unit, UO_magnetic_flux_unit,
+    UO_unit, UO_magnetic_flux_unit,
+    UO_unit,
+    UO_unit, UO_information_unit,
+    UO_unit, UO_information_unit,
+    UO_unit, UO_information_unit,
+    UO_unit, UO_information_unit,
+    UO_unit, UO_information_unit,
+    UO_unit, UO_information_unit, UO_image_resolution_unit,
+    UO_unit, UO_information_unit, UO_image_resolution_unit,
+    UO_unit, UO_information_unit, UO_image_resolution_unit,
+    UO_unit, UO_information_unit, UO_image_resolution_unit, UO_spatial_resolution_unit,
+    UO_unit, UO_information_unit, UO_image_resolution_unit, UO_spatial_resolution_unit,
+    UO_unit, UO_information_unit, UO_image_resolution_unit, UO_spatial_resolution_unit,
+    UO_unit, UO_information_unit, UO_image_resolution_unit, UO_spatial_resolution_unit,
+    UO_unit, UO_dimensionless_unit, UO_count_unit,
+    UO_unit, UO_information_unit,
+    UO_unit, UO_information_unit,
+    UO_unit, UO_electric_potential_difference_unit,
+    UO_unit, UO_electric_potential_difference_unit,
+    UO_unit, UO_electric_potential_difference_unit,
+    UO_unit, UO_electric_potential_difference_unit,
+    UO_unit, UO_electric_potential_difference_unit,
+    UO_unit, UO_electric_potential_difference_unit,
+    UO_unit,
+    UO_unit, UO_surface_tension_unit,
+    UO_unit, UO_surface_tension_unit,
+    UO_unit,
+    UO_unit, UO_viscosity_unit,
+    UO_unit, UO_viscosity_unit,
+    UO_unit, UO_dimensionless_unit, UO_ratio,
+    UO_unit, UO_radiation_unit,
+    UO_unit,
+    UO_unit, UO_conduction_unit,
+    UO_unit, UO_conduction_unit,
+    UO_unit, UO_conduction_unit, UO_electrical_conduction_unit,
+    UO_unit, UO_conduction_unit, UO_heat_conduction_unit,
+    UO_unit, UO_energy_unit,
+    UO_unit,
+    UO_unit, UO_electric_field_strength_unit,
+    UO_unit, UO_dimensionless_unit,
+    UO_unit,
+    UO_unit, UO_volumetric_flow_rate_unit,
+    UO_unit, UO_pressure_unit,
+    UO_unit, UO_mass_density_unit, UO_density_unit,
+    UO_unit, UO_mass_density_unit, UO_density_unit,
+    UO_unit, UO_mass_density_unit, UO_density_unit,
+    UO_unit, UO_concentration_unit,
+    UO_unit, UO_concentration_unit, UO_amount_per_container,
+    UO_unit, UO_concentration_unit, UO_amount_per_container,
+    UO_unit, UO_concentration_unit, UO_unit_per_volume_unit,
+    UO_unit,
+    UO_unit, UO_rate_unit,
+    UO_unit, UO_rate_unit,
+    UO_unit, UO_area_density_unit, UO_density_unit,
+    UO_unit, UO_rate_unit,
+    UO_unit, UO_rate_unit,
+    UO_unit, UO_mass_density_unit, UO_density_unit,
+}; // isAClosure_
+
+
+struct TermRelations
+{
+    unsigned int isA, partOf, other, exactSynonym, propertyValue, isAClosure;
+};
+
+
+// where each term's entries begin in the relation arrays; they end where the next term's begin
+const TermRelations termRelations_[] =
+{
+    {0, 0, 0, 0, 0, 0}, // CVID_Unknown
+    {0, 0, 1, 1, 1, 0}, // MS_Proteomics_Standards_Initiative_Mass_Spectrometry_Vocabularies
+    {0, 0, 1, 1, 1, 0}, // MS_sample_number
+    {1, 0, 1, 1, 1, 2}, // MS_sample_name
+    {2, 0, 1, 1, 1, 4}, // MS_sample_state
+    {3, 0, 1, 1, 1, 6}, // MS_sample_mass
+    {4, 0, 2, 1, 1, 8}, // MS_sample_volume
+    {5, 0, 3, 1, 1, 10}, // MS_sample_concentration
+    {6, 0, 4, 1, 1, 12}, // MS_inlet_type
+    {6, 1, 4, 1, 1, 12}, // MS_ionization_type
+    {6, 2, 4, 1, 1, 12}, // MS_ionization_mode_OBSOLETE
+    {6, 2, 4, 1, 1, 12}, // MS_analyzer_type_OBSOLETE
+    {6, 2, 4, 1, 1, 12}, // MS_mass_resolution
+    {7, 2, 4, 1, 1, 14}, // MS_resolution_measurement_method
+    {8, 2, 4, 1, 1, 15}, // MS_resolution_type_OBSOLETE
+    {8, 2, 4, 1, 1, 15}, // MS_accuracy
+    {9, 2, 6, 1, 1, 16}, // MS_scan_rate
+    {10, 2, 7, 1, 1, 18}, // MS_scan_start_time
+    {12, 2, 9, 1, 1, 25}, // MS_Scan_Function_OBSOLETE
+    {12, 2, 9, 1, 1, 25}, // MS_scan_direction
+    {12, 3, 9, 1, 1, 25}, // MS_scan_law
+    {12, 4, 9, 1, 1, 25}, // MS_scanning_method_OBSOLETE
+    {12, 4, 9, 1, 1, 25}, // MS_reflectron_state
+    {13, 4, 9, 1, 1, 26}, // MS_TOF_Total_Path_Length
+    {14, 4, 10, 1, 1, 27}, // MS_isolation_width_OBSOLETE
+    {14, 4, 11, 1, 1, 27}, // MS_final_MS_exponent
+    {15, 4, 11, 1, 1, 28}, // MS_magnetic_field_strength
+    {16, 4, 12, 2, 1, 29}, // MS_detector_type
+    {16, 5, 12, 2, 1, 29}, // MS_detector_acquisition_mode
+    {16, 6, 12, 2, 1, 29}, // MS_detector_resolution
+    {17, 6, 12, 2, 1, 30}, // MS_sampling_frequency
+    {18, 6, 13, 2, 1, 31}, // MS_vendor_OBSOLETE
+    {18, 6, 13, 2, 1, 31}, // MS_instrument_model
+    {18, 7, 13, 2, 1, 31}, // MS_customization
+    {19, 7, 13, 2, 1, 33}, // MS_deisotoping
+    {20, 7, 13, 2, 1, 35}, // MS_charge_deconvolution
+    {21, 7, 13, 2, 1, 37}, // MS_peak_picking
+    {22, 7, 13, 2, 1, 39}, // MS_scan_mode_OBSOLETE
+    {22, 7, 13, 2, 1, 39}, // MS_polarity_OBSOLETE
+    {22, 7, 13, 2, 1, 39}, // MS_minute_OBSOLETE
+    {22, 7, 13, 2, 1, 39}, // MS_second_OBSOLETE
+    {22, 7, 13, 2, 1, 39}, // MS_m_z
+    {22, 7, 13, 5, 1, 39}, // MS_charge_state
+    {23, 7, 13, 6, 1, 41}, // MS_peak_intensity
+    {24, 8, 18, 6, 1, 43}, // MS_intensity_unit
+    {24, 8, 18, 6, 1, 43}, // MS_dissociation_method
+    {24, 9, 18, 6, 1, 43}, // MS_collision_energy
+    {25, 9, 19, 6, 1, 44}, // MS_energy_unit_OBSOLETE
+    {25, 9, 19, 6, 1, 44}, // MS_emulsion
+    {26, 9, 19, 6, 1, 47}, // MS_gaseous_sample_state
+    {27, 9, 19, 6, 1, 50}, // MS_liquid_sample_state
+    {28, 9, 19, 6, 1, 53}, // MS_solid_sample_state
+    {29, 9, 19, 6, 1, 56}, // MS_solution
+    {30, 9, 19, 6, 1, 59}, // MS_suspension
+    {31, 9, 19, 6, 1, 62}, // MS_sample_batch
+    {32, 9, 19, 6, 1, 64}, // MS_chromatography_OBSOLETE
+    {32, 9, 19, 6, 1, 64}, // MS_continuous_flow_fast_atom_bombardment
+    {33, 9, 19, 7, 1, 65}, // MS_direct_inlet
+    {34, 9, 19, 7, 1, 66}, // MS_electrospray_inlet
+    {35, 9, 19, 7, 1, 67}, // MS_flow_injection_analysis
+    {36, 9, 19, 7, 1, 68}, // MS_inductively_coupled_plasma
+    {37, 9, 19, 7, 1, 69}, // MS_infusion
+    {38, 9, 19, 7, 1, 70}, // MS_jet_separator
+    {39, 9, 19, 7, 1, 71}, // MS_membrane_separator
+    {40, 9, 19, 7, 1, 72}, // MS_moving_belt
+    {41, 9, 19, 7, 1, 73}, // MS_moving_wire
+    {42, 9, 19, 7, 1, 74}, // MS_open_split
+    {43, 9, 19, 7, 1, 75}, // MS_particle_beam
+    {44, 9, 19, 7, 1, 76}, // MS_reservoir
+    {45, 9, 19, 7, 1, 77}, // MS_septum
+    {46, 9, 19, 7, 1, 78}, // MS_thermospray_inlet
+    {47, 9, 19, 7, 1, 79}, // MS_atmospheric_pressure_chemical_ionization
+    {48, 9, 19, 8, 1, 81}, // MS_chemical_ionization
+    {49, 9, 19, 9, 1, 82}, // MS_Electronic_Ionization_OBSOLETE
+    {49, 9, 19, 10, 1, 82}, // MS_electrospray_ionization
+    {50, 9, 19, 11, 1, 83}, // MS_fast_atom_bombardment_ionization
+    {51, 9, 19, 12, 1, 84}, // MS_matrix_assisted_laser_desorption_ionization
+    {52, 9, 19, 13, 1, 86}, // MS_negative_ion_mode_OBSOLETE
+    {52, 9, 19, 13, 1, 86}, // MS_positive_ion_mode_OBSOLETE
+    {52, 9, 19, 13, 1, 86}, // MS_axial_ejection_linear_ion_trap
+    {53, 9, 19, 13, 1, 89}, // MS_fourier_transform_ion_cyclotron_resonance_mass_spectrometer
+    {54, 9, 19, 14, 1, 90}, // MS_magnetic_sector
+    {55, 9, 19, 14, 1, 91}, // MS_quadrupole
+    {56, 9, 19, 14, 1, 92}, // MS_quadrupole_ion_trap
+    {57, 9, 19, 17, 1, 94}, // MS_radial_ejection_linear_ion_trap
+    {58, 9, 19, 17, 1, 97}, // MS_time_of_flight
+    {59, 9, 19, 18, 1, 98}, // MS_baseline
+    {60, 9, 19, 18, 1, 100}, // MS_full_width_at_half_maximum
+    {61, 9, 19, 19, 1, 102}, // MS_ten_percent_valley
+    {62, 9, 19, 19, 1, 104}, // MS_constant_OBSOLETE
+    {62, 9, 19, 19, 1, 104}, // MS_proportional_OBSOLETE
+    {62, 9, 19, 19, 1, 104}, // MS_mass_scan_OBSOLETE
+    {62, 9, 19, 19, 1, 104}, // MS_selected_ion_detection_OBSOLETE
+    {62, 9, 19, 19, 1, 104}, // MS_decreasing_m_z_scan
+    {63, 9, 19, 19, 1, 105}, // MS_increasing_m_z_scan
+    {64, 9, 19, 19, 1, 106}, // MS_exponential
+    {65, 9, 19, 19, 1, 107}, // MS_linear_OBSOLETE
+    {66, 9, 19, 19, 1, 108}, // MS_quadratic
+    {67, 9, 19, 19, 1, 109}, // MS_constant_neutral_mass_loss_OBSOLETE
+    {67, 9, 19, 19, 1, 109}, // MS_multiple_ion_monitoring_OBSOLETE
+    {67, 9, 19, 19, 1, 109}, // MS_multiple_reaction_monitoring_OBSOLETE
+    {67, 9, 19, 20, 1, 109}, // MS_precursor_ion_scan_OBSOLETE
+    {67, 9, 19, 20, 1, 109}, // MS_product_ion_scan_OBSOLETE
+    {67, 9, 19, 20, 1, 109}, // MS_single_ion_monitoring_OBSOLETE
+    {67, 9, 19, 20, 1, 109}, // MS_single_reaction_monitoring_OBSOLETE
+    {67, 9, 19, 20, 1, 109}, // MS_None____OBSOLETE
+    {67, 9, 19, 20, 1, 109}, // MS_reflectron_off
+    {68, 9, 19, 20, 1, 111}, // MS_reflectron_on
+    {69, 9, 19, 20, 1, 113}, // MS_channeltron
+    {70, 9, 19, 21, 1, 114}, // MS_conversion_dynode_electron_multiplier
+    {71, 9, 19, 21, 1, 116}, // MS_conversion_dynode_photomultiplier
+    {72, 9, 19, 21, 1, 118}, // MS_daly_detector
+    {73, 9, 19, 22, 1, 119}, // MS_electron_multiplier_tube
+    {74, 9, 19, 23, 1, 121}, // MS_faraday_cup
+    {75, 9, 19, 23, 1, 122}, // MS_focal_plane_array
+    {76, 9, 19, 23, 1, 124}, // MS_microchannel_plate_detector
+    {77, 9, 19, 24, 1, 126}, // MS_multi_collector
+    {78, 9, 19, 24, 1, 127}, // MS_photomultiplier
+    {79, 9, 19, 25, 1, 128}, // MS_analog_digital_converter
+    {80, 9, 19, 26, 1, 129}, // MS_pulse_counting
+    {81, 9, 19, 26, 1, 130}, // MS_time_digital_converter
+    {82, 9, 19, 27, 1, 131}, // MS_transient_recorder
+    {83, 9, 19, 27, 1, 132}, // MS_SCIEX_instrument_model
+    {84, 9, 19, 27, 1, 133}, // MS_Bruker_Daltonics_instrument_model
+    {85, 9, 19, 27, 1, 134}, // MS_IonSpec_instrument_model
+    {86, 9, 19, 27, 1, 136}, // MS_Shimadzu_instrument_model
+    {87, 9, 19, 27, 1, 137}, // MS_Thermo_Finnigan_instrument_model
+    {88, 9, 19, 27, 1, 139}, // MS_Waters_instrument_model
+    {89, 9, 19, 27, 1, 140}, // MS_centroid_spectrum
+    {90, 9, 19, 28, 1, 141}, // MS_profile_spectrum
+    {91, 9, 19, 30, 1, 142}, // MS_negative_scan
+    {93, 9, 19, 30, 1, 145}, // MS_positive_scan
+    {95, 9, 19, 30, 1, 148}, // MS_number_of_detector_counts
+    {96, 9, 19, 30, 1, 149}, // MS_percent_of_base_peak
+    {97, 9, 19, 30, 1, 150}, // MS_collision_induced_dissociation
+    {98, 9, 19, 33, 1, 151}, // MS_plasma_desorption
+    {99, 9, 19, 34, 1, 152}, // MS_post_source_decay
+    {100, 9, 19, 35, 1, 153}, // MS_surface_induced_dissociation
+    {101, 9, 19, 36, 1, 154}, // MS_electron_volt_OBSOLETE
+    {101, 9, 19, 37, 1, 154}, // MS_normalized_collision_energy
+    {102, 9, 20, 37, 1, 155}, // MS_4000_QTRAP
+    {103, 9, 20, 37, 1, 157}, // MS_4700_Proteomics_Analyzer
+    {104, 9, 20, 37, 1, 159}, // MS_apex_IV
+    {105, 9, 20, 37, 1, 162}, // MS_apex_Q
+    {106, 9, 20, 37, 1, 165}, // MS_API_150EX
+    {107, 9, 20, 37, 1, 167}, // MS_API_150EX_Prep
+    {108, 9, 20, 37, 1, 169}, // MS_API_2000
+    {109, 9, 20, 37, 1, 171}, // MS_API_3000
+    {110, 9, 20, 37, 1, 173}, // MS_API_4000
+    {111, 9, 20, 37, 1, 175}, // MS_autoflex_II
+    {112, 9, 20, 37, 1, 178}, // MS_autoflex_TOF_TOF
+    {113, 9, 20, 37, 1, 181}, // MS_Auto_Spec_Ultima_NT
+    {114, 9, 20, 37, 1, 183}, // MS_BioTOF_II
+    {115, 9, 20, 37, 1, 186}, // MS_BioTOF_Q
+    {116, 9, 20, 37, 1, 189}, // MS_DELTA_plusAdvantage
+    {117, 9, 20, 37, 1, 192}, // MS_DELTAplusXP
+    {118, 9, 20, 37, 1, 195}, // MS_ELEMENT2_OBSOLETE
+    {118, 9, 20, 37, 1, 195}, // MS_esquire_4000
+    {119, 9, 20, 37, 1, 198}, // MS_esquire_6000
+    {120, 9, 20, 37, 1, 201}, // MS_explorer
+    {121, 9, 20, 37, 1, 204}, // MS_GCT
+    {122, 9, 20, 37, 1, 206}, // MS_HCT
+    {123, 9, 20, 37, 1, 209}, // MS_HCTplus
+    {124, 9, 20, 37, 1, 212}, // MS_HiRes_ESI
+    {125, 9, 20, 37, 1, 215}, // MS_HiRes_MALDI
+    {126, 9, 20, 37, 1, 218}, // MS_IsoPrime
+    {127, 9, 20, 37, 1, 220}, // MS_IsoProbe
+    {128, 9, 20, 37, 1, 222}, // MS_IsoProbe_T
+    {129, 9, 20, 37, 1, 224}, // MS_LCQ_Advantage
+    {130, 9, 20, 37, 1, 227}, // MS_LCQ_Classic
+    {131, 9, 20, 37, 1, 230}, // MS_LCQ_Deca_XP_Plus
+    {132, 9, 20, 37, 1, 233}, // MS_M_LDI_L
+    {133, 9, 20, 37, 1, 235}, // MS_M_LDI_LR
+    {134, 9, 20, 37, 1, 237}, // MS_MAT253
+    {135, 9, 20, 37, 1, 240}, // MS_MAT900XP
+    {136, 9, 20, 37, 1, 243}, // MS_MAT900XP_Trap
+    {137, 9, 20, 37, 1, 246}, // MS_MAT95XP
+    {138, 9, 20, 37, 1, 249}, // MS_MAT95XP_Trap
+    {139, 9, 20, 37, 1, 252}, // MS_microflex
+    {140, 9, 20, 37, 1, 255}, // MS_microTOF_LC
+    {141, 9, 20, 37, 1, 258}, // MS_neptune
+    {142, 9, 20, 37, 1, 261}, // MS_NG_5400
+    {143, 9, 20, 37, 1, 263}, // MS_OMEGA
+    {144, 9, 20, 37, 1, 266}, // MS_OMEGA_2001
+    {145, 9, 20, 37, 1, 269}, // MS_OmniFlex
+    {146, 9, 20, 37, 1, 272}, // MS_Platform_ICP
+    {147, 9, 20, 37, 1, 274}, // MS_PolarisQ
+    {148, 9, 20, 37, 1, 277}, // MS_proteomics_solution_1
+    {149, 9, 20, 37, 1, 279}, // MS_Q_TRAP
+    {150, 9, 20, 37, 1, 281}, // MS_Q_Tof_micro
+    {151, 9, 20, 37, 1, 283}, // MS_Q_Tof_ultima
+    {152, 9, 20, 37, 1, 285}, // MS_QSTAR
+    {153, 9, 20, 37, 1, 287}, // MS_quattro_micro
+    {154, 9, 20, 37, 1, 289}, // MS_Quattro_UItima
+    {155, 9, 20, 37, 1, 291}, // MS_Surveyor_MSQ
+    {156, 9, 20, 37, 1, 294}, // MS_SymBiot_I
+    {157, 9, 20, 37, 1, 296}, // MS_SymBiot_XVI
+    {158, 9, 20, 37, 1, 298}, // MS_TEMPUS_TOF
+    {159, 9, 20, 37, 1, 301}, // MS_TRACE_DSQ
+    {160, 9, 20, 37, 1, 304}, // MS_TRITON
+    {161, 9, 20, 37, 1, 307}, // MS_TSQ_Quantum
+    {162, 9, 20, 37, 1, 310}, // MS_ultima
+    {163, 9, 20, 37, 1, 313}, // MS_ultraflex
+    {164, 9, 20, 37, 1, 316}, // MS_ultraflex_TOF_TOF
+    {165, 9, 20, 37, 1, 319}, // MS_Voyager_DE_PRO
+    {166, 9, 20, 37, 1, 321}, // MS_Voyager_DE_STR
+    {167, 9, 20, 37, 1, 323}, // MS_selected_ion_monitoring
+    {168, 9, 20, 39, 1, 324}, // MS_selected_reaction_monitoring
+    {169, 9, 20, 40, 1, 325}, // MS_accurate_mass_OBSOLETE
+    {169, 9, 21, 40, 1, 325}, // MS_average_mass_OBSOLETE
+    {169, 9, 22, 40, 1, 325}, // MS_appearance_energy_OBSOLETE
+    {169, 9, 23, 41, 1, 325}, // MS_base_peak
+    {170, 9, 23, 42, 1, 326}, // MS_OBSOLETE_charge_number_OBSOLETE
+    {170, 9, 23, 43, 1, 326}, // MS_dalton_OBSOLETE
+    {170, 9, 23, 44, 1, 326}, // MS_electron_affinity_OBSOLETE
+    {170, 9, 23, 45, 1, 326}, // MS_electron_energy_obsolete_OBSOLETE
+    {170, 9, 23, 45, 1, 326}, // MS_exact_mass_OBSOLETE
+    {170, 9, 24, 45, 1, 326}, // MS_field_free_region
+    {171, 9, 24, 46, 1, 328}, // MS_ionization_cross_section_OBSOLETE
+    {171, 9, 24, 46, 1, 328}, // MS_ionization_efficiency_OBSOLETE
+    {171, 9, 24, 46, 1, 328}, // MS_ionization_energy_OBSOLETE
+    {171, 9, 25, 47, 1, 328}, // MS_isotope_dilution_mass_spectrometry_OBSOLETE
+    {171, 9, 25, 48, 1, 328}, // MS_magnetic_deflection
+    {172, 9, 25, 48, 1, 330}, // MS_mass_defect_OBSOLETE
+    {172, 9, 26, 48, 1, 330}, // MS_mass_number_OBSOLETE
+    {172, 9, 26, 48, 1, 330}, // MS_molecular_mass_OBSOLETE
+    {172, 9, 27, 48, 1, 330}, // MS_monoisotopic_mass_OBSOLETE
+    {172, 9, 28, 48, 1, 330}, // MS_molecular_beam_mass_spectrometry_OBSOLETE
+    {172, 9, 28, 49, 1, 330}, // MS_multiphoton_ionization
+    {173, 9, 28, 50, 1, 331}, // MS_nitrogen_rule_OBSOLETE
+    {173, 9, 28, 50, 1, 331}, // MS_nominal_mass_OBSOLETE
+    {173, 9, 29, 50, 1, 331}, // MS_odd_electron_rule_OBSOLETE
+    {173, 9, 29, 50, 1, 331}, // MS_peak
+    {173, 10, 29, 50, 1, 331}, // MS_peak_intensity_OBSOLETE
+    {173, 10, 29, 50, 1, 331}, // MS_proton_affinity_OBSOLETE
+    {173, 10, 29, 51, 1, 331}, // MS_mass_resolving_power_OBSOLETE
+    {173, 10, 29, 51, 1, 331}, // MS_total_ion_current_chromatogram
+    {175, 10, 29, 52, 1, 334}, // MS_transmission
+    {176, 10, 29, 52, 1, 336}, // MS_unified_atomic_mass_unit_OBSOLETE
+    {176, 10, 29, 53, 1, 336}, // MS_accelerator_mass_spectrometry_OBSOLETE
+    {176, 10, 29, 54, 1, 336}, // MS_atmospheric_pressure_matrix_assisted_laser_desorption_ionization
+    {177, 10, 29, 55, 1, 338}, // MS_atmospheric_pressure_ionization
+    {178, 10, 29, 56, 1, 339}, // MS_Atmostpheric_Pressure_Photoionization_OBSOLETE
+    {178, 10, 29, 57, 1, 339}, // MS_blackbody_infrared_radiative_dissociation
+    {179, 10, 29, 58, 1, 340}, // MS_charge_remote_fragmentation_OBSOLETE
+    {179, 10, 29, 59, 1, 340}, // MS_consecutive_reaction_monitoring_OBSOLETE_1000244
+    {179, 10, 29, 60, 1, 340}, // MS_charge_stripping
+    {180, 10, 29, 61, 1, 341}, // MS_delayed_extraction
+    {181, 10, 29, 62, 1, 343}, // MS_desorption_ionization
+    {182, 10, 29, 63, 1, 344}, // MS_direct_insertion_probe
+    {183, 10, 29, 64, 1, 345}, // MS_direct_liquid_introduction
+    {184, 10, 29, 65, 1, 346}, // MS_electron_capture_dissociation
+    {185, 10, 29, 66, 1, 347}, // MS_even_electron_ion_OBSOLETE
+    {185, 10, 29, 67, 1, 347}, // MS_electron_induced_excitation_in_organics_OBSOLETE
+    {185, 10, 29, 68, 1, 347}, // MS_electron_multiplier
+    {186, 10, 29, 69, 1, 348}, // MS_electrostatic_energy_analyzer
+    {187, 10, 29, 70, 1, 349}, // MS_flowing_afterglow
+    {188, 10, 29, 71, 1, 350}, // MS_high_field_asymmetric_waveform_ion_mobility_spectrometry_OBSOLETE
+    {188, 10, 29, 72, 1, 350}, // MS_field_desorption
+    {189, 10, 29, 73, 1, 352}, // MS_field_ionization
+    {190, 10, 29, 74, 1, 353}, // MS_glow_discharge_ionization
+    {191, 10, 29, 75, 1, 354}, // MS_ion_kinetic_energy_spectrometry_OBSOLETE
+    {191, 10, 29, 76, 1, 354}, // MS_ion_mobility_spectrometry_OBSOLETE
+    {191, 10, 29, 77, 1, 354}, // MS_infrared_multiphoton_dissociation
+    {192, 10, 29, 78, 1, 355}, // MS_isotope_ratio_mass_spectrometry_OBSOLETE
+    {192, 10, 29, 79, 1, 355}, // MS_ion_trap
+    {193, 10, 29, 80, 1, 356}, // MS_kinetic_energy_release_distribution_OBSOLETE
+    {193, 10, 29, 81, 1, 356}, // MS_Laser_Desorption_OBSOLETE
+    {193, 10, 29, 83, 1, 356}, // MS_mass_analyzed_ion_kinetic_energy_spectrometry_OBSOLETE
+    {193, 10, 29, 84, 1, 356}, // MS_mass_spectrometry_OBSOLETE
+    {193, 10, 29, 85, 1, 356}, // MS_mass_spectrometry_mass_spectrometry_OBSOLETE
+    {193, 10, 29, 86, 1, 356}, // MS_multiple_stage_mass_spectrometry_OBSOLETE
+    {193, 10, 29, 87, 1, 356}, // MS_Negative_Ion_chemical_ionization
+    {194, 10, 29, 88, 1, 357}, // MS_neutralization_reionization_mass_spectrometry
+    {195, 10, 29, 89, 1, 358}, // MS_photoionization
+    {196, 10, 29, 90, 1, 359}, // MS_pyrolysis_mass_spectrometry
+    {197, 10, 29, 91, 1, 360}, // MS_collision_quadrupole
+    {198, 10, 29, 92, 1, 362}, // MS_resonance_enhanced_multiphoton_ionization
+    {199, 10, 29, 93, 1, 363}, // MS_residual_gas_analyzer_OBSOLETE
+    {199, 10, 29, 94, 1, 363}, // MS_surface_enhanced_laser_desorption_ionization
+    {200, 10, 29, 95, 1, 365}, // MS_surface_enhanced_neat_desorption
+    {201, 10, 29, 96, 1, 367}, // MS_suface_ionization_OBSOLETE
+    {201, 10, 29, 97, 1, 367}, // MS_selected_ion_flow_tube
+    {202, 10, 29, 98, 1, 369}, // MS_sustained_off_resonance_irradiation
+    {203, 10, 29, 99, 1, 370}, // MS_Spark_Source_Mass_Spectrometry_OBSOLETE
+    {203, 10, 29, 100, 1, 370}, // MS_stored_waveform_inverse_fourier_transform
+    {204, 10, 29, 101, 1, 371}, // MS_total_ion_current
+    {205, 10, 29, 102, 1, 373}, // MS_time_lag_focusing
+    {206, 10, 29, 103, 1, 375}, // MS_time_of_flight_mass_spectrometer_OBSOLETE
+    {206, 10, 29, 104, 1, 375}, // MS_cyclotron
+    {207, 10, 29, 104, 1, 376}, // MS_double_focusing_mass_spectrometer_OBSOLETE
+    {207, 10, 29, 104, 1, 376}, // MS_hybrid_mass_spectrometer_OBSOLETE
+    {207, 10, 29, 104, 1, 376}, // MS_linear_ion_trap
+    {208, 10, 29, 104, 1, 378}, // MS_mass_spectrograph_obsolete_OBSOLETE
+    {208, 10, 29, 104, 1, 378}, // MS_mass_spectrometer_OBSOLETE
+    {208, 10, 29, 104, 1, 378}, // MS_mass_spectrum
+    {210, 10, 29, 104, 1, 380}, // MS_mattauch_herzog_geometry_OBSOLETE
+    {210, 10, 29, 104, 1, 380}, // MS_nier_johnson_geometry_OBSOLETE
+    {210, 10, 29, 104, 1, 380}, // MS_paul_ion_trap_OBSOLETE
+    {210, 10, 29, 104, 1, 380}, // MS_prolate_traochoidal_mass_spectrometer_OBSOLETE
+    {210, 10, 29, 104, 1, 380}, // MS_quistor_OBSOLETE
+    {210, 10, 29, 104, 1, 380}, // MS_reflectron
+    {211, 10, 29, 104, 1, 382}, // MS_sector_mass_spectrometer_OBSOLETE
+    {211, 10, 29, 104, 1, 382}, // MS_tandem_mass_spectrometer_OBSOLETE
+    {211, 10, 29, 104, 1, 382}, // MS_transmission_quadrupole_mass_spectrometer_OBSOLETE
+    {211, 10, 29, 104, 1, 382}, // MS_accelerating_voltage
+    {212, 10, 30, 104, 1, 384}, // MS_cyclotron_motion_OBSOLETE
+    {212, 10, 30, 104, 1, 384}, // MS_dynamic_mass_spectrometry_OBSOLETE
+    {212, 10, 30, 104, 1, 384}, // MS_einzel_lens
+    {213, 10, 30, 104, 1, 386}, // MS_electric_field_strength
+    {214, 10, 31, 104, 1, 388}, // MS_first_stability_region
+    {215, 10, 31, 104, 1, 390}, // MS_fringing_field
+    {216, 10, 31, 104, 1, 392}, // MS_kinetic_energy_analyzer
+    {217, 10, 31, 104, 1, 394}, // MS_mass_limit_OBSOLETE
+    {217, 10, 31, 104, 1, 394}, // MS_scan_m_z_range__OBSOLETE
+    {217, 10, 31, 104, 1, 394}, // MS_mass_selective_axial_ejection_OBSOLETE
+    {217, 10, 31, 104, 1, 394}, // MS_mass_selective_instability_OBSOLETE
+    {217, 10, 31, 104, 1, 394}, // MS_mathieu_stability_diagram_OBSOLETE
+    {217, 10, 31, 104, 1, 394}, // MS_orthogonal_extraction_OBSOLETE
+    {217, 10, 31, 104, 1, 394}, // MS_resonance_ion_ejection_OBSOLETE
+    {217, 10, 31, 104, 1, 394}, // MS_space_charge_effect
+    {218, 10, 31, 104, 1, 396}, // MS_static_field
+    {219, 10, 31, 104, 1, 398}, // MS_2E_Mass_Spectrum_OBSOLETE
+    {219, 10, 31, 104, 1, 398}, // MS_charge_inversion_mass_spectrum
+    {221, 10, 31, 104, 1, 401}, // MS_constant_neutral_loss_scan_OBSOLETE
+    {221, 10, 31, 104, 1, 401}, // MS_constant_neutral_gain_scan_OBSOLETE
+    {221, 10, 31, 105, 1, 401}, // MS_constant_neutral_gain_spectrum
+    {223, 10, 31, 106, 1, 404}, // MS_constant_neutral_loss_spectrum
+    {225, 10, 31, 107, 1, 407}, // MS_consecutive_reaction_monitoring_OBSOLETE_1000327
+    {225, 10, 31, 107, 1, 407}, // MS_e_2_mass_spectrum
+    {226, 10, 31, 107, 1, 410}, // MS_linked_scan_OBSOLETE
+    {226, 10, 31, 107, 1, 410}, // MS_linked_scan_at_constant_b_e_OBSOLETE
+    {226, 10, 31, 107, 1, 410}, // MS_Linked_Scan_at_Constant_E2_V_OBSOLETE
+    {226, 10, 31, 107, 1, 410}, // MS_Linked_Scan_at_Constant_B2_E_OBSOLETE
+    {226, 10, 31, 107, 1, 410}, // MS_Linked_Scan_at_Constant_B_1__E_E0___1_2___E_OBSOLETE
+    {226, 10, 31, 107, 1, 410}, // MS_MS_MS_in_Time_OBSOLETE
+    {226, 10, 31, 107, 1, 410}, // MS_MS_MS_in_Space_OBSOLETE
+    {226, 10, 31, 107, 1, 410}, // MS_neutral_loss
+    {227, 10, 31, 107, 1, 411}, // MS_nth_generation_product_ion_OBSOLETE
+    {227, 10, 31, 107, 1, 411}, // MS_nth_generation_product_ion_scan_OBSOLETE
+    {227, 10, 31, 107, 1, 411}, // MS_nth_generation_product_ion_spectrum_OBSOLETE
+    {227, 10, 31, 107, 1, 411}, // MS_precursor_ion_OBSOLETE
+    {227, 10, 31, 107, 1, 411}, // MS_precursor_ion_spectrum
+    {229, 10, 31, 107, 1, 414}, // MS_product_ion_OBSOLETE
+    {229, 10, 31, 107, 1, 414}, // MS_product_ion_spectrum_OBSOLETE
+    {231, 10, 31, 107, 1, 417}, // MS_progeny_ion_OBSOLETE
+    {231, 10, 31, 108, 1, 417}, // MS_array_detector
+    {232, 10, 31, 108, 1, 418}, // MS_conversion_dynode
+    {233, 10, 31, 108, 1, 419}, // MS_dynode
+    {234, 10, 31, 108, 1, 420}, // MS_focal_plane_collector
+    {235, 10, 31, 108, 1, 421}, // MS_ion_to_photon_detector
+    {236, 10, 31, 108, 1, 422}, // MS_point_collector
+    {237, 10, 31, 108, 1, 423}, // MS_postacceleration_detector
+    {238, 10, 31, 108, 1, 424}, // MS_secondary_electron_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_adduct_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_aromatic_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_analog_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_anti_aromatic_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_cationized_molecule_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_cluster_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_Conventional_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_diagnostic_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_dimeric_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_distonic_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_enium_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_fragment_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_ion__OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_Isotopologue_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_Isotopomeric_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_metastable_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_molecular_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_negative_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_non_classical_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_onium_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_principal_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_positive_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_protonated_molecule_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_radical_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_reference_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_stable_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_unstable_ion_OBSOLETE
+    {238, 10, 31, 108, 1, 424}, // MS_adiabatic_ionization
+    {239, 10, 31, 108, 1, 425}, // MS_associative_ionization
+    {240, 10, 31, 108, 1, 426}, // MS_atmospheric_pressure_photoionization
+    {241, 10, 31, 108, 1, 428}, // MS_autodetachment
+    {242, 10, 31, 108, 1, 429}, // MS_autoionization
+    {243, 10, 31, 108, 1, 430}, // MS_charge_exchange_ionization
+    {244, 10, 31, 108, 1, 431}, // MS_chemi_ionization
+    {245, 10, 31, 108, 1, 432}, // MS_desorption_ionization_on_silicon
+    {246, 10, 31, 108, 1, 434}, // MS_dissociative_ionization
+    {247, 10, 31, 108, 1, 435}, // MS_electron_ionization
+    {248, 10, 31, 108, 1, 436}, // MS_ion_desolvation_OBSOLETE
+    {248, 10, 31, 108, 1, 436}, // MS_ion_pair_formation_OBSOLETE
+    {248, 10, 31, 108, 1, 436}, // MS_ionization_efficiency
+    {249, 10, 31, 108, 1, 437}, // MS_laser_desorption_ionization
+    {250, 10, 31, 108, 1, 439}, // MS_liquid_secondary_ionization
+    {251, 10, 31, 108, 1, 440}, // MS_membrane_inlet
+    {252, 10, 31, 108, 1, 441}, // MS_microelectrospray
+    {253, 10, 31, 108, 1, 443}, // MS_nanoelectrospray
+    {254, 10, 31, 109, 1, 445}, // MS_penning_ionization
+    {255, 10, 31, 109, 1, 446}, // MS_plasma_desorption_ionization
+    {256, 10, 31, 109, 1, 447}, // MS_pre_ionization_state_OBSOLETE
+    {256, 10, 31, 109, 1, 447}, // MS_secondary_ionization
+    {257, 10, 31, 109, 1, 448}, // MS_soft_ionization
+    {258, 10, 31, 109, 1, 449}, // MS_spark_ionization
+    {259, 10, 31, 109, 1, 450}, // MS_surface_assisted_laser_desorption_ionization
+    {260, 10, 31, 109, 1, 452}, // MS_surface_ionization
+    {261, 10, 31, 109, 1, 453}, // MS_thermal_ionization
+    {262, 10, 31, 109, 1, 454}, // MS_vertical_ionization
+    {263, 10, 31, 109, 1, 455}, // MS_association_reaction_OBSOLETE
+    {263, 10, 31, 109, 1, 455}, // MS_alpha_cleavage_OBSOLETE
+    {263, 10, 31, 109, 1, 455}, // MS_beta_cleavage_OBSOLETE
+    {263, 10, 31, 109, 1, 455}, // MS_buffer_gas
+    {264, 10, 31, 109, 1, 456}, // MS_charge_induced_fragmentation_OBSOLETE
+    {264, 10, 31, 109, 1, 456}, // MS_charge_inversion_reaction_OBSOLETE
+    {264, 10, 31, 109, 1, 456}, // MS_charge_permutation_reaction_OBSOLETE
+    {264, 10, 31, 109, 1, 456}, // MS_charge_stripping_reaction_OBSOLETE
+    {264, 10, 31, 109, 1, 456}, // MS_charge_transfer_reaction_OBSOLETE
+    {264, 10, 31, 109, 1, 456}, // MS_collisional_excitation_OBSOLETE
+    {264, 10, 31, 109, 1, 456}, // MS_collision_gas
+    {265, 10, 31, 109, 1, 457}, // MS_heterolytic_cleavage_OBSOLETE
+    {265, 10, 31, 109, 1, 457}, // MS_high_energy_collision_OBSOLETE
+    {265, 10, 31, 109, 1, 457}, // MS_beam_type_collision_induced_dissociation
+    {266, 10, 31, 110, 1, 459}, // MS_homolytic_cleavage_OBSOLETE
+    {266, 10, 31, 110, 1, 459}, // MS_hydrogen_deuterium_exchange_OBSOLETE
+    {266, 10, 31, 110, 1, 459}, // MS_ion_energy_loss_spectrum_OBSOLETE
+    {266, 10, 31, 110, 1, 459}, // MS_ionizing_collision_OBSOLETE
+    {266, 10, 31, 110, 1, 459}, // MS_ion_molecule_reaction_OBSOLETE
+    {266, 10, 31, 110, 1, 459}, // MS_ion_neutral_complex_OBSOLETE
+    {266, 10, 31, 110, 1, 459}, // MS_ion_neutral_species_reaction_OBSOLETE
+    {266, 10, 31, 110, 1, 459}, // MS_ion_neutral_species_exchange_reaction_OBSOLETE
+    {266, 10, 31, 110, 1, 459}, // MS_kinetic_method_OBSOLETE
+    {266, 10, 31, 110, 1, 459}, // MS_low_energy_collisions_OBSOLETE
+    {266, 10, 31, 110, 1, 459}, // MS_low_energy_collision_induced_dissociation
+    {267, 10, 31, 110, 1, 460}, // MS_McLafferty_Rearrangement_OBSOLETE
+    {267, 10, 31, 110, 1, 460}, // MS_photodissociation
+    {268, 10, 31, 112, 1, 461}, // MS_partial_charge_transfer_reaction_OBSOLETE
+    {268, 10, 31, 112, 1, 461}, // MS_ion_reaction_OBSOLETE
+    {268, 10, 31, 112, 1, 461}, // MS_superelastic_collision_OBSOLETE
+    {268, 10, 31, 112, 1, 461}, // MS_surface_induced_reaction_OBSOLETE
+    {268, 10, 31, 112, 1, 461}, // MS_unimolecular_dissociation_OBSOLETE
+    {268, 10, 31, 112, 1, 461}, // MS_scan
+    {268, 11, 31, 112, 1, 461}, // MS_spectrum
+    {268, 12, 31, 112, 1, 461}, // MS_mass_analyzer_type
+    {268, 13, 31, 112, 1, 461}, // MS_m_z_Separation_Method_OBSOLETE
+    {268, 13, 31, 112, 1, 461}, // MS_sequential_m_z_separation_method_OBSOLETE
+    {268, 13, 31, 112, 1, 461}, // MS_fast_ion_bombardment
+    {269, 13, 31, 113, 1, 462}, // MS_LTQ
+    {270, 13, 31, 113, 1, 465}, // MS_LTQ_FT
+    {271, 13, 31, 113, 1, 468}, // MS_LTQ_Orbitrap
+    {272, 13, 31, 113, 1, 471}, // MS_LXQ
+    {273, 13, 31, 113, 1, 474}, // MS_mass_analyzer
+    {273, 14, 31, 114, 1, 474}, // MS_data_transformation
+    {273, 15, 31, 115, 1, 474}, // MS_detector
+    {273, 16, 31, 115, 1, 474}, // MS_instrument_additional_description_OBSOLETE
+    {273, 16, 31, 115, 1, 474}, // MS_ion_selection_attribute
+    {274, 17, 31, 115, 1, 475}, // MS_precursor_activation
+    {274, 18, 31, 116, 1, 475}, // MS_sample
+    {274, 19, 31, 116, 1, 475}, // MS_source
+    {274, 20, 31, 116, 1, 475}, // MS_spectrum_instrument_description_OBSOLETE
+    {274, 20, 31, 116, 1, 475}, // MS_unit_OBSOLETE
+    {274, 21, 31, 116, 1, 475}, // MS_additional_description_OBSOLETE
+    {274, 21, 31, 116, 1, 475}, // MS_ion_optics
+    {274, 22, 31, 116, 1, 475}, // MS_instrument
+    {274, 23, 31, 117, 1, 475}, // MS_mass_unit_OBSOLETE
+    {274, 23, 31, 117, 1, 475}, // MS_scan_polarity
+    {274, 24, 31, 117, 1, 475}, // MS_alternating_OBSOLETE
+    {274, 24, 31, 117, 1, 475}, // MS_1200_series_LC_MSD_SL
+    {275, 24, 31, 117, 1, 477}, // MS_6110_Quadrupole_LC_MS
+    {276, 24, 31, 117, 1, 479}, // MS_6120_Quadrupole_LC_MS
+    {277, 24, 31, 117, 1, 481}, // MS_6130_Quadrupole_LC_MS
+    {278, 24, 31, 117, 1, 483}, // MS_6140_Quadrupole_LC_MS
+    {279, 24, 31, 117, 1, 485}, // MS_6210_Time_of_Flight_LC_MS
+    {280, 24, 31, 117, 1, 487}, // MS_6310_Ion_Trap_LC_MS
+    {281, 24, 31, 117, 1, 489}, // MS_6320_Ion_Trap_LC_MS
+    {282, 24, 31, 117, 1, 491}, // MS_6330_Ion_Trap_LC_MS
+    {283, 24, 31, 117, 1, 493}, // MS_6340_Ion_Trap_LC_MS
+    {284, 24, 31, 117, 1, 495}, // MS_6410_Triple_Quadrupole_LC_MS
+    {285, 24, 31, 118, 1, 497}, // MS_1200_series_LC_MSD_VL
+    {286, 24, 31, 118, 1, 499}, // MS_purgatory_OBSOLETE
+    {286, 24, 31, 118, 1, 499}, // MS_mass_analyzer_attribute
+    {286, 25, 31, 118, 1, 499}, // MS_detector_attribute
+    {286, 26, 31, 118, 1, 499}, // MS_source_attribute
+    {286, 27, 31, 118, 1, 499}, // MS_Thermo_Fisher_Scientific_instrument_model
+    {287, 27, 31, 118, 1, 500}, // MS_orbitrap
+    {288, 27, 31, 118, 1, 501}, // MS_nanospray_inlet
+    {289, 27, 31, 118, 1, 503}, // MS_source_potential
+    {290, 27, 32, 118, 1, 504}, // MS_ion_optics_attribute
+    {291, 27, 32, 118, 1, 505}, // MS_Hitachi_instrument_model
+    {292, 27, 32, 118, 1, 506}, // MS_Varian_instrument_model
+    {293, 27, 32, 118, 1, 507}, // MS_Agilent_instrument_model
+    {294, 27, 32, 118, 1, 508}, // MS_Dionex_instrument_model
+    {295, 27, 32, 118, 1, 509}, // MS_Thermo_Electron_instrument_model
+    {296, 27, 32, 118, 1, 511}, // MS_Finnigan_MAT_instrument_model
+    {297, 27, 32, 118, 1, 513}, // MS_Thermo_Scientific_instrument_model
+    {298, 27, 32, 118, 1, 515}, // MS_Applied_Biosystems_instrument_model
+    {299, 27, 32, 119, 1, 516}, // MS_instrument_attribute
+    {300, 28, 32, 119, 1, 517}, // MS_zoom_scan
+    {301, 28, 32, 120, 1, 519}, // MS_full_scan_OBSOLETE
+    {301, 28, 32, 120, 1, 519}, // MS_spectrum_attribute
+    {302, 29, 32, 120, 1, 520}, // MS_scan_window_upper_limit
+    {303, 29, 33, 120, 1, 522}, // MS_scan_window_lower_limit
+    {304, 29, 34, 120, 1, 524}, // MS_dwell_time
+    {305, 29, 36, 120, 1, 526}, // MS_scan_attribute
+    {306, 30, 36, 120, 1, 527}, // MS_base_peak_m_z
+    {307, 30, 37, 120, 1, 529}, // MS_base_peak_intensity
+    {308, 30, 42, 120, 1, 531}, // MS_ion_role_OBSOLETE
+    {308, 30, 42, 120, 1, 531}, // MS_ion_attribute_OBSOLETE
+    {308, 30, 42, 120, 1, 531}, // MS_ion_chemical_type_OBSOLETE
+    {308, 30, 42, 120, 1, 531}, // MS_activation_energy
+    {309, 30, 43, 120, 1, 532}, // MS_precursor_activation_attribute
+    {309, 31, 43, 120, 1, 532}, // MS_ms_level
+    {310, 31, 43, 120, 1, 534}, // MS_filter_string
+    {311, 31, 43, 120, 1, 536}, // MS_binary_data_array
+    {311, 33, 43, 120, 1, 536}, // MS_m_z_array
+    {312, 33, 44, 120, 1, 537}, // MS_intensity_array
+    {313, 33, 49, 120, 1, 538}, // MS_charge_array
+    {314, 33, 49, 120, 1, 539}, // MS_signal_to_noise_array
+    {315, 33, 49, 120, 1, 540}, // MS_binary_data_type
+    {315, 35, 49, 120, 1, 540}, // MS_32_bit_integer
+    {316, 35, 49, 120, 1, 541}, // MS_16_bit_float_OBSOLETE
+    {317, 35, 49, 120, 1, 542}, // MS_32_bit_float
+    {318, 35, 49, 120, 1, 543}, // MS_64_bit_integer
+    {319, 35, 49, 120, 1, 544}, // MS_64_bit_float
+    {320, 35, 49, 120, 1, 545}, // MS_data_file_content
+    {320, 36, 49, 120, 1, 545}, // MS_spectrum_representation
+    {320, 37, 49, 120, 1, 545}, // MS_Waters_raw_format
+    {321, 37, 49, 120, 1, 547}, // MS_highest_observed_m_z
+    {323, 37, 50, 120, 1, 550}, // MS_lowest_observed_m_z
+    {325, 37, 51, 120, 1, 553}, // MS_instrument_serial_number
+    {326, 37, 51, 120, 1, 555}, // MS_file_format_conversion
+    {327, 37, 51, 120, 1, 556}, // MS_software
+    {327, 38, 51, 120, 1, 556}, // MS_Xcalibur
+    {331, 38, 51, 120, 1, 561}, // MS_Bioworks
+    {334, 38, 51, 120, 1, 565}, // MS_MassLynx
+    {338, 38, 51, 120, 1, 570}, // MS_FlexAnalysis
+    {341, 38, 51, 120, 1, 574}, // MS_Data_Explorer
+    {345, 38, 51, 120, 1, 579}, // MS_4700_Explorer
+    {349, 38, 51, 120, 1, 584}, // MS_massWolf
+    {350, 38, 51, 121, 1, 586}, // MS_Voyager_Biospectrometry_Workstation_System
+    {354, 38, 51, 121, 1, 591}, // MS_FlexControl
+    {356, 38, 51, 121, 1, 594}, // MS_ReAdW
+    {357, 38, 51, 121, 1, 596}, // MS_MzStar
+    {358, 38, 51, 121, 1, 598}, // MS_data_processing_action
+    {359, 38, 51, 121, 1, 599}, // MS_Conversion_to_mzML
+    {360, 38, 51, 121, 1, 601}, // MS_Conversion_to_mzXML
+    {361, 38, 51, 121, 1, 603}, // MS_Conversion_to_mzData
+    {362, 38, 51, 121, 1, 605}, // MS_object_attribute
+    {362, 39, 51, 121, 1, 605}, // MS_sample_attribute
+    {363, 40, 51, 121, 1, 606}, // MS_selection_window_attribute
+    {364, 41, 51, 121, 1, 607}, // MS_time_unit_OBSOLETE
+    {364, 41, 51, 121, 1, 607}, // MS_Analyst
+    {368, 41, 51, 121, 1, 612}, // MS_maldi_spot_identifier_OBSOLETE
+    {368, 41, 51, 121, 1, 612}, // MS_Trapper
+    {369, 41, 51, 121, 1, 614}, // MS_LCQ_Deca
+    {370, 41, 51, 121, 1, 617}, // MS_LTQ_Orbitrap_Discovery
+    {371, 41, 51, 121, 1, 620}, // MS_LTQ_Orbitrap_XL
+    {372, 41, 51, 121, 1, 623}, // MS_LTQ_FT_Ultra
+    {373, 41, 51, 121, 1, 626}, // MS_GC_Quantum
+    {374, 41, 51, 121, 1, 629}, // MS_spectrum_type
+    {374, 42, 51, 121, 1, 629}, // MS_mass_spectrometer_file_format
+    {375, 42, 51, 121, 1, 630}, // MS_data_file_checksum_type
+    {375, 43, 51, 121, 1, 630}, // MS_ABI_WIFF_format
+    {376, 43, 51, 121, 1, 632}, // MS_Thermo_RAW_format
+    {377, 43, 51, 121, 1, 634}, // MS_PSI_mzData_format
+    {378, 43, 51, 121, 1, 636}, // MS_Micromass_PKL_format
+    {379, 43, 51, 121, 1, 638}, // MS_ISB_mzXML_format
+    {380, 43, 51, 121, 1, 640}, // MS_Bruker_Agilent_YEP_format
+    {381, 43, 51, 121, 1, 642}, // MS_MD5
+    {382, 43, 51, 121, 1, 643}, // MS_SHA_1
+    {383, 43, 51, 121, 1, 644}, // MS_spectra_combination
+    {383, 44, 51, 121, 1, 644}, // MS_sum_of_spectra
+    {384, 44, 51, 121, 1, 645}, // MS_binary_data_compression_type
+    {384, 46, 51, 121, 1, 645}, // MS_median_of_spectra
+    {385, 46, 51, 121, 1, 646}, // MS_zlib_compression
+    {386, 46, 51, 121, 1, 647}, // MS_mean_of_spectra
+    {387, 46, 51, 121, 1, 648}, // MS_no_compression
+    {388, 46, 51, 121, 1, 649}, // MS_raw_data_file
+    {388, 47, 51, 122, 1, 649}, // MS_LCQ_Fleet
+    {389, 47, 51, 122, 1, 652}, // MS_MS1_spectrum
+    {391, 47, 51, 126, 1, 655}, // MS_MSn_spectrum
+    {393, 47, 51, 129, 1, 658}, // MS_CRM_spectrum
+    {395, 47, 51, 129, 1, 661}, // MS_SIM_spectrum
+    {397, 47, 51, 132, 1, 664}, // MS_SRM_spectrum
+    {399, 47, 51, 135, 1, 667}, // MS_mzML_format
+    {400, 47, 51, 135, 1, 669}, // MS_contact_attribute
+    {401, 48, 51, 135, 1, 670}, // MS_contact_name
+    {402, 48, 51, 135, 1, 672}, // MS_contact_address
+    {403, 48, 51, 135, 1, 674}, // MS_contact_URL
+    {404, 48, 51, 135, 1, 676}, // MS_contact_email
+    {405, 48, 51, 135, 1, 678}, // MS_contact_affiliation
+    {406, 48, 51, 135, 1, 680}, // MS_MzWiff
+    {407, 48, 51, 135, 1, 682}, // MS_smoothing
+    {408, 48, 51, 135, 1, 684}, // MS_baseline_reduction
+    {409, 48, 51, 135, 1, 686}, // MS_low_intensity_data_point_removal
+    {410, 48, 51, 136, 1, 689}, // MS_time_array
+    {411, 48, 53, 136, 1, 690}, // MS_measurement_method
+    {411, 49, 53, 136, 1, 690}, // MS_ion_optics_type
+    {412, 49, 53, 136, 1, 691}, // MS_electron_transfer_dissociation
+    {413, 49, 53, 137, 1, 692}, // MS_pulsed_q_dissociation
+    {414, 49, 53, 138, 1, 693}, // MS_Proteios
+    {416, 49, 53, 138, 1, 696}, // MS_ProteinLynx_Global_Server
+    {419, 49, 53, 138, 1, 700}, // MS_Shimadzu_MALDI_TOF_instrument_model
+    {420, 49, 53, 138, 1, 702}, // MS_Shimadzu_Scientific_Instruments_instrument_model
+    {421, 49, 53, 138, 1, 704}, // MS_LCMS_IT_TOF
+    {422, 49, 53, 138, 1, 707}, // MS_LCMS_2010EV
+    {423, 49, 53, 138, 1, 710}, // MS_LCMS_2010A
+    {424, 49, 53, 138, 1, 713}, // MS_AXIMA_CFR_MALDI_TOF
+    {425, 49, 53, 138, 1, 716}, // MS_AXIMA_QIT
+    {426, 49, 53, 138, 1, 719}, // MS_AXIMA_CFR_plus
+    {427, 49, 53, 138, 1, 722}, // MS_AXIMA_Performance_MALDI_TOF_TOF
+    {428, 49, 53, 138, 1, 725}, // MS_AXIMA_Confidence_MALDI_TOF
+    {429, 49, 53, 138, 1, 728}, // MS_AXIMA_Assurance_Linear_MALDI_TOF
+    {430, 49, 53, 138, 1, 731}, // MS_DTA_format
+    {431, 49, 53, 138, 1, 733}, // MS_ProteinLynx_Global_Server_mass_spectrum_XML_format
+    {432, 49, 53, 138, 1, 735}, // MS_ProteoWizard_software
+    {434, 49, 53, 139, 1, 738}, // MS_preset_scan_configuration
+    {435, 49, 53, 139, 1, 740}, // MS_wavelength_array
+    {436, 49, 54, 139, 1, 741}, // MS_highest_observed_wavelength
+    {438, 49, 55, 139, 1, 744}, // MS_lowest_observed_wavelength
+    {440, 49, 56, 139, 1, 747}, // MS_PDA_spectrum_OBSOLETE
+    {442, 49, 56, 139, 1, 749}, // MS_photodiode_array_detector
+    {443, 49, 56, 140, 1, 751}, // MS_Surveyor_PDA
+    {444, 49, 56, 140, 1, 754}, // MS_Accela_PDA
+    {445, 49, 56, 140, 1, 757}, // MS_inductive_detector
+    {446, 49, 56, 141, 1, 758}, // MS_chromatogram
+    {446, 50, 56, 141, 1, 758}, // MS_chromatogram_type
+    {446, 51, 56, 141, 1, 758}, // MS_selected_ion_current_chromatogram
+    {448, 51, 56, 142, 1, 761}, // MS_basepeak_chromatogram
+    {450, 51, 56, 142, 1, 764}, // MS_low_intensity_threshold
+    {451, 51, 61, 142, 1, 765}, // MS_data_processing_parameter
+    {451, 52, 61, 142, 1, 765}, // MS_high_intensity_threshold
+    {452, 52, 66, 142, 1, 766}, // MS_Q_Tof_Premier
+    {453, 52, 66, 142, 1, 768}, // MS_possible_charge_state
+    {454, 52, 66, 142, 1, 770}, // MS_DSQ
+    {455, 52, 66, 142, 1, 773}, // MS_ITQ_700
+    {456, 52, 66, 142, 1, 776}, // MS_ITQ_900
+    {457, 52, 66, 142, 1, 779}, // MS_ITQ_1100
+    {458, 52, 66, 142, 1, 782}, // MS_LTQ_XL_ETD
+    {459, 52, 66, 142, 1, 785}, // MS_LTQ_Orbitrap_XL_ETD
+    {460, 52, 66, 142, 1, 788}, // MS_DFS
+    {461, 52, 66, 142, 1, 791}, // MS_DSQ_II
+    {462, 52, 66, 142, 1, 794}, // MS_MALDI_LTQ_XL
+    {463, 52, 66, 142, 1, 797}, // MS_MALDI_LTQ_Orbitrap
+    {464, 52, 66, 142, 1, 800}, // MS_TSQ_Quantum_Access
+    {465, 52, 66, 142, 1, 803}, // MS_Element_XR
+    {466, 52, 66, 142, 1, 806}, // MS_Element_2
+    {467, 52, 66, 142, 1, 809}, // MS_Element_GD
+    {468, 52, 66, 142, 1, 812}, // MS_GC_IsoLink
+    {469, 52, 66, 142, 1, 815}, // MS_Exactive
+    {470, 52, 66, 142, 1, 818}, // MS_Proteome_Discoverer
+    {473, 52, 66, 142, 1, 822}, // MS_3200_QTRAP
+    {474, 52, 66, 142, 1, 824}, // MS_4800_Plus_MALDI_TOF_TOF
+    {475, 52, 66, 142, 1, 826}, // MS_API_3200
+    {476, 52, 66, 142, 1, 828}, // MS_API_5000
+    {477, 52, 66, 142, 1, 830}, // MS_QSTAR_Elite
+    {478, 52, 66, 142, 1, 832}, // MS_QSTAR_Pulsar
+    {479, 52, 66, 142, 1, 834}, // MS_QSTAR_XL
+    {480, 52, 66, 142, 1, 836}, // MS_4800_Proteomics_Analyzer
+    {481, 52, 66, 142, 1, 838}, // MS_4000_Series_Explorer_Software
+    {485, 52, 66, 142, 1, 843}, // MS_GPS_Explorer
+    {489, 52, 66, 142, 1, 848}, // MS_LightSight_Software
+    {492, 52, 66, 142, 1, 852}, // MS_ProteinPilot_Software
+    {495, 52, 66, 142, 1, 856}, // MS_TissueView_Software
+    {498, 52, 66, 142, 1, 860}, // MS_MarkerView_Software
+    {501, 52, 66, 142, 1, 864}, // MS_MRMPilot_Software
+    {504, 52, 66, 142, 1, 868}, // MS_BioAnalyst
+    {507, 52, 66, 142, 1, 872}, // MS_Pro_ID
+    {510, 52, 66, 142, 1, 876}, // MS_Pro_ICAT
+    {513, 52, 66, 142, 1, 880}, // MS_Pro_Quant
+    {516, 52, 66, 142, 1, 884}, // MS_Pro_BLAST
+    {519, 52, 66, 142, 1, 888}, // MS_Cliquid
+    {520, 52, 66, 142, 1, 890}, // MS_MIDAS_Workflow_Designer
+    {521, 52, 66, 142, 1, 892}, // MS_MultiQuant
+    {524, 52, 66, 142, 1, 896}, // MS_6220_Time_of_Flight_LC_MS
+    {525, 52, 66, 142, 1, 898}, // MS_6510_Quadrupole_Time_of_Flight_LC_MS
+    {526, 52, 66, 142, 1, 900}, // MS_6520_Quadrupole_Time_of_Flight_LC_MS
+    {527, 52, 66, 142, 1, 902}, // MS_MassHunter_Data_Acquisition
+    {529, 52, 66, 142, 1, 905}, // MS_MassHunter_Easy_Access
+    {531, 52, 66, 142, 1, 908}, // MS_MassHunter_Qualitative_Analysis
+    {534, 52, 66, 142, 1, 912}, // MS_MassHunter_Quantitative_Analysis
+    {537, 52, 66, 142, 1, 916}, // MS_MassHunter_Metabolite_ID
+    {540, 52, 66, 142, 1, 920}, // MS_MassHunter_BioConfirm
+    {543, 52, 66, 142, 1, 924}, // MS_Genespring_MS
+    {546, 52, 66, 142, 1, 928}, // MS_MassHunter_Mass_Profiler
+    {549, 52, 66, 142, 1, 932}, // MS_METLIN
+    {552, 52, 66, 142, 1, 936}, // MS_Spectrum_Mill_for_MassHunter_Workstation
+    {555, 52, 66, 142, 1, 940}, // MS_6300_Series_Ion_Trap_Data_Analysis_Software
+    {559, 52, 66, 142, 1, 945}, // MS_Agilent_software
+    {560, 52, 66, 142, 1, 946}, // MS_SCIEX_software
+    {561, 52, 66, 142, 1, 947}, // MS_Applied_Biosystems_software
+    {562, 52, 66, 142, 1, 948}, // MS_Bruker_software
+    {563, 52, 66, 142, 1, 949}, // MS_Thermo_Finnigan_software
+    {564, 52, 66, 142, 1, 950}, // MS_Waters_software
+    {565, 52, 66, 142, 1, 951}, // MS_apex_ultra
+    {566, 52, 66, 142, 1, 954}, // MS_autoflex_III_smartbeam
+    {567, 52, 66, 142, 1, 957}, // MS_Bruker_Daltonics_HCT_Series
+    {568, 52, 66, 142, 1, 959}, // MS_HCTultra
+    {569, 52, 66, 142, 1, 962}, // MS_HCTultra_PTM
+    {570, 52, 66, 142, 1, 965}, // MS_HCTultra_ETD_II
+    {571, 52, 66, 142, 1, 968}, // MS_microflex_LT
+    {572, 52, 66, 142, 1, 971}, // MS_micrOTOF
+    {573, 52, 66, 142, 1, 974}, // MS_micrOTOF_Q
+    {574, 52, 66, 142, 1, 977}, // MS_micrOTOF_Q_II
+    {575, 52, 66, 142, 1, 980}, // MS_ultraflex_III_TOF_TOF
+    {576, 52, 66, 142, 1, 983}, // MS_apexControl
+    {578, 52, 66, 142, 1, 986}, // MS_BioTools
+    {581, 52, 66, 142, 1, 990}, // MS_CLINPROT
+    {584, 52, 66, 142, 1, 994}, // MS_CLINPROT_micro
+    {587, 52, 66, 142, 1, 998}, // MS_CLINPROT_robot
+    {588, 52, 66, 142, 1, 1000}, // MS_ClinProTools
+    {589, 52, 66, 142, 1, 1002}, // MS_Compass
+    {592, 52, 66, 142, 1, 1006}, // MS_Compass_for_HCT_esquire
+    {595, 52, 66, 142, 1, 1010}, // MS_Compass_for_micrOTOF
+    {598, 52, 66, 142, 1, 1014}, // MS_Compass_OpenAccess
+    {601, 52, 66, 142, 1, 1018}, // MS_Compass_Security_Pack
+    {602, 52, 66, 142, 1, 1020}, // MS_CompassXport
+    {604, 52, 66, 142, 1, 1023}, // MS_CompassXtract
+    {606, 52, 66, 142, 1, 1026}, // MS_DataAnalysis
+    {609, 52, 66, 142, 1, 1030}, // MS_dpControl
+    {611, 52, 66, 142, 1, 1033}, // MS_esquireControl
+    {613, 52, 66, 142, 1, 1036}, // MS_flexImaging
+    {616, 52, 66, 142, 1, 1040}, // MS_GENOLINK
+    {617, 52, 66, 142, 1, 1042}, // MS_GenoTools
+    {618, 52, 66, 142, 1, 1044}, // MS_HCTcontrol
+    {620, 52, 66, 142, 1, 1047}, // MS_micrOTOFcontrol
+    {622, 52, 66, 142, 1, 1050}, // MS_PolyTools
+    {623, 52, 66, 142, 1, 1052}, // MS_ProfileAnalysis
+    {626, 52, 66, 142, 1, 1056}, // MS_PROTEINEER
+    {627, 52, 66, 142, 1, 1058}, // MS_PROTEINEER_dp
+    {628, 52, 66, 142, 1, 1060}, // MS_PROTEINEER_fc
+    {629, 52, 66, 142, 1, 1062}, // MS_PROTEINEER_spII
+    {630, 52, 66, 142, 1, 1064}, // MS_PROTEINEER_LC
+    {631, 52, 66, 142, 1, 1066}, // MS_ProteinScape
+    {633, 52, 66, 142, 1, 1069}, // MS_PureDisk
+    {634, 52, 66, 142, 1, 1071}, // MS_QuantAnalysis
+    {637, 52, 66, 142, 1, 1075}, // MS_spControl
+    {639, 52, 66, 142, 1, 1078}, // MS_TargetAnalysis
+    {640, 52, 66, 142, 1, 1080}, // MS_WARP_LC
+    {642, 52, 66, 142, 1, 1084}, // MS_parameter_file
+    {643, 52, 66, 142, 1, 1086}, // MS_Conversion_to_dta
+    {644, 52, 66, 142, 1, 1088}, // MS_Bioworks_SRF_format
+    {646, 52, 66, 142, 1, 1091}, // MS_TSQ_Quantum_Ultra_AM
+    {647, 52, 66, 142, 1, 1094}, // MS_selected_ion_m_z
+    {648, 52, 67, 142, 1, 1096}, // MS_retention_time_alignment
+    {649, 52, 67, 142, 1, 1098}, // MS_high_intensity_data_point_removal
+    {650, 52, 67, 142, 1, 1101}, // MS_completion_time
+    {651, 52, 67, 142, 1, 1102}, // MS_SSQ_7000
+    {652, 52, 67, 142, 1, 1105}, // MS_TSQ_7000
+    {653, 52, 67, 142, 1, 1108}, // MS_TSQ
+    {654, 52, 67, 142, 1, 1111}, // MS_TSQ_Quantum_Ultra
+    {655, 52, 67, 142, 1, 1114}, // MS_TOPP_software
+    {657, 52, 67, 142, 1, 1117}, // MS_BaselineFilter
+    {658, 52, 67, 142, 1, 1121}, // MS_DBExporter
+    {659, 52, 67, 142, 1, 1125}, // MS_DBImporter
+    {660, 52, 67, 142, 1, 1129}, // MS_FileConverter
+    {661, 52, 67, 142, 1, 1133}, // MS_FileFilter
+    {662, 52, 67, 142, 1, 1137}, // MS_FileMerger
+    {663, 52, 67, 142, 1, 1141}, // MS_InternalCalibration
+    {664, 52, 67, 142, 1, 1145}, // MS_MapAligner_OBSOLETE
+    {665, 52, 67, 142, 1, 1149}, // MS_MapNormalizer
+    {666, 52, 67, 142, 1, 1153}, // MS_NoiseFilter_OBSOLETE
+    {667, 52, 67, 142, 1, 1157}, // MS_PeakPicker_OBSOLETE
+    {668, 52, 67, 142, 1, 1161}, // MS_Resampler
+    {669, 52, 67, 142, 1, 1165}, // MS_SpectraFilter_OBSOLETE
+    {670, 52, 67, 142, 1, 1169}, // MS_TOFCalibration
+    {671, 52, 67, 142, 1, 1173}, // MS_native_spectrum_identifier_format
+    {671, 53, 67, 143, 1, 1173}, // MS_Thermo_nativeID_format
+    {672, 53, 67, 143, 1, 1174}, // MS_Waters_nativeID_format
+    {673, 53, 67, 143, 1, 1175}, // MS_WIFF_nativeID_format
+    {674, 53, 67, 143, 1, 1176}, // MS_Bruker_Agilent_YEP_nativeID_format
+    {675, 53, 67, 143, 1, 1177}, // MS_Bruker_BAF_nativeID_format
+    {676, 53, 67, 143, 1, 1178}, // MS_Bruker_FID_nativeID_format
+    {677, 53, 67, 143, 1, 1179}, // MS_multiple_peak_list_nativeID_format
+    {678, 53, 67, 143, 1, 1180}, // MS_single_peak_list_nativeID_format
+    {679, 53, 67, 143, 1, 1181}, // MS_scan_number_only_nativeID_format
+    {680, 53, 67, 143, 1, 1182}, // MS_spectrum_identifier_nativeID_format
+    {681, 53, 67, 143, 1, 1183}, // MS_charge_state_calculation
+    {682, 53, 67, 143, 1, 1185}, // MS_below_precursor_intensity_dominance_charge_state_calculation
+    {683, 53, 67, 143, 1, 1188}, // MS_precursor_recalculation
+    {684, 53, 67, 143, 1, 1190}, // MS_msPrefix_precursor_recalculation
+    {685, 53, 67, 143, 1, 1193}, // MS_Savitzky_Golay_smoothing
+    {686, 53, 67, 143, 1, 1196}, // MS_LOWESS_smoothing
+    {687, 53, 67, 143, 1, 1199}, // MS_Gaussian_smoothing
+    {688, 53, 67, 145, 1, 1202}, // MS_moving_average_smoothing
+    {689, 53, 67, 148, 1, 1205}, // MS_non_standard_data_array
+    {690, 53, 67, 148, 1, 1206}, // MS_inclusive_low_intensity_threshold
+    {691, 53, 72, 148, 1, 1207}, // MS_inclusive_high_intensity_threshold
+    {692, 53, 77, 148, 1, 1208}, // MS_enhanced_multiply_charged_spectrum
+    {694, 53, 77, 148, 1, 1212}, // MS_time_delayed_fragmentation_spectrum
+    {696, 53, 77, 148, 1, 1216}, // MS_enhanced_resolution_scan_OBSOLETE
+    {696, 53, 77, 148, 1, 1216}, // MS_isolation_window_attribute
+    {697, 54, 77, 148, 1, 1217}, // MS_isolation_window_upper_limit_OBSOLETE
+    {698, 54, 78, 148, 1, 1219}, // MS_isolation_window_lower_limit_OBSOLETE
+    {699, 54, 79, 148, 1, 1221}, // MS_no_combination
+    {700, 54, 79, 148, 1, 1222}, // MS_spectrum_title
+    {702, 54, 79, 148, 1, 1225}, // MS_peak_list_scans
+    {704, 54, 79, 148, 1, 1228}, // MS_peak_list_raw_scans
+    {706, 54, 79, 148, 1, 1231}, // MS_custom_unreleased_software_tool
+    {707, 54, 79, 148, 1, 1232}, // MS_mass_resolving_power
+    {708, 54, 79, 148, 1, 1234}, // MS_area_peak_picking
+    {709, 54, 79, 149, 1, 1237}, // MS_height_peak_picking
+    {710, 54, 79, 150, 1, 1240}, // MS_analyzer_scan_offset
+    {711, 54, 80, 150, 1, 1242}, // MS_electromagnetic_radiation_spectrum
+    {713, 54, 80, 151, 1, 1244}, // MS_emission_spectrum
+    {715, 54, 80, 151, 1, 1246}, // MS_absorption_spectrum
+    {717, 54, 80, 151, 1, 1248}, // MS_Th_s
+    {717, 54, 80, 151, 1, 1248}, // MS_chromatogram_attribute
+    {718, 55, 80, 151, 1, 1249}, // MS_chromatogram_title
+    {719, 55, 80, 151, 1, 1251}, // MS_mass_chromatogram
+    {721, 55, 80, 151, 1, 1253}, // MS_electromagnetic_radiation_chromatogram
+    {723, 55, 80, 152, 1, 1255}, // MS_absorption_chromatogram
+    {725, 55, 80, 152, 1, 1258}, // MS_emission_chromatogram
+    {727, 55, 80, 152, 1, 1261}, // MS_counts_per_second
+    {728, 55, 80, 152, 1, 1262}, // MS_Bruker_BAF_format
+    {729, 55, 80, 152, 1, 1264}, // MS_Bruker_U2_format
+    {730, 55, 80, 152, 1, 1266}, // MS_HyStar
+    {731, 55, 80, 152, 1, 1268}, // MS_Acquity_UPLC_PDA
+    {733, 55, 80, 152, 1, 1273}, // MS_Acquity_UPLC_FLR
+    {735, 55, 80, 152, 1, 1277}, // MS_flow_rate_array
+    {736, 55, 80, 152, 1, 1278}, // MS_pressure_array
+    {737, 55, 81, 152, 1, 1279}, // MS_temperature_array
+    {738, 55, 82, 152, 1, 1280}, // MS_Bruker_U2_nativeID_format
+    {739, 55, 82, 152, 1, 1281}, // MS_no_nativeID_format
+    {740, 55, 82, 152, 1, 1282}, // MS_Bruker_FID_format
+    {741, 55, 82, 152, 1, 1284}, // MS_elution_time
+    {742, 55, 84, 152, 1, 1286}, // MS_isolation_window_target_m_z
+    {743, 55, 85, 152, 1, 1288}, // MS_isolation_window_lower_offset
+    {744, 55, 86, 152, 1, 1290}, // MS_isolation_window_upper_offset
+    {745, 55, 87, 152, 1, 1292}, // MS_sample_preparation
+    {746, 56, 87, 152, 1, 1293}, // MS_MALDI_matrix_application
+    {746, 57, 87, 152, 1, 1293}, // MS_matrix_application_type
+    {746, 58, 87, 152, 1, 1293}, // MS_matrix_solution
+    {747, 58, 87, 152, 1, 1294}, // MS_matrix_solution_concentration
+    {748, 58, 88, 152, 1, 1295}, // MS_dried_droplet_MALDI_matrix_preparation
+    {749, 58, 88, 152, 1, 1296}, // MS_printed_MALDI_matrix_preparation
+    {750, 58, 88, 152, 1, 1297}, // MS_sprayed_MALDI_matrix_preparation
+    {751, 58, 88, 152, 1, 1298}, // MS_precoated_MALDI_sample_plate
+    {753, 58, 88, 152, 1, 1300}, // MS_laser
+    {753, 59, 88, 152, 1, 1300}, // MS_laser_attribute
+    {753, 60, 88, 152, 1, 1300}, // MS_laser_type
+    {753, 61, 88, 152, 1, 1300}, // MS_wavelength_OBSOLETE
+    {754, 61, 89, 152, 1, 1301}, // MS_focus_diameter_x
+    {755, 61, 90, 152, 1, 1302}, // MS_focus_diameter_y
+    {756, 61, 91, 152, 1, 1303}, // MS_pulse_energy
+    {757, 61, 92, 152, 1, 1304}, // MS_pulse_duration
+    {758, 61, 93, 152, 1, 1305}, // MS_attenuation
+    {759, 61, 94, 152, 1, 1306}, // MS_impact_angle
+    {760, 61, 95, 152, 1, 1307}, // MS_gas_laser
+    {761, 61, 95, 152, 1, 1308}, // MS_solid_state_laser
+    {762, 61, 95, 152, 1, 1309}, // MS_dye_laser
+    {763, 61, 95, 152, 1, 1310}, // MS_free_electron_laser
+    {764, 61, 95, 152, 1, 1311}, // MS_LTQ_XL
+    {765, 61, 95, 152, 1, 1314}, // MS_LTQ_Velos
+    {766, 61, 95, 152, 1, 1317}, // MS_LTQ_Velos_ETD
+    {767, 61, 95, 152, 1, 1320}, // MS_run_attribute
+    {768, 61, 95, 152, 1, 1321}, // MS_fraction_identifier
+    {769, 61, 95, 152, 1, 1323}, // MS_molecule
+    {769, 62, 95, 152, 1, 1323}, // MS_peptide
+    {770, 62, 95, 152, 1, 1324}, // MS_chemical_compound_attribute
+    {770, 63, 95, 152, 1, 1324}, // MS_isoelectric_point
+    {771, 63, 95, 153, 1, 1325}, // MS_predicted_isoelectric_point
+    {772, 63, 95, 154, 1, 1327}, // MS_chemical_compound_formula
+    {772, 64, 95, 154, 1, 1327}, // MS_empirical_formula
+    {773, 64, 95, 154, 1, 1328}, // MS_molecular_formula
+    {774, 64, 95, 154, 1, 1329}, // MS_structural_formula
+    {775, 64, 95, 154, 1, 1330}, // MS_SMILES_string
+    {776, 64, 95, 154, 1, 1331}, // MS_collision_gas_pressure
+    {777, 64, 96, 154, 1, 1332}, // MS_4000_QTRAP_OBSOLETE
+    {778, 64, 96, 154, 1, 1334}, // MS_SRM_software
+    {779, 64, 96, 154, 1, 1335}, // MS_MaRiMba
+    {780, 64, 96, 154, 1, 1337}, // MS_peptide_attribute_calculation_software
+    {781, 64, 96, 154, 1, 1338}, // MS_SSRCalc
+    {782, 64, 96, 154, 1, 1340}, // MS_declustering_potential
+    {783, 64, 97, 154, 1, 1341}, // MS_cone_voltage
+    {784, 64, 98, 154, 1, 1342}, // MS_tube_lens_voltage
+    {785, 64, 99, 154, 1, 1343}, // MS_external_reference_identifier
+    {785, 65, 99, 154, 1, 1343}, // MS_PubMed_identifier
+    {786, 65, 99, 154, 1, 1344}, // MS_interchannel_delay
+    {787, 65, 100, 154, 1, 1346}, // MS_chemical_compound
+    {787, 66, 100, 154, 1, 1346}, // MS_protein
+    {788, 66, 100, 154, 1, 1347}, // MS_protein_short_name
+    {789, 66, 100, 154, 1, 1350}, // MS_protein_attribute
+    {790, 67, 100, 154, 1, 1352}, // MS_protein_accession
+    {791, 67, 100, 154, 1, 1355}, // MS_protein_name
+    {792, 67, 100, 154, 1, 1358}, // MS_peptide_attribute
+    {792, 68, 100, 154, 1, 1358}, // MS_unmodified_peptide_sequence
+    {793, 68, 100, 154, 1, 1359}, // MS_modified_peptide_sequence
+    {794, 68, 100, 154, 1, 1360}, // MS_peptide_labeling_state
+    {795, 68, 100, 154, 1, 1361}, // MS_heavy_labeled_peptide
+    {796, 68, 100, 154, 1, 1363}, // MS_unlabeled_peptide
+    {797, 68, 100, 155, 1, 1365}, // MS_peptide_group_label
+    {798, 68, 100, 155, 1, 1366}, // MS_retention_time
+    {799, 68, 102, 155, 1, 1367}, // MS_local_retention_time
+    {800, 68, 104, 155, 1, 1369}, // MS_normalized_retention_time
+    {801, 68, 106, 155, 1, 1371}, // MS_predicted_retention_time
+    {802, 68, 108, 155, 1, 1373}, // MS_standard
+    {802, 69, 108, 155, 1, 1373}, // MS_de_facto_standard
+    {803, 69, 108, 155, 1, 1374}, // MS_minimum_information_standard
+    {804, 69, 108, 155, 1, 1375}, // MS_retention_time_normalization_standard
+    {805, 69, 108, 155, 1, 1376}, // MS_H_PINS_retention_time_normalization_standard
+    {806, 69, 108, 155, 1, 1378}, // MS_product_ion_series_ordinal
+    {807, 69, 108, 155, 1, 1383}, // MS_product_ion_m_z_delta
+    {808, 69, 109, 155, 1, 1388}, // MS_percent_of_base_peak_times_100
+    {809, 69, 109, 155, 1, 1389}, // MS_peak_intensity_rank
+    {810, 70, 109, 155, 1, 1391}, // MS_peak_targeting_suitability_rank
+    {811, 71, 109, 155, 1, 1393}, // MS_transition
+    {811, 72, 109, 156, 1, 1393}, // MS_transition_validation_method
+    {811, 73, 109, 156, 1, 1393}, // MS_transition_optimized_on_specified_instrument
+    {812, 73, 109, 156, 1, 1394}, // MS_transition_validated_with_an_MS_MS_spectrum_on_specified_instrument
+    {813, 73, 109, 156, 1, 1395}, // MS_transition_purported_from_an_MS_MS_spectrum_on_a_different__specified_instrument
+    {814, 73, 109, 156, 1, 1396}, // MS_transition_predicted_by_informatic_analysis
+    {815, 73, 109, 156, 1, 1397}, // MS_tab_delimited_text_format
+    {817, 73, 109, 156, 1, 1399}, // MS_retention_time_window_attribute
+    {817, 74, 109, 156, 1, 1399}, // MS_retention_time_window_lower_offset
+    {818, 74, 111, 156, 1, 1400}, // MS_retention_time_window_upper_offset
+    {819, 74, 113, 156, 1, 1401}, // MS_target_list
+    {819, 75, 113, 156, 1, 1401}, // MS_target_inclusion_exclusion_priority
+    {819, 76, 113, 156, 1, 1401}, // MS_includes_supersede_excludes
+    {820, 76, 113, 156, 1, 1402}, // MS_excludes_supersede_includes
+    {821, 76, 113, 156, 1, 1403}, // MS_Skyline
+    {823, 76, 113, 156, 1, 1407}, // MS_TIQAM
+    {824, 76, 113, 156, 1, 1409}, // MS_MaRiMba_OBSOLETE
+    {824, 76, 113, 156, 1, 1409}, // MS_ATAQS
+    {825, 76, 113, 156, 1, 1411}, // MS_product_interpretation_rank
+    {826, 76, 113, 156, 1, 1416}, // MS_ion_injection_time
+    {827, 76, 114, 156, 1, 1418}, // MS_calibration_spectrum
+    {828, 76, 114, 156, 1, 1419}, // MS_Shimadzu_Biotech_nativeID_format
+    {829, 76, 114, 156, 1, 1420}, // MS_Shimadzu_Biotech_database_entity
+    {830, 76, 114, 156, 1, 1422}, // MS_QTRAP_5500
+    {831, 76, 114, 156, 1, 1424}, // MS_TripleTOF_5600
+    {832, 76, 114, 156, 1, 1426}, // MS_protein_modifications
+    {833, 76, 114, 156, 1, 1429}, // MS_gene_name
+    {834, 76, 114, 156, 1, 1432}, // MS_spectrum_interpretation
+    {834, 77, 114, 156, 1, 1432}, // MS_SEQUEST_CleavesAt
+    {835, 77, 114, 156, 1, 1436}, // MS_SEQUEST_ViewCV
+    {836, 77, 114, 156, 1, 1440}, // MS_SEQUEST_OutputLines
+    {837, 77, 114, 156, 1, 1444}, // MS_SEQUEST_DescriptionLines
+    {838, 77, 114, 156, 1, 1448}, // MS_de_novo_search
+    {839, 77, 114, 156, 1, 1450}, // MS_search_database_details
+    {840, 77, 114, 156, 1, 1451}, // MS_database_source
+    {841, 77, 114, 156, 1, 1453}, // MS_database_name
+    {842, 77, 114, 156, 1, 1455}, // MS_database_local_file_path_OBSOLETE
+    {843, 77, 114, 156, 1, 1457}, // MS_database_original_uri
+    {844, 77, 114, 156, 1, 1459}, // MS_database_version_OBSOLETE
+    {845, 77, 114, 156, 1, 1461}, // MS_database_release_date_OBSOLETE
+    {846, 77, 114, 156, 1, 1463}, // MS_database_type
+    {847, 77, 114, 156, 1, 1465}, // MS_database_filtering
+    {848, 77, 114, 156, 1, 1467}, // MS_DB_filter_taxonomy
+    {849, 77, 114, 156, 1, 1471}, // MS_DB_filter_on_accession_numbers
+    {850, 77, 114, 156, 1, 1475}, // MS_DB_MW_filter
+    {851, 77, 114, 156, 1, 1479}, // MS_DB_PI_filter
+    {852, 77, 114, 156, 1, 1483}, // MS_translation_frame
+    {853, 77, 114, 156, 1, 1485}, // MS_translation_table
+    {854, 77, 114, 156, 1, 1487}, // MS_SEQUEST_NormalizeXCorrValues
+    {855, 77, 114, 156, 1, 1491}, // MS_DB_filter_on_sequence_pattern
+    {856, 77, 114, 156, 1, 1495}, // MS_SEQUEST_SequenceHeaderFilter
+    {857, 77, 114, 156, 1, 1499}, // MS_number_of_sequences_searched
+    {858, 77, 114, 156, 1, 1501}, // MS_number_of_peptide_seqs_compared_to_each_spectrum
+    {860, 77, 114, 156, 1, 1504}, // MS_spectral_library_search
+    {861, 77, 114, 156, 1, 1506}, // MS_SEQUEST_SequencePartialFilter
+    {862, 77, 114, 156, 1, 1510}, // MS_date___time_search_performed_OBSOLETE
+    {863, 77, 114, 156, 1, 1512}, // MS_search_time_taken
+    {864, 77, 114, 156, 1, 1514}, // MS_SEQUEST_ShowFragmentIons
+    {865, 77, 114, 156, 1, 1518}, // MS_SEQUEST_Consensus
+    {866, 77, 114, 156, 1, 1523}, // MS_intermediate_analysis_format
+    {867, 77, 114, 156, 1, 1524}, // MS_SEQUEST_sortCV
+    {868, 77, 114, 156, 1, 1529}, // MS_SEQUEST_LimitTo
+    {869, 77, 114, 156, 1, 1533}, // MS_cleavage_agent_details
+    {870, 77, 114, 156, 1, 1534}, // MS_cleavage_agent_name
+    {871, 77, 114, 156, 1, 1536}, // MS_SEQUEST_sort_by_dCn
+    {872, 77, 114, 156, 1, 1542}, // MS_SEQUEST_sort_by_dM
+    {873, 77, 114, 156, 1, 1548}, // MS_SEQUEST_sort_by_Ions
+    {874, 77, 114, 156, 1, 1554}, // MS_SEQUEST_sort_by_MH_
+    {875, 77, 114, 156, 1, 1560}, // MS_SEQUEST_sort_by_P
+    {876, 77, 114, 156, 1, 1566}, // MS_multiple_enzyme_combination_rules_OBSOLETE
+    {876, 77, 114, 156, 1, 1566}, // MS_SEQUEST_sort_by_PreviousAminoAcid
+    {877, 77, 114, 156, 1, 1572}, // MS_SEQUEST_sort_by_Ref
+    {878, 77, 114, 156, 1, 1578}, // MS_modification_parameters
+    {878, 78, 114, 156, 1, 1578}, // MS_modification_specificity_rule
+    {879, 78, 114, 156, 1, 1579}, // MS_tolerance_on_types_OBSOLETE
+    {880, 78, 114, 156, 1, 1580}, // MS_quality_estimation_by_manual_validation
+    {881, 78, 114, 156, 1, 1582}, // MS_SEQUEST_sort_by_RSp
+    {882, 78, 114, 156, 1, 1588}, // MS_quality_estimation_method_details
+    {883, 78, 114, 156, 1, 1589}, // MS_neutral_loss_OBSOLETE
+    {884, 78, 114, 156, 1, 1590}, // MS_Mascot_MGF_format
+    {885, 78, 114, 156, 1, 1592}, // MS_TODOscoring_model_OBSOLETE
+    {886, 78, 114, 156, 1, 1593}, // MS_ions_series_considered_in_search
+    {887, 78, 114, 156, 1, 1594}, // MS_SEQUEST_sort_by_Sp
+    {888, 78, 114, 156, 1, 1600}, // MS_SEQUEST_sort_by_TIC
+    {889, 78, 114, 156, 1, 1606}, // MS_SEQUEST_sort_by_Scan
+    {890, 78, 114, 156, 1, 1612}, // MS_SEQUEST_sort_by_Sequence
+    {891, 78, 114, 156, 1, 1618}, // MS_SEQUEST_sort_by_Sf
+    {892, 78, 114, 156, 1, 1624}, // MS_database_type_amino_acid
+    {893, 78, 114, 156, 1, 1627}, // MS_database_type_nucleotide
+    {894, 78, 114, 156, 1, 1630}, // MS_search_type
+    {895, 78, 114, 156, 1, 1631}, // MS_pmf_search
+    {896, 78, 114, 156, 1, 1633}, // MS_tag_search
+    {897, 78, 114, 156, 1, 1635}, // MS_ms_ms_search
+    {898, 78, 114, 156, 1, 1637}, // MS_database_nr
+    {899, 78, 114, 156, 1, 1640}, // MS_protein_level_identification_attribute
+    {900, 78, 114, 156, 1, 1644}, // MS_SEQUEST_sort_by_XCorr
+    {901, 78, 114, 156, 1, 1650}, // MS_SEQUEST_ProcessCV
+    {902, 78, 114, 156, 1, 1654}, // MS_protein_description
+    {904, 78, 114, 156, 1, 1662}, // MS_molecule_taxonomy
+    {907, 78, 114, 156, 1, 1672}, // MS_taxonomy_nomenclature_OBSOLETE
+    {908, 78, 114, 156, 1, 1683}, // MS_NoEnzyme_OBSOLETE
+    {909, 78, 114, 156, 1, 1686}, // MS_peptide_sequence_level_identification_statistic
+    {910, 78, 114, 156, 1, 1691}, // MS_sequence_coverage
+    {911, 78, 114, 156, 1, 1696}, // MS_SEQUEST_sort_by_z
+    {912, 78, 114, 156, 1, 1702}, // MS_SEQUEST_ProcessAll
+    {913, 78, 114, 156, 1, 1707}, // MS_SEQUEST_TopPercentMostIntense
+    {914, 78, 114, 156, 1, 1712}, // MS_distinct_peptide_sequences
+    {915, 78, 114, 156, 1, 1717}, // MS_confident_distinct_peptide_sequences
+    {916, 78, 114, 156, 1, 1722}, // MS_confident_peptide_qualification
+    {917, 78, 114, 156, 1, 1727}, // MS_confident_peptide_sequence_number
+    {918, 78, 114, 156, 1, 1732}, // MS_protein_group_or_subset_relationship
+    {919, 78, 114, 156, 1, 1737}, // MS_SEQUEST_Chromatogram
+    {920, 78, 114, 156, 1, 1742}, // MS_SEQUEST_InfoAndLog
+    {921, 78, 114, 156, 1, 1747}, // MS_database_UniProtKB_Swiss_Prot
+    {922, 78, 114, 156, 1, 1751}, // MS_peptide_sequence_level_identification_attribute
+    {923, 78, 114, 156, 1, 1755}, // MS_SEQUEST_TopNumber
+    {924, 78, 114, 156, 1, 1760}, // MS_data_stored_in_database
+    {925, 78, 114, 156, 1, 1762}, // MS_param__a_ion
+    {926, 78, 114, 156, 1, 1764}, // MS_SEQUEST_CullTo
+    {927, 78, 114, 156, 1, 1769}, // MS_SEQUEST_modeCV
+    {928, 78, 114, 156, 1, 1773}, // MS_SEQUEST_Full
+    {929, 78, 114, 156, 1, 1778}, // MS_n_terminal_flanking_residue
+    {930, 78, 114, 156, 1, 1783}, // MS_c_terminal_flanking_residue
+    {931, 78, 114, 156, 1, 1788}, // MS_retention_time_s__OBSOLETE
+    {933, 78, 116, 156, 1, 1793}, // MS_scan_number_s__OBSOLETE
+    {933, 78, 116, 156, 1, 1793}, // MS_single_protein_identification_statistic
+    {934, 78, 116, 156, 1, 1798}, // MS_theoretical_mass
+    {935, 78, 117, 156, 1, 1803}, // MS_param__b_ion
+    {936, 78, 117, 156, 1, 1805}, // MS_param__c_ion
+    {937, 78, 117, 156, 1, 1807}, // MS_SEQUEST_FormatAndLinks
+    {938, 78, 117, 156, 1, 1812}, // MS_number_of_matched_peaks
+    {939, 78, 117, 156, 1, 1817}, // MS_ions_series_considered
+    {940, 78, 117, 156, 1, 1822}, // MS_number_of_peaks_used
+    {941, 78, 117, 156, 1, 1827}, // MS_number_of_peaks_submitted
+    {942, 78, 117, 156, 1, 1832}, // MS_manual_validation
+    {944, 78, 117, 156, 1, 1840}, // MS_SEQUEST_Fast
+    {945, 78, 117, 156, 1, 1845}, // MS_peptide_sharing_details
+    {946, 78, 117, 156, 1, 1850}, // MS_SEQUEST_selectCV
+    {947, 78, 117, 156, 1, 1854}, // MS_quantification_information
+    {947, 79, 117, 156, 1, 1854}, // MS_peptide_raw_area_OBSOLETE
+    {948, 79, 117, 156, 1, 1856}, // MS_error_on_peptide_area
+    {949, 79, 117, 156, 1, 1858}, // MS_peptide_ratio
+    {950, 79, 117, 156, 1, 1860}, // MS_error_on_peptide_ratio
+    {951, 79, 117, 156, 1, 1862}, // MS_protein_ratio
+    {952, 79, 117, 156, 1, 1864}, // MS_error_on_protein_ratio
+    {953, 79, 117, 156, 1, 1866}, // MS_p_value__protein_diff_from_1_randomly__OBSOLETE
+    {954, 79, 117, 156, 1, 1868}, // MS_absolute_quantity
+    {955, 79, 117, 156, 1, 1870}, // MS_error_on_absolute_quantity
+    {956, 79, 117, 156, 1, 1872}, // MS_quantitation_software_name
+    {958, 79, 117, 156, 1, 1874}, // MS_quantitation_software_version_OBSOLETE
+    {959, 79, 117, 156, 1, 1875}, // MS_intensity_of_precursor_ion
+    {960, 79, 117, 156, 1, 1877}, // MS_database_IPI_human
+    {961, 79, 117, 156, 1, 1880}, // MS_PSM_level_search_engine_specific_statistic
+    {962, 79, 117, 156, 1, 1886}, // MS_SEQUEST_SelectDefault
+    {963, 79, 117, 156, 1, 1891}, // MS_SEQUEST_SelectAdvancedCV
+    {964, 79, 117, 156, 1, 1896}, // MS_param__a_ion_NH3_DEPRECATED
+    {965, 79, 117, 156, 1, 1898}, // MS_protein_ambiguity_group_result_details
+    {967, 79, 117, 156, 1, 1904}, // MS_param__a_ion_H2O_DEPRECATED
+    {968, 79, 117, 156, 1, 1906}, // MS_param__b_ion_NH3_DEPRECATED
+    {969, 79, 117, 156, 1, 1908}, // MS_param__b_ion_H2O_DEPRECATED
+    {970, 79, 117, 156, 1, 1910}, // MS_param__y_ion_NH3_DEPRECATED
+    {971, 79, 117, 156, 1, 1912}, // MS_param__y_ion_H2O_DEPRECATED
+    {972, 79, 117, 156, 1, 1914}, // MS_search_engine_specific_score
+    {973, 79, 117, 156, 1, 1918}, // MS_SEQUEST_probability
+    {974, 79, 117, 156, 1, 1925}, // MS_SEQUEST_xcorr
+    {975, 79, 118, 156, 1, 1932}, // MS_SEQUEST_deltacn
+    {976, 79, 118, 156, 1, 1939}, // MS_SEQUEST_sp
+    {977, 79, 118, 156, 1, 1946}, // MS_SEQUEST_Uniq
+    {978, 79, 118, 156, 1, 1953}, // MS_SEQUEST_expectation_value
+    {979, 79, 118, 156, 1, 1958}, // MS_SEQUEST_sf
+    {980, 79, 118, 156, 1, 1965}, // MS_SEQUEST_matched_ions
+    {981, 79, 118, 156, 1, 1972}, // MS_SEQUEST_total_ions
+    {982, 79, 118, 156, 1, 1979}, // MS_SEQUEST_consensus_score
+    {983, 79, 118, 156, 1, 1984}, // MS_Paragon_unused_protscore
+    {985, 79, 118, 156, 1, 1994}, // MS_Paragon_total_protscore
+    {987, 79, 118, 156, 1, 2004}, // MS_Paragon_score
+    {988, 79, 118, 156, 1, 2011}, // MS_Paragon_confidence
+    {989, 79, 118, 156, 1, 2018}, // MS_Paragon_expression_error_factor
+    {990, 79, 118, 156, 1, 2025}, // MS_Paragon_expression_change_p_value
+    {991, 79, 118, 156, 1, 2032}, // MS_Paragon_contrib
+    {992, 79, 118, 156, 1, 2039}, // MS_Mascot_score
+    {993, 79, 118, 156, 1, 2046}, // MS_Mascot_expectation_value
+    {994, 79, 118, 156, 1, 2053}, // MS_Mascot_matched_ions
+    {995, 79, 118, 156, 1, 2060}, // MS_Mascot_total_ions
+    {996, 79, 118, 156, 1, 2067}, // MS_peptide_shared_in_multiple_proteins
+    {997, 79, 118, 156, 1, 2073}, // MS______KR_____P_
+    {998, 79, 118, 156, 1, 2075}, // MS_number_of_molecular_hypothesis_considered
+    {999, 79, 118, 156, 1, 2077}, // MS_database_EST
+    {1000, 79, 118, 156, 1, 2081}, // MS_Cleavage_agent_regular_expression
+    {1001, 80, 118, 156, 1, 2082}, // MS_search_statistics
+    {1002, 80, 118, 156, 1, 2083}, // MS_modification_specificity_peptide_N_term
+    {1003, 80, 118, 156, 1, 2085}, // MS_modification_specificity_peptide_C_term
+    {1004, 80, 118, 156, 1, 2087}, // MS_p_value_OBSOLETE
+    {1006, 80, 118, 156, 1, 2096}, // MS_Expect_value
+    {1008, 80, 118, 156, 1, 2104}, // MS_confidence_score
+    {1010, 80, 118, 156, 1, 2112}, // MS_quality_estimation_with_decoy_database
+    {1011, 80, 118, 156, 1, 2114}, // MS_decoy_DB_type_reverse
+    {1012, 80, 118, 156, 1, 2117}, // MS_decoy_DB_type_randomized
+    {1013, 80, 118, 156, 1, 2120}, // MS_DB_composition_target_decoy
+    {1014, 80, 118, 156, 1, 2123}, // MS_protein_identification_confidence_metric
+    {1015, 80, 118, 156, 1, 2129}, // MS_Mascot_DAT_format
+    {1016, 80, 118, 156, 1, 2131}, // MS_SEQUEST_out_file_format
+    {1017, 80, 118, 156, 1, 2133}, // MS_DB_MW_filter_maximum
+    {1018, 80, 120, 156, 1, 2137}, // MS_DB_MW_filter_minimum
+    {1019, 80, 122, 156, 1, 2141}, // MS_DB_PI_filter_maximum
+    {1020, 80, 122, 156, 1, 2145}, // MS_DB_PI_filter_minimum
+    {1021, 80, 122, 156, 1, 2149}, // MS_Mascot
+    {1022, 80, 122, 156, 1, 2151}, // MS_SEQUEST
+    {1023, 80, 122, 156, 1, 2153}, // MS_Phenyx
+    {1024, 80, 122, 156, 1, 2155}, // MS_mass_type_settings
+    {1025, 80, 122, 156, 1, 2156}, // MS_parent_mass_type_mono
+    {1026, 80, 122, 156, 1, 2158}, // MS_parent_mass_type_average
+    {1027, 80, 122, 156, 1, 2160}, // MS_search_result_details_OBSOLETE
+    {1027, 80, 122, 156, 1, 2160}, // MS_protein_level_global_FDR
+    {1028, 80, 123, 156, 1, 2166}, // MS_SEQUEST_PeptideSp
+    {1029, 80, 123, 156, 1, 2173}, // MS_SEQUEST_PeptideRankSp
+    {1030, 80, 123, 156, 1, 2180}, // MS_SEQUEST_PeptideNumber
+    {1031, 80, 123, 156, 1, 2187}, // MS_SEQUEST_PeptideIdnumber
+    {1032, 80, 123, 156, 1, 2194}, // MS_frag__y_ion
+    {1033, 80, 123, 156, 1, 2200}, // MS_product_ion_attribute
+    {1034, 80, 123, 156, 1, 2204}, // MS_frag__b_ion___H2O
+    {1035, 80, 123, 156, 1, 2210}, // MS_frag__y_ion___H2O
+    {1036, 80, 123, 156, 1, 2216}, // MS_frag__b_ion
+    {1037, 80, 123, 156, 1, 2222}, // MS_product_ion_m_z
+    {1038, 80, 124, 157, 1, 2227}, // MS_product_ion_intensity
+    {1039, 80, 128, 158, 1, 2232}, // MS_product_ion_m_z_error
+    {1040, 80, 130, 158, 1, 2237}, // MS_frag__x_ion
+    {1041, 80, 130, 158, 1, 2243}, // MS_frag__a_ion
+    {1042, 80, 130, 158, 1, 2249}, // MS_frag__z_ion
+    {1043, 80, 130, 158, 1, 2255}, // MS_frag__c_ion
+    {1044, 80, 130, 158, 1, 2261}, // MS_frag__b_ion___NH3
+    {1045, 80, 130, 158, 1, 2267}, // MS_frag__y_ion___NH3
+    {1046, 80, 130, 158, 1, 2273}, // MS_frag__a_ion___H2O
+    {1047, 80, 130, 158, 1, 2279}, // MS_frag__a_ion___NH3
+    {1048, 80, 130, 158, 1, 2285}, // MS_frag__d_ion
+    {1049, 80, 130, 158, 1, 2291}, // MS_frag__v_ion
+    {1050, 80, 130, 158, 1, 2297}, // MS_frag__w_ion
+    {1051, 80, 130, 158, 1, 2303}, // MS_frag__immonium_ion
+    {1052, 80, 130, 158, 1, 2309}, // MS_non_identified_ion
+    {1053, 80, 130, 158, 1, 2314}, // MS_co_eluting_ion
+    {1054, 80, 130, 158, 1, 2319}, // MS_SEQUEST_out_folder
+    {1055, 80, 130, 158, 1, 2321}, // MS_SEQUEST_summary
+    {1056, 80, 130, 158, 1, 2323}, // MS_PerSeptive_PKS_format
+    {1057, 80, 130, 158, 1, 2325}, // MS_SCIEX_API_III_format
+    {1058, 80, 130, 158, 1, 2327}, // MS_Bruker_XML_format
+    {1059, 80, 130, 158, 1, 2329}, // MS_search_input_details
+    {1059, 81, 130, 158, 1, 2329}, // MS_local_FDR
+    {1061, 81, 130, 158, 1, 2337}, // MS_Trypsin
+    {1062, 81, 131, 158, 1, 2340}, // MS_DB_source_EBI
+    {1063, 81, 131, 158, 1, 2343}, // MS_DB_source_NCBI
+    {1064, 81, 131, 158, 1, 2346}, // MS_DB_source_UniProt
+    {1065, 81, 131, 158, 1, 2349}, // MS_fragment_mass_type_average
+    {1066, 81, 131, 158, 1, 2351}, // MS_fragment_mass_type_mono
+    {1067, 81, 131, 158, 1, 2353}, // MS_param__v_ion
+    {1068, 81, 131, 158, 1, 2355}, // MS_param__d_ion
+    {1069, 81, 131, 158, 1, 2357}, // MS_param__immonium_ion
+    {1070, 81, 131, 158, 1, 2359}, // MS_param__w_ion
+    {1071, 81, 131, 158, 1, 2361}, // MS_param__x_ion
+    {1072, 81, 131, 158, 1, 2363}, // MS_param__y_ion
+    {1073, 81, 131, 158, 1, 2365}, // MS_param__z_ion
+    {1074, 81, 131, 158, 1, 2367}, // MS_role_type
+    {1075, 81, 131, 158, 1, 2369}, // MS_software_vendor
+    {1076, 81, 131, 158, 1, 2372}, // MS_programmer
+    {1077, 81, 131, 158, 1, 2375}, // MS_instrument_vendor
+    {1078, 81, 131, 158, 1, 2378}, // MS_lab_personnel
+    {1079, 81, 131, 158, 1, 2381}, // MS_researcher
+    {1080, 81, 131, 158, 1, 2384}, // MS_____R____P_
+    {1081, 81, 131, 158, 1, 2386}, // MS_____BD__
+    {1082, 81, 131, 158, 1, 2388}, // MS_____DE__
+    {1083, 81, 131, 158, 1, 2390}, // MS_ProteinScape_SearchEvent
+    {1084, 81, 131, 158, 1, 2392}, // MS_ProteinScape_Gel
+    {1085, 81, 131, 158, 1, 2394}, // MS_decoy_DB_accession_regexp
+    {1086, 81, 131, 158, 1, 2397}, // MS_decoy_DB_derived_from_OBSOLETE
+    {1087, 81, 131, 158, 1, 2400}, // MS_database_IPI_mouse
+    {1088, 81, 131, 158, 1, 2403}, // MS_database_IPI_rat
+    {1089, 81, 131, 158, 1, 2406}, // MS_database_IPI_zebrafish
+    {1090, 81, 131, 158, 1, 2409}, // MS_database_IPI_chicken
+    {1091, 81, 131, 158, 1, 2412}, // MS_database_IPI_cow
+    {1092, 81, 131, 158, 1, 2415}, // MS_database_IPI_arabidopsis
+    {1093, 81, 131, 158, 1, 2418}, // MS_decoy_DB_from_nr_OBSOLETE
+    {1093, 81, 131, 158, 1, 2418}, // MS_decoy_DB_from_IPI_rat_OBSOLETE
+    {1093, 81, 131, 158, 1, 2418}, // MS_decoy_DB_from_IPI_mouse_OBSOLETE
+    {1093, 81, 131, 158, 1, 2418}, // MS_decoy_DB_from_IPI_arabidopsis_OBSOLETE
+    {1093, 81, 131, 158, 1, 2418}, // MS_decoy_DB_from_EST_OBSOLETE
+    {1093, 81, 131, 158, 1, 2418}, // MS_decoy_DB_from_IPI_zebrafish_OBSOLETE
+    {1093, 81, 131, 158, 1, 2418}, // MS_decoy_DB_from_UniProtKB_Swiss_Prot_OBSOLETE
+    {1093, 81, 131, 158, 1, 2418}, // MS_decoy_DB_from_IPI_chicken_OBSOLETE
+    {1093, 81, 131, 158, 1, 2418}, // MS_decoy_DB_from_IPI_cow_OBSOLETE
+    {1093, 81, 131, 158, 1, 2418}, // MS_decoy_DB_from_IPI_human_OBSOLETE
+    {1093, 81, 131, 158, 1, 2418}, // MS_protein_rank
+    {1094, 81, 131, 158, 1, 2423}, // MS_search_engine_specific_input_parameter
+    {1095, 81, 131, 158, 1, 2425}, // MS_Arg_C
+    {1096, 81, 132, 159, 1, 2428}, // MS_Asp_N
+    {1097, 81, 133, 159, 1, 2431}, // MS_Asp_N_ambic
+    {1098, 81, 134, 159, 1, 2434}, // MS_Chymotrypsin
+    {1099, 81, 135, 159, 1, 2437}, // MS_CNBr
+    {1100, 81, 136, 159, 1, 2440}, // MS_Formic_acid
+    {1101, 81, 137, 159, 1, 2443}, // MS_Lys_C
+    {1102, 81, 138, 159, 1, 2446}, // MS_Lys_C_P
+    {1103, 81, 139, 159, 1, 2449}, // MS_PepsinA
+    {1104, 81, 140, 159, 1, 2452}, // MS_TrypChymo
+    {1105, 81, 141, 159, 1, 2455}, // MS_Trypsin_P
+    {1106, 81, 142, 159, 1, 2458}, // MS_V8_DE
+    {1107, 81, 143, 159, 1, 2461}, // MS_V8_E
+    {1108, 81, 144, 159, 1, 2464}, // MS_Mascot_SigThreshold
+    {1109, 81, 144, 159, 1, 2468}, // MS_Mascot_MaxProteinHits
+    {1110, 81, 144, 159, 1, 2472}, // MS_Mascot_ProteinScoringMethod
+    {1111, 81, 144, 159, 1, 2476}, // MS_Mascot_MinMSMSThreshold
+    {1112, 81, 144, 159, 1, 2480}, // MS_Mascot_ShowHomologousProteinsWithSamePeptides
+    {1113, 81, 144, 159, 1, 2484}, // MS_Mascot_ShowHomologousProteinsWithSubsetOfPeptides
+    {1114, 81, 144, 159, 1, 2488}, // MS_Mascot_RequireBoldRed
+    {1115, 81, 144, 159, 1, 2492}, // MS_Mascot_UseUnigeneClustering
+    {1116, 81, 144, 159, 1, 2496}, // MS_Mascot_IncludeErrorTolerantMatches
+    {1117, 81, 144, 159, 1, 2500}, // MS_Mascot_ShowDecoyMatches
+    {1118, 81, 144, 159, 1, 2504}, // MS_add_others_OBSOLETE
+    {1118, 81, 144, 159, 1, 2504}, // MS_OMSSA_evalue
+    {1119, 81, 144, 159, 1, 2511}, // MS_OMSSA_pvalue
+    {1120, 81, 144, 159, 1, 2518}, // MS_X_Tandem_expect
+    {1121, 81, 144, 159, 1, 2525}, // MS_X_Tandem_hyperscore
+    {1122, 81, 144, 159, 1, 2532}, // MS______FYWL_____P_
+    {1123, 81, 144, 159, 1, 2534}, // MS_____M_
+    {1124, 81, 144, 159, 1, 2536}, // MS______D_______D__
+    {1125, 81, 144, 159, 1, 2538}, // MS_____K____P_
+    {1126, 81, 144, 159, 1, 2540}, // MS_____K_
+    {1127, 81, 144, 159, 1, 2542}, // MS______FL__
+    {1128, 81, 144, 159, 1, 2544}, // MS______FYWLKR_____P_
+    {1129, 81, 144, 159, 1, 2546}, // MS______KR__
+    {1130, 81, 144, 159, 1, 2548}, // MS______BDEZ_____P_
+    {1131, 81, 144, 159, 1, 2550}, // MS______EZ_____P_
+    {1132, 81, 144, 159, 1, 2552}, // MS_database_sequence_details
+    {1133, 81, 144, 159, 1, 2554}, // MS_NA_sequence
+    {1134, 81, 144, 159, 1, 2557}, // MS_AA_sequence
+    {1135, 81, 144, 159, 1, 2560}, // MS_mass_table_source
+    {1136, 81, 144, 159, 1, 2561}, // MS_AAIndex_mass_table
+    {1137, 81, 144, 159, 1, 2563}, // MS_database_file_formats
+    {1138, 81, 144, 159, 1, 2565}, // MS_FASTA_format
+    {1139, 81, 144, 159, 1, 2568}, // MS_ASN_1
+    {1140, 81, 144, 159, 1, 2571}, // MS_NCBI___p_
+    {1141, 81, 144, 159, 1, 2574}, // MS_clustal_aln
+    {1142, 81, 144, 159, 1, 2577}, // MS_embl_em
+    {1143, 81, 144, 159, 1, 2580}, // MS_NBRF_PIR
+    {1144, 81, 144, 159, 1, 2583}, // MS_mass_table_options
+    {1144, 82, 144, 159, 1, 2583}, // MS_peptide_descriptions
+    {1145, 82, 144, 159, 1, 2588}, // MS_spectrum_descriptions
+    {1146, 82, 144, 159, 1, 2589}, // MS_spectrum_quality_descriptions
+    {1147, 82, 144, 159, 1, 2591}, // MS_msmsEval_quality
+    {1148, 82, 144, 159, 1, 2594}, // MS_ambiguous_residues
+    {1148, 83, 144, 159, 1, 2594}, // MS_alternate_single_letter_codes
+    {1149, 83, 144, 159, 1, 2595}, // MS_alternate_mass
+    {1150, 83, 145, 159, 1, 2596}, // MS_number_of_unmatched_peaks
+    {1151, 83, 145, 159, 1, 2601}, // MS_peptide_unique_to_one_protein
+    {1152, 83, 145, 159, 1, 2607}, // MS_peptide_sequence_level_global_FDR
+    {1153, 83, 146, 159, 1, 2613}, // MS_frag__internal_yb_ion
+    {1154, 83, 146, 159, 1, 2619}, // MS_frag__internal_ya_ion
+    {1155, 83, 146, 159, 1, 2625}, // MS_frag__z_1_ion
+    {1156, 83, 146, 159, 1, 2631}, // MS_frag__z_2_ion
+    {1157, 83, 146, 159, 1, 2637}, // MS_text_format
+    {1158, 83, 146, 159, 1, 2639}, // MS_Mascot_homology_threshold
+    {1159, 83, 146, 159, 1, 2646}, // MS_Mascot_identity_threshold
+    {1160, 83, 146, 159, 1, 2653}, // MS_SEQUEST_Sequences
+    {1161, 83, 146, 159, 1, 2660}, // MS_SEQUEST_TIC
+    {1162, 83, 146, 159, 1, 2667}, // MS_SEQUEST_Sum
+    {1163, 83, 146, 159, 1, 2674}, // MS_Phenyx_Instrument_Type
+    {1164, 83, 146, 159, 1, 2678}, // MS_Phenyx_Scoring_Model
+    {1165, 83, 146, 159, 1, 2682}, // MS_Phenyx_Default_Parent_Charge
+    {1166, 83, 146, 159, 1, 2686}, // MS_Phenyx_Trust_Parent_Charge
+    {1167, 83, 146, 159, 1, 2690}, // MS_Phenyx_Turbo
+    {1168, 83, 146, 159, 1, 2694}, // MS_Phenyx_Turbo_ErrorTol
+    {1169, 83, 146, 159, 1, 2698}, // MS_Phenyx_Turbo_Coverage
+    {1170, 83, 146, 159, 1, 2702}, // MS_Phenyx_Turbo_Series
+    {1171, 83, 146, 159, 1, 2706}, // MS_Phenyx_MinPepLength
+    {1172, 83, 146, 159, 1, 2710}, // MS_Phenyx_MinPepzscore
+    {1173, 83, 146, 159, 1, 2714}, // MS_Phenyx_MaxPepPvalue
+    {1174, 83, 146, 159, 1, 2718}, // MS_Phenyx_AC_Score
+    {1175, 83, 146, 159, 1, 2722}, // MS_Phenyx_Conflict_Resolution
+    {1176, 83, 146, 159, 1, 2726}, // MS_Phenyx_AC
+    {1177, 83, 146, 159, 1, 2733}, // MS_Phenyx_ID
+    {1178, 83, 146, 159, 1, 2740}, // MS_Phenyx_Score
+    {1179, 83, 146, 159, 1, 2747}, // MS_Phenyx_Peptides1
+    {1180, 83, 146, 159, 1, 2754}, // MS_Phenyx_Peptides2
+    {1181, 83, 146, 159, 1, 2761}, // MS_Phenyx_Auto
+    {1182, 83, 146, 159, 1, 2768}, // MS_Phenyx_User
+    {1184, 83, 146, 159, 1, 2778}, // MS_Phenyx_Pepzscore
+    {1185, 83, 146, 159, 1, 2785}, // MS_Phenyx_PepPvalue
+    {1187, 83, 146, 159, 1, 2795}, // MS_Phenyx_NumberOfMC
+    {1188, 83, 146, 159, 1, 2802}, // MS_Phenyx_Modif
+    {1190, 83, 146, 159, 1, 2812}, // MS_OMSSA_csv_format
+    {1191, 83, 146, 159, 1, 2814}, // MS_OMSSA_xml_format
+    {1192, 83, 146, 159, 1, 2816}, // MS_X_Tandem_xml_format
+    {1193, 83, 146, 159, 1, 2818}, // MS_spectrum_identification_result_details
+    {1193, 84, 146, 159, 1, 2818}, // MS_param__internal_yb_ion
+    {1194, 84, 146, 159, 1, 2820}, // MS_param__internal_ya_ion
+    {1195, 84, 146, 159, 1, 2822}, // MS_param__z_1_ion
+    {1196, 84, 146, 159, 1, 2824}, // MS_param__z_2_ion
+    {1197, 84, 146, 159, 1, 2826}, // MS_translation_start_codons
+    {1198, 84, 146, 159, 1, 2828}, // MS_search_tolerance_specification
+    {1199, 84, 146, 159, 1, 2829}, // MS_search_tolerance_plus_value
+    {1200, 84, 150, 159, 1, 2831}, // MS_search_tolerance_minus_value
+    {1201, 84, 154, 159, 1, 2833}, // MS_MGF_scans_OBSOLETE
+    {1202, 84, 154, 159, 1, 2834}, // MS_MGF_raw_scans_OBSOLETE
+    {1203, 84, 154, 159, 1, 2835}, // MS_spectrum_title_OBSOLETE
+    {1204, 84, 154, 159, 1, 2836}, // MS_SpectraST_dot
+    {1205, 84, 154, 159, 1, 2843}, // MS_SpectraST_dot_bias
+    {1206, 84, 154, 159, 1, 2850}, // MS_SpectraST_discriminant_score_F
+    {1207, 84, 154, 159, 1, 2857}, // MS_SpectraST_delta
+    {1208, 84, 154, 159, 1, 2864}, // MS_pepXML_format
+    {1209, 84, 154, 159, 1, 2866}, // MS_protXML_format
+    {1210, 84, 154, 159, 1, 2868}, // MS_translation_table_description
+    {1211, 84, 154, 159, 1, 2870}, // MS_ProteinExtractor_Methodname
+    {1212, 84, 154, 159, 1, 2874}, // MS_ProteinExtractor_GenerateNonRedundant
+    {1213, 84, 154, 159, 1, 2878}, // MS_ProteinExtractor_IncludeIdentified
+    {1214, 84, 154, 159, 1, 2882}, // MS_ProteinExtractor_MaxNumberOfProteins
+    {1215, 84, 154, 159, 1, 2886}, // MS_ProteinExtractor_MaxProteinMass
+    {1216, 84, 154, 159, 1, 2890}, // MS_ProteinExtractor_MinNumberOfPeptides
+    {1217, 84, 154, 159, 1, 2894}, // MS_ProteinExtractor_UseMascot
+    {1218, 84, 154, 159, 1, 2898}, // MS_ProteinExtractor_MascotPeptideScoreThreshold
+    {1219, 84, 154, 159, 1, 2902}, // MS_ProteinExtractor_MascotUniqueScore
+    {1220, 84, 154, 159, 1, 2906}, // MS_ProteinExtractor_MascotUseIdentityScore
+    {1221, 84, 154, 159, 1, 2910}, // MS_ProteinExtractor_MascotWeighting
+    {1222, 84, 154, 159, 1, 2914}, // MS_ProteinExtractor_UseSequest
+    {1223, 84, 154, 159, 1, 2918}, // MS_ProteinExtractor_SequestPeptideScoreThreshold
+    {1224, 84, 154, 159, 1, 2922}, // MS_ProteinExtractor_SequestUniqueScore
+    {1225, 84, 154, 159, 1, 2926}, // MS_ProteinExtractor_SequestWeighting
+    {1226, 84, 154, 159, 1, 2930}, // MS_ProteinExtractor_UseProteinSolver
+    {1227, 84, 154, 159, 1, 2934}, // MS_ProteinExtractor_ProteinSolverPeptideScoreThreshold
+    {1228, 84, 154, 159, 1, 2938}, // MS_ProteinExtractor_ProteinSolverUniqueScore
+    {1229, 84, 154, 159, 1, 2942}, // MS_ProteinExtractor_ProteinSolverWeighting
+    {1230, 84, 154, 159, 1, 2946}, // MS_ProteinExtractor_UsePhenyx
+    {1231, 84, 154, 159, 1, 2950}, // MS_ProteinExtractor_PhenyxPeptideScoreThreshold
+    {1232, 84, 154, 159, 1, 2954}, // MS_ProteinExtractor_PhenyxUniqueScore
+    {1233, 84, 154, 159, 1, 2958}, // MS_ProteinExtractor_PhenyxWeighting
+    {1234, 84, 154, 159, 1, 2962}, // MS_prot_FDR_threshold
+    {1235, 84, 154, 159, 1, 2967}, // MS_pep_FDR_threshold
+    {1236, 84, 154, 159, 1, 2972}, // MS_OMSSA_e_value_threshold
+    {1237, 84, 154, 159, 1, 2976}, // MS_decoy_DB_details
+    {1238, 84, 154, 159, 1, 2978}, // MS_decoy_DB_generation_algorithm
+    {1239, 84, 154, 159, 1, 2981}, // MS_decoy_DB_type_shuffle
+    {1240, 84, 154, 159, 1, 2984}, // MS_DB_composition_only_decoy
+    {1241, 84, 154, 159, 1, 2987}, // MS_quality_estimation_with_implicite_decoy_sequences
+    {1242, 84, 154, 159, 1, 2989}, // MS_acquisition_software
+    {1243, 84, 154, 159, 1, 2990}, // MS_analysis_software
+    {1244, 84, 154, 159, 1, 2991}, // MS_data_processing_software
+    {1245, 84, 154, 159, 1, 2992}, // MS_spectrum_generation_information
+    {1245, 85, 154, 159, 1, 2992}, // MS_file_format
+    {1245, 86, 154, 159, 1, 2992}, // MS_unknown_modification
+    {1246, 86, 154, 159, 1, 2993}, // MS_greylag
+    {1247, 86, 154, 159, 1, 2995}, // MS_PEFF_format
+    {1248, 86, 154, 159, 1, 2998}, // MS_Phenyx_XML_format
+    {1250, 86, 154, 159, 1, 3001}, // MS_DTASelect_format
+    {1251, 86, 154, 159, 1, 3003}, // MS_MS2_format
+    {1252, 86, 154, 159, 1, 3005}, // MS_taxonomy__NCBI_TaxID
+    {1253, 86, 154, 159, 1, 3016}, // MS_taxonomy__common_name
+    {1254, 86, 154, 159, 1, 3027}, // MS_taxonomy__scientific_name
+    {1255, 86, 154, 159, 1, 3038}, // MS_taxonomy__Swiss_Prot_ID
+    {1256, 86, 154, 159, 1, 3049}, // MS_peptide_modification_details
+    {1256, 87, 154, 159, 1, 3049}, // MS_selected_ion_monitoring_chromatogram
+    {1258, 87, 154, 160, 1, 3052}, // MS_selected_reaction_monitoring_chromatogram
+    {1260, 87, 154, 161, 1, 3055}, // MS_consecutive_reaction_monitoring_chromatogram_OBSOLETE
+    {1262, 87, 154, 162, 1, 3058}, // MS_OMSSA
+    {1263, 87, 154, 162, 1, 3060}, // MS_X_Tandem
+    {1264, 87, 154, 162, 1, 3062}, // MS_SpectraST
+    {1265, 87, 154, 162, 1, 3064}, // MS_Mascot_Parser
+    {1266, 87, 154, 162, 1, 3066}, // MS_null_terminated_ASCII_string
+    {1267, 87, 154, 162, 1, 3067}, // MS_SCIEX_TOF_TOF_nativeID_format
+    {1268, 87, 154, 162, 1, 3068}, // MS_SCIEX_TOF_TOF_database
+    {1269, 87, 154, 162, 1, 3070}, // MS_5800_TOF_TOF
+    {1270, 87, 154, 162, 1, 3072}, // MS_SCIEX_TOF_TOF_Series_Explorer_Software
+    {1274, 87, 154, 162, 1, 3077}, // MS_intensity_normalization
+    {1275, 87, 154, 162, 1, 3079}, // MS_m_z_calibration
+    {1276, 87, 154, 162, 1, 3081}, // MS_data_filtering
+    {1277, 87, 154, 162, 1, 3083}, // MS_ProteinExtractor
+    {1279, 87, 154, 162, 1, 3086}, // MS_Mascot_Distiller
+    {1281, 87, 154, 162, 1, 3090}, // MS_Mascot_Integra
+    {1282, 87, 154, 162, 1, 3092}, // MS_Percolator
+    {1283, 87, 154, 162, 1, 3094}, // MS_percolator_Q_value
+    {1284, 87, 154, 162, 1, 3101}, // MS_percolator_score
+    {1285, 87, 154, 162, 1, 3108}, // MS_percolator_PEP
+    {1286, 87, 154, 162, 1, 3115}, // MS_no_threshold
+    {1287, 87, 154, 162, 1, 3118}, // MS_ProteinScape_SearchResultId
+    {1288, 87, 154, 162, 1, 3125}, // MS_ProteinScape_SearchEventId
+    {1289, 87, 154, 162, 1, 3132}, // MS_ProteinScape_ProfoundProbability
+    {1290, 87, 154, 162, 1, 3139}, // MS_Profound_z_value
+    {1291, 87, 154, 162, 1, 3146}, // MS_Profound_Cluster
+    {1292, 87, 154, 162, 1, 3153}, // MS_Profound_ClusterRank
+    {1293, 87, 154, 162, 1, 3160}, // MS_MSFit_Mowse_score
+    {1294, 87, 154, 162, 1, 3167}, // MS_Sonar_Score
+    {1295, 87, 154, 162, 1, 3174}, // MS_ProteinScape_PFFSolverExp
+    {1296, 87, 154, 162, 1, 3181}, // MS_ProteinScape_PFFSolverScore
+    {1297, 87, 154, 162, 1, 3188}, // MS_ProteinScape_IntensityCoverage
+    {1298, 87, 154, 162, 1, 3195}, // MS_ProteinScape_SequestMetaScore
+    {1299, 87, 154, 162, 1, 3202}, // MS_ProteinExtractor_Score
+    {1300, 87, 154, 162, 1, 3209}, // MS_Agilent_MassHunter_nativeID_format
+    {1301, 87, 154, 162, 1, 3210}, // MS_Agilent_MassHunter_format
+    {1302, 87, 154, 162, 1, 3212}, // MS_TSQ_Vantage
+    {1303, 87, 154, 162, 1, 3215}, // MS_Sequence_database_filter_types
+    {1304, 87, 154, 162, 1, 3218}, // MS_Sequence_database_filters
+    {1305, 87, 154, 162, 1, 3221}, // MS_DB_sequence_filter_pattern
+    {1306, 87, 154, 162, 1, 3225}, // MS_DB_accession_filter_string
+    {1307, 87, 154, 162, 1, 3229}, // MS_frag__c_ion___H2O
+    {1308, 87, 154, 162, 1, 3235}, // MS_frag__c_ion___NH3
+    {1309, 87, 154, 162, 1, 3241}, // MS_frag__z_ion___H2O
+    {1310, 87, 154, 162, 1, 3247}, // MS_frag__z_ion___NH3
+    {1311, 87, 154, 162, 1, 3253}, // MS_frag__x_ion___H2O
+    {1312, 87, 154, 162, 1, 3259}, // MS_frag__x_ion___NH3
+    {1313, 87, 154, 162, 1, 3265}, // MS_frag__precursor_ion___H2O
+    {1314, 87, 154, 162, 1, 3271}, // MS_frag__precursor_ion___NH3
+    {1315, 87, 154, 162, 1, 3277}, // MS_frag__precursor_ion
+    {1316, 87, 154, 162, 1, 3283}, // MS_fragment_neutral_loss
+    {1317, 87, 155, 162, 1, 3284}, // MS_precursor_neutral_loss
+    {1318, 87, 156, 162, 1, 3285}, // MS_spectrum_from_database_integer_nativeID_format
+    {1319, 87, 156, 162, 1, 3286}, // MS_Proteinscape_spectra
+    {1320, 87, 156, 162, 1, 3288}, // MS_Mascot_query_number
+    {1322, 87, 156, 162, 1, 3290}, // MS_spectra_data_details
+    {1323, 87, 156, 162, 1, 3291}, // MS_mzML_unique_identifier
+    {1324, 87, 156, 162, 1, 3293}, // MS_spectrum_from_ProteinScape_database_nativeID_format
+    {1326, 87, 156, 162, 1, 3296}, // MS_spectrum_from_database_string_nativeID_format
+    {1328, 87, 156, 162, 1, 3299}, // MS_Bruker_Daltonics_esquire_series
+    {1329, 87, 156, 162, 1, 3301}, // MS_Bruker_Daltonics_flex_series
+    {1330, 87, 156, 162, 1, 3303}, // MS_Bruker_Daltonics_BioTOF_series
+    {1331, 87, 156, 162, 1, 3305}, // MS_Bruker_Daltonics_micrOTOF_series
+    {1332, 87, 156, 162, 1, 3307}, // MS_BioTOF
+    {1333, 87, 156, 162, 1, 3310}, // MS_BioTOF_III
+    {1334, 87, 156, 162, 1, 3313}, // MS_UltroTOF_Q
+    {1335, 87, 156, 162, 1, 3316}, // MS_micrOTOF_II
+    {1336, 87, 156, 162, 1, 3319}, // MS_maXis
+    {1337, 87, 156, 162, 1, 3322}, // MS_amaZon_ETD
+    {1338, 87, 156, 162, 1, 3325}, // MS_microflex_LRF
+    {1339, 87, 156, 162, 1, 3328}, // MS_ultrafleXtreme
+    {1340, 87, 156, 162, 1, 3331}, // MS_Bruker_Daltonics_amaZon_series
+    {1341, 87, 156, 162, 1, 3333}, // MS_amaZon_X
+    {1342, 87, 156, 162, 1, 3336}, // MS_Bruker_Daltonics_maXis_series
+    {1343, 87, 156, 162, 1, 3338}, // MS_Bruker_Daltonics_solarix_series
+    {1344, 87, 156, 162, 1, 3340}, // MS_solariX
+    {1345, 87, 156, 162, 1, 3343}, // MS_microflex_II
+    {1346, 87, 156, 162, 1, 3346}, // MS_autoflex_II_TOF_TOF
+    {1347, 87, 156, 162, 1, 3349}, // MS_autoflex_III_TOF_TOF_smartbeam
+    {1348, 87, 156, 162, 1, 3352}, // MS_autoflex
+    {1349, 87, 156, 162, 1, 3355}, // MS_Bruker_Daltonics_apex_series
+    {1350, 87, 156, 162, 1, 3357}, // MS_Shimadzu_Corporation_software
+    {1351, 87, 156, 162, 1, 3358}, // MS_MALDI_Solutions
+    {1355, 87, 156, 162, 1, 3363}, // MS_SCIEX_TOF_TOF_T2D_nativeID_format
+    {1356, 87, 156, 162, 1, 3364}, // MS_SCIEX_TOF_TOF_T2D_format
+    {1357, 87, 156, 162, 1, 3366}, // MS_Scaffold
+    {1358, 87, 156, 162, 1, 3368}, // MS_Scaffold_nativeID_format
+    {1359, 87, 156, 162, 1, 3369}, // MS_SEQUEST_SQT_format
+    {1360, 87, 156, 162, 1, 3371}, // MS_Discoverer_MSF_format
+    {1361, 87, 156, 162, 1, 3373}, // MS_IdentityE_XML_format
+    {1362, 87, 156, 162, 1, 3375}, // MS_ProteinLynx_XML_format
+    {1363, 87, 156, 162, 1, 3377}, // MS_SpectrumMill_directories
+    {1364, 87, 156, 162, 1, 3379}, // MS_Scaffold_Peptide_Probability
+    {1365, 87, 156, 162, 1, 3386}, // MS_IdentityE_Score
+    {1366, 87, 156, 162, 1, 3393}, // MS_ProteinLynx_Log_Likelihood
+    {1367, 87, 156, 162, 1, 3400}, // MS_ProteinLynx_Ladder_Score
+    {1368, 87, 156, 162, 1, 3407}, // MS_SpectrumMill_Score
+    {1369, 87, 156, 162, 1, 3414}, // MS_SpectrumMill_SPI
+    {1370, 87, 156, 162, 1, 3421}, // MS_report_only_spectra_assigned_to_identified_proteins
+    {1371, 87, 156, 162, 1, 3423}, // MS_Scaffold__Minimum_Peptide_Count
+    {1372, 87, 156, 162, 1, 3427}, // MS_Scaffold__Minimum_Protein_Probability
+    {1373, 87, 156, 162, 1, 3431}, // MS_Scaffold__Minimum_Peptide_Probability
+    {1374, 87, 156, 162, 1, 3435}, // MS_minimum_number_of_enzymatic_termini
+    {1375, 87, 156, 162, 1, 3438}, // MS_Scaffold_Protein_Probability
+    {1376, 87, 156, 162, 1, 3445}, // MS_SpectrumMill_Discriminant_Score
+    {1377, 87, 156, 162, 1, 3452}, // MS_FAIMS_compensation_voltage
+    {1378, 87, 156, 163, 1, 3454}, // MS_XCMS
+    {1380, 87, 156, 163, 1, 3457}, // MS_MaxQuant
+    {1382, 87, 156, 163, 1, 3461}, // MS_combined_pmf___ms_ms_search
+    {1383, 87, 156, 163, 1, 3463}, // MS_MyriMatch
+    {1384, 87, 156, 163, 1, 3465}, // MS_DirecTag
+    {1385, 87, 156, 163, 1, 3467}, // MS_TagRecon
+    {1386, 87, 156, 163, 1, 3469}, // MS_Pepitome
+    {1387, 87, 156, 163, 1, 3471}, // MS_MyriMatch_MVH
+    {1388, 87, 156, 165, 1, 3478}, // MS_MyriMatch_mzFidelity
+    {1389, 87, 156, 167, 1, 3485}, // MS_anchor_protein
+    {1390, 87, 156, 167, 1, 3491}, // MS_family_member_protein
+    {1391, 87, 156, 167, 1, 3497}, // MS_group_member_with_undefined_relationship_OR_ortholog_protein
+    {1392, 87, 156, 167, 1, 3503}, // MS_sequence_same_set_protein
+    {1393, 87, 156, 167, 1, 3509}, // MS_spectrum_same_set_protein
+    {1394, 87, 156, 167, 1, 3515}, // MS_sequence_sub_set_protein
+    {1395, 87, 156, 167, 1, 3521}, // MS_spectrum_sub_set_protein
+    {1396, 87, 156, 167, 1, 3527}, // MS_sequence_subsumable_protein
+    {1397, 87, 156, 167, 1, 3533}, // MS_spectrum_subsumable_protein
+    {1398, 87, 156, 167, 1, 3539}, // MS_protein_inference_confidence_category
+    {1399, 87, 156, 167, 1, 3545}, // MS_ProteomeDiscoverer_Spectrum_Files_Raw_File_names_OBSOLETE
+    {1400, 87, 156, 167, 1, 3549}, // MS_ProteomeDiscoverer_SRF_File_Selector_SRF_File_Path_OBSOLETE
+    {1401, 87, 156, 167, 1, 3553}, // MS_ProteomeDiscoverer_Spectrum_Selector_Ionization_Source_OBSOLETE
+    {1402, 87, 156, 167, 1, 3557}, // MS_ProteomeDiscoverer_Activation_Type_OBSOLETE
+    {1403, 87, 156, 167, 1, 3561}, // MS_ProteomeDiscoverer_Spectrum_Selector_Lower_RT_Limit
+    {1404, 87, 156, 167, 1, 3565}, // MS_ProteomeDiscoverer_Mass_Analyzer_OBSOLETE
+    {1405, 87, 156, 167, 1, 3569}, // MS_ProteomeDiscoverer_Max_Precursor_Mass
+    {1406, 87, 156, 167, 1, 3573}, // MS_ProteomeDiscoverer_Min_Precursor_Mass
+    {1407, 87, 156, 167, 1, 3577}, // MS_ProteomeDiscoverer_Spectrum_Selector_Minimum_Peak_Count
+    {1408, 87, 156, 167, 1, 3581}, // MS_ProteomeDiscoverer_MS_Order_OBSOLETE
+    {1409, 87, 156, 167, 1, 3585}, // MS_ProteomeDiscoverer_Polarity_Mode_OBSOLETE
+    {1410, 87, 156, 167, 1, 3589}, // MS_ProteomeDiscoverer_Spectrum_Selector_Precursor_Selection
+    {1411, 87, 156, 167, 1, 3593}, // MS_ProteomeDiscoverer_SN_Threshold
+    {1412, 87, 156, 167, 1, 3597}, // MS_ProteomeDiscoverer_Scan_Type_OBSOLETE
+    {1413, 87, 156, 167, 1, 3601}, // MS_ProteomeDiscoverer_Spectrum_Selector_Total_Intensity_Threshold
+    {1414, 87, 156, 167, 1, 3605}, // MS_ProteomeDiscoverer_Spectrum_Selector_Unrecognized_Activation_Type_Replacements
+    {1415, 87, 156, 167, 1, 3609}, // MS_ProteomeDiscoverer_Spectrum_Selector_Unrecognized_Charge_Replacements
+    {1416, 87, 156, 167, 1, 3613}, // MS_ProteomeDiscoverer_Spectrum_Selector_Unrecognized_Mass_Analyzer_Replacements
+    {1417, 87, 156, 167, 1, 3617}, // MS_ProteomeDiscoverer_Spectrum_Selector_Unrecognized_MS_Order_Replacements
+    {1418, 87, 156, 167, 1, 3621}, // MS_ProteomeDiscoverer_Spectrum_Selector_Unrecognized_Polarity_Replacements
+    {1419, 87, 156, 167, 1, 3625}, // MS_ProteomeDiscoverer_Spectrum_Selector_Upper_RT_Limit
+    {1420, 87, 156, 167, 1, 3629}, // MS_ProteomeDiscoverer_Non_Fragment_Filter_Mass_Window_Offset
+    {1421, 87, 156, 167, 1, 3633}, // MS_ProteomeDiscoverer_Non_Fragment_Filter_Maximum_Neutral_Loss_Mass
+    {1422, 87, 156, 167, 1, 3637}, // MS_ProteomeDiscoverer_Non_Fragment_Filter_Remove_Charge_Reduced_Precursor
+    {1423, 87, 156, 167, 1, 3641}, // MS_ProteomeDiscoverer_Non_Fragment_Filter_Remove_Neutral_Loss_Peaks
+    {1424, 87, 156, 167, 1, 3645}, // MS_ProteomeDiscoverer_Non_Fragment_Filter_Remove_Only_Known_Masses
+    {1425, 87, 156, 167, 1, 3649}, // MS_ProteomeDiscoverer_Non_Fragment_Filter_Remove_Precursor_Overtones
+    {1426, 87, 156, 167, 1, 3653}, // MS_ProteomeDiscoverer_Non_Fragment_Filter_Remove_Precursor_Peak
+    {1427, 87, 156, 167, 1, 3657}, // MS_ProteomeDiscoverer_Spectrum_Grouper_Allow_Mass_Analyzer_Mismatch
+    {1428, 87, 156, 167, 1, 3661}, // MS_ProteomeDiscoverer_Spectrum_Grouper_Allow_MS_Order_Mismatch
+    {1429, 87, 156, 167, 1, 3665}, // MS_ProteomeDiscoverer_Spectrum_Grouper_Max_RT_Difference_OBSOLETE
+    {1430, 87, 156, 167, 1, 3669}, // MS_ProteomeDiscoverer_Spectrum_Grouper_Precursor_Mass_Criterion
+    {1431, 87, 156, 167, 1, 3673}, // MS_ProteomeDiscoverer_Xtract_Highest_Charge
+    {1432, 87, 156, 167, 1, 3677}, // MS_ProteomeDiscoverer_Xtract_Highest_MZ_OBSOLETE
+    {1433, 87, 156, 167, 1, 3681}, // MS_ProteomeDiscoverer_Xtract_Lowest_Charge
+    {1434, 87, 156, 167, 1, 3685}, // MS_ProteomeDiscoverer_Xtract_Lowest_MZ_OBSOLETE
+    {1435, 87, 156, 167, 1, 3689}, // MS_ProteomeDiscoverer_Xtract_Monoisotopic_Mass_Only
+    {1436, 87, 156, 167, 1, 3693}, // MS_ProteomeDiscoverer_Xtract_Overlapping_Remainder
+    {1437, 87, 156, 167, 1, 3697}, // MS_ProteomeDiscoverer_Xtract_Required_Fitting_Accuracy
+    {1438, 87, 156, 167, 1, 3701}, // MS_ProteomeDiscoverer_Xtract_Resolution_At_400
+    {1439, 87, 156, 167, 1, 3705}, // MS_ProteomeDiscoverer_Lowest_Charge_State
+    {1440, 87, 156, 167, 1, 3709}, // MS_ProteomeDiscoverer_Highest_Charge_State
+    {1441, 87, 156, 167, 1, 3713}, // MS_ProteomeDiscoverer_Spectrum_Score_Filter_Let_Pass_Above_Scores
+    {1442, 87, 156, 167, 1, 3717}, // MS_ProteomeDiscoverer_Dynamic_Modification
+    {1443, 87, 156, 167, 1, 3721}, // MS_ProteomeDiscoverer_Static_Modification
+    {1444, 87, 156, 167, 1, 3725}, // MS_ProteomeDiscoverer_Mascot_Decoy_Search_OBSOLETE
+    {1445, 87, 156, 167, 1, 3729}, // MS_ProteomeDiscoverer_Mascot_Error_tolerant_Search
+    {1446, 87, 156, 167, 1, 3733}, // MS_ProteomeDiscoverer_Mascot_Max_MGF_File_Size
+    {1447, 87, 156, 167, 1, 3737}, // MS_ProteomeDiscoverer_Mascot_Mascot_Server_URL
+    {1448, 87, 156, 167, 1, 3741}, // MS_ProteomeDiscoverer_Mascot_Number_of_attempts_to_submit_the_search
+    {1449, 87, 156, 167, 1, 3745}, // MS_ProteomeDiscoverer_Mascot_X_Static_Modification
+    {1450, 87, 156, 167, 1, 3749}, // MS_ProteomeDiscoverer_Mascot_User_Name_OBSOLETE
+    {1451, 87, 156, 167, 1, 3753}, // MS_ProteomeDiscoverer_Mascot_Time_interval_between_attempts_to_submit_a_search
+    {1452, 87, 156, 167, 1, 3757}, // MS_ProteomeDiscoverer_Enzyme_Name_OBSOLETE
+    {1453, 87, 156, 167, 1, 3761}, // MS_ProteomeDiscoverer_Fragment_Mass_Tolerance_OBSOLETE
+    {1454, 87, 156, 167, 1, 3765}, // MS_Mascot_Instrument
+    {1455, 87, 156, 167, 1, 3769}, // MS_ProteomeDiscoverer_Maximum_Missed_Cleavage_Sites
+    {1456, 87, 156, 167, 1, 3773}, // MS_ProteomeDiscoverer_Mascot_Peptide_CutOff_Score
+    {1457, 87, 156, 167, 1, 3777}, // MS_ProteomeDiscoverer_Precursor_Mass_Tolerance_OBSOLETE
+    {1458, 87, 156, 167, 1, 3781}, // MS_ProteomeDiscoverer_Mascot_Protein_CutOff_Score
+    {1459, 87, 156, 167, 1, 3785}, // MS_ProteomeDiscoverer_Protein_Database_OBSOLETE
+    {1460, 87, 156, 167, 1, 3789}, // MS_ProteomeDiscoverer_Mascot_Protein_Relevance_Factor
+    {1461, 87, 156, 167, 1, 3793}, // MS_ProteomeDiscoverer_Target_FDR_Relaxed
+    {1462, 87, 156, 167, 1, 3797}, // MS_ProteomeDiscoverer_Target_FDR_Strict
+    {1463, 87, 156, 167, 1, 3801}, // MS_ProteomeDiscoverer_Mascot_Taxonomy_OBSOLETE
+    {1464, 87, 156, 167, 1, 3805}, // MS_ProteomeDiscoverer_Use_Average_Precursor_Mass_OBSOLETE
+    {1465, 87, 156, 167, 1, 3809}, // MS_Mascot_use_MudPIT_scoring_OBSOLETE
+    {1466, 87, 156, 167, 1, 3813}, // MS_ProteomeDiscoverer_Absolute_XCorr_Threshold
+    {1467, 87, 156, 167, 1, 3817}, // MS_ProteomeDiscoverer_SEQUEST_Calculate_Probability_Score
+    {1468, 87, 156, 167, 1, 3821}, // MS_ProteomeDiscoverer_SEQUEST_CTerminal_Modification
+    {1469, 87, 156, 167, 1, 3825}, // MS_ProteomeDiscoverer_SEQUEST_Fragment_Ion_Cutoff_Percentage
+    {1470, 87, 156, 167, 1, 3829}, // MS_ProteomeDiscoverer_SEQUEST_Max_Identical_Modifications_Per_Peptide
+    {1471, 87, 156, 167, 1, 3833}, // MS_ProteomeDiscoverer_Max_Modifications_Per_Peptide
+    {1472, 87, 156, 167, 1, 3837}, // MS_ProteomeDiscoverer_SEQUEST_Maximum_Peptides_Considered
+    {1473, 87, 156, 167, 1, 3841}, // MS_ProteomeDiscoverer_Maximum_Peptides_Output
+    {1474, 87, 156, 167, 1, 3845}, // MS_ProteomeDiscoverer_Maximum_Protein_References_Per_Peptide
+    {1475, 87, 156, 167, 1, 3849}, // MS_ProteomeDiscoverer_SEQUEST_NTerminal_Modification
+    {1476, 87, 156, 167, 1, 3853}, // MS_ProteomeDiscoverer_Peptide_CTerminus
+    {1477, 87, 156, 167, 1, 3857}, // MS_ProteomeDiscoverer_Peptide_NTerminus
+    {1478, 87, 156, 167, 1, 3861}, // MS_ProteomeDiscoverer_SEQUEST_Peptide_Relevance_Factor
+    {1479, 87, 156, 167, 1, 3865}, // MS_ProteomeDiscoverer_Protein_Relevance_Threshold
+    {1480, 87, 156, 167, 1, 3869}, // MS_ProteomeDiscoverer_Search_Against_Decoy_Database_OBSOLETE
+    {1481, 87, 156, 167, 1, 3873}, // MS_ProteomeDiscoverer_SEQUEST_Use_Average_Fragment_Masses
+    {1482, 87, 156, 167, 1, 3877}, // MS_ProteomeDiscoverer_Use_Neutral_Loss_a_Ions
+    {1483, 87, 156, 167, 1, 3881}, // MS_ProteomeDiscoverer_Use_Neutral_Loss_b_Ions
+    {1484, 87, 156, 167, 1, 3885}, // MS_ProteomeDiscoverer_Use_Neutral_Loss_y_Ions
+    {1485, 87, 156, 167, 1, 3889}, // MS_ProteomeDiscoverer_Use_Neutral_Loss_z_Ions
+    {1486, 87, 156, 167, 1, 3893}, // MS_ProteomeDiscoverer_SEQUEST_Weight_of_a_Ions
+    {1487, 87, 156, 167, 1, 3897}, // MS_ProteomeDiscoverer_SEQUEST_Weight_of_b_Ions
+    {1488, 87, 156, 167, 1, 3901}, // MS_ProteomeDiscoverer_SEQUEST_Weight_of_c_Ions
+    {1489, 87, 156, 167, 1, 3905}, // MS_ProteomeDiscoverer_SEQUEST_Weight_of_d_Ions
+    {1490, 87, 156, 167, 1, 3909}, // MS_ProteomeDiscoverer_SEQUEST_Weight_of_v_Ions
+    {1491, 87, 156, 167, 1, 3913}, // MS_ProteomeDiscoverer_SEQUEST_Weight_of_w_Ions
+    {1492, 87, 156, 167, 1, 3917}, // MS_ProteomeDiscoverer_SEQUEST_Weight_of_x_Ions
+    {1493, 87, 156, 167, 1, 3921}, // MS_ProteomeDiscoverer_SEQUEST_Weight_of_y_Ions
+    {1494, 87, 156, 167, 1, 3925}, // MS_ProteomeDiscoverer_SEQUEST_Weight_of_z_Ions
+    {1495, 87, 156, 167, 1, 3929}, // MS_ProteomeDiscoverer_ZCore_Protein_Score_Cutoff
+    {1496, 87, 156, 167, 1, 3933}, // MS_ProteomeDiscoverer_Reporter_Ions_Quantizer_Integration_Method
+    {1497, 87, 156, 167, 1, 3937}, // MS_ProteomeDiscoverer_Reporter_Ions_Quantizer_Integration_Window_Tolerance
+    {1498, 87, 156, 167, 1, 3941}, // MS_ProteomeDiscoverer_Reporter_Ions_Quantizer_Quantitation_Method
+    {1499, 87, 156, 167, 1, 3945}, // MS_ProteomeDiscoverer_Spectrum_Exporter_Export_Format_OBSOLETE
+    {1500, 87, 156, 167, 1, 3949}, // MS_ProteomeDiscoverer_Spectrum_Exporter_File_name
+    {1501, 87, 156, 167, 1, 3953}, // MS_ProteomeDiscoverer_Search_Modifications_Only_For_Identified_Proteins
+    {1502, 87, 156, 167, 1, 3957}, // MS_ProteomeDiscoverer_SEQUEST_Std_High_Confidence_XCorr_Charge1
+    {1503, 87, 156, 167, 1, 3961}, // MS_ProteomeDiscoverer_SEQUEST_Std_High_Confidence_XCorr_Charge2
+    {1504, 87, 156, 167, 1, 3965}, // MS_ProteomeDiscoverer_SEQUEST_Std_High_Confidence_XCorr_Charge3
+    {1505, 87, 156, 167, 1, 3969}, // MS_ProteomeDiscoverer_SEQUEST_Std_High_Confidence_XCorr_Charge4
+    {1506, 87, 156, 167, 1, 3973}, // MS_ProteomeDiscoverer_SEQUEST_Std_Medium_Confidence_XCorr_Charge1
+    {1507, 87, 156, 167, 1, 3977}, // MS_ProteomeDiscoverer_SEQUEST_Std_Medium_Confidence_XCorr_Charge2
+    {1508, 87, 156, 167, 1, 3981}, // MS_ProteomeDiscoverer_SEQUEST_Std_Medium_Confidence_XCorr_Charge3
+    {1509, 87, 156, 167, 1, 3985}, // MS_ProteomeDiscoverer_SEQUEST_Std_Medium_Confidence_XCorr_Charge4
+    {1510, 87, 156, 167, 1, 3989}, // MS_ProteomeDiscoverer_SEQUEST_FT_High_Confidence_XCorr_Charge1
+    {1511, 87, 156, 167, 1, 3993}, // MS_ProteomeDiscoverer_SEQUEST_FT_High_Confidence_XCorr_Charge2
+    {1512, 87, 156, 167, 1, 3997}, // MS_ProteomeDiscoverer_SEQUEST_FT_High_Confidence_XCorr_Charge3
+    {1513, 87, 156, 167, 1, 4001}, // MS_ProteomeDiscoverer_SEQUEST_FT_High_Confidence_XCorr_Charge4
+    {1514, 87, 156, 167, 1, 4005}, // MS_ProteomeDiscoverer_SEQUEST_FT_Medium_Confidence_XCorr_Charge1
+    {1515, 87, 156, 167, 1, 4009}, // MS_ProteomeDiscoverer_SEQUEST_FT_Medium_Confidence_XCorr_Charge2
+    {1516, 87, 156, 167, 1, 4013}, // MS_ProteomeDiscoverer_SEQUEST_FT_Medium_Confidence_XCorr_Charge3
+    {1517, 87, 156, 167, 1, 4017}, // MS_ProteomeDiscoverer_SEQUEST_FT_Medium_Confidence_XCorr_Charge4
+    {1518, 87, 156, 167, 1, 4021}, // MS_ProteomeDiscoverer_1__Dynamic_Modification_OBSOLETE
+    {1519, 87, 156, 167, 1, 4025}, // MS_ProteomeDiscoverer_2__Dynamic_Modification_OBSOLETE
+    {1520, 87, 156, 167, 1, 4029}, // MS_ProteomeDiscoverer_3__Dynamic_Modification_OBSOLETE
+    {1521, 87, 156, 167, 1, 4033}, // MS_ProteomeDiscoverer_4__Dynamic_Modification_OBSOLETE
+    {1522, 87, 156, 167, 1, 4037}, // MS_ProteomeDiscoverer_Static_Modification_for_X
+    {1523, 87, 156, 167, 1, 4041}, // MS_ProteomeDiscoverer_Initial_minimal_peptide_probability
+    {1524, 87, 156, 167, 1, 4045}, // MS_ProteomeDiscoverer_Minimal_peptide_probability
+    {1525, 87, 156, 167, 1, 4049}, // MS_ProteomeDiscoverer_Minimal_peptide_weight
+    {1526, 87, 156, 167, 1, 4053}, // MS_ProteomeDiscoverer_Number_of_input1_spectra
+    {1527, 87, 156, 167, 1, 4057}, // MS_ProteomeDiscoverer_Number_of_input2_spectra
+    {1528, 87, 156, 167, 1, 4061}, // MS_ProteomeDiscoverer_Number_of_input3_spectra
+    {1529, 87, 156, 167, 1, 4065}, // MS_ProteomeDiscoverer_Number_of_input4_spectra
+    {1530, 87, 156, 167, 1, 4069}, // MS_ProteomeDiscoverer_Number_of_input5_spectra
+    {1531, 87, 156, 167, 1, 4073}, // MS_ProteomeDiscoverer_Number_of_predicted_correct_proteins
+    {1532, 87, 156, 167, 1, 4077}, // MS_ProteomeDiscoverer_Organism_OBSOLETE
+    {1533, 87, 156, 167, 1, 4081}, // MS_ProteomeDiscoverer_Reference_Database_OBSOLETE
+    {1534, 87, 156, 167, 1, 4085}, // MS_ProteomeDiscoverer_Residue_substitution_list
+    {1535, 87, 156, 167, 1, 4089}, // MS_ProteomeDiscoverer_Source_file_extension_OBSOLETE
+    {1536, 87, 156, 167, 1, 4093}, // MS_ProteomeDiscoverer_Source_Files_OBSOLETE
+    {1537, 87, 156, 167, 1, 4097}, // MS_ProteomeDiscoverer_Source_Files_old_OBSOLETE
+    {1538, 87, 156, 167, 1, 4101}, // MS_ProteomeDiscoverer_WinCyg_reference_database
+    {1539, 87, 156, 167, 1, 4105}, // MS_ProteomeDiscoverer_WinCyg_source_files
+    {1540, 87, 156, 167, 1, 4109}, // MS_LTQ_Orbitrap_Velos
+    {1541, 87, 156, 167, 1, 4112}, // MS_ProteomeDiscoverer_Mascot_Weight_of_A_Ions
+    {1542, 87, 156, 167, 1, 4116}, // MS_ProteomeDiscoverer_Mascot_Weight_of_B_Ions
+    {1543, 87, 156, 167, 1, 4120}, // MS_ProteomeDiscoverer_Mascot_Weight_of_C_Ions
+    {1544, 87, 156, 167, 1, 4124}, // MS_ProteomeDiscoverer_Mascot_Weight_of_D_Ions
+    {1545, 87, 156, 167, 1, 4128}, // MS_ProteomeDiscoverer_Mascot_Weight_of_V_Ions
+    {1546, 87, 156, 167, 1, 4132}, // MS_ProteomeDiscoverer_Mascot_Weight_of_W_Ions
+    {1547, 87, 156, 167, 1, 4136}, // MS_ProteomeDiscoverer_Mascot_Weight_of_X_Ions
+    {1548, 87, 156, 167, 1, 4140}, // MS_ProteomeDiscoverer_Mascot_Weight_of_Y_Ions
+    {1549, 87, 156, 167, 1, 4144}, // MS_ProteomeDiscoverer_Mascot_Weight_of_Z_Ions
+    {1550, 87, 156, 167, 1, 4148}, // MS_ProteomeDiscoverer_Spectrum_Selector_Use_New_Precursor_Reevaluation
+    {1551, 87, 156, 167, 1, 4152}, // MS_ProteomeDiscoverer_Spectrum_Selector_SN_Threshold_FTonly
+    {1552, 87, 156, 167, 1, 4156}, // MS_ProteomeDiscoverer_Mascot_Please_Do_not_Touch_this
+    {1553, 87, 156, 167, 1, 4160}, // MS_contact_phone_number
+    {1554, 87, 156, 167, 1, 4162}, // MS_contact_fax_number
+    {1555, 87, 156, 167, 1, 4164}, // MS_contact_toll_free_phone_number
+    {1556, 87, 156, 167, 1, 4166}, // MS_Mascot_SigThresholdType
+    {1557, 87, 156, 167, 1, 4170}, // MS_Mascot_ProteinGrouping
+    {1558, 87, 156, 167, 1, 4174}, // MS_Percolator_features
+    {1559, 87, 156, 167, 1, 4178}, // MS_ACQUITY_UPLC
+    {1560, 87, 156, 167, 1, 4180}, // MS_ACQUITY_UPLC_H_Class
+    {1561, 87, 156, 167, 1, 4182}, // MS_ACQUITY_UPLC_H_Class_Bio
+    {1562, 87, 156, 167, 1, 4184}, // MS_ACQUITY_UPLC_I_Class
+    {1563, 87, 156, 167, 1, 4186}, // MS_ACQUITY_UPLC_Systems_with_2D_Technology
+    {1564, 87, 156, 167, 1, 4188}, // MS_nanoACQUITY_UPLC
+    {1565, 87, 156, 167, 1, 4190}, // MS_nanoACQUITY_UPLC_System_with_Technology
+    {1566, 87, 156, 167, 1, 4192}, // MS_nanoACQUITY_UPLC_with_HDX_Technology
+    {1567, 87, 156, 167, 1, 4194}, // MS_TRIZAIC_UPLC_nanoTile
+    {1568, 87, 156, 167, 1, 4196}, // MS_GCT_Premier
+    {1569, 87, 156, 167, 1, 4198}, // MS_MALDI_Synapt_G2_HDMS
+    {1570, 87, 156, 167, 1, 4200}, // MS_MALDI_Synapt_G2_MS
+    {1571, 87, 156, 167, 1, 4202}, // MS_MALDI_Synapt_G2_S_HDMS
+    {1572, 87, 156, 167, 1, 4204}, // MS_MALDI_Synapt_G2_S_MS
+    {1573, 87, 156, 167, 1, 4206}, // MS_MALDI_Synapt_HDMS
+    {1574, 87, 156, 167, 1, 4208}, // MS_MALDI_Synapt_MS
+    {1575, 87, 156, 167, 1, 4210}, // MS_Synapt_G2_HDMS
+    {1576, 87, 156, 167, 1, 4212}, // MS_Synapt_G2_MS
+    {1577, 87, 156, 167, 1, 4214}, // MS_Synapt_G2_S_HDMS
+    {1578, 87, 156, 167, 1, 4216}, // MS_Synapt_G2_S_MS
+    {1579, 87, 156, 167, 1, 4218}, // MS_Synapt_HDMS
+    {1580, 87, 156, 167, 1, 4220}, // MS_Synapt_MS
+    {1581, 87, 156, 167, 1, 4222}, // MS_Xevo_G2_Q_Tof
+    {1582, 87, 156, 167, 1, 4224}, // MS_Xevo_G2_Tof
+    {1583, 87, 156, 167, 1, 4226}, // MS_Xevo_Q_Tof
+    {1584, 87, 156, 167, 1, 4228}, // MS_3100
+    {1585, 87, 156, 167, 1, 4230}, // MS_Acquity_SQD
+    {1586, 87, 156, 167, 1, 4232}, // MS_Acquity_TQD
+    {1587, 87, 156, 167, 1, 4234}, // MS_Quattro_micro_GC
+    {1588, 87, 156, 167, 1, 4236}, // MS_Xevo_TQ_MS
+    {1589, 87, 156, 167, 1, 4238}, // MS_Xevo_TQD
+    {1590, 87, 156, 167, 1, 4240}, // MS_Xevo_TQ_S
+    {1591, 87, 156, 167, 1, 4242}, // MS_Mascot_PreferredTaxonomy
+    {1592, 87, 156, 167, 1, 4246}, // MS_Empower
+    {1595, 87, 156, 167, 1, 4250}, // MS_Unify
+    {1598, 87, 156, 167, 1, 4254}, // MS_travelling_wave_ion_mobility_mass_spectrometer_OBSOLETE
+    {1598, 87, 156, 168, 1, 4254}, // MS_LECO_software
+    {1599, 87, 156, 168, 1, 4255}, // MS_ChromaTOF_software
+    {1603, 87, 156, 168, 1, 4260}, // MS_LECO_instrument_model
+    {1604, 87, 156, 168, 1, 4261}, // MS_Pegasus_HRT
+    {1605, 87, 156, 168, 1, 4263}, // MS_Citius_HRT
+    {1606, 87, 156, 168, 1, 4265}, // MS_Pegasus
+    {1607, 87, 156, 168, 1, 4267}, // MS_TruTOF
+    {1608, 87, 156, 168, 1, 4269}, // MS_quantification_datatype
+    {1609, 87, 156, 168, 1, 4270}, // MS_quantification_object_attribute
+    {1610, 87, 156, 168, 1, 4271}, // MS_study_variable_attribute
+    {1611, 87, 156, 168, 1, 4273}, // MS_technical_replicate
+    {1612, 87, 156, 168, 1, 4276}, // MS_biological_replicate
+    {1613, 87, 156, 168, 1, 4279}, // MS_experimental_condition__case_
+    {1614, 87, 156, 168, 1, 4282}, // MS_experimental_condition__control_
+    {1615, 87, 156, 168, 1, 4285}, // MS_experimental_condition__disease_
+    {1616, 87, 156, 168, 1, 4288}, // MS_experimental_condition__healthy_
+    {1617, 87, 156, 168, 1, 4291}, // MS_generic_experimental_condition
+    {1618, 87, 156, 168, 1, 4294}, // MS_time_series__time_point_X
+    {1619, 87, 156, 168, 1, 4297}, // MS_dilution_series__concentration_X
+    {1620, 87, 156, 168, 1, 4300}, // MS_raw_file_attribute
+    {1621, 87, 156, 168, 1, 4302}, // MS_one_sample_run
+    {1622, 87, 156, 168, 1, 4305}, // MS_two_sample_run
+    {1623, 87, 156, 168, 1, 4308}, // MS_three_sample_run
+    {1624, 87, 156, 168, 1, 4311}, // MS_four_sample_run
+    {1625, 87, 156, 168, 1, 4314}, // MS_eight_sample_run
+    {1626, 87, 156, 168, 1, 4317}, // MS_raw_files_group_attribute
+    {1627, 87, 156, 168, 1, 4319}, // MS_merge_of_runs_of_1D_gel_bands
+    {1628, 87, 156, 168, 1, 4322}, // MS_feature_list_attribute
+    {1629, 87, 156, 168, 1, 4324}, // MS_mass_trace_reporting__rectangles
+    {1630, 87, 156, 168, 1, 4327}, // MS_mass_trace_reporting__polygons
+    {1631, 87, 156, 168, 1, 4330}, // MS_feature_attribute
+    {1632, 87, 156, 168, 1, 4332}, // MS_SRM_transition_ID
+    {1633, 87, 156, 168, 1, 4335}, // MS_Progenesis_LC_MS
+    {1634, 87, 156, 168, 1, 4338}, // MS_SILACAnalyzer
+    {1636, 87, 156, 168, 1, 4344}, // MS_quantitation_software_comment_or_customizations
+    {1637, 87, 156, 168, 1, 4345}, // MS_quantitation_analysis_summary
+    {1638, 87, 156, 168, 1, 4346}, // MS_LC_MS_label_free_quantitation_analysis
+    {1639, 87, 156, 168, 1, 4348}, // MS_SILAC_quantitation_analysis
+    {1640, 87, 156, 168, 1, 4350}, // MS_spectral_counting_quantitation_analysis
+    {1641, 87, 156, 168, 1, 4352}, // MS_iTRAQ_quantitation_analysis
+    {1642, 87, 156, 168, 1, 4355}, // MS_SRM_quantitation_analysis
+    {1643, 87, 156, 168, 1, 4357}, // MS_metabolic_labeling_14N___15N_quantitation_analysis
+    {1644, 87, 156, 168, 1, 4359}, // MS_LC_MS_feature_intensity
+    {1645, 87, 156, 168, 1, 4361}, // MS_LC_MS_feature_volume
+    {1646, 87, 156, 168, 1, 4363}, // MS_peptide_PSM_count
+    {1647, 87, 156, 168, 1, 4365}, // MS_MS1_feature_maximum_intensity
+    {1648, 87, 156, 168, 1, 4367}, // MS_MS1_feature_area
+    {1649, 87, 156, 168, 1, 4369}, // MS_peak_area_OBSOLETE
+    {1650, 87, 156, 168, 1, 4371}, // MS_isotopic_pattern_area
+    {1651, 87, 156, 168, 1, 4373}, // MS_reporter_ion_intensity
+    {1652, 87, 156, 168, 1, 4375}, // MS_simple_ratio_of_two_values
+    {1653, 87, 156, 168, 1, 4378}, // MS_sum_of_MatchedFeature_values_OBSOLETE
+    {1654, 87, 156, 168, 1, 4380}, // MS_normalized_peptide_value
+    {1655, 87, 156, 168, 1, 4382}, // MS_protein_value__sum_of_peptide_values
+    {1656, 87, 156, 168, 1, 4384}, // MS_normalized_protein_value
+    {1657, 87, 156, 168, 1, 4386}, // MS_max_fold_change
+    {1658, 87, 156, 168, 1, 4388}, // MS_ANOVA_p_value
+    {1659, 87, 156, 168, 1, 4391}, // MS_t_test_p_value
+    {1660, 87, 156, 168, 1, 4394}, // MS_reporter_ion_raw_value
+    {1661, 87, 156, 168, 1, 4396}, // MS_reporter_ion_normalized_value
+    {1662, 87, 156, 168, 1, 4398}, // MS_XIC_area
+    {1663, 87, 156, 168, 1, 4400}, // MS_normalized_XIC_area
+    {1664, 87, 156, 168, 1, 4402}, // MS_protein_value__mean_of_peptide_ratios
+    {1665, 87, 156, 168, 1, 4404}, // MS_quantification_data_processing
+    {1665, 88, 156, 168, 1, 4404}, // MS_normalization_to_mean_of_sum_of_all_proteins
+    {1666, 88, 156, 168, 1, 4405}, // MS_quantile_normalization__proteins
+    {1667, 88, 156, 168, 1, 4406}, // MS_quantile_normalization__peptides
+    {1668, 88, 156, 168, 1, 4407}, // MS_Progenesis_automatic_alignment
+    {1669, 88, 156, 168, 1, 4408}, // MS_Progenesis_manual_alignment
+    {1670, 88, 156, 168, 1, 4409}, // MS_Progenesis_normalization
+    {1671, 88, 156, 168, 1, 4410}, // MS_distinct_peptide_level_q_value
+    {1672, 88, 157, 168, 1, 4415}, // MS_protein_level_q_value
+    {1673, 88, 158, 168, 1, 4421}, // MS_peptide_sequence_level_p_value
+    {1674, 88, 159, 168, 1, 4427}, // MS_protein_level_p_value
+    {1675, 88, 160, 168, 1, 4433}, // MS_peptide_sequence_level_e_value
+    {1676, 88, 161, 168, 1, 4439}, // MS_protein_level_e_value
+    {1677, 88, 162, 168, 1, 4445}, // MS_FDRScore_OBSOLETE
+    {1679, 88, 162, 168, 1, 4453}, // MS_modification_motif
+    {1680, 88, 162, 168, 1, 4455}, // MS_modification_probability
+    {1681, 88, 162, 168, 1, 4457}, // MS_ChromaTOF_HRT_software
+    {1685, 88, 162, 168, 1, 4462}, // MS_MALDI_Solutions_Microbial_Identification
+    {1689, 88, 162, 168, 1, 4468}, // MS_offset_voltage
+    {1690, 88, 163, 168, 1, 4469}, // MS_in_source_collision_induced_dissociation
+    {1691, 88, 163, 168, 1, 4470}, // MS_mz5_format
+    {1692, 88, 163, 168, 1, 4472}, // MS_transition_validation_attribute
+    {1692, 89, 163, 168, 1, 4472}, // MS_coefficient_of_variation
+    {1693, 89, 163, 168, 1, 4473}, // MS_signal_to_noise_ratio
+    {1694, 89, 163, 168, 1, 4474}, // MS_command_line_parameters
+    {1695, 89, 163, 168, 1, 4475}, // MS_SQID
+    {1697, 89, 163, 168, 1, 4478}, // MS_SQID_score
+    {1698, 89, 163, 168, 1, 4485}, // MS_SQID_deltaScore
+    {1699, 89, 163, 168, 1, 4492}, // MS_SQID_protein_score
+    {1700, 89, 163, 168, 1, 4499}, // MS_Progenesis_protein_normalised_abundance
+    {1701, 89, 163, 168, 1, 4501}, // MS_Progenesis_peptide_normalised_abundance
+    {1702, 89, 163, 168, 1, 4503}, // MS_Progenesis_protein_raw_abundance
+    {1703, 89, 163, 168, 1, 4505}, // MS_Progenesis_peptide_raw_abundance
+    {1704, 89, 163, 168, 1, 4507}, // MS_Progenesis_confidence_score
+    {1705, 89, 163, 168, 1, 4509}, // MS_Progenesis_peptide_count
+    {1706, 89, 163, 168, 1, 4511}, // MS_Progenesis_feature_intensity
+    {1707, 89, 163, 168, 1, 4513}, // MS_MaxQuant_peptide_counts__unique_
+    {1708, 89, 163, 168, 1, 4515}, // MS_MaxQuant_peptide_counts__all_
+    {1709, 89, 163, 168, 1, 4517}, // MS_MaxQuant_peptide_counts__razor_unique_
+    {1710, 89, 163, 168, 1, 4519}, // MS_MaxQuant_sequence_length
+    {1711, 89, 163, 168, 1, 4521}, // MS_MaxQuant_PEP
+    {1712, 89, 163, 168, 1, 4523}, // MS_MaxQuant_LFQ_intensity
+    {1713, 89, 163, 168, 1, 4525}, // MS_MaxQuant_feature_intensity
+    {1714, 89, 163, 168, 1, 4527}, // MS_MaxQuant_MS_MS_count
+    {1715, 89, 163, 168, 1, 4529}, // MS_emPAI_value
+    {1716, 89, 163, 168, 1, 4531}, // MS_APEX_value
+    {1717, 89, 163, 168, 1, 4533}, // MS_retention_time_window_width
+    {1718, 89, 165, 168, 1, 4534}, // MS_ISQ
+    {1719, 89, 165, 168, 1, 4537}, // MS_Velos_Plus
+    {1720, 89, 165, 168, 1, 4540}, // MS_LTQ_Orbitrap_Elite
+    {1721, 89, 165, 168, 1, 4543}, // MS_Q_Exactive
+    {1722, 89, 165, 168, 1, 4546}, // MS_PinPoint
+    {1725, 89, 165, 168, 1, 4550}, // MS_S_lens_voltage
+    {1726, 89, 166, 168, 1, 4551}, // MS_pymzML
+    {1727, 89, 166, 168, 1, 4553}, // MS_leukocyte_elastase
+    {1728, 89, 167, 168, 1, 4556}, // MS_proline_endopeptidase
+    {1729, 89, 168, 168, 1, 4559}, // MS_glutamyl_endopeptidase
+    {1730, 89, 169, 170, 1, 4562}, // MS_2_iodobenzoate
+    {1731, 89, 170, 170, 1, 4565}, // MS_ProteomeXchange_accession_number
+    {1732, 89, 170, 170, 1, 4566}, // MS_ProteomeXchange_accession_number_version_number
+    {1733, 89, 170, 170, 1, 4567}, // MS_Digital_Object_Identifier__DOI_
+    {1734, 89, 171, 171, 1, 4568}, // MS_external_reference_keyword
+    {1735, 89, 171, 171, 1, 4569}, // MS_journal_article_keyword
+    {1736, 89, 171, 171, 1, 4571}, // MS_submitter_keyword
+    {1737, 89, 171, 171, 1, 4573}, // MS_curator_keyword
+    {1738, 89, 171, 171, 1, 4575}, // MS_Tranche_file_hash
+    {1739, 89, 171, 171, 1, 4576}, // MS_Tranche_project_hash
+    {1740, 89, 171, 171, 1, 4577}, // MS_PRIDE_experiment_URI
+    {1741, 89, 171, 171, 1, 4578}, // MS_PRIDE_project_URI
+    {1742, 89, 171, 171, 1, 4579}, // MS_source_interface
+    {1742, 90, 171, 171, 1, 4579}, // MS_source_interface_model
+    {1742, 91, 171, 171, 1, 4579}, // MS_source_sprayer
+    {1742, 92, 171, 171, 1, 4579}, // MS_source_sprayer_type
+    {1742, 93, 171, 171, 1, 4579}, // MS_source_sprayer_manufacturer
+    {1742, 94, 171, 171, 1, 4579}, // MS_source_sprayer_model
+    {1742, 95, 171, 171, 1, 4579}, // MS_sample_plate
+    {1742, 96, 171, 171, 1, 4579}, // MS_sample_plate_type
+    {1742, 97, 171, 171, 1, 4579}, // MS_stainless_steel_plate
+    {1743, 97, 171, 171, 1, 4580}, // MS_coated_glass_plate
+    {1744, 97, 171, 171, 1, 4581}, // MS_electrospray_supply_type
+    {1744, 98, 171, 171, 1, 4581}, // MS_static_supply_electrospray
+    {1745, 98, 171, 171, 1, 4582}, // MS_fed_supply_electrospray
+    {1746, 98, 171, 171, 1, 4583}, // MS_Collision_cell_exit_potential
+    {1747, 98, 172, 172, 1, 4584}, // MS_Pegasus_4D
+    {1748, 98, 172, 172, 1, 4586}, // MS_PEAKS_Studio
+    {1751, 98, 172, 172, 1, 4591}, // MS_PEAKS_Online
+    {1754, 98, 172, 172, 1, 4596}, // MS_PEAKS_Node
+    {1757, 98, 172, 172, 1, 4601}, // MS_BSI_software
+    {1758, 98, 172, 172, 1, 4602}, // MS_PEAKS_peptideScore
+    {1759, 98, 172, 172, 1, 4609}, // MS_PEAKS_proteinScore
+    {1760, 98, 172, 172, 1, 4616}, // MS_ZCore_probScore
+    {1761, 98, 172, 172, 1, 4623}, // MS_source_interface_manufacturer
+    {1761, 99, 172, 172, 1, 4623}, // MS_acquisition_parameter
+    {1761, 100, 172, 172, 1, 4623}, // MS_no_cleavage
+    {1762, 100, 172, 172, 1, 4626}, // MS_unspecific_cleavage
+    {1763, 100, 172, 172, 1, 4629}, // MS______ALIV_____P_
+    {1764, 100, 172, 172, 1, 4631}, // MS______HKR_P____P_
+    {1765, 100, 172, 172, 1, 4633}, // MS_______E_E_
+    {1766, 100, 172, 172, 1, 4635}, // MS_____W_
+    {1767, 100, 172, 172, 1, 4637}, // MS_peptide_spectrum_match_scoring_algorithm
+    {1767, 101, 172, 172, 1, 4637}, // MS_Mascot_C13_counts
+    {1768, 101, 172, 172, 1, 4641}, // MS_ProteinExtractor_Weighting
+    {1769, 101, 172, 172, 1, 4645}, // MS_ProteinScape_second_round_Mascot
+    {1770, 101, 172, 172, 1, 4649}, // MS_ProteinScape_second_round_Phenyx
+    {1771, 101, 172, 172, 1, 4653}, // MS_product_ion_mobility
+    {1772, 101, 172, 172, 1, 4658}, // MS_product_ion_drift_time_OBSOLETE
+    {1773, 101, 173, 172, 1, 4661}, // MS_PTM_localization_PSM_level_statistic
+    {1774, 101, 173, 172, 1, 4665}, // MS_phosphoRS_score
+    {1775, 101, 174, 172, 1, 4670}, // MS_phosphoRS_sequence_probability
+    {1776, 101, 175, 172, 1, 4675}, // MS_phosphoRS_site_probability
+    {1777, 101, 176, 172, 1, 4680}, // MS_PTM_scoring_algorithm_version
+    {1778, 101, 176, 172, 1, 4681}, // MS_DeBunker
+    {1779, 101, 176, 172, 1, 4683}, // MS_DeBunker_score
+    {1781, 101, 177, 172, 1, 4693}, // MS_delta_m_z
+    {1782, 101, 180, 173, 1, 4694}, // MS_delta_M
+    {1783, 101, 183, 174, 1, 4695}, // MS_MSQuant
+    {1784, 101, 183, 174, 1, 4697}, // MS_MSQuant_PTM_score
+    {1785, 101, 184, 174, 1, 4702}, // MS_MaxQuant_PTM_Score
+    {1786, 101, 185, 174, 1, 4707}, // MS_MaxQuant_Phospho__STY__Probabilities
+    {1787, 101, 186, 174, 1, 4712}, // MS_MaxQuant_Phospho__STY__Score_Diffs
+    {1788, 101, 186, 174, 1, 4717}, // MS_MaxQuant_P_site_localization_probability
+    {1789, 101, 187, 174, 1, 4722}, // MS_MaxQuant_PTM_Delta_Score
+    {1790, 101, 188, 174, 1, 4727}, // MS_Ascore_software
+    {1791, 101, 188, 174, 1, 4729}, // MS_Ascore
+    {1792, 101, 189, 174, 1, 4734}, // MS_H_Score
+    {1793, 101, 190, 174, 1, 4739}, // MS_vacuum_drying_MALDI_sample_preparation
+    {1794, 101, 190, 174, 1, 4740}, // MS_crushed_crystal_MALDI_sample_preparation
+    {1795, 101, 190, 174, 1, 4741}, // MS_fast_evaporation_MALDI_sample_preparation
+    {1796, 101, 190, 174, 1, 4742}, // MS_overlayer_MALDI_sample_preparation
+    {1797, 101, 190, 174, 1, 4743}, // MS_sandwich_MALDI_sample_preparation
+    {1798, 101, 190, 174, 1, 4744}, // MS_spin_coating_MALDI_sample_preparation
+    {1799, 101, 190, 174, 1, 4745}, // MS_quick_and_dirty_MALDI_sample_preparation
+    {1800, 101, 190, 174, 1, 4746}, // MS_top_hat_baseline_reduction
+    {1801, 101, 190, 174, 1, 4749}, // MS_convex_hull_baseline_reduction
+    {1802, 101, 190, 174, 1, 4752}, // MS_median_baseline_reduction
+    {1803, 101, 190, 174, 1, 4755}, // MS_wavelet_transformation_smoothing
+    {1804, 101, 190, 174, 1, 4758}, // MS_sophisticated_numerical_annotation_procedure
+    {1805, 101, 190, 175, 1, 4762}, // MS_area_normalization
+    {1806, 101, 190, 175, 1, 4765}, // MS_LIFT
+    {1807, 101, 190, 175, 1, 4766}, // MS_MS1_label_based_raw_feature_quantitation
+    {1808, 101, 190, 175, 1, 4769}, // MS_MS1_label_based_peptide_level_quantitation
+    {1809, 101, 190, 175, 1, 4772}, // MS_MS1_label_based_protein_level_quantitation
+    {1810, 101, 190, 175, 1, 4775}, // MS_MS1_label_based_proteingroup_level_quantitation
+    {1811, 101, 190, 175, 1, 4778}, // MS_iRT_retention_time_normalization_standard
+    {1812, 101, 190, 175, 1, 4780}, // MS_SRM_transition_type
+    {1812, 102, 190, 176, 1, 4780}, // MS_target_SRM_transition
+    {1813, 102, 190, 177, 1, 4781}, // MS_decoy_SRM_transition
+    {1814, 102, 190, 178, 1, 4782}, // MS_isobaric_label_quantitation_analysis
+    {1815, 102, 190, 178, 1, 4784}, // MS_TMT_quantitation_analysis
+    {1817, 102, 190, 178, 1, 4787}, // MS_desorption_electrospray_ionization
+    {1818, 102, 190, 179, 1, 4789}, // MS_Mascot_PTM_site_assignment_confidence
+    {1819, 102, 191, 179, 1, 4794}, // MS_collision_energy_ramp_start
+    {1820, 102, 192, 179, 1, 4796}, // MS_collision_energy_ramp_end
+    {1821, 102, 193, 179, 1, 4798}, // MS_spectral_count_peptide_level_quantitation
+    {1822, 102, 193, 179, 1, 4801}, // MS_spectral_count_protein_level_quantitation
+    {1823, 102, 193, 179, 1, 4804}, // MS_spectral_count_proteingroup_level_quantitation
+    {1824, 102, 193, 179, 1, 4807}, // MS_MS1_label_based_analysis
+    {1825, 102, 193, 179, 1, 4809}, // MS_label_free_raw_feature_quantitation
+    {1826, 102, 193, 179, 1, 4812}, // MS_label_free_peptide_level_quantitation
+    {1827, 102, 193, 179, 1, 4815}, // MS_label_free_protein_level_quantitation
+    {1828, 102, 193, 179, 1, 4818}, // MS_label_free_proteingroup_level_quantitation
+    {1829, 102, 193, 179, 1, 4821}, // MS_MS2_tag_based_analysis
+    {1830, 102, 193, 179, 1, 4823}, // MS_MS2_tag_based_feature_level_quantitation
+    {1831, 102, 193, 179, 1, 4826}, // MS_MS2_tag_based_peptide_level_quantitation
+    {1832, 102, 193, 179, 1, 4829}, // MS_MS2_tag_based_protein_level_quantitation
+    {1833, 102, 193, 179, 1, 4832}, // MS_MS2_tag_based_proteingroup_level_quantitation
+    {1834, 102, 193, 179, 1, 4835}, // MS_nucleic_acid_base_modification
+    {1835, 102, 193, 179, 1, 4836}, // MS_original_nucleic_acid_sequence
+    {1836, 102, 193, 179, 1, 4837}, // MS_modified_nucleic_acid_sequence
+    {1837, 102, 193, 179, 1, 4838}, // MS_PASSEL_transition_group_browser_URI
+    {1838, 102, 193, 179, 1, 4839}, // MS_PeptideAtlas_dataset_URI
+    {1839, 102, 193, 179, 1, 4840}, // MS_contact_role
+    {1840, 102, 193, 179, 1, 4842}, // MS_first_author
+    {1841, 102, 193, 179, 1, 4845}, // MS_senior_author
+    {1842, 102, 193, 179, 1, 4848}, // MS_co_author
+    {1843, 102, 193, 179, 1, 4851}, // MS_dataset_submitter
+    {1844, 102, 193, 179, 1, 4854}, // MS_unlabeled_sample
+    {1845, 102, 193, 180, 1, 4856}, // MS_inlet_attribute
+    {1846, 103, 193, 180, 1, 4857}, // MS_inlet_temperature
+    {1848, 103, 195, 180, 1, 4860}, // MS_source_temperature
+    {1849, 103, 197, 180, 1, 4861}, // MS_modulation_time
+    {1850, 103, 199, 180, 1, 4863}, // MS_ProteinProspector
+    {1851, 103, 199, 180, 1, 4865}, // MS_ProteinProspector_score
+    {1852, 103, 199, 180, 1, 4872}, // MS_ProteinProspector_expectation_value
+    {1853, 103, 199, 180, 1, 4879}, // MS_native_source_path
+    {1854, 103, 199, 180, 1, 4880}, // MS_MS_GF
+    {1855, 103, 199, 180, 1, 4882}, // MS_MS_GF_
+    {1856, 103, 199, 181, 1, 4884}, // MS_MS_GF_RawScore
+    {1857, 103, 199, 181, 1, 4891}, // MS_MS_GF_DeNovoScore
+    {1858, 103, 199, 181, 1, 4898}, // MS_MS_GF_Energy
+    {1859, 103, 199, 181, 1, 4905}, // MS_MS_GF_SpecEValue
+    {1861, 103, 200, 181, 1, 4913}, // MS_MS_GF_EValue
+    {1863, 103, 201, 181, 1, 4921}, // MS_MS_GF_QValue
+    {1865, 103, 201, 181, 1, 4929}, // MS_MS_GF_PepQValue
+    {1866, 103, 201, 181, 1, 4936}, // MS_MS_GF_PEP
+    {1867, 103, 201, 181, 1, 4943}, // MS_modification_specificity_protein_N_term
+    {1868, 103, 201, 181, 1, 4945}, // MS_modification_specificity_protein_C_term
+    {1869, 103, 201, 181, 1, 4947}, // MS_Microsoft_Excel
+    {1870, 103, 201, 181, 1, 4950}, // MS_database_UniProtKB_TrEMBL
+    {1871, 103, 201, 181, 1, 4954}, // MS_decoy_DB_from_UniProtKB_TrEMBL_OBSOLETE
+    {1871, 103, 201, 181, 1, 4954}, // MS_metabolic_labelling__natural_N__mainly_14N_
+    {1872, 103, 201, 181, 1, 4955}, // MS_FindPairs
+    {1873, 103, 201, 181, 1, 4958}, // MS_peptide_consensus_RT
+    {1874, 103, 201, 181, 1, 4960}, // MS_peptide_consensus_m_z
+    {1875, 103, 201, 181, 1, 4962}, // MS_ratio_calculation_method
+    {1876, 103, 201, 181, 1, 4964}, // MS_protein_value__median_of_peptide_ratios
+    {1877, 103, 201, 181, 1, 4966}, // MS_metabolic_labelling__heavy_N__mainly_15N_
+    {1878, 103, 201, 181, 1, 4967}, // MS_metabolic_labelling_purity
+    {1879, 103, 201, 181, 1, 4968}, // MS_t_test
+    {1880, 103, 201, 181, 1, 4969}, // MS_ANOVA_test
+    {1881, 103, 201, 181, 1, 4970}, // MS_p_value
+    {1882, 103, 202, 181, 1, 4972}, // MS_mzIdentML_format
+    {1883, 103, 202, 181, 1, 4974}, // MS_quantification_file_format
+    {1884, 103, 202, 181, 1, 4975}, // MS_mzQuantML_format
+    {1885, 103, 202, 181, 1, 4977}, // MS_PAnalyzer
+    {1886, 103, 202, 181, 1, 4979}, // MS_impact
+    {1887, 103, 202, 181, 1, 4982}, // MS_ProteomeDiscoverer_1__Static_Modification_OBSOLETE
+    {1888, 103, 202, 181, 1, 4986}, // MS_ProteomeDiscoverer_2__Static_Modification_OBSOLETE
+    {1889, 103, 202, 181, 1, 4990}, // MS_ProteomeDiscoverer_Spectrum_Selector_Precursor_Clipping_Range_Before
+    {1890, 103, 203, 181, 1, 4994}, // MS_ProteomeDiscoverer_Spectrum_Selector_Precursor_Clipping_Range_After
+    {1891, 103, 204, 181, 1, 4998}, // MS_first_column_elution_time
+    {1892, 103, 206, 181, 1, 5000}, // MS_second_column_elution_time
+    {1893, 103, 208, 181, 1, 5002}, // MS_multidimensional_chromatography_modulation_description
+    {1894, 103, 208, 181, 1, 5004}, // MS_two_dimensional_gas_chromatography_with_fixed_modulation_time
+    {1895, 103, 208, 181, 1, 5007}, // MS_two_dimensional_gas_chromatography_with_discrete_modulation_time_steps
+    {1896, 103, 208, 181, 1, 5010}, // MS_two_dimensional_liquid_chromatography_with_fixed_modulation_time
+    {1897, 103, 208, 181, 1, 5013}, // MS_two_dimensional_liquid_chromatography_with_discrete_modulation_time_steps
+    {1898, 103, 208, 181, 1, 5016}, // MS_ProteomeDiscoverer_Peptide_Without_Protein_XCorr_Threshold
+    {1899, 103, 208, 181, 1, 5020}, // MS_Calculate_Probability_Scores
+    {1900, 103, 208, 181, 1, 5023}, // MS_ProteomeDiscoverer_Maximum_Delta_Cn
+    {1901, 103, 208, 181, 1, 5027}, // MS_Percolator_Validation_based_on
+    {1902, 103, 208, 181, 1, 5031}, // MS_search_engine_input_parameter
+    {1903, 103, 208, 181, 1, 5032}, // MS_common_search_engine_input_parameter
+    {1904, 103, 208, 181, 1, 5034}, // MS_Mascot_input_parameter
+    {1905, 103, 208, 181, 1, 5037}, // MS_SEQUEST_input_parameter
+    {1906, 103, 208, 181, 1, 5040}, // MS_Phenyx_input_parameter
+    {1907, 103, 208, 181, 1, 5043}, // MS_ProteinExtractor_input_parameter
+    {1908, 103, 208, 181, 1, 5046}, // MS_OMSSA_input_parameter
+    {1909, 103, 208, 181, 1, 5049}, // MS_ProteinScape_input_parameter
+    {1910, 103, 208, 181, 1, 5052}, // MS_ProteomeDiscoverer_input_parameter
+    {1911, 103, 208, 181, 1, 5055}, // MS_software_input_parameter
+    {1912, 103, 208, 181, 1, 5056}, // MS_common_software_input_parameter
+    {1913, 103, 208, 181, 1, 5058}, // MS_software_specific_input_parameter
+    {1914, 103, 208, 181, 1, 5060}, // MS_Scaffold_input_parameter
+    {1915, 103, 208, 181, 1, 5063}, // MS_Percolator_input_parameter
+    {1916, 103, 208, 181, 1, 5066}, // MS_higher_score_better
+    {1916, 104, 208, 181, 1, 5066}, // MS_lower_score_better
+    {1916, 105, 208, 181, 1, 5066}, // MS_assay_attribute
+    {1917, 105, 208, 181, 1, 5068}, // MS_assay_label_attribute
+    {1918, 105, 208, 181, 1, 5070}, // MS_protein_group_list_attribute
+    {1919, 105, 208, 181, 1, 5072}, // MS_protein_group_attribute
+    {1920, 105, 208, 181, 1, 5074}, // MS_protein_list_attribute
+    {1921, 105, 208, 181, 1, 5076}, // MS_peptide_consensus_list_attribute
+    {1922, 105, 208, 181, 1, 5078}, // MS_peptide_consensus_attribute
+    {1923, 105, 208, 181, 1, 5080}, // MS_small_molecule_list_attribute
+    {1924, 105, 208, 181, 1, 5082}, // MS_small_molecule_attribute
+    {1925, 105, 208, 181, 1, 5084}, // MS_small_molecule_modification_attribute
+    {1926, 105, 208, 181, 1, 5086}, // MS_experiment_name
+    {1927, 105, 208, 181, 1, 5088}, // MS_spectral_count_feature
+    {1928, 105, 208, 181, 1, 5091}, // MS_counts_reporting
+    {1929, 105, 208, 181, 1, 5094}, // MS_x_Tracker
+    {1930, 105, 208, 181, 1, 5097}, // MS_ProteoSuite
+    {1931, 105, 208, 181, 1, 5100}, // MS_combined_FDRScore_OBSOLETE
+    {1933, 105, 208, 181, 1, 5108}, // MS_database_UniProtKB
+    {1934, 105, 208, 181, 1, 5111}, // MS_identification_file_attribute
+    {1935, 105, 208, 181, 1, 5113}, // MS_method_file_format
+    {1936, 105, 208, 181, 1, 5114}, // MS_ITRAQAnalyzer
+    {1938, 105, 208, 181, 1, 5120}, // MS_identification_file_format
+    {1939, 105, 208, 181, 1, 5121}, // MS_TOPP_noise_filter
+    {1940, 105, 208, 181, 1, 5125}, // MS_TOPP_NoiseFilterGaussian
+    {1941, 105, 208, 181, 1, 5130}, // MS_TOPP_NoiseFilterSGolay
+    {1942, 105, 208, 181, 1, 5135}, // MS_TOPP_peak_picker
+    {1943, 105, 208, 181, 1, 5139}, // MS_TOPP_PeakPickerHiRes
+    {1944, 105, 208, 181, 1, 5144}, // MS_TOPP_PeakPickerWavelet
+    {1945, 105, 208, 181, 1, 5149}, // MS_TOPP_spectra_filter
+    {1946, 105, 208, 181, 1, 5153}, // MS_TOPP_SpectraFilterBernNorm
+    {1947, 105, 208, 181, 1, 5158}, // MS_TOPP_SpectraFilterMarkerMower
+    {1948, 105, 208, 181, 1, 5163}, // MS_TOPP_SpectraFilterNLargest
+    {1949, 105, 208, 181, 1, 5168}, // MS_TOPP_SpectraFilterNormalizer
+    {1950, 105, 208, 181, 1, 5173}, // MS_TOPP_SpectraFilterParentPeakMower
+    {1951, 105, 208, 181, 1, 5178}, // MS_TOPP_SpectraFilterScaler
+    {1952, 105, 208, 181, 1, 5183}, // MS_TOPP_SpectraFilterSqrtMower
+    {1953, 105, 208, 181, 1, 5188}, // MS_TOPP_SpectraFilterThresholdMower
+    {1954, 105, 208, 181, 1, 5193}, // MS_TOPP_SpectraFilterWindowMower
+    {1955, 105, 208, 181, 1, 5198}, // MS_TOPP_map_aligner
+    {1956, 105, 208, 181, 1, 5202}, // MS_TOPP_MapAlignerIdentification
+    {1957, 105, 208, 181, 1, 5207}, // MS_TOPP_MapAlignerPoseClustering
+    {1958, 105, 208, 181, 1, 5212}, // MS_TOPP_MapAlignerSpectrum
+    {1959, 105, 208, 181, 1, 5217}, // MS_numerator_data_type_attribute
+    {1960, 105, 208, 181, 1, 5219}, // MS_denominator_data_type_attribute
+    {1961, 105, 208, 181, 1, 5221}, // MS_protein_level_PSM_counts
+    {1962, 105, 208, 181, 1, 5223}, // MS_TOPP_DTAExtractor
+    {1963, 105, 208, 181, 1, 5227}, // MS_TOPP_IDMerger
+    {1964, 105, 208, 181, 1, 5231}, // MS_TOPP_IDFileConverter
+    {1965, 105, 208, 181, 1, 5235}, // MS_TOPP_SpectraMerger
+    {1966, 105, 208, 181, 1, 5239}, // MS_TOPP_MzTabExporter
+    {1967, 105, 208, 181, 1, 5243}, // MS_TOPP_MassTraceExtractor
+    {1968, 105, 208, 181, 1, 5247}, // MS_TOPP_PrecursorMassCorrector
+    {1969, 105, 208, 181, 1, 5251}, // MS_TOPP_HighResPrecursorMassCorrector
+    {1970, 105, 208, 181, 1, 5255}, // MS_TOPP_AdditiveSeries
+    {1971, 105, 208, 181, 1, 5259}, // MS_TOPP_Decharger
+    {1972, 105, 208, 181, 1, 5263}, // MS_TOPP_EICExtractor
+    {1973, 105, 208, 181, 1, 5267}, // MS_TOPP_feature_finder
+    {1974, 105, 208, 181, 1, 5271}, // MS_TOPP_FeatureFinderCentroided
+    {1975, 105, 208, 181, 1, 5276}, // MS_TOPP_FeatureFinderRaw
+    {1976, 105, 208, 181, 1, 5281}, // MS_TOPP_FeatureFinderIsotopeWavelet
+    {1977, 105, 208, 181, 1, 5286}, // MS_TOPP_FeatureFinderMetabo
+    {1978, 105, 208, 181, 1, 5291}, // MS_TOPP_FeatureFinderMRM
+    {1979, 105, 208, 181, 1, 5296}, // MS_TOPP_ProteinQuantifier
+    {1980, 105, 208, 181, 1, 5300}, // MS_TOPP_ConsensusMapNormalizer
+    {1981, 105, 208, 181, 1, 5304}, // MS_TOPP_MapRTTransformer
+    {1982, 105, 208, 181, 1, 5308}, // MS_TOPP_feature_linker
+    {1983, 105, 208, 181, 1, 5312}, // MS_TOPP_FeatureLinkerLabeled
+    {1984, 105, 208, 181, 1, 5317}, // MS_TOPP_FeatureLinkerUnlabeled
+    {1985, 105, 208, 181, 1, 5322}, // MS_TOPP_FeatureLinkerUnlabeledQT
+    {1986, 105, 208, 181, 1, 5327}, // MS_TOPP_CompNovo
+    {1987, 105, 208, 181, 1, 5331}, // MS_TOPP_CompNovoCID
+    {1988, 105, 208, 181, 1, 5335}, // MS_TOPP_software_adaptor
+    {1989, 105, 208, 181, 1, 5339}, // MS_TOPP_InspectAdapter
+    {1990, 105, 208, 181, 1, 5344}, // MS_TOPP_MascotAdapter
+    {1991, 105, 208, 181, 1, 5349}, // MS_TOPP_MascotAdapterOnline
+    {1992, 105, 208, 181, 1, 5354}, // MS_TOPP_OMSSAAdapter
+    {1993, 105, 208, 181, 1, 5359}, // MS_TOPP_PepNovoAdapter
+    {1994, 105, 208, 181, 1, 5364}, // MS_TOPP_XTandemAdapter
+    {1995, 105, 208, 181, 1, 5369}, // MS_TOPP_SpecLibSearcher
+    {1996, 105, 208, 181, 1, 5373}, // MS_TOPP_ConsensusID
+    {1997, 105, 208, 181, 1, 5377}, // MS_TOPP_IDConflictResolver
+    {1998, 105, 208, 181, 1, 5381}, // MS_TOPP_IDFilter
+    {1999, 105, 208, 181, 1, 5385}, // MS_TOPP_IDMapper
+    {2000, 105, 208, 181, 1, 5389}, // MS_TOPP_IDPosteriorErrorProbability
+    {2001, 105, 208, 181, 1, 5393}, // MS_TOPP_IDRTCalibration
+    {2002, 105, 208, 181, 1, 5397}, // MS_TOPP_PeptideIndexer
+    {2003, 105, 208, 181, 1, 5401}, // MS_TOPP_PrecursorIonSelector
+    {2004, 105, 208, 181, 1, 5405}, // MS_TOPP_MRMMapper
+    {2005, 105, 208, 181, 1, 5409}, // MS_TOPP_OpenSwath_component
+    {2006, 105, 208, 181, 1, 5413}, // MS_TOPP_OpenSwathAnalyzer
+    {2007, 105, 208, 181, 1, 5418}, // MS_TOPP_OpenSwathChromatogramExtractor
+    {2008, 105, 208, 181, 1, 5423}, // MS_TOPP_OpenSwathDecoyGenerator
+    {2009, 105, 208, 181, 1, 5428}, // MS_TOPP_OpenSwathFeatureXMLToTSV
+    {2010, 105, 208, 181, 1, 5433}, // MS_TOPP_OpenSwathRTNormalizer
+    {2011, 105, 208, 181, 1, 5438}, // MS_TOPP_ProteinInference
+    {2012, 105, 208, 181, 1, 5442}, // MS_TOPP_FalseDiscoveryRate
+    {2013, 105, 208, 181, 1, 5446}, // MS_ProteoWizard_msconvert
+    {2014, 105, 208, 181, 1, 5450}, // MS_ProteoWizard_idconvert
+    {2015, 105, 208, 181, 1, 5454}, // MS_ProteoWizard_chainsaw
+    {2016, 105, 208, 181, 1, 5458}, // MS_ProteoWizard_msaccess
+    {2017, 105, 208, 181, 1, 5462}, // MS_ProteoWizard_SeeMS
+    {2018, 105, 208, 181, 1, 5466}, // MS_IsobariQ
+    {2020, 105, 208, 181, 1, 5470}, // MS_Variance_stabilizing_normalization
+    {2021, 105, 208, 181, 1, 5471}, // MS_IPTL_quantitation_analysis
+    {2022, 105, 208, 181, 1, 5474}, // MS_PAnalyzer_conclusive_protein
+    {2023, 105, 208, 181, 1, 5481}, // MS_PAnalyzer_indistinguishable_protein
+    {2024, 105, 208, 181, 1, 5488}, // MS_PAnalyzer_non_conclusive_protein
+    {2025, 105, 208, 181, 1, 5495}, // MS_PAnalyzer_ambiguous_group_member
+    {2026, 105, 208, 181, 1, 5502}, // MS_decoy_peptide
+    {2027, 105, 208, 181, 1, 5507}, // MS_percent_collision_energy_ramp_start
+    {2028, 105, 209, 181, 1, 5509}, // MS_percent_collision_energy_ramp_end
+    {2029, 105, 210, 181, 1, 5511}, // MS_MRMaid
+    {2030, 105, 210, 181, 1, 5513}, // MS_MRMaid_peptide_score
+    {2032, 105, 210, 181, 1, 5521}, // MS_SRM_transition_attribute
+    {2033, 106, 210, 181, 1, 5523}, // MS_precursor_ion_detection_probability
+    {2034, 106, 210, 181, 1, 5526}, // MS_product_ion_detection_probability
+    {2035, 106, 210, 181, 1, 5529}, // MS_average_product_ion_intensity
+    {2036, 106, 214, 181, 1, 5535}, // MS_product_ion_intensity_standard_deviation
+    {2037, 106, 218, 181, 1, 5541}, // MS_number_of_product_ion_observations
+    {2038, 106, 218, 181, 1, 5544}, // MS_number_of_precursor_ion_observations
+    {2039, 106, 218, 181, 1, 5547}, // MS_ProteomeDiscoverer_Mascot_Significance_Middle
+    {2040, 106, 218, 181, 1, 5551}, // MS_ProteomeDiscoverer_Mascot_Significance_High
+    {2041, 106, 218, 181, 1, 5555}, // MS_regular_expressions_for_a_GUID
+    {2042, 106, 218, 181, 1, 5556}, // MS_ProteomeDiscoverer_Default_FDR_calculator
+    {2043, 106, 219, 181, 1, 5560}, // MS_ProteomeDiscoverer_SEQUEST_Low_resolution_spectra_contained
+    {2044, 106, 219, 181, 1, 5564}, // MS_selected_precursor_m_z
+    {2045, 106, 220, 181, 1, 5566}, // MS_ProteoGrouper_PDH_score
+    {2046, 106, 220, 181, 1, 5573}, // MS_ProteoGrouper_PAG_score
+    {2047, 106, 220, 181, 1, 5580}, // MS_mzidLib
+    {2048, 106, 220, 181, 1, 5582}, // MS_mzidLib_Omssa2Mzid
+    {2049, 106, 220, 181, 1, 5585}, // MS_mzidLib_Tandem2Mzid
+    {2050, 106, 220, 181, 1, 5588}, // MS_mzidLib_Csv2Mzid
+    {2051, 106, 220, 181, 1, 5591}, // MS_mzidLib_ProteoGrouper
+    {2052, 106, 220, 181, 1, 5594}, // MS_mzidLib_Thresholder
+    {2053, 106, 220, 181, 1, 5597}, // MS_mzidLib_Perform_emPAI_on_mzid
+    {2054, 106, 220, 181, 1, 5600}, // MS_mzidLib_FalseDiscoveryRate
+    {2055, 106, 220, 181, 1, 5603}, // MS_mzidLib_Mzidentml2Csv
+    {2056, 106, 220, 181, 1, 5606}, // MS_mzidLib_CombineSearchEngines
+    {2057, 106, 220, 181, 1, 5609}, // MS_mzidLib_InsertMetaDataFromFasta
+    {2058, 106, 220, 181, 1, 5612}, // MS_SEQUEST_spscore
+    {2059, 106, 220, 181, 1, 5619}, // MS_SEQUEST_sprank
+    {2060, 106, 220, 181, 1, 5626}, // MS_SEQUEST_deltacnstar
+    {2061, 106, 220, 181, 1, 5633}, // MS_Comet
+    {2062, 106, 220, 181, 1, 5635}, // MS_Comet_xcorr
+    {2063, 106, 221, 181, 1, 5642}, // MS_Comet_deltacn
+    {2064, 106, 221, 181, 1, 5649}, // MS_Comet_deltacnstar
+    {2065, 106, 221, 181, 1, 5656}, // MS_Comet_spscore
+    {2066, 106, 221, 181, 1, 5663}, // MS_Comet_sprank
+    {2067, 106, 221, 181, 1, 5670}, // MS_Comet_expectation_value
+    {2068, 106, 221, 181, 1, 5675}, // MS_Comet_matched_ions
+    {2069, 106, 221, 181, 1, 5682}, // MS_Comet_total_ions
+    {2070, 106, 221, 181, 1, 5689}, // MS_PSM_FDR_threshold
+    {2071, 106, 221, 181, 1, 5694}, // MS_Byonic
+    {2072, 106, 221, 181, 1, 5696}, // MS_Byonic_Score
+    {2073, 106, 222, 181, 1, 5703}, // MS_Byonic_Delta_Score
+    {2074, 106, 223, 181, 1, 5710}, // MS_Byonic_DeltaMod_Score
+    {2075, 106, 224, 181, 1, 5717}, // MS_Byonic_PEP
+    {2076, 106, 225, 181, 1, 5724}, // MS_Byonic_Peptide_LogProb
+    {2077, 106, 226, 181, 1, 5731}, // MS_Byonic_Protein_LogProb
+    {2079, 106, 227, 181, 1, 5738}, // MS_Byonic_Best_LogProb
+    {2081, 106, 228, 181, 1, 5745}, // MS_Byonic_Best_Score
+    {2082, 106, 229, 181, 1, 5752}, // MS_chromatography_separation
+    {2083, 106, 229, 181, 1, 5754}, // MS_liquid_chromatography_separation
+    {2084, 106, 229, 181, 1, 5757}, // MS_gas_chromatography_separation
+    {2085, 106, 229, 181, 1, 5760}, // MS_detector_potential
+    {2086, 106, 230, 181, 1, 5761}, // MS_SQ_Detector_2
+    {2087, 106, 230, 181, 1, 5763}, // MS_Xevo_G2_S_Tof
+    {2088, 106, 230, 181, 1, 5765}, // MS_Xevo_G2_S_QTof
+    {2089, 106, 230, 181, 1, 5767}, // MS_AutoSpec_Premier
+    {2090, 106, 230, 181, 1, 5769}, // MS_Pegasus_III
+    {2091, 106, 230, 181, 1, 5771}, // MS_maXis_4G
+    {2092, 106, 230, 181, 1, 5774}, // MS_compact
+    {2093, 106, 230, 181, 1, 5777}, // MS_SRM_feature_level_quantitation
+    {2094, 106, 230, 181, 1, 5780}, // MS_SRM_peptide_level_quantitation
+    {2095, 106, 230, 181, 1, 5783}, // MS_SRM_protein_level_quantitation
+    {2096, 106, 230, 181, 1, 5786}, // MS_SRM_proteingroup_level_quantitation
+    {2097, 106, 230, 181, 1, 5789}, // MS_Trans_Proteomic_Pipeline
+    {2098, 106, 230, 182, 1, 5791}, // MS_Trans_Proteomic_Pipeline_software
+    {2099, 107, 230, 182, 1, 5793}, // MS_PeptideProphet
+    {2100, 107, 230, 182, 1, 5796}, // MS_iProphet
+    {2101, 107, 230, 182, 1, 5799}, // MS_ProteinProphet
+    {2102, 107, 230, 182, 1, 5802}, // MS_XPRESS
+    {2103, 107, 230, 182, 1, 5805}, // MS_Libra
+    {2104, 107, 230, 182, 1, 5808}, // MS_PTMProphet
+    {2105, 107, 230, 182, 1, 5811}, // MS_Bruker_Daltonics_SCION_series
+    {2106, 107, 230, 182, 1, 5813}, // MS_Bruker_Daltonics_EVOQ_series
+    {2107, 107, 230, 182, 1, 5815}, // MS_SCION_SQ
+    {2108, 107, 230, 182, 1, 5818}, // MS_SCION_TQ
+    {2109, 107, 230, 182, 1, 5821}, // MS_EVOQ_Elite
+    {2110, 107, 230, 182, 1, 5824}, // MS_EVOQ_Qube
+    {2111, 107, 230, 182, 1, 5827}, // MS_micrOTOF_Q_III
+    {2112, 107, 230, 182, 1, 5830}, // MS_amaZon_Speed_ETD
+    {2113, 107, 230, 182, 1, 5833}, // MS_amaZon_Speed
+    {2114, 107, 230, 182, 1, 5836}, // MS_Bruker_Container_format
+    {2115, 107, 230, 182, 1, 5838}, // MS_Bruker_Container_nativeID_format
+    {2116, 107, 230, 182, 1, 5839}, // MS_domain_range
+    {2116, 108, 230, 182, 1, 5839}, // MS_value_between_0_and_1_inclusive
+    {2117, 108, 230, 182, 1, 5840}, // MS_value_greater_than_zero
+    {2118, 108, 230, 182, 1, 5841}, // MS_fragmentation_ion_type
+    {2119, 108, 230, 182, 1, 5846}, // MS_fluorescence_detector
+    {2120, 108, 230, 182, 1, 5847}, // MS_Byonic__Peptide_AbsLogProb
+    {2121, 108, 231, 182, 1, 5854}, // MS_Byonic__Protein_AbsLogProb
+    {2122, 108, 232, 182, 1, 5861}, // MS_Byonic__Peptide_AbsLogProb2D
+    {2123, 108, 233, 182, 1, 5868}, // MS_MS_Numpress_linear_prediction_compression
+    {2124, 108, 233, 182, 1, 5869}, // MS_MS_Numpress_positive_integer_compression
+    {2125, 108, 233, 182, 1, 5870}, // MS_MS_Numpress_short_logged_float_compression
+    {2126, 108, 233, 182, 1, 5871}, // MS_consensus_result
+    {2127, 108, 233, 182, 1, 5872}, // MS_ProteomeDiscoverer_Amanda_high_confidence_threshold
+    {2128, 108, 233, 182, 1, 5876}, // MS_ProteomeDiscoverer_Amanda_middle_confidence_threshold
+    {2129, 108, 233, 182, 1, 5880}, // MS_ProteomeDiscoverer_automatic_workload
+    {2130, 108, 233, 182, 1, 5884}, // MS_Amanda_AmandaScore
+    {2131, 108, 233, 182, 1, 5891}, // MS_ProteomeDiscoverer_max_differential_modifications
+    {2132, 108, 233, 182, 1, 5895}, // MS_ProteomeDiscoverer_max_equal_modifications
+    {2133, 108, 233, 182, 1, 5899}, // MS_ProteomeDiscoverer_min_peptide_length
+    {2134, 108, 233, 182, 1, 5903}, // MS_ProteomeDiscoverer_max_peptide_length
+    {2135, 108, 233, 182, 1, 5907}, // MS_ProteomeDiscoverer_max_number_neutral_loss
+    {2136, 108, 233, 182, 1, 5911}, // MS_ProteomeDiscoverer_max_number_neutral_loss_modifications
+    {2137, 108, 233, 182, 1, 5915}, // MS_ProteomeDiscoverer_use_flanking_ions
+    {2138, 108, 233, 182, 1, 5919}, // MS_ProteomeDiscoverer_max_number_of_same_modifs
+    {2139, 108, 233, 182, 1, 5923}, // MS_ProteomeDiscoverer_perform_deisotoping
+    {2140, 108, 233, 182, 1, 5927}, // MS_ProteomeDiscoverer_ion_settings
+    {2141, 108, 233, 182, 1, 5931}, // MS_ProteomeDiscoverer_3__Static_Modification_OBSOLETE
+    {2142, 108, 233, 182, 1, 5935}, // MS_ProteomeDiscoverer_5__Dynamic_Modification_OBSOLETE
+    {2143, 108, 233, 182, 1, 5939}, // MS_lab_head
+    {2144, 108, 233, 182, 1, 5942}, // MS_conversion_software
+    {2145, 108, 233, 182, 1, 5944}, // MS_ProCon
+    {2147, 108, 233, 182, 1, 5947}, // MS_PRIDE_Converter2
+    {2149, 108, 233, 182, 1, 5950}, // MS_Amanda
+    {2150, 108, 233, 182, 1, 5952}, // MS_Andromeda
+    {2151, 108, 233, 182, 1, 5954}, // MS_Andromeda_score
+    {2152, 108, 234, 182, 1, 5961}, // MS_site_global_FDR
+    {2153, 108, 234, 182, 1, 5962}, // MS_ProteomeXchange_project_tag
+    {2154, 108, 234, 182, 1, 5963}, // MS_second_pass_peptide_identification
+    {2155, 108, 234, 182, 1, 5968}, // MS_MZmine
+    {2157, 108, 234, 182, 1, 5971}, // MS_ion_stability_type_OBSOLETE
+    {2157, 108, 234, 182, 1, 5971}, // MS_Maltcms
+    {2159, 108, 234, 182, 1, 5974}, // MS_PSM_level_attribute
+    {2160, 108, 234, 182, 1, 5978}, // MS_protein_group_level_identification_attribute
+    {2161, 108, 234, 182, 1, 5982}, // MS_PSM_level_identification_statistic
+    {2162, 108, 234, 182, 1, 5987}, // MS_protein_group_level_identification_statistic
+    {2163, 108, 234, 182, 1, 5992}, // MS_value_greater_than_zero_but_less_than_or_equal_to_one
+    {2164, 108, 234, 182, 1, 5993}, // MS_PSM_level_global_FDR
+    {2165, 108, 235, 182, 1, 5999}, // MS_PSM_level_local_FDR
+    {2166, 108, 236, 182, 1, 6005}, // MS_PSM_level_p_value
+    {2167, 108, 237, 182, 1, 6011}, // MS_PSM_level_e_value
+    {2168, 108, 238, 182, 1, 6017}, // MS_PSM_level_q_value
+    {2169, 108, 239, 182, 1, 6023}, // MS_PSM_level_FDRScore
+    {2171, 108, 240, 182, 1, 6033}, // MS_PSM_level_combined_FDRScore
+    {2173, 108, 241, 182, 1, 6043}, // MS_PSM_level_probability
+    {2174, 108, 242, 182, 1, 6049}, // MS_search_engine_specific_peptide_sequence_level_identification_statistic
+    {2175, 108, 242, 182, 1, 6055}, // MS_peptide_sequence_level_local_FDR
+    {2176, 108, 243, 182, 1, 6061}, // MS_distinct_peptide_level_FDRScore
+    {2178, 108, 244, 182, 1, 6071}, // MS_distinct_peptide_level_combined_FDRScore
+    {2180, 108, 245, 182, 1, 6081}, // MS_peptide_sequence_level_probability
+    {2181, 108, 246, 182, 1, 6087}, // MS_search_engine_specific_score_for_proteins
+    {2182, 108, 246, 182, 1, 6093}, // MS_protein_level_local_FDR
+    {2183, 108, 246, 182, 1, 6099}, // MS_FDRScore_for_proteins
+    {2184, 108, 247, 182, 1, 6106}, // MS_combined_FDRScore_for_proteins
+    {2185, 108, 248, 182, 1, 6113}, // MS_probability_for_proteins
+    {2186, 108, 249, 182, 1, 6119}, // MS_search_engine_specific_score_for_protein_groups
+    {2187, 108, 249, 182, 1, 6125}, // MS_protein_group_level_global_FDR
+    {2188, 108, 249, 182, 1, 6131}, // MS_protein_group_level_local_FDR
+    {2189, 108, 249, 182, 1, 6137}, // MS_protein_group_level_p_value
+    {2190, 108, 250, 182, 1, 6143}, // MS_protein_group_level_e_value
+    {2191, 108, 251, 182, 1, 6149}, // MS_protein_group_level_q_value
+    {2192, 108, 252, 182, 1, 6155}, // MS_protein_group_level_FDRScore
+    {2193, 108, 253, 182, 1, 6162}, // MS_protein_group_level_combined_FDRScore
+    {2194, 108, 254, 182, 1, 6169}, // MS_protein_group_level_probability
+    {2195, 108, 255, 182, 1, 6175}, // MS_ProteomeDiscoverer_Relaxed_Score_Threshold
+    {2196, 108, 255, 182, 1, 6179}, // MS_ProteomeDiscoverer_Strict_Score_Threshold
+    {2197, 108, 255, 182, 1, 6183}, // MS_ProteomeDiscoverer_Peptide_Without_Protein_Cut_Off_Score
+    {2198, 108, 255, 182, 1, 6187}, // MS_false_localization_rate
+    {2199, 108, 255, 182, 1, 6188}, // MS_MALDI_Solutions_LC_MALDI
+    {2203, 108, 255, 182, 1, 6193}, // MS_Shimadzu_MALDI_7090
+    {2204, 108, 255, 182, 1, 6196}, // MS_SCiLS_software
+    {2205, 108, 255, 182, 1, 6197}, // MS_SCiLS_Lab
+    {2208, 108, 255, 182, 1, 6201}, // MS_SCiLS_Lab_format
+    {2209, 108, 255, 182, 1, 6203}, // MS_preprocessing_software
+    {2210, 108, 255, 182, 1, 6205}, // MS_PIA
+    {2213, 108, 255, 182, 1, 6209}, // MS_PIA_XML_format
+    {2214, 108, 255, 182, 1, 6211}, // MS_PIA_workflow_parameter
+    {2216, 108, 255, 182, 1, 6216}, // MS_PIA_FDRScore_calculated
+    {2217, 108, 255, 182, 1, 6222}, // MS_PIA_Combined_FDRScore_calculated
+    {2218, 108, 255, 182, 1, 6228}, // MS_PIA_PSM_sets_created
+    {2219, 108, 255, 182, 1, 6234}, // MS_PIA_used_top_identifications_for_FDR
+    {2220, 108, 255, 182, 1, 6240}, // MS_PIA_protein_score
+    {2221, 108, 256, 182, 1, 6247}, // MS_PIA_protein_inference
+    {2222, 108, 256, 182, 1, 6253}, // MS_PIA_protein_inference_filter
+    {2223, 108, 256, 182, 1, 6259}, // MS_PIA_protein_inference_scoring
+    {2224, 108, 256, 182, 1, 6265}, // MS_PIA_protein_inference_used_score
+    {2225, 108, 256, 182, 1, 6271}, // MS_PIA_protein_inference_used_PSMs
+    {2226, 108, 256, 182, 1, 6277}, // MS_PIA_filter
+    {2227, 108, 256, 182, 1, 6283}, // MS_leading_protein
+    {2228, 108, 256, 182, 1, 6289}, // MS_non_leading_protein
+    {2229, 108, 256, 182, 1, 6295}, // MS_group_representative
+    {2230, 108, 256, 182, 1, 6301}, // MS_count_of_identified_proteins
+    {2231, 108, 256, 182, 1, 6306}, // MS_protein_group_level_result_list_attribute
+    {2232, 108, 256, 182, 1, 6310}, // MS_count_of_identified_clusters
+    {2233, 108, 256, 182, 1, 6315}, // MS_cluster_identifier
+    {2234, 108, 256, 182, 1, 6320}, // MS_number_of_distinct_protein_sequences
+    {2235, 108, 256, 182, 1, 6325}, // MS_marginally_distinguished_protein
+    {2236, 108, 256, 182, 1, 6331}, // MS_Anubis
+    {2238, 108, 256, 182, 1, 6335}, // MS_TraML_format
+    {2239, 108, 256, 182, 1, 6337}, // MS_total_XIC_area
+    {2240, 108, 256, 182, 1, 6339}, // MS_product_background
+    {2241, 108, 256, 182, 1, 6341}, // MS_postprocessing_software
+    {2242, 108, 256, 182, 1, 6343}, // MS_protein_group_passes_threshold
+    {2243, 108, 256, 182, 1, 6348}, // MS_Orbitrap_Fusion
+    {2244, 108, 256, 182, 1, 6351}, // MS_Orbitrap_Fusion_ETD
+    {2245, 108, 256, 182, 1, 6354}, // MS_TSQ_Quantiva
+    {2246, 108, 256, 182, 1, 6357}, // MS_TSQ_Endura
+    {2247, 108, 256, 182, 1, 6360}, // MS_PASSEL_experiment_URI
+    {2248, 108, 256, 182, 1, 6361}, // MS_Paragon_input_parameter
+    {2249, 108, 256, 182, 1, 6364}, // MS_Paragon__sample_type
+    {2250, 108, 256, 182, 1, 6368}, // MS_Paragon__cysteine_alkylation
+    {2251, 108, 256, 182, 1, 6372}, // MS_Paragon__instrument_setting
+    {2252, 108, 256, 182, 1, 6376}, // MS_Paragon__search_effort
+    {2253, 108, 256, 182, 1, 6380}, // MS_Paragon__ID_focus
+    {2254, 108, 256, 182, 1, 6384}, // MS_Paragon__FDR_analysis
+    {2255, 108, 256, 182, 1, 6388}, // MS_Paragon__quantitation
+    {2256, 108, 256, 182, 1, 6392}, // MS_Paragon__background_correction
+    {2257, 108, 256, 182, 1, 6396}, // MS_Paragon__bias_correction
+    {2258, 108, 256, 182, 1, 6400}, // MS_Paragon__channel_to_use_as_denominator_in_ratios
+    {2259, 108, 256, 182, 1, 6404}, // MS_search_engine_specific_input_metadata
+    {2260, 108, 256, 182, 1, 6405}, // MS_Paragon__modified_data_dictionary_or_parameter_translation
+    {2261, 108, 256, 182, 1, 6407}, // MS_number_of_spectra_searched
+    {2262, 108, 256, 182, 1, 6408}, // MS_data_processing_start_time
+    {2263, 108, 256, 182, 1, 6409}, // MS_Paragon__digestion
+    {2264, 108, 256, 182, 1, 6410}, // MS_number_of_decoy_sequences
+    {2265, 108, 256, 182, 1, 6412}, // MS_spectrum_identification_list_result_details
+    {2265, 109, 256, 182, 1, 6412}, // MS_final_PSM_list
+    {2266, 109, 256, 182, 1, 6413}, // MS_intermediate_PSM_list
+    {2267, 109, 256, 182, 1, 6414}, // MS_Andi_MS_format
+    {2268, 109, 256, 182, 1, 6416}, // MS_chromatograph_file_format
+    {2269, 109, 256, 182, 1, 6417}, // MS_Andi_CHROM_format
+    {2270, 109, 256, 182, 1, 6419}, // MS_6420_Triple_Quadrupole_LC_MS
+    {2271, 109, 256, 182, 1, 6421}, // MS_6460_Triple_Quadrupole_LC_MS
+    {2272, 109, 256, 182, 1, 6423}, // MS_6490_Triple_Quadrupole_LC_MS
+    {2273, 109, 256, 182, 1, 6425}, // MS_Paragon_special_factor
+    {2274, 109, 256, 182, 1, 6429}, // MS_PEAKS_inChorusPeptideScore
+    {2275, 109, 256, 182, 1, 6436}, // MS_PEAKS_inChorusProteinScore
+    {2276, 109, 256, 182, 1, 6443}, // MS_param__b_ion_H3PO4_DEPRECATED
+    {2277, 109, 256, 182, 1, 6445}, // MS_param__y_ion_H3PO4_DEPRECATED
+    {2278, 109, 256, 182, 1, 6447}, // MS_Maui
+    {2280, 109, 256, 182, 1, 6450}, // MS_No_fixed_modifications_searched
+    {2281, 109, 256, 182, 1, 6453}, // MS_No_variable_modifications_searched
+    {2282, 109, 256, 182, 1, 6456}, // MS_H2O_neutral_loss_OBSOLETE
+    {2284, 109, 256, 182, 1, 6460}, // MS_NH3_neutral_loss_OBSOLETE
+    {2286, 109, 256, 182, 1, 6464}, // MS_H3PO4_neutral_loss_OBSOLETE
+    {2288, 109, 256, 182, 1, 6468}, // MS_PeptideShaker
+    {2289, 109, 256, 182, 1, 6470}, // MS_MS_Amanda_csv_format
+    {2290, 109, 256, 182, 1, 6472}, // MS_protein_group_level_global_FNR
+    {2291, 109, 257, 182, 1, 6478}, // MS_protein_group_level_confidence
+    {2292, 109, 257, 182, 1, 6484}, // MS_peptide_sequence_level_global_FNR
+    {2293, 109, 258, 182, 1, 6490}, // MS_peptide_sequence_level_global_confidence
+    {2294, 109, 258, 182, 1, 6496}, // MS_PSM_level_global_FNR
+    {2295, 109, 259, 182, 1, 6502}, // MS_PSM_level_global_confidence
+    {2296, 109, 259, 182, 1, 6508}, // MS_PeptideShaker_PSM_score
+    {2297, 109, 260, 182, 1, 6515}, // MS_PeptideShaker_PSM_confidence
+    {2298, 109, 261, 182, 1, 6522}, // MS_PeptideShaker_peptide_score
+    {2300, 109, 262, 182, 1, 6532}, // MS_PeptideShaker_peptide_confidence
+    {2301, 109, 263, 182, 1, 6539}, // MS_PeptideShaker_protein_group_score
+    {2303, 109, 264, 182, 1, 6549}, // MS_PeptideShaker_protein_group_confidence
+    {2304, 109, 265, 182, 1, 6556}, // MS_trap_type_collision_induced_dissociation
+    {2305, 109, 265, 182, 1, 6558}, // MS_ion_series_considered_in_search
+    {2306, 109, 265, 182, 1, 6559}, // MS_ProteoAnnotator_non_canonical_gene_model_score
+    {2307, 109, 266, 182, 1, 6566}, // MS_ProteoAnnotator_count_alternative_peptides
+    {2308, 109, 266, 182, 1, 6573}, // MS_ion_mobility_drift_time
+    {2309, 109, 267, 182, 1, 6575}, // MS_mean_drift_time_array
+    {2310, 109, 269, 182, 1, 6576}, // MS_mean_charge_array
+    {2311, 109, 269, 182, 1, 6577}, // MS_regular_expression
+    {2311, 110, 269, 182, 1, 6577}, // MS_regular_expression_for_a_digital_object_identifier__DOI_
+    {2312, 110, 269, 182, 1, 6578}, // MS_higher_energy_beam_type_collision_induced_dissociation
+    {2313, 110, 269, 182, 1, 6581}, // MS_statistical_threshold
+    {2314, 110, 269, 182, 1, 6583}, // MS_PSM_level_statistical_threshold
+    {2315, 110, 269, 182, 1, 6587}, // MS_peptide_level_statistical_threshold
+    {2316, 110, 269, 182, 1, 6591}, // MS_protein_level_statistical_threshold
+    {2317, 110, 269, 182, 1, 6595}, // MS_protein_group_level_statistical_threshold
+    {2318, 110, 269, 182, 1, 6599}, // MS_MassIVE_dataset_identifier
+    {2319, 110, 269, 182, 1, 6600}, // MS_MassIVE_dataset_URI
+    {2320, 110, 269, 182, 1, 6601}, // MS_special_processing
+    {2321, 111, 269, 182, 1, 6603}, // MS_peptide_level_scoring
+    {2322, 111, 269, 182, 1, 6606}, // MS_modification_localization_scoring
+    {2323, 111, 269, 182, 1, 6609}, // MS_consensus_scoring
+    {2324, 111, 269, 182, 1, 6612}, // MS_sample_pre_fractionation
+    {2325, 111, 269, 182, 1, 6615}, // MS_cross_linking_search
+    {2326, 111, 269, 182, 1, 6618}, // MS_no_special_processing
+    {2327, 111, 269, 182, 1, 6621}, // MS_group_PSMs_by_sequence
+    {2328, 111, 269, 182, 1, 6622}, // MS_group_PSMs_by_sequence_with_modifications
+    {2329, 111, 269, 182, 1, 6623}, // MS_group_PSMs_by_sequence_with_modifications_and_charge
+    {2330, 111, 269, 182, 1, 6624}, // MS_peptide_level_score_OBSOLETE
+    {2331, 111, 269, 182, 1, 6631}, // MS_peptide_passes_threshold
+    {2332, 111, 269, 182, 1, 6636}, // MS_no_PSM_threshold
+    {2333, 111, 269, 182, 1, 6642}, // MS_no_peptide_level_threshold
+    {2334, 111, 269, 182, 1, 6647}, // MS_PSM_is_used_for_peptide_level_scoring
+    {2335, 111, 269, 182, 1, 6652}, // MS_modification_index
+    {2336, 111, 269, 182, 1, 6653}, // MS_regular_expression_for_modification_localization_scoring
+    {2337, 111, 269, 182, 1, 6654}, // MS_modification_position_score
+    {2338, 111, 269, 182, 1, 6655}, // MS_modification_rescoring_false_localization_rate
+    {2339, 111, 270, 182, 1, 6657}, // MS_cross_linking_attribute
+    {2340, 111, 270, 182, 1, 6661}, // MS_cross_link_donor
+    {2341, 111, 270, 182, 1, 6666}, // MS_cross_link_acceptor
+    {2342, 111, 270, 182, 1, 6671}, // MS_cross_link_spectrum_identification_item
+    {2343, 111, 270, 182, 1, 6676}, // MS_cross_linking_score
+    {2344, 111, 270, 182, 1, 6683}, // MS_molecules_per_cell
+    {2345, 111, 270, 182, 1, 6685}, // MS_absolute_quantitation_analysis
+    {2346, 111, 270, 182, 1, 6687}, // MS_internal_peptide_reference_used
+    {2347, 111, 270, 182, 1, 6689}, // MS_internal_protein_reference_used
+    {2348, 111, 270, 182, 1, 6691}, // MS_internal_reference_abundance
+    {2349, 111, 270, 182, 1, 6693}, // MS_Progenesis_protein_group_normalised_abundance
+    {2350, 111, 270, 182, 1, 6695}, // MS_Progenesis_protein_group_raw_abundance
+    {2351, 111, 270, 182, 1, 6697}, // MS_peptide_group_ID
+    {2352, 111, 270, 182, 1, 6702}, // MS_mass_spectrometry_imaging
+    {2353, 111, 270, 182, 1, 6704}, // MS_ProteomeDiscoverer_1__Static_Terminal_Modification
+    {2354, 111, 270, 182, 1, 6708}, // MS_Q_Exactive_HF
+    {2355, 111, 270, 182, 1, 6711}, // MS_PepFinder
+    {2356, 111, 270, 182, 1, 6713}, // MS_TSQ_8000_Evo
+    {2357, 111, 270, 182, 1, 6716}, // MS_Exactive_Plus
+    {2358, 111, 270, 182, 1, 6719}, // MS_instrument_specific_scan_attribute
+    {2359, 111, 270, 182, 1, 6721}, // MS_synchronous_prefilter_selection
+    {2360, 111, 270, 183, 1, 6724}, // MS_resolution_array
+    {2361, 111, 270, 183, 1, 6725}, // MS_baseline_array
+    {2362, 111, 270, 183, 1, 6726}, // MS_UIMF_format
+    {2363, 111, 270, 183, 1, 6728}, // MS_UIMF_nativeID_format
+    {2364, 111, 270, 183, 1, 6729}, // MS_TripleTOF_6600
+    {2365, 111, 270, 183, 1, 6731}, // MS_ProLuCID_xcorr
+    {2366, 111, 271, 183, 1, 6738}, // MS_ProLuCID_deltacn
+    {2367, 111, 271, 183, 1, 6745}, // MS_D_Score
+    {2368, 111, 272, 183, 1, 6750}, // MS_MD_Score
+    {2369, 111, 273, 183, 1, 6755}, // MS_PTM_localization_confidence_metric
+    {2370, 111, 273, 183, 1, 6756}, // MS_PeptideShaker_PTM_confidence_type
+    {2371, 111, 273, 183, 1, 6758}, // MS_PeptideShaker_PSM_confidence_type
+    {2372, 111, 273, 183, 1, 6764}, // MS_PeptideShaker_peptide_confidence_type
+    {2373, 111, 273, 183, 1, 6771}, // MS_PeptideShaker_protein_confidence_type
+    {2374, 111, 273, 183, 1, 6777}, // MS_xiFDR
+    {2375, 111, 273, 183, 1, 6779}, // MS_xi
+    {2376, 111, 273, 183, 1, 6781}, // MS_xi_score
+    {2377, 111, 274, 183, 1, 6788}, // MS_Skyline_mzQuantML_converter
+    {2379, 111, 274, 183, 1, 6792}, // MS_normalized_spectral_abundance_factor
+    {2380, 111, 274, 183, 1, 6794}, // MS_distributed_normalized_spectral_abundance_factor
+    {2381, 111, 274, 183, 1, 6796}, // MS_PTM_localization_distinct_peptide_level_statistic
+    {2382, 111, 274, 183, 1, 6800}, // MS_peptide_phosphoRS_score
+    {2383, 111, 275, 183, 1, 6805}, // MS_peptide_Ascore
+    {2384, 111, 276, 183, 1, 6810}, // MS_peptide_H_Score
+    {2385, 111, 277, 183, 1, 6815}, // MS_peptide_D_Score
+    {2386, 111, 278, 183, 1, 6820}, // MS_peptide_MD_Score
+    {2387, 111, 279, 183, 1, 6825}, // MS_PTM_localization_score_threshold
+    {2388, 111, 279, 183, 1, 6826}, // MS_Ascore_threshold
+    {2389, 111, 279, 183, 1, 6828}, // MS_D_Score_threshold
+    {2390, 111, 279, 183, 1, 6830}, // MS_MD_Score_threshold
+    {2391, 111, 279, 183, 1, 6832}, // MS_H_Score_threshold
+    {2392, 111, 279, 183, 1, 6834}, // MS_DeBunker_score_threshold
+    {2393, 111, 279, 183, 1, 6836}, // MS_Mascot_PTM_site_assignment_confidence_threshold
+    {2394, 111, 279, 183, 1, 6838}, // MS_MSQuant_PTM_score_threshold
+    {2395, 111, 279, 183, 1, 6840}, // MS_MaxQuant_PTM_Score_threshold
+    {2396, 111, 279, 183, 1, 6842}, // MS_MaxQuant_P_site_localization_probability_threshold
+    {2397, 111, 279, 183, 1, 6844}, // MS_MaxQuant_PTM_Delta_Score_threshold
+    {2398, 111, 279, 183, 1, 6846}, // MS_MaxQuant_Phospho__STY__Probabilities_threshold
+    {2399, 111, 279, 183, 1, 6848}, // MS_phosphoRS_score_threshold
+    {2400, 111, 279, 183, 1, 6850}, // MS_phosphoRS_site_probability_threshold
+    {2401, 111, 279, 183, 1, 6852}, // MS_ProteomeDiscoverer_Number_of_Spectra_Processed_At_Once
+    {2402, 111, 279, 183, 1, 6856}, // MS_sequence_multiply_subsumable_protein
+    {2403, 111, 279, 183, 1, 6862}, // MS_spectrum_multiply_subsumable_protein
+    {2404, 111, 279, 183, 1, 6868}, // MS_protein_detection_statistical_threshold
+    {2405, 111, 279, 183, 1, 6871}, // MS_spectrum_identification_statistical_threshold
+    {2406, 111, 279, 183, 1, 6874}, // MS_ASAPRatio
+    {2407, 111, 279, 183, 1, 6877}, // MS_Tide
+    {2408, 111, 279, 183, 1, 6879}, // MS_Andromeda_result_file
+    {2409, 111, 279, 183, 1, 6881}, // MS_2000_QTRAP
+    {2410, 111, 279, 183, 1, 6883}, // MS_2500_QTRAP
+    {2411, 111, 279, 183, 1, 6885}, // MS_3500_QTRAP
+    {2412, 111, 279, 183, 1, 6887}, // MS_QTRAP_4500
+    {2413, 111, 279, 183, 1, 6889}, // MS_QTRAP_6500
+    {2414, 111, 279, 183, 1, 6891}, // MS_QTRAP_6500_
+    {2415, 111, 279, 183, 1, 6893}, // MS_TripleTOF_4600
+    {2416, 111, 279, 183, 1, 6895}, // MS_TripleTOF_5600_
+    {2417, 111, 279, 183, 1, 6897}, // MS_API_100
+    {2418, 111, 279, 183, 1, 6899}, // MS_API_100LC
+    {2419, 111, 279, 183, 1, 6901}, // MS_API_165
+    {2420, 111, 279, 183, 1, 6903}, // MS_API_300
+    {2421, 111, 279, 183, 1, 6905}, // MS_API_350
+    {2422, 111, 279, 183, 1, 6907}, // MS_API_365
+    {2423, 111, 279, 183, 1, 6909}, // MS_Triple_Quad_3500
+    {2424, 111, 279, 183, 1, 6911}, // MS_Triple_Quad_4500
+    {2425, 111, 279, 183, 1, 6913}, // MS_Triple_Quad_5500
+    {2426, 111, 279, 183, 1, 6915}, // MS_Triple_Quad_6500
+    {2427, 111, 279, 183, 1, 6917}, // MS_Triple_Quad_6500_
+    {2428, 111, 279, 183, 1, 6919}, // MS_ProLuCID
+    {2429, 111, 279, 183, 1, 6921}, // MS_MS1_format
+    {2430, 111, 279, 183, 1, 6923}, // MS_DTASelect
+    {2431, 111, 279, 183, 1, 6925}, // MS_splash_key
+    {2432, 111, 279, 183, 1, 6926}, // MS_PRIDE_XML
+    {2434, 111, 279, 183, 1, 6929}, // MS_mzTab
+    {2435, 111, 279, 183, 1, 6932}, // MS_quantification_reagent
+    {2437, 111, 279, 183, 1, 6937}, // MS_ICAT_reagent
+    {2438, 111, 279, 183, 1, 6943}, // MS_ICAT_heavy_reagent
+    {2439, 111, 279, 183, 1, 6950}, // MS_ICAT_light_reagent
+    {2440, 111, 279, 183, 1, 6957}, // MS_ICPL_reagent
+    {2441, 111, 279, 183, 1, 6963}, // MS_ICPL_reagent_0
+    {2442, 111, 279, 183, 1, 6970}, // MS_ICPL_reagent_4
+    {2443, 111, 279, 183, 1, 6977}, // MS_ICPL_reagent_6
+    {2444, 111, 279, 183, 1, 6984}, // MS_ICPL_reagent_10
+    {2445, 111, 279, 183, 1, 6991}, // MS_SILAC_reagent
+    {2446, 111, 279, 183, 1, 6997}, // MS_SILAC_heavy_reagent
+    {2447, 111, 279, 183, 1, 7004}, // MS_SILAC_medium_reagent
+    {2448, 111, 279, 183, 1, 7011}, // MS_SILAC_light_reagent
+    {2449, 111, 279, 183, 1, 7018}, // MS_TMT_reagent
+    {2450, 111, 279, 183, 1, 7024}, // MS_TMT_reagent_126
+    {2451, 111, 279, 183, 1, 7031}, // MS_TMT_reagent_127
+    {2452, 111, 279, 183, 1, 7038}, // MS_TMT_reagent_128
+    {2453, 111, 279, 183, 1, 7045}, // MS_TMT_reagent_129
+    {2454, 111, 279, 183, 1, 7052}, // MS_TMT_reagent_130
+    {2455, 111, 279, 183, 1, 7059}, // MS_TMT_reagent_131
+    {2456, 111, 279, 183, 1, 7066}, // MS_iTRAQ_reagent
+    {2457, 111, 279, 183, 1, 7072}, // MS_iTRAQ_reagent_113
+    {2458, 111, 279, 183, 1, 7079}, // MS_iTRAQ_reagent_114
+    {2459, 111, 279, 183, 1, 7086}, // MS_iTRAQ_reagent_115
+    {2460, 111, 279, 183, 1, 7093}, // MS_iTRAQ_reagent_116
+    {2461, 111, 279, 183, 1, 7100}, // MS_iTRAQ_reagent_117
+    {2462, 111, 279, 183, 1, 7107}, // MS_iTRAQ_reagent_118
+    {2463, 111, 279, 183, 1, 7114}, // MS_iTRAQ_reagent_119
+    {2464, 111, 279, 183, 1, 7121}, // MS_iTRAQ_reagent_121
+    {2465, 111, 279, 183, 1, 7128}, // MS_Electron_Transfer_Higher_Energy_Collision_Dissociation__EThcD_
+    {2466, 111, 279, 184, 1, 7129}, // MS_jPOST_dataset_identifier
+    {2467, 111, 279, 184, 1, 7130}, // MS_jPOST_dataset_URI
+    {2468, 111, 279, 184, 1, 7131}, // MS_Q_Exactive_Plus
+    {2469, 111, 279, 184, 1, 7134}, // MS_proteogenomics_search
+    {2470, 111, 279, 184, 1, 7137}, // MS_proteogenomics_attribute
+    {2471, 111, 279, 184, 1, 7142}, // MS_chromosome_name
+    {2472, 111, 279, 184, 1, 7148}, // MS_chromosome_strand
+    {2473, 111, 279, 184, 1, 7154}, // MS_peptide_start_on_chromosome_OBSOLETE
+    {2474, 111, 279, 184, 1, 7160}, // MS_peptide_end_on_chromosome
+    {2475, 111, 279, 184, 1, 7166}, // MS_peptide_exon_count
+    {2476, 111, 279, 184, 1, 7172}, // MS_peptide_exon_nucleotide_sizes
+    {2477, 111, 279, 184, 1, 7178}, // MS_peptide_start_positions_on_chromosome
+    {2478, 111, 279, 184, 1, 7184}, // MS_genome_reference_version
+    {2479, 111, 279, 184, 1, 7190}, // MS_MSDK
+    {2481, 111, 279, 184, 1, 7193}, // MS_native_spectrum_identifier_format__combined_spectra
+    {2481, 112, 279, 185, 1, 7193}, // MS_Thermo_nativeID_format__combined_spectra
+    {2482, 112, 279, 185, 1, 7194}, // MS_Waters_nativeID_format__combined_spectra
+    {2483, 112, 279, 185, 1, 7195}, // MS_WIFF_nativeID_format__combined_spectra
+    {2484, 112, 279, 185, 1, 7196}, // MS_Bruker_Agilent_YEP_nativeID_format__combined_spectra
+    {2485, 112, 279, 185, 1, 7197}, // MS_Bruker_BAF_nativeID_format__combined_spectra
+    {2486, 112, 279, 185, 1, 7198}, // MS_Bruker_FID_nativeID_format__combined_spectra
+    {2487, 112, 279, 185, 1, 7199}, // MS_multiple_peak_list_nativeID_format__combined_spectra
+    {2488, 112, 279, 185, 1, 7200}, // MS_single_peak_list_nativeID_format__combined_spectra
+    {2489, 112, 279, 185, 1, 7201}, // MS_scan_number_only_nativeID_format__combined_spectra
+    {2490, 112, 279, 185, 1, 7202}, // MS_spectrum_identifier_nativeID_format__combined_spectra
+    {2491, 112, 279, 185, 1, 7203}, // MS_mzML_unique_identifier__combined_spectra
+    {2492, 112, 279, 185, 1, 7204}, // MS_identification_parameter
+    {2492, 113, 279, 185, 1, 7204}, // MS_UniProtKB_text_sequence_format
+    {2493, 113, 279, 185, 1, 7207}, // MS_UniProtKB_XML_sequence_format
+    {2494, 113, 279, 185, 1, 7210}, // MS_Morpheus
+    {2495, 113, 279, 185, 1, 7212}, // MS_Morpheus_Morpheus_score
+    {2496, 113, 280, 185, 1, 7219}, // MS_Morpheus_summed_Morpheus_score
+    {2497, 113, 281, 185, 1, 7226}, // MS_interaction_score_derived_from_cross_linking
+    {2498, 113, 282, 185, 1, 7227}, // MS_regular_expression_for_interaction_scores_derived_from_cross_linking
+    {2499, 113, 282, 185, 1, 7228}, // MS_impact_II
+    {2500, 113, 282, 185, 1, 7231}, // MS_impact_HD
+    {2501, 113, 282, 185, 1, 7234}, // MS_frag__iTRAQ_4plex_reporter_ion
+    {2502, 113, 282, 185, 1, 7240}, // MS_frag__iTRAQ_8plex_reporter_ion
+    {2503, 113, 282, 185, 1, 7246}, // MS_frag__TMT_reporter_ion
+    {2504, 113, 282, 185, 1, 7252}, // MS_frag__TMT_ETD_reporter_ion
+    {2505, 113, 282, 185, 1, 7258}, // MS_no_modification_threshold
+    {2506, 113, 282, 185, 1, 7260}, // MS_OpenXQuest
+    {2507, 113, 282, 185, 1, 7264}, // MS_X500R_QTOF
+    {2508, 113, 282, 185, 1, 7266}, // MS_cross_linking_result_details
+    {2508, 114, 282, 185, 1, 7266}, // MS_protein_pair_level_global_FDR
+    {2509, 114, 284, 185, 1, 7268}, // MS_residue_pair_level_global_FDR
+    {2510, 114, 286, 185, 1, 7270}, // MS_supplemental_higher_energy_beam_type_collision_induced_dissociation
+    {2511, 114, 286, 185, 1, 7273}, // MS_supplemental_collision_induced_dissociation
+    {2512, 114, 286, 185, 1, 7274}, // MS_supplemental_collision_energy
+    {2513, 114, 287, 185, 1, 7275}, // MS_OpenXQuest_combined_score
+    {2515, 114, 288, 185, 1, 7283}, // MS_OpenXQuest_xcorr_xlink
+    {2517, 114, 289, 185, 1, 7291}, // MS_OpenXQuest_xcorr_common
+    {2519, 114, 290, 185, 1, 7299}, // MS_OpenXQuest_match_odds
+    {2521, 114, 292, 185, 1, 7307}, // MS_OpenXQuest_intsum
+    {2523, 114, 294, 185, 1, 7315}, // MS_OpenXQuest_wTIC
+    {2525, 114, 296, 185, 1, 7323}, // MS_analysis_attribute
+    {2526, 114, 296, 185, 1, 7324}, // MS_PTM_localization_attribute
+    {2527, 114, 296, 185, 1, 7326}, // MS_PTM_localization_single_result_statistic
+    {2528, 114, 296, 185, 1, 7329}, // MS_PTM_localization_result_list_statistic
+    {2529, 114, 296, 185, 1, 7332}, // MS_global_FLR
+    {2530, 114, 296, 185, 1, 7336}, // MS_local_FLR_at_threshold
+    {2531, 114, 296, 185, 1, 7340}, // MS_identification_attribute
+    {2532, 114, 296, 185, 1, 7342}, // MS_single_identification_result_attribute
+    {2533, 114, 296, 185, 1, 7345}, // MS_frag__isobaric_label_ion
+    {2534, 114, 296, 185, 1, 7351}, // MS_secondary_isotope_peak
+    {2535, 114, 296, 185, 1, 7357}, // MS_protein_cluster_identification_attribute
+    {2536, 114, 296, 185, 1, 7361}, // MS_result_list_attribute
+    {2537, 114, 296, 185, 1, 7364}, // MS_PSM_level_result_list_attribute
+    {2538, 114, 296, 185, 1, 7368}, // MS_PSM_level_result_list_statistic
+    {2539, 114, 296, 185, 1, 7373}, // MS_peptide_sequence_level_result_list_attribute
+    {2540, 114, 296, 185, 1, 7377}, // MS_peptide_sequence_level_result_list_statistic
+    {2541, 114, 296, 185, 1, 7382}, // MS_protein_level_result_list_attribute
+    {2542, 114, 296, 185, 1, 7386}, // MS_protein_level_result_list_statistic
+    {2543, 114, 296, 185, 1, 7391}, // MS_protein_group_level_result_list_statistic
+    {2544, 114, 296, 185, 1, 7396}, // UNIMOD_unimod_root_node
+    {2544, 114, 296, 185, 1, 7396}, // UNIMOD_Acetyl
+    {2545, 114, 296, 185, 35, 7397}, // UNIMOD_Amidated
+    {2546, 114, 296, 185, 45, 7398}, // UNIMOD_Biotin
+    {2547, 114, 296, 185, 55, 7399}, // UNIMOD_Carbamidomethyl
+    {2548, 114, 296, 185, 97, 7400}, // UNIMOD_Carbamyl
+    {2549, 114, 296, 185, 135, 7401}, // UNIMOD_Carboxymethyl
+    {2550, 114, 296, 185, 157, 7402}, // UNIMOD_Deamidated
+    {2551, 114, 296, 185, 175, 7403}, // UNIMOD_ICAT_G
+    {2552, 114, 296, 185, 181, 7404}, // UNIMOD_ICAT_G_2H_8_
+    {2553, 114, 296, 185, 187, 7405}, // UNIMOD_Met__Hse
+    {2554, 114, 296, 185, 193, 7406}, // UNIMOD_Met__Hsl
+    {2555, 114, 296, 185, 199, 7407}, // UNIMOD_ICAT_D_2H_8_
+    {2556, 114, 296, 185, 205, 7408}, // UNIMOD_ICAT_D
+    {2557, 114, 296, 185, 211, 7409}, // UNIMOD_NIPCAM
+    {2558, 114, 296, 185, 217, 7410}, // UNIMOD_PEO_Iodoacetyl_LC_Biotin
+    {2559, 114, 296, 185, 223, 7411}, // UNIMOD_Phospho
+    {2560, 114, 296, 185, 257, 7412}, // UNIMOD_Dehydrated
+    {2561, 114, 296, 185, 287, 7413}, // UNIMOD_Propionamide
+    {2562, 114, 296, 185, 301, 7414}, // UNIMOD_Pyridylacetyl
+    {2563, 114, 296, 185, 311, 7415}, // UNIMOD_Pyro_carbamidomethyl
+    {2564, 114, 296, 185, 317, 7416}, // UNIMOD_Glu__pyro_Glu
+    {2565, 114, 296, 185, 323, 7417}, // UNIMOD_Gln__pyro_Glu
+    {2566, 114, 296, 185, 329, 7418}, // UNIMOD_SMA
+    {2567, 114, 296, 185, 339, 7419}, // UNIMOD_Cation_Na
+    {2568, 114, 296, 185, 353, 7420}, // UNIMOD_Pyridylethyl
+    {2569, 114, 296, 185, 359, 7421}, // UNIMOD_Methyl
+    {2570, 114, 296, 185, 421, 7422}, // UNIMOD_Oxidation
+    {2571, 114, 296, 185, 475, 7423}, // UNIMOD_Dimethyl
+    {2572, 114, 296, 185, 501, 7424}, // UNIMOD_Trimethyl
+    {2573, 114, 296, 185, 515, 7425}, // UNIMOD_Methylthio
+    {2574, 114, 296, 185, 537, 7426}, // UNIMOD_Sulfo
+    {2575, 114, 296, 185, 555, 7427}, // UNIMOD_Hex
+    {2576, 114, 296, 185, 593, 7428}, // UNIMOD_Lipoyl
+    {2577, 114, 296, 185, 599, 7429}, // UNIMOD_HexNAc
+    {2578, 114, 296, 185, 613, 7430}, // UNIMOD_Farnesyl
+    {2579, 114, 296, 185, 619, 7431}, // UNIMOD_Myristoyl
+    {2580, 114, 296, 185, 633, 7432}, // UNIMOD_PyridoxalPhosphate
+    {2581, 114, 296, 185, 639, 7433}, // UNIMOD_Palmitoyl
+    {2582, 114, 296, 185, 661, 7434}, // UNIMOD_GeranylGeranyl
+    {2583, 114, 296, 185, 667, 7435}, // UNIMOD_Phosphopantetheine
+    {2584, 114, 296, 185, 673, 7436}, // UNIMOD_FAD
+    {2585, 114, 296, 185, 687, 7437}, // UNIMOD_Tripalmitate
+    {2586, 114, 296, 185, 693, 7438}, // UNIMOD_Guanidinyl
+    {2587, 114, 296, 185, 703, 7439}, // UNIMOD_HNE
+    {2588, 114, 296, 185, 725, 7440}, // UNIMOD_Glucuronyl
+    {2589, 114, 296, 185, 739, 7441}, // UNIMOD_Glutathione
+    {2590, 114, 296, 185, 745, 7442}, // UNIMOD_Acetyl_2H_3_
+    {2591, 114, 296, 185, 775, 7443}, // UNIMOD_Propionyl
+    {2592, 114, 296, 185, 797, 7444}, // UNIMOD_Propionyl_13C_3_
+    {2593, 114, 296, 185, 807, 7445}, // UNIMOD_GIST_Quat
+    {2594, 114, 296, 185, 817, 7446}, // UNIMOD_GIST_Quat_2H_3_
+    {2595, 114, 296, 185, 827, 7447}, // UNIMOD_GIST_Quat_2H_6_
+    {2596, 114, 296, 185, 837, 7448}, // UNIMOD_GIST_Quat_2H_9_
+    {2597, 114, 296, 185, 847, 7449}, // UNIMOD_Succinyl
+    {2598, 114, 296, 185, 861, 7450}, // UNIMOD_Succinyl_2H_4_
+    {2599, 114, 296, 185, 871, 7451}, // UNIMOD_Succinyl_13C_4_
+    {2600, 114, 296, 185, 881, 7452}, // UNIMOD_Iminobiotin
+    {2601, 114, 296, 185, 891, 7453}, // UNIMOD_ESP
+    {2602, 114, 296, 185, 901, 7454}, // UNIMOD_ESP_2H_10_
+    {2603, 114, 296, 185, 911, 7455}, // UNIMOD_NHS_LC_Biotin
+    {2604, 114, 296, 185, 921, 7456}, // UNIMOD_EDT_maleimide_PEO_biotin
+    {2605, 114, 296, 185, 931, 7457}, // UNIMOD_IMID
+    {2606, 114, 296, 185, 937, 7458}, // UNIMOD_IMID_2H_4_
+    {2607, 114, 296, 185, 943, 7459}, // UNIMOD_Propionamide_2H_3_
+    {2608, 114, 296, 185, 949, 7460}, // UNIMOD_ICAT_C
+    {2609, 114, 296, 185, 955, 7461}, // UNIMOD_ICAT_C_13C_9_
+    {2610, 114, 296, 185, 961, 7462}, // UNIMOD_FormylMet
+    {2611, 114, 296, 185, 967, 7463}, // UNIMOD_Nethylmaleimide
+    {2612, 114, 296, 185, 973, 7464}, // UNIMOD_OxLysBiotinRed
+    {2613, 114, 296, 185, 979, 7465}, // UNIMOD_OxLysBiotin
+    {2614, 114, 296, 185, 985, 7466}, // UNIMOD_OxProBiotinRed
+    {2615, 114, 296, 185, 991, 7467}, // UNIMOD_OxProBiotin
+    {2616, 114, 296, 185, 997, 7468}, // UNIMOD_OxArgBiotin
+    {2617, 114, 296, 185, 1003, 7469}, // UNIMOD_OxArgBiotinRed
+    {2618, 114, 296, 185, 1009, 7470}, // UNIMOD_EDT_iodoacetyl_PEO_biotin
+    {2619, 114, 296, 185, 1019, 7471}, // UNIMOD_IBTP
+    {2620, 114, 296, 185, 1025, 7472}, // UNIMOD_GG
+    {2621, 114, 296, 185, 1043, 7473}, // UNIMOD_Formyl
+    {2622, 114, 296, 185, 1065, 7474}, // UNIMOD_ICAT_H
+    {2623, 114, 296, 185, 1071, 7475}, // UNIMOD_ICAT_H_13C_6_
+    {2624, 114, 296, 185, 1077, 7476}, // UNIMOD_Thioacyl
+    {2625, 114, 296, 185, 1087, 7477}, // UNIMOD_Fluoro
+    {2626, 114, 296, 185, 1105, 7478}, // UNIMOD_Fluorescein
+    {2627, 114, 296, 185, 1111, 7479}, // UNIMOD_Iodo
+    {2628, 114, 296, 185, 1121, 7480}, // UNIMOD_Diiodo
+    {2629, 114, 296, 185, 1131, 7481}, // UNIMOD_Triiodo
+    {2630, 114, 296, 185, 1137, 7482}, // UNIMOD_Myristoleyl
+    {2631, 114, 296, 185, 1143, 7483}, // UNIMOD_Myristoyl_Delta_H__4_
+    {2632, 114, 296, 185, 1149, 7484}, // UNIMOD_Benzoyl
+    {2633, 114, 296, 185, 1159, 7485}, // UNIMOD_Hex_5_HexNAc_2_
+    {2634, 114, 296, 185, 1165, 7486}, // UNIMOD_Dansyl
+    {2635, 114, 296, 185, 1175, 7487}, // UNIMOD_a_type_ion
+    {2636, 114, 296, 185, 1181, 7488}, // UNIMOD_Amidine
+    {2637, 114, 296, 185, 1191, 7489}, // UNIMOD_HexNAc_1_dHex_1_
+    {2638, 114, 296, 185, 1205, 7490}, // UNIMOD_HexNAc_2_
+    {2639, 114, 296, 185, 1219, 7491}, // UNIMOD_Hex_3_
+    {2640, 114, 296, 185, 1233, 7492}, // UNIMOD_HexNAc_1_dHex_2_
+    {2641, 114, 296, 185, 1239, 7493}, // UNIMOD_Hex_1_HexNAc_1_dHex_1_
+    {2642, 114, 296, 185, 1253, 7494}, // UNIMOD_HexNAc_2_dHex_1_
+    {2643, 114, 296, 185, 1259, 7495}, // UNIMOD_Hex_1_HexNAc_2_
+    {2644, 114, 296, 185, 1273, 7496}, // UNIMOD_Hex_1_HexNAc_1_NeuAc_1_
+    {2645, 114, 296, 185, 1287, 7497}, // UNIMOD_HexNAc_2_dHex_2_
+    {2646, 114, 296, 185, 1293, 7498}, // UNIMOD_Hex_1_HexNAc_2_Pent_1_
+    {2647, 114, 296, 185, 1299, 7499}, // UNIMOD_Hex_1_HexNAc_2_dHex_1_
+    {2648, 114, 296, 185, 1313, 7500}, // UNIMOD_Hex_2_HexNAc_2_
+    {2649, 114, 296, 185, 1327, 7501}, // UNIMOD_Hex_3_HexNAc_1_Pent_1_
+    {2650, 114, 296, 185, 1333, 7502}, // UNIMOD_Hex_1_HexNAc_2_dHex_1_Pent_1_
+    {2651, 114, 296, 185, 1339, 7503}, // UNIMOD_Hex_1_HexNAc_2_dHex_2_
+    {2652, 114, 296, 185, 1353, 7504}, // UNIMOD_Hex_2_HexNAc_2_Pent_1_
+    {2653, 114, 296, 185, 1359, 7505}, // UNIMOD_Hex_2_HexNAc_2_dHex_1_
+    {2654, 114, 296, 185, 1373, 7506}, // UNIMOD_Hex_3_HexNAc_2_
+    {2655, 114, 296, 185, 1387, 7507}, // UNIMOD_Hex_1_HexNAc_1_NeuAc_2_
+    {2656, 114, 296, 185, 1401, 7508}, // UNIMOD_Hex_3_HexNAc_2_Phos_1_
+    {2657, 114, 296, 185, 1407, 7509}, // UNIMOD_Delta_S__1_Se_1_
+    {2658, 114, 296, 185, 1417, 7510}, // UNIMOD_Delta_H_1_N__1_18O_1_
+    {2659, 114, 296, 185, 1423, 7511}, // UNIMOD_NBS_13C_6_
+    {2660, 114, 296, 185, 1429, 7512}, // UNIMOD_NBS
+    {2661, 114, 296, 185, 1435, 7513}, // UNIMOD_BHT
+    {2662, 114, 296, 185, 1449, 7514}, // UNIMOD_DAET
+    {2663, 114, 296, 185, 1459, 7515}, // UNIMOD_Label_13C_9_
+    {2664, 114, 296, 185, 1469, 7516}, // UNIMOD_Label_13C_9__Phospho
+    {2665, 114, 296, 185, 1475, 7517}, // UNIMOD_HPG
+    {2666, 114, 296, 185, 1481, 7518}, // UNIMOD_2HPG
+    {2667, 114, 296, 185, 1487, 7519}, // UNIMOD_Label_13C_6_
+    {2668, 114, 296, 185, 1505, 7520}, // UNIMOD_Label_18O_2_
+    {2669, 114, 296, 185, 1511, 7521}, // UNIMOD_AccQTag
+    {2670, 114, 296, 185, 1521, 7522}, // UNIMOD_QAT
+    {2671, 114, 296, 185, 1527, 7523}, // UNIMOD_QAT_2H_3_
+    {2672, 114, 296, 185, 1533, 7524}, // UNIMOD_EQAT
+    {2673, 114, 296, 185, 1539, 7525}, // UNIMOD_EQAT_2H_5_
+    {2674, 114, 296, 185, 1545, 7526}, // UNIMOD_Dimethyl_2H_4_
+    {2675, 114, 296, 185, 1563, 7527}, // UNIMOD_Ethanedithiol
+    {2676, 114, 296, 185, 1573, 7528}, // UNIMOD_Delta_H_6_C_6_O_1_
+    {2677, 114, 296, 185, 1579, 7529}, // UNIMOD_Delta_H_4_C_3_O_1_
+    {2678, 114, 296, 185, 1593, 7530}, // UNIMOD_Delta_H_2_C_3_
+    {2679, 114, 296, 185, 1599, 7531}, // UNIMOD_Delta_H_4_C_6_
+    {2680, 114, 296, 185, 1605, 7532}, // UNIMOD_Delta_H_8_C_6_O_2_
+    {2681, 114, 296, 185, 1611, 7533}, // UNIMOD_NEIAA
+    {2682, 114, 296, 185, 1621, 7534}, // UNIMOD_NEIAA_2H_5_
+    {2683, 114, 296, 185, 1631, 7535}, // UNIMOD_ADP_Ribosyl
+    {2684, 114, 296, 185, 1665, 7536}, // UNIMOD_iTRAQ4plex
+    {2685, 114, 296, 185, 1695, 7537}, // UNIMOD_IGBP
+    {2686, 114, 296, 185, 1701, 7538}, // UNIMOD_Crotonaldehyde
+    {2687, 114, 296, 185, 1715, 7539}, // UNIMOD_Delta_H_2_C_2_
+    {2688, 114, 296, 185, 1733, 7540}, // UNIMOD_Delta_H_4_C_2_
+    {2689, 114, 296, 185, 1747, 7541}, // UNIMOD_Delta_H_4_C_3_
+    {2690, 114, 296, 185, 1761, 7542}, // UNIMOD_Label_18O_1_
+    {2691, 114, 296, 185, 1779, 7543}, // UNIMOD_Label_13C_6_15N_2_
+    {2692, 114, 296, 185, 1785, 7544}, // UNIMOD_Thiophospho
+    {2693, 114, 296, 185, 1799, 7545}, // UNIMOD_SPITC
+    {2694, 114, 296, 185, 1809, 7546}, // UNIMOD_Label_2H_3_
+    {2695, 114, 296, 185, 1819, 7547}, // UNIMOD_PET
+    {2696, 114, 296, 185, 1829, 7548}, // UNIMOD_Label_13C_6_15N_4_
+    {2697, 114, 296, 185, 1835, 7549}, // UNIMOD_Label_13C_5_15N_1_
+    {2698, 114, 296, 185, 1853, 7550}, // UNIMOD_Label_13C_9_15N_1_
+    {2699, 114, 296, 185, 1859, 7551}, // UNIMOD_Cytopiloyne
+    {2700, 114, 296, 185, 1889, 7552}, // UNIMOD_Cytopiloyne_water
+    {2701, 114, 296, 185, 1919, 7553}, // UNIMOD_CAF
+    {2702, 114, 296, 185, 1925, 7554}, // UNIMOD_Xlink_SSD
+    {2703, 114, 296, 185, 1931, 7555}, // UNIMOD_Nitrosyl
+    {2704, 114, 296, 185, 1937, 7556}, // UNIMOD_AEBS
+    {2705, 114, 296, 185, 1959, 7557}, // UNIMOD_Ethanolyl
+    {2706, 114, 296, 185, 1973, 7558}, // UNIMOD_Ethyl
+    {2707, 114, 296, 185, 1999, 7559}, // UNIMOD_CoenzymeA
+    {2708, 114, 296, 185, 2005, 7560}, // UNIMOD_Methyl_2H_2_
+    {2709, 114, 296, 185, 2015, 7561}, // UNIMOD_SulfanilicAcid
+    {2710, 114, 296, 185, 2029, 7562}, // UNIMOD_SulfanilicAcid_13C_6_
+    {2711, 114, 296, 185, 2043, 7563}, // UNIMOD_Trp__Oxolactone
+    {2712, 114, 296, 185, 2049, 7564}, // UNIMOD_Biotin_PEO_Amine
+    {2713, 114, 296, 185, 2063, 7565}, // UNIMOD_Biotin_HPDP
+    {2714, 114, 296, 185, 2069, 7566}, // UNIMOD_Delta_Hg_1_
+    {2715, 114, 296, 185, 2075, 7567}, // UNIMOD_IodoU_AMP
+    {2716, 114, 296, 185, 2089, 7568}, // UNIMOD_CAMthiopropanoyl
+    {2717, 114, 296, 185, 2099, 7569}, // UNIMOD_IED_Biotin
+    {2718, 114, 296, 185, 2105, 7570}, // UNIMOD_dHex
+    {2719, 114, 296, 185, 2119, 7571}, // UNIMOD_Methyl_2H_3_
+    {2720, 114, 296, 185, 2141, 7572}, // UNIMOD_Carboxy
+    {2721, 114, 296, 185, 2163, 7573}, // UNIMOD_Bromobimane
+    {2722, 114, 296, 185, 2169, 7574}, // UNIMOD_Menadione
+    {2723, 114, 296, 185, 2179, 7575}, // UNIMOD_DeStreak
+    {2724, 114, 296, 185, 2185, 7576}, // UNIMOD_dHex_1_Hex_3_HexNAc_4_
+    {2725, 114, 296, 185, 2199, 7577}, // UNIMOD_dHex_1_Hex_4_HexNAc_4_
+    {2726, 114, 296, 185, 2213, 7578}, // UNIMOD_dHex_1_Hex_5_HexNAc_4_
+    {2727, 114, 296, 185, 2219, 7579}, // UNIMOD_Hex_3_HexNAc_4_
+    {2728, 114, 296, 185, 2233, 7580}, // UNIMOD_Hex_4_HexNAc_4_
+    {2729, 114, 296, 185, 2247, 7581}, // UNIMOD_Hex_5_HexNAc_4_
+    {2730, 114, 296, 185, 2261, 7582}, // UNIMOD_Cysteinyl
+    {2731, 114, 296, 185, 2267, 7583}, // UNIMOD_Lys_loss
+    {2732, 114, 296, 185, 2273, 7584}, // UNIMOD_Nmethylmaleimide
+    {2733, 114, 296, 185, 2283, 7585}, // UNIMOD_DimethylpyrroleAdduct
+    {2734, 114, 296, 185, 2289, 7586}, // UNIMOD_Delta_H_2_C_5_
+    {2735, 114, 296, 185, 2295, 7587}, // UNIMOD_Delta_H_2_C_3_O_1_
+    {2736, 114, 296, 185, 2305, 7588}, // UNIMOD_Nethylmaleimide_water
+    {2737, 114, 296, 185, 2315, 7589}, // UNIMOD_Xlink_B10621
+    {2738, 114, 296, 185, 2321, 7590}, // UNIMOD_DTBP
+    {2739, 114, 296, 185, 2343, 7591}, // UNIMOD_FP_Biotin
+    {2740, 114, 296, 185, 2361, 7592}, // UNIMOD_Delta_H_4_C_2_O__1_S_1_
+    {2741, 114, 296, 185, 2367, 7593}, // UNIMOD_Methyl_2H_3_13C_1_
+    {2742, 114, 296, 185, 2381, 7594}, // UNIMOD_Dimethyl_2H_6_13C_2_
+    {2743, 114, 296, 185, 2399, 7595}, // UNIMOD_Thiophos_S_S_biotin
+    {2744, 114, 296, 185, 2413, 7596}, // UNIMOD_Can_FP_biotin
+    {2745, 114, 296, 185, 2427, 7597}, // UNIMOD_HNE_Delta_H_2_
+    {2746, 114, 296, 185, 2441, 7598}, // UNIMOD_Methylamine
+    {2747, 114, 296, 185, 2451, 7599}, // UNIMOD_Bromo
+    {2748, 114, 296, 185, 2469, 7600}, // UNIMOD_Amino
+    {2749, 114, 296, 185, 2475, 7601}, // UNIMOD_Argbiotinhydrazide
+    {2750, 114, 296, 185, 2481, 7602}, // UNIMOD_Arg__GluSA
+    {2751, 114, 296, 185, 2487, 7603}, // UNIMOD_Trioxidation
+    {2752, 114, 296, 185, 2501, 7604}, // UNIMOD_His__Asn
+    {2753, 114, 296, 185, 2507, 7605}, // UNIMOD_His__Asp
+    {2754, 114, 296, 185, 2513, 7606}, // UNIMOD_Trp__Hydroxykynurenin
+    {2755, 114, 296, 185, 2519, 7607}, // UNIMOD_Trp__Kynurenin
+    {2756, 114, 296, 185, 2525, 7608}, // UNIMOD_Lys__Allysine
+    {2757, 114, 296, 185, 2531, 7609}, // UNIMOD_Lysbiotinhydrazide
+    {2758, 114, 296, 185, 2537, 7610}, // UNIMOD_Nitro
+    {2759, 114, 296, 185, 2547, 7611}, // UNIMOD_probiotinhydrazide
+    {2760, 114, 296, 185, 2553, 7612}, // UNIMOD_Pro__pyro_Glu
+    {2761, 114, 296, 185, 2559, 7613}, // UNIMOD_Pro__Pyrrolidinone
+    {2762, 114, 296, 185, 2565, 7614}, // UNIMOD_Thrbiotinhydrazide
+    {2763, 114, 296, 185, 2571, 7615}, // UNIMOD_Diisopropylphosphate
+    {2764, 114, 296, 185, 2593, 7616}, // UNIMOD_Isopropylphospho
+    {2765, 114, 296, 185, 2607, 7617}, // UNIMOD_ICPL_13C_6_
+    {2766, 114, 296, 185, 2621, 7618}, // UNIMOD_ICPL
+    {2767, 114, 296, 185, 2635, 7619}, // UNIMOD_Deamidated_18O_1_
+    {2768, 114, 296, 185, 2645, 7620}, // UNIMOD_Cys__Dha
+    {2769, 114, 296, 185, 2651, 7621}, // UNIMOD_Pro__Pyrrolidone
+    {2770, 114, 296, 185, 2657, 7622}, // UNIMOD_HMVK
+    {2771, 114, 296, 185, 2663, 7623}, // UNIMOD_Arg__Orn
+    {2772, 114, 296, 185, 2669, 7624}, // UNIMOD_Dehydro
+    {2773, 114, 296, 185, 2675, 7625}, // UNIMOD_Diphthamide
+    {2774, 114, 296, 185, 2681, 7626}, // UNIMOD_Hydroxyfarnesyl
+    {2775, 114, 296, 185, 2687, 7627}, // UNIMOD_Diacylglycerol
+    {2776, 114, 296, 185, 2693, 7628}, // UNIMOD_Carboxyethyl
+    {2777, 114, 296, 185, 2703, 7629}, // UNIMOD_Hypusine
+    {2778, 114, 296, 185, 2709, 7630}, // UNIMOD_Retinylidene
+    {2779, 114, 296, 185, 2715, 7631}, // UNIMOD_Lys__AminoadipicAcid
+    {2780, 114, 296, 185, 2721, 7632}, // UNIMOD_Cys__PyruvicAcid
+    {2781, 114, 296, 185, 2727, 7633}, // UNIMOD_Ammonia_loss
+    {2782, 114, 296, 185, 2745, 7634}, // UNIMOD_Phycocyanobilin
+    {2783, 114, 296, 185, 2751, 7635}, // UNIMOD_Phycoerythrobilin
+    {2784, 114, 296, 185, 2757, 7636}, // UNIMOD_Phytochromobilin
+    {2785, 114, 296, 185, 2763, 7637}, // UNIMOD_Heme
+    {2786, 114, 296, 185, 2773, 7638}, // UNIMOD_Molybdopterin
+    {2787, 114, 296, 185, 2779, 7639}, // UNIMOD_Quinone
+    {2788, 114, 296, 185, 2789, 7640}, // UNIMOD_Glucosylgalactosyl
+    {2789, 114, 296, 185, 2795, 7641}, // UNIMOD_GPIanchor
+    {2790, 114, 296, 185, 2801, 7642}, // UNIMOD_PhosphoribosyldephosphoCoA
+    {2791, 114, 296, 185, 2807, 7643}, // UNIMOD_GlycerylPE
+    {2792, 114, 296, 185, 2813, 7644}, // UNIMOD_Triiodothyronine
+    {2793, 114, 296, 185, 2819, 7645}, // UNIMOD_Thyroxine
+    {2794, 114, 296, 185, 2825, 7646}, // UNIMOD_Tyr__Dha
+    {2795, 114, 296, 185, 2831, 7647}, // UNIMOD_Didehydro
+    {2796, 114, 296, 185, 2849, 7648}, // UNIMOD_Cys__Oxoalanine
+    {2797, 114, 296, 185, 2855, 7649}, // UNIMOD_Ser__LacticAcid
+    {2798, 114, 296, 185, 2861, 7650}, // UNIMOD_Phosphoadenosine
+    {2799, 114, 296, 185, 2879, 7651}, // UNIMOD_Hydroxycinnamyl
+    {2800, 114, 296, 185, 2885, 7652}, // UNIMOD_Glycosyl
+    {2801, 114, 296, 185, 2891, 7653}, // UNIMOD_FMNH
+    {2802, 114, 296, 185, 2901, 7654}, // UNIMOD_Archaeol
+    {2803, 114, 296, 185, 2907, 7655}, // UNIMOD_Phenylisocyanate
+    {2804, 114, 296, 185, 2913, 7656}, // UNIMOD_Phenylisocyanate_2H_5_
+    {2805, 114, 296, 185, 2919, 7657}, // UNIMOD_Phosphoguanosine
+    {2806, 114, 296, 185, 2929, 7658}, // UNIMOD_Hydroxymethyl
+    {2807, 114, 296, 185, 2935, 7659}, // UNIMOD_MolybdopterinGD_Delta_S__1_Se_1_
+    {2808, 114, 296, 185, 2941, 7660}, // UNIMOD_Dipyrrolylmethanemethyl
+    {2809, 114, 296, 185, 2947, 7661}, // UNIMOD_PhosphoUridine
+    {2810, 114, 296, 185, 2957, 7662}, // UNIMOD_Glycerophospho
+    {2811, 114, 296, 185, 2963, 7663}, // UNIMOD_Carboxy__Thiocarboxy
+    {2812, 114, 296, 185, 2969, 7664}, // UNIMOD_Sulfide
+    {2813, 114, 296, 185, 2983, 7665}, // UNIMOD_PyruvicAcidIminyl
+    {2814, 114, 296, 185, 2997, 7666}, // UNIMOD_Delta_Se_1_
+    {2815, 114, 296, 185, 3003, 7667}, // UNIMOD_MolybdopterinGD
+    {2816, 114, 296, 185, 3017, 7668}, // UNIMOD_Dioxidation
+    {2817, 114, 296, 185, 3055, 7669}, // UNIMOD_Octanoyl
+    {2818, 114, 296, 185, 3069, 7670}, // UNIMOD_PhosphoHexNAc
+    {2819, 114, 296, 185, 3079, 7671}, // UNIMOD_PhosphoHex
+    {2820, 114, 296, 185, 3089, 7672}, // UNIMOD_Palmitoleyl
+    {2821, 114, 296, 185, 3103, 7673}, // UNIMOD_Cholesterol
+    {2822, 114, 296, 185, 3109, 7674}, // UNIMOD_Didehydroretinylidene
+    {2823, 114, 296, 185, 3115, 7675}, // UNIMOD_CHDH
+    {2824, 114, 296, 185, 3121, 7676}, // UNIMOD_Methylpyrroline
+    {2825, 114, 296, 185, 3127, 7677}, // UNIMOD_Hydroxyheme
+    {2826, 114, 296, 185, 3133, 7678}, // UNIMOD_MicrocinC7
+    {2827, 114, 296, 185, 3139, 7679}, // UNIMOD_Cyano
+    {2828, 114, 296, 185, 3145, 7680}, // UNIMOD_Diironsubcluster
+    {2829, 114, 296, 185, 3151, 7681}, // UNIMOD_Amidino
+    {2830, 114, 296, 185, 3157, 7682}, // UNIMOD_FMN
+    {2831, 114, 296, 185, 3167, 7683}, // UNIMOD_FMNC
+    {2832, 114, 296, 185, 3173, 7684}, // UNIMOD_CuSMo
+    {2833, 114, 296, 185, 3179, 7685}, // UNIMOD_Hydroxytrimethyl
+    {2834, 114, 296, 185, 3185, 7686}, // UNIMOD_Deoxy
+    {2835, 114, 296, 185, 3199, 7687}, // UNIMOD_Microcin
+    {2836, 114, 296, 185, 3205, 7688}, // UNIMOD_Decanoyl
+    {2837, 114, 296, 185, 3215, 7689}, // UNIMOD_Glu
+    {2838, 114, 296, 185, 3225, 7690}, // UNIMOD_GluGlu
+    {2839, 114, 296, 185, 3235, 7691}, // UNIMOD_GluGluGlu
+    {2840, 114, 296, 185, 3245, 7692}, // UNIMOD_GluGluGluGlu
+    {2841, 114, 296, 185, 3255, 7693}, // UNIMOD_HexN
+    {2842, 114, 296, 185, 3277, 7694}, // UNIMOD_Xlink_DMP_s
+    {2843, 114, 296, 185, 3287, 7695}, // UNIMOD_Xlink_DMP
+    {2844, 114, 296, 185, 3297, 7696}, // UNIMOD_NDA
+    {2845, 114, 296, 185, 3307, 7697}, // UNIMOD_SPITC_13C_6_
+    {2846, 114, 296, 185, 3317, 7698}, // UNIMOD_AEC_MAEC
+    {2847, 114, 296, 185, 3327, 7699}, // UNIMOD_TMAB
+    {2848, 114, 296, 185, 3337, 7700}, // UNIMOD_TMAB_2H_9_
+    {2849, 114, 296, 185, 3347, 7701}, // UNIMOD_FTC
+    {2850, 114, 296, 185, 3369, 7702}, // UNIMOD_Label_2H_4_
+    {2851, 114, 296, 185, 3383, 7703}, // UNIMOD_DHP
+    {2852, 114, 296, 185, 3389, 7704}, // UNIMOD_Hep
+    {2853, 114, 296, 185, 3415, 7705}, // UNIMOD_BADGE
+    {2854, 114, 296, 185, 3421, 7706}, // UNIMOD_CyDye_Cy3
+    {2855, 114, 296, 185, 3427, 7707}, // UNIMOD_CyDye_Cy5
+    {2856, 114, 296, 185, 3433, 7708}, // UNIMOD_BHTOH
+    {2857, 114, 296, 185, 3447, 7709}, // UNIMOD_IGBP_13C_2_
+    {2858, 114, 296, 185, 3453, 7710}, // UNIMOD_Nmethylmaleimide_water
+    {2859, 114, 296, 185, 3459, 7711}, // UNIMOD_PyMIC
+    {2860, 114, 296, 185, 3465, 7712}, // UNIMOD_LG_lactam_K
+    {2861, 114, 296, 185, 3475, 7713}, // UNIMOD_LG_Hlactam_K
+    {2862, 114, 296, 185, 3485, 7714}, // UNIMOD_LG_lactam_R
+    {2863, 114, 296, 185, 3491, 7715}, // UNIMOD_LG_Hlactam_R
+    {2864, 114, 296, 185, 3497, 7716}, // UNIMOD_Dimethyl_2H_4_13C_2_
+    {2865, 114, 296, 185, 3515, 7717}, // UNIMOD_Hex_2_
+    {2866, 114, 296, 185, 3525, 7718}, // UNIMOD_C8_QAT
+    {2867, 114, 296, 185, 3535, 7719}, // UNIMOD_PropylNAGthiazoline
+    {2868, 114, 296, 185, 3541, 7720}, // UNIMOD_FNEM
+    {2869, 114, 296, 185, 3547, 7721}, // UNIMOD_Diethyl
+    {2870, 114, 296, 185, 3557, 7722}, // UNIMOD_BisANS
+    {2871, 114, 296, 185, 3563, 7723}, // UNIMOD_Piperidine
+    {2872, 114, 296, 185, 3573, 7724}, // UNIMOD_Maleimide_PEO2_Biotin
+    {2873, 114, 296, 185, 3579, 7725}, // UNIMOD_Sulfo_NHS_LC_LC_Biotin
+    {2874, 114, 296, 185, 3589, 7726}, // UNIMOD_CLIP_TRAQ_2
+    {2875, 114, 296, 185, 3603, 7727}, // UNIMOD_Dethiomethyl
+    {2876, 114, 296, 185, 3609, 7728}, // UNIMOD_Methyl_Deamidated
+    {2877, 114, 296, 185, 3619, 7729}, // UNIMOD_Delta_H_5_C_2_
+    {2878, 114, 296, 185, 3625, 7730}, // UNIMOD_Cation_K
+    {2879, 114, 296, 185, 3639, 7731}, // UNIMOD_Cation_Cu_I_
+    {2880, 114, 296, 185, 3657, 7732}, // UNIMOD_iTRAQ4plex114
+    {2881, 114, 296, 185, 3671, 7733}, // UNIMOD_iTRAQ4plex115
+    {2882, 114, 296, 185, 3685, 7734}, // UNIMOD_Dibromo
+    {2883, 114, 296, 185, 3691, 7735}, // UNIMOD_LRGG
+    {2884, 114, 296, 185, 3697, 7736}, // UNIMOD_CLIP_TRAQ_3
+    {2885, 114, 296, 185, 3711, 7737}, // UNIMOD_CLIP_TRAQ_4
+    {2886, 114, 296, 185, 3725, 7738}, // UNIMOD_Biotin_Cayman_10141
+    {2887, 114, 296, 185, 3731, 7739}, // UNIMOD_Biotin_Cayman_10013
+    {2888, 114, 296, 185, 3737, 7740}, // UNIMOD_Ala__Ser
+    {2889, 114, 296, 185, 3743, 7741}, // UNIMOD_Ala__Thr
+    {2890, 114, 296, 185, 3749, 7742}, // UNIMOD_Ala__Asp
+    {2891, 114, 296, 185, 3755, 7743}, // UNIMOD_Ala__Pro
+    {2892, 114, 296, 185, 3761, 7744}, // UNIMOD_Ala__Gly
+    {2893, 114, 296, 185, 3767, 7745}, // UNIMOD_Ala__Glu
+    {2894, 114, 296, 185, 3773, 7746}, // UNIMOD_Ala__Val
+    {2895, 114, 296, 185, 3779, 7747}, // UNIMOD_Cys__Phe
+    {2896, 114, 296, 185, 3785, 7748}, // UNIMOD_Cys__Ser
+    {2897, 114, 296, 185, 3791, 7749}, // UNIMOD_Cys__Trp
+    {2898, 114, 296, 185, 3797, 7750}, // UNIMOD_Cys__Tyr
+    {2899, 114, 296, 185, 3803, 7751}, // UNIMOD_Cys__Arg
+    {2900, 114, 296, 185, 3809, 7752}, // UNIMOD_Cys__Gly
+    {2901, 114, 296, 185, 3815, 7753}, // UNIMOD_Asp__Ala
+    {2902, 114, 296, 185, 3821, 7754}, // UNIMOD_Asp__His
+    {2903, 114, 296, 185, 3827, 7755}, // UNIMOD_Asp__Asn
+    {2904, 114, 296, 185, 3833, 7756}, // UNIMOD_Asp__Gly
+    {2905, 114, 296, 185, 3839, 7757}, // UNIMOD_Asp__Tyr
+    {2906, 114, 296, 185, 3845, 7758}, // UNIMOD_Asp__Glu
+    {2907, 114, 296, 185, 3851, 7759}, // UNIMOD_Asp__Val
+    {2908, 114, 296, 185, 3857, 7760}, // UNIMOD_Glu__Ala
+    {2909, 114, 296, 185, 3863, 7761}, // UNIMOD_Glu__Gln
+    {2910, 114, 296, 185, 3869, 7762}, // UNIMOD_Glu__Asp
+    {2911, 114, 296, 185, 3875, 7763}, // UNIMOD_Glu__Lys
+    {2912, 114, 296, 185, 3881, 7764}, // UNIMOD_Glu__Gly
+    {2913, 114, 296, 185, 3887, 7765}, // UNIMOD_Glu__Val
+    {2914, 114, 296, 185, 3893, 7766}, // UNIMOD_Phe__Ser
+    {2915, 114, 296, 185, 3899, 7767}, // UNIMOD_Phe__Cys
+    {2916, 114, 296, 185, 3905, 7768}, // UNIMOD_Phe__Xle
+    {2917, 114, 296, 185, 3911, 7769}, // UNIMOD_Phe__Tyr
+    {2918, 114, 296, 185, 3917, 7770}, // UNIMOD_Phe__Val
+    {2919, 114, 296, 185, 3923, 7771}, // UNIMOD_Gly__Ala
+    {2920, 114, 296, 185, 3929, 7772}, // UNIMOD_Gly__Ser
+    {2921, 114, 296, 185, 3935, 7773}, // UNIMOD_Gly__Trp
+    {2922, 114, 296, 185, 3941, 7774}, // UNIMOD_Gly__Glu
+    {2923, 114, 296, 185, 3947, 7775}, // UNIMOD_Gly__Val
+    {2924, 114, 296, 185, 3953, 7776}, // UNIMOD_Gly__Asp
+    {2925, 114, 296, 185, 3959, 7777}, // UNIMOD_Gly__Cys
+    {2926, 114, 296, 185, 3965, 7778}, // UNIMOD_Gly__Arg
+    {2927, 114, 296, 185, 3971, 7779}, // UNIMOD_His__Pro
+    {2928, 114, 296, 185, 3977, 7780}, // UNIMOD_His__Tyr
+    {2929, 114, 296, 185, 3983, 7781}, // UNIMOD_His__Gln
+    {2930, 114, 296, 185, 3989, 7782}, // UNIMOD_His__Arg
+    {2931, 114, 296, 185, 3995, 7783}, // UNIMOD_His__Xle
+    {2932, 114, 296, 185, 4001, 7784}, // UNIMOD_Xle__Thr
+    {2933, 114, 296, 185, 4011, 7785}, // UNIMOD_Xle__Asn
+    {2934, 114, 296, 185, 4021, 7786}, // UNIMOD_Xle__Lys
+    {2935, 114, 296, 185, 4031, 7787}, // UNIMOD_Lys__Thr
+    {2936, 114, 296, 185, 4037, 7788}, // UNIMOD_Lys__Asn
+    {2937, 114, 296, 185, 4043, 7789}, // UNIMOD_Lys__Glu
+    {2938, 114, 296, 185, 4049, 7790}, // UNIMOD_Lys__Gln
+    {2939, 114, 296, 185, 4055, 7791}, // UNIMOD_Lys__Met
+    {2940, 114, 296, 185, 4061, 7792}, // UNIMOD_Lys__Arg
+    {2941, 114, 296, 185, 4067, 7793}, // UNIMOD_Lys__Xle
+    {2942, 114, 296, 185, 4073, 7794}, // UNIMOD_Xle__Ser
+    {2943, 114, 296, 185, 4083, 7795}, // UNIMOD_Xle__Phe
+    {2944, 114, 296, 185, 4093, 7796}, // UNIMOD_Xle__Trp
+    {2945, 114, 296, 185, 4103, 7797}, // UNIMOD_Xle__Pro
+    {2946, 114, 296, 185, 4113, 7798}, // UNIMOD_Xle__Val
+    {2947, 114, 296, 185, 4123, 7799}, // UNIMOD_Xle__His
+    {2948, 114, 296, 185, 4133, 7800}, // UNIMOD_Xle__Gln
+    {2949, 114, 296, 185, 4143, 7801}, // UNIMOD_Xle__Met
+    {2950, 114, 296, 185, 4153, 7802}, // UNIMOD_Xle__Arg
+    {2951, 114, 296, 185, 4163, 7803}, // UNIMOD_Met__Thr
+    {2952, 114, 296, 185, 4169, 7804}, // UNIMOD_Met__Arg
+    {2953, 114, 296, 185, 4175, 7805}, // UNIMOD_Met__Lys
+    {2954, 114, 296, 185, 4181, 7806}, // UNIMOD_Met__Xle
+    {2955, 114, 296, 185, 4187, 7807}, // UNIMOD_Met__Val
+    {2956, 114, 296, 185, 4193, 7808}, // UNIMOD_Asn__Ser
+    {2957, 114, 296, 185, 4199, 7809}, // UNIMOD_Asn__Thr
+    {2958, 114, 296, 185, 4205, 7810}, // UNIMOD_Asn__Lys
+    {2959, 114, 296, 185, 4211, 7811}, // UNIMOD_Asn__Tyr
+    {2960, 114, 296, 185, 4217, 7812}, // UNIMOD_Asn__His
+    {2961, 114, 296, 185, 4223, 7813}, // UNIMOD_Asn__Asp
+    {2962, 114, 296, 185, 4229, 7814}, // UNIMOD_Asn__Xle
+    {2963, 114, 296, 185, 4235, 7815}, // UNIMOD_Pro__Ser
+    {2964, 114, 296, 185, 4241, 7816}, // UNIMOD_Pro__Ala
+    {2965, 114, 296, 185, 4247, 7817}, // UNIMOD_Pro__His
+    {2966, 114, 296, 185, 4253, 7818}, // UNIMOD_Pro__Gln
+    {2967, 114, 296, 185, 4259, 7819}, // UNIMOD_Pro__Thr
+    {2968, 114, 296, 185, 4265, 7820}, // UNIMOD_Pro__Arg
+    {2969, 114, 296, 185, 4271, 7821}, // UNIMOD_Pro__Xle
+    {2970, 114, 296, 185, 4277, 7822}, // UNIMOD_Gln__Pro
+    {2971, 114, 296, 185, 4283, 7823}, // UNIMOD_Gln__Lys
+    {2972, 114, 296, 185, 4289, 7824}, // UNIMOD_Gln__Glu
+    {2973, 114, 296, 185, 4295, 7825}, // UNIMOD_Gln__His
+    {2974, 114, 296, 185, 4301, 7826}, // UNIMOD_Gln__Arg
+    {2975, 114, 296, 185, 4307, 7827}, // UNIMOD_Gln__Xle
+    {2976, 114, 296, 185, 4313, 7828}, // UNIMOD_Arg__Ser
+    {2977, 114, 296, 185, 4319, 7829}, // UNIMOD_Arg__Trp
+    {2978, 114, 296, 185, 4325, 7830}, // UNIMOD_Arg__Thr
+    {2979, 114, 296, 185, 4331, 7831}, // UNIMOD_Arg__Pro
+    {2980, 114, 296, 185, 4337, 7832}, // UNIMOD_Arg__Lys
+    {2981, 114, 296, 185, 4343, 7833}, // UNIMOD_Arg__His
+    {2982, 114, 296, 185, 4349, 7834}, // UNIMOD_Arg__Gln
+    {2983, 114, 296, 185, 4355, 7835}, // UNIMOD_Arg__Met
+    {2984, 114, 296, 185, 4361, 7836}, // UNIMOD_Arg__Cys
+    {2985, 114, 296, 185, 4367, 7837}, // UNIMOD_Arg__Xle
+    {2986, 114, 296, 185, 4373, 7838}, // UNIMOD_Arg__Gly
+    {2987, 114, 296, 185, 4379, 7839}, // UNIMOD_Ser__Phe
+    {2988, 114, 296, 185, 4385, 7840}, // UNIMOD_Ser__Ala
+    {2989, 114, 296, 185, 4391, 7841}, // UNIMOD_Ser__Trp
+    {2990, 114, 296, 185, 4397, 7842}, // UNIMOD_Ser__Thr
+    {2991, 114, 296, 185, 4403, 7843}, // UNIMOD_Ser__Asn
+    {2992, 114, 296, 185, 4409, 7844}, // UNIMOD_Ser__Pro
+    {2993, 114, 296, 185, 4415, 7845}, // UNIMOD_Ser__Tyr
+    {2994, 114, 296, 185, 4421, 7846}, // UNIMOD_Ser__Cys
+    {2995, 114, 296, 185, 4427, 7847}, // UNIMOD_Ser__Arg
+    {2996, 114, 296, 185, 4433, 7848}, // UNIMOD_Ser__Xle
+    {2997, 114, 296, 185, 4439, 7849}, // UNIMOD_Ser__Gly
+    {2998, 114, 296, 185, 4445, 7850}, // UNIMOD_Thr__Ser
+    {2999, 114, 296, 185, 4451, 7851}, // UNIMOD_Thr__Ala
+    {3000, 114, 296, 185, 4457, 7852}, // UNIMOD_Thr__Asn
+    {3001, 114, 296, 185, 4463, 7853}, // UNIMOD_Thr__Lys
+    {3002, 114, 296, 185, 4469, 7854}, // UNIMOD_Thr__Pro
+    {3003, 114, 296, 185, 4475, 7855}, // UNIMOD_Thr__Met
+    {3004, 114, 296, 185, 4481, 7856}, // UNIMOD_Thr__Xle
+    {3005, 114, 296, 185, 4487, 7857}, // UNIMOD_Thr__Arg
+    {3006, 114, 296, 185, 4493, 7858}, // UNIMOD_Val__Phe
+    {3007, 114, 296, 185, 4499, 7859}, // UNIMOD_Val__Ala
+    {3008, 114, 296, 185, 4505, 7860}, // UNIMOD_Val__Glu
+    {3009, 114, 296, 185, 4511, 7861}, // UNIMOD_Val__Met
+    {3010, 114, 296, 185, 4517, 7862}, // UNIMOD_Val__Asp
+    {3011, 114, 296, 185, 4523, 7863}, // UNIMOD_Val__Xle
+    {3012, 114, 296, 185, 4529, 7864}, // UNIMOD_Val__Gly
+    {3013, 114, 296, 185, 4535, 7865}, // UNIMOD_Trp__Ser
+    {3014, 114, 296, 185, 4541, 7866}, // UNIMOD_Trp__Cys
+    {3015, 114, 296, 185, 4547, 7867}, // UNIMOD_Trp__Arg
+    {3016, 114, 296, 185, 4553, 7868}, // UNIMOD_Trp__Gly
+    {3017, 114, 296, 185, 4559, 7869}, // UNIMOD_Trp__Xle
+    {3018, 114, 296, 185, 4565, 7870}, // UNIMOD_Tyr__Phe
+    {3019, 114, 296, 185, 4571, 7871}, // UNIMOD_Tyr__Ser
+    {3020, 114, 296, 185, 4577, 7872}, // UNIMOD_Tyr__Asn
+    {3021, 114, 296, 185, 4583, 7873}, // UNIMOD_Tyr__His
+    {3022, 114, 296, 185, 4589, 7874}, // UNIMOD_Tyr__Asp
+    {3023, 114, 296, 185, 4595, 7875}, // UNIMOD_Tyr__Cys
+    {3024, 114, 296, 185, 4601, 7876}, // UNIMOD_BDMAPP
+    {3025, 114, 296, 185, 4623, 7877}, // UNIMOD_NA_LNO2
+    {3026, 114, 296, 185, 4633, 7878}, // UNIMOD_NA_OA_NO2
+    {3027, 114, 296, 185, 4643, 7879}, // UNIMOD_ICPL_2H_4_
+    {3028, 114, 296, 185, 4657, 7880}, // UNIMOD_Label_13C_6_15N_1_
+    {3029, 114, 296, 185, 4667, 7881}, // UNIMOD_Label_2H_9_13C_6_15N_2_
+    {3030, 114, 296, 185, 4673, 7882}, // UNIMOD_NIC
+    {3031, 114, 296, 185, 4683, 7883}, // UNIMOD_dNIC
+    {3032, 114, 296, 185, 4693, 7884}, // UNIMOD_HNE_Delta_H_2_O
+    {3033, 114, 296, 185, 4707, 7885}, // UNIMOD_4_ONE
+    {3034, 114, 296, 185, 4721, 7886}, // UNIMOD_O_Dimethylphosphate
+    {3035, 114, 296, 185, 4735, 7887}, // UNIMOD_O_Methylphosphate
+    {3036, 114, 296, 185, 4749, 7888}, // UNIMOD_Diethylphosphate
+    {3037, 114, 296, 185, 4779, 7889}, // UNIMOD_Ethylphosphate
+    {3038, 114, 296, 185, 4801, 7890}, // UNIMOD_O_pinacolylmethylphosphonate
+    {3039, 114, 296, 185, 4823, 7891}, // UNIMOD_Methylphosphonate
+    {3040, 114, 296, 185, 4837, 7892}, // UNIMOD_O_Isopropylmethylphosphonate
+    {3041, 114, 296, 185, 4851, 7893}, // UNIMOD_iTRAQ8plex
+    {3042, 114, 296, 185, 4881, 7894}, // UNIMOD_iTRAQ8plex_13C_6_15N_2_
+    {3043, 114, 296, 185, 4895, 7895}, // UNIMOD_Ethanolamine
+    {3044, 114, 296, 185, 4913, 7896}, // UNIMOD_DTT_ST
+    {3045, 114, 296, 185, 4923, 7897}, // UNIMOD_DTT_C
+    {3046, 114, 296, 185, 4929, 7898}, // UNIMOD_TMT6plex
+    {3047, 114, 296, 185, 4955, 7899}, // UNIMOD_TMT2plex
+    {3048, 114, 296, 185, 4981, 7900}, // UNIMOD_TMT
+    {3049, 114, 296, 185, 5007, 7901}, // UNIMOD_ExacTagThiol
+    {3050, 114, 296, 185, 5013, 7902}, // UNIMOD_ExacTagAmine
+    {3051, 114, 296, 185, 5019, 7903}, // UNIMOD_4_ONE_Delta_H__2_O__1_
+    {3052, 114, 296, 185, 5033, 7904}, // UNIMOD_NO_SMX_SEMD
+    {3053, 114, 296, 185, 5039, 7905}, // UNIMOD_NO_SMX_SMCT
+    {3054, 114, 296, 185, 5045, 7906}, // UNIMOD_NO_SMX_SIMD
+    {3055, 114, 296, 185, 5051, 7907}, // UNIMOD_Malonyl
+    {3056, 114, 296, 185, 5061, 7908}, // UNIMOD_3sulfo
+    {3057, 114, 296, 185, 5067, 7909}, // UNIMOD_trifluoro
+    {3058, 114, 296, 185, 5073, 7910}, // UNIMOD_TNBS
+    {3059, 114, 296, 185, 5083, 7911}, // UNIMOD_IDEnT
+    {3060, 114, 296, 185, 5089, 7912}, // UNIMOD_DTT_ST_2H_6_
+    {3061, 114, 296, 185, 5099, 7913}, // UNIMOD_DTT_C_2H_6_
+    {3062, 114, 296, 185, 5105, 7914}, // UNIMOD_Met_loss
+    {3063, 114, 296, 185, 5111, 7915}, // UNIMOD_Met_loss_Acetyl
+    {3064, 114, 296, 185, 5117, 7916}, // UNIMOD_Menadione_HQ
+    {3065, 114, 296, 185, 5127, 7917}, // UNIMOD_Methyl_Acetyl_2H_3_
+    {3066, 114, 296, 185, 5133, 7918}, // UNIMOD_lapachenole
+    {3067, 114, 296, 185, 5139, 7919}, // UNIMOD_Label_13C_5_
+    {3068, 114, 296, 185, 5145, 7920}, // UNIMOD_maleimide
+    {3069, 114, 296, 185, 5155, 7921}, // UNIMOD_Biotin_phenacyl
+    {3070, 114, 296, 185, 5169, 7922}, // UNIMOD_Carboxymethyl_13C_2_
+    {3071, 114, 296, 185, 5175, 7923}, // UNIMOD_NEM_2H_5_
+    {3072, 114, 296, 185, 5181, 7924}, // UNIMOD_AEC_MAEC_2H_4_
+    {3073, 114, 296, 185, 5191, 7925}, // UNIMOD_Hex_1_HexNAc_1_
+    {3074, 114, 296, 185, 5205, 7926}, // UNIMOD_Label_13C_6__GG
+    {3075, 114, 296, 185, 5211, 7927}, // UNIMOD_Biotin_Thermo_21345
+    {3076, 114, 296, 185, 5217, 7928}, // UNIMOD_Pentylamine
+    {3077, 114, 296, 185, 5223, 7929}, // UNIMOD_Biotin_Thermo_21360
+    {3078, 114, 296, 185, 5229, 7930}, // UNIMOD_Cy3b_maleimide
+    {3079, 114, 296, 185, 5235, 7931}, // UNIMOD_Gly_loss_Amide
+    {3080, 114, 296, 185, 5241, 7932}, // UNIMOD_BMOE
+    {3081, 114, 296, 185, 5247, 7933}, // UNIMOD_DFDNB
+    {3082, 114, 296, 185, 5265, 7934}, // UNIMOD_TMPP_Ac
+    {3083, 114, 296, 185, 5271, 7935}, // UNIMOD_Dihydroxyimidazolidine
+    {3084, 114, 296, 185, 5277, 7936}, // UNIMOD_Label_2H_4__Acetyl
+    {3085, 114, 296, 185, 5283, 7937}, // UNIMOD_Label_13C_6__Acetyl
+    {3086, 114, 296, 185, 5289, 7938}, // UNIMOD_Label_13C_6_15N_2__Acetyl
+    {3087, 114, 296, 185, 5295, 7939}, // UNIMOD_Arg__Npo
+    {3088, 114, 296, 185, 5301, 7940}, // UNIMOD_EQIGG
+    {3089, 114, 296, 185, 5307, 7941}, // UNIMOD_Arg2PG
+    {3090, 114, 296, 185, 5313, 7942}, // UNIMOD_cGMP
+    {3091, 114, 296, 185, 5323, 7943}, // UNIMOD_cGMP_RMP_loss
+    {3092, 114, 296, 185, 5333, 7944}, // UNIMOD_Label_2H_4__GG
+    {3093, 114, 296, 185, 5339, 7945}, // UNIMOD_MG_H1
+    {3094, 114, 296, 185, 5345, 7946}, // UNIMOD_G_H1
+    {3095, 114, 296, 185, 5351, 7947}, // UNIMOD_ZGB
+    {3096, 114, 296, 185, 5361, 7948}, // UNIMOD_Label_13C_1_2H_3_
+    {3097, 114, 296, 185, 5367, 7949}, // UNIMOD_Label_13C_6_15N_2__GG
+    {3098, 114, 296, 185, 5373, 7950}, // UNIMOD_ICPL_13C_6_2H_4_
+    {3099, 114, 296, 185, 5387, 7951}, // UNIMOD_QEQTGG
+    {3100, 114, 296, 185, 5393, 7952}, // UNIMOD_QQQTGG
+    {3101, 114, 296, 185, 5399, 7953}, // UNIMOD_Bodipy
+    {3102, 114, 296, 185, 5405, 7954}, // UNIMOD_Biotin_Thermo_21325
+    {3103, 114, 296, 185, 5411, 7955}, // UNIMOD_Label_13C_1_2H_3__Oxidation
+    {3104, 114, 296, 185, 5417, 7956}, // UNIMOD_HydroxymethylOP
+    {3105, 114, 296, 185, 5423, 7957}, // UNIMOD_MDCC
+    {3106, 114, 296, 185, 5429, 7958}, // UNIMOD_mTRAQ
+    {3107, 114, 296, 185, 5455, 7959}, // UNIMOD_mTRAQ_13C_3_15N_1_
+    {3108, 114, 296, 185, 5481, 7960}, // UNIMOD_DyLight_maleimide
+    {3109, 114, 296, 185, 5487, 7961}, // UNIMOD_Methyl_PEO12_Maleimide
+    {3110, 114, 296, 185, 5493, 7962}, // UNIMOD_CarbamidomethylDTT
+    {3111, 114, 296, 185, 5499, 7963}, // UNIMOD_CarboxymethylDTT
+    {3112, 114, 296, 185, 5505, 7964}, // UNIMOD_Biotin_PEG_PRA
+    {3113, 114, 296, 185, 5511, 7965}, // UNIMOD_Met__Aha
+    {3114, 114, 296, 185, 5517, 7966}, // UNIMOD_Label_15N_4_
+    {3115, 114, 296, 185, 5523, 7967}, // UNIMOD_pyrophospho
+    {3116, 114, 296, 185, 5533, 7968}, // UNIMOD_Met__Hpg
+    {3117, 114, 296, 185, 5539, 7969}, // UNIMOD_4AcAllylGal
+    {3118, 114, 296, 185, 5545, 7970}, // UNIMOD_DimethylArsino
+    {3119, 114, 296, 185, 5551, 7971}, // UNIMOD_Lys__CamCys
+    {3120, 114, 296, 185, 5557, 7972}, // UNIMOD_Phe__CamCys
+    {3121, 114, 296, 185, 5563, 7973}, // UNIMOD_Leu__MetOx
+    {3122, 114, 296, 185, 5569, 7974}, // UNIMOD_Lys__MetOx
+    {3123, 114, 296, 185, 5575, 7975}, // UNIMOD_Galactosyl
+    {3124, 114, 296, 185, 5585, 7976}, // UNIMOD_SMCC_maleimide
+    {3125, 114, 296, 185, 5591, 7977}, // UNIMOD_Bacillosamine
+    {3126, 114, 296, 185, 5597, 7978}, // UNIMOD_MTSL
+    {3127, 114, 296, 185, 5603, 7979}, // UNIMOD_HNE_BAHAH
+    {3128, 114, 296, 185, 5617, 7980}, // UNIMOD_Methylmalonylation
+    {3129, 114, 296, 185, 5623, 7981}, // UNIMOD_Ethoxyformyl
+    {3130, 114, 296, 185, 5629, 7982}, // UNIMOD_Label_13C_4_15N_2__GG
+    {3131, 114, 296, 185, 5635, 7983}, // UNIMOD_ethylamino
+    {3132, 114, 296, 185, 5645, 7984}, // UNIMOD_MercaptoEthanol
+    {3133, 114, 296, 185, 5655, 7985}, // UNIMOD_Ethyl_Deamidated
+    {3134, 114, 296, 185, 5665, 7986}, // UNIMOD_VFQQQTGG
+    {3135, 114, 296, 185, 5671, 7987}, // UNIMOD_VIEVYQEQTGG
+    {3136, 114, 296, 185, 5677, 7988}, // UNIMOD_AMTzHexNAc2
+    {3137, 114, 296, 185, 5691, 7989}, // UNIMOD_Atto495Maleimide
+    {3138, 114, 296, 185, 5697, 7990}, // UNIMOD_Chlorination
+    {3139, 114, 296, 185, 5703, 7991}, // UNIMOD_dichlorination
+    {3140, 114, 296, 185, 5713, 7992}, // UNIMOD_AROD
+    {3141, 114, 296, 185, 5719, 7993}, // UNIMOD_Cys__methylaminoAla
+    {3142, 114, 296, 185, 5725, 7994}, // UNIMOD_Cys__ethylaminoAla
+    {3143, 114, 296, 185, 5731, 7995}, // UNIMOD_DNPS
+    {3144, 114, 296, 185, 5741, 7996}, // UNIMOD_SulfoGMBS
+    {3145, 114, 296, 185, 5747, 7997}, // UNIMOD_DimethylamineGMBS
+    {3146, 114, 296, 185, 5753, 7998}, // UNIMOD_Label_15N_2_2H_9_
+    {3147, 114, 296, 185, 5759, 7999}, // UNIMOD_LG_anhydrolactam
+    {3148, 114, 296, 185, 5769, 8000}, // UNIMOD_LG_pyrrole
+    {3149, 114, 296, 185, 5779, 8001}, // UNIMOD_LG_anhyropyrrole
+    {3150, 114, 296, 185, 5789, 8002}, // UNIMOD_3_deoxyglucosone
+    {3151, 114, 296, 185, 5795, 8003}, // UNIMOD_Cation_Li
+    {3152, 114, 296, 185, 5809, 8004}, // UNIMOD_Cation_Ca_II_
+    {3153, 114, 296, 185, 5823, 8005}, // UNIMOD_Cation_Fe_II_
+    {3154, 114, 296, 185, 5837, 8006}, // UNIMOD_Cation_Ni_II_
+    {3155, 114, 296, 185, 5851, 8007}, // UNIMOD_Cation_Zn_II_
+    {3156, 114, 296, 185, 5869, 8008}, // UNIMOD_Cation_Ag
+    {3157, 114, 296, 185, 5883, 8009}, // UNIMOD_Cation_Mg_II_
+    {3158, 114, 296, 185, 5897, 8010}, // UNIMOD_2_succinyl
+    {3159, 114, 296, 185, 5903, 8011}, // UNIMOD_Propargylamine
+    {3160, 114, 296, 185, 5917, 8012}, // UNIMOD_Phosphopropargyl
+    {3161, 114, 296, 185, 5931, 8013}, // UNIMOD_SUMO2135
+    {3162, 114, 296, 185, 5937, 8014}, // UNIMOD_SUMO3549
+    {3163, 114, 296, 185, 5943, 8015}, // UNIMOD_thioacylPA
+    {3164, 114, 296, 185, 5949, 8016}, // UNIMOD_maleimide3
+    {3165, 114, 296, 185, 5959, 8017}, // UNIMOD_maleimide5
+    {3166, 114, 296, 185, 5969, 8018}, // UNIMOD_Puromycin
+    {3167, 114, 296, 185, 5975, 8019}, // UNIMOD_Chlorpyrifos
+    {3168, 114, 296, 185, 5989, 8020}, // UNIMOD_Carbofuran
+    {3169, 114, 296, 185, 5995, 8021}, // UNIMOD_BITC
+    {3170, 114, 296, 185, 6009, 8022}, // UNIMOD_PEITC
+    {3171, 114, 296, 185, 6023, 8023}, // UNIMOD_glucosone
+    {3172, 114, 296, 185, 6029, 8024}, // UNIMOD_cysTMT
+    {3173, 114, 296, 185, 6035, 8025}, // UNIMOD_cysTMT6plex
+    {3174, 114, 296, 185, 6041, 8026}, // UNIMOD_Label_13C_6__Dimethyl
+    {3175, 114, 296, 185, 6047, 8027}, // UNIMOD_Label_13C_6_15N_2__Dimethyl
+    {3176, 114, 296, 185, 6053, 8028}, // UNIMOD_Ammonium
+    {3177, 114, 296, 185, 6067, 8029}, // UNIMOD_ISD_z_2_ion
+    {3178, 114, 296, 185, 6073, 8030}, // UNIMOD_Biotin_Sigma_B1267
+    {3179, 114, 296, 185, 6079, 8031}, // UNIMOD_Label_15N_1_
+    {3180, 114, 296, 185, 6137, 8032}, // UNIMOD_Label_15N_2_
+    {3181, 114, 296, 185, 6155, 8033}, // UNIMOD_Label_15N_3_
+    {3182, 114, 296, 185, 6161, 8034}, // UNIMOD_sulfo_amino
+    {3183, 114, 296, 185, 6167, 8035}, // UNIMOD_AHA_Alkyne
+    {3184, 114, 296, 185, 6173, 8036}, // UNIMOD_AHA_Alkyne_KDDDD
+    {3185, 114, 296, 185, 6179, 8037}, // UNIMOD_EGCG1
+    {3186, 114, 296, 185, 6185, 8038}, // UNIMOD_EGCG2
+    {3187, 114, 296, 185, 6191, 8039}, // UNIMOD_Label_13C_6_15N_4__Methyl
+    {3188, 114, 296, 185, 6197, 8040}, // UNIMOD_Label_13C_6_15N_4__Dimethyl
+    {3189, 114, 296, 185, 6203, 8041}, // UNIMOD_Label_13C_6_15N_4__Methyl_2H_3_13C_1_
+    {3190, 114, 296, 185, 6209, 8042}, // UNIMOD_Label_13C_6_15N_4__Dimethyl_2H_6_13C_2_
+    {3191, 114, 296, 185, 6215, 8043}, // UNIMOD_Cys__CamSec
+    {3192, 114, 296, 185, 6221, 8044}, // UNIMOD_Thiazolidine
+    {3193, 114, 296, 185, 6227, 8045}, // UNIMOD_DEDGFLYMVYASQETFG
+    {3194, 114, 296, 185, 6233, 8046}, // UNIMOD_Biotin_Invitrogen_M1602
+    {3195, 114, 296, 185, 6239, 8047}, // UNIMOD_glycidamide
+    {3196, 114, 296, 185, 6249, 8048}, // UNIMOD_Ahx2_Hsl
+    {3197, 114, 296, 185, 6255, 8049}, // UNIMOD_DMPO
+    {3198, 114, 296, 185, 6269, 8050}, // UNIMOD_ICDID
+    {3199, 114, 296, 185, 6275, 8051}, // UNIMOD_ICDID_2H_6_
+    {3200, 114, 296, 185, 6281, 8052}, // UNIMOD_Xlink_DSS
+    {3201, 114, 296, 185, 6291, 8053}, // UNIMOD_Xlink_EGS
+    {3202, 114, 296, 185, 6301, 8054}, // UNIMOD_Xlink_DST
+    {3203, 114, 296, 185, 6311, 8055}, // UNIMOD_Xlink_DTSSP
+    {3204, 114, 296, 185, 6321, 8056}, // UNIMOD_Xlink_SMCC
+    {3205, 114, 296, 185, 6327, 8057}, // UNIMOD_Xlink_DMP_de
+    {3206, 114, 296, 185, 6337, 8058}, // UNIMOD_Xlink_EGScleaved
+    {3207, 114, 296, 185, 6347, 8059}, // UNIMOD_Biotin_Thermo_88310
+    {3208, 114, 296, 185, 6353, 8060}, // UNIMOD_2_nitrobenzyl
+    {3209, 114, 296, 185, 6359, 8061}, // UNIMOD_Cys__SecNEM
+    {3210, 114, 296, 185, 6365, 8062}, // UNIMOD_Cys__SecNEM_2H_5_
+    {3211, 114, 296, 185, 6371, 8063}, // UNIMOD_Thiadiazole
+    {3212, 114, 296, 185, 6377, 8064}, // UNIMOD_Withaferin
+    {3213, 114, 296, 185, 6383, 8065}, // UNIMOD_Biotin_Thermo_88317
+    {3214, 114, 296, 185, 6393, 8066}, // UNIMOD_TAMRA_FP
+    {3215, 114, 296, 185, 6403, 8067}, // UNIMOD_Biotin_Thermo_21901_H2O
+    {3216, 114, 296, 185, 6409, 8068}, // UNIMOD_Deoxyhypusine
+    {3217, 114, 296, 185, 6419, 8069}, // UNIMOD_Acetyldeoxyhypusine
+    {3218, 114, 296, 185, 6425, 8070}, // UNIMOD_Acetylhypusine
+    {3219, 114, 296, 185, 6431, 8071}, // UNIMOD_Ala__Cys
+    {3220, 114, 296, 185, 6437, 8072}, // UNIMOD_Ala__Phe
+    {3221, 114, 296, 185, 6443, 8073}, // UNIMOD_Ala__His
+    {3222, 114, 296, 185, 6449, 8074}, // UNIMOD_Ala__Xle
+    {3223, 114, 296, 185, 6455, 8075}, // UNIMOD_Ala__Lys
+    {3224, 114, 296, 185, 6461, 8076}, // UNIMOD_Ala__Met
+    {3225, 114, 296, 185, 6467, 8077}, // UNIMOD_Ala__Asn
+    {3226, 114, 296, 185, 6473, 8078}, // UNIMOD_Ala__Gln
+    {3227, 114, 296, 185, 6479, 8079}, // UNIMOD_Ala__Arg
+    {3228, 114, 296, 185, 6485, 8080}, // UNIMOD_Ala__Trp
+    {3229, 114, 296, 185, 6491, 8081}, // UNIMOD_Ala__Tyr
+    {3230, 114, 296, 185, 6497, 8082}, // UNIMOD_Cys__Ala
+    {3231, 114, 296, 185, 6503, 8083}, // UNIMOD_Cys__Asp
+    {3232, 114, 296, 185, 6509, 8084}, // UNIMOD_Cys__Glu
+    {3233, 114, 296, 185, 6515, 8085}, // UNIMOD_Cys__His
+    {3234, 114, 296, 185, 6521, 8086}, // UNIMOD_Cys__Xle
+    {3235, 114, 296, 185, 6527, 8087}, // UNIMOD_Cys__Lys
+    {3236, 114, 296, 185, 6533, 8088}, // UNIMOD_Cys__Met
+    {3237, 114, 296, 185, 6539, 8089}, // UNIMOD_Cys__Asn
+    {3238, 114, 296, 185, 6545, 8090}, // UNIMOD_Cys__Pro
+    {3239, 114, 296, 185, 6551, 8091}, // UNIMOD_Cys__Gln
+    {3240, 114, 296, 185, 6557, 8092}, // UNIMOD_Cys__Thr
+    {3241, 114, 296, 185, 6563, 8093}, // UNIMOD_Cys__Val
+    {3242, 114, 296, 185, 6569, 8094}, // UNIMOD_Asp__Cys
+    {3243, 114, 296, 185, 6575, 8095}, // UNIMOD_Asp__Phe
+    {3244, 114, 296, 185, 6581, 8096}, // UNIMOD_Asp__Xle
+    {3245, 114, 296, 185, 6587, 8097}, // UNIMOD_Asp__Lys
+    {3246, 114, 296, 185, 6593, 8098}, // UNIMOD_Asp__Met
+    {3247, 114, 296, 185, 6599, 8099}, // UNIMOD_Asp__Pro
+    {3248, 114, 296, 185, 6605, 8100}, // UNIMOD_Asp__Gln
+    {3249, 114, 296, 185, 6611, 8101}, // UNIMOD_Asp__Arg
+    {3250, 114, 296, 185, 6617, 8102}, // UNIMOD_Asp__Ser
+    {3251, 114, 296, 185, 6623, 8103}, // UNIMOD_Asp__Thr
+    {3252, 114, 296, 185, 6629, 8104}, // UNIMOD_Asp__Trp
+    {3253, 114, 296, 185, 6635, 8105}, // UNIMOD_Glu__Cys
+    {3254, 114, 296, 185, 6641, 8106}, // UNIMOD_Glu__Phe
+    {3255, 114, 296, 185, 6647, 8107}, // UNIMOD_Glu__His
+    {3256, 114, 296, 185, 6653, 8108}, // UNIMOD_Glu__Xle
+    {3257, 114, 296, 185, 6659, 8109}, // UNIMOD_Glu__Met
+    {3258, 114, 296, 185, 6665, 8110}, // UNIMOD_Glu__Asn
+    {3259, 114, 296, 185, 6671, 8111}, // UNIMOD_Glu__Pro
+    {3260, 114, 296, 185, 6677, 8112}, // UNIMOD_Glu__Arg
+    {3261, 114, 296, 185, 6683, 8113}, // UNIMOD_Glu__Ser
+    {3262, 114, 296, 185, 6689, 8114}, // UNIMOD_Glu__Thr
+    {3263, 114, 296, 185, 6695, 8115}, // UNIMOD_Glu__Trp
+    {3264, 114, 296, 185, 6701, 8116}, // UNIMOD_Glu__Tyr
+    {3265, 114, 296, 185, 6707, 8117}, // UNIMOD_Phe__Ala
+    {3266, 114, 296, 185, 6713, 8118}, // UNIMOD_Phe__Asp
+    {3267, 114, 296, 185, 6719, 8119}, // UNIMOD_Phe__Glu
+    {3268, 114, 296, 185, 6725, 8120}, // UNIMOD_Phe__Gly
+    {3269, 114, 296, 185, 6731, 8121}, // UNIMOD_Phe__His
+    {3270, 114, 296, 185, 6737, 8122}, // UNIMOD_Phe__Lys
+    {3271, 114, 296, 185, 6743, 8123}, // UNIMOD_Phe__Met
+    {3272, 114, 296, 185, 6749, 8124}, // UNIMOD_Phe__Asn
+    {3273, 114, 296, 185, 6755, 8125}, // UNIMOD_Phe__Pro
+    {3274, 114, 296, 185, 6761, 8126}, // UNIMOD_Phe__Gln
+    {3275, 114, 296, 185, 6767, 8127}, // UNIMOD_Phe__Arg
+    {3276, 114, 296, 185, 6773, 8128}, // UNIMOD_Phe__Thr
+    {3277, 114, 296, 185, 6779, 8129}, // UNIMOD_Phe__Trp
+    {3278, 114, 296, 185, 6785, 8130}, // UNIMOD_Gly__Phe
+    {3279, 114, 296, 185, 6791, 8131}, // UNIMOD_Gly__His
+    {3280, 114, 296, 185, 6797, 8132}, // UNIMOD_Gly__Xle
+    {3281, 114, 296, 185, 6803, 8133}, // UNIMOD_Gly__Lys
+    {3282, 114, 296, 185, 6809, 8134}, // UNIMOD_Gly__Met
+    {3283, 114, 296, 185, 6815, 8135}, // UNIMOD_Gly__Asn
+    {3284, 114, 296, 185, 6821, 8136}, // UNIMOD_Gly__Pro
+    {3285, 114, 296, 185, 6827, 8137}, // UNIMOD_Gly__Gln
+    {3286, 114, 296, 185, 6833, 8138}, // UNIMOD_Gly__Thr
+    {3287, 114, 296, 185, 6839, 8139}, // UNIMOD_Gly__Tyr
+    {3288, 114, 296, 185, 6845, 8140}, // UNIMOD_His__Ala
+    {3289, 114, 296, 185, 6851, 8141}, // UNIMOD_His__Cys
+    {3290, 114, 296, 185, 6857, 8142}, // UNIMOD_His__Glu
+    {3291, 114, 296, 185, 6863, 8143}, // UNIMOD_His__Phe
+    {3292, 114, 296, 185, 6869, 8144}, // UNIMOD_His__Gly
+    {3293, 114, 296, 185, 6875, 8145}, // UNIMOD_His__Lys
+    {3294, 114, 296, 185, 6881, 8146}, // UNIMOD_His__Met
+    {3295, 114, 296, 185, 6887, 8147}, // UNIMOD_His__Ser
+    {3296, 114, 296, 185, 6893, 8148}, // UNIMOD_His__Thr
+    {3297, 114, 296, 185, 6899, 8149}, // UNIMOD_His__Val
+    {3298, 114, 296, 185, 6905, 8150}, // UNIMOD_His__Trp
+    {3299, 114, 296, 185, 6911, 8151}, // UNIMOD_Xle__Ala
+    {3300, 114, 296, 185, 6921, 8152}, // UNIMOD_Xle__Cys
+    {3301, 114, 296, 185, 6931, 8153}, // UNIMOD_Xle__Asp
+    {3302, 114, 296, 185, 6941, 8154}, // UNIMOD_Xle__Glu
+    {3303, 114, 296, 185, 6951, 8155}, // UNIMOD_Xle__Gly
+    {3304, 114, 296, 185, 6961, 8156}, // UNIMOD_Xle__Tyr
+    {3305, 114, 296, 185, 6971, 8157}, // UNIMOD_Lys__Ala
+    {3306, 114, 296, 185, 6977, 8158}, // UNIMOD_Lys__Cys
+    {3307, 114, 296, 185, 6983, 8159}, // UNIMOD_Lys__Asp
+    {3308, 114, 296, 185, 6989, 8160}, // UNIMOD_Lys__Phe
+    {3309, 114, 296, 185, 6995, 8161}, // UNIMOD_Lys__Gly
+    {3310, 114, 296, 185, 7001, 8162}, // UNIMOD_Lys__His
+    {3311, 114, 296, 185, 7007, 8163}, // UNIMOD_Lys__Pro
+    {3312, 114, 296, 185, 7013, 8164}, // UNIMOD_Lys__Ser
+    {3313, 114, 296, 185, 7019, 8165}, // UNIMOD_Lys__Val
+    {3314, 114, 296, 185, 7025, 8166}, // UNIMOD_Lys__Trp
+    {3315, 114, 296, 185, 7031, 8167}, // UNIMOD_Lys__Tyr
+    {3316, 114, 296, 185, 7037, 8168}, // UNIMOD_Met__Ala
+    {3317, 114, 296, 185, 7043, 8169}, // UNIMOD_Met__Cys
+    {3318, 114, 296, 185, 7049, 8170}, // UNIMOD_Met__Asp
+    {3319, 114, 296, 185, 7055, 8171}, // UNIMOD_Met__Glu
+    {3320, 114, 296, 185, 7061, 8172}, // UNIMOD_Met__Phe
+    {3321, 114, 296, 185, 7067, 8173}, // UNIMOD_Met__Gly
+    {3322, 114, 296, 185, 7073, 8174}, // UNIMOD_Met__His
+    {3323, 114, 296, 185, 7079, 8175}, // UNIMOD_Met__Asn
+    {3324, 114, 296, 185, 7085, 8176}, // UNIMOD_Met__Pro
+    {3325, 114, 296, 185, 7091, 8177}, // UNIMOD_Met__Gln
+    {3326, 114, 296, 185, 7097, 8178}, // UNIMOD_Met__Ser
+    {3327, 114, 296, 185, 7103, 8179}, // UNIMOD_Met__Trp
+    {3328, 114, 296, 185, 7109, 8180}, // UNIMOD_Met__Tyr
+    {3329, 114, 296, 185, 7115, 8181}, // UNIMOD_Asn__Ala
+    {3330, 114, 296, 185, 7121, 8182}, // UNIMOD_Asn__Cys
+    {3331, 114, 296, 185, 7127, 8183}, // UNIMOD_Asn__Glu
+    {3332, 114, 296, 185, 7133, 8184}, // UNIMOD_Asn__Phe
+    {3333, 114, 296, 185, 7139, 8185}, // UNIMOD_Asn__Gly
+    {3334, 114, 296, 185, 7145, 8186}, // UNIMOD_Asn__Met
+    {3335, 114, 296, 185, 7151, 8187}, // UNIMOD_Asn__Pro
+    {3336, 114, 296, 185, 7157, 8188}, // UNIMOD_Asn__Gln
+    {3337, 114, 296, 185, 7163, 8189}, // UNIMOD_Asn__Arg
+    {3338, 114, 296, 185, 7169, 8190}, // UNIMOD_Asn__Val
+    {3339, 114, 296, 185, 7175, 8191}, // UNIMOD_Asn__Trp
+    {3340, 114, 296, 185, 7181, 8192}, // UNIMOD_Pro__Cys
+    {3341, 114, 296, 185, 7187, 8193}, // UNIMOD_Pro__Asp
+    {3342, 114, 296, 185, 7193, 8194}, // UNIMOD_Pro__Glu
+    {3343, 114, 296, 185, 7199, 8195}, // UNIMOD_Pro__Phe
+    {3344, 114, 296, 185, 7205, 8196}, // UNIMOD_Pro__Gly
+    {3345, 114, 296, 185, 7211, 8197}, // UNIMOD_Pro__Lys
+    {3346, 114, 296, 185, 7217, 8198}, // UNIMOD_Pro__Met
+    {3347, 114, 296, 185, 7223, 8199}, // UNIMOD_Pro__Asn
+    {3348, 114, 296, 185, 7229, 8200}, // UNIMOD_Pro__Val
+    {3349, 114, 296, 185, 7235, 8201}, // UNIMOD_Pro__Trp
+    {3350, 114, 296, 185, 7241, 8202}, // UNIMOD_Pro__Tyr
+    {3351, 114, 296, 185, 7247, 8203}, // UNIMOD_Gln__Ala
+    {3352, 114, 296, 185, 7253, 8204}, // UNIMOD_Gln__Cys
+    {3353, 114, 296, 185, 7259, 8205}, // UNIMOD_Gln__Asp
+    {3354, 114, 296, 185, 7265, 8206}, // UNIMOD_Gln__Phe
+    {3355, 114, 296, 185, 7271, 8207}, // UNIMOD_Gln__Gly
+    {3356, 114, 296, 185, 7277, 8208}, // UNIMOD_Gln__Met
+    {3357, 114, 296, 185, 7283, 8209}, // UNIMOD_Gln__Asn
+    {3358, 114, 296, 185, 7289, 8210}, // UNIMOD_Gln__Ser
+    {3359, 114, 296, 185, 7295, 8211}, // UNIMOD_Gln__Thr
+    {3360, 114, 296, 185, 7301, 8212}, // UNIMOD_Gln__Val
+    {3361, 114, 296, 185, 7307, 8213}, // UNIMOD_Gln__Trp
+    {3362, 114, 296, 185, 7313, 8214}, // UNIMOD_Gln__Tyr
+    {3363, 114, 296, 185, 7319, 8215}, // UNIMOD_Arg__Ala
+    {3364, 114, 296, 185, 7325, 8216}, // UNIMOD_Arg__Asp
+    {3365, 114, 296, 185, 7331, 8217}, // UNIMOD_Arg__Glu
+    {3366, 114, 296, 185, 7337, 8218}, // UNIMOD_Arg__Asn
+    {3367, 114, 296, 185, 7343, 8219}, // UNIMOD_Arg__Val
+    {3368, 114, 296, 185, 7349, 8220}, // UNIMOD_Arg__Tyr
+    {3369, 114, 296, 185, 7355, 8221}, // UNIMOD_Arg__Phe
+    {3370, 114, 296, 185, 7361, 8222}, // UNIMOD_Ser__Asp
+    {3371, 114, 296, 185, 7367, 8223}, // UNIMOD_Ser__Glu
+    {3372, 114, 296, 185, 7373, 8224}, // UNIMOD_Ser__His
+    {3373, 114, 296, 185, 7379, 8225}, // UNIMOD_Ser__Lys
+    {3374, 114, 296, 185, 7385, 8226}, // UNIMOD_Ser__Met
+    {3375, 114, 296, 185, 7391, 8227}, // UNIMOD_Ser__Gln
+    {3376, 114, 296, 185, 7397, 8228}, // UNIMOD_Ser__Val
+    {3377, 114, 296, 185, 7403, 8229}, // UNIMOD_Thr__Cys
+    {3378, 114, 296, 185, 7409, 8230}, // UNIMOD_Thr__Asp
+    {3379, 114, 296, 185, 7415, 8231}, // UNIMOD_Thr__Glu
+    {3380, 114, 296, 185, 7421, 8232}, // UNIMOD_Thr__Phe
+    {3381, 114, 296, 185, 7427, 8233}, // UNIMOD_Thr__Gly
+    {3382, 114, 296, 185, 7433, 8234}, // UNIMOD_Thr__His
+    {3383, 114, 296, 185, 7439, 8235}, // UNIMOD_Thr__Gln
+    {3384, 114, 296, 185, 7445, 8236}, // UNIMOD_Thr__Val
+    {3385, 114, 296, 185, 7451, 8237}, // UNIMOD_Thr__Trp
+    {3386, 114, 296, 185, 7457, 8238}, // UNIMOD_Thr__Tyr
+    {3387, 114, 296, 185, 7463, 8239}, // UNIMOD_Val__Cys
+    {3388, 114, 296, 185, 7469, 8240}, // UNIMOD_Val__His
+    {3389, 114, 296, 185, 7475, 8241}, // UNIMOD_Val__Lys
+    {3390, 114, 296, 185, 7481, 8242}, // UNIMOD_Val__Asn
+    {3391, 114, 296, 185, 7487, 8243}, // UNIMOD_Val__Pro
+    {3392, 114, 296, 185, 7493, 8244}, // UNIMOD_Val__Gln
+    {3393, 114, 296, 185, 7499, 8245}, // UNIMOD_Val__Arg
+    {3394, 114, 296, 185, 7505, 8246}, // UNIMOD_Val__Ser
+    {3395, 114, 296, 185, 7511, 8247}, // UNIMOD_Val__Thr
+    {3396, 114, 296, 185, 7517, 8248}, // UNIMOD_Val__Trp
+    {3397, 114, 296, 185, 7523, 8249}, // UNIMOD_Val__Tyr
+    {3398, 114, 296, 185, 7529, 8250}, // UNIMOD_Trp__Ala
+    {3399, 114, 296, 185, 7535, 8251}, // UNIMOD_Trp__Asp
+    {3400, 114, 296, 185, 7541, 8252}, // UNIMOD_Trp__Glu
+    {3401, 114, 296, 185, 7547, 8253}, // UNIMOD_Trp__Phe
+    {3402, 114, 296, 185, 7553, 8254}, // UNIMOD_Trp__His
+    {3403, 114, 296, 185, 7559, 8255}, // UNIMOD_Trp__Lys
+    {3404, 114, 296, 185, 7565, 8256}, // UNIMOD_Trp__Met
+    {3405, 114, 296, 185, 7571, 8257}, // UNIMOD_Trp__Asn
+    {3406, 114, 296, 185, 7577, 8258}, // UNIMOD_Trp__Pro
+    {3407, 114, 296, 185, 7583, 8259}, // UNIMOD_Trp__Gln
+    {3408, 114, 296, 185, 7589, 8260}, // UNIMOD_Trp__Thr
+    {3409, 114, 296, 185, 7595, 8261}, // UNIMOD_Trp__Val
+    {3410, 114, 296, 185, 7601, 8262}, // UNIMOD_Trp__Tyr
+    {3411, 114, 296, 185, 7607, 8263}, // UNIMOD_Tyr__Ala
+    {3412, 114, 296, 185, 7613, 8264}, // UNIMOD_Tyr__Glu
+    {3413, 114, 296, 185, 7619, 8265}, // UNIMOD_Tyr__Gly
+    {3414, 114, 296, 185, 7625, 8266}, // UNIMOD_Tyr__Lys
+    {3415, 114, 296, 185, 7631, 8267}, // UNIMOD_Tyr__Met
+    {3416, 114, 296, 185, 7637, 8268}, // UNIMOD_Tyr__Pro
+    {3417, 114, 296, 185, 7643, 8269}, // UNIMOD_Tyr__Gln
+    {3418, 114, 296, 185, 7649, 8270}, // UNIMOD_Tyr__Arg
+    {3419, 114, 296, 185, 7655, 8271}, // UNIMOD_Tyr__Thr
+    {3420, 114, 296, 185, 7661, 8272}, // UNIMOD_Tyr__Val
+    {3421, 114, 296, 185, 7667, 8273}, // UNIMOD_Tyr__Trp
+    {3422, 114, 296, 185, 7673, 8274}, // UNIMOD_Tyr__Xle
+    {3423, 114, 296, 185, 7679, 8275}, // UNIMOD_AHA_SS
+    {3424, 114, 296, 185, 7685, 8276}, // UNIMOD_AHA_SS_CAM
+    {3425, 114, 296, 185, 7691, 8277}, // UNIMOD_Biotin_Thermo_33033
+    {3426, 114, 296, 185, 7697, 8278}, // UNIMOD_Biotin_Thermo_33033_H
+    {3427, 114, 296, 185, 7703, 8279}, // UNIMOD_2_monomethylsuccinyl
+    {3428, 114, 296, 185, 7709, 8280}, // UNIMOD_Saligenin
+    {3429, 114, 296, 185, 7719, 8281}, // UNIMOD_Cresylphosphate
+    {3430, 114, 296, 185, 7745, 8282}, // UNIMOD_CresylSaligeninPhosphate
+    {3431, 114, 296, 185, 7771, 8283}, // UNIMOD_Ub_Br2
+    {3432, 114, 296, 185, 7777, 8284}, // UNIMOD_Ub_VME
+    {3433, 114, 296, 185, 7783, 8285}, // UNIMOD_Ub_amide
+    {3434, 114, 296, 185, 7789, 8286}, // UNIMOD_Ub_fluorescein
+    {3435, 114, 296, 185, 7795, 8287}, // UNIMOD_2_dimethylsuccinyl
+    {3436, 114, 296, 185, 7801, 8288}, // UNIMOD_Gly
+    {3437, 114, 296, 185, 7815, 8289}, // UNIMOD_pupylation
+    {3438, 114, 296, 185, 7821, 8290}, // UNIMOD_Label_13C_4_
+    {3439, 114, 296, 185, 7827, 8291}, // UNIMOD_Label_13C_4__Oxidation
+    {3440, 114, 296, 185, 7833, 8292}, // UNIMOD_HCysThiolactone
+    {3441, 114, 296, 185, 7839, 8293}, // UNIMOD_HCysteinyl
+    {3442, 114, 296, 185, 7845, 8294}, // UNIMOD_UgiJoullie
+    {3443, 114, 296, 185, 7855, 8295}, // UNIMOD_Dipyridyl
+    {3444, 114, 296, 185, 7861, 8296}, // UNIMOD_Furan
+    {3445, 114, 296, 185, 7867, 8297}, // UNIMOD_Difuran
+    {3446, 114, 296, 185, 7873, 8298}, // UNIMOD_BMP_piperidinol
+    {3447, 114, 296, 185, 7883, 8299}, // UNIMOD_UgiJoullieProGly
+    {3448, 114, 296, 185, 7893, 8300}, // UNIMOD_UgiJoullieProGlyProGly
+    {3449, 114, 296, 185, 7903, 8301}, // UNIMOD_IMEHex_2_NeuAc_1_
+    {3450, 114, 296, 185, 7909, 8302}, // UNIMOD_Arg_loss
+    {3451, 114, 296, 185, 7915, 8303}, // UNIMOD_Arg
+    {3452, 114, 296, 185, 7921, 8304}, // UNIMOD_Butyryl
+    {3453, 114, 296, 185, 7927, 8305}, // UNIMOD_Dicarbamidomethyl
+    {3454, 114, 296, 185, 7949, 8306}, // UNIMOD_Dimethyl_2H_6_
+    {3455, 114, 296, 185, 7963, 8307}, // UNIMOD_GGQ
+    {3456, 114, 296, 185, 7969, 8308}, // UNIMOD_QTGG
+    {3457, 114, 296, 185, 7975, 8309}, // UNIMOD_Label_13C_3_
+    {3458, 114, 296, 185, 7981, 8310}, // UNIMOD_Label_13C_3_15N_1_
+    {3459, 114, 296, 185, 7987, 8311}, // UNIMOD_Label_13C_4_15N_1_
+    {3460, 114, 296, 185, 7993, 8312}, // UNIMOD_Label_2H_10_
+    {3461, 114, 296, 185, 7999, 8313}, // UNIMOD_Label_2H_4_13C_1_
+    {3462, 114, 296, 185, 8005, 8314}, // UNIMOD_Lys
+    {3463, 114, 296, 185, 8011, 8315}, // UNIMOD_mTRAQ_13C_6_15N_2_
+    {3464, 114, 296, 185, 8037, 8316}, // UNIMOD_NeuAc
+    {3465, 114, 296, 185, 8051, 8317}, // UNIMOD_NeuGc
+    {3466, 114, 296, 185, 8065, 8318}, // UNIMOD_Propyl
+    {3467, 114, 296, 185, 8091, 8319}, // UNIMOD_Propyl_2H_6_
+    {3468, 114, 296, 185, 8101, 8320}, // UNIMOD_Propiophenone
+    {3469, 114, 296, 185, 8131, 8321}, // UNIMOD_Delta_H_6_C_3_O_1_
+    {3470, 114, 296, 185, 8149, 8322}, // UNIMOD_Delta_H_8_C_6_O_1_
+    {3471, 114, 296, 185, 8159, 8323}, // UNIMOD_biotinAcrolein298
+    {3472, 114, 296, 185, 8177, 8324}, // UNIMOD_MM_diphenylpentanone
+    {3473, 114, 296, 185, 8183, 8325}, // UNIMOD_EHD_diphenylpentanone
+    {3474, 114, 296, 185, 8193, 8326}, // UNIMOD_Biotin_Thermo_21901_2H2O
+    {3475, 114, 296, 185, 8199, 8327}, // UNIMOD_DiLeu4plex115
+    {3476, 114, 296, 185, 8213, 8328}, // UNIMOD_DiLeu4plex
+    {3477, 114, 296, 185, 8227, 8329}, // UNIMOD_DiLeu4plex117
+    {3478, 114, 296, 185, 8241, 8330}, // UNIMOD_DiLeu4plex118
+    {3479, 114, 296, 185, 8255, 8331}, // UNIMOD_NEMsulfur
+    {3480, 114, 296, 185, 8261, 8332}, // UNIMOD_SulfurDioxide
+    {3481, 114, 296, 185, 8267, 8333}, // UNIMOD_NEMsulfurWater
+    {3482, 114, 296, 185, 8273, 8334}, // UNIMOD_bisANS_sulfonates
+    {3483, 114, 296, 185, 8287, 8335}, // UNIMOD_DNCB_hapten
+    {3484, 114, 296, 185, 8305, 8336}, // UNIMOD_Biotin_Thermo_21911
+    {3485, 114, 296, 185, 8311, 8337}, // UNIMOD_iodoTMT
+    {3486, 114, 296, 185, 8333, 8338}, // UNIMOD_iodoTMT6plex
+    {3487, 114, 296, 185, 8355, 8339}, // UNIMOD_Phosphogluconoylation
+    {3488, 114, 296, 185, 8365, 8340}, // UNIMOD_PS_Hapten
+    {3489, 114, 296, 185, 8379, 8341}, // UNIMOD_Cy3_maleimide
+    {3490, 114, 296, 185, 8385, 8342}, // UNIMOD_benzylguanidine
+    {3491, 114, 296, 185, 8391, 8343}, // UNIMOD_CarboxymethylDMAP
+    {3492, 114, 296, 185, 8397, 8344}, // UNIMOD_azole
+    {3493, 114, 296, 185, 8407, 8345}, // UNIMOD_phosphoRibosyl
+    {3494, 114, 296, 185, 8421, 8346}, // UNIMOD_NEM_2H_5__H2O
+    {3495, 114, 296, 185, 8427, 8347}, // UNIMOD_Crotonyl
+    {3496, 114, 296, 185, 8433, 8348}, // UNIMOD_O_Et_N_diMePhospho
+    {3497, 114, 296, 185, 8439, 8349}, // UNIMOD_N_dimethylphosphate
+    {3498, 114, 296, 185, 8445, 8350}, // UNIMOD_dHex_1_Hex_1_
+    {3499, 114, 296, 185, 8455, 8351}, // UNIMOD_Methyl_2H_3__Acetyl_2H_3_
+    {3500, 114, 296, 185, 8461, 8352}, // UNIMOD_Label_2H_3__Oxidation
+    {3501, 114, 296, 185, 8467, 8353}, // UNIMOD_Trimethyl_2H_9_
+    {3502, 114, 296, 185, 8477, 8354}, // UNIMOD_Acetyl_13C_2_
+    {3503, 114, 296, 185, 8487, 8355}, // UNIMOD_dHex_1_Hex_2_
+    {3504, 114, 296, 185, 8497, 8356}, // UNIMOD_dHex_1_Hex_3_
+    {3505, 114, 296, 185, 8507, 8357}, // UNIMOD_dHex_1_Hex_4_
+    {3506, 114, 296, 185, 8517, 8358}, // UNIMOD_dHex_1_Hex_5_
+    {3507, 114, 296, 185, 8527, 8359}, // UNIMOD_dHex_1_Hex_6_
+    {3508, 114, 296, 185, 8537, 8360}, // UNIMOD_methylsulfonylethyl
+    {3509, 114, 296, 185, 8551, 8361}, // UNIMOD_ethylsulfonylethyl
+    {3510, 114, 296, 185, 8565, 8362}, // UNIMOD_phenylsulfonylethyl
+    {3511, 114, 296, 185, 8571, 8363}, // UNIMOD_PyridoxalPhosphateH2
+    {3512, 114, 296, 185, 8577, 8364}, // UNIMOD_Homocysteic_acid
+    {3513, 114, 296, 185, 8583, 8365}, // UNIMOD_Hydroxamic_acid
+    {3514, 114, 296, 185, 8593, 8366}, // UNIMOD_3_phosphoglyceryl
+    {3515, 114, 296, 185, 8599, 8367}, // UNIMOD_HN2_mustard
+    {3516, 114, 296, 185, 8613, 8368}, // UNIMOD_HN3_mustard
+    {3517, 114, 296, 185, 8627, 8369}, // UNIMOD_Oxidation_NEM
+    {3518, 114, 296, 185, 8633, 8370}, // UNIMOD_NHS_fluorescein
+    {3519, 114, 296, 185, 8639, 8371}, // UNIMOD_DiART6plex
+    {3520, 114, 296, 185, 8657, 8372}, // UNIMOD_DiART6plex115
+    {3521, 114, 296, 185, 8675, 8373}, // UNIMOD_DiART6plex116_119
+    {3522, 114, 296, 185, 8693, 8374}, // UNIMOD_DiART6plex117
+    {3523, 114, 296, 185, 8711, 8375}, // UNIMOD_DiART6plex118
+    {3524, 114, 296, 185, 8729, 8376}, // UNIMOD_Iodoacetanilide
+    {3525, 114, 296, 185, 8743, 8377}, // UNIMOD_Iodoacetanilide_13C_6_
+    {3526, 114, 296, 185, 8757, 8378}, // UNIMOD_Dap_DSP
+    {3527, 114, 296, 185, 8771, 8379}, // UNIMOD_MurNAc
+    {3528, 114, 296, 185, 8777, 8380}, // UNIMOD_Label_2H_7_15N_4_
+    {3529, 114, 296, 185, 8783, 8381}, // UNIMOD_Label_2H_6_15N_1_
+    {3530, 114, 296, 185, 8789, 8382}, // UNIMOD_EEEDVIEVYQEQTGG
+    {3531, 114, 296, 185, 8795, 8383}, // UNIMOD_EDEDTIDVFQQQTGG
+    {3532, 114, 296, 185, 8801, 8384}, // UNIMOD_Hex_5_HexNAc_4_NeuAc_2_
+    {3533, 114, 296, 185, 8807, 8385}, // UNIMOD_Hex_5_HexNAc_4_NeuAc_1_
+    {3534, 114, 296, 185, 8813, 8386}, // UNIMOD_dHex_1_Hex_5_HexNAc_4_NeuAc_1_
+    {3535, 114, 296, 185, 8819, 8387}, // UNIMOD_dHex_1_Hex_5_HexNAc_4_NeuAc_2_
+    {3536, 114, 296, 185, 8825, 8388}, // UNIMOD_s_GlcNAc
+    {3537, 114, 296, 185, 8835, 8389}, // UNIMOD_PhosphoHex_2_
+    {3538, 114, 296, 185, 8849, 8390}, // UNIMOD_Trimethyl_13C_3_2H_9_
+    {3539, 114, 296, 185, 8859, 8391}, // UNIMOD_15N_oxobutanoic
+    {3540, 114, 296, 185, 8873, 8392}, // UNIMOD_spermine
+    {3541, 114, 296, 185, 8879, 8393}, // UNIMOD_spermidine
+    {3542, 114, 296, 185, 8885, 8394}, // UNIMOD_Biotin_Thermo_21330
+    {3543, 114, 296, 185, 8895, 8395}, // UNIMOD_Pentose
+    {3544, 114, 296, 185, 8905, 8396}, // UNIMOD_Hex_1_Pent_1_
+    {3545, 114, 296, 185, 8915, 8397}, // UNIMOD_Hex_1_HexA_1_
+    {3546, 114, 296, 185, 8925, 8398}, // UNIMOD_Hex_1_Pent_2_
+    {3547, 114, 296, 185, 8935, 8399}, // UNIMOD_Hex_1_HexNAc_1_Phos_1_
+    {3548, 114, 296, 185, 8945, 8400}, // UNIMOD_Hex_1_HexNAc_1_Sulf_1_
+    {3549, 114, 296, 185, 8955, 8401}, // UNIMOD_Hex_1_NeuAc_1_
+    {3550, 114, 296, 185, 8965, 8402}, // UNIMOD_Hex_1_NeuGc_1_
+    {3551, 114, 296, 185, 8975, 8403}, // UNIMOD_HexNAc_3_
+    {3552, 114, 296, 185, 8985, 8404}, // UNIMOD_HexNAc_1_NeuAc_1_
+    {3553, 114, 296, 185, 8995, 8405}, // UNIMOD_HexNAc_1_NeuGc_1_
+    {3554, 114, 296, 185, 9005, 8406}, // UNIMOD_Hex_1_HexNAc_1_dHex_1_Me_1_
+    {3555, 114, 296, 185, 9015, 8407}, // UNIMOD_Hex_1_HexNAc_1_dHex_1_Me_2_
+    {3556, 114, 296, 185, 9025, 8408}, // UNIMOD_Hex_2_HexNAc_1_
+    {3557, 114, 296, 185, 9035, 8409}, // UNIMOD_Hex_1_HexA_1_HexNAc_1_
+    {3558, 114, 296, 185, 9045, 8410}, // UNIMOD_Hex_2_HexNAc_1_Me_1_
+    {3559, 114, 296, 185, 9055, 8411}, // UNIMOD_Hex_3_Phos_1_
+    {3560, 114, 296, 185, 9065, 8412}, // UNIMOD_Hex_1_NeuAc_1_Pent_1_
+    {3561, 114, 296, 185, 9075, 8413}, // UNIMOD_Hex_2_HexNAc_1_Sulf_1_
+    {3562, 114, 296, 185, 9085, 8414}, // UNIMOD_Hex_2_NeuAc_1_
+    {3563, 114, 296, 185, 9095, 8415}, // UNIMOD_dHex_2_Hex_2_
+    {3564, 114, 296, 185, 9105, 8416}, // UNIMOD_dHex_1_Hex_2_HexA_1_
+    {3565, 114, 296, 185, 9115, 8417}, // UNIMOD_Hex_1_HexNAc_2_Sulf_1_
+    {3566, 114, 296, 185, 9125, 8418}, // UNIMOD_Hex_4_
+    {3567, 114, 296, 185, 9135, 8419}, // UNIMOD_dHex_1_Hex_2_HexNAc_2_Pent_1_
+    {3568, 114, 296, 185, 9141, 8420}, // UNIMOD_Hex_2_HexNAc_2_NeuAc_1_
+    {3569, 114, 296, 185, 9147, 8421}, // UNIMOD_Hex_3_HexNAc_2_Pent_1_
+    {3570, 114, 296, 185, 9153, 8422}, // UNIMOD_Hex_4_HexNAc_2_
+    {3571, 114, 296, 185, 9159, 8423}, // UNIMOD_dHex_1_Hex_4_HexNAc_1_Pent_1_
+    {3572, 114, 296, 185, 9165, 8424}, // UNIMOD_dHex_1_Hex_3_HexNAc_2_Pent_1_
+    {3573, 114, 296, 185, 9171, 8425}, // UNIMOD_Hex_3_HexNAc_2_NeuAc_1_
+    {3574, 114, 296, 185, 9177, 8426}, // UNIMOD_Hex_4_HexNAc_2_Pent_1_
+    {3575, 114, 296, 185, 9183, 8427}, // UNIMOD_Hex_3_HexNAc_3_Pent_1_
+    {3576, 114, 296, 185, 9189, 8428}, // UNIMOD_Hex_5_HexNAc_2_Phos_1_
+    {3577, 114, 296, 185, 9195, 8429}, // UNIMOD_dHex_1_Hex_4_HexNAc_2_Pent_1_
+    {3578, 114, 296, 185, 9201, 8430}, // UNIMOD_Hex_7_HexNAc_1_
+    {3579, 114, 296, 185, 9207, 8431}, // UNIMOD_Hex_4_HexNAc_2_NeuAc_1_
+    {3580, 114, 296, 185, 9213, 8432}, // UNIMOD_dHex_1_Hex_5_HexNAc_2_
+    {3581, 114, 296, 185, 9219, 8433}, // UNIMOD_dHex_1_Hex_3_HexNAc_3_Pent_1_
+    {3582, 114, 296, 185, 9225, 8434}, // UNIMOD_Hex_3_HexNAc_4_Sulf_1_
+    {3583, 114, 296, 185, 9231, 8435}, // UNIMOD_Hex_6_HexNAc_2_
+    {3584, 114, 296, 185, 9237, 8436}, // UNIMOD_Hex_4_HexNAc_3_Pent_1_
+    {3585, 114, 296, 185, 9243, 8437}, // UNIMOD_dHex_1_Hex_4_HexNAc_3_
+    {3586, 114, 296, 185, 9249, 8438}, // UNIMOD_Hex_5_HexNAc_3_
+    {3587, 114, 296, 185, 9255, 8439}, // UNIMOD_Hex_3_HexNAc_4_Pent_1_
+    {3588, 114, 296, 185, 9261, 8440}, // UNIMOD_Hex_6_HexNAc_2_Phos_1_
+    {3589, 114, 296, 185, 9267, 8441}, // UNIMOD_dHex_1_Hex_4_HexNAc_3_Sulf_1_
+    {3590, 114, 296, 185, 9273, 8442}, // UNIMOD_dHex_1_Hex_5_HexNAc_2_Pent_1_
+    {3591, 114, 296, 185, 9279, 8443}, // UNIMOD_Hex_8_HexNAc_1_
+    {3592, 114, 296, 185, 9285, 8444}, // UNIMOD_dHex_1_Hex_3_HexNAc_3_Pent_2_
+    {3593, 114, 296, 185, 9291, 8445}, // UNIMOD_dHex_2_Hex_3_HexNAc_3_Pent_1_
+    {3594, 114, 296, 185, 9297, 8446}, // UNIMOD_dHex_1_Hex_3_HexNAc_4_Sulf_1_
+    {3595, 114, 296, 185, 9303, 8447}, // UNIMOD_dHex_1_Hex_6_HexNAc_2_
+    {3596, 114, 296, 185, 9309, 8448}, // UNIMOD_dHex_1_Hex_4_HexNAc_3_Pent_1_
+    {3597, 114, 296, 185, 9315, 8449}, // UNIMOD_Hex_4_HexNAc_4_Sulf_1_
+    {3598, 114, 296, 185, 9321, 8450}, // UNIMOD_Hex_7_HexNAc_2_
+    {3599, 114, 296, 185, 9327, 8451}, // UNIMOD_dHex_2_Hex_4_HexNAc_3_
+    {3600, 114, 296, 185, 9333, 8452}, // UNIMOD_Hex_5_HexNAc_3_Pent_1_
+    {3601, 114, 296, 185, 9339, 8453}, // UNIMOD_Hex_4_HexNAc_3_NeuGc_1_
+    {3602, 114, 296, 185, 9345, 8454}, // UNIMOD_dHex_1_Hex_5_HexNAc_3_
+    {3603, 114, 296, 185, 9351, 8455}, // UNIMOD_dHex_1_Hex_3_HexNAc_4_Pent_1_
+    {3604, 114, 296, 185, 9357, 8456}, // UNIMOD_Hex_3_HexNAc_5_Sulf_1_
+    {3605, 114, 296, 185, 9363, 8457}, // UNIMOD_Hex_6_HexNAc_3_
+    {3606, 114, 296, 185, 9369, 8458}, // UNIMOD_Hex_3_HexNAc_4_NeuAc_1_
+    {3607, 114, 296, 185, 9375, 8459}, // UNIMOD_Hex_4_HexNAc_4_Pent_1_
+    {3608, 114, 296, 185, 9381, 8460}, // UNIMOD_Hex_7_HexNAc_2_Phos_1_
+    {3609, 114, 296, 185, 9387, 8461}, // UNIMOD_Hex_4_HexNAc_4_Me_2_Pent_1_
+    {3610, 114, 296, 185, 9393, 8462}, // UNIMOD_dHex_1_Hex_3_HexNAc_3_Pent_3_
+    {3611, 114, 296, 185, 9399, 8463}, // UNIMOD_dHex_1_Hex_5_HexNAc_3_Sulf_1_
+    {3612, 114, 296, 185, 9405, 8464}, // UNIMOD_dHex_2_Hex_3_HexNAc_3_Pent_2_
+    {3613, 114, 296, 185, 9411, 8465}, // UNIMOD_Hex_6_HexNAc_3_Phos_1_
+    {3614, 114, 296, 185, 9417, 8466}, // UNIMOD_Hex_4_HexNAc_5_
+    {3615, 114, 296, 185, 9423, 8467}, // UNIMOD_dHex_3_Hex_3_HexNAc_3_Pent_1_
+    {3616, 114, 296, 185, 9429, 8468}, // UNIMOD_dHex_2_Hex_4_HexNAc_3_Pent_1_
+    {3617, 114, 296, 185, 9435, 8469}, // UNIMOD_dHex_1_Hex_4_HexNAc_4_Sulf_1_
+    {3618, 114, 296, 185, 9441, 8470}, // UNIMOD_dHex_1_Hex_7_HexNAc_2_
+    {3619, 114, 296, 185, 9447, 8471}, // UNIMOD_dHex_1_Hex_4_HexNAc_3_NeuAc_1_
+    {3620, 114, 296, 185, 9453, 8472}, // UNIMOD_Hex_7_HexNAc_2_Phos_2_
+    {3621, 114, 296, 185, 9459, 8473}, // UNIMOD_Hex_5_HexNAc_4_Sulf_1_
+    {3622, 114, 296, 185, 9465, 8474}, // UNIMOD_Hex_8_HexNAc_2_
+    {3623, 114, 296, 185, 9471, 8475}, // UNIMOD_dHex_1_Hex_3_HexNAc_4_Pent_2_
+    {3624, 114, 296, 185, 9477, 8476}, // UNIMOD_dHex_1_Hex_4_HexNAc_3_NeuGc_1_
+    {3625, 114, 296, 185, 9483, 8477}, // UNIMOD_dHex_2_Hex_3_HexNAc_4_Pent_1_
+    {3626, 114, 296, 185, 9489, 8478}, // UNIMOD_dHex_1_Hex_3_HexNAc_5_Sulf_1_
+    {3627, 114, 296, 185, 9495, 8479}, // UNIMOD_dHex_1_Hex_6_HexNAc_3_
+    {3628, 114, 296, 185, 9501, 8480}, // UNIMOD_dHex_1_Hex_3_HexNAc_4_NeuAc_1_
+    {3629, 114, 296, 185, 9507, 8481}, // UNIMOD_dHex_3_Hex_3_HexNAc_4_
+    {3630, 114, 296, 185, 9513, 8482}, // UNIMOD_dHex_1_Hex_4_HexNAc_4_Pent_1_
+    {3631, 114, 296, 185, 9519, 8483}, // UNIMOD_Hex_4_HexNAc_5_Sulf_1_
+    {3632, 114, 296, 185, 9525, 8484}, // UNIMOD_Hex_7_HexNAc_3_
+    {3633, 114, 296, 185, 9531, 8485}, // UNIMOD_dHex_1_Hex_4_HexNAc_3_NeuAc_1_Sulf_1_
+    {3634, 114, 296, 185, 9537, 8486}, // UNIMOD_Hex_5_HexNAc_4_Me_2_Pent_1_
+    {3635, 114, 296, 185, 9543, 8487}, // UNIMOD_Hex_3_HexNAc_6_Sulf_1_
+    {3636, 114, 296, 185, 9549, 8488}, // UNIMOD_dHex_1_Hex_6_HexNAc_3_Sulf_1_
+    {3637, 114, 296, 185, 9555, 8489}, // UNIMOD_dHex_1_Hex_4_HexNAc_5_
+    {3638, 114, 296, 185, 9561, 8490}, // UNIMOD_dHex_1_Hex_5_HexA_1_HexNAc_3_Sulf_1_
+    {3639, 114, 296, 185, 9567, 8491}, // UNIMOD_Hex_7_HexNAc_3_Phos_1_
+    {3640, 114, 296, 185, 9573, 8492}, // UNIMOD_Hex_6_HexNAc_4_Me_3_
+    {3641, 114, 296, 185, 9579, 8493}, // UNIMOD_dHex_2_Hex_4_HexNAc_4_Sulf_1_
+    {3642, 114, 296, 185, 9585, 8494}, // UNIMOD_Hex_4_HexNAc_3_NeuAc_2_
+    {3643, 114, 296, 185, 9591, 8495}, // UNIMOD_dHex_1_Hex_3_HexNAc_4_Pent_3_
+    {3644, 114, 296, 185, 9597, 8496}, // UNIMOD_dHex_2_Hex_5_HexNAc_3_Pent_1_
+    {3645, 114, 296, 185, 9603, 8497}, // UNIMOD_dHex_1_Hex_5_HexNAc_4_Sulf_1_
+    {3646, 114, 296, 185, 9609, 8498}, // UNIMOD_dHex_2_Hex_3_HexNAc_4_Pent_2_
+    {3647, 114, 296, 185, 9615, 8499}, // UNIMOD_dHex_1_Hex_5_HexNAc_3_NeuAc_1_
+    {3648, 114, 296, 185, 9621, 8500}, // UNIMOD_Hex_3_HexNAc_6_Sulf_2_
+    {3649, 114, 296, 185, 9627, 8501}, // UNIMOD_Hex_9_HexNAc_2_
+    {3650, 114, 296, 185, 9633, 8502}, // UNIMOD_Hex_4_HexNAc_6_
+    {3651, 114, 296, 185, 9639, 8503}, // UNIMOD_dHex_3_Hex_3_HexNAc_4_Pent_1_
+    {3652, 114, 296, 185, 9645, 8504}, // UNIMOD_dHex_1_Hex_5_HexNAc_3_NeuGc_1_
+    {3653, 114, 296, 185, 9651, 8505}, // UNIMOD_dHex_2_Hex_4_HexNAc_4_Pent_1_
+    {3654, 114, 296, 185, 9657, 8506}, // UNIMOD_dHex_1_Hex_4_HexNAc_5_Sulf_1_
+    {3655, 114, 296, 185, 9663, 8507}, // UNIMOD_dHex_1_Hex_7_HexNAc_3_
+    {3656, 114, 296, 185, 9669, 8508}, // UNIMOD_dHex_1_Hex_5_HexNAc_4_Pent_1_
+    {3657, 114, 296, 185, 9675, 8509}, // UNIMOD_dHex_1_Hex_5_HexA_1_HexNAc_3_Sulf_2_
+    {3658, 114, 296, 185, 9681, 8510}, // UNIMOD_Hex_3_HexNAc_7_
+    {3659, 114, 296, 185, 9687, 8511}, // UNIMOD_dHex_2_Hex_5_HexNAc_4_
+    {3660, 114, 296, 185, 9693, 8512}, // UNIMOD_dHex_2_Hex_4_HexNAc_3_NeuAc_1_Sulf_1_
+    {3661, 114, 296, 185, 9699, 8513}, // UNIMOD_dHex_1_Hex_5_HexNAc_4_Sulf_2_
+    {3662, 114, 296, 185, 9705, 8514}, // UNIMOD_dHex_1_Hex_5_HexNAc_4_Me_2_Pent_1_
+    {3663, 114, 296, 185, 9711, 8515}, // UNIMOD_Hex_5_HexNAc_4_NeuGc_1_
+    {3664, 114, 296, 185, 9717, 8516}, // UNIMOD_dHex_1_Hex_3_HexNAc_6_Sulf_1_
+    {3665, 114, 296, 185, 9723, 8517}, // UNIMOD_dHex_1_Hex_6_HexNAc_4_
+    {3666, 114, 296, 185, 9729, 8518}, // UNIMOD_dHex_1_Hex_5_HexNAc_3_NeuAc_1_Sulf_1_
+    {3667, 114, 296, 185, 9735, 8519}, // UNIMOD_Hex_7_HexNAc_4_
+    {3668, 114, 296, 185, 9741, 8520}, // UNIMOD_dHex_1_Hex_5_HexNAc_3_NeuGc_1_Sulf_1_
+    {3669, 114, 296, 185, 9747, 8521}, // UNIMOD_Hex_4_HexNAc_5_NeuAc_1_
+    {3670, 114, 296, 185, 9753, 8522}, // UNIMOD_Hex_6_HexNAc_4_Me_3_Pent_1_
+    {3671, 114, 296, 185, 9759, 8523}, // UNIMOD_dHex_1_Hex_7_HexNAc_3_Sulf_1_
+    {3672, 114, 296, 185, 9765, 8524}, // UNIMOD_dHex_1_Hex_7_HexNAc_3_Phos_1_
+    {3673, 114, 296, 185, 9771, 8525}, // UNIMOD_dHex_1_Hex_5_HexNAc_5_
+    {3674, 114, 296, 185, 9777, 8526}, // UNIMOD_dHex_1_Hex_4_HexNAc_4_NeuAc_1_Sulf_1_
+    {3675, 114, 296, 185, 9783, 8527}, // UNIMOD_dHex_3_Hex_4_HexNAc_4_Sulf_1_
+    {3676, 114, 296, 185, 9789, 8528}, // UNIMOD_Hex_3_HexNAc_7_Sulf_1_
+    {3677, 114, 296, 185, 9795, 8529}, // UNIMOD_Hex_6_HexNAc_5_
+    {3678, 114, 296, 185, 9801, 8530}, // UNIMOD_Hex_5_HexNAc_4_NeuAc_1_Sulf_1_
+    {3679, 114, 296, 185, 9807, 8531}, // UNIMOD_Hex_3_HexNAc_6_NeuAc_1_
+    {3680, 114, 296, 185, 9813, 8532}, // UNIMOD_dHex_2_Hex_3_HexNAc_6_
+    {3681, 114, 296, 185, 9819, 8533}, // UNIMOD_Hex_1_HexNAc_1_NeuGc_1_
+    {3682, 114, 296, 185, 9829, 8534}, // UNIMOD_dHex_1_Hex_2_HexNAc_1_
+    {3683, 114, 296, 185, 9839, 8535}, // UNIMOD_HexNAc_3_Sulf_1_
+    {3684, 114, 296, 185, 9849, 8536}, // UNIMOD_Hex_3_HexNAc_1_
+    {3685, 114, 296, 185, 9859, 8537}, // UNIMOD_Hex_1_HexNAc_1_Kdn_1_Sulf_1_
+    {3686, 114, 296, 185, 9869, 8538}, // UNIMOD_HexNAc_2_NeuAc_1_
+    {3687, 114, 296, 185, 9879, 8539}, // UNIMOD_HexNAc_1_Kdn_2_
+    {3688, 114, 296, 185, 9889, 8540}, // UNIMOD_Hex_3_HexNAc_1_Me_1_
+    {3689, 114, 296, 185, 9899, 8541}, // UNIMOD_Hex_2_HexA_1_Pent_1_Sulf_1_
+    {3690, 114, 296, 185, 9909, 8542}, // UNIMOD_HexNAc_2_NeuGc_1_
+    {3691, 114, 296, 185, 9919, 8543}, // UNIMOD_Hex_4_Phos_1_
+    {3692, 114, 296, 185, 9929, 8544}, // UNIMOD_Hex_1_HexNAc_1_NeuAc_1_Sulf_1_
+    {3693, 114, 296, 185, 9939, 8545}, // UNIMOD_Hex_1_HexA_1_HexNAc_2_
+    {3694, 114, 296, 185, 9949, 8546}, // UNIMOD_dHex_1_Hex_2_HexNAc_1_Sulf_1_
+    {3695, 114, 296, 185, 9959, 8547}, // UNIMOD_dHex_1_HexNAc_3_
+    {3696, 114, 296, 185, 9969, 8548}, // UNIMOD_dHex_1_Hex_1_HexNAc_1_Kdn_1_
+    {3697, 114, 296, 185, 9979, 8549}, // UNIMOD_Hex_1_HexNAc_3_
+    {3698, 114, 296, 185, 9989, 8550}, // UNIMOD_HexNAc_2_NeuAc_1_Sulf_1_
+    {3699, 114, 296, 185, 9999, 8551}, // UNIMOD_dHex_2_Hex_3_
+    {3700, 114, 296, 185, 10009, 8552}, // UNIMOD_Hex_2_HexA_1_HexNAc_1_Sulf_1_
+    {3701, 114, 296, 185, 10019, 8553}, // UNIMOD_dHex_2_Hex_2_HexA_1_
+    {3702, 114, 296, 185, 10029, 8554}, // UNIMOD_dHex_1_Hex_1_HexNAc_2_Sulf_1_
+    {3703, 114, 296, 185, 10039, 8555}, // UNIMOD_dHex_1_Hex_1_HexNAc_1_NeuAc_1_
+    {3704, 114, 296, 185, 10049, 8556}, // UNIMOD_Hex_2_HexNAc_2_Sulf_1_
+    {3705, 114, 296, 185, 10059, 8557}, // UNIMOD_Hex_5_
+    {3706, 114, 296, 185, 10069, 8558}, // UNIMOD_HexNAc_4_
+    {3707, 114, 296, 185, 10079, 8559}, // UNIMOD_HexNAc_1_NeuGc_2_
+    {3708, 114, 296, 185, 10089, 8560}, // UNIMOD_dHex_1_Hex_1_HexNAc_1_NeuGc_1_
+    {3709, 114, 296, 185, 10099, 8561}, // UNIMOD_dHex_2_Hex_2_HexNAc_1_
+    {3710, 114, 296, 185, 10109, 8562}, // UNIMOD_Hex_2_HexNAc_1_NeuGc_1_
+    {3711, 114, 296, 185, 10119, 8563}, // UNIMOD_dHex_1_Hex_3_HexNAc_1_
+    {3712, 114, 296, 185, 10129, 8564}, // UNIMOD_dHex_1_Hex_2_HexA_1_HexNAc_1_
+    {3713, 114, 296, 185, 10139, 8565}, // UNIMOD_Hex_1_HexNAc_3_Sulf_1_
+    {3714, 114, 296, 185, 10149, 8566}, // UNIMOD_Hex_4_HexNAc_1_
+    {3715, 114, 296, 185, 10159, 8567}, // UNIMOD_Hex_1_HexNAc_2_NeuAc_1_
+    {3716, 114, 296, 185, 10169, 8568}, // UNIMOD_Hex_1_HexNAc_2_NeuGc_1_
+    {3717, 114, 296, 185, 10179, 8569}, // UNIMOD_Hex_5_Phos_1_
+    {3718, 114, 296, 185, 10189, 8570}, // UNIMOD_dHex_2_Hex_1_HexNAc_1_Kdn_1_
+    {3719, 114, 296, 185, 10199, 8571}, // UNIMOD_dHex_1_Hex_3_HexNAc_1_Sulf_1_
+    {3720, 114, 296, 185, 10209, 8572}, // UNIMOD_dHex_1_Hex_1_HexNAc_3_
+    {3721, 114, 296, 185, 10219, 8573}, // UNIMOD_dHex_1_Hex_2_HexA_1_HexNAc_1_Sulf_1_
+    {3722, 114, 296, 185, 10229, 8574}, // UNIMOD_Hex_2_HexNAc_3_
+    {3723, 114, 296, 185, 10239, 8575}, // UNIMOD_Hex_1_HexNAc_2_NeuAc_1_Sulf_1_
+    {3724, 114, 296, 185, 10249, 8576}, // UNIMOD_dHex_2_Hex_4_
+    {3725, 114, 296, 185, 10259, 8577}, // UNIMOD_dHex_2_HexNAc_2_Kdn_1_
+    {3726, 114, 296, 185, 10269, 8578}, // UNIMOD_dHex_1_Hex_2_HexNAc_2_Sulf_1_
+    {3727, 114, 296, 185, 10279, 8579}, // UNIMOD_dHex_1_HexNAc_4_
+    {3728, 114, 296, 185, 10289, 8580}, // UNIMOD_Hex_1_HexNAc_1_NeuAc_1_NeuGc_1_
+    {3729, 114, 296, 185, 10299, 8581}, // UNIMOD_dHex_1_Hex_1_HexNAc_2_Kdn_1_
+    {3730, 114, 296, 185, 10309, 8582}, // UNIMOD_Hex_1_HexNAc_1_NeuGc_2_
+    {3731, 114, 296, 185, 10319, 8583}, // UNIMOD_Hex_1_HexNAc_1_NeuAc_2_Ac_1_
+    {3732, 114, 296, 185, 10329, 8584}, // UNIMOD_dHex_2_Hex_2_HexA_1_HexNAc_1_
+    {3733, 114, 296, 185, 10339, 8585}, // UNIMOD_dHex_1_Hex_1_HexNAc_3_Sulf_1_
+    {3734, 114, 296, 185, 10349, 8586}, // UNIMOD_Hex_2_HexA_1_NeuAc_1_Pent_1_Sulf_1_
+    {3735, 114, 296, 185, 10359, 8587}, // UNIMOD_dHex_1_Hex_1_HexNAc_2_NeuAc_1_
+    {3736, 114, 296, 185, 10369, 8588}, // UNIMOD_dHex_1_Hex_3_HexA_1_HexNAc_1_
+    {3737, 114, 296, 185, 10379, 8589}, // UNIMOD_Hex_2_HexNAc_3_Sulf_1_
+    {3738, 114, 296, 185, 10389, 8590}, // UNIMOD_Hex_5_HexNAc_1_
+    {3739, 114, 296, 185, 10399, 8591}, // UNIMOD_HexNAc_5_
+    {3740, 114, 296, 185, 10409, 8592}, // UNIMOD_dHex_1_Hex_1_HexNAc_2_NeuGc_1_
+    {3741, 114, 296, 185, 10419, 8593}, // UNIMOD_Hex_1_HexNAc_1_NeuAc_2_Ac_2_
+    {3742, 114, 296, 185, 10429, 8594}, // UNIMOD_Hex_2_HexNAc_2_NeuGc_1_
+    {3743, 114, 296, 185, 10439, 8595}, // UNIMOD_Hex_5_Phos_3_
+    {3744, 114, 296, 185, 10449, 8596}, // UNIMOD_Hex_6_Phos_1_
+    {3745, 114, 296, 185, 10459, 8597}, // UNIMOD_dHex_1_Hex_2_HexA_1_HexNAc_2_
+    {3746, 114, 296, 185, 10469, 8598}, // UNIMOD_dHex_2_Hex_3_HexNAc_1_Sulf_1_
+    {3747, 114, 296, 185, 10479, 8599}, // UNIMOD_Hex_1_HexNAc_3_NeuAc_1_
+    {3748, 114, 296, 185, 10489, 8600}, // UNIMOD_dHex_2_Hex_1_HexNAc_3_
+    {3749, 114, 296, 185, 10499, 8601}, // UNIMOD_Hex_1_HexNAc_3_NeuGc_1_
+    {3750, 114, 296, 185, 10509, 8602}, // UNIMOD_dHex_1_Hex_1_HexNAc_2_NeuAc_1_Sulf_1_
+    {3751, 114, 296, 185, 10519, 8603}, // UNIMOD_dHex_1_Hex_3_HexA_1_HexNAc_1_Sulf_1_
+    {3752, 114, 296, 185, 10529, 8604}, // UNIMOD_dHex_1_Hex_1_HexA_1_HexNAc_3_
+    {3753, 114, 296, 185, 10539, 8605}, // UNIMOD_Hex_2_HexNAc_2_NeuAc_1_Sulf_1_
+    {3754, 114, 296, 185, 10549, 8606}, // UNIMOD_dHex_2_Hex_2_HexNAc_2_Sulf_1_
+    {3755, 114, 296, 185, 10559, 8607}, // UNIMOD_dHex_2_Hex_1_HexNAc_2_Kdn_1_
+    {3756, 114, 296, 185, 10569, 8608}, // UNIMOD_dHex_1_Hex_1_HexNAc_4_
+    {3757, 114, 296, 185, 10579, 8609}, // UNIMOD_Hex_2_HexNAc_4_
+    {3758, 114, 296, 185, 10589, 8610}, // UNIMOD_Hex_2_HexNAc_1_NeuGc_2_
+    {3759, 114, 296, 185, 10599, 8611}, // UNIMOD_dHex_2_Hex_4_HexNAc_1_
+    {3760, 114, 296, 185, 10609, 8612}, // UNIMOD_Hex_1_HexNAc_2_NeuAc_2_
+    {3761, 114, 296, 185, 10619, 8613}, // UNIMOD_dHex_2_Hex_1_HexNAc_2_NeuAc_1_
+    {3762, 114, 296, 185, 10629, 8614}, // UNIMOD_dHex_1_Hex_2_HexNAc_3_Sulf_1_
+    {3763, 114, 296, 185, 10639, 8615}, // UNIMOD_dHex_1_HexNAc_5_
+    {3764, 114, 296, 185, 10649, 8616}, // UNIMOD_dHex_2_Hex_1_HexNAc_2_NeuGc_1_
+    {3765, 114, 296, 185, 10659, 8617}, // UNIMOD_dHex_3_Hex_2_HexNAc_2_
+    {3766, 114, 296, 185, 10669, 8618}, // UNIMOD_Hex_3_HexNAc_3_Sulf_1_
+    {3767, 114, 296, 185, 10679, 8619}, // UNIMOD_dHex_2_Hex_2_HexNAc_2_Sulf_2_
+    {3768, 114, 296, 185, 10689, 8620}, // UNIMOD_dHex_1_Hex_2_HexNAc_2_NeuGc_1_
+    {3769, 114, 296, 185, 10699, 8621}, // UNIMOD_dHex_1_Hex_1_HexNAc_3_NeuAc_1_
+    {3770, 114, 296, 185, 10709, 8622}, // UNIMOD_Hex_6_Phos_3_
+    {3771, 114, 296, 185, 10719, 8623}, // UNIMOD_dHex_1_Hex_3_HexA_1_HexNAc_2_
+    {3772, 114, 296, 185, 10729, 8624}, // UNIMOD_dHex_1_Hex_1_HexNAc_3_NeuGc_1_
+    {3773, 114, 296, 185, 10739, 8625}, // UNIMOD_Hex_1_HexNAc_2_NeuAc_2_Sulf_1_
+    {3774, 114, 296, 185, 10749, 8626}, // UNIMOD_dHex_2_Hex_3_HexA_1_HexNAc_1_Sulf_1_
+    {3775, 114, 296, 185, 10759, 8627}, // UNIMOD_Hex_1_HexNAc_1_NeuAc_3_
+    {3776, 114, 296, 185, 10769, 8628}, // UNIMOD_Hex_2_HexNAc_3_NeuGc_1_
+    {3777, 114, 296, 185, 10779, 8629}, // UNIMOD_dHex_1_Hex_2_HexNAc_2_NeuAc_1_Sulf_1_
+    {3778, 114, 296, 185, 10789, 8630}, // UNIMOD_dHex_3_Hex_1_HexNAc_2_Kdn_1_
+    {3779, 114, 296, 185, 10799, 8631}, // UNIMOD_dHex_2_Hex_3_HexNAc_2_Sulf_1_
+    {3780, 114, 296, 185, 10809, 8632}, // UNIMOD_dHex_2_Hex_2_HexNAc_2_Kdn_1_
+    {3781, 114, 296, 185, 10819, 8633}, // UNIMOD_dHex_2_Hex_2_HexA_1_HexNAc_2_Sulf_1_
+    {3782, 114, 296, 185, 10829, 8634}, // UNIMOD_dHex_1_Hex_2_HexNAc_4_
+    {3783, 114, 296, 185, 10839, 8635}, // UNIMOD_Hex_1_HexNAc_1_NeuGc_3_
+    {3784, 114, 296, 185, 10849, 8636}, // UNIMOD_dHex_1_Hex_1_HexNAc_3_NeuAc_1_Sulf_1_
+    {3785, 114, 296, 185, 10859, 8637}, // UNIMOD_dHex_1_Hex_3_HexA_1_HexNAc_2_Sulf_1_
+    {3786, 114, 296, 185, 10869, 8638}, // UNIMOD_dHex_1_Hex_1_HexNAc_2_NeuAc_2_
+    {3787, 114, 296, 185, 10879, 8639}, // UNIMOD_dHex_3_HexNAc_3_Kdn_1_
+    {3788, 114, 296, 185, 10889, 8640}, // UNIMOD_Hex_2_HexNAc_3_NeuAc_1_Sulf_1_
+    {3789, 114, 296, 185, 10899, 8641}, // UNIMOD_dHex_2_Hex_2_HexNAc_3_Sulf_1_
+    {3790, 114, 296, 185, 10909, 8642}, // UNIMOD_dHex_2_HexNAc_5_
+    {3791, 114, 296, 185, 10919, 8643}, // UNIMOD_Hex_2_HexNAc_2_NeuAc_2_
+    {3792, 114, 296, 185, 10929, 8644}, // UNIMOD_dHex_2_Hex_2_HexNAc_2_NeuAc_1_
+    {3793, 114, 296, 185, 10939, 8645}, // UNIMOD_dHex_1_Hex_3_HexNAc_3_Sulf_1_
+    {3794, 114, 296, 185, 10949, 8646}, // UNIMOD_dHex_2_Hex_2_HexNAc_2_NeuGc_1_
+    {3795, 114, 296, 185, 10959, 8647}, // UNIMOD_Hex_2_HexNAc_5_
+    {3796, 114, 296, 185, 10969, 8648}, // UNIMOD_dHex_1_Hex_3_HexNAc_2_NeuGc_1_
+    {3797, 114, 296, 185, 10979, 8649}, // UNIMOD_Hex_1_HexNAc_3_NeuAc_2_
+    {3798, 114, 296, 185, 10989, 8650}, // UNIMOD_dHex_1_Hex_2_HexNAc_3_NeuAc_1_
+    {3799, 114, 296, 185, 10999, 8651}, // UNIMOD_dHex_3_Hex_2_HexNAc_3_
+    {3800, 114, 296, 185, 11009, 8652}, // UNIMOD_Hex_7_Phos_3_
+    {3801, 114, 296, 185, 11019, 8653}, // UNIMOD_dHex_1_Hex_4_HexA_1_HexNAc_2_
+    {3802, 114, 296, 185, 11029, 8654}, // UNIMOD_Hex_3_HexNAc_3_NeuAc_1_
+    {3803, 114, 296, 185, 11039, 8655}, // UNIMOD_dHex_1_Hex_3_HexA_2_HexNAc_2_
+    {3804, 114, 296, 185, 11049, 8656}, // UNIMOD_Hex_2_HexNAc_2_NeuAc_2_Sulf_1_
+    {3805, 114, 296, 185, 11059, 8657}, // UNIMOD_dHex_2_Hex_2_HexNAc_2_NeuAc_1_Sulf_1_
+    {3806, 114, 296, 185, 11069, 8658}, // UNIMOD_Hex_3_HexNAc_3_NeuGc_1_
+    {3807, 114, 296, 185, 11079, 8659}, // UNIMOD_dHex_4_Hex_1_HexNAc_2_Kdn_1_
+    {3808, 114, 296, 185, 11089, 8660}, // UNIMOD_dHex_3_Hex_2_HexNAc_2_Kdn_1_
+    {3809, 114, 296, 185, 11099, 8661}, // UNIMOD_dHex_3_Hex_2_HexA_1_HexNAc_2_Sulf_1_
+    {3810, 114, 296, 185, 11109, 8662}, // UNIMOD_Hex_2_HexNAc_4_NeuAc_1_
+    {3811, 114, 296, 185, 11119, 8663}, // UNIMOD_dHex_2_Hex_2_HexNAc_4_
+    {3812, 114, 296, 185, 11129, 8664}, // UNIMOD_dHex_2_Hex_3_HexA_1_HexNAc_2_Sulf_1_
+    {3813, 114, 296, 185, 11139, 8665}, // UNIMOD_dHex_4_HexNAc_3_Kdn_1_
+    {3814, 114, 296, 185, 11149, 8666}, // UNIMOD_Hex_2_HexNAc_1_NeuGc_3_
+    {3815, 114, 296, 185, 11159, 8667}, // UNIMOD_dHex_4_Hex_1_HexNAc_1_Kdn_2_
+    {3816, 114, 296, 185, 11169, 8668}, // UNIMOD_dHex_1_Hex_2_HexNAc_3_NeuAc_1_Sulf_1_
+    {3817, 114, 296, 185, 11179, 8669}, // UNIMOD_dHex_1_Hex_2_HexNAc_2_NeuAc_2_
+    {3818, 114, 296, 185, 11189, 8670}, // UNIMOD_dHex_3_Hex_1_HexNAc_3_Kdn_1_
+    {3819, 114, 296, 185, 11199, 8671}, // UNIMOD_Hex_3_HexNAc_3_NeuAc_1_Sulf_1_
+    {3820, 114, 296, 185, 11209, 8672}, // UNIMOD_Hex_3_HexNAc_2_NeuAc_2_
+    {3821, 114, 296, 185, 11219, 8673}, // UNIMOD_Hex_3_HexNAc_3_NeuGc_1_Sulf_1_
+    {3822, 114, 296, 185, 11229, 8674}, // UNIMOD_dHex_1_Hex_2_HexNAc_2_NeuGc_2_
+    {3823, 114, 296, 185, 11239, 8675}, // UNIMOD_dHex_2_Hex_3_HexNAc_2_NeuGc_1_
+    {3824, 114, 296, 185, 11249, 8676}, // UNIMOD_dHex_1_Hex_3_HexA_1_HexNAc_3_Sulf_1_
+    {3825, 114, 296, 185, 11259, 8677}, // UNIMOD_Hex_2_HexNAc_3_NeuAc_2_
+    {3826, 114, 296, 185, 11269, 8678}, // UNIMOD_dHex_2_Hex_2_HexNAc_3_NeuAc_1_
+    {3827, 114, 296, 185, 11279, 8679}, // UNIMOD_dHex_4_Hex_2_HexNAc_3_
+    {3828, 114, 296, 185, 11289, 8680}, // UNIMOD_Hex_2_HexNAc_3_NeuAc_1_NeuGc_1_
+    {3829, 114, 296, 185, 11299, 8681}, // UNIMOD_dHex_2_Hex_2_HexNAc_3_NeuGc_1_
+    {3830, 114, 296, 185, 11309, 8682}, // UNIMOD_dHex_3_Hex_3_HexNAc_3_
+    {3831, 114, 296, 185, 11319, 8683}, // UNIMOD_Hex_8_Phos_3_
+    {3832, 114, 296, 185, 11329, 8684}, // UNIMOD_dHex_1_Hex_2_HexNAc_2_NeuAc_2_Sulf_1_
+    {3833, 114, 296, 185, 11339, 8685}, // UNIMOD_Hex_2_HexNAc_3_NeuGc_2_
+    {3834, 114, 296, 185, 11349, 8686}, // UNIMOD_dHex_4_Hex_2_HexNAc_2_Kdn_1_
+    {3835, 114, 296, 185, 11359, 8687}, // UNIMOD_dHex_1_Hex_2_HexNAc_4_NeuAc_1_
+    {3836, 114, 296, 185, 11369, 8688}, // UNIMOD_dHex_3_Hex_2_HexNAc_4_
+    {3837, 114, 296, 185, 11379, 8689}, // UNIMOD_Hex_1_HexNAc_1_NeuGc_4_
+    {3838, 114, 296, 185, 11389, 8690}, // UNIMOD_dHex_4_Hex_1_HexNAc_3_Kdn_1_
+    {3839, 114, 296, 185, 11399, 8691}, // UNIMOD_Hex_4_HexNAc_4_Sulf_2_
+    {3840, 114, 296, 185, 11409, 8692}, // UNIMOD_dHex_3_Hex_2_HexNAc_3_Kdn_1_
+    {3841, 114, 296, 185, 11419, 8693}, // UNIMOD_dHex_2_Hex_2_HexNAc_5_
+    {3842, 114, 296, 185, 11429, 8694}, // UNIMOD_dHex_2_Hex_3_HexA_1_HexNAc_3_Sulf_1_
+    {3843, 114, 296, 185, 11439, 8695}, // UNIMOD_dHex_1_Hex_4_HexA_1_HexNAc_3_Sulf_1_
+    {3844, 114, 296, 185, 11449, 8696}, // UNIMOD_Hex_3_HexNAc_3_NeuAc_2_
+    {3845, 114, 296, 185, 11459, 8697}, // UNIMOD_dHex_2_Hex_3_HexNAc_3_NeuAc_1_
+    {3846, 114, 296, 185, 11469, 8698}, // UNIMOD_dHex_4_Hex_3_HexNAc_3_
+    {3847, 114, 296, 185, 11479, 8699}, // UNIMOD_dHex_2_Hex_3_HexNAc_3_NeuGc_1_
+    {3848, 114, 296, 185, 11489, 8700}, // UNIMOD_Hex_9_Phos_3_
+    {3849, 114, 296, 185, 11499, 8701}, // UNIMOD_dHex_2_HexNAc_7_
+    {3850, 114, 296, 185, 11509, 8702}, // UNIMOD_Hex_2_HexNAc_1_NeuGc_4_
+    {3851, 114, 296, 185, 11519, 8703}, // UNIMOD_Hex_3_HexNAc_3_NeuAc_2_Sulf_1_
+    {3852, 114, 296, 185, 11529, 8704}, // UNIMOD_dHex_2_Hex_3_HexNAc_5_
+    {3853, 114, 296, 185, 11539, 8705}, // UNIMOD_dHex_1_Hex_2_HexNAc_2_NeuGc_3_
+    {3854, 114, 296, 185, 11549, 8706}, // UNIMOD_dHex_2_Hex_4_HexA_1_HexNAc_3_Sulf_1_
+    {3855, 114, 296, 185, 11559, 8707}, // UNIMOD_Hex_2_HexNAc_3_NeuAc_3_
+    {3856, 114, 296, 185, 11569, 8708}, // UNIMOD_dHex_1_Hex_3_HexNAc_3_NeuAc_2_
+    {3857, 114, 296, 185, 11579, 8709}, // UNIMOD_dHex_3_Hex_3_HexNAc_3_NeuAc_1_
+    {3858, 114, 296, 185, 11589, 8710}, // UNIMOD_Hex_2_HexNAc_3_NeuGc_3_
+    {3859, 114, 296, 185, 11599, 8711}, // UNIMOD_Hex_10_Phos_3_
+    {3860, 114, 296, 185, 11609, 8712}, // UNIMOD_dHex_1_Hex_2_HexNAc_4_NeuAc_2_
+    {3861, 114, 296, 185, 11619, 8713}, // UNIMOD_Hex_1_HexNAc_1_NeuGc_5_
+    {3862, 114, 296, 185, 11629, 8714}, // UNIMOD_Hex_4_HexNAc_4_NeuAc_1_Sulf_2_
+    {3863, 114, 296, 185, 11639, 8715}, // UNIMOD_Hex_4_HexNAc_4_NeuGc_1_Sulf_2_
+    {3864, 114, 296, 185, 11649, 8716}, // UNIMOD_dHex_2_Hex_3_HexNAc_3_NeuAc_2_
+    {3865, 114, 296, 185, 11659, 8717}, // UNIMOD_Hex_4_HexNAc_4_NeuAc_1_Sulf_3_
+    {3866, 114, 296, 185, 11669, 8718}, // UNIMOD_dHex_2_Hex_2_HexNAc_2_
+    {3867, 114, 296, 185, 11683, 8719}, // UNIMOD_dHex_1_Hex_3_HexNAc_2_
+    {3868, 114, 296, 185, 11697, 8720}, // UNIMOD_dHex_1_Hex_2_HexNAc_3_
+    {3869, 114, 296, 185, 11711, 8721}, // UNIMOD_Hex_3_HexNAc_3_
+    {3870, 114, 296, 185, 11725, 8722}, // UNIMOD_dHex_1_Hex_3_HexNAc_2_Sulf_1_
+    {3871, 114, 296, 185, 11739, 8723}, // UNIMOD_dHex_2_Hex_3_HexNAc_2_
+    {3872, 114, 296, 185, 11753, 8724}, // UNIMOD_dHex_1_Hex_4_HexNAc_2_
+    {3873, 114, 296, 185, 11767, 8725}, // UNIMOD_dHex_2_Hex_2_HexNAc_3_
+    {3874, 114, 296, 185, 11781, 8726}, // UNIMOD_dHex_1_Hex_3_HexNAc_3_
+    {3875, 114, 296, 185, 11795, 8727}, // UNIMOD_Hex_4_HexNAc_3_
+    {3876, 114, 296, 185, 11809, 8728}, // UNIMOD_dHex_2_Hex_4_HexNAc_2_
+    {3877, 114, 296, 185, 11823, 8729}, // UNIMOD_dHex_2_Hex_3_HexNAc_3_
+    {3878, 114, 296, 185, 11837, 8730}, // UNIMOD_Hex_3_HexNAc_5_
+    {3879, 114, 296, 185, 11851, 8731}, // UNIMOD_Hex_4_HexNAc_3_NeuAc_1_
+    {3880, 114, 296, 185, 11865, 8732}, // UNIMOD_dHex_2_Hex_3_HexNAc_4_
+    {3881, 114, 296, 185, 11879, 8733}, // UNIMOD_dHex_1_Hex_3_HexNAc_5_
+    {3882, 114, 296, 185, 11893, 8734}, // UNIMOD_Hex_3_HexNAc_6_
+    {3883, 114, 296, 185, 11907, 8735}, // UNIMOD_Hex_4_HexNAc_4_NeuAc_1_
+    {3884, 114, 296, 185, 11921, 8736}, // UNIMOD_dHex_2_Hex_4_HexNAc_4_
+    {3885, 114, 296, 185, 11935, 8737}, // UNIMOD_Hex_6_HexNAc_4_
+    {3886, 114, 296, 185, 11949, 8738}, // UNIMOD_Hex_5_HexNAc_5_
+    {3887, 114, 296, 185, 11963, 8739}, // UNIMOD_dHex_1_Hex_3_HexNAc_6_
+    {3888, 114, 296, 185, 11977, 8740}, // UNIMOD_dHex_1_Hex_4_HexNAc_4_NeuAc_1_
+    {3889, 114, 296, 185, 11991, 8741}, // UNIMOD_dHex_3_Hex_4_HexNAc_4_
+    {3890, 114, 296, 185, 12005, 8742}, // UNIMOD_dHex_1_Hex_3_HexNAc_5_NeuAc_1_
+    {3891, 114, 296, 185, 12019, 8743}, // UNIMOD_dHex_2_Hex_4_HexNAc_5_
+    {3892, 114, 296, 185, 12033, 8744}, // UNIMOD_Hex_1_HexNAc_1_NeuAc_1_Ac_1_
+    {3893, 114, 296, 185, 12043, 8745}, // UNIMOD_Label_13C_2_15N_2_
+    {3894, 114, 296, 185, 12049, 8746}, // UNIMOD_Xlink_DSS_NH2
+    {3895, 114, 296, 185, 12059, 8747}, // UNIMOD_NQIGG
+    {3896, 114, 296, 185, 12065, 8748}, // UNIMOD_Carboxyethylpyrrole
+    {3897, 114, 296, 185, 12071, 8749}, // UNIMOD_Fluorescein_tyramine
+    {3898, 114, 296, 185, 12077, 8750}, // UNIMOD_GEE
+    {3899, 114, 296, 185, 12083, 8751}, // UNIMOD_RNPXL
+    {3900, 114, 296, 185, 12093, 8752}, // UNIMOD_Glu__pyro_Glu_Methyl
+    {3901, 114, 296, 185, 12099, 8753}, // UNIMOD_Glu__pyro_Glu_Methyl_2H_2_13C_1_
+    {3902, 114, 296, 185, 12105, 8754}, // UO_unit
+    {3902, 114, 296, 185, 12105, 8754}, // UO_length_unit
+    {3903, 114, 296, 185, 12105, 8755}, // UO_mass_unit
+    {3904, 114, 296, 185, 12105, 8756}, // UO_time_unit
+    {3905, 114, 296, 186, 12105, 8757}, // UO_electric_current_unit
+    {3906, 114, 296, 186, 12105, 8758}, // UO_temperature_unit
+    {3907, 114, 296, 187, 12105, 8759}, // UO_substance_unit
+    {3908, 114, 296, 187, 12105, 8760}, // UO_luminous_intensity_unit
+    {3909, 114, 296, 187, 12105, 8762}, // UO_meter
+    {3911, 114, 296, 188, 12105, 8765}, // UO_kilogram
+    {3913, 114, 296, 189, 12105, 8768}, // UO_second
+    {3915, 114, 296, 190, 12105, 8771}, // UO_ampere
+    {3917, 114, 296, 191, 12105, 8774}, // UO_kelvin
+    {3919, 114, 296, 192, 12105, 8777}, // UO_mole
+    {3921, 114, 296, 193, 12105, 8780}, // UO_candela
+    {3923, 114, 296, 194, 12105, 8784}, // UO_centimeter
+    {3924, 114, 296, 195, 12105, 8786}, // UO_millimeter
+    {3925, 114, 296, 196, 12105, 8788}, // UO_micrometer
+    {3926, 114, 296, 198, 12105, 8790}, // UO_nanometer
+    {3927, 114, 296, 199, 12105, 8792}, // UO_angstrom
+    {3928, 114, 296, 200, 12105, 8794}, // UO_picometer
+    {3929, 114, 296, 201, 12105, 8796}, // UO_gram
+    {3930, 114, 296, 202, 12105, 8798}, // UO_milligram
+    {3931, 114, 296, 203, 12105, 8800}, // UO_microgram
+    {3932, 114, 296, 204, 12105, 8802}, // UO_nanogram
+    {3933, 114, 296, 205, 12105, 8804}, // UO_picogram
+    {3934, 114, 296, 206, 12105, 8806}, // UO_femtogram
+    {3935, 114, 296, 207, 12105, 8808}, // UO_degree_celsius
+    {3936, 114, 296, 208, 12105, 8810}, // UO_millisecond
+    {3937, 114, 296, 209, 12105, 8812}, // UO_microsecond
+    {3938, 114, 296, 210, 12105, 8814}, // UO_picosecond
+    {3939, 114, 296, 211, 12105, 8816}, // UO_minute
+    {3940, 114, 296, 212, 12105, 8818}, // UO_hour
+    {3941, 114, 296, 213, 12105, 8820}, // UO_day
+    {3942, 114, 296, 213, 12105, 8822}, // UO_week
+    {3943, 114, 296, 213, 12105, 8824}, // UO_month
+    {3944, 114, 296, 213, 12105, 8826}, // UO_year
+    {3945, 114, 296, 213, 12105, 8828}, // UO_milliampere
+    {3946, 114, 296, 214, 12105, 8830}, // UO_microampere
+    {3947, 114, 296, 215, 12105, 8832}, // UO_micromole
+    {3948, 114, 296, 216, 12105, 8834}, // UO_millimole
+    {3949, 114, 296, 217, 12105, 8836}, // UO_nanomole
+    {3950, 114, 296, 218, 12105, 8838}, // UO_picomole
+    {3951, 114, 296, 219, 12105, 8840}, // UO_femtomole
+    {3952, 114, 296, 220, 12105, 8842}, // UO_attomole
+    {3953, 114, 296, 221, 12105, 8844}, // UO_base_unit
+    {3954, 114, 296, 221, 12105, 8845}, // UO_derived_unit_OBSOLETE
+    {3954, 114, 296, 221, 12105, 8845}, // UO_area_unit
+    {3955, 114, 296, 221, 12105, 8846}, // UO_acceleration_unit
+    {3956, 114, 296, 221, 12105, 8847}, // UO_angular_velocity_unit
+    {3957, 114, 296, 221, 12105, 8848}, // UO_angular_acceleration_unit
+    {3958, 114, 296, 221, 12105, 8849}, // UO_concentration_unit
+    {3959, 114, 296, 221, 12105, 8850}, // UO_mass_density_unit
+    {3960, 114, 296, 222, 12105, 8852}, // UO_luminance_unit
+    {3961, 114, 296, 222, 12105, 8854}, // UO_area_density_unit
+    {3962, 114, 296, 223, 12105, 8856}, // UO_molar_mass_unit
+    {3963, 114, 296, 223, 12105, 8858}, // UO_molar_volume_unit
+    {3964, 114, 296, 223, 12105, 8860}, // UO_momentum_unit
+    {3965, 114, 296, 223, 12105, 8861}, // UO_rotational_frequency_unit
+    {3966, 114, 296, 223, 12105, 8863}, // UO_specific_volume_unit
+    {3967, 114, 296, 223, 12105, 8865}, // UO_speed_velocity_unit
+    {3968, 114, 296, 223, 12105, 8866}, // UO_unit_of_molarity
+    {3969, 114, 296, 223, 12105, 8868}, // UO_molar
+    {3970, 114, 296, 224, 12105, 8871}, // UO_millimolar
+    {3971, 114, 296, 225, 12105, 8874}, // UO_micromolar
+    {3972, 114, 296, 226, 12105, 8877}, // UO_nanomolar
+    {3973, 114, 296, 227, 12105, 8880}, // UO_picomolar
+    {3974, 114, 296, 228, 12105, 8883}, // UO_unit_of_molality
+    {3975, 114, 296, 228, 12105, 8885}, // UO_molal
+    {3976, 114, 296, 229, 12105, 8888}, // UO_millimolal
+    {3977, 114, 296, 230, 12105, 8891}, // UO_micromolal
+    {3978, 114, 296, 231, 12105, 8894}, // UO_nanomolal
+    {3979, 114, 296, 232, 12105, 8897}, // UO_picomolal
+    {3980, 114, 296, 233, 12105, 8900}, // UO_femtomolar
+    {3981, 114, 296, 234, 12105, 8903}, // UO_unit_of_normality
+    {3982, 114, 296, 234, 12105, 8905}, // UO_normal
+    {3983, 114, 296, 235, 12105, 8908}, // UO_mole_fraction
+    {3985, 114, 296, 237, 12105, 8913}, // UO_meter_per_second_per_second
+    {3986, 114, 296, 238, 12105, 8915}, // UO_radian_per_second_per_second
+    {3987, 114, 296, 240, 12105, 8917}, // UO_radian_per_second
+    {3988, 114, 296, 241, 12105, 8919}, // UO_square_meter
+    {3989, 114, 296, 242, 12105, 8921}, // UO_square_centimeter
+    {3990, 114, 296, 243, 12105, 8923}, // UO_square_millimeter
+    {3991, 114, 296, 244, 12105, 8925}, // UO_kilogram_per_cubic_meter
+    {3992, 114, 296, 245, 12105, 8928}, // UO_gram_per_cubic_centimeter
+    {3993, 114, 296, 246, 12105, 8931}, // UO_candela_per_square_meter
+    {3994, 114, 296, 247, 12105, 8934}, // UO_kilogram_per_square_meter
+    {3995, 114, 296, 249, 12105, 8937}, // UO_kilogram_per_mole
+    {3996, 114, 296, 250, 12105, 8940}, // UO_gram_per_mole
+    {3997, 114, 296, 251, 12105, 8943}, // UO_cubic_meter_per_mole
+    {3998, 114, 296, 252, 12105, 8946}, // UO_cubic_centimeter_per_mole
+    {3999, 114, 296, 253, 12105, 8949}, // UO_kilogram_meter_per_second
+    {4000, 114, 296, 254, 12105, 8951}, // UO_turns_per_second
+    {4001, 114, 296, 255, 12105, 8954}, // UO_cubic_meter_per_kilogram
+    {4002, 114, 296, 256, 12105, 8957}, // UO_meter_per_second
+    {4003, 114, 296, 257, 12105, 8959}, // UO_volume_unit
+    {4004, 114, 296, 257, 12105, 8960}, // UO_cubic_meter
+    {4005, 114, 296, 258, 12105, 8962}, // UO_cubic_centimeter
+    {4006, 114, 296, 260, 12105, 8964}, // UO_milliliter
+    {4007, 114, 296, 261, 12105, 8966}, // UO_liter
+    {4008, 114, 296, 263, 12105, 8968}, // UO_cubic_decimeter
+    {4009, 114, 296, 264, 12105, 8970}, // UO_microliter
+    {4010, 114, 296, 265, 12105, 8972}, // UO_nanoliter
+    {4011, 114, 296, 266, 12105, 8974}, // UO_picoliter
+    {4012, 114, 296, 267, 12105, 8976}, // UO_femtoliter
+    {4013, 114, 296, 268, 12105, 8978}, // UO_frequency_unit
+    {4014, 114, 296, 268, 12105, 8979}, // UO_hertz
+    {4015, 114, 296, 270, 12105, 8981}, // UO_force_unit
+    {4016, 114, 296, 270, 12105, 8982}, // UO_newton
+    {4017, 114, 296, 271, 12105, 8984}, // UO_pressure_unit
+    {4018, 114, 296, 271, 12105, 8985}, // UO_pascal
+    {4019, 114, 296, 272, 12105, 8987}, // UO_energy_unit
+    {4020, 114, 296, 272, 12105, 8988}, // UO_joule
+    {4021, 114, 296, 273, 12105, 8990}, // UO_power_unit
+    {4022, 114, 296, 273, 12105, 8991}, // UO_watt
+    {4023, 114, 296, 274, 12105, 8993}, // UO_illuminance_unit
+    {4024, 114, 296, 274, 12105, 8995}, // UO_lux
+    {4025, 114, 296, 275, 12105, 8998}, // UO_luminous_flux_unit
+    {4026, 114, 296, 275, 12105, 9000}, // UO_lumen
+    {4027, 114, 296, 276, 12105, 9003}, // UO_catalytic_activity_unit
+    {4028, 114, 296, 276, 12105, 9004}, // UO_katal
+    {4029, 114, 296, 277, 12105, 9006}, // UO_angle_unit
+    {4030, 114, 296, 277, 12105, 9007}, // UO_plane_angle_unit
+    {4031, 114, 296, 277, 12105, 9009}, // UO_radian
+    {4032, 114, 296, 278, 12105, 9012}, // UO_solid_angle_unit
+    {4033, 114, 296, 278, 12105, 9014}, // UO_steradian
+    {4034, 114, 296, 279, 12105, 9017}, // UO_radiation_unit
+    {4035, 114, 296, 279, 12105, 9018}, // UO_activity__of_a_radionuclide__unit
+    {4036, 114, 296, 279, 12105, 9020}, // UO_absorbed_dose_unit
+    {4037, 114, 296, 279, 12105, 9022}, // UO_dose_equivalent_unit
+    {4038, 114, 296, 279, 12105, 9024}, // UO_exposure_unit
+    {4039, 114, 296, 279, 12105, 9026}, // UO_becquerel
+    {4040, 114, 296, 280, 12105, 9029}, // UO_curie
+    {4041, 114, 296, 281, 12105, 9032}, // UO_gray
+    {4042, 114, 296, 282, 12105, 9035}, // UO_rad
+    {4043, 114, 296, 282, 12105, 9038}, // UO_roentgen
+    {4044, 114, 296, 283, 12105, 9041}, // UO_sievert
+    {4045, 114, 296, 284, 12105, 9044}, // UO_millisievert
+    {4046, 114, 296, 285, 12105, 9047}, // UO_microsievert
+    {4047, 114, 296, 286, 12105, 9050}, // UO_Roentgen_equivalent_man
+    {4048, 114, 296, 287, 12105, 9053}, // UO_microgray
+    {4049, 114, 296, 288, 12105, 9056}, // UO_milligray
+    {4050, 114, 296, 289, 12105, 9059}, // UO_nanogray
+    {4051, 114, 296, 290, 12105, 9062}, // UO_nanosievert
+    {4052, 114, 296, 291, 12105, 9065}, // UO_millicurie
+    {4053, 114, 296, 292, 12105, 9068}, // UO_microcurie
+    {4054, 114, 296, 293, 12105, 9071}, // UO_disintegrations_per_minute
+    {4055, 114, 296, 294, 12105, 9074}, // UO_counts_per_minute
+    {4056, 114, 296, 295, 12105, 9077}, // UO_nanosecond
+    {4057, 114, 296, 296, 12105, 9079}, // UO_century
+    {4058, 114, 296, 296, 12105, 9081}, // UO_half_life
+    {4059, 114, 296, 296, 12105, 9083}, // UO_foot_candle
+    {4060, 114, 296, 297, 12105, 9086}, // UO_irradiance_unit
+    {4061, 114, 296, 297, 12105, 9088}, // UO_watt_per_square_meter
+    {4062, 114, 296, 298, 12105, 9091}, // UO_einstein_per_square_meter_per_second
+    {4063, 114, 296, 300, 12105, 9094}, // UO_light_unit
+    {4064, 114, 296, 300, 12105, 9095}, // UO_watt_per_steradian_per_square_meter
+    {4065, 114, 296, 301, 12105, 9098}, // UO_radiant_intensity_unit
+    {4066, 114, 296, 301, 12105, 9100}, // UO_microeinstein_per_square_meter_per_second
+    {4067, 114, 296, 303, 12105, 9103}, // UO_radiance_unit
+    {4068, 114, 296, 303, 12105, 9105}, // UO_watt_per_steradian
+    {4069, 114, 296, 304, 12105, 9108}, // UO_mass_percentage
+    {4071, 114, 296, 306, 12105, 9113}, // UO_mass_volume_percentage
+    {4073, 114, 296, 308, 12105, 9118}, // UO_volume_percentage
+    {4075, 114, 296, 309, 12105, 9124}, // UO_parts_per_notation_unit
+    {4076, 114, 296, 309, 12105, 9126}, // UO_parts_per_hundred
+    {4077, 114, 296, 311, 12105, 9129}, // UO_parts_per_thousand
+    {4078, 114, 296, 313, 12105, 9132}, // UO_parts_per_million
+    {4079, 114, 296, 315, 12105, 9135}, // UO_parts_per_billion
+    {4080, 114, 296, 317, 12105, 9138}, // UO_parts_per_trillion
+    {4081, 114, 296, 319, 12105, 9141}, // UO_parts_per_quadrillion
+    {4082, 114, 296, 321, 12105, 9144}, // UO_gram_per_milliliter
+    {4083, 114, 296, 322, 12105, 9147}, // UO_kilogram_per_liter
+    {4084, 114, 296, 323, 12105, 9150}, // UO_gram_per_liter
+    {4085, 114, 296, 324, 12105, 9153}, // UO_milligram_per_milliliter
+    {4086, 114, 296, 325, 12105, 9156}, // UO_unit_per_volume_unit
+    {4087, 114, 296, 325, 12105, 9158}, // UO_unit_per_milliliter
+    {4088, 114, 296, 326, 12105, 9161}, // UO_unit_per_liter
+    {4089, 114, 296, 327, 12105, 9164}, // UO_mass_per_unit_volume
+    {4090, 114, 296, 327, 12105, 9166}, // UO_enzyme_unit
+    {4091, 114, 296, 328, 12105, 9168}, // UO_density_unit
+    {4092, 114, 296, 328, 12105, 9169}, // UO_linear_density_unit
+    {4093, 114, 296, 328, 12105, 9171}, // UO_kilogram_per_meter
+    {4094, 114, 296, 329, 12105, 9174}, // UO_degree
+    {4095, 114, 296, 329, 12105, 9177}, // UO_dimensionless_unit
+    {4096, 114, 296, 329, 12105, 9178}, // UO_percent
+    {4097, 114, 296, 330, 12105, 9181}, // UO_pi
+    {4098, 114, 296, 330, 12105, 9183}, // UO_count_unit
+    {4099, 114, 296, 331, 12105, 9185}, // UO_ratio
+    {4100, 114, 296, 331, 12105, 9187}, // UO_fraction
+    {4101, 114, 296, 331, 12105, 9190}, // UO_molecule_count
+    {4102, 114, 296, 331, 12105, 9193}, // UO_purity_percentage
+    {4103, 114, 296, 331, 12105, 9197}, // UO_confluence_percentage
+    {4104, 114, 296, 331, 12105, 9201}, // UO_degree_fahrenheit
+    {4105, 114, 296, 332, 12105, 9203}, // UO_pH
+    {4107, 114, 296, 332, 12105, 9206}, // UO_liter_per_kilogram
+    {4108, 114, 296, 333, 12105, 9209}, // UO_milliliter_per_kilogram
+    {4109, 114, 296, 334, 12105, 9212}, // UO_microliter_per_kilogram
+    {4110, 114, 296, 335, 12105, 9215}, // UO_cell_concentration_unit
+    {4111, 114, 296, 335, 12105, 9217}, // UO_cells_per_milliliter
+    {4112, 114, 296, 336, 12105, 9220}, // UO_catalytic__activity__concentration_unit
+    {4113, 114, 296, 336, 12105, 9222}, // UO_katal_per_cubic_meter
+    {4114, 114, 296, 337, 12105, 9225}, // UO_katal_per_liter
+    {4115, 114, 296, 338, 12105, 9228}, // UO_volume_per_unit_volume
+    {4116, 114, 296, 338, 12105, 9230}, // UO_milliliter_per_cubic_meter
+    {4117, 114, 296, 339, 12105, 9233}, // UO_milliliter_per_liter
+    {4118, 114, 296, 340, 12105, 9236}, // UO_gram_per_deciliter
+    {4119, 114, 296, 341, 12105, 9239}, // UO_deciliter
+    {4120, 114, 296, 342, 12105, 9241}, // UO_colony_forming_unit
+    {4121, 114, 296, 343, 12105, 9244}, // UO_plaque_forming_unit
+    {4122, 114, 296, 344, 12105, 9247}, // UO_colony_forming_unit_per_volume
+    {4123, 114, 296, 344, 12105, 9249}, // UO_colony_forming_unit_per_milliliter
+    {4124, 114, 296, 345, 12105, 9252}, // UO_plaque_forming_unit_per_volume
+    {4125, 114, 296, 345, 12105, 9254}, // UO_plaque_forming_unit_per_milliliter
+    {4126, 114, 296, 346, 12105, 9257}, // UO_disintegrations_per_second
+    {4127, 114, 296, 347, 12105, 9260}, // UO_electric_potential_difference_unit
+    {4128, 114, 296, 347, 12105, 9261}, // UO_volt
+    {4129, 114, 296, 348, 12105, 9263}, // UO_electric_charge
+    {4130, 114, 296, 348, 12105, 9264}, // UO_coulomb
+    {4131, 114, 296, 349, 12105, 9266}, // UO_dalton
+    {4132, 114, 296, 352, 12105, 9268}, // UO_kilodalton
+    {4133, 114, 296, 353, 12105, 9270}, // UO_watt_hour
+    {4134, 114, 296, 354, 12105, 9272}, // UO_kilowatt_hour
+    {4135, 114, 296, 354, 12105, 9274}, // UO_magnetic_flux_unit
+    {4136, 114, 296, 354, 12105, 9275}, // UO_weber
+    {4137, 114, 296, 356, 12105, 9277}, // UO_magnetic_flux_density_unit
+    {4138, 114, 296, 357, 12105, 9278}, // UO_tesla
+    {4139, 114, 296, 359, 12105, 9280}, // UO_volt_hour
+    {4140, 114, 296, 360, 12105, 9282}, // UO_kilovolt_hour
+    {4141, 114, 296, 361, 12105, 9284}, // UO_information_unit
+    {4142, 114, 296, 361, 12105, 9285}, // UO_bit
+    {4143, 114, 296, 361, 12105, 9287}, // UO_byte
+    {4144, 114, 296, 362, 12105, 9289}, // UO_kilobyte
+    {4145, 114, 296, 363, 12105, 9291}, // UO_megabyte
+    {4146, 114, 296, 364, 12105, 9293}, // UO_image_resolution_unit
+    {4147, 114, 296, 364, 12105, 9295}, // UO_chroma_sampling_unit
+    {4148, 114, 296, 364, 12105, 9298}, // UO_dynamic_range_unit
+    {4149, 114, 296, 364, 12105, 9301}, // UO_spatial_resolution_unit
+    {4150, 114, 296, 364, 12105, 9304}, // UO_dots_per_inch
+    {4151, 114, 296, 365, 12105, 9308}, // UO_micron_pixel
+    {4152, 114, 296, 366, 12105, 9312}, // UO_pixels_per_inch
+    {4153, 114, 296, 368, 12105, 9316}, // UO_pixels_per_millimeter
+    {4154, 114, 296, 368, 12105, 9320}, // UO_base_pair
+    {4155, 114, 296, 369, 12105, 9323}, // UO_kibibyte
+    {4156, 114, 296, 370, 12105, 9325}, // UO_mebibyte
+    {4157, 114, 296, 371, 12105, 9327}, // UO_millivolt
+    {4158, 114, 296, 372, 12105, 9329}, // UO_kilovolt
+    {4159, 114, 296, 373, 12105, 9331}, // UO_microvolt
+    {4160, 114, 296, 374, 12105, 9333}, // UO_nanovolt
+    {4161, 114, 296, 375, 12105, 9335}, // UO_picovolt
+    {4162, 114, 296, 376, 12105, 9337}, // UO_megavolt
+    {4163, 114, 296, 377, 12105, 9339}, // UO_surface_tension_unit
+    {4164, 114, 296, 377, 12105, 9340}, // UO_newton_per_meter
+    {4165, 114, 296, 378, 12105, 9342}, // UO_dyne_per_cm
+    {4166, 114, 296, 379, 12105, 9344}, // UO_viscosity_unit
+    {4167, 114, 296, 379, 12105, 9345}, // UO_pascal_second
+    {4168, 114, 296, 380, 12105, 9347}, // UO_poise
+    {4169, 114, 296, 382, 12105, 9349}, // UO_decibel
+    {4170, 114, 296, 383, 12105, 9352}, // UO_effective_dose_unit
+    {4171, 114, 296, 383, 12105, 9354}, // UO_conduction_unit
+    {4172, 114, 296, 383, 12105, 9355}, // UO_electrical_conduction_unit
+    {4173, 114, 296, 383, 12105, 9357}, // UO_heat_conduction_unit
+    {4174, 114, 296, 383, 12105, 9359}, // UO_siemens
+    {4175, 114, 296, 384, 12105, 9362}, // UO_watt_per_meter_kelvin
+    {4176, 114, 296, 385, 12105, 9365}, // UO_electronvolt
+    {4177, 114, 296, 387, 12105, 9367}, // UO_electric_field_strength_unit
+    {4178, 114, 296, 388, 12105, 9368}, // UO_volt_per_meter
+    {4179, 114, 296, 389, 12105, 9370}, // UO_absorbance_unit
+    {4180, 114, 296, 390, 12105, 9372}, // UO_volumetric_flow_rate_unit
+    {4181, 114, 296, 390, 12105, 9373}, // UO_microliters_per_minute
+    {4182, 114, 296, 391, 12105, 9375}, // UO_millimetres_of_mercury
+    {4183, 114, 296, 392, 12105, 9377}, // UO_milligram_per_liter
+    {4184, 114, 296, 393, 12105, 9380}, // UO_microgram_per_milliliter
+    {4185, 114, 296, 394, 12105, 9383}, // UO_nanogram_per_milliliter
+    {4186, 114, 296, 395, 12105, 9386}, // UO_amount_per_container
+    {4187, 114, 296, 395, 12105, 9388}, // UO_ug_disk
+    {4188, 114, 296, 395, 12105, 9391}, // UO_nmole_disk
+    {4189, 114, 296, 395, 12105, 9394}, // UO_milliunits_per_milliliter
+    {4190, 114, 296, 396, 12105, 9397}, // UO_rate_unit
+    {4191, 114, 296, 396, 12105, 9398}, // UO_count_per_nanomolar_second
+    {4192, 114, 296, 397, 12105, 9400}, // UO_count_per_molar_second
+    {4193, 114, 296, 398, 12105, 9402}, // UO_kilogram_per_hectare
+    {4194, 114, 296, 398, 12105, 9405}, // UO_count_per_nanomolar
+    {4195, 114, 296, 400, 12105, 9407}, // UO_count_per_molar
+    {4196, 114, 296, 402, 12105, 9409}, // UO_microgram_per_liter
+    {4197, 114, 296, 403, 12105, 9412}, // end
+}; // termRelations_
+
+
+// CVID -> termInfos_ index: termHashSlots_[cvidHash(cvid, termHashDisplacements_[cvidHash(cvid, 0) % buckets]) % slots]
+inline boost::uint32_t cvidHash(boost::uint32_t cvid, boost::uint32_t seed)
+{
+    boost::uint32_t h = cvid ^ (seed * 0x9E3779B9u);
+    h ^= h >> 16; h *= 0x85EBCA6Bu;
+    h ^= h >> 13; h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+
+const boost::uint32_t termHashDisplacements_[] =
+{
+    5, 4, 12, 29, 1, 1, 12, 12, 1, 39, 2, 0, 0, 11, 1, 9,
+    3, 2, 2, 1, 1, 7, 27, 81, 5, 3, 4, 12, 13, 2, 8, 4,
+    25, 18, 1, 6, 5, 18, 10, 1, 10, 2, 5, 2, 14, 3, 27, 7,
+    9, 4, 1, 4, 1, 29, 5, 23, 2, 1, 8, 13, 7, 2, 2, 5,
+    1, 1, 1, 16, 16, 17, 29, 8, 52, 1, 2, 3, 0, 3, 3, 5,
+    2, 9, 1, 5, 9, 1, 10, 37, 1, 1, 2, 1, 2, 1, 3, 95,
+    16, 5, 20, 6, 1, 15, 1, 17, 5, 1, 43, 24, 1, 4, 1, 13,
+    12, 2, 28, 7, 1, 2, 16, 3, 11, 38, 2, 6, 1, 1, 17, 46,
+    14, 5, 7, 13, 7, 1, 15, 4, 6, 2, 17, 2, 8, 4, 1, 0,
+    3, 17, 4, 11, 6, 2, 11, 2, 1, 1, 1, 24, 17, 5, 5, 11,
+    14, 1, 2, 2, 6, 8, 40, 1, 12, 5, 7, 20, 3, 3, 11, 4,
+    4, 1, 4, 7, 2, 5, 37, 2, 2, 4, 2, 4, 1, 3, 18, 5,
+    6, 3, 4, 14, 58, 6, 3, 11, 26, 30, 38, 2, 9, 2, 6, 6,
+    17, 11, 19, 4, 5, 2, 1, 1, 7, 4, 6, 9, 1, 49, 26, 15,
+    11, 17, 93, 19, 23, 17, 14, 4, 2, 5, 2, 3, 0, 11, 22, 10,
+    3, 1, 5, 3, 17, 15, 29, 6, 1, 1, 5, 60, 2, 1, 3, 4,
+    3, 2, 38, 6, 4, 1, 14, 5, 1, 43, 28, 1, 5, 1, 1, 53,
+    36, 18, 4, 1, 2, 11, 2, 8, 4, 29, 1, 1, 2, 45, 10, 30,
+    5, 4, 3, 6, 29, 3, 3, 0, 6, 4, 2, 2, 20, 2, 1, 7,
+    8, 29, 5, 1, 7, 2, 1, 14, 1, 22, 33, 57, 13, 20, 2, 3,
+    6, 5, 15, 1, 11, 4, 12, 0, 2, 1, 35, 19, 4, 2, 13, 6,
+    18, 18, 2, 1, 62, 9, 0, 3, 1, 5, 7, 6, 0, 20, 14, 5,
+    8, 2, 8, 1, 1, 3, 3, 8, 5, 2, 36, 7, 7, 9, 15, 2,
+    18, 13, 9, 5, 10, 3, 8, 59, 1, 7, 5, 4, 4, 17, 6, 1,
+    0, 1, 2, 18, 44, 10, 2, 17, 1, 27, 1, 9, 4, 11, 0, 2,
+    11, 1, 1, 7, 4, 11, 0, 24, 12, 10, 3, 23, 28, 3, 22, 7,
+    4, 14, 3, 8, 1, 3, 2, 15, 14, 7, 3, 21, 35, 28, 33, 4,
+    132, 11, 8, 6, 0, 5, 49, 7, 18, 12, 7, 9, 4, 10, 2, 5,
+    4, 2, 11, 7, 5, 8, 7, 7, 6, 26, 9, 9, 58, 7, 10, 36,
+    1, 1, 1, 1, 19, 17, 3, 10, 16, 4, 1, 1, 1, 9, 13, 21,
+    2, 35, 1, 1, 7, 20, 1, 1, 7, 6, 4, 3, 1, 1, 1, 8,
+    1, 34, 11, 6, 17, 10, 22, 2, 6, 6, 1, 0, 17, 1, 10, 10,
+    3, 4, 1, 2, 35, 2, 4, 11, 1, 6, 1, 14, 29, 6, 1, 17,
+    23, 4, 1, 0, 9, 50, 4, 8, 15, 0, 6, 9, 15, 2, 39, 2,
+    18, 3, 3, 2, 40, 2, 3, 31, 1, 33, 20, 1, 3, 3, 51, 19,
+    17, 88, 2, 3, 11, 68, 1, 14, 16, 31, 24, 4, 7, 1, 1, 11,
+    5, 6, 4, 5, 27, 34, 10, 2, 49, 37, 9, 49, 3, 2, 2, 0,
+    2, 4, 11, 7, 2, 25, 0, 17, 13, 20, 11, 27, 67, 63, 27, 10,
+    1, 2, 3, 8, 3, 23, 24, 20, 14, 21, 2, 3, 6, 0, 8, 4,
+    15, 94, 3, 1, 76, 5, 25, 1, 17, 1, 1, 8, 31, 42, 11, 19,
+    9, 21, 24, 4, 9, 7, 12, 19, 1, 0, 18, 4, 5, 15, 15, 4,
+    36, 69, 11, 76, 11, 15, 5, 3, 17, 11, 7, 91, 6, 17, 20, 7,
+    8, 13, 5, 2, 7, 38, 8, 5, 51, 2, 54, 111, 1, 1, 37, 5,
+    48, 25, 42, 6, 1, 2, 1, 1, 4, 28, 9, 143, 11, 86, 8, 65,
+    1, 15, 0, 25, 7, 30, 53, 20, 17, 13, 1, 9, 53, 90, 3, 9,
+    6, 9, 6, 27, 1, 88, 1, 65, 9, 17, 23, 4, 6, 1, 133, 38,
+    11, 43, 13, 36, 14, 2, 10, 8, 3, 5, 7, 6, 14, 3, 56, 3,
+    6, 1, 10, 1, 5, 21, 1, 80, 7, 35, 7, 1, 13, 0, 41, 4,
+    1, 11, 1, 10, 48, 16, 1, 17, 3, 1, 16, 21, 25, 3, 5, 59,
+    42, 5, 26, 36, 25, 16, 11, 23, 3, 5, 2, 6, 17, 23, 3, 13,
+    23, 125, 4, 25, 10, 2, 57, 54, 7, 1, 5, 60, 84, 29, 1, 91,
+    24, 20, 2, 55, 9, 15, 1, 6, 2, 6, 18, 26, 207, 73, 1, 1,
+    13, 9, 1, 44, 4, 4, 51, 3, 29, 6, 52, 5, 63, 5, 21, 13,
+    36, 19, 4, 1, 60, 11, 32, 13, 13, 24, 4, 70, 106, 5, 2, 2,
+    65, 71, 6, 8, 2, 19, 1, 52, 17, 112, 31, 8, 3, 6, 41, 135,
+    1, 5, 1, 4, 13, 0, 36, 3, 59, 10, 1, 27, 3, 5, 8, 5,
+    18, 45, 7, 36, 4, 1, 34, 6, 55, 18, 7, 14, 68, 16, 66, 7,
+    5, 17, 3, 14, 7, 12, 22, 33, 26, 1, 45, 1, 3, 12, 4, 7,
+    36, 1, 31, 131, 14, 74, 80, 4, 221, 4, 31, 1, 16, 7, 14, 6,
+    126, 33, 4, 2, 1, 6, 32, 142, 14, 7, 5, 18, 22, 2, 7, 91,
+    1, 12, 5, 4, 4, 40, 73, 40, 6, 3, 27, 10, 9, 1, 3, 33,
+    2, 0, 35, 15, 18, 47, 17, 7, 12, 2, 11, 5, 10, 67, 1, 43,
+    37, 91, 5, 61, 1, 178, 32, 1, 7, 2, 4, 73, 1, 33, 20, 2,
+    3, 11, 20, 27, 2, 16, 1, 28, 1, 23, 58, 8, 41, 86, 3, 31,
+    126, 52, 2, 27, 7, 1, 16, 7, 20, 1, 40, 9, 7, 7, 19, 17,
+    4, 1, 176, 91, 7, 13, 1, 16, 33, 3, 1, 8, 4, 98, 2, 122,
+    26, 0, 12,
+}; // termHashDisplacements_
+
+
+const size_t termHashDisplacementsSize_ = sizeof(termHashDisplacements_)/sizeof(boost::uint32_t);
+
+
+// an empty slot has termInfosSize_
+const boost::uint32_t termHashSlots_[] =
+{
+    2249, 3854, 984, 3916, 4234, 4234, 2807, 2101, 1980, 1045, 1145, 3973, 2132, 2507, 3566, 855,
+    4195, 3284, 2930, 425, 2553, 2009, 2358, 2643, 4234, 4234, 2024, 1178, 999, 4055, 167, 4234,
+    1720, 4234, 3112, 879, 2454, 3445, 1988, 3948, 1798, 4234, 3091, 4234, 791, 4234, 2566, 4120,
+    487, 3430, 1313, 1018, 488, 4200, 1601, 3251, 1287, 3258, 1829, 1874, 4234, 4234, 4234, 2345,
+    4234, 870, 2677, 2722, 3595, 2513, 99, 592, 3759, 4156, 2557, 4234, 471, 4234, 3744, 4234,
+    826, 3567, 2844, 3692, 2964, 4234, 332, 1628, 402, 2413, 4234, 256, 1361, 1014, 2123, 1396,
+    38, 2785, 2323, 3825, 1609, 276, 2299, 1602, 2377, 3749, 2630, 2219, 2400, 692, 3283, 3853,
+    4234, 1201, 3953, 3721, 3227, 3298, 1448, 127, 4234, 2835, 4234, 3479, 2949, 4234, 3203, 209,
+    3820, 334, 4234, 3687, 2462, 4234, 4234, 3297, 3135, 4234, 4234, 578, 4234, 982, 3339, 2020,
+    745, 2364, 2618, 3249, 4234, 53, 3218, 2401, 1202, 1994, 2998, 4065, 990, 1255, 449, 1594,
+    1385, 4234, 4234, 2093, 1370, 1109, 2284, 97, 1166, 1833, 2763, 2248, 4234, 63, 4234, 3513,
+    2520, 4234, 4165, 1883, 4234, 4234, 3901, 1882, 4234, 4234, 595, 4040, 646, 4234, 3163, 2999,
+    2727, 4092, 3960, 2052, 3781, 861, 4094, 3776, 193, 1070, 4018, 460, 886, 3565, 3260, 4113,
+    1121, 403, 343, 3737, 3106, 4014, 4157, 4234, 2468, 4234, 3610, 1710, 767, 914, 3125, 1047,
+    4234, 1182, 3336, 2750, 3313, 2623, 1099, 4234, 4234, 872, 1615, 1809, 4234, 2329, 3457, 2304,
+    4085, 1547, 1569, 1556, 4021, 415, 1815, 3078, 61, 3782, 4234, 1650, 3968, 4234, 1120, 1752,
+    126, 2331, 4234, 3294, 3122, 4234, 2778, 772, 2422, 2455, 4234, 1276, 79, 2904, 3064, 4234,
+    710, 1167, 1887, 4234, 2049, 1466, 4234, 865, 1183, 1826, 1032, 4234, 11, 3296, 890, 2420,
+    4234, 3643, 2018, 926, 528, 3179, 656, 74, 3814, 107, 4043, 1472, 749, 3110, 362, 494,
+    2822, 714, 2981, 1664, 4234, 3885, 4234, 4234, 4234, 3590, 1845, 4234, 3456, 511, 4234, 4234,
+    2315, 2342, 328, 4234, 4234, 3414, 3508, 2932, 203, 2517, 2808, 3545, 2939, 2380, 1857, 9,
+    1880, 3225, 2064, 4234, 1827, 3965, 613, 2408, 3272, 3858, 2597, 4069, 2156, 4234, 89, 1050,
+    4234, 4234, 3197, 2133, 4234, 2435, 606, 1891, 2022, 1122, 4234, 1304, 4221, 2607, 3543, 1088,
+    4234, 769, 2307, 3390, 1125, 4234, 375, 2090, 467, 3165, 979, 2212, 3238, 34, 4203, 1877,
+    1531, 1243, 768, 102, 992, 4234, 4053, 4234, 2701, 2189, 4234, 75, 1212, 3625, 3324, 1277,
+    3245, 4234, 4234, 3173, 2802, 859, 4234, 1091, 1326, 2139, 2111, 4234, 2738, 1454, 4231, 3753,
+    300, 1149, 529, 3351, 2665, 1907, 821, 4234, 740, 4099, 4234, 3976, 4154, 802, 614, 2410,
+    588, 2023, 1387, 787, 824, 3918, 3551, 1250, 3733, 2925, 3672, 1840, 3795, 2859, 4076, 1227,
+    2118, 2816, 4234, 308, 4127, 2606, 2332, 214, 733, 2386, 1449, 4234, 3607, 567, 3329, 2916,
+    4035, 4234, 4234, 1958, 4234, 669, 935, 4234, 3568, 1623, 434, 648, 3017, 3455, 4234, 1232,
+    2514, 1709, 40, 2720, 3497, 3609, 176, 887, 2966, 4090, 4234, 3988, 3716, 4234, 701, 4234,
+    891, 4234, 4129, 944, 2664, 2097, 4234, 4234, 4234, 866, 4234, 70, 1854, 1290, 3425, 2505,
+    2351, 4019, 3524, 3192, 1039, 2801, 2282, 1938, 4234, 3232, 4234, 3059, 1684, 135, 139, 393,
+    4234, 4234, 4134, 4234, 3974, 2692, 1113, 4234, 4234, 2565, 1924, 2459, 943, 1317, 2871, 4234,
+    834, 1347, 4131, 2499, 1855, 2262, 853, 3689, 368, 1856, 4234, 4155, 2298, 4234, 378, 2545,
+    2224, 4147, 4234, 4234, 2145, 2567, 684, 396, 3632, 95, 948, 4234, 3564, 3877, 4234, 4098,
+    1245, 3275, 110, 2888, 4234, 4234, 892, 4234, 4234, 33, 1822, 957, 3378, 4234, 3601, 1504,
+    2995, 3025, 109, 1379, 2869, 4234, 4234, 4107, 637, 2494, 3240, 3661, 2897, 1192, 1337, 3805,
+    524, 2827, 1414, 4234, 1371, 2398, 3860, 709, 3920, 3522, 638, 4234, 476, 4234, 4234, 1836,
+    3620, 1741, 1592, 1315, 2071, 2969, 1929, 1694, 1554, 3770, 2178, 4234, 531, 4044, 1533, 1768,
+    3714, 2784, 3813, 2004, 2003, 602, 2781, 3534, 2218, 838, 3290, 4234, 2034, 4234, 30, 4177,
+    3164, 869, 72, 964, 3888, 1865, 1461, 3871, 4234, 4234, 1656, 4234, 4234, 4052, 4234, 1116,
+    1901, 3985, 1915, 2378, 3473, 2575, 2872, 4213, 3041, 2636, 3964, 4234, 805, 2788, 3584, 1198,
+    2734, 4234, 3319, 3707, 4234, 404, 3239, 1204, 1922, 3088, 4173, 1358, 433, 2686, 1456, 3438,
+    1170, 3267, 359, 641, 3415, 66, 539, 4115, 3758, 4234, 4234, 1678, 4234, 1745, 3043, 2088,
+    1578, 1596, 2615, 580, 4234, 3254, 2849, 4234, 191, 478, 142, 4234, 212, 762, 4234, 1423,
+    4234, 2495, 1100, 4234, 679, 2210, 1438, 3706, 4234, 4234, 2915, 702, 1095, 3946, 0, 4234,
+    4234, 3195, 4234, 4234, 4234, 2533, 1545, 1744, 1332, 3715, 1259, 1101, 2289, 2639, 4234, 2441,
+    1026, 4234, 2035, 2370, 3516, 4234, 4234, 4234, 3641, 939, 3370, 4169, 2046, 4234, 3539, 3977,
+    738, 2437, 4234, 2397, 2202, 3999, 3754, 4234, 3358, 3273, 2676, 1197, 105, 3933, 2172, 3966,
+    3659, 3555, 4202, 1748, 4234, 3648, 3573, 1367, 2073, 4234, 395, 3311, 4234, 2264, 3490, 3006,
+    4234, 2431, 190, 2928, 2991, 4234, 1083, 1003, 416, 618, 3827, 1302, 303, 2879, 479, 4234,
+    4201, 3020, 568, 497, 2745, 687, 3792, 3484, 3592, 2294, 4234, 4234, 593, 3032, 2600, 750,
+    1521, 2148, 4234, 407, 1942, 420, 1771, 2056, 764, 4234, 4234, 3237, 3829, 2147, 3026, 1151,
+    1683, 2283, 154, 151, 540, 4234, 4234, 1028, 717, 963, 385, 244, 3637, 1685, 1038, 4234,
+    4234, 439, 4234, 2968, 4234, 4234, 2355, 1193, 2926, 1859, 1806, 3393, 4184, 3356, 572, 24,
+    4234, 2475, 4234, 1559, 1923, 2138, 4234, 1986, 777, 4234, 635, 1002, 319, 4038, 3450, 1677,
+    536, 1928, 1484, 3990, 3804, 1794, 475, 4234, 4208, 168, 4234, 1141, 1802, 4234, 4234, 213,
+    4234, 2231, 2077, 1407, 4234, 550, 549, 1080, 237, 3463, 3926, 2146, 2978, 4234, 1397, 2158,
+    4234, 481, 156, 187, 757, 1724, 3204, 3525, 1189, 4234, 4105, 983, 4080, 1595, 1401, 4234,
+    3354, 1743, 1296, 3668, 4234, 4234, 4141, 1996, 3614, 1579, 4234, 3306, 3579, 1837, 406, 1667,
+    4234, 4234, 4234, 1065, 346, 4234, 4234, 2548, 4074, 2444, 3176, 230, 3711, 3705, 4234, 379,
+    697, 801, 1244, 800, 3591, 112, 2803, 2924, 1587, 3235, 3784, 1146, 4234, 1419, 1676, 3817,
+    1731, 1511, 2233, 114, 3405, 4234, 1911, 162, 2881, 4234, 4234, 57, 4234, 1412, 229, 605,
+    3367, 4104, 4234, 2019, 2236, 1263, 4234, 2316, 4234, 3063, 4214, 399, 1270, 1551, 3697, 1503,
+    3511, 4234, 4234, 2211, 1024, 3658, 4234, 104, 2830, 3118, 1180, 3433, 1989, 495, 25, 129,
+    2961, 840, 2487, 2818, 2057, 4234, 3650, 2952, 2108, 3736, 1949, 2010, 4234, 58, 4234, 2780,
+    4234, 4234, 3938, 3178, 4234, 2945, 2588, 1765, 746, 329, 4070, 4234, 3087, 2079, 430, 965,
+    331, 2384, 3429, 2181, 1770, 4234, 3337, 2905, 3207, 115, 462, 4234, 1713, 1169, 4234, 4234,
+    4187, 2962, 4234, 915, 138, 4234, 4118, 2344, 455, 1658, 4234, 2175, 3015, 2714, 1235, 1778,
+    1740, 4234, 4234, 2301, 3526, 2810, 4234, 2666, 2974, 4234, 2679, 1264, 419, 2254, 4234, 2140,
+    2854, 3739, 4234, 179, 273, 2352, 2082, 1561, 1359, 1096, 4234, 2902, 937, 604, 1655, 2637,
+    4234, 4234, 2529, 4234, 1825, 2063, 2971, 477, 2199, 1285, 4234, 184, 2258, 1161, 3129, 4170,
+    1165, 2584, 155, 2467, 2471, 4234, 1430, 1269, 856, 4234, 4234, 860, 4234, 2394, 4234, 2876,
+    2614, 4234, 108, 3869, 2076, 2119, 4234, 822, 4234, 3950, 3660, 3007, 3001, 4234, 3108, 325,
+    376, 265, 4234, 285, 1591, 2667, 3912, 1647, 1208, 2357, 2434, 3103, 3317, 1252, 3133, 1950,
+    4234, 1718, 243, 2317, 424, 582, 2353, 4234, 3521, 4234, 4234, 1985, 1917, 4234, 4234, 4190,
+    519, 3994, 4234, 1645, 21, 858, 4234, 4036, 4234, 254, 3799, 2760, 2709, 748, 3773, 1509,
+    1103, 1021, 4234, 1048, 2204, 3184, 576, 3903, 3873, 2432, 4234, 1517, 1320, 1067, 1637, 76,
+    2485, 947, 1866, 1977, 4234, 3120, 4234, 2242, 2272, 3837, 1214, 4234, 631, 338, 134, 1476,
+    1312, 694, 607, 628, 4234, 2430, 428, 353, 1617, 4110, 4234, 4234, 4234, 4234, 3878, 322,
+    2478, 1970, 1502, 4234, 4234, 1507, 3997, 4234, 3189, 874, 3138, 1153, 2853, 2445, 360, 3488,
+    2104, 2319, 4234, 2016, 2635, 3055, 429, 3271, 696, 975, 2141, 248, 489, 4234, 3421, 4234,
+    4234, 1211, 2852, 4234, 3448, 4234, 4234, 3216, 4234, 2461, 440, 4234, 2787, 3287, 3252, 4234,
+    2941, 2177, 371, 1984, 4077, 3098, 4234, 1458, 4066, 2836, 3819, 1124, 1319, 64, 4234, 3559,
+    159, 3798, 3343, 849, 3605, 3348, 1059, 1224, 3172, 2142, 1027, 2404, 2226, 4217, 4234, 2488,
+    636, 2281, 846, 202, 4234, 815, 1022, 4137, 2306, 4234, 305, 1042, 409, 553, 2050, 4234,
+    4234, 1878, 131, 4234, 2668, 4234, 400, 4234, 2405, 1869, 486, 1508, 2938, 1303, 4163, 2591,
+    2761, 3095, 2814, 4234, 766, 65, 1049, 896, 4234, 1257, 4234, 3615, 4234, 3201, 1342, 883,
+    4234, 221, 4119, 773, 898, 1159, 4234, 401, 798, 4234, 2715, 442, 1558, 4234, 2008, 1991,
+    2436, 3281, 4234, 2489, 4234, 1035, 2092, 4234, 3157, 4234, 2863, 2572, 4234, 2419, 4234, 1948,
+    3452, 998, 2970, 6, 718, 2504, 1813, 3472, 4234, 4234, 280, 952, 534, 4234, 3485, 2220,
+    3494, 1362, 242, 4234, 4234, 4158, 2609, 27, 2343, 4234, 1228, 1775, 474, 2562, 4234, 3263,
+    4234, 4234, 336, 4234, 4234, 1966, 2864, 1532, 3037, 1381, 929, 4234, 291, 1455, 4234, 4234,
+    737, 1912, 170, 809, 2936, 1909, 3947, 4234, 4205, 3072, 1755, 2312, 106, 3269, 4234, 3500,
+    2182, 83, 4234, 3482, 1920, 2672, 770, 1382, 1722, 960, 3874, 2308, 2015, 703, 3712, 1522,
+    4234, 3170, 1247, 1795, 4234, 945, 4234, 3408, 1056, 4234, 2554, 3652, 2659, 3848, 4230, 3364,
+    113, 4234, 4234, 1816, 1217, 4234, 981, 3720, 2800, 2741, 4167, 4220, 2769, 2570, 3265, 4234,
+    4234, 1363, 1223, 398, 4234, 1094, 4234, 2590, 3066, 4234, 4234, 225, 255, 4234, 3642, 4234,
+    1552, 2170, 3676, 4234, 2716, 4062, 1411, 612, 4234, 1520, 3431, 2354, 847, 1006, 545, 1090,
+    4234, 2655, 2126, 908, 3816, 2956, 461, 4234, 3585, 71, 1630, 4234, 4234, 3970, 1163, 3902,
+    88, 3111, 1236, 1900, 1965, 3833, 1575, 4234, 4234, 3713, 2840, 1391, 1888, 1640, 4234, 724,
+    3282, 3465, 4234, 1992, 2247, 4234, 263, 4234, 616, 4234, 3322, 968, 3086, 3821, 2107, 4234,
+    2997, 4234, 3940, 1415, 4234, 1750, 4180, 485, 3148, 569, 1260, 251, 1707, 2923, 1714, 4234,
+    2512, 2900, 4234, 3563, 508, 3981, 3580, 3857, 2817, 2519, 4234, 268, 1405, 4041, 1351, 1808,
+    4023, 3558, 4234, 3094, 222, 4193, 2544, 2222, 3338, 1735, 2947, 4234, 3943, 2751, 1258, 4028,
+    2369, 1564, 3158, 1005, 4234, 3229, 2649, 2793, 972, 4234, 140, 2825, 3136, 4234, 1943, 466,
+    2724, 4234, 1576, 2460, 3743, 3945, 645, 4234, 1729, 4234, 1325, 1634, 682, 2646, 1821, 2866,
+    4234, 3725, 1492, 262, 392, 3221, 4234, 3469, 2030, 693, 2339, 1804, 3690, 1486, 2473, 2060,
+    337, 2708, 4234, 3162, 3501, 610, 2337, 4234, 2632, 2425, 4234, 790, 4234, 3234, 598, 1328,
+    976, 1947, 1662, 4234, 4234, 730, 2829, 1478, 1884, 3420, 4234, 2457, 2201, 4234, 1537, 1506,
+    680, 2087, 711, 3509, 1123, 2223, 2406, 180, 2957, 4232, 4234, 3402, 4234, 2429, 1643, 3486,
+    1927, 469, 3412, 3649, 689, 1015, 4234, 1318, 1041, 3186, 3797, 2563, 2192, 4054, 4234, 2477,
+    4001, 1870, 4234, 1548, 4234, 3350, 496, 2240, 2532, 1910, 2762, 2842, 4234, 829, 85, 1497,
+    1792, 3387, 2660, 2948, 2943, 4234, 1403, 3493, 1057, 882, 261, 4145, 4234, 1571, 989, 388,
+    4234, 3571, 4042, 2205, 2309, 3655, 4234, 4234, 4234, 1605, 4234, 664, 2484, 3696, 1612, 2585,
+    3882, 3310, 3132, 2311, 1776, 3467, 2880, 2143, 2068, 1229, 3468, 3050, 4234, 2438, 3847, 4234,
+    1787, 3956, 4008, 4234, 3995, 2958, 2522, 1353, 1443, 1451, 260, 2882, 93, 1700, 2252, 281,
+    4081, 1063, 4234, 4056, 624, 4234, 1357, 4234, 4234, 2883, 2424, 2062, 465, 2215, 1819, 954,
+    3608, 3742, 118, 658, 3388, 918, 2268, 833, 564, 3958, 32, 1525, 2797, 4234, 2535, 4234,
+    1336, 1935, 3166, 3756, 1188, 1646, 3606, 1433, 2169, 4234, 4101, 3732, 1875, 2955, 4234, 1218,
+    55, 217, 3507, 2906, 4234, 3398, 807, 3334, 2186, 4194, 2587, 1144, 4234, 4234, 3451, 2327,
+    3678, 3583, 4234, 94, 4234, 2777, 189, 3783, 3330, 4234, 1444, 3119, 788, 73, 1442, 4234,
+    4234, 792, 2730, 1885, 321, 3289, 3527, 2038, 411, 3439, 1262, 160, 781, 864, 4234, 2598,
+    4225, 619, 4185, 4234, 3763, 3835, 2286, 3598, 4234, 4234, 4234, 2412, 4234, 2144, 1711, 3656,
+    3704, 1134, 374, 2305, 4234, 4234, 3114, 1598, 3109, 1969, 1118, 3489, 4234, 3859, 4234, 2841,
+    1469, 3447, 2483, 3177, 3332, 657, 3880, 2694, 1261, 4234, 307, 412, 3944, 3577, 901, 4234,
+    3293, 4172, 2234, 470, 1230, 3147, 3069, 4234, 1019, 3244, 4109, 4234, 3214, 2203, 3826, 166,
+    3320, 2624, 987, 2757, 4234, 373, 734, 3907, 3014, 2031, 623, 3934, 4234, 3010, 1990, 1863,
+    3532, 4234, 288, 459, 1428, 3949, 4234, 2187, 651, 2275, 2737, 458, 1253, 1841, 417, 2270,
+    269, 1409, 3049, 3461, 3012, 514, 871, 1651, 3219, 1040, 933, 2078, 4132, 1570, 448, 1828,
+    2895, 4234, 1998, 4234, 2541, 310, 513, 2528, 520, 2379, 600, 2273, 301, 4234, 633, 1311,
+    1425, 4234, 3844, 1622, 4234, 2476, 3992, 2954, 1979, 4234, 3168, 48, 3018, 988, 2612, 4030,
+    4234, 198, 46, 4234, 1238, 3082, 3199, 2755, 2838, 372, 2712, 4234, 2414, 323, 1406, 5,
+    3365, 512, 4234, 1154, 1793, 559, 4234, 1839, 4234, 1327, 2740, 629, 4234, 2227, 3975, 1763,
+    3248, 4234, 4234, 4234, 3937, 1737, 2113, 4004, 364, 3549, 4234, 1079, 804, 4234, 3708, 617,
+    4234, 3603, 1075, 2551, 4234, 727, 4234, 3345, 3677, 2094, 1389, 565, 2975, 3057, 361, 490,
+    713, 537, 2794, 1340, 2116, 812, 962, 2032, 4234, 704, 1432, 1012, 2433, 1573, 889, 4032,
+    3876, 4234, 4234, 1242, 1654, 3861, 391, 4234, 4159, 4234, 4234, 554, 3307, 747, 1931, 121,
+    1383, 4234, 2821, 1400, 1807, 1641, 3466, 1344, 1639, 4084, 543, 2531, 994, 3927, 3459, 4234,
+    3604, 205, 2697, 4171, 4234, 4234, 3752, 936, 4234, 3104, 29, 4234, 1128, 1036, 2496, 3738,
+    4234, 28, 277, 3205, 4174, 1933, 4011, 4058, 3519, 436, 4234, 4017, 3734, 4234, 1220, 3051,
+    4234, 4234, 3936, 677, 3024, 4234, 4234, 2095, 3085, 3065, 1483, 852, 2127, 3961, 916, 3437,
+    4122, 2486, 3644, 4152, 1567, 4234, 3893, 1393, 3621, 3278, 2526, 3008, 2823, 760, 3090, 3505,
+    267, 2017, 1314, 2470, 1976, 2571, 1435, 3959, 1074, 2237, 383, 1200, 2276, 1784, 4234, 306,
+    1495, 4234, 4234, 2878, 2959, 3700, 259, 2642, 132, 2403, 2516, 828, 4051, 41, 1392, 2942,
+    2786, 2390, 1369, 3919, 3542, 4234, 2001, 621, 4234, 920, 3496, 2110, 289, 4234, 1334, 1514,
+    3061, 3292, 4234, 3780, 4234, 2524, 3228, 3434, 1445, 1009, 2318, 4234, 4182, 3747, 1584, 1952,
+    2368, 2982, 1956, 2858, 4234, 2266, 2154, 188, 2886, 3183, 4234, 1322, 2482, 1746, 3812, 3280,
+    2653, 3957, 1272, 4234, 4234, 4025, 2805, 4234, 2155, 1993, 765, 2984, 450, 1661, 3726, 4233,
+    2707, 2393, 1174, 1626, 3169, 119, 4224, 3836, 2167, 2988, 1625, 444, 3745, 4234, 3093, 3397,
+    3478, 3074, 4234, 4234, 1324, 3060, 552, 1316, 3396, 1692, 4228, 1338, 1105, 2993, 4234, 2492,
+    87, 4234, 318, 3033, 3553, 4162, 1764, 271, 1426, 1177, 2375, 1523, 2908, 1398, 2990, 1184,
+    4234, 4234, 1157, 3005, 1867, 2622, 2870, 1550, 1799, 3969, 4234, 1937, 1479, 2887, 1284, 1652,
+    4234, 4234, 2919, 3654, 1286, 1196, 4234, 1301, 4125, 1150, 2782, 3327, 2896, 2, 1919, 3785,
+    2580, 3062, 1440, 3285, 574, 4234, 3683, 2128, 4234, 192, 4234, 556, 4234, 4234, 2027, 2209,
+    3347, 1068, 2115, 3730, 3751, 3631, 4234, 2994, 4207, 1953, 1408, 3495, 3152, 3922, 4234, 1832,
+    4234, 4234, 2592, 4234, 3475, 3987, 4138, 2253, 3991, 3556, 4234, 1921, 3589, 1135, 3765, 3548,
+    4234, 2610, 218, 200, 178, 4234, 1017, 3762, 4234, 3113, 2684, 1712, 16, 3076, 625, 4234,
+    4234, 2767, 4234, 4234, 2346, 1789, 662, 3675, 3850, 4234, 3045, 1957, 1902, 4234, 4234, 3250,
+    387, 483, 4234, 2621, 1726, 3193, 2638, 4234, 2392, 2014, 4234, 4144, 90, 4234, 2285, 4234,
+    1139, 4234, 3411, 3274, 1903, 3481, 2986, 2547, 4234, 4234, 695, 4234, 2515, 4234, 1543, 4234,
+    4234, 4142, 480, 3832, 1102, 3634, 1246, 4176, 3417, 1346, 1835, 4234, 1697, 1254, 1565, 313,
+    358, 1280, 3846, 335, 1155, 4234, 2989, 278, 438, 1439, 1078, 2449, 4234, 4199, 4234, 4234,
+    3757, 2583, 4234, 2200, 4234, 1930, 4234, 4234, 3126, 4234, 674, 2596, 2098, 1823, 342, 3040,
+    3404, 1842, 1648, 1108, 2235, 2894, 1138, 3538, 2901, 1376, 1759, 4234, 1960, 4234, 2625, 2559,
+    562, 2537, 2402, 2511, 4234, 3084, 3839, 4234, 2546, 4234, 52, 4234, 2421, 2325, 3978, 1291,
+    4234, 4149, 2678, 1734, 928, 2770, 3801, 1860, 4091, 2447, 848, 1209, 3741, 4234, 2151, 3674,
+    1582, 818, 4234, 912, 1271, 1604, 2348, 877, 1742, 1616, 1399, 3915, 4181, 194, 1375, 77,
+    4234, 676, 223, 1982, 2074, 1237, 510, 4234, 1749, 3718, 3325, 2194, 4060, 136, 224, 4234,
+    655, 1698, 3803, 4234, 1186, 4234, 2025, 2179, 457, 2121, 4234, 2698, 1248, 1069, 4198, 1465,
+    4234, 3308, 644, 681, 660, 241, 2779, 4234, 4219, 2371, 2634, 143, 1273, 171, 671, 3030,
+    690, 2500, 1117, 2744, 2251, 3180, 1468, 3636, 1649, 3868, 298, 4234, 2349, 1298, 4234, 4234,
+    4234, 2180, 1670, 2184, 4234, 3196, 2965, 4234, 3881, 1066, 302, 1519, 37, 2287, 116, 783,
+    4234, 2293, 2627, 2721, 2525, 2387, 4234, 4234, 2909, 2335, 731, 4234, 3520, 4186, 1293, 117,
+    1365, 4234, 3503, 3224, 4234, 836, 3154, 1546, 4234, 4234, 4234, 3181, 157, 1560, 1251, 2833,
+    1089, 3474, 755, 884, 290, 299, 2927, 585, 498, 3149, 1599, 4234, 4012, 4234, 84, 557,
+    4234, 2789, 3380, 1814, 1983, 4212, 3137, 4234, 4146, 4234, 3554, 1757, 4215, 4234, 1305, 3530,
+    4166, 4234, 1462, 2164, 2873, 2288, 3967, 4234, 1031, 518, 4143, 3068, 1715, 4234, 1421, 782,
+    2980, 1062, 292, 672, 2809, 1345, 4234, 1963, 4226, 1727, 1800, 3701, 1580, 4234, 977, 215,
+    2688, 796, 124, 4229, 4210, 735, 763, 2654, 3156, 1850, 1199, 2296, 4103, 3512, 626, 803,
+    3424, 780, 297, 304, 2568, 3335, 3161, 2617, 584, 2813, 4234, 1530, 4234, 1007, 4234, 3852,
+    1905, 4234, 60, 1801, 2112, 1234, 365, 4206, 354, 4234, 54, 1941, 1087, 3247, 2452, 4160,
+    4234, 4234, 597, 997, 1354, 3856, 4234, 4234, 253, 4234, 4234, 4234, 1747, 1951, 2297, 3371,
+    1171, 4234, 2674, 4234, 3449, 3464, 363, 904, 2341, 527, 4234, 2415, 3048, 4234, 3576, 3905,
+    2041, 4234, 3740, 4234, 35, 2687, 1811, 3331, 581, 4234, 741, 1758, 3341, 349, 1413, 4234,
+    3722, 1716, 1739, 3630, 4234, 942, 1723, 2710, 4234, 4234, 1061, 3575, 4234, 1207, 3099, 4234,
+    3989, 577, 551, 3673, 153, 2469, 3581, 2185, 2243, 3830, 2152, 18, 4234, 1780, 2747, 3191,
+    4234, 4234, 827, 2645, 1137, 2491, 4234, 80, 3914, 3286, 4234, 4234, 1843, 2603, 1377, 1781,
+    1762, 4234, 4234, 2963, 4234, 4150, 844, 3406, 4086, 1055, 2671, 3663, 3845, 1681, 4234, 423,
+    1013, 333, 4234, 324, 2040, 2324, 1555, 3117, 1309, 3588, 2326, 3426, 2839, 2106, 1896, 4234,
+    590, 2102, 1364, 3855, 4073, 1023, 4234, 2890, 817, 785, 1978, 2892, 435, 4048, 3276, 186,
+    2843, 4234, 647, 4234, 2188, 1997, 4013, 4234, 1858, 4234, 4031, 50, 4234, 1274, 1060, 3748,
+    2620, 4234, 2555, 1107, 3092, 1588, 611, 4234, 3928, 51, 2732, 719, 3003, 3270, 1848, 4234,
+    2043, 1696, 2773, 4234, 3811, 2207, 3187, 632, 2013, 1644, 3209, 204, 2214, 1803, 1097, 3312,
+    4234, 3587, 4234, 4234, 2608, 2456, 45, 1119, 3843, 2685, 2561, 2129, 421, 4234, 4234, 2656,
+    275, 3904, 2081, 500, 3264, 1613, 1498, 4234, 3667, 3491, 3326, 2501, 3009, 862, 1011, 4234,
+    1926, 3863, 953, 2278, 729, 2183, 4234, 2261, 541, 2903, 2914, 4234, 907, 3851, 4234, 2791,
+    2096, 3864, 4234, 930, 4234, 3952, 2448, 1629, 2768, 678, 555, 2581, 26, 4234, 2427, 4234,
+    1289, 1360, 4234, 3895, 974, 810, 3386, 2463, 4234, 594, 2690, 3693, 4234, 533, 502, 2007,
+    3666, 2450, 2503, 1572, 640, 3807, 4034, 183, 4234, 1064, 2599, 4234, 4234, 4234, 3651, 3951,
+    4234, 4234, 4234, 1037, 4234, 2934, 1621, 3034, 4161, 3546, 2689, 4234, 10, 3993, 3185, 3921,
+    2604, 3764, 1624, 1934, 3073, 82, 1690, 575, 4234, 1618, 2987, 558, 3910, 1231, 1790, 830,
+    742, 4234, 4234, 2857, 2453, 4234, 4234, 210, 1528, 1769, 1590, 938, 3971, 2011, 4234, 4234,
+    4234, 1699, 700, 4082, 3023, 1203, 4234, 4234, 2539, 1160, 1767, 1029, 2605, 4067, 3889, 4234,
+    1633, 2913, 2157, 1172, 3645, 4234, 19, 774, 1429, 505, 3717, 4234, 426, 3619, 1914, 3377,
+    1221, 3909, 2826, 1974, 2681, 101, 3190, 4234, 2137, 951, 4234, 1738, 4234, 4234, 1945, 4234,
+    2322, 3809, 1851, 4234, 753, 42, 3550, 3301, 3582, 355, 17, 283, 3395, 2867, 3262, 3681,
+    4234, 3083, 2776, 2044, 3442, 1568, 3477, 4234, 2758, 3146, 3394, 1513, 1529, 1266, 2613, 4234,
+    1268, 4124, 3105, 1916, 893, 924, 1378, 2662, 3002, 245, 2481, 3391, 3019, 4234, 1539, 4234,
+    4234, 1693, 149, 1339, 1987, 686, 2731, 4234, 384, 4234, 675, 3150, 1016, 4234, 4234, 2951,
+    4100, 1603, 1620, 2832, 2953, 2373, 4234, 351, 1682, 1818, 3128, 2711, 1082, 3942, 4234, 4133,
+    4175, 1600, 3788, 3557, 630, 3291, 3381, 2884, 1366, 1671, 81, 4234, 4234, 1518, 3373, 3646,
+    542, 2070, 3504, 1779, 2799, 3288, 3029, 2828, 2790, 452, 4234, 2225, 1300, 1736, 315, 570,
+    2693, 2075, 3389, 1796, 3268, 2536, 4234, 4234, 1972, 397, 2706, 4234, 4234, 722, 775, 4191,
+    706, 2190, 405, 161, 4234, 1501, 4234, 608, 4071, 4234, 3698, 4234, 4234, 895, 913, 4078,
+    123, 2290, 1975, 3828, 1132, 4234, 235, 3160, 2072, 650, 1849, 4003, 3514, 1112, 3899, 4046,
+    2367, 521, 3127, 668, 2195, 2644, 1864, 4234, 2850, 3906, 4234, 1434, 2753, 3454, 3761, 1308,
+    2310, 252, 2558, 1939, 3241, 2472, 751, 150, 4234, 3616, 3633, 3143, 2669, 2739, 295, 2717,
+    4234, 1282, 2411, 1524, 1728, 3498, 591, 1288, 1730, 2271, 985, 839, 1510, 3470, 3932, 2960,
+    3834, 2911, 286, 1788, 2518, 2933, 1130, 941, 3039, 4234, 4178, 3562, 2069, 4059, 3986, 4234,
+    3407, 3822, 4234, 4234, 1908, 905, 4234, 4234, 2845, 3360, 4234, 2736, 1786, 991, 3510, 2972,
+    148, 2985, 2005, 1459, 2361, 2120, 532, 4234, 1390, 3487, 2631, 3418, 1627, 1110, 4112, 1179,
+    3071, 3894, 4234, 4234, 4234, 3561, 4234, 4234, 14, 3052, 902, 4234, 3376, 4234, 1422, 4234,
+    3980, 2950, 3998, 4234, 2029, 3628, 482, 1831, 1341, 3870, 2756, 4234, 715, 3266, 3599, 1373,
+    422, 523, 2458, 152, 1491, 3, 996, 3476, 2382, 1805, 3984, 4234, 4234, 903, 1973, 3400,
+    339, 3304, 2089, 169, 4234, 4234, 2815, 1164, 1538, 3368, 1691, 4234, 201, 3142, 736, 712,
+    4234, 3383, 4234, 4234, 3875, 4234, 145, 231, 685, 2208, 4234, 2350, 3586, 1653, 4083, 4000,
+    4234, 4234, 1168, 2898, 78, 4234, 1131, 2417, 4234, 4148, 3144, 3772, 4234, 1541, 1774, 986,
+    4234, 3662, 1892, 3963, 4234, 2899, 3246, 1936, 4234, 111, 2907, 4234, 4234, 587, 1241, 4234,
+    2000, 1632, 446, 1638, 854, 4135, 4234, 3884, 219, 1610, 2874, 3806, 2534, 2365, 2695, 493,
+    3349, 832, 312, 4234, 2920, 1025, 3305, 144, 1225, 1404, 4234, 4234, 1895, 2230, 1111, 3236,
+    2302, 2391, 4234, 732, 1181, 147, 2691, 317, 3729, 1499, 2578, 842, 1773, 3100, 2798, 922,
+    3746, 2628, 794, 4234, 4234, 2173, 837, 1194, 845, 182, 2719, 1488, 4234, 663, 2340, 3016,
+    3766, 2051, 1467, 2124, 4234, 1695, 3787, 2742, 4234, 876, 207, 1583, 653, 4234, 2259, 2629,
+    4234, 1894, 673, 4234, 195, 92, 4234, 2922, 4234, 1086, 934, 2256, 3446, 4179, 4216, 1051,
+    2091, 1527, 1329, 3842, 2508, 813, 726, 4234, 931, 4234, 2673, 2586, 1544, 875, 4234, 535,
+    3731, 120, 3013, 4234, 1668, 825, 3531, 1071, 456, 3540, 3440, 2333, 3890, 3366, 4234, 1073,
+    3300, 925, 4234, 1490, 4234, 4234, 2774, 4234, 2109, 1176, 2696, 2856, 173, 196, 2641, 2683,
+    3340, 3671, 3679, 4037, 4234, 1733, 356, 4111, 4234, 863, 3460, 4234, 4234, 4234, 2729, 1846,
+    1081, 661, 3962, 3529, 1688, 4234, 1861, 4234, 4234, 3886, 2502, 4106, 3723, 266, 4234, 2443,
+    3924, 1380, 2103, 1475, 3359, 4234, 1034, 3116, 639, 2257, 357, 4234, 2245, 2418, 1427, 744,
+    2552, 3515, 2550, 708, 1493, 441, 563, 4234, 786, 3699, 2921, 4234, 1838, 560, 4234, 2026,
+    1249, 1471, 1918, 4234, 4234, 1215, 4234, 1526, 1868, 4234, 3499, 1512, 226, 4002, 3613, 4234,
+    3053, 4234, 4234, 4234, 4234, 2292, 4234, 4108, 4234, 548, 4234, 1904, 1847, 4234, 3593, 1606,
+    4234, 946, 2334, 2556, 4234, 2497, 3369, 4234, 1756, 1614, 4189, 4234, 1331, 3458, 2640, 1642,
+    3872, 2216, 386, 4222, 4234, 4234, 3724, 2174, 3492, 4234, 1496, 504, 1093, 3523, 1889, 2576,
+    4234, 4234, 141, 546, 3670, 2114, 4234, 4234, 4234, 4234, 1516, 666, 950, 4, 4234, 4234,
+    4234, 427, 1052, 4234, 3131, 2105, 2191, 3879, 969, 1175, 1374, 451, 4234, 4234, 917, 206,
+    911, 2601, 1395, 3908, 4234, 1265, 3518, 2260, 246, 3865, 4168, 1968, 2376, 1657, 1076, 2166,
+    4234, 96, 4234, 4234, 4234, 4234, 3640, 843, 868, 2973, 4096, 1417, 3777, 4234, 1515, 4234,
+    4049, 1487, 2021, 683, 4234, 1853, 2754, 4234, 1054, 4234, 3569, 1256, 4234, 4139, 1335, 3702,
+    2848, 1999, 68, 2451, 4234, 3897, 1893, 4234, 2313, 3096, 3996, 2977, 3691, 1704, 966, 544,
+    517, 4005, 4234, 4234, 3123, 2680, 1593, 3596, 799, 1, 4015, 293, 927, 2661, 4114, 91,
+    2196, 2399, 4022, 4234, 4234, 1751, 885, 3212, 174, 272, 1995, 888, 2176, 3611, 771, 3242,
+    1732, 3357, 1143, 36, 4234, 940, 2280, 1092, 4192, 705, 2135, 2480, 2250, 4234, 2648, 4234,
+    1872, 3243, 4234, 4075, 2979, 3929, 906, 1004, 453, 4234, 175, 4234, 418, 4234, 2446, 1470,
+    3021, 3891, 3541, 3097, 4234, 4234, 1292, 4234, 3533, 4234, 1566, 4234, 3597, 1660, 1659, 1441,
+    69, 3222, 2893, 2831, 3279, 1940, 2820, 530, 1540, 643, 240, 2521, 3647, 3384, 3838, 789,
+    447, 4234, 3665, 2795, 1008, 344, 3791, 1725, 1890, 2860, 955, 1482, 3815, 3070, 3771, 1944,
+    2569, 2409, 2134, 1450, 390, 995, 919, 3206, 1663, 3139, 3194, 1114, 4234, 4234, 2862, 1129,
+    2002, 4026, 3323, 2442, 3483, 4234, 2626, 3427, 2274, 2675, 4128, 3175, 3552, 1701, 1636, 3768,
+    2388, 2728, 3900, 1680, 1721, 4234, 3735, 3167, 1152, 3840, 3355, 4234, 4234, 3669, 1817, 4234,
+    1607, 4234, 3079, 900, 3107, 4234, 1233, 197, 381, 2983, 2295, 4234, 515, 2149, 3428, 3727,
+    4234, 4183, 793, 3639, 1106, 4027, 4029, 4234, 3145, 659, 2837, 1307, 2385, 2752, 2428, 1352,
+    4234, 894, 3866, 413, 1187, 3570, 1586, 4234, 4234, 4234, 4234, 4121, 2080, 2702, 3333, 3075,
+    2602, 2527, 1222, 4234, 3810, 1077, 146, 3682, 13, 4234, 4234, 3544, 3755, 4234, 2772, 3517,
+    4234, 4223, 2330, 2651, 2783, 2407, 4234, 2048, 4234, 739, 1782, 1343, 1098, 1481, 4234, 1267,
+    2875, 4234, 3602, 971, 3831, 1719, 3594, 993, 867, 3314, 4061, 4234, 3316, 4117, 652, 3200,
+    2277, 4234, 1333, 4234, 4211, 1156, 2161, 2490, 4234, 4140, 1674, 1283, 4234, 4164, 503, 4234,
+    2006, 3182, 1871, 2321, 4234, 1295, 3011, 1959, 1158, 4234, 3930, 4234, 4234, 2099, 3502, 2198,
+    816, 2039, 257, 4234, 649, 1783, 345, 2775, 4234, 3130, 4234, 4234, 4234, 1812, 1104, 2163,
+    3983, 3121, 1810, 4234, 3923, 1279, 3622, 1372, 3432, 2796, 348, 3786, 1766, 4234, 897, 382,
+    1072, 4234, 3022, 491, 4234, 808, 4234, 1881, 1001, 1206, 4234, 1297, 3808, 1876, 4234, 1043,
+    4234, 3416, 4234, 3134, 3572, 4234, 586, 4234, 2440, 2996, 3419, 3081, 2616, 2059, 2229, 1020,
+    1216, 2759, 4234, 1708, 2877, 2868, 835, 3101, 2255, 3560, 4234, 2303, 236, 443, 1717, 2573,
+    1464, 1030, 1585, 3436, 958, 4234, 2086, 4068, 296, 2054, 1672, 2084, 2937, 432, 238, 3208,
+    3789, 2426, 1635, 410, 3435, 3703, 4234, 2510, 2682, 2746, 2396, 2735, 723, 2918, 1147, 1505,
+    4234, 4234, 622, 2279, 4234, 4234, 2479, 1420, 3277, 2594, 599, 4234, 98, 1494, 4234, 2865,
+    3657, 4234, 165, 4234, 3056, 1210, 1452, 547, 3898, 43, 4234, 4234, 973, 2238, 3077, 4234,
+    4234, 2012, 522, 3547, 2647, 369, 2657, 2328, 2542, 1686, 4234, 3638, 3217, 4234, 3259, 3174,
+    1473, 49, 499, 4130, 1348, 3004, 3047, 880, 831, 2912, 3353, 314, 4234, 3401, 2543, 3140,
+    566, 3913, 4234, 2885, 1562, 721, 2269, 1127, 1689, 1299, 2053, 784, 688, 691, 4234, 3728,
+    3774, 4234, 909, 1824, 67, 1608, 3035, 4234, 2765, 1955, 1754, 3892, 4234, 311, 1873, 923,
+    4234, 2764, 4089, 2564, 2381, 3171, 4234, 4234, 2165, 4196, 2917, 3392, 2733, 4234, 287, 1675,
+    561, 3231, 341, 3210, 59, 4072, 699, 4136, 573, 1394, 3982, 4234, 1386, 2383, 3627, 967,
+    4234, 414, 2100, 2498, 4116, 778, 3230, 3767, 797, 2582, 15, 2246, 4234, 4234, 1820, 3629,
+    2374, 4234, 3695, 3423, 1760, 4234, 3102, 1148, 4234, 1772, 3375, 8, 181, 759, 525, 4234,
+    177, 258, 250, 1115, 2395, 2663, 4234, 758, 3261, 3413, 3385, 881, 1136, 4234, 3769, 4234,
+    3862, 3896, 4234, 4234, 2360, 3574, 380, 164, 4234, 4234, 3626, 4234, 2792, 3000, 4234, 2291,
+    2650, 2232, 3058, 980, 352, 163, 1460, 3362, 4234, 3653, 2976, 2713, 761, 1830, 3709, 3823,
+    873, 1899, 1862, 2465, 627, 1946, 208, 2891, 330, 199, 4234, 878, 1140, 4234, 128, 2703,
+    239, 4234, 4234, 2474, 4234, 472, 603, 4234, 3941, 2171, 3042, 2338, 1278, 1553, 1162, 2439,
+    122, 707, 2946, 4047, 3537, 4234, 3778, 725, 3233, 3220, 3027, 4234, 1213, 2929, 137, 2847,
+    1410, 232, 3535, 4234, 3887, 4234, 4234, 7, 970, 4234, 4234, 3255, 2652, 2042, 4123, 4234,
+    506, 100, 2619, 841, 978, 3403, 1453, 4234, 2228, 3044, 233, 1416, 3054, 326, 4234, 1474,
+    4234, 2766, 4234, 4204, 1446, 1239, 4007, 1402, 2036, 1447, 2159, 3299, 2855, 795, 1190, 3443,
+    1436, 4234, 3188, 2549, 3954, 1705, 1925, 921, 2466, 3124, 1431, 2633, 2336, 1535, 4234, 4234,
+    501, 4234, 2743, 3361, 4218, 1489, 1388, 1191, 1219, 1879, 4153, 1323, 961, 4102, 2723, 1384,
+    4234, 4234, 320, 3211, 3824, 2812, 3979, 2718, 3374, 3409, 2125, 4234, 3750, 3710, 4234, 220,
+    3253, 249, 1195, 754, 3793, 3867, 1852, 1275, 910, 216, 158, 2028, 589, 4234, 1898, 3612,
+    3939, 3931, 3794, 227, 4234, 1577, 3444, 4234, 2162, 4234, 3318, 1913, 4234, 4234, 1702, 814,
+    4234, 86, 3680, 2221, 4039, 4234, 4197, 2117, 2045, 850, 4234, 4234, 1666, 2910, 4234, 776,
+    4234, 4188, 62, 4234, 4126, 3309, 2033, 3578, 615, 4234, 20, 4234, 2560, 579, 3911, 1971,
+    1500, 3379, 4234, 2523, 2940, 4234, 4234, 3302, 4234, 2055, 2153, 3635, 1477, 1964, 932, 538,
+    2538, 756, 516, 264, 2704, 1480, 642, 3342, 3159, 4006, 3155, 2047, 4033, 1906, 4234, 2366,
+    3295, 2851, 4063, 2241, 1356, 2085, 3067, 4234, 3346, 857, 4234, 571, 4234, 507, 4234, 4234,
+    4234, 3925, 247, 484, 3422, 4234, 4234, 4234, 949, 4151, 1355, 3153, 3046, 820, 3321, 1797,
+    3352, 3089, 2611, 3410, 2359, 211, 3198, 377, 1761, 3462, 3883, 3617, 367, 4234, 956, 4234,
+    1932, 4234, 408, 3686, 1619, 3694, 316, 1967, 4234, 4234, 3618, 1673, 4234, 2700, 2263, 2699,
+    2506, 3315, 1542, 3372, 4088, 234, 634, 4234, 4234, 4234, 3775, 1185, 23, 1437, 4234, 3441,
+    4064, 1173, 1536, 3955, 4050, 130, 2217, 4234, 728, 4227, 698, 2300, 4234, 3480, 1350, 4234,
+    3215, 2160, 2992, 1368, 4234, 4079, 2540, 1418, 2362, 4234, 3223, 366, 22, 1010, 3624, 2037,
+    125, 1777, 4234, 274, 294, 752, 1631, 1126, 1597, 720, 3031, 1581, 4234, 473, 1033, 282,
+    1310, 437, 959, 3688, 2320, 4234, 4057, 779, 2670, 2819, 1084, 284, 3382, 601, 2811, 3972,
+    2267, 2574, 279, 4095, 2806, 1205, 2824, 1053, 2771, 1665, 823, 4016, 1981, 3141, 4234, 1306,
+    1703, 667, 1000, 454, 1349, 2239, 4234, 509, 2846, 4234, 2244, 2363, 2493, 12, 2083, 2944,
+    3760, 2935, 583, 2197, 1046, 4234, 526, 2589, 1954, 2579, 4234, 3790, 3399, 2150, 4234, 670,
+    463, 2131, 4234, 1058, 4234, 4234, 3226, 4234, 4009, 3802, 4234, 4093, 2834, 1085, 1563, 340,
+    4234, 31, 370, 4234, 3935, 1321, 389, 4234, 3506, 899, 3453, 3303, 4234, 1424, 1294, 3779,
+    4234, 4234, 185, 1044, 2577, 2067, 3800, 2206, 2889, 4234, 2804, 4234, 2749, 3536, 3719, 4234,
+    3213, 2705, 609, 2593, 1785, 2193, 4234, 468, 327, 620, 4234, 3664, 2423, 1886, 4234, 39,
+    2058, 4234, 4097, 4234, 1706, 103, 819, 1791, 1463, 4234, 743, 4024, 1330, 3685, 3115, 1834,
+    1589, 2861, 3328, 4234, 3344, 1240, 4234, 2130, 4010, 2136, 3796, 1669, 347, 172, 4234, 2168,
+    3528, 2065, 464, 1485, 4234, 1549, 4234, 3028, 2658, 2509, 4234, 2530, 811, 2748, 350, 1962,
+    2061, 4234, 1687, 309, 2389, 665, 3202, 2347, 3849, 851, 4234, 4087, 4234, 394, 3036, 2356,
+    2931, 4234, 4234, 4045, 56, 596, 4234, 445, 431, 2066, 1281, 2372, 2725, 4234, 1961, 4234,
+    4234, 4234, 654, 4234, 4209, 2314, 492, 1611, 4234, 3080, 44, 4234, 228, 1133, 3684, 4234,
+    1844, 4234, 1457, 1142, 1557, 2967, 4234, 3257, 2464, 1534, 4020, 2595, 4234, 4234, 47, 2726,
+    3623, 133, 2265, 2213, 3151, 4234, 4234, 806, 716, 4234, 3917, 3600, 2122, 3841, 4234, 3256,
+    4234, 3471, 270, 3038, 3363, 1753, 4234, 1226, 1574, 1679, 3818, 1897, 2416,
+}; // termHashSlots_
+
+
+const size_t termHashSlotsSize_ = sizeof(termHashSlots_)/sizeof(boost::uint32_t);
+
+
 class CVTermData : public boost::singleton<CVTermData>
 {
     public:
     CVTermData(boost::restricted)
+    :   infos_(termInfosSize_), infoInitialized_(termInfosSize_, util::init_once_flag_proxy)
     {
+        cvids_.reserve(termInfosSize_);
         for (const TermInfo* it=termInfos_; it!=termInfos_+termInfosSize_; ++it)
-        {
-            CVTermInfo temp;
-            temp.cvid = it->cvid;
-            temp.id = it->id;
-            temp.name = it->name;
-            temp.def = it->def;
-            temp.isObsolete = it->isObsolete;
-            infoMap_[temp.cvid] = temp;
             cvids_.push_back(it->cvid);
-        }
-
-        for (const CVIDPair* it=relationsIsA_; it!=relationsIsA_+relationsIsASize_; ++it)
-            infoMap_[it->first].parentsIsA.push_back(it->second);
-
-        for (const CVIDPair* it=relationsPartOf_; it!=relationsPartOf_+relationsPartOfSize_; ++it)
-            infoMap_[it->first].parentsPartOf.push_back(it->second);
-
-        for (const OtherRelationPair* it=relationsOther_; it!=relationsOther_+relationsOtherSize_; ++it)
-            infoMap_[it->subject].otherRelations.insert(make_pair(it->relation, it->object));
-
-        for (const CVIDStringPair* it=relationsExactSynonym_; it!=relationsExactSynonym_+relationsExactSynonymSize_; ++it)
-            infoMap_[it->first].exactSynonyms.push_back(it->second);
-
-        for (const PropertyValuePair* it=propertyValue_; it!=propertyValue_+propertyValueSize_; ++it)
-            infoMap_[it->term].propertyValues.insert(make_pair(it->name, it->value));
 
         cvMap_["MS"].fullName = "Proteomics Standards Initiative Mass Spectrometry Ontology";
         cvMap_["MS"].URI = "http://psidev.cvs.sourceforge.net/*checkout*/psidev/psi/psi-ms/mzML/controlledVocabulary/psi-ms.obo";
@@ -21531,12 +30122,48 @@ class CVTermData : public boost::singleton<CVTermData>
 
     }
 
-    inline const map<CVID,CVTermInfo>& infoMap() const {return infoMap_;}
+    /// the CVTermInfo of the term at termInfos_[index], which is only filled in the first time it is asked for
+    inline const CVTermInfo& info(size_t index) const
+    {
+        boost::call_once(infoInitialized_[index].flag, boost::bind(&CVTermData::initializeInfo, this, index));
+        return infos_[index];
+    }
+
     inline const map<string,CV>& cvMap() const {return cvMap_;}
     inline const vector<CVID>& cvids() const {return cvids_;}
 
     private:
-    map<CVID,CVTermInfo> infoMap_;
+    void initializeInfo(size_t index) const
+    {
+        const TermInfo& term = termInfos_[index];
+        const TermRelations& begin = termRelations_[index];
+        const TermRelations& end = termRelations_[index+1];
+
+        CVTermInfo& info = infos_[index];
+        info.cvid = term.cvid;
+        info.id = term.id;
+        info.name = term.name;
+        info.def = term.def;
+        info.isObsolete = term.isObsolete;
+
+        for (const CVIDPair* it=relationsIsA_+begin.isA; it!=relationsIsA_+end.isA; ++it)
+            info.parentsIsA.push_back(it->second);
+
+        for (const CVIDPair* it=relationsPartOf_+begin.partOf; it!=relationsPartOf_+end.partOf; ++it)
+            info.parentsPartOf.push_back(it->second);
+
+        for (const OtherRelationPair* it=relationsOther_+begin.other; it!=relationsOther_+end.other; ++it)
+            info.otherRelations.insert(make_pair(it->relation, it->object));
+
+        for (const CVIDStringPair* it=relationsExactSynonym_+begin.exactSynonym; it!=relationsExactSynonym_+end.exactSynonym; ++it)
+            info.exactSynonyms.push_back(it->second);
+
+        for (const PropertyValuePair* it=propertyValue_+begin.propertyValue; it!=propertyValue_+end.propertyValue; ++it)
+            info.propertyValues.insert(make_pair(it->name, it->value));
+    }
+
+    mutable vector<CVTermInfo> infos_;
+    mutable vector<util::once_flag_proxy> infoInitialized_;
     map<string,CV> cvMap_;
     vector<CVID> cvids_;
 };
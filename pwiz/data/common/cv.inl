@@ -67,13 +67,22 @@ PWIZ_API_DECL string CVTermInfo::prefix() const
 }
 
 
+/// returns the index of cvid in termInfos_, or termInfosSize_ if there is no such term
+inline size_t termIndex(CVID cvid)
+{
+    boost::uint32_t key = (boost::uint32_t) cvid;
+    boost::uint32_t displacement = termHashDisplacements_[cvidHash(key, 0) % termHashDisplacementsSize_];
+    size_t index = termHashSlots_[cvidHash(key, displacement) % termHashSlotsSize_];
+    return index < termInfosSize_ && termInfos_[index].cvid == cvid ? index : termInfosSize_;
+}
+
+
 PWIZ_API_DECL const CVTermInfo& cvTermInfo(CVID cvid)
 {
-    const map<CVID,CVTermInfo>& infoMap = CVTermData::instance->infoMap();
-    map<CVID,CVTermInfo>::const_iterator itr = infoMap.find(cvid);
-    if (itr == infoMap.end())
+    size_t index = termIndex(cvid);
+    if (index == termInfosSize_)
         throw invalid_argument("[cvTermInfo()] no term associated with CVID \"" + lexical_cast<string>(cvid) + "\"");
-    return itr->second;
+    return CVTermData::instance->info(index);
 }
 
 
@@ -108,26 +117,27 @@ PWIZ_API_DECL const CVTermInfo& cvTermInfo(const char* id)
             if ((!*op) && (*ip++==':')) 
             {   // id has form "FOO:nnnnnn", and ip points at "nnnnnn"
                 CVID cvid = (CVID)(o*enumBlockSize_ + strtoul(ip,NULL,10));
-                const map<CVID, CVTermInfo>& infoMap = CVTermData::instance->infoMap();
-                map<CVID, CVTermInfo>::const_iterator find = infoMap.find(cvid);
-                if (find == infoMap.end())
+                size_t index = termIndex(cvid);
+                if (index == termInfosSize_)
                 {
                     throw out_of_range("Invalid cvParam accession \"" + lexical_cast<string>(cvid) + "\"");
                 }
-                return find->second;
+                return CVTermData::instance->info(index);
             }
         }
-    return CVTermData::instance->infoMap().find(CVID_Unknown)->second;
+    return CVTermData::instance->info(termIndex(CVID_Unknown));
 }
 
 
 PWIZ_API_DECL bool cvIsA(CVID child, CVID parent)
 {
     if (child == parent) return true;
-    const CVTermInfo& info = cvTermInfo(child);
-    for (CVTermInfo::id_list::const_iterator it=info.parentsIsA.begin(); it!=info.parentsIsA.end(); ++it)
-        if (cvIsA(*it,parent)) return true;
-    return false;
+    size_t index = termIndex(child);
+    if (index == termInfosSize_)
+        throw invalid_argument("[cvIsA()] no term associated with CVID \"" + lexical_cast<string>(child) + "\"");
+    return binary_search(isAClosure_ + termRelations_[index].isAClosure,
+                         isAClosure_ + termRelations_[index+1].isAClosure,
+                         parent);
 }
 
 
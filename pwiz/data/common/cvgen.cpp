@@ -26,6 +26,7 @@
 #include "boost/filesystem/fstream.hpp"
 #include "boost/xpressive/xpressive_dynamic.hpp"
 #include "pwiz/utility/misc/Std.hpp"
+#include <boost/cstdint.hpp>
 
 using namespace pwiz::data;
 namespace bfs = boost::filesystem;
@@ -121,6 +122,86 @@ size_t enumValue(const Term& term, size_t index)
 }
 
 
+// the hash used for the CVID -> term index lookup table; cvidHashSource_ must be the same function
+boost::uint32_t cvidHash(boost::uint32_t cvid, boost::uint32_t seed)
+{
+    boost::uint32_t h = cvid ^ (seed * 0x9E3779B9u);
+    h ^= h >> 16; h *= 0x85EBCA6Bu;
+    h ^= h >> 13; h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+const char* cvidHashSource_ =
+    "inline boost::uint32_t cvidHash(boost::uint32_t cvid, boost::uint32_t seed)\n"
+    "{\n"
+    "    boost::uint32_t h = cvid ^ (seed * 0x9E3779B9u);\n"
+    "    h ^= h >> 16; h *= 0x85EBCA6Bu;\n"
+    "    h ^= h >> 13; h *= 0xC2B2AE35u;\n"
+    "    h ^= h >> 16;\n"
+    "    return h;\n"
+    "}\n\n\n";
+
+
+struct BiggerBucket
+{
+    const vector< vector<size_t> >& buckets;
+    BiggerBucket(const vector< vector<size_t> >& buckets) : buckets(buckets) {}
+    bool operator()(size_t lhs, size_t rhs) const {return buckets[lhs].size() > buckets[rhs].size();}
+};
+
+
+// builds a minimal-ish perfect hash of the CVIDs by "hash and displace": keys are split into buckets by
+// cvidHash(key, 0), and each bucket (biggest first) gets the first seed that puts all its keys in free slots
+void buildPerfectHash(const vector<boost::uint32_t>& keys,
+                      vector<boost::uint32_t>& displacements,
+                      vector<size_t>& slots)
+{
+    size_t bucketCount = keys.size() / 4 + 1;
+    size_t slotCount = keys.size() + keys.size() / 4 + 1;
+
+    vector< vector<size_t> > buckets(bucketCount);
+    for (size_t i=0; i < keys.size(); ++i)
+        buckets[cvidHash(keys[i], 0) % bucketCount].push_back(i);
+
+    vector<size_t> bucketOrder(bucketCount);
+    for (size_t i=0; i < bucketCount; ++i)
+        bucketOrder[i] = i;
+    stable_sort(bucketOrder.begin(), bucketOrder.end(), BiggerBucket(buckets));
+
+    displacements.assign(bucketCount, 0);
+    slots.assign(slotCount, keys.size()); // keys.size() marks an empty slot
+    BOOST_FOREACH(size_t b, bucketOrder)
+    {
+        const vector<size_t>& bucket = buckets[b];
+        if (bucket.empty())
+            break;
+
+        for (boost::uint32_t seed=1;; ++seed)
+        {
+            if (seed == 0)
+                throw runtime_error("[buildPerfectHash] unable to place bucket");
+
+            vector<size_t> bucketSlots;
+            BOOST_FOREACH(size_t key, bucket)
+            {
+                size_t slot = cvidHash(keys[key], seed) % slotCount;
+                if (slots[slot] != keys.size() || find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end())
+                    break;
+                bucketSlots.push_back(slot);
+            }
+            if (bucketSlots.size() < bucket.size())
+                continue;
+
+            displacements[b] = seed;
+            for (size_t i=0; i < bucket.size(); ++i)
+                slots[bucketSlots[i]] = bucket[i];
+            break;
+        }
+    }
+}
+
+
 // OBO format can use C-style escape characters; these need to be escaped when writing a quoted string
 string escape_copy(const string& str)
 {
@@ -135,6 +216,17 @@ string escape_copy(const string& str)
 vector< map<Term::id_type, const Term*> > termMaps;
 vector< map<Term::id_type, string> > correctedEnumNameMaps;
 
+
+void addIsAAncestors(const map<Term::id_type, const Term*>& termMap, Term::id_type id, set<Term::id_type>& ancestors)
+{
+    map<Term::id_type, const Term*>::const_iterator itr = termMap.find(id);
+    if (itr == termMap.end())
+        return;
+    BOOST_FOREACH(Term::id_type parent, itr->second->parentsIsA)
+        if (ancestors.insert(parent).second)
+            addIsAAncestors(termMap, parent, ancestors);
+}
+
 void writeHpp(const vector<OBO>& obos, const string& basename, const bfs::path& outputDir)
 {
     string filename = basename + ".hpp";
@@ -271,12 +363,30 @@ void writeCpp(const vector<OBO>& obos, const string& basename, const bfs::path&
        << "#include \"" << basename << ".hpp\"\n"
        << "#include \"pwiz/utility/misc/Std.hpp\"\n"
        << "#include \"pwiz/utility/misc/Singleton.hpp\"\n"
+       << "#include \"pwiz/utility/misc/Once.hpp\"\n"
+       << "#include <boost/cstdint.hpp>\n"
+       << "#include <boost/bind.hpp>\n"
        << "\n\n";
 
     namespaceBegin(os, basename);
 
     os << "namespace {\n\n\n";
 
+    // index of each term in termInfos_ (after CVID_Unknown), and the number of entries each term has
+    // in each of the relation arrays, for the offsets in termRelations_
+    enum {IsA, PartOf, Other, ExactSynonym, PropertyValue, IsAClosure, RelationCount};
+    vector< map<Term::id_type, size_t> > termIndexes(obos.size());
+    vector<string> termEnumNames(1, "CVID_Unknown");
+    vector<boost::uint32_t> termCVIDs(1, (boost::uint32_t) -1);
+    for (vector<OBO>::const_iterator obo=obos.begin(); obo!=obos.end(); ++obo)
+    BOOST_FOREACH(const Term& term, obo->terms)
+    {
+        termIndexes[obo-obos.begin()][term.id] = termEnumNames.size();
+        termEnumNames.push_back(correctedEnumNameMaps[obo-obos.begin()][term.id]);
+        termCVIDs.push_back((boost::uint32_t) enumValue(term, obo-obos.begin()));
+    }
+    vector< vector<size_t> > relationCounts(RelationCount, vector<size_t>(termEnumNames.size(), 0));
+
     os << "struct TermInfo\n"
           "{\n"
           "    CVID cvid;\n"
@@ -318,8 +428,11 @@ void writeCpp(const vector<OBO>& obos, const string& basename, const bfs::path&
     for (vector<OBO>::const_iterator obo=obos.begin(); obo!=obos.end(); ++obo)
     BOOST_FOREACH(const Term& term, obo->terms)
     BOOST_FOREACH(const Term::id_type& id, term.parentsIsA)
+    {
         os << "    {" << correctedEnumNameMaps[obo-obos.begin()][term.id] << ", "
            << correctedEnumNameMaps[obo-obos.begin()][id] << "},\n";
+        ++relationCounts[IsA][termIndexes[obo-obos.begin()][term.id]];
+    }
     os << "}; // relationsIsA_\n\n\n";
 
     os << "const size_t relationsIsASize_ = sizeof(relationsIsA_)/sizeof(CVIDPair);\n\n\n";
@@ -328,8 +441,11 @@ void writeCpp(const vector<OBO>& obos, const string& basename, const bfs::path&
     for (vector<OBO>::const_iterator obo=obos.begin(); obo!=obos.end(); ++obo)
     BOOST_FOREACH(const Term& term, obo->terms)
     BOOST_FOREACH(const Term::id_type& id, term.parentsPartOf)
+    {
         os << "    {" << correctedEnumNameMaps[obo-obos.begin()][term.id] << ", "
            << correctedEnumNameMaps[obo-obos.begin()][id] << "},\n";
+        ++relationCounts[PartOf][termIndexes[obo-obos.begin()][term.id]];
+    }
     os << "}; // relationsPartOf_\n\n\n";
 
     os << "const size_t relationsPartOfSize_ = sizeof(relationsPartOf_)/sizeof(CVIDPair);\n\n\n";
@@ -345,6 +461,7 @@ void writeCpp(const vector<OBO>& obos, const string& basename, const bfs::path&
     os << "OtherRelationPair relationsOther_[] =\n"
        << "{\n"
        << "    {CVID_Unknown, \"Unknown\", CVID_Unknown},\n";
+    ++relationCounts[Other][0];
     for (vector<OBO>::const_iterator obo=obos.begin(); obo!=obos.end(); ++obo)
     BOOST_FOREACH(const Term& term, obo->terms)
     for (Term::relation_map::const_iterator jt=term.relations.begin(); jt!=term.relations.end(); ++jt)
@@ -370,8 +487,11 @@ void writeCpp(const vector<OBO>& obos, const string& basename, const bfs::path&
                 cerr << "[writeCpp] Warning: unable to find object of term relationship for term \"" << term.name << "\"." << endl;
         }
         else
+        {
             os << "    {" << correctedEnumNameMaps[obo-obos.begin()][term.id] << ", "
                << "\"" << jt->first << "\", " << correctedEnumNameMaps[obo2-obos.begin()][relatedTerm->id] << "},\n";
+            ++relationCounts[Other][termIndexes[obo-obos.begin()][term.id]];
+        }
     }
     os << "}; // relationsOther_\n\n\n";
 
@@ -387,10 +507,14 @@ void writeCpp(const vector<OBO>& obos, const string& basename, const bfs::path&
     os << "CVIDStringPair relationsExactSynonym_[] =\n"
           "{\n"
           "    {CVID_Unknown, \"Unknown\"},\n";
+    ++relationCounts[ExactSynonym][0];
     for (vector<OBO>::const_iterator obo=obos.begin(); obo!=obos.end(); ++obo)
     BOOST_FOREACH(const Term& term, obo->terms)
     BOOST_FOREACH(const string& synonym, term.exactSynonyms)
+    {
         os << "    {" << correctedEnumNameMaps[obo-obos.begin()][term.id] << ", \"" << synonym << "\"},\n";
+        ++relationCounts[ExactSynonym][termIndexes[obo-obos.begin()][term.id]];
+    }
     os << "}; // relationsExactSynonym_\n\n\n";
 
     os << "const size_t relationsExactSynonymSize_ = sizeof(relationsExactSynonym_)/sizeof(CVIDStringPair);\n\n\n";
@@ -409,6 +533,7 @@ void writeCpp(const vector<OBO>& obos, const string& basename, const bfs::path&
     os << "PropertyValuePair propertyValue_[] =\n"
           "{\n"
           "    {CVID_Unknown, \"Unknown\", \"Unknown\"},\n";
+    ++relationCounts[PropertyValue][0];
     for (vector<OBO>::const_iterator obo=obos.begin(); obo!=obos.end(); ++obo)
     {
         if (obo->prefix != "UNIMOD") // we currently only use UNIMOD properties
@@ -428,42 +553,83 @@ void writeCpp(const vector<OBO>& obos, const string& basename, const bfs::path&
                           << ", \"" << nameValuePair.first
                           << "\", \"" << nameValuePair.second
                           << "\"},\n";
+            ++relationCounts[PropertyValue][termIndexes[obo-obos.begin()][term.id]];
         }
     }
     os << "}; // propertyValue_\n\n\n";
     os << "const size_t propertyValueSize_ = sizeof(propertyValue_)/sizeof(PropertyValuePair);\n\n\n";
 
+    // the transitive closure of is_a, so cvIsA() is a lookup instead of a walk up the parents
+    os << "// all the IsA ancestors of each term (in termInfos_ order), sorted by CVID\n"
+          "const CVID isAClosure_[] =\n{\n";
+    for (vector<OBO>::const_iterator obo=obos.begin(); obo!=obos.end(); ++obo)
+    BOOST_FOREACH(const Term& term, obo->terms)
+    {
+        set<Term::id_type> ancestors;
+        addIsAAncestors(termMaps[obo-obos.begin()], term.id, ancestors);
+        if (ancestors.empty())
+            continue;
+
+        os << "   ";
+        BOOST_FOREACH(Term::id_type id, ancestors)
+            os << " " << correctedEnumNameMaps[obo-obos.begin()][id] << ",";
+        os << "\n";
+        relationCounts[IsAClosure][termIndexes[obo-obos.begin()][term.id]] = ancestors.size();
+    }
+    os << "}; // isAClosure_\n\n\n";
+
+    os << "struct TermRelations\n"
+          "{\n"
+          "    unsigned int isA, partOf, other, exactSynonym, propertyValue, isAClosure;\n"
+          "};\n\n\n";
+
+    os << "// where each term's entries begin in the relation arrays; they end where the next term's begin\n"
+          "const TermRelations termRelations_[] =\n{\n";
+    vector<size_t> offsets(RelationCount, 0);
+    for (size_t i=0; i <= termEnumNames.size(); ++i)
+    {
+        os << "    {";
+        for (size_t r=0; r < offsets.size(); ++r)
+        {
+            os << (r > 0 ? ", " : "") << offsets[r];
+            if (i < termEnumNames.size())
+                offsets[r] += relationCounts[r][i];
+        }
+        os << "}, // " << (i < termEnumNames.size() ? termEnumNames[i] : "end") << "\n";
+    }
+    os << "}; // termRelations_\n\n\n";
+
+    vector<boost::uint32_t> displacements;
+    vector<size_t> slots;
+    buildPerfectHash(termCVIDs, displacements, slots);
+
+    os << "// CVID -> termInfos_ index: termHashSlots_[cvidHash(cvid, termHashDisplacements_[cvidHash(cvid, 0) % buckets]) % slots]\n"
+       << cvidHashSource_;
+
+    os << "const boost::uint32_t termHashDisplacements_[] =\n{";
+    for (size_t i=0; i < displacements.size(); ++i)
+        os << (i % 16 == 0 ? "\n    " : " ") << displacements[i] << ",";
+    os << "\n}; // termHashDisplacements_\n\n\n";
+
+    os << "const size_t termHashDisplacementsSize_ = sizeof(termHashDisplacements_)/sizeof(boost::uint32_t);\n\n\n";
+
+    os << "// an empty slot has termInfosSize_\n"
+          "const boost::uint32_t termHashSlots_[] =\n{";
+    for (size_t i=0; i < slots.size(); ++i)
+        os << (i % 16 == 0 ? "\n    " : " ") << slots[i] << ",";
+    os << "\n}; // termHashSlots_\n\n\n";
+
+    os << "const size_t termHashSlotsSize_ = sizeof(termHashSlots_)/sizeof(boost::uint32_t);\n\n\n";
+
     os << "class CVTermData : public boost::singleton<CVTermData>\n"
           "{\n"
           "    public:\n"
           "    CVTermData(boost::restricted)\n"
+          "    :   infos_(termInfosSize_), infoInitialized_(termInfosSize_, util::init_once_flag_proxy)\n"
           "    {\n"
+          "        cvids_.reserve(termInfosSize_);\n"
           "        for (const TermInfo* it=termInfos_; it!=termInfos_+termInfosSize_; ++it)\n"
-          "        {\n"
-          "            CVTermInfo temp;\n"
-          "            temp.cvid = it->cvid;\n"
-          "            temp.id = it->id;\n"
-          "            temp.name = it->name;\n"
-          "            temp.def = it->def;\n"
-          "            temp.isObsolete = it->isObsolete;\n"
-          "            infoMap_[temp.cvid] = temp;\n"
           "            cvids_.push_back(it->cvid);\n"
-          "        }\n"
-          "\n"
-          "        for (const CVIDPair* it=relationsIsA_; it!=relationsIsA_+relationsIsASize_; ++it)\n"
-          "            infoMap_[it->first].parentsIsA.push_back(it->second);\n"
-          "\n"
-          "        for (const CVIDPair* it=relationsPartOf_; it!=relationsPartOf_+relationsPartOfSize_; ++it)\n"
-          "            infoMap_[it->first].parentsPartOf.push_back(it->second);\n"
-          "\n"
-          "        for (const OtherRelationPair* it=relationsOther_; it!=relationsOther_+relationsOtherSize_; ++it)\n"
-          "            infoMap_[it->subject].otherRelations.insert(make_pair(it->relation, it->object));\n"
-          "\n"
-          "        for (const CVIDStringPair* it=relationsExactSynonym_; it!=relationsExactSynonym_+relationsExactSynonymSize_; ++it)\n"
-          "            infoMap_[it->first].exactSynonyms.push_back(it->second);\n"
-          "\n"
-          "        for (const PropertyValuePair* it=propertyValue_; it!=propertyValue_+propertyValueSize_; ++it)\n"
-          "            infoMap_[it->term].propertyValues.insert(make_pair(it->name, it->value));\n"
           "\n";
 
     // TODO: is there a way to get these from the OBOs?
@@ -535,12 +701,48 @@ void writeCpp(const vector<OBO>& obos, const string& basename, const bfs::path&
 
     os << "    }\n"
           "\n"
-          "    inline const map<CVID,CVTermInfo>& infoMap() const {return infoMap_;}\n"
+          "    /// the CVTermInfo of the term at termInfos_[index], which is only filled in the first time it is asked for\n"
+          "    inline const CVTermInfo& info(size_t index) const\n"
+          "    {\n"
+          "        boost::call_once(infoInitialized_[index].flag, boost::bind(&CVTermData::initializeInfo, this, index));\n"
+          "        return infos_[index];\n"
+          "    }\n"
+          "\n"
           "    inline const map<string,CV>& cvMap() const {return cvMap_;}\n"
           "    inline const vector<CVID>& cvids() const {return cvids_;}\n"
           "\n"
           "    private:\n"
-          "    map<CVID,CVTermInfo> infoMap_;\n"
+          "    void initializeInfo(size_t index) const\n"
+          "    {\n"
+          "        const TermInfo& term = termInfos_[index];\n"
+          "        const TermRelations& begin = termRelations_[index];\n"
+          "        const TermRelations& end = termRelations_[index+1];\n"
+          "\n"
+          "        CVTermInfo& info = infos_[index];\n"
+          "        info.cvid = term.cvid;\n"
+          "        info.id = term.id;\n"
+          "        info.name = term.name;\n"
+          "        info.def = term.def;\n"
+          "        info.isObsolete = term.isObsolete;\n"
+          "\n"
+          "        for (const CVIDPair* it=relationsIsA_+begin.isA; it!=relationsIsA_+end.isA; ++it)\n"
+          "            info.parentsIsA.push_back(it->second);\n"
+          "\n"
+          "        for (const CVIDPair* it=relationsPartOf_+begin.partOf; it!=relationsPartOf_+end.partOf; ++it)\n"
+          "            info.parentsPartOf.push_back(it->second);\n"
+          "\n"
+          "        for (const OtherRelationPair* it=relationsOther_+begin.other; it!=relationsOther_+end.other; ++it)\n"
+          "            info.otherRelations.insert(make_pair(it->relation, it->object));\n"
+          "\n"
+          "        for (const CVIDStringPair* it=relationsExactSynonym_+begin.exactSynonym; it!=relationsExactSynonym_+end.exactSynonym; ++it)\n"
+          "            info.exactSynonyms.push_back(it->second);\n"
+          "\n"
+          "        for (const PropertyValuePair* it=propertyValue_+begin.propertyValue; it!=propertyValue_+end.propertyValue; ++it)\n"
+          "            info.propertyValues.insert(make_pair(it->name, it->value));\n"
+          "    }\n"
+          "\n"
+          "    mutable vector<CVTermInfo> infos_;\n"
+          "    mutable vector<util::once_flag_proxy> infoInitialized_;\n"
           "    map<string,CV> cvMap_;\n"
           "    vector<CVID> cvids_;\n"
           "};\n\n\n";
@@ -81,6 +81,50 @@ void testIsA()
 }
 
 
+// the old walk up parentsIsA that cvIsA's precomputed closure replaced
+bool isAByWalk(CVID child, CVID parent)
+{
+    if (child == parent) return true;
+    BOOST_FOREACH(CVID p, cvTermInfo(child).parentsIsA)
+        if (isAByWalk(p, parent)) return true;
+    return false;
+}
+
+
+void testAllTerms()
+{
+    const vector<CVID>& allCvids = cvids();
+    unit_assert(allCvids.size() > 4000);
+
+    // every term is found by its CVID and by its accession
+    BOOST_FOREACH(CVID cvid, allCvids)
+    {
+        const CVTermInfo& info = cvTermInfo(cvid);
+        unit_assert_operator_equal(cvid, info.cvid);
+        if (cvid != CVID_Unknown)
+            unit_assert_operator_equal(cvid, cvTermInfo(info.id).cvid);
+    }
+
+    // the closure agrees with the parents, and doesn't have anything more
+    set<CVID> roots;
+    BOOST_FOREACH(CVID cvid, allCvids)
+        if (cvTermInfo(cvid).parentsIsA.empty())
+            roots.insert(cvid);
+    BOOST_FOREACH(CVID cvid, allCvids)
+    {
+        BOOST_FOREACH(CVID parent, cvTermInfo(cvid).parentsIsA)
+            unit_assert(cvIsA(cvid, parent));
+        BOOST_FOREACH(CVID root, roots)
+            unit_assert_operator_equal(isAByWalk(cvid, root), cvIsA(cvid, root));
+    }
+
+    unit_assert(cvIsA((CVID) 42, (CVID) 42));
+    unit_assert_throws(cvTermInfo((CVID) 42), invalid_argument);
+    unit_assert_throws(cvIsA((CVID) 42, MS_m_z), invalid_argument);
+    unit_assert_throws(cvTermInfo("MS:9999999"), out_of_range);
+}
+
+
 void testOtherRelations()
 {
     const CVTermInfo& info = cvTermInfo(MS_accuracy);
@@ -186,6 +230,7 @@ int main(int argc, char* argv[])
         testThreadSafety(4);
         testThreadSafety(8);
         testThreadSafety(16);
+        testAllTerms();
     }
     catch (exception& e)
     {
@@ -60,6 +60,11 @@ struct SequenceIndex
 };
 
 
+// the positions of the SpectrumIdentificationResults of each SpectrumIdentificationList,
+// when they are skipped to be read one at a time
+typedef vector< vector<boost::iostreams::stream_offset> > ResultOffsets;
+
+
 // convenience to support attribute name changes between schema versions
 namespace {
 
@@ -4106,10 +4111,14 @@ PWIZ_API_DECL void write(minimxml::XMLWriter& writer, const SpectrumIdentificati
 struct HandlerSpectrumIdentificationList : public HandlerIdentifiableParamContainer
 {
     SpectrumIdentificationList* silp;
+
+    // if set, the results are skipped and their positions are added to it instead
+    vector<stream_offset>* resultOffsets;
+
     HandlerSpectrumIdentificationList(SequenceIndex& sequenceIndex,
                                       SpectrumIdentificationList* _silp = 0,
                                       const IterationListenerRegistry* iterationListenerRegistry = 0)
-    : silp(_silp), ilr_(iterationListenerRegistry), handlerSpectrumIdentificationResult_(sequenceIndex)
+    : silp(_silp), resultOffsets(0), ilr_(iterationListenerRegistry), handlerSpectrumIdentificationResult_(sequenceIndex)
     {}
 
     virtual Status startElement(const string& name, 
@@ -4142,9 +4151,15 @@ struct HandlerSpectrumIdentificationList : public HandlerIdentifiableParamContai
         }
         else if (name == "SpectrumIdentificationResult")
         {
-            if (ilr_ && ilr_->broadcastUpdateMessage(IterationListener::UpdateMessage(silp->spectrumIdentificationResult.size(), 0, "reading spectrum identification results")) == IterationListener::Status_Cancel)
+            if (ilr_ && ilr_->broadcastUpdateMessage(IterationListener::UpdateMessage(resultCount(), 0, "reading spectrum identification results")) == IterationListener::Status_Cancel)
                 return Status::Done;
 
+            if (resultOffsets)
+            {
+                resultOffsets->push_back(position);
+                return Status(Status::Delegate, &handlerIgnore_);
+            }
+
             SpectrumIdentificationResultPtr sirp(new SpectrumIdentificationResult());
             silp->spectrumIdentificationResult.push_back(sirp);
             handlerSpectrumIdentificationResult_.version = version;
@@ -4157,11 +4172,11 @@ struct HandlerSpectrumIdentificationList : public HandlerIdentifiableParamContai
 
     virtual Status endElement(const string& name,
                               stream_offset position)
-    {
+    {
         // handle final iteration update once final count is known
         if (name == "SpectrumIdentificationList")
-        {
-            if (ilr_ && ilr_->broadcastUpdateMessage(IterationListener::UpdateMessage(silp->spectrumIdentificationResult.size()-1, silp->spectrumIdentificationResult.size(), "reading spectrum identification results")) == IterationListener::Status_Cancel)
+        {
+            if (ilr_ && ilr_->broadcastUpdateMessage(IterationListener::UpdateMessage(resultCount()-1, resultCount(), "reading spectrum identification results")) == IterationListener::Status_Cancel)
                 return Status::Done;
         }
         return Status::Ok;
@@ -4171,6 +4186,9 @@ struct HandlerSpectrumIdentificationList : public HandlerIdentifiableParamContai
     const IterationListenerRegistry* ilr_;
     HandlerMeasure handlerMeasure_;
     HandlerSpectrumIdentificationResult handlerSpectrumIdentificationResult_;
+    SAXParser::Handler handlerIgnore_; // skips a result and everything in it
+
+    size_t resultCount() const {return resultOffsets ? resultOffsets->size() : silp->spectrumIdentificationResult.size();}
 };
 
 
@@ -4212,9 +4230,11 @@ struct HandlerAnalysisData : public SAXParser::Handler
     HandlerAnalysisData(SequenceIndex& sequenceIndex,
                         AnalysisData* _ad = 0,
                         const IterationListenerRegistry* iterationListenerRegistry = 0,
-                        AnalysisDataFlag analysisDataFlag = ReadAnalysisData)
+                        AnalysisDataFlag analysisDataFlag = ReadAnalysisData,
+                        ResultOffsets* resultOffsets = 0)
     : ad(_ad),
       analysisDataFlag(analysisDataFlag),
+      resultOffsets_(resultOffsets),
       handlerSpectrumIdentificationList_(sequenceIndex, 0, iterationListenerRegistry),
       handlerProteinDetectionList_(sequenceIndex)
     {}
@@ -4239,6 +4259,11 @@ struct HandlerAnalysisData : public SAXParser::Handler
             ad->spectrumIdentificationList.push_back(silp);
             handlerSpectrumIdentificationList_.version = version;
             handlerSpectrumIdentificationList_.silp = ad->spectrumIdentificationList.back().get();
+            if (resultOffsets_)
+            {
+                resultOffsets_->push_back(vector<stream_offset>());
+                handlerSpectrumIdentificationList_.resultOffsets = &resultOffsets_->back();
+            }
             return Status(Status::Delegate, &handlerSpectrumIdentificationList_);
         }
         else if (name == "ProteinDetectionList")
@@ -4250,14 +4275,17 @@ struct HandlerAnalysisData : public SAXParser::Handler
                 handlerProteinDetectionList_.pdl = ad->proteinDetectionListPtr.get();
                 return Status(Status::Delegate, &handlerProteinDetectionList_);
             }
+            return Status(Status::Delegate, &handlerIgnore_);
         }
         else
             throw runtime_error("[IO::HandlerAnalysisData] Unexpected element name: " + name);
         return Status::Ok;
     }
     private:
+    ResultOffsets* resultOffsets_;
     HandlerSpectrumIdentificationList handlerSpectrumIdentificationList_;
     HandlerProteinDetectionList handlerProteinDetectionList_;
+    SAXParser::Handler handlerIgnore_; // skips an ignored ProteinDetectionList
 };
 
 
@@ -4294,8 +4322,9 @@ struct HandlerDataCollection : public SAXParser::Handler
     HandlerDataCollection(SequenceIndex& sequenceIndex,
                           DataCollection* _dc = 0,
                           const IterationListenerRegistry* iterationListenerRegistry = 0,
-                          AnalysisDataFlag analysisDataFlag = ReadAnalysisData)
-    : dc(_dc), handlerAnalysisData_(sequenceIndex, 0, iterationListenerRegistry, analysisDataFlag)
+                          AnalysisDataFlag analysisDataFlag = ReadAnalysisData,
+                          ResultOffsets* resultOffsets = 0)
+    : dc(_dc), handlerAnalysisData_(sequenceIndex, 0, iterationListenerRegistry, analysisDataFlag, resultOffsets)
     {}
 
     virtual Status startElement(const string& name, 
@@ -4461,10 +4490,11 @@ struct HandlerIdentData : public HandlerIdentifiable
     HandlerIdentData(IdentData* _mzid = 0,
                      const IterationListenerRegistry* iterationListenerRegistry = 0,
                      SequenceCollectionFlag sequenceCollectionFlag = ReadSequenceCollection,
-                     AnalysisDataFlag analysisDataFlag = ReadAnalysisData)
+                     AnalysisDataFlag analysisDataFlag = ReadAnalysisData,
+                     ResultOffsets* resultOffsets = 0)
     : mzid(_mzid),
       handlerSequenceCollection_(sequenceIndex, 0, iterationListenerRegistry, sequenceCollectionFlag),
-      handlerDataCollection_(sequenceIndex, 0, iterationListenerRegistry, analysisDataFlag)
+      handlerDataCollection_(sequenceIndex, 0, iterationListenerRegistry, analysisDataFlag, resultOffsets)
     {}
 
     virtual Status startElement(const string& name, 
@@ -4614,6 +4644,77 @@ PWIZ_API_DECL void read(std::istream& is, IdentData& mzid,
     References::resolve(mzid); 
 }
 
+
+namespace {
+
+class SpectrumIdentificationResultSource : public SpectrumIdentificationResultIterator::Source
+{
+    public:
+
+    SpectrumIdentificationResultSource(shared_ptr<istream> is, IdentData& mzid,
+                                       const IterationListenerRegistry* iterationListenerRegistry)
+    :   is_(is), mzid_(mzid), listIndex_(0), resultIndex_(0)
+    {
+        HandlerIdentData handler(&mzid, iterationListenerRegistry, ReadSequenceCollection, IgnoreProteinDetectionList, &resultOffsets_);
+        SAXParser::parse(*is, handler);
+
+        fixCVList(mzid.cvs);
+        References::resolve(mzid);
+
+        // keep the index of the sequence collection for resolving the results' references
+        sequenceIndex_.dbSequences.swap(handler.sequenceIndex.dbSequences);
+        sequenceIndex_.peptides.swap(handler.sequenceIndex.peptides);
+        sequenceIndex_.peptideEvidence.swap(handler.sequenceIndex.peptideEvidence);
+        version_ = handler.version;
+    }
+
+    virtual SpectrumIdentificationResultPtr next(SpectrumIdentificationListPtr& list)
+    {
+        while (listIndex_ < resultOffsets_.size() && resultIndex_ == resultOffsets_[listIndex_].size())
+        {
+            ++listIndex_;
+            resultIndex_ = 0;
+        }
+
+        if (listIndex_ == resultOffsets_.size())
+            return SpectrumIdentificationResultPtr();
+
+        list = mzid_.dataCollection.analysisData.spectrumIdentificationList[listIndex_];
+        SpectrumIdentificationResultPtr sir(new SpectrumIdentificationResult);
+
+        is_->clear();
+        is_->seekg(boost::iostreams::offset_to_position(resultOffsets_[listIndex_][resultIndex_++]));
+
+        HandlerSpectrumIdentificationResult handler(sequenceIndex_, sir.get());
+        handler.version = version_;
+        SAXParser::parse(*is_, handler);
+
+        // only the ProteinDetectionList refers to the items, and it isn't read
+        sequenceIndex_.spectrumIdentificationItems.clear();
+
+        References::resolve(*sir, *list, mzid_);
+        return sir;
+    }
+
+    private:
+    shared_ptr<istream> is_;
+    IdentData& mzid_;
+    SequenceIndex sequenceIndex_;
+    int version_;
+    ResultOffsets resultOffsets_;
+    size_t listIndex_, resultIndex_;
+};
+
+} // namespace
+
+
+PWIZ_API_DECL void read(shared_ptr<istream> is, IdentData& mzid,
+                        SpectrumIdentificationResultIterator::SourcePtr& results,
+                        const IterationListenerRegistry* iterationListenerRegistry)
+{
+    results.reset(new SpectrumIdentificationResultSource(is, mzid, iterationListenerRegistry));
+}
+
 } // namespace pwiz 
 } // namespace identdata 
 } // namespace IO 
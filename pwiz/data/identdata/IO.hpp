@@ -25,6 +25,7 @@
 
 #include "pwiz/utility/misc/Export.hpp"
 #include "IdentData.hpp"
+#include "SpectrumIdentificationResultIterator.hpp"
 #include "pwiz/utility/minimxml/XMLWriter.hpp"
 #include "pwiz/utility/misc/IterationListener.hpp"
 
@@ -262,6 +263,13 @@ PWIZ_API_DECL void read(std::istream& is, IdentData& identdata,
                         SequenceCollectionFlag sequenceCollectionFlag = ReadSequenceCollection,
                         AnalysisDataFlag analysisDataFlag = ReadAnalysisData);
 
+/// reads everything but the SpectrumIdentificationResults and the ProteinDetectionList, noting where
+/// each result is; the results are then read from the stream one at a time by the returned source,
+/// which resolves their references into identdata (so identdata must outlive it)
+PWIZ_API_DECL void read(boost::shared_ptr<std::istream> is, IdentData& identdata,
+                        SpectrumIdentificationResultIterator::SourcePtr& results,
+                        const pwiz::util::IterationListenerRegistry* iterationListenerRegistry = 0);
+
 
 } // namespace IO
 
@@ -1221,57 +1221,22 @@ PWIZ_API_DECL std::vector<string> cleavageAgentRegexes(const Enzymes& enzymes)
     return result;
 }
 
-PWIZ_API_DECL void snapModificationsToUnimod(const SpectrumIdentification& si)
+namespace {
+
+MZTolerance precursorTolerance(const SpectrumIdentificationProtocol& sip)
 {
-    const SpectrumIdentificationProtocol& sip = *si.spectrumIdentificationProtocolPtr;
-
     // TODO: what about asymmetric tolerances?
     CVParam precursorToleranceParam = sip.parentTolerance.cvParam(MS_search_tolerance_plus_value);
-    MZTolerance precursorTolerance(precursorToleranceParam.valueAs<double>());
+    MZTolerance tolerance(precursorToleranceParam.valueAs<double>());
     if (precursorToleranceParam.units == UO_parts_per_million)
-        precursorTolerance.units = MZTolerance::PPM;
-
-    BOOST_FOREACH(const SearchModificationPtr& modPtr, sip.modificationParams)
-    {
-        SearchModification& mod = *modPtr;
-        vector<char> residues = mod.residues;
-        if (residues.empty() || (residues.size() == 1 && residues[0] == '.'))
-        {
-            residues.clear();
-            residues.push_back('x');
-        }
-        
-        mod.cvParams.clear();
-        BOOST_FOREACH(char residue, residues)
-        {
-            vector<unimod::Modification> possibleMods = unimod::modifications(mod.massDelta,
-                                                                              0.0001,
-                                                                              boost::logic::indeterminate,
-                                                                              boost::logic::indeterminate,
-                                                                              unimod::site(residue),
-                                                                              unimod::position(mod.specificityRules.cvid));
-
-            BOOST_FOREACH(const unimod::Modification& possibleMod, possibleMods)
-            {
-                // skip AA substitutions
-                if (possibleMod.specificities[0].classification == unimod::Classification::Substitution)
-                    continue;
-                mod.set(possibleMod.cvid);
-            }
-        }
-        if (mod.cvParams.empty())
-            mod.set(MS_unknown_modification);
-    }
-
-    if (!si.spectrumIdentificationListPtr.get())
-        return;
-
-    const SpectrumIdentificationList& sil = *si.spectrumIdentificationListPtr;
+        tolerance.units = MZTolerance::PPM;
+    return tolerance;
+}
 
-    // loop over SIIs instead of Peptides to get access to calculatedMassToCharge without recalculating it
-    set<PeptidePtr> snappedPeptides;
-    BOOST_FOREACH(const SpectrumIdentificationResultPtr& sir, sil.spectrumIdentificationResult)
-    BOOST_FOREACH(const SpectrumIdentificationItemPtr& sii, sir->spectrumIdentificationItem)
+// loop over SIIs instead of Peptides to get access to calculatedMassToCharge without recalculating it
+void snapModificationsToUnimod(const SpectrumIdentificationResult& sir, const MZTolerance& precursorTolerance, set<PeptidePtr>& snappedPeptides)
+{
+    BOOST_FOREACH(const SpectrumIdentificationItemPtr& sii, sir.spectrumIdentificationItem)
     {
         if (!sii->peptidePtr.get())
             throw runtime_error("[identdata::snapModificationsToUnimod] NULL PeptidePtr in " + sii->id);
@@ -1322,6 +1287,61 @@ PWIZ_API_DECL void snapModificationsToUnimod(const SpectrumIdentification& si)
     }
 }
 
+} // namespace
+
+
+PWIZ_API_DECL void snapModificationsToUnimod(const SpectrumIdentification& si)
+{
+    const SpectrumIdentificationProtocol& sip = *si.spectrumIdentificationProtocolPtr;
+
+    BOOST_FOREACH(const SearchModificationPtr& modPtr, sip.modificationParams)
+    {
+        SearchModification& mod = *modPtr;
+        vector<char> residues = mod.residues;
+        if (residues.empty() || (residues.size() == 1 && residues[0] == '.'))
+        {
+            residues.clear();
+            residues.push_back('x');
+        }
+        
+        mod.cvParams.clear();
+        BOOST_FOREACH(char residue, residues)
+        {
+            vector<unimod::Modification> possibleMods = unimod::modifications(mod.massDelta,
+                                                                              0.0001,
+                                                                              boost::logic::indeterminate,
+                                                                              boost::logic::indeterminate,
+                                                                              unimod::site(residue),
+                                                                              unimod::position(mod.specificityRules.cvid));
+
+            BOOST_FOREACH(const unimod::Modification& possibleMod, possibleMods)
+            {
+                // skip AA substitutions
+                if (possibleMod.specificities[0].classification == unimod::Classification::Substitution)
+                    continue;
+                mod.set(possibleMod.cvid);
+            }
+        }
+        if (mod.cvParams.empty())
+            mod.set(MS_unknown_modification);
+    }
+
+    if (!si.spectrumIdentificationListPtr.get())
+        return;
+
+    MZTolerance tolerance = precursorTolerance(sip);
+    set<PeptidePtr> snappedPeptides;
+    BOOST_FOREACH(const SpectrumIdentificationResultPtr& sir, si.spectrumIdentificationListPtr->spectrumIdentificationResult)
+        snapModificationsToUnimod(*sir, tolerance, snappedPeptides);
+}
+
+
+PWIZ_API_DECL void snapModificationsToUnimod(const SpectrumIdentificationResult& sir, const SpectrumIdentificationProtocol& sip,
+                                             set<PeptidePtr>& snappedPeptides)
+{
+    snapModificationsToUnimod(sir, precursorTolerance(sip), snappedPeptides);
+}
+
 
 } // namespace identdata
 } // namespace pwiz
@@ -33,6 +33,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <set>
 
 
 #ifdef USE_RAW_PTR
@@ -1063,6 +1064,11 @@ PWIZ_API_DECL std::vector<std::string> cleavageAgentRegexes(const Enzymes& enzym
 /// sets Unimod CV terms (if possible) for all SearchModifications and Modification elements
 PWIZ_API_DECL void snapModificationsToUnimod(const SpectrumIdentification& si);
 
+/// sets Unimod CV terms (if possible) for the Modification elements of a result's peptides, e.g. one read by itself;
+/// peptides already in snappedPeptides are skipped, and the newly snapped ones are added to it
+PWIZ_API_DECL void snapModificationsToUnimod(const SpectrumIdentificationResult& sir, const SpectrumIdentificationProtocol& sip,
+                                             std::set<PeptidePtr>& snappedPeptides);
+
 
 } // namespace identdata 
 } // namespace pwiz 
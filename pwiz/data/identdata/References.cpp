@@ -224,36 +224,39 @@ struct ResolvePE
     }
 };
 
-PWIZ_API_DECL void resolve(SpectrumIdentificationListPtr& sil, IdentData& mzid)
+PWIZ_API_DECL void resolve(SpectrumIdentificationResult& sir, const SpectrumIdentificationList& sil, IdentData& mzid)
 {
-    BOOST_FOREACH(SpectrumIdentificationResultPtr& sir, sil->spectrumIdentificationResult)
-    {
-        if (sir->spectraDataPtr.get())
-            resolve(sir->spectraDataPtr, mzid.dataCollection.inputs.spectraData);
+    if (sir.spectraDataPtr.get())
+        resolve(sir.spectraDataPtr, mzid.dataCollection.inputs.spectraData);
 
-        BOOST_FOREACH(SpectrumIdentificationItemPtr& sii, sir->spectrumIdentificationItem)
-        {
-            resolve(sii->massTablePtr, mzid.analysisProtocolCollection.spectrumIdentificationProtocol);
-            resolve(sii->samplePtr, mzid.analysisSampleCollection.samples);
+    BOOST_FOREACH(SpectrumIdentificationItemPtr& sii, sir.spectrumIdentificationItem)
+    {
+        resolve(sii->massTablePtr, mzid.analysisProtocolCollection.spectrumIdentificationProtocol);
+        resolve(sii->samplePtr, mzid.analysisSampleCollection.samples);
 
-            BOOST_FOREACH(IonTypePtr& it, sii->fragmentation)
-            BOOST_FOREACH(FragmentArrayPtr& fa, it->fragmentArray)
-                resolve(fa->measurePtr, sil->fragmentationTable);
+        BOOST_FOREACH(IonTypePtr& it, sii->fragmentation)
+        BOOST_FOREACH(FragmentArrayPtr& fa, it->fragmentArray)
+            resolve(fa->measurePtr, sil.fragmentationTable);
 
-            if (!mzid.sequenceCollection.empty() &&
-                sii->peptidePtr.get() &&
-                sii->peptidePtr->peptideSequence.empty())
-            {
-                ResolvePE rpe(&mzid);
-                for_each(sii->peptideEvidencePtr.begin(),
-                         sii->peptideEvidencePtr.end(),
-                         rpe);
-                resolve(sii->peptidePtr, mzid.sequenceCollection.peptides);
-            }
+        if (!mzid.sequenceCollection.empty() &&
+            sii->peptidePtr.get() &&
+            sii->peptidePtr->peptideSequence.empty())
+        {
+            ResolvePE rpe(&mzid);
+            for_each(sii->peptideEvidencePtr.begin(),
+                     sii->peptideEvidencePtr.end(),
+                     rpe);
+            resolve(sii->peptidePtr, mzid.sequenceCollection.peptides);
         }
     }
 }
 
+PWIZ_API_DECL void resolve(SpectrumIdentificationListPtr& sil, IdentData& mzid)
+{
+    BOOST_FOREACH(SpectrumIdentificationResultPtr& sir, sil->spectrumIdentificationResult)
+        resolve(*sir, *sil, mzid);
+}
+
 PWIZ_API_DECL void resolve(SpectrumIdentification& si, IdentData& mzid)
 {
     if (si.spectrumIdentificationProtocolPtr.get())
@@ -41,6 +41,9 @@ PWIZ_API_DECL void resolve(AnalysisSampleCollection& asc, IdentData& mzid);
 PWIZ_API_DECL void resolve(std::vector<ContactPtr>& vcp, IdentData& mzid);
 PWIZ_API_DECL void resolve(SequenceCollection& sc, IdentData& mzid);
 
+/// resolves the references of a result, e.g. one read by itself, from the list it belongs to
+PWIZ_API_DECL void resolve(SpectrumIdentificationResult& sir, const SpectrumIdentificationList& sil, IdentData& mzid);
+
 PWIZ_API_DECL void resolve(IdentData& mzid);
 
 } // namespace References
@@ -66,6 +66,19 @@ void Serializer_mzIdentML::read(shared_ptr<istream> is, IdentData& mzid,
              config_.readAnalysisData ? IO::ReadAnalysisData : IO::IgnoreAnalysisData);
 }
 
+
+void Serializer_mzIdentML::read(shared_ptr<istream> is, IdentData& mzid,
+                                SpectrumIdentificationResultIterator::SourcePtr& results,
+                                const pwiz::util::IterationListenerRegistry* iterationListenerRegistry) const
+{
+    if (!is.get() || !*is)
+        throw runtime_error("[Serializer_mzIdentML::read()] Bad istream.");
+
+    is->seekg(0);
+
+    IO::read(is, mzid, results, iterationListenerRegistry);
+}
+
 } // namespace pwiz 
 } // namespace identdata 
 
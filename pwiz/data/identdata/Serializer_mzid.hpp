@@ -26,6 +26,7 @@
 
 #include "pwiz/utility/misc/Export.hpp"
 #include "IdentData.hpp"
+#include "SpectrumIdentificationResultIterator.hpp"
 #include "pwiz/utility/misc/IterationListener.hpp"
 
 
@@ -56,6 +57,12 @@ class PWIZ_API_DECL Serializer_mzIdentML
     void read(boost::shared_ptr<std::istream> is, IdentData& mzid,
               const pwiz::util::IterationListenerRegistry* = 0) const;
 
+    /// read in MZIDData object from a mzIdentML istream, except for the SpectrumIdentificationResults
+    /// and the ProteinDetectionList; the results are then read one at a time from the istream by the source
+    void read(boost::shared_ptr<std::istream> is, IdentData& mzid,
+              SpectrumIdentificationResultIterator::SourcePtr& results,
+              const pwiz::util::IterationListenerRegistry* = 0) const;
+
     private:
     const Config config_;
     Serializer_mzIdentML(Serializer_mzIdentML&);
@@ -1521,13 +1521,23 @@ struct HandlerSearchResults : public SAXParser::Handler
                          bool strict)
     :   _nTerm("H1"),
         _cTerm("O1H1"),
-        siiCount(0), peptideCount(0), spectrumQueryCount(0),
+        siiCount(0), peptideCount(0), spectrumQueryCount(0), removedResultCount(0),
         _cvTranslator(cvTranslator),
         ilr(iterationListenerRegistry),
         strict(strict)
     {
     }
 
+    /// when the results are read one at a time, each one is removed from _sil after it's read
+    /// (and progress is no longer reported)
+    void removeResults()
+    {
+        removedResultCount += _sil->spectrumIdentificationResult.size();
+        _sil->spectrumIdentificationResult.clear();
+        _resultMap.clear();
+        ilr = 0;
+    }
+
     bool setDBSequenceParams(const string& accession,
                              const ParamContainer& params)
     {
@@ -1747,7 +1757,7 @@ struct HandlerSearchResults : public SAXParser::Handler
                 }
 
                 sir.reset(new SpectrumIdentificationResult);
-                sir->id = "SIR_" + lexical_cast<string>(_sil->spectrumIdentificationResult.size()+1);
+                sir->id = "SIR_" + lexical_cast<string>(removedResultCount + _sil->spectrumIdentificationResult.size()+1);
                 sir->spectrumID = spectrumNativeID;
                 sir->name = spectrumWithoutCharge;
                 sir->spectraDataPtr = _mzid->dataCollection.inputs.spectraData[0];
@@ -1788,6 +1798,7 @@ struct HandlerSearchResults : public SAXParser::Handler
     Formula _nTerm, _cTerm;
     boost::xpressive::smatch what;
     int siiCount, peptideCount, spectrumQueryCount;
+    size_t removedResultCount;
     const CVTranslator& _cvTranslator;
     const IterationListenerRegistry* ilr;
     bool strict;
@@ -1801,15 +1812,28 @@ struct HandlerSearchResults : public SAXParser::Handler
 };
 
 
+// where each spectrum_query is, and whether it's for the same spectrum as the one before it (i.e. another charge state)
+struct SpectrumQueryIndex
+{
+    vector<stream_offset> offsets;
+    vector<bool> continuesResult;
+    string lastSpectrum;
+};
+
+
 struct Handler_pepXML : public SAXParser::Handler
 {
     IdentData& mzid;
 
+    // if set, the spectrum queries are skipped and their positions are added to it instead
+    SpectrumQueryIndex* spectrumQueryIndex;
+
     Handler_pepXML(IdentData& mzid,
                    bool readSpectrumQueries,
                    const IterationListenerRegistry* iterationListenerRegistry,
                    bool strict)
     :   mzid(mzid),
+        spectrumQueryIndex(0),
         handlerSampleEnzyme(cvTranslator, strict),
         handlerSearchSummary(cvTranslator, strict),
         handlerSearchResults(cvTranslator, iterationListenerRegistry, strict),
@@ -1937,6 +1961,23 @@ struct Handler_pepXML : public SAXParser::Handler
 
             mzid.dataCollection.inputs.spectraData[0]->spectrumIDFormat.cvid = nativeIdFormat;
 
+            if (spectrumQueryIndex)
+            {
+                if (ilr && ilr->broadcastUpdateMessage(IterationListener::UpdateMessage(spectrumQueryIndex->offsets.size(), 0, "reading spectrum queries")) == IterationListener::Status_Cancel)
+                    return Status::Done;
+
+                string spectrum;
+                getAttribute(attributes, "spectrum", spectrum);
+                string spectrumWithoutCharge = stripChargeFromConventionalSpectrumId(spectrum);
+
+                spectrumQueryIndex->continuesResult.push_back(!spectrumQueryIndex->offsets.empty() && spectrumWithoutCharge == spectrumQueryIndex->lastSpectrum);
+                spectrumQueryIndex->offsets.push_back(position);
+                spectrumQueryIndex->lastSpectrum.swap(spectrumWithoutCharge);
+
+                handlerSearchResults.nativeIdFormat = nativeIdFormat;
+                return Status(Status::Delegate, &handlerIgnore);
+            }
+
             if (readSpectrumQueries)
             {
                 handlerSearchResults.nativeIdFormat = nativeIdFormat;
@@ -1951,11 +1992,23 @@ struct Handler_pepXML : public SAXParser::Handler
         return Status::Ok;
     }
 
+    /// reads the spectrum_query at the given position into the SpectrumIdentificationList
+    void readSpectrumQuery(istream& is, stream_offset position)
+    {
+        is.clear();
+        is.seekg(boost::iostreams::offset_to_position(position));
+        SAXParser::parse(is, handlerSearchResults);
+    }
+
+    /// removes the results read by readSpectrumQuery() from the SpectrumIdentificationList
+    void removeResults() {handlerSearchResults.removeResults();}
+
     private:
     CVTranslator cvTranslator;
     HandlerSampleEnzyme handlerSampleEnzyme;
     HandlerSearchSummary handlerSearchSummary;
     HandlerSearchResults handlerSearchResults;
+    SAXParser::Handler handlerIgnore; // skips an indexed spectrum_query
 
     bool readSpectrumQueries;
     const IterationListenerRegistry* ilr;
@@ -1993,6 +2046,77 @@ PWIZ_API_DECL void Serializer_pepXML::read(boost::shared_ptr<std::istream> is, I
 }
 
 
+namespace {
+
+class SpectrumIdentificationResultSource : public SpectrumIdentificationResultIterator::Source
+{
+    public:
+
+    SpectrumIdentificationResultSource(shared_ptr<istream> is, IdentData& mzid,
+                                       const IterationListenerRegistry* iterationListenerRegistry)
+    :   is_(is), handler_(mzid, true, iterationListenerRegistry, false), nextQuery_(0)
+    {
+        handler_.spectrumQueryIndex = &index_;
+        SAXParser::parse(*is, handler_);
+        index_.lastSpectrum.clear();
+
+        si_ = mzid.analysisCollection.spectrumIdentification[0];
+        snapModificationsToUnimod(*si_);
+        handler_.removeResults();
+    }
+
+    virtual SpectrumIdentificationResultPtr next(SpectrumIdentificationListPtr& list)
+    {
+        SpectrumIdentificationList& sil = *si_->spectrumIdentificationListPtr;
+
+        // the charge states of a spectrum are consecutive spectrum queries; the queries without hits don't make a result
+        while (sil.spectrumIdentificationResult.empty() && nextQuery_ < index_.offsets.size())
+        {
+            do
+                handler_.readSpectrumQuery(*is_, index_.offsets[nextQuery_++]);
+            while (nextQuery_ < index_.offsets.size() && index_.continuesResult[nextQuery_]);
+
+            if (sil.spectrumIdentificationResult.empty())
+                handler_.removeResults();
+        }
+
+        if (sil.spectrumIdentificationResult.empty())
+            return SpectrumIdentificationResultPtr();
+
+        SpectrumIdentificationResultPtr sir = sil.spectrumIdentificationResult[0];
+        handler_.removeResults();
+
+        // results share peptides, so each one is only snapped the first time it's returned
+        snapModificationsToUnimod(*sir, *si_->spectrumIdentificationProtocolPtr, snappedPeptides_);
+        list = si_->spectrumIdentificationListPtr;
+        return sir;
+    }
+
+    private:
+    shared_ptr<istream> is_;
+    Handler_pepXML handler_;
+    SpectrumQueryIndex index_;
+    size_t nextQuery_;
+    SpectrumIdentificationPtr si_;
+    set<PeptidePtr> snappedPeptides_;
+};
+
+} // namespace
+
+
+PWIZ_API_DECL void Serializer_pepXML::read(boost::shared_ptr<std::istream> is, IdentData& mzid,
+                                           SpectrumIdentificationResultIterator::SourcePtr& results,
+                                           const pwiz::util::IterationListenerRegistry* iterationListenerRegistry) const
+{
+    if (!is.get() || !*is)
+        throw runtime_error("[Serializer_pepXML::read()] Bad istream.");
+
+    is->seekg(0);
+
+    results.reset(new SpectrumIdentificationResultSource(is, mzid, iterationListenerRegistry));
+}
+
+
 namespace {
   
 const string allResidues = "ABCDEFGHIJKLMNOPQRSTUVWYZ";
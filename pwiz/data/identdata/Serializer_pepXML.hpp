@@ -25,6 +25,7 @@
 
 #include "pwiz/utility/misc/Export.hpp"
 #include "IdentData.hpp"
+#include "SpectrumIdentificationResultIterator.hpp"
 #include "pwiz/utility/misc/IterationListener.hpp"
 
 
@@ -55,6 +56,14 @@ class PWIZ_API_DECL Serializer_pepXML
     void read(boost::shared_ptr<std::istream> is, IdentData& mzid,
               const pwiz::util::IterationListenerRegistry* = 0) const;
 
+    /// read in MZIDData object from a pepXML istream, except for the spectrum queries, which are then
+    /// read one at a time from the istream by the source; since pepXML has no sequence collection,
+    /// the peptides are added to mzid as they are read, and the charge states of a spectrum
+    /// are merged into one result only when their spectrum queries are consecutive
+    void read(boost::shared_ptr<std::istream> is, IdentData& mzid,
+              SpectrumIdentificationResultIterator::SourcePtr& results,
+              const pwiz::util::IterationListenerRegistry* = 0) const;
+
     private:
     const Config config_;
     Serializer_pepXML(Serializer_pepXML&);
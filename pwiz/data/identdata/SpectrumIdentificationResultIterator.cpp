@@ -0,0 +1,176 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#define PWIZ_SOURCE
+
+#include "SpectrumIdentificationResultIterator.hpp"
+#include "Serializer_mzid.hpp"
+#include "Serializer_pepXML.hpp"
+#include "pwiz/utility/minimxml/SAXParser.hpp"
+#include "pwiz/utility/misc/Filesystem.hpp"
+#include "pwiz/utility/misc/Std.hpp"
+
+
+namespace pwiz {
+namespace identdata {
+
+
+using namespace pwiz::util;
+using namespace pwiz::minimxml;
+
+
+class SpectrumIdentificationResultIterator::Impl
+{
+    public:
+
+    Impl(const string& filename, const IterationListenerRegistry* iterationListenerRegistry)
+    :   identData_(new IdentData), atEnd_(false)
+    {
+        shared_ptr<istream> is(new random_access_compressed_ifstream(filename.c_str()));
+        if (!is.get() || !*is)
+            throw runtime_error("[SpectrumIdentificationResultIterator] Unable to open file " + filename);
+
+        // mzIdentML 1.0 root is "mzIdentML", 1.1 root is "MzIdentML"
+        string rootElement = xml_root_element(read_file_header(filename, 512));
+        if (bal::iequals(rootElement, "MzIdentML"))
+            Serializer_mzIdentML().read(is, *identData_, source_, iterationListenerRegistry);
+        else if (rootElement == "msms_pipeline_analysis")
+            Serializer_pepXML().read(is, *identData_, source_, iterationListenerRegistry);
+        else
+            throw runtime_error("[SpectrumIdentificationResultIterator] Unsupported file format: " + filename);
+
+        preincrement();
+    }
+
+    Impl(const IdentDataPtr& identData, const SourcePtr& source)
+    :   identData_(identData), source_(source), atEnd_(false)
+    {
+        if (!identData_.get() || !source_.get())
+            throw runtime_error("[SpectrumIdentificationResultIterator] Null IdentData or Source.");
+
+        preincrement();
+    }
+
+    void preincrement()
+    {
+        if (atEnd())
+            throw runtime_error("[SpectrumIdentificationResultIterator] Increment past the end.");
+
+        SpectrumIdentificationListPtr list;
+        result_ = source_->next(list);
+        if (result_.get())
+            list_ = list;
+        else
+        {
+            list_.reset();
+            atEnd_ = true;
+        }
+    }
+
+    bool atEnd() const {return atEnd_;}
+
+    const IdentData& identData() const {return *identData_;}
+    const SpectrumIdentificationListPtr& list() const {return list_;}
+    const SpectrumIdentificationResultPtr& result() const {return result_;}
+
+    private:
+
+    // declared before the source, which refers to it
+    IdentDataPtr identData_;
+    SourcePtr source_;
+    SpectrumIdentificationListPtr list_;
+    SpectrumIdentificationResultPtr result_;
+    bool atEnd_;
+};
+
+
+PWIZ_API_DECL SpectrumIdentificationResultIterator::SpectrumIdentificationResultIterator()
+{}
+
+
+PWIZ_API_DECL SpectrumIdentificationResultIterator::SpectrumIdentificationResultIterator(const string& filename,
+                                                                                         const IterationListenerRegistry* iterationListenerRegistry)
+:   impl_(new Impl(filename, iterationListenerRegistry))
+{}
+
+
+PWIZ_API_DECL SpectrumIdentificationResultIterator::SpectrumIdentificationResultIterator(const IdentDataPtr& identData, const SourcePtr& source)
+:   impl_(new Impl(identData, source))
+{}
+
+
+PWIZ_API_DECL SpectrumIdentificationResultIterator::SpectrumIdentificationResultIterator(const SpectrumIdentificationResultIterator& that)
+:   impl_(that.impl_)
+{}
+
+
+PWIZ_API_DECL const IdentData& SpectrumIdentificationResultIterator::identData() const
+{
+    if (!impl_.get())
+        throw runtime_error("[SpectrumIdentificationResultIterator::identData()] No IdentData for the past-the-end marker.");
+    return impl_->identData();
+}
+
+
+PWIZ_API_DECL const SpectrumIdentificationListPtr& SpectrumIdentificationResultIterator::spectrumIdentificationList() const
+{
+    if (!impl_.get() || impl_->atEnd())
+        throw runtime_error("[SpectrumIdentificationResultIterator::spectrumIdentificationList()] No current result.");
+    return impl_->list();
+}
+
+
+PWIZ_API_DECL SpectrumIdentificationResultIterator& SpectrumIdentificationResultIterator::operator++()
+{
+    if (!impl_.get())
+        throw runtime_error("[SpectrumIdentificationResultIterator] Increment past the end.");
+    impl_->preincrement();
+    return *this;
+}
+
+
+PWIZ_API_DECL const SpectrumIdentificationResultPtr& SpectrumIdentificationResultIterator::operator*() const
+{
+    if (!impl_.get() || impl_->atEnd())
+        throw runtime_error("[SpectrumIdentificationResultIterator] Dereferencing the past-the-end iterator.");
+    return impl_->result();
+}
+
+
+PWIZ_API_DECL const SpectrumIdentificationResult* SpectrumIdentificationResultIterator::operator->() const {return (**this).get();}
+
+
+PWIZ_API_DECL bool SpectrumIdentificationResultIterator::operator==(const SpectrumIdentificationResultIterator& that) const
+{
+    bool atEnd = !impl_.get() || impl_->atEnd();
+    bool thatAtEnd = !that.impl_.get() || that.impl_->atEnd();
+    if (atEnd || thatAtEnd)
+        return atEnd && thatAtEnd;
+    return impl_ == that.impl_;
+}
+
+
+PWIZ_API_DECL bool SpectrumIdentificationResultIterator::operator!=(const SpectrumIdentificationResultIterator& that) const {return !(*this == that);}
+
+
+} // namespace identdata
+} // namespace pwiz
@@ -0,0 +1,120 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#ifndef _SPECTRUMIDENTIFICATIONRESULTITERATOR_HPP_
+#define _SPECTRUMIDENTIFICATIONRESULTITERATOR_HPP_
+
+
+#include "pwiz/utility/misc/Export.hpp"
+#include "IdentData.hpp"
+#include "pwiz/utility/misc/IterationListener.hpp"
+
+
+namespace pwiz {
+namespace identdata {
+
+
+///
+/// SpectrumIdentificationResultIterator reads the SpectrumIdentificationResults of an mzIdentML
+/// or pepXML file one at a time, so that a file can be processed without holding all of its results in memory.
+///
+/// The constructor reads the rest of the file into identData(): everything but the results and the
+/// ProteinDetectionList. Each result's references (e.g. to its Peptides and PeptideEvidences) are resolved
+/// into identData(), whose SpectrumIdentificationLists stay empty.
+///
+/// Its behavior is similar to istream_iterator.  In particular:
+/// - the default constructed SpectrumIdentificationResultIterator() is a past-the-end marker
+/// - preincrement reads the next result; a SpectrumIdentificationResultPtr to the current one stays valid
+/// - copies share the underlying file, so incrementing one advances them all
+///
+class PWIZ_API_DECL SpectrumIdentificationResultIterator
+{
+    public:
+
+    /// interface for reading the results of a particular format one at a time
+    class PWIZ_API_DECL Source
+    {
+        public:
+
+        /// returns the next result and sets the list it belongs to, or returns null after the last result
+        virtual SpectrumIdentificationResultPtr next(SpectrumIdentificationListPtr& list) = 0;
+
+        virtual ~Source() {}
+    };
+
+    typedef boost::shared_ptr<Source> SourcePtr;
+
+    /// special default object for marking past-the-end
+    SpectrumIdentificationResultIterator();
+
+    /// opens an mzIdentML or pepXML file and reads everything but its results
+    SpectrumIdentificationResultIterator(const std::string& filename,
+                                         const pwiz::util::IterationListenerRegistry* iterationListenerRegistry = 0);
+
+    /// iterates the results of a source, e.g. from Serializer_mzIdentML::read(), which were resolved into identData
+    SpectrumIdentificationResultIterator(const IdentDataPtr& identData, const SourcePtr& source);
+
+    /// copy constructor
+    SpectrumIdentificationResultIterator(const SpectrumIdentificationResultIterator&);
+
+    /// the file's metadata, sequence collection and (empty) SpectrumIdentificationLists
+    const IdentData& identData() const;
+
+    /// the SpectrumIdentificationList the current result belongs to
+    const SpectrumIdentificationListPtr& spectrumIdentificationList() const;
+
+    /// \name input iterator interface
+    //@{
+    SpectrumIdentificationResultIterator& operator++();
+    const SpectrumIdentificationResultPtr& operator*() const;
+    const SpectrumIdentificationResult* operator->() const;
+    bool operator==(const SpectrumIdentificationResultIterator& that) const;
+    bool operator!=(const SpectrumIdentificationResultIterator& that) const;
+    //@}
+
+    /// \name standard iterator typedefs
+    //@{
+    typedef std::input_iterator_tag iterator_category;
+    typedef SpectrumIdentificationResultPtr value_type;
+    typedef int difference_type;
+    typedef const value_type* pointer;
+    typedef const value_type& reference;
+    //@}
+
+    private:
+
+    class Impl;
+    boost::shared_ptr<Impl> impl_;
+
+    /// no copying
+    SpectrumIdentificationResultIterator& operator=(const SpectrumIdentificationResultIterator&);
+
+    /// don't do this -- avoid temporary copy
+    SpectrumIdentificationResultIterator operator++(int);
+};
+
+
+} // namespace identdata
+} // namespace pwiz
+
+
+#endif // _SPECTRUMIDENTIFICATIONRESULTITERATOR_HPP_
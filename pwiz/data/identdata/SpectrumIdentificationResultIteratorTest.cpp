@@ -0,0 +1,214 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#include "SpectrumIdentificationResultIterator.hpp"
+#include "Serializer_mzid.hpp"
+#include "Serializer_pepXML.hpp"
+#include "Diff.hpp"
+#include "examples.hpp"
+#include "pwiz/utility/misc/unit.hpp"
+#include "pwiz/utility/misc/Std.hpp"
+#include "pwiz/utility/misc/Filesystem.hpp"
+
+
+using namespace pwiz::identdata;
+using namespace pwiz::util;
+
+
+ostream* os_ = 0;
+
+
+// the results read one at a time are the same as the results read all at once
+void testResults(const IdentData& expected, SpectrumIdentificationResultIterator& it)
+{
+    const IdentData& mzid = it.identData();
+    unit_assert_operator_equal(expected.dataCollection.analysisData.spectrumIdentificationList.size(),
+                               mzid.dataCollection.analysisData.spectrumIdentificationList.size());
+
+    // the lists and the sequence collection are read, but not the results or the ProteinDetectionList
+    BOOST_FOREACH(const SpectrumIdentificationListPtr& sil, mzid.dataCollection.analysisData.spectrumIdentificationList)
+        unit_assert(sil->spectrumIdentificationResult.empty());
+    unit_assert(!mzid.dataCollection.analysisData.proteinDetectionListPtr.get());
+
+    BOOST_FOREACH(const SpectrumIdentificationListPtr& sil, expected.dataCollection.analysisData.spectrumIdentificationList)
+    BOOST_FOREACH(const SpectrumIdentificationResultPtr& sir, sil->spectrumIdentificationResult)
+    {
+        unit_assert(it != SpectrumIdentificationResultIterator());
+        if (os_) *os_ << sil->id << " " << it->id << " " << it->spectrumID << endl;
+
+        unit_assert_operator_equal(sil->id, it.spectrumIdentificationList()->id);
+
+        Diff<SpectrumIdentificationResult, DiffConfig> diff(*sir, **it);
+        if (os_ && diff) *os_ << diff << endl;
+        unit_assert(!diff);
+
+        // references are resolved to the IdentData the iterator read
+        BOOST_FOREACH(const SpectrumIdentificationItemPtr& sii, (*it)->spectrumIdentificationItem)
+        {
+            unit_assert(find(mzid.sequenceCollection.peptides.begin(), mzid.sequenceCollection.peptides.end(), sii->peptidePtr) != mzid.sequenceCollection.peptides.end());
+            BOOST_FOREACH(const PeptideEvidencePtr& pe, sii->peptideEvidencePtr)
+                unit_assert(find(mzid.sequenceCollection.peptideEvidence.begin(), mzid.sequenceCollection.peptideEvidence.end(), pe) != mzid.sequenceCollection.peptideEvidence.end());
+        }
+
+        ++it;
+    }
+
+    unit_assert(it == SpectrumIdentificationResultIterator());
+    unit_assert_throws(++it, runtime_error);
+
+    // pepXML's peptides are added as their results are read
+    unit_assert_operator_equal(expected.sequenceCollection.peptides.size(), mzid.sequenceCollection.peptides.size());
+}
+
+
+void testMzIdentML()
+{
+    if (os_) *os_ << "testMzIdentML" << endl;
+
+    IdentData tiny;
+    examples::initializeTiny(tiny);
+
+    Serializer_mzIdentML serializer;
+    ostringstream oss;
+    serializer.write(oss, tiny);
+
+    IdentData expected;
+    serializer.read(shared_ptr<istream>(new istringstream(oss.str())), expected);
+
+    IdentDataPtr mzid(new IdentData);
+    SpectrumIdentificationResultIterator::SourcePtr results;
+    serializer.read(shared_ptr<istream>(new istringstream(oss.str())), *mzid, results);
+    SpectrumIdentificationResultIterator it(mzid, results);
+    testResults(expected, it);
+
+    // the file constructor finds the format
+    string filename = "SpectrumIdentificationResultIteratorTest.mzid";
+    ofstream(filename.c_str()) << oss.str();
+    {
+        SpectrumIdentificationResultIterator it2(filename);
+        testResults(expected, it2);
+    }
+    bfs::remove(filename);
+}
+
+
+void testPepXML()
+{
+    if (os_) *os_ << "testPepXML" << endl;
+
+    IdentData basic;
+    examples::initializeBasicSpectrumIdentification(basic);
+
+    Serializer_pepXML serializer;
+    ostringstream oss;
+    serializer.write(oss, basic, "tiny.pepXML");
+
+    IdentData expected;
+    serializer.read(shared_ptr<istream>(new istringstream(oss.str())), expected);
+    unit_assert(!expected.dataCollection.analysisData.spectrumIdentificationList[0]->spectrumIdentificationResult.empty());
+
+    string filename = "SpectrumIdentificationResultIteratorTest.pepXML";
+    ofstream(filename.c_str()) << oss.str();
+    {
+        SpectrumIdentificationResultIterator it(filename);
+        testResults(expected, it);
+    }
+    bfs::remove(filename);
+}
+
+
+// results 2 and 3 of the example share modified peptides, which are only snapped to Unimod when first read
+void testPepXMLSharedPeptides()
+{
+    if (os_) *os_ << "testPepXMLSharedPeptides" << endl;
+
+    IdentData basic;
+    examples::initializeBasicSpectrumIdentification(basic);
+
+    Serializer_pepXML serializer;
+    ostringstream oss;
+    serializer.write(oss, basic, "tiny.pepXML");
+
+    IdentDataPtr mzid(new IdentData);
+    SpectrumIdentificationResultIterator::SourcePtr results;
+    serializer.read(shared_ptr<istream>(new istringstream(oss.str())), *mzid, results);
+
+    set<PeptidePtr> seenPeptides;
+    size_t sharedModifiedPeptides = 0;
+    for (SpectrumIdentificationResultIterator it(mzid, results); it != SpectrumIdentificationResultIterator(); ++it)
+    {
+        set<PeptidePtr> resultPeptides;
+        BOOST_FOREACH(const SpectrumIdentificationItemPtr& sii, (*it)->spectrumIdentificationItem)
+            resultPeptides.insert(sii->peptidePtr);
+
+        BOOST_FOREACH(const PeptidePtr& peptide, resultPeptides)
+        {
+            if (seenPeptides.insert(peptide).second)
+            {
+                // snapped when first read; clear the terms to see if a later result snaps it again
+                BOOST_FOREACH(const ModificationPtr& mod, peptide->modification)
+                {
+                    unit_assert(!mod->cvParams.empty());
+                    mod->cvParams.clear();
+                }
+                continue;
+            }
+
+            if (os_) *os_ << (*it)->id << " shares " << peptide->peptideSequence << endl;
+            if (!peptide->modification.empty())
+                ++sharedModifiedPeptides;
+            BOOST_FOREACH(const ModificationPtr& mod, peptide->modification)
+                unit_assert(mod->cvParams.empty());
+        }
+    }
+    unit_assert(sharedModifiedPeptides > 0);
+}
+
+
+void test()
+{
+    testMzIdentML();
+    testPepXML();
+    testPepXMLSharedPeptides();
+}
+
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(argc, argv)
+
+    try
+    {
+        if (argc>1 && !strcmp(argv[1],"-v")) os_ = &cout;
+        test();
+    }
+    catch (exception& e)
+    {
+        TEST_FAILED(e.what())
+    }
+    catch (...)
+    {
+        TEST_FAILED("Caught unknown exception.")
+    }
+
+    TEST_EPILOG
+}
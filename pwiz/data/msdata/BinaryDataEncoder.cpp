@@ -27,14 +27,9 @@
 #include "pwiz/utility/misc/Base64.hpp"
 #include "pwiz/utility/misc/endian.hpp"
 #include "boost/static_assert.hpp"
-#include "boost/iostreams/filtering_streambuf.hpp"
-#include "boost/iostreams/filtering_stream.hpp"
-#include "boost/iostreams/copy.hpp"
 #include <boost/math/special_functions/fpclassify.hpp>
-#include "iosfwd"
-#include "boost/iostreams/categories.hpp"
-#include "boost/iostreams/filter/zlib.hpp"
-#include "boost/iostreams/device/array.hpp"
+#include <boost/thread/tss.hpp>
+#include "zlib.h"
 #include "pwiz/utility/misc/Std.hpp"
 #include "pwiz/data/msdata/MSNumpress.hpp"
 
@@ -44,7 +39,192 @@ namespace msdata {
 
 using namespace pwiz::util;
 using namespace pwiz::cv;
-using namespace boost::iostreams;
+
+
+namespace {
+
+
+// Scratch space for encoding and decoding, reused by every call on the same thread. Buffers only ever grow,
+// so after the first few arrays no more allocations are needed. The zlib streams are kept too, since
+// initializing a deflate stream allocates a few hundred KB.
+struct Workspace
+{
+    vector<unsigned char> compressed;
+    vector<unsigned char> numpressed;
+    vector<float> data32;
+    vector<double> data64endianized;
+    vector<double> unpressed;
+    vector<double> widened;
+
+    vector<unsigned char> binary;
+    vector<unsigned char> decompressed;
+    vector<double> decoded;
+
+    z_stream deflater;
+    z_stream inflater;
+    bool deflaterInitialized;
+    bool inflaterInitialized;
+
+    Workspace() : deflaterInitialized(false), inflaterInitialized(false) {}
+
+    ~Workspace()
+    {
+        if (deflaterInitialized) deflateEnd(&deflater);
+        if (inflaterInitialized) inflateEnd(&inflater);
+    }
+};
+
+boost::thread_specific_ptr<Workspace> workspace_;
+
+Workspace& workspace()
+{
+    if (!workspace_.get())
+        workspace_.reset(new Workspace);
+    return *workspace_;
+}
+
+
+// grows buffer to at least count elements (without shrinking it) and returns its storage
+template <typename T>
+T* reserveBuffer(vector<T>& buffer, size_t count)
+{
+    if (buffer.size() < count)
+        buffer.resize(count);
+    return buffer.empty() ? 0 : &buffer[0];
+}
+
+
+// compresses byteCount bytes into ws.compressed in a single deflate call; returns the compressed size
+size_t zlibCompress(Workspace& ws, const void* byteBuffer, size_t byteCount)
+{
+    z_stream& zs = ws.deflater;
+    if (!ws.deflaterInitialized)
+    {
+        memset(&zs, 0, sizeof(zs));
+        if (deflateInit(&zs, Z_DEFAULT_COMPRESSION) != Z_OK)
+            throw runtime_error("[BinaryDataEncoder::encode()] Error initializing zlib compression.");
+        ws.deflaterInitialized = true;
+    }
+    else
+        deflateReset(&zs);
+
+    size_t bound = deflateBound(&zs, (uLong) byteCount);
+    zs.next_in = (Bytef*) byteBuffer;
+    zs.avail_in = (uInt) byteCount;
+    zs.next_out = reserveBuffer(ws.compressed, bound);
+    zs.avail_out = (uInt) bound;
+
+    if (deflate(&zs, Z_FINISH) != Z_STREAM_END)
+        throw runtime_error("[BinaryDataEncoder::encode()] Compression error?");
+    return zs.total_out;
+}
+
+
+// decompresses byteCount bytes into ws.decompressed, growing it as needed; returns the decompressed size
+size_t zlibDecompress(Workspace& ws, const void* byteBuffer, size_t byteCount)
+{
+    z_stream& zs = ws.inflater;
+    if (!ws.inflaterInitialized)
+    {
+        memset(&zs, 0, sizeof(zs));
+        if (inflateInit(&zs) != Z_OK)
+            throw runtime_error("[BinaryDataEncoder::decode()] Error initializing zlib decompression.");
+        ws.inflaterInitialized = true;
+    }
+    else
+        inflateReset(&zs);
+
+    zs.next_in = (Bytef*) byteBuffer;
+    zs.avail_in = (uInt) byteCount;
+    reserveBuffer(ws.decompressed, max<size_t>(byteCount * 4, 4096));
+
+    while (true)
+    {
+        zs.next_out = &ws.decompressed[zs.total_out];
+        zs.avail_out = (uInt) (ws.decompressed.size() - zs.total_out);
+
+        int status = inflate(&zs, Z_FINISH);
+        if (status == Z_STREAM_END)
+            break;
+        if (zs.avail_out > 0 || (status != Z_BUF_ERROR && status != Z_OK))
+            throw runtime_error("[BinaryDataEncoder::decode()] Compression error?"); // corrupt or truncated
+        ws.decompressed.resize(ws.decompressed.size() * 2); // ran out of room
+    }
+
+    if (zs.total_out == 0)
+        throw runtime_error("[BinaryDataEncoder::decode()] Compression error?");
+    return zs.total_out;
+}
+
+
+// where decoded values go: either a vector that is resized to fit,
+// or a caller's buffer of fixed capacity that must be large enough
+template <typename value_type>
+class DecodeTarget
+{
+    public:
+
+    DecodeTarget(vector<value_type>& v) : vector_(&v), buffer_(0), capacity_(0) {}
+    DecodeTarget(value_type* buffer, size_t capacity) : vector_(0), buffer_(buffer), capacity_(capacity) {}
+
+    /// storage for exactly count values
+    value_type* get(size_t count)
+    {
+        if (vector_)
+        {
+            vector_->resize(count);
+            return vector_->empty() ? 0 : &(*vector_)[0];
+        }
+
+        if (count > capacity_)
+            throw runtime_error("[BinaryDataEncoder::decode()] Decoded array is larger than the buffer provided.");
+        return buffer_;
+    }
+
+    /// for decoders that need room for up to maxCount values before the actual count is known;
+    /// returns NULL if the values must be decoded elsewhere and copied in with get()
+    value_type* getUpTo(size_t maxCount)
+    {
+        if (!vector_)
+            return 0;
+        if (vector_->size() < max<size_t>(maxCount, 1))
+            vector_->resize(max<size_t>(maxCount, 1));
+        return &(*vector_)[0];
+    }
+
+    void setSize(size_t count)
+    {
+        if (vector_) vector_->resize(count);
+    }
+
+    private:
+    vector<value_type>* vector_;
+    value_type* buffer_;
+    size_t capacity_;
+};
+
+
+// the numpress decoders only write doubles
+double* numpressTarget(DecodeTarget<double>& result, size_t maxCount) {return result.getUpTo(maxCount);}
+double* numpressTarget(DecodeTarget<float>& result, size_t maxCount) {return 0;}
+
+
+template <typename float_type, typename value_type>
+size_t copyBuffer(const void* byteBuffer, size_t byteCount, DecodeTarget<value_type>& result)
+{
+    const float_type* floatBuffer = reinterpret_cast<const float_type*>(byteBuffer);
+
+    if (byteCount % sizeof(float_type) != 0) 
+        throw runtime_error("[BinaryDataEncoder::copyBuffer()] Bad byteCount.");
+
+    size_t floatCount = byteCount / sizeof(float_type);
+    copy(floatBuffer, floatBuffer+floatCount, result.get(floatCount));
+    return floatCount;
+}
+
+
+} // namespace
+
 
 //
 // BinaryDataEncoder::Impl
@@ -61,17 +241,19 @@ class BinaryDataEncoder::Impl
 
     void encode(const vector<double>& data, string& result, size_t* binaryByteCount);
     void encode(const double* data, size_t dataSize, std::string& result, size_t* binaryByteCount);
-    void decode(const char *encodedData, size_t len, vector<double>& result);
-    void decode(const string& encodedData, vector<double>& result) 
-    {
-        decode(encodedData.c_str(),encodedData.length(),result);
-    }
+    void encode(const float* data, size_t dataSize, std::string& result, size_t* binaryByteCount);
+
+    template <typename value_type>
+    size_t decode(const char *encodedData, size_t len, DecodeTarget<value_type>& result);
+
     const Config & getConfig() const
     {
         return config_;
     }
     private:
     Config config_;
+
+    void compressAndEncode(Workspace& ws, const void* byteBuffer, size_t byteCount, std::string& result, size_t* binaryByteCount);
 };
 
 
@@ -91,86 +273,55 @@ void BinaryDataEncoder::Impl::encode(const vector<double>& data, string& result,
     encode(&data[0], data.size(), result, binaryByteCount);
 }
 
-// formerly returned a string, but those are not guaranteed to have
-// contiguous storage space in older C++ standards, so use vector instead
-// thx to Johan Teleman
-template <typename filter_type>
-void filterArray(const void* byteBuffer, size_t byteCount, vector<unsigned char> &result)
-{
-    result.reserve(byteCount); // preallocate (more than we need), for speed
-    filtering_ostream fos;
-    fos.push(filter_type());
-    fos.push(back_inserter(result));
-    fos.write((const char*)byteBuffer, byteCount);
-    fos.pop(); 
-    fos.pop(); // forces buffer to flush
-
-/* 
-    // original implementation, using technique in boost iostreams docs
-    // this doesn't flush properly in all cases -- see unit test
-    ostringstream result;
-    array_source source(reinterpret_cast<const char*>(byteBuffer), byteCount);
-    filtering_streambuf<input> in;
-    in.push(filter_type());
-    in.push(source);
-    boost::iostreams::copy(in, result);
-    return result.str();
-*/
-}
-
 
 void BinaryDataEncoder::Impl::encode(const double* data, size_t dataSize, std::string& result, size_t* binaryByteCount)
 {
     // using MSNumpress, from johan.teleman@immun.lth.se
     size_t byteCount;
     const void* byteBuffer;
-    vector<unsigned char> compressed;
-    vector<unsigned char> numpressed;
-    vector<float> data32;
-    vector<double> data64endianized;
+    Workspace& ws = workspace();
 
     if (Numpress_None != config_.numpress) { // lossy numerical representation
         try {
+            unsigned char* numpressed;
             switch(config_.numpress)
             {
             case Numpress_Linear:
-                numpressed.resize(dataSize * sizeof(double) + 8);
+                numpressed = reserveBuffer(ws.numpressed, dataSize * sizeof(double) + 8);
                 break;
 
             case Numpress_Pic:
-                numpressed.resize(dataSize * sizeof(double));
+                numpressed = reserveBuffer(ws.numpressed, dataSize * sizeof(double));
                 break;
 
             case Numpress_Slof:
-                numpressed.resize(dataSize * 2 + 8);
+                numpressed = reserveBuffer(ws.numpressed, dataSize * 2 + 8);
                 break;
 
             default: 
                 throw runtime_error("[BinaryDataEncoder::encode()] unknown numpress mode");
                 break;
             }
-            vector<double> unpressed; // for checking excessive accurary loss
+            // the encoders report the values the decoder will produce, for checking excessive accuracy loss
+            double* unpressed = 0;
             double numpressErrorTolerance = 0.0;
             switch (config_.numpress) {
                 case Numpress_Linear:
-                    byteCount = MSNumpress::encodeLinear(data, dataSize, &numpressed[0], config_.numpressFixedPoint);
-                    numpressed.resize(byteCount);
-                    if ((numpressErrorTolerance=config_.numpressLinearErrorTolerance) > 0) // decompress to check accuracy loss
-                        MSNumpress::decodeLinear(numpressed,unpressed); 
+                    if ((numpressErrorTolerance=config_.numpressLinearErrorTolerance) > 0)
+                        unpressed = reserveBuffer(ws.unpressed, dataSize);
+                    byteCount = MSNumpress::encodeLinear(data, dataSize, numpressed, config_.numpressFixedPoint, unpressed);
                     break;
 
                 case Numpress_Pic:
-                    byteCount = MSNumpress::encodePic(data, dataSize, &numpressed[0]);
-                    numpressed.resize(byteCount);
                     numpressErrorTolerance = 0.5; // it's an integer rounding, so always +- 0.5
-                    MSNumpress::decodePic(numpressed,unpressed); // but susceptable to overflow, so always check
+                    unpressed = reserveBuffer(ws.unpressed, dataSize); // but susceptable to overflow, so always check
+                    byteCount = MSNumpress::encodePic(data, dataSize, numpressed, unpressed);
                     break; 
 
                 case Numpress_Slof:
-                    byteCount = MSNumpress::encodeSlof(data, dataSize, &numpressed[0], config_.numpressFixedPoint);
-                    numpressed.resize(byteCount);
-                    if ((numpressErrorTolerance=config_.numpressSlofErrorTolerance) > 0) // decompress to check accuracy loss
-                        MSNumpress::decodeSlof(numpressed,unpressed); 
+                    if ((numpressErrorTolerance=config_.numpressSlofErrorTolerance) > 0)
+                        unpressed = reserveBuffer(ws.unpressed, dataSize);
+                    byteCount = MSNumpress::encodeSlof(data, dataSize, numpressed, config_.numpressFixedPoint, unpressed);
                     break;
 
                 default:
@@ -213,7 +364,7 @@ void BinaryDataEncoder::Impl::encode(const double* data, size_t dataSize, std::s
             if (n>=0)
                 config_.numpress = Numpress_None; // excessive error, don't numpress
             else
-                byteBuffer = reinterpret_cast<const void*>(&numpressed[0]);
+                byteBuffer = reinterpret_cast<const void*>(numpressed);
         } catch (int e) {
             cerr << "MZNumpress encoder threw exception: " << e << endl;
         } catch (...) {
@@ -238,13 +389,13 @@ void BinaryDataEncoder::Impl::encode(const double* data, size_t dataSize, std::s
 
         // 64-bit -> 32-bit downconversion
 
-
+        float* data32 = 0;
         if (config_.precision == Precision_32)
         {
-            data32.resize(dataSize);
-            transform(data, data+dataSize, data32.begin(), DoubleToFloat());
-            byteBuffer = reinterpret_cast<void*>(&data32[0]);
-            byteCount = data32.size() * sizeof(float);
+            data32 = reserveBuffer(ws.data32, dataSize);
+            transform(data, data+dataSize, data32, DoubleToFloat());
+            byteBuffer = reinterpret_cast<void*>(data32);
+            byteCount = dataSize * sizeof(float);
         }
 
         // byte ordering
@@ -259,34 +410,67 @@ void BinaryDataEncoder::Impl::encode(const double* data, size_t dataSize, std::s
         {
             if (config_.precision == Precision_32)
             {
-                unsigned int* p = reinterpret_cast<unsigned int *>(&data32[0]);
-                transform(p, p+data32.size(), p, endianize32);
+                unsigned int* p = reinterpret_cast<unsigned int *>(data32);
+                transform(p, p+dataSize, p, endianize32);
             }
             else // Precision_64 
             {
-                data64endianized.resize(dataSize);
                 const unsigned long long* from = reinterpret_cast<const unsigned long long*>(data);
-                unsigned long long* to = reinterpret_cast<unsigned long long*>(&data64endianized[0]);
+                unsigned long long* to = reinterpret_cast<unsigned long long*>(reserveBuffer(ws.data64endianized, dataSize));
                 transform(from, from+dataSize, to, endianize64);
-                byteBuffer = reinterpret_cast<void*>(&data64endianized[0]);
+                byteBuffer = reinterpret_cast<void*>(to);
                 byteCount = dataSize * sizeof(double);
             }
         }
     }
+
+    compressAndEncode(ws, byteBuffer, byteCount, result, binaryByteCount);
+}
+
+
+void BinaryDataEncoder::Impl::encode(const float* data, size_t dataSize, std::string& result, size_t* binaryByteCount)
+{
+    Workspace& ws = workspace();
+
+    // numpress and 64-bit output work from doubles; widening a float is exact
+    if (Numpress_None != config_.numpress || config_.precision == Precision_64)
+    {
+        double* widened = reserveBuffer(ws.widened, dataSize);
+        copy(data, data+dataSize, widened);
+        encode(widened, dataSize, result, binaryByteCount);
+        return;
+    }
+
+    // 32-bit output is encoded straight from the caller's values
+    const void* byteBuffer = reinterpret_cast<const void*>(data);
+    size_t byteCount = dataSize * sizeof(float);
+
+    #ifdef PWIZ_LITTLE_ENDIAN
+    bool mustEndianize = (config_.byteOrder == ByteOrder_BigEndian);
+    #elif defined(PWIZ_BIG_ENDIAN)
+    bool mustEndianize = (config_.byteOrder == ByteOrder_LittleEndian);
+    #endif
+
+    if (mustEndianize)
+    {
+        const unsigned int* from = reinterpret_cast<const unsigned int*>(data);
+        unsigned int* to = reinterpret_cast<unsigned int*>(reserveBuffer(ws.data32, dataSize));
+        transform(from, from+dataSize, to, endianize32);
+        byteBuffer = reinterpret_cast<void*>(to);
+    }
+
+    compressAndEncode(ws, byteBuffer, byteCount, result, binaryByteCount);
+}
+
+
+void BinaryDataEncoder::Impl::compressAndEncode(Workspace& ws, const void* byteBuffer, size_t byteCount, std::string& result, size_t* binaryByteCount)
+{
     // compression
 
     if (config_.compression == Compression_Zlib)
     {
-        filterArray<zlib_compressor>(byteBuffer, byteCount,compressed);
-        if (!compressed.empty())
-        {
-            byteBuffer = reinterpret_cast<void*>(&compressed[0]);
-            byteCount = compressed.size();
-        }
-        else
-        {
-            throw runtime_error("[BinaryDataEncoder::encode()] Compression error?");
-        }
+        byteCount = zlibCompress(ws, byteBuffer, byteCount);
+        byteBuffer = reinterpret_cast<void*>(&ws.compressed[0]);
     }
 
     // Base64 encoding
@@ -316,55 +500,28 @@ void BinaryDataEncoder::Impl::encode(const double* data, size_t dataSize, std::s
 }
 
 
-template <typename float_type>
-void copyBuffer(const void* byteBuffer, size_t byteCount, vector<double>& result)
+template <typename value_type>
+size_t BinaryDataEncoder::Impl::decode(const char *encodedData, size_t length, DecodeTarget<value_type>& result)
 {
-    const float_type* floatBuffer = reinterpret_cast<const float_type*>(byteBuffer);
-
-    if (byteCount % sizeof(float_type) != 0) 
-        throw runtime_error("[BinaryDataEncoder::copyBuffer()] Bad byteCount.");
-
-    size_t floatCount = byteCount / sizeof(float_type);
-
-    result.resize(floatCount);
-
-    copy(floatBuffer, floatBuffer+floatCount, result.begin());
-}
-
-
-void BinaryDataEncoder::Impl::decode(const char *encodedData, size_t length, vector<double>& result)
-{
-    if (!encodedData || !length) return;
+    Workspace& ws = workspace();
 
     // Base64 decoding
 
-    vector<unsigned char> binary(Base64::textToBinarySize(length));
-    size_t binarySize = Base64::textToBinary(encodedData, length, &binary[0]);
-    binary.resize(binarySize);
+    unsigned char* binary = reserveBuffer(ws.binary, Base64::textToBinarySize(length));
+    size_t binarySize = Base64::textToBinary(encodedData, length, binary);
 
     // buffer abstractions
 
-    void* byteBuffer = &binary[0];
+    void* byteBuffer = binary;
     size_t byteCount = binarySize;
     size_t initialSize;
 
     // decompression
 
-    vector<unsigned char> decompressed;
     switch (config_.compression) {
         case Compression_Zlib:
-            {
-                filterArray<zlib_decompressor>(byteBuffer, byteCount,decompressed);
-                if (!decompressed.empty())
-                {
-                    byteBuffer = reinterpret_cast<void*>(&decompressed[0]);
-                    byteCount = decompressed.size();
-                }
-                else
-                {
-                    throw runtime_error("[BinaryDataEncoder::decode()] Compression error?");
-                }
-            } 
+            byteCount = zlibDecompress(ws, byteBuffer, byteCount);
+            byteBuffer = reinterpret_cast<void*>(&ws.decompressed[0]);
             break;
         case Compression_None:
             break;
@@ -373,79 +530,71 @@ void BinaryDataEncoder::Impl::decode(const char *encodedData, size_t length, vec
             break;
     }
     // numpress expansion or endian correction
-    switch (config_.numpress) 
+    if (config_.numpress != Numpress_None)
     {
-        case Numpress_Linear:
-            initialSize = byteCount * 2;
-            if (result.size() < initialSize)
-                result.resize(initialSize);
-            try {
-                size_t count = MSNumpress::decodeLinear((const unsigned char *)byteBuffer, byteCount, &result[0]);
-                result.resize(count);
-            } catch (...) {
-                throw runtime_error("BinaryDataEncoder::Impl::decode  error in numpress linear decompression");
-            }
-            break;
-        case Numpress_Pic:
-            initialSize = byteCount * 2;
-            if (result.size() < initialSize)
-                result.resize(initialSize);
-            try {
-                size_t count = MSNumpress::decodePic((const unsigned char *)byteBuffer, byteCount, &result[0]);
-                result.resize(count);
-            } catch (...) {
-                throw runtime_error("BinaryDataEncoder::Impl::decode  error in numpress pic decompression");
-            }
-            break;
-        case Numpress_Slof:
-            initialSize = byteCount / 2;
-            if (result.size() < initialSize)
-                result.resize(initialSize);
-            try {
-                size_t count = MSNumpress::decodeSlof((const unsigned char *)byteBuffer, byteCount, &result[0]);
-                result.resize(count);
-            } catch (...) {
-                throw runtime_error("BinaryDataEncoder::Impl::decode  error in numpress slof decompression");
-            }
-            break;
-        case Numpress_None:
-            {
-            // endianization for non-numpress cases
+        const char* name;
+        switch (config_.numpress) 
+        {
+            case Numpress_Linear: initialSize = byteCount * 2; name = "linear"; break;
+            case Numpress_Pic: initialSize = byteCount * 2; name = "pic"; break;
+            case Numpress_Slof: initialSize = byteCount / 2; name = "slof"; break;
+            default: throw runtime_error("BinaryDataEncoder::Impl::decode  unknown numpress method");
+        }
 
-            #ifdef PWIZ_LITTLE_ENDIAN
-            bool mustEndianize = (config_.byteOrder == ByteOrder_BigEndian);
-            #elif defined(PWIZ_BIG_ENDIAN)
-            bool mustEndianize = (config_.byteOrder == ByteOrder_LittleEndian);
-            #endif
+        // decode straight into the result if possible, otherwise into the workspace and copy
+        double* direct = numpressTarget(result, initialSize);
+        double* decoded = direct ? direct : reserveBuffer(ws.decoded, max<size_t>(initialSize, 1));
 
-            if (mustEndianize)
+        size_t count;
+        try {
+            const unsigned char* bytes = (const unsigned char *)byteBuffer;
+            switch (config_.numpress) 
             {
-                if (config_.precision == Precision_32)
-                {
-                    unsigned int* p = reinterpret_cast<unsigned int*>(byteBuffer);
-                    size_t floatCount = byteCount / sizeof(float);
-                    transform(p, p+floatCount, p, endianize32);
-                }
-                else // Precision_64
-                {
-                    unsigned long long* p = reinterpret_cast<unsigned long long*>(byteBuffer);
-                    size_t doubleCount = byteCount / sizeof(double);
-                    transform(p, p+doubleCount, p, endianize64);
-                }
+                case Numpress_Linear: count = MSNumpress::decodeLinear(bytes, byteCount, decoded); break;
+                case Numpress_Pic: count = MSNumpress::decodePic(bytes, byteCount, decoded); break;
+                default: count = MSNumpress::decodeSlof(bytes, byteCount, decoded); break;
             }
+        } catch (...) {
+            throw runtime_error(string("BinaryDataEncoder::Impl::decode  error in numpress ") + name + " decompression");
+        }
 
-            // (upconversion and) copy to result buffer
+        if (direct)
+            result.setSize(count);
+        else
+            copy(decoded, decoded+count, result.get(count));
+        return count;
+    }
 
-            if (config_.precision == Precision_32)
-                copyBuffer<float>(byteBuffer, byteCount, result);
-            else // Precision_64
-                copyBuffer<double>(byteBuffer, byteCount, result);
-            }
-            break;
-        default: 
-            throw runtime_error("BinaryDataEncoder::Impl::decode  unknown numpress method");
-            break;
-   }
+    // endianization for non-numpress cases
+
+    #ifdef PWIZ_LITTLE_ENDIAN
+    bool mustEndianize = (config_.byteOrder == ByteOrder_BigEndian);
+    #elif defined(PWIZ_BIG_ENDIAN)
+    bool mustEndianize = (config_.byteOrder == ByteOrder_LittleEndian);
+    #endif
+
+    if (mustEndianize)
+    {
+        if (config_.precision == Precision_32)
+        {
+            unsigned int* p = reinterpret_cast<unsigned int*>(byteBuffer);
+            size_t floatCount = byteCount / sizeof(float);
+            transform(p, p+floatCount, p, endianize32);
+        }
+        else // Precision_64
+        {
+            unsigned long long* p = reinterpret_cast<unsigned long long*>(byteBuffer);
+            size_t doubleCount = byteCount / sizeof(double);
+            transform(p, p+doubleCount, p, endianize64);
+        }
+    }
+
+    // (up/down conversion and) copy to result buffer
+
+    if (config_.precision == Precision_32)
+        return copyBuffer<float>(byteBuffer, byteCount, result);
+    else // Precision_64
+        return copyBuffer<double>(byteBuffer, byteCount, result);
 }
 
 
@@ -470,11 +619,51 @@ PWIZ_API_DECL void BinaryDataEncoder::encode(const double* data, size_t dataSize
 }
 
 
+PWIZ_API_DECL void BinaryDataEncoder::encode(const std::vector<float>& data, std::string& result, size_t* binaryByteCount /*= NULL*/) const
+{
+    if (data.empty()) return;
+    impl_->encode(&data[0], data.size(), result, binaryByteCount);
+}
+
+
+PWIZ_API_DECL void BinaryDataEncoder::encode(const float* data, size_t dataSize, std::string& result, size_t* binaryByteCount /*= NULL*/) const
+{
+    impl_->encode(data, dataSize, result, binaryByteCount);
+}
+
+
 PWIZ_API_DECL void BinaryDataEncoder::decode(const char * encodedData, size_t len, std::vector<double>& result) const
 {
-    impl_->decode(encodedData, len, result);
+    if (!encodedData || !len) return;
+    DecodeTarget<double> target(result);
+    impl_->decode(encodedData, len, target);
 }
 
+
+PWIZ_API_DECL void BinaryDataEncoder::decode(const char * encodedData, size_t len, std::vector<float>& result) const
+{
+    if (!encodedData || !len) return;
+    DecodeTarget<float> target(result);
+    impl_->decode(encodedData, len, target);
+}
+
+
+PWIZ_API_DECL size_t BinaryDataEncoder::decode(const char * encodedData, size_t len, double* result, size_t resultSize) const
+{
+    if (!encodedData || !len) return 0;
+    DecodeTarget<double> target(result, resultSize);
+    return impl_->decode(encodedData, len, target);
+}
+
+
+PWIZ_API_DECL size_t BinaryDataEncoder::decode(const char * encodedData, size_t len, float* result, size_t resultSize) const
+{
+    if (!encodedData || !len) return 0;
+    DecodeTarget<float> target(result, resultSize);
+    return impl_->decode(encodedData, len, target);
+}
+
+
 PWIZ_API_DECL const BinaryDataEncoder::Config& BinaryDataEncoder::getConfig() const // get the config actually used - may differ from input for numpress use
 {
     return impl_->getConfig();
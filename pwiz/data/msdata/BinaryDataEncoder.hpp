@@ -41,6 +41,7 @@ const double BinaryDataEncoder_default_numpressLinearErrorTolerance = 2e-9;
 const double BinaryDataEncoder_default_numpressPicErrorTolerance = 0.5; // rounds to nearest integer
 
 /// binary-to-text encoding
+/// - intermediate buffers and zlib streams are kept per thread and reused between calls
 class PWIZ_API_DECL BinaryDataEncoder
 {
     public:
@@ -85,6 +86,11 @@ class PWIZ_API_DECL BinaryDataEncoder
     /// encode binary data as a text string
     void encode(const double* data, size_t dataSize, std::string& result, size_t* binaryByteCount = NULL) const;
 
+    /// encode single precision values as a text string; with Precision_32 (and no numpress)
+    /// the values are encoded as they are, without a double precision intermediate
+    void encode(const std::vector<float>& data, std::string& result, size_t* binaryByteCount = NULL) const;
+    void encode(const float* data, size_t dataSize, std::string& result, size_t* binaryByteCount = NULL) const;
+
     /// decode text-encoded data as binary 
     void decode(const char *encodedData, size_t len, std::vector<double>& result) const;
     void decode(const std::string& encodedData, std::vector<double>& result) const 
@@ -92,6 +98,15 @@ class PWIZ_API_DECL BinaryDataEncoder
         decode(encodedData.c_str(),encodedData.length(),result);
     }
 
+    /// decode text-encoded data as single precision values, without a double precision intermediate
+    void decode(const char *encodedData, size_t len, std::vector<float>& result) const;
+
+    /// decode text-encoded data into a caller-provided buffer with room for resultSize values
+    /// (e.g. the expected array length); returns the number of values decoded,
+    /// or throws if the decoded array does not fit
+    size_t decode(const char *encodedData, size_t len, double* result, size_t resultSize) const;
+    size_t decode(const char *encodedData, size_t len, float* result, size_t resultSize) const;
+
     private:
     class Impl;
     boost::shared_ptr<Impl> impl_;
@@ -229,11 +229,74 @@ void testConfiguration(const BinaryDataEncoder::Config& config_in)
         break;
     }
     if (os_) *os_ << "validated with epsilon: " << fixed << setprecision(1) << scientific << epsilon << "\n\n";
+
+    // decoding to single precision or into a caller's buffer gives the same values
+
+    vector<float> decoded32;
+    encoder.decode(encoded.c_str(), encoded.length(), decoded32);
+    unit_assert_operator_equal(decoded.size(), decoded32.size());
+    for (size_t i=0; i < decoded.size(); ++i)
+        unit_assert(decoded32[i] == float(decoded[i]));
+
+    vector<double> buffer(decoded.size() + 1);
+    unit_assert_operator_equal(decoded.size(), encoder.decode(encoded.c_str(), encoded.length(), &buffer[0], buffer.size()));
+    unit_assert(equal(decoded.begin(), decoded.end(), buffer.begin()));
+
+    vector<float> buffer32(decoded.size());
+    unit_assert_operator_equal(decoded.size(), encoder.decode(encoded.c_str(), encoded.length(), &buffer32[0], buffer32.size()));
+    unit_assert(buffer32 == decoded32);
+
+    unit_assert_throws(encoder.decode(encoded.c_str(), encoded.length(), &buffer[0], decoded.size() - 1), runtime_error);
+
+    // encoding single precision values gives the same text as encoding them widened to doubles
+
+    if (!checkNumpressMaxErrorSupression)
+    {
+        vector<float> binary32(binary.begin(), binary.end());
+        vector<double> widened(binary32.begin(), binary32.end());
+        string encoded32, encodedWidened;
+        BinaryDataEncoder(config).encode(binary32, encoded32);
+        BinaryDataEncoder(config).encode(widened, encodedWidened);
+        unit_assert(encoded32 == encodedWidened);
+    }
+}
+
+
+// the per-thread buffers are reused across arrays of very different sizes
+void testBufferReuse()
+{
+    if (os_) *os_ << "testBufferReuse\n";
+
+    BinaryDataEncoder::Config config;
+    config.compression = BinaryDataEncoder::Compression_Zlib;
+
+    const size_t sizes[] = {100000, 10, 1, 5000, 200000, 3};
+    BOOST_FOREACH(size_t size, sizes)
+    {
+        for (int linear=0; linear < 2; ++linear)
+        {
+            config.numpress = linear ? BinaryDataEncoder::Numpress_Linear : BinaryDataEncoder::Numpress_None;
+            BinaryDataEncoder encoder(config);
+
+            vector<double> data(size), decoded;
+            for (size_t i=0; i < size; ++i)
+                data[i] = 100 + i * 0.25;
+
+            string encoded;
+            encoder.encode(data, encoded);
+            encoder.decode(encoded, decoded);
+            unit_assert_operator_equal(size, decoded.size());
+            for (size_t i=0; i < size; ++i)
+                unit_assert_equal(data[i], decoded[i], 1e-4);
+        }
+    }
 }
 
 
 void test()
 {
+    testBufferReuse();
+
     BinaryDataEncoder::Config config;
 
     config.precision = BinaryDataEncoder::Precision_32;
@@ -134,10 +134,14 @@ PWIZ_API_DECL void Reader_mzML::read(const std::string& filename,
     if (runIndex != 0)
         throw ReaderFail("[Reader_mzML::read] multiple runs not supported");
 
-    shared_ptr<istream> is(new pwiz::util::random_access_compressed_ifstream(filename.c_str()));
+    shared_ptr<istream> is(new pwiz::util::random_access_compressed_ifstream(filename.c_str(), true));
     if (!is.get() || !*is)
         throw runtime_error(("[Reader_mzML::read] Unable to open file " + filename).c_str());
 
+    IndexSidecarPtr sidecar;
+    if (config.indexSidecar)
+        sidecar.reset(new IndexSidecar(filename));
+
     switch (type(*is))
     {
         case Type_mzML:
@@ -145,13 +149,13 @@ PWIZ_API_DECL void Reader_mzML::read(const std::string& filename,
             Serializer_mzML::Config config;
             config.indexed = false;
             Serializer_mzML serializer(config);
-            serializer.read(is, result);
+            serializer.read(is, result, sidecar);
             break;
         }
         case Type_mzML_Indexed:
         {
             Serializer_mzML serializer;
-            serializer.read(is, result);
+            serializer.read(is, result, sidecar);
             break;
         }
         case Type_Unknown:
@@ -217,15 +221,19 @@ PWIZ_API_DECL void Reader_mzXML::read(const std::string& filename,
     if (runsIndex != 0)
         throw ReaderFail("[Reader_mzXML::read] multiple runs not supported");
 
-    shared_ptr<istream> is(new pwiz::util::random_access_compressed_ifstream(filename.c_str()));
+    shared_ptr<istream> is(new pwiz::util::random_access_compressed_ifstream(filename.c_str(), true));
     if (!is.get() || !*is)
         throw runtime_error(("[Reader_mzXML::read] Unable to open file " + filename).c_str());
 
+    IndexSidecarPtr sidecar;
+    if (config.indexSidecar)
+        sidecar.reset(new IndexSidecar(filename));
+
     try
     {
         // assume there is a scan index
         Serializer_mzXML serializer;
-        serializer.read(is, result);
+        serializer.read(is, result, sidecar);
         fillInCommonMetadata(filename, result);
         result.fileDescription.sourceFilePtrs.back()->set(MS_scan_number_only_nativeID_format);
         result.fileDescription.sourceFilePtrs.back()->set(MS_ISB_mzXML_format);
@@ -239,7 +247,7 @@ PWIZ_API_DECL void Reader_mzXML::read(const std::string& filename,
     Serializer_mzXML::Config serializerConfig;
     serializerConfig.indexed = false;
     Serializer_mzXML serializer(serializerConfig);
-    serializer.read(is, result);
+    serializer.read(is, result, sidecar);
     fillInCommonMetadata(filename, result);
     result.fileDescription.sourceFilePtrs.back()->set(MS_scan_number_only_nativeID_format);
     result.fileDescription.sourceFilePtrs.back()->set(MS_ISB_mzXML_format);
@@ -278,8 +286,12 @@ PWIZ_API_DECL void Reader_MGF::read(const string& filename,
     if (!is.get() || !*is)
         throw runtime_error(("[Reader_MGF::read] Unable to open file " + filename));
 
+    IndexSidecarPtr sidecar;
+    if (config.indexSidecar)
+        sidecar.reset(new IndexSidecar(filename));
+
     Serializer_MGF serializer;
-    serializer.read(is, result);
+    serializer.read(is, result, sidecar);
     fillInCommonMetadata(filename, result);
     result.fileDescription.sourceFilePtrs.back()->set(MS_multiple_peak_list_nativeID_format);
     result.fileDescription.sourceFilePtrs.back()->set(MS_Mascot_MGF_format);
@@ -292,7 +304,7 @@ PWIZ_API_DECL void Reader_MGF::read(const std::string& filename,
                                     const Config& config) const
 {
     results.push_back(MSDataPtr(new MSData));
-    read(filename, head, *results.back());
+    read(filename, head, *results.back(), 0, config);
 }
 
 
@@ -339,16 +339,23 @@ void diff(const BinaryDataArray& a,
         diff(static_cast<const ParamContainer&>(a), b, a_b, b_a, config);
     }
 
-    if (a.data.size() != b.data.size())
+    // packed arrays are compared by value
+    vector<double> aUnpacked, bUnpacked;
+    if (a.isPacked()) a.getData(aUnpacked);
+    if (b.isPacked()) b.getData(bUnpacked);
+    const vector<double>& aData = a.isPacked() ? aUnpacked : a.data;
+    const vector<double>& bData = b.isPacked() ? bUnpacked : b.data;
+
+    if (aData.size() != bData.size())
     {
         a_b.userParams.push_back(UserParam("Binary data array size: " + 
-                                           lexical_cast<string>(a.data.size())));
+                                           lexical_cast<string>(aData.size())));
         b_a.userParams.push_back(UserParam("Binary data array size: " + 
-                                           lexical_cast<string>(b.data.size())));
+                                           lexical_cast<string>(bData.size())));
     }
     else
     {
-        pair<size_t, double> max = maxdiff(a.data, b.data);
+        pair<size_t, double> max = maxdiff(aData, bData);
        
         if (max.second > config.precision + numeric_limits<double>::epsilon())
         {
@@ -29,6 +29,7 @@
 #include "pwiz/utility/misc/Filesystem.hpp"
 #include "pwiz/utility/misc/Std.hpp"
 #include "SpectrumWorkerThreads.hpp"
+#include <boost/bind.hpp>
 
 namespace pwiz {
 namespace msdata {
@@ -91,19 +92,19 @@ PWIZ_API_DECL void read(std::istream& is, CV& cv)
 
 PWIZ_API_DECL void write(minimxml::XMLWriter& writer, const UserParam& userParam)
 {
-    XMLWriter::Attributes attributes;
-    attributes.add("name", userParam.name);
+    writer.startTag("userParam");
+    writer.attribute("name", userParam.name);
     if (!userParam.value.empty())
-        attributes.add("value", userParam.value);
+        writer.attribute("value", userParam.value);
     if (!userParam.type.empty())
-        attributes.add("type", userParam.type);
+        writer.attribute("type", userParam.type);
     if (userParam.units != CVID_Unknown)
     {
-        attributes.add("unitAccession", cvTermInfo(userParam.units).id);
-        attributes.add("unitName", cvTermInfo(userParam.units).name);
+        const CVTermInfo& units = cvTermInfo(userParam.units);
+        writer.attribute("unitAccession", units.id);
+        writer.attribute("unitName", units.name);
     }
-
-    writer.startElement("userParam", attributes, XMLWriter::EmptyElement);
+    writer.endStartTag(XMLWriter::EmptyElement);
 }
 
 
@@ -150,18 +151,20 @@ PWIZ_API_DECL void read(std::istream& is, UserParam& userParam)
 
 PWIZ_API_DECL void write(minimxml::XMLWriter& writer, const CVParam& cvParam)
 {
-    XMLWriter::Attributes attributes;
-    attributes.add("cvRef", cvTermInfo(cvParam.cvid).prefix());
-    attributes.add("accession", cvTermInfo(cvParam.cvid).id);
-    attributes.add("name", cvTermInfo(cvParam.cvid).name);
-    attributes.add("value", cvParam.value);
+    const CVTermInfo& info = cvTermInfo(cvParam.cvid);
+    writer.startTag("cvParam");
+    writer.attribute("cvRef", info.prefix());
+    writer.attribute("accession", info.id);
+    writer.attribute("name", info.name);
+    writer.attribute("value", cvParam.value);
     if (cvParam.units != CVID_Unknown)
     {
-        attributes.add("unitCvRef", cvTermInfo(cvParam.units).prefix());
-        attributes.add("unitAccession", cvTermInfo(cvParam.units).id);
-        attributes.add("unitName", cvTermInfo(cvParam.units).name);
+        const CVTermInfo& units = cvTermInfo(cvParam.units);
+        writer.attribute("unitCvRef", units.prefix());
+        writer.attribute("unitAccession", units.id);
+        writer.attribute("unitName", units.name);
     }
-    writer.startElement("cvParam", attributes, XMLWriter::EmptyElement);
+    writer.endStartTag(XMLWriter::EmptyElement);
 }
 
 
@@ -186,6 +189,7 @@ struct HandlerCVParam : public SAXParser::Handler
             cvParam->cvid = cvTermInfo(accession).cvid;
 
         getAttribute(attributes, "value", cvParam->value);
+        cvParam->cacheNumericValue(); // numeric values are parsed once here instead of in every valueAs<double>()
 
         const char *unitAccession = getAttribute(attributes, "unitAccession", NoXMLUnescape); 
         if (unitAccession)
@@ -213,9 +217,9 @@ PWIZ_API_DECL void read(std::istream& is, CVParam& cvParam)
 
 PWIZ_API_DECL void writeParamGroupRef(minimxml::XMLWriter& writer, const ParamGroup& paramGroup)
 {
-    XMLWriter::Attributes attributes;
-    attributes.add("ref", paramGroup.id);
-    writer.startElement("referenceableParamGroupRef", attributes, XMLWriter::EmptyElement);
+    writer.startTag("referenceableParamGroupRef");
+    writer.attribute("ref", paramGroup.id);
+    writer.endStartTag(XMLWriter::EmptyElement);
 }
 
 
@@ -1179,23 +1183,21 @@ PWIZ_API_DECL void read(std::istream& is, Activation& activation)
 
 PWIZ_API_DECL void write(minimxml::XMLWriter& writer, const Precursor& precursor)
 {
-    XMLWriter::Attributes attributes;
+    if (precursor.spectrumID.empty() && !precursor.externalSpectrumID.empty() && !precursor.sourceFilePtr.get())
+        throw runtime_error("[IO::write] External spectrum references must refer to a source file");
 
+    writer.startTag("precursor");
     if (precursor.spectrumID.empty())
     {
         if (!precursor.externalSpectrumID.empty())
         {
-            if (!precursor.sourceFilePtr.get())
-                throw runtime_error("[IO::write] External spectrum references must refer to a source file");
-
-            attributes.add("sourceFileRef", encode_xml_id_copy(precursor.sourceFilePtr->id)); 
-            attributes.add("externalSpectrumID", precursor.externalSpectrumID); 
+            writer.attribute("sourceFileRef", encode_xml_id_copy(precursor.sourceFilePtr->id)); 
+            writer.attribute("externalSpectrumID", precursor.externalSpectrumID); 
         }
     }
     else
-        attributes.add("spectrumRef", precursor.spectrumID); // not an XML:IDREF
-
-    writer.startElement("precursor", attributes);
+        writer.attribute("spectrumRef", precursor.spectrumID); // not an XML:IDREF
+    writer.endStartTag();
     writeParamContainer(writer, precursor);
 
     if (!precursor.isolationWindow.empty())
@@ -1207,9 +1209,9 @@ PWIZ_API_DECL void write(minimxml::XMLWriter& writer, const Precursor& precursor
 
     if (!precursor.selectedIons.empty())
     {
-        attributes.clear();
-        attributes.add("count", precursor.selectedIons.size());
-        writer.startElement("selectedIonList", attributes);
+        writer.startTag("selectedIonList");
+        writer.attribute("count", precursor.selectedIons.size());
+        writer.endStartTag();
 
         for (vector<SelectedIon>::const_iterator it=precursor.selectedIons.begin(); 
              it!=precursor.selectedIons.end(); ++it)
@@ -1400,36 +1402,34 @@ PWIZ_API_DECL void read(std::istream& is, ScanWindow& scanWindow)
 
 PWIZ_API_DECL void write(minimxml::XMLWriter& writer, const Scan& scan, const MSData& msd)
 {
-    XMLWriter::Attributes attributes;
+    if (scan.spectrumID.empty() && !scan.externalSpectrumID.empty() && !scan.sourceFilePtr.get())
+        throw runtime_error("[IO::write] External spectrum references must refer to a source file");
 
+    writer.startTag("scan");
     if (scan.spectrumID.empty())
     {
         if (!scan.externalSpectrumID.empty())
         {
-            if (!scan.sourceFilePtr.get())
-                throw runtime_error("[IO::write] External spectrum references must refer to a source file");
-
-            attributes.add("sourceFileRef", encode_xml_id_copy(scan.sourceFilePtr->id)); 
-            attributes.add("externalSpectrumID", scan.externalSpectrumID); 
+            writer.attribute("sourceFileRef", encode_xml_id_copy(scan.sourceFilePtr->id)); 
+            writer.attribute("externalSpectrumID", scan.externalSpectrumID); 
         }
     }
     else
-        attributes.add("spectrumRef", scan.spectrumID); // not an XML:IDREF
+        writer.attribute("spectrumRef", scan.spectrumID); // not an XML:IDREF
 
     // don't write the instrumentConfigurationRef if it's set to the default
     const InstrumentConfigurationPtr& defaultIC = msd.run.defaultInstrumentConfigurationPtr;
     if (scan.instrumentConfigurationPtr.get() &&
         (!defaultIC.get() || scan.instrumentConfigurationPtr != defaultIC))
-        attributes.add("instrumentConfigurationRef", encode_xml_id_copy(scan.instrumentConfigurationPtr->id));
-
-    writer.startElement("scan", attributes);
+        writer.attribute("instrumentConfigurationRef", encode_xml_id_copy(scan.instrumentConfigurationPtr->id));
+    writer.endStartTag();
     writeParamContainer(writer, scan);
     
     if (!scan.scanWindows.empty())
     {
-        attributes.clear();
-        attributes.add("count", scan.scanWindows.size());
-        writer.startElement("scanWindowList", attributes);
+        writer.startTag("scanWindowList");
+        writer.attribute("count", scan.scanWindows.size());
+        writer.endStartTag();
         
         for (vector<ScanWindow>::const_iterator it=scan.scanWindows.begin(); 
              it!=scan.scanWindows.end(); ++it)
@@ -1544,9 +1544,9 @@ PWIZ_API_DECL void read(std::istream& is, Scan& scan)
 
 PWIZ_API_DECL void write(minimxml::XMLWriter& writer, const ScanList& scanList, const MSData& msd)
 {
-    XMLWriter::Attributes attributes;
-    attributes.add("count", scanList.scans.size());
-    writer.startElement("scanList", attributes);
+    writer.startTag("scanList");
+    writer.attribute("count", scanList.scans.size());
+    writer.endStartTag();
     writeParamContainer(writer, scanList);
     
     for (vector<Scan>::const_iterator it=scanList.scans.begin(); 
@@ -1618,24 +1618,35 @@ void write(minimxml::XMLWriter& writer, const BinaryDataArray& binaryDataArray,
 
     BinaryDataEncoder encoder(usedConfig);
     string encoded;
-    encoder.encode(binaryDataArray.data, encoded);
+    if (!binaryDataArray.isPacked())
+        encoder.encode(binaryDataArray.data, encoded);
+    else if (binaryDataArray.packedType() == BinaryDataType_Float32)
+    {
+        if (binaryDataArray.arrayLength() > 0)
+            encoder.encode(static_cast<const float*>(binaryDataArray.packedData()), binaryDataArray.arrayLength(), encoded);
+    }
+    else
+    {
+        vector<double> data;
+        binaryDataArray.getData(data);
+        encoder.encode(data, encoded);
+    }
     usedConfig = encoder.getConfig(); // config may have changed if numpress error was excessive
 
-    XMLWriter::Attributes attributes;
+    writer.startTag("binaryDataArray");
 
     // primary array types can never override the default array length
     if (!binaryDataArray.hasCVParam(MS_m_z_array) &&
         !binaryDataArray.hasCVParam(MS_time_array) &&
         !binaryDataArray.hasCVParam(MS_intensity_array))
     {
-        attributes.add("arrayLength", binaryDataArray.data.size());
+        writer.attribute("arrayLength", binaryDataArray.arrayLength());
     }
 
-    attributes.add("encodedLength", encoded.size());
+    writer.attribute("encodedLength", encoded.size());
     if (binaryDataArray.dataProcessingPtr.get())
-        attributes.add("dataProcessingRef", encode_xml_id_copy(binaryDataArray.dataProcessingPtr->id));
-
-    writer.startElement("binaryDataArray", attributes);
+        writer.attribute("dataProcessingRef", encode_xml_id_copy(binaryDataArray.dataProcessingPtr->id));
+    writer.endStartTag();
 
     if (BinaryDataEncoder::Numpress_None == usedConfig.numpress)
     {
@@ -1894,18 +1905,17 @@ PWIZ_API_DECL
 void write(minimxml::XMLWriter& writer, const Spectrum& spectrum, const MSData& msd, 
            const BinaryDataEncoder::Config& config)
 {
-    XMLWriter::Attributes attributes;
-    attributes.add("index", spectrum.index);
-    attributes.add("id", spectrum.id); // not an XML:ID
+    writer.startTag("spectrum");
+    writer.attribute("index", spectrum.index);
+    writer.attribute("id", spectrum.id); // not an XML:ID
     if (!spectrum.spotID.empty())
-        attributes.add("spotID", spectrum.spotID);
-    attributes.add("defaultArrayLength", spectrum.defaultArrayLength);
+        writer.attribute("spotID", spectrum.spotID);
+    writer.attribute("defaultArrayLength", spectrum.defaultArrayLength);
     if (spectrum.dataProcessingPtr.get())
-        attributes.add("dataProcessingRef", encode_xml_id_copy(spectrum.dataProcessingPtr->id));
+        writer.attribute("dataProcessingRef", encode_xml_id_copy(spectrum.dataProcessingPtr->id));
     if (spectrum.sourceFilePtr.get())
-        attributes.add("sourceFileRef", encode_xml_id_copy(spectrum.sourceFilePtr->id));
-
-    writer.startElement("spectrum", attributes);
+        writer.attribute("sourceFileRef", encode_xml_id_copy(spectrum.sourceFilePtr->id));
+    writer.endStartTag();
 
     writeParamContainer(writer, spectrum);
 
@@ -1913,9 +1923,9 @@ void write(minimxml::XMLWriter& writer, const Spectrum& spectrum, const MSData&
 
     if (!spectrum.precursors.empty())
     {
-        XMLWriter::Attributes attributes;
-        attributes.add("count", spectrum.precursors.size());
-        writer.startElement("precursorList", attributes);
+        writer.startTag("precursorList");
+        writer.attribute("count", spectrum.precursors.size());
+        writer.endStartTag();
         
         for (vector<Precursor>::const_iterator it=spectrum.precursors.begin(); 
              it!=spectrum.precursors.end(); ++it)
@@ -1926,9 +1936,9 @@ void write(minimxml::XMLWriter& writer, const Spectrum& spectrum, const MSData&
    
     if (!spectrum.products.empty())
     {
-        XMLWriter::Attributes attributes;
-        attributes.add("count", spectrum.products.size());
-        writer.startElement("productList", attributes);
+        writer.startTag("productList");
+        writer.attribute("count", spectrum.products.size());
+        writer.endStartTag();
         
         for (vector<Product>::const_iterator it=spectrum.products.begin(); 
              it!=spectrum.products.end(); ++it)
@@ -1939,9 +1949,9 @@ void write(minimxml::XMLWriter& writer, const Spectrum& spectrum, const MSData&
 
     if (!spectrum.binaryDataArrayPtrs.empty())
     {
-        attributes.clear();
-        attributes.add("count", spectrum.binaryDataArrayPtrs.size());
-        writer.startElement("binaryDataArrayList", attributes);
+        writer.startTag("binaryDataArrayList");
+        writer.attribute("count", spectrum.binaryDataArrayPtrs.size());
+        writer.endStartTag();
 
         for (vector<BinaryDataArrayPtr>::const_iterator it=spectrum.binaryDataArrayPtrs.begin(); 
              it!=spectrum.binaryDataArrayPtrs.end(); ++it)
@@ -2226,11 +2236,27 @@ PWIZ_API_DECL void read(std::istream& is, Chromatogram& chromatogram,
 //
 
 
+namespace {
+
+// renders a spectrum as it would be written at the current position of the writer the fragmentConfig came from
+void renderSpectrum(const Spectrum& spectrum, string& rendered, const MSData& msd,
+                    const BinaryDataEncoder::Config& config,
+                    const XMLWriter::Config& fragmentConfig)
+{
+    rendered.clear(); // keeps its capacity for the next spectrum
+    XMLWriter fragmentWriter(rendered, fragmentConfig);
+    write(fragmentWriter, spectrum, msd, config);
+}
+
+} // namespace
+
+
 PWIZ_API_DECL
 void write(minimxml::XMLWriter& writer, const SpectrumList& spectrumList, const MSData& msd,
            const BinaryDataEncoder::Config& config,
            vector<boost::iostreams::stream_offset>* spectrumPositions,
-           const IterationListenerRegistry* iterationListenerRegistry)
+           const IterationListenerRegistry* iterationListenerRegistry,
+           const SpectrumWorkerThreads::Config& spectrumWorkerThreadsConfig)
 {
     XMLWriter::Attributes attributes;
     attributes.add("count", spectrumList.size());
@@ -2240,7 +2266,11 @@ void write(minimxml::XMLWriter& writer, const SpectrumList& spectrumList, const
                                         spectrumList.dataProcessingPtr()->id));
 
     writer.startElement("spectrumList", attributes);
-    SpectrumWorkerThreads spectrumWorkers(spectrumList);
+
+    // spectra are fetched, encoded and rendered on the worker threads; this thread only appends the rendered XML
+    SpectrumWorkerThreads spectrumWorkers(spectrumList, boost::bind(&renderSpectrum, _1, _2, boost::cref(msd), boost::cref(config), writer.fragmentConfig()),
+                                          spectrumWorkerThreadsConfig);
+    string rendered;
 
     for (size_t i=0; i<spectrumList.size(); i++)
     {
@@ -2263,11 +2293,11 @@ void write(minimxml::XMLWriter& writer, const SpectrumList& spectrumList, const
         // write the spectrum
 
         //SpectrumPtr spectrum = spectrumList.spectrum(i, true);
-        SpectrumPtr spectrum = spectrumWorkers.processBatch(i);
+        SpectrumPtr spectrum = spectrumWorkers.processBatch(i, rendered);
         BOOST_ASSERT(spectrum->binaryDataArrayPtrs.empty() ||
                      spectrum->defaultArrayLength == spectrum->getMZArray()->data.size());
         if (spectrum->index != i) throw runtime_error("[IO::write(SpectrumList)] Bad index.");
-        write(writer, *spectrum, msd, config);
+        writer.fragment(rendered);
     }
 
     writer.endElement();
@@ -2430,7 +2460,8 @@ void write(minimxml::XMLWriter& writer, const Run& run, const MSData& msd,
            const BinaryDataEncoder::Config& config,
            vector<boost::iostreams::stream_offset>* spectrumPositions,
            vector<boost::iostreams::stream_offset>* chromatogramPositions,
-           const pwiz::util::IterationListenerRegistry* iterationListenerRegistry)
+           const pwiz::util::IterationListenerRegistry* iterationListenerRegistry,
+           const SpectrumWorkerThreads::Config& spectrumWorkerThreadsConfig)
 {
     XMLWriter::Attributes attributes;
     attributes.add("id", encode_xml_id_copy(run.id));
@@ -2460,7 +2491,7 @@ void write(minimxml::XMLWriter& writer, const Run& run, const MSData& msd,
     bool hasChromatogramList = run.chromatogramListPtr.get() && run.chromatogramListPtr->size() > 0;
 
     if (hasSpectrumList)
-        write(writer, *run.spectrumListPtr, msd, config, spectrumPositions, iterationListenerRegistry);
+        write(writer, *run.spectrumListPtr, msd, config, spectrumPositions, iterationListenerRegistry, spectrumWorkerThreadsConfig);
 
     if (hasChromatogramList)
         write(writer, *run.chromatogramListPtr, config, chromatogramPositions, iterationListenerRegistry);
@@ -2586,7 +2617,8 @@ void write(minimxml::XMLWriter& writer, const MSData& msd,
            const BinaryDataEncoder::Config& config,
            vector<boost::iostreams::stream_offset>* spectrumPositions,
            vector<boost::iostreams::stream_offset>* chromatogramPositions,
-           const pwiz::util::IterationListenerRegistry* iterationListenerRegistry)
+           const pwiz::util::IterationListenerRegistry* iterationListenerRegistry,
+           const SpectrumWorkerThreads::Config& spectrumWorkerThreadsConfig)
 {
     XMLWriter::Attributes attributes;
     attributes.add("xmlns", "http://psi.hupo.org/ms/mzml");
@@ -2629,7 +2661,7 @@ void write(minimxml::XMLWriter& writer, const MSData& msd,
 
     writeList(writer, msd.allDataProcessingPtrs(), "dataProcessingList");
 
-    write(writer, msd.run, msd, config, spectrumPositions, chromatogramPositions, iterationListenerRegistry);
+    write(writer, msd.run, msd, config, spectrumPositions, chromatogramPositions, iterationListenerRegistry, spectrumWorkerThreadsConfig);
 
     writer.endElement();
 }
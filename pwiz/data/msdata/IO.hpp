@@ -28,6 +28,7 @@
 #include "pwiz/utility/misc/Export.hpp"
 #include "MSData.hpp"
 #include "BinaryDataEncoder.hpp"
+#include "SpectrumWorkerThreads.hpp"
 #include "pwiz/utility/minimxml/XMLWriter.hpp"
 #include "pwiz/utility/misc/IterationListener.hpp"
 #include "boost/iostreams/positioning.hpp"
@@ -197,7 +198,8 @@ PWIZ_API_DECL
 void write(minimxml::XMLWriter& writer, const SpectrumList& spectrumList, const MSData& msd,
            const BinaryDataEncoder::Config& config = BinaryDataEncoder::Config(),
            std::vector<boost::iostreams::stream_offset>* spectrumPositions = 0,
-           const pwiz::util::IterationListenerRegistry* iterationListenerRegistry = 0);
+           const pwiz::util::IterationListenerRegistry* iterationListenerRegistry = 0,
+           const SpectrumWorkerThreads::Config& spectrumWorkerThreadsConfig = SpectrumWorkerThreads::Config());
 PWIZ_API_DECL void read(std::istream& is, SpectrumListSimple& spectrumListSimple);
 
 
@@ -217,7 +219,8 @@ void write(minimxml::XMLWriter& writer, const Run& run, const MSData& msd,
            const BinaryDataEncoder::Config& config = BinaryDataEncoder::Config(),
            std::vector<boost::iostreams::stream_offset>* spectrumPositions = 0,
            std::vector<boost::iostreams::stream_offset>* chromatogramPositions = 0,
-           const pwiz::util::IterationListenerRegistry* iterationListenerRegistry = 0);
+           const pwiz::util::IterationListenerRegistry* iterationListenerRegistry = 0,
+           const SpectrumWorkerThreads::Config& spectrumWorkerThreadsConfig = SpectrumWorkerThreads::Config());
 PWIZ_API_DECL
 void read(std::istream& is, Run& run,
           SpectrumListFlag spectrumListFlag = IgnoreSpectrumList);
@@ -228,7 +231,8 @@ void write(minimxml::XMLWriter& writer, const MSData& msd,
            const BinaryDataEncoder::Config& config = BinaryDataEncoder::Config(),
            std::vector<boost::iostreams::stream_offset>* spectrumPositions = 0,
            std::vector<boost::iostreams::stream_offset>* chromatogramPositions = 0,
-           const pwiz::util::IterationListenerRegistry* iterationListenerRegistry = 0);
+           const pwiz::util::IterationListenerRegistry* iterationListenerRegistry = 0,
+           const SpectrumWorkerThreads::Config& spectrumWorkerThreadsConfig = SpectrumWorkerThreads::Config());
 PWIZ_API_DECL
 void read(std::istream& is, MSData& msd,
           SpectrumListFlag spectrumListFlag = IgnoreSpectrumList);
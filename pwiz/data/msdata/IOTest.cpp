@@ -435,6 +435,20 @@ void testBinaryDataArray(const BinaryDataEncoder::Config& config)
     Diff<BinaryDataArray> diff(a,b);
     if (diff && os_) *os_ << "diff:\n" << diff << endl;
     unit_assert(!diff);
+
+    // packed arrays are written exactly as their unpacked values are
+
+    BinaryDataType packedTypes[] = {BinaryDataType_Float32, BinaryDataType_Int32, BinaryDataType_Float64};
+    BOOST_FOREACH(BinaryDataType type, packedTypes)
+    {
+        BinaryDataArray packed(a);
+        unit_assert(packed.pack(type));
+
+        ostringstream ossPacked;
+        XMLWriter writerPacked(ossPacked);
+        IO::write(writerPacked, packed, config);
+        unit_assert_operator_equal(oss.str(), ossPacked.str());
+    }
 }
 
 
@@ -0,0 +1,303 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#define PWIZ_SOURCE
+
+#include "IndexSidecar.hpp"
+#include "pwiz/data/common/BinaryIndexStream.hpp"
+#include "pwiz/utility/misc/SHA1Calculator.hpp"
+#include "pwiz/utility/misc/Filesystem.hpp"
+#include "pwiz/utility/misc/Std.hpp"
+#include <boost/cstdint.hpp>
+
+
+namespace pwiz {
+namespace msdata {
+
+
+using namespace pwiz::util;
+using data::Index;
+using data::BinaryIndexStream;
+
+
+namespace {
+
+// the sidecar layout:
+//
+// magic (the last character is the format version)
+//
+// fingerprint of the file the index belongs to: size, modification time, and the SHA-1 of its first and last 64 KB
+//
+// sections, each a byte count followed by the bytes:
+//   spectra (BinaryIndexStream of id, index and file offset)
+//   spot ids (BinaryIndexStream of spot id, spectrum index; only spectra with a spot id)
+//   chromatograms (BinaryIndexStream of id, index and file offset)
+//   seek checkpoints (random_access_compressed_ifstream::write_seek_index(); empty if the file is not gzipped)
+//
+// magic again, so a truncated sidecar is never used
+
+const string magic_ = "pwizidx1";
+const size_t hashedBytes_ = 65536;
+
+
+struct Fingerprint
+{
+    boost::uint64_t size;
+    boost::int64_t modificationTime;
+    string hash;
+
+    explicit Fingerprint(const string& filename)
+    :   size(bfs::file_size(filename)),
+        modificationTime(bfs::last_write_time(filename))
+    {
+        ifstream is(filename.c_str(), ios::binary);
+        size_t headBytes = (size_t) min<boost::uint64_t>(size, hashedBytes_);
+        size_t tailBytes = (size_t) min<boost::uint64_t>(size - headBytes, hashedBytes_);
+
+        string buffer(headBytes + tailBytes, '\0');
+        is.read(&buffer[0], headBytes);
+        is.seekg(-(streamoff) tailBytes, ios::end);
+        is.read(&buffer[headBytes], tailBytes);
+        if (!is)
+            throw runtime_error("[IndexSidecar] error reading " + filename);
+
+        hash = SHA1Calculator::hash(buffer);
+    }
+
+    Fingerprint(istream& is)
+    {
+        is.read(reinterpret_cast<char*>(&size), sizeof(size));
+        is.read(reinterpret_cast<char*>(&modificationTime), sizeof(modificationTime));
+        hash.resize(40);
+        is.read(&hash[0], hash.length());
+    }
+
+    void write(ostream& os) const
+    {
+        os.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        os.write(reinterpret_cast<const char*>(&modificationTime), sizeof(modificationTime));
+        os.write(hash.c_str(), hash.length());
+    }
+
+    bool operator==(const Fingerprint& rhs) const
+    {
+        return size == rhs.size && modificationTime == rhs.modificationTime && hash == rhs.hash;
+    }
+};
+
+
+void writeSection(ostream& os, const string& bytes)
+{
+    boost::uint64_t length = bytes.length();
+    os.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    os.write(bytes.c_str(), bytes.length());
+}
+
+bool readSection(istream& is, boost::uint64_t sidecarSize, string& bytes)
+{
+    boost::uint64_t length = 0;
+    is.read(reinterpret_cast<char*>(&length), sizeof(length));
+    if (!is || length > sidecarSize)
+        return false;
+    bytes.resize((size_t) length);
+    if (length > 0)
+        is.read(&bytes[0], bytes.length());
+    return !!is;
+}
+
+
+string indexStreamBytes(vector<Index::Entry>& entries)
+{
+    boost::shared_ptr<stringstream> indexStreamPtr(new stringstream);
+    BinaryIndexStream index(indexStreamPtr);
+    index.create(entries);
+    return indexStreamPtr->str();
+}
+
+void readIndexStream(const string& bytes, vector<Index::Entry>& entries)
+{
+    boost::shared_ptr<stringstream> indexStreamPtr(new stringstream(bytes));
+    BinaryIndexStream index(indexStreamPtr);
+    entries.resize(index.size());
+    for (size_t i=0; i < entries.size(); ++i)
+        entries[i] = *index.find(i);
+}
+
+
+template <typename IdentityType>
+string toIndexStream(const vector<IdentityType>& identities)
+{
+    vector<Index::Entry> entries(identities.size());
+    for (size_t i=0; i < identities.size(); ++i)
+    {
+        entries[i].id = identities[i].id;
+        entries[i].index = identities[i].index;
+        entries[i].offset = identities[i].sourceFilePosition;
+    }
+    return indexStreamBytes(entries);
+}
+
+// an index must be consecutive from 0
+template <typename IdentityType>
+bool fromIndexStream(const string& bytes, vector<IdentityType>& identities)
+{
+    vector<Index::Entry> entries;
+    readIndexStream(bytes, entries);
+    identities.resize(entries.size());
+    for (size_t i=0; i < entries.size(); ++i)
+    {
+        if (entries[i].index != i)
+            return false;
+        identities[i].index = i;
+        identities[i].id = entries[i].id;
+        identities[i].sourceFilePosition = entries[i].offset;
+    }
+    return true;
+}
+
+} // namespace
+
+
+PWIZ_API_DECL IndexSidecar::IndexSidecar(const string& filename) : filename_(filename) {}
+
+PWIZ_API_DECL const string& IndexSidecar::filename() const {return filename_;}
+PWIZ_API_DECL string IndexSidecar::path() const {return filename_ + ".index";}
+
+
+PWIZ_API_DECL bool IndexSidecar::read(vector<SpectrumIdentity>& spectra,
+                                      vector<ChromatogramIdentity>& chromatograms,
+                                      istream* is) const
+{
+    spectra.clear();
+    chromatograms.clear();
+
+    try
+    {
+        if (!bfs::exists(path()))
+            return false;
+
+        boost::uint64_t sidecarSize = bfs::file_size(path());
+        ifstream sidecar(path().c_str(), ios::binary);
+
+        string header(magic_.length(), '\0');
+        sidecar.read(&header[0], header.length());
+        if (!sidecar || header != magic_ || !(Fingerprint(sidecar) == Fingerprint(filename_)))
+            return false;
+
+        string spectrumBytes, spotIdBytes, chromatogramBytes, seekIndexBytes, trailer(magic_.length(), '\0');
+        if (!readSection(sidecar, sidecarSize, spectrumBytes) ||
+            !readSection(sidecar, sidecarSize, spotIdBytes) ||
+            !readSection(sidecar, sidecarSize, chromatogramBytes) ||
+            !readSection(sidecar, sidecarSize, seekIndexBytes) ||
+            !sidecar.read(&trailer[0], trailer.length()) || trailer != magic_)
+            return false;
+
+        vector<Index::Entry> spotIds;
+        readIndexStream(spotIdBytes, spotIds);
+        if (!fromIndexStream(spectrumBytes, spectra) ||
+            !fromIndexStream(chromatogramBytes, chromatograms))
+            throw runtime_error("[IndexSidecar::read] bad index");
+
+        BOOST_FOREACH(const Index::Entry& entry, spotIds)
+        {
+            if (entry.index >= spectra.size())
+                throw runtime_error("[IndexSidecar::read] bad spot id index");
+            spectra[entry.index].spotID = entry.id;
+        }
+
+        random_access_compressed_ifstream* gzis = dynamic_cast<random_access_compressed_ifstream*>(is);
+        if (!seekIndexBytes.empty() && gzis && gzis->getCompressionType() == random_access_compressed_ifstream::GZIP)
+        {
+            istringstream seekIndex(seekIndexBytes);
+            if (!gzis->read_seek_index(seekIndex))
+                throw runtime_error("[IndexSidecar::read] bad seek index");
+        }
+
+        return true;
+    }
+    catch (exception&)
+    {
+        // an unreadable sidecar is treated as a missing one (see IndexSidecar::read)
+        spectra.clear();
+        chromatograms.clear();
+        return false;
+    }
+}
+
+
+PWIZ_API_DECL bool IndexSidecar::write(const vector<SpectrumIdentity>& spectra,
+                                       const vector<ChromatogramIdentity>& chromatograms,
+                                       istream* is) const
+{
+    // write a temporary file and then move it into place, so concurrent readers never see a partial sidecar
+    string tempPath = path() + "." + bfs::unique_path().string();
+
+    try
+    {
+        vector<Index::Entry> spotIds;
+        BOOST_FOREACH(const SpectrumIdentity& si, spectra)
+            if (!si.spotID.empty())
+            {
+                spotIds.push_back(Index::Entry());
+                spotIds.back().id = si.spotID;
+                spotIds.back().index = si.index;
+                spotIds.back().offset = 0;
+            }
+
+        ostringstream seekIndex;
+        random_access_compressed_ifstream* gzis = dynamic_cast<random_access_compressed_ifstream*>(is);
+        if (gzis && gzis->getCompressionType() == random_access_compressed_ifstream::GZIP &&
+            !gzis->write_seek_index(seekIndex))
+            seekIndex.str("");
+
+        {
+            ofstream sidecar(tempPath.c_str(), ios::binary);
+            if (!sidecar)
+                return false;
+
+            sidecar.write(magic_.c_str(), magic_.length());
+            Fingerprint(filename_).write(sidecar);
+            writeSection(sidecar, toIndexStream(spectra));
+            writeSection(sidecar, indexStreamBytes(spotIds));
+            writeSection(sidecar, toIndexStream(chromatograms));
+            writeSection(sidecar, seekIndex.str());
+            sidecar.write(magic_.c_str(), magic_.length());
+
+            sidecar.close();
+            if (!sidecar)
+                throw runtime_error("[IndexSidecar::write] error writing " + tempPath);
+        }
+
+        bfs::rename(tempPath, path());
+        return true;
+    }
+    catch (exception&)
+    {
+        boost::system::error_code ec;
+        bfs::remove(tempPath, ec);
+        return false;
+    }
+}
+
+
+} // namespace msdata
+} // namespace pwiz
@@ -0,0 +1,78 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#ifndef _INDEXSIDECAR_HPP_
+#define _INDEXSIDECAR_HPP_
+
+
+#include "pwiz/utility/misc/Export.hpp"
+#include "MSData.hpp"
+#include <boost/shared_ptr.hpp>
+#include <iosfwd>
+
+
+namespace pwiz {
+namespace msdata {
+
+
+/// a binary file kept next to an mzML, mzXML or MGF file that saves the ids and offsets of its spectra and
+/// chromatograms (and, for a gzipped file, the checkpoints used to seek in it), so that opening the file again
+/// doesn't take a scan through the whole file; the saved index is only used while the file's size, modification
+/// time and a hash of its first and last 64 KB are unchanged
+class PWIZ_API_DECL IndexSidecar
+{
+    public:
+
+    /// the sidecar for filename is filename + ".index"
+    explicit IndexSidecar(const std::string& filename);
+
+    const std::string& filename() const;
+    std::string path() const;
+
+    /// reads the saved index into spectra and chromatograms and restores the seek checkpoints into is
+    /// (if it is a gzipped random_access_compressed_ifstream); returns false, leaving spectra and
+    /// chromatograms empty, if there is no sidecar or it was saved for a different version of the file;
+    /// an unreadable (e.g. truncated) sidecar is not an error either: it also returns false, so that the
+    /// caller falls back to scanning the whole file and then replaces the sidecar
+    bool read(std::vector<SpectrumIdentity>& spectra,
+              std::vector<ChromatogramIdentity>& chromatograms,
+              std::istream* is = 0) const;
+
+    /// saves the index, along with the seek checkpoints of is (if it is a gzipped random_access_compressed_ifstream);
+    /// returns false if the sidecar can't be written (e.g. the file is in a read-only directory)
+    bool write(const std::vector<SpectrumIdentity>& spectra,
+               const std::vector<ChromatogramIdentity>& chromatograms,
+               std::istream* is = 0) const;
+
+    private:
+    std::string filename_;
+};
+
+
+typedef boost::shared_ptr<IndexSidecar> IndexSidecarPtr;
+
+
+} // namespace msdata
+} // namespace pwiz
+
+
+#endif // _INDEXSIDECAR_HPP_
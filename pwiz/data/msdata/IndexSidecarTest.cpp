@@ -0,0 +1,246 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#include "IndexSidecar.hpp"
+#include "DefaultReaderList.hpp"
+#include "MSDataFile.hpp"
+#include "Diff.hpp"
+#include "examples.hpp"
+#include "pwiz/utility/misc/unit.hpp"
+#include "pwiz/utility/misc/Filesystem.hpp"
+#include "pwiz/utility/misc/Std.hpp"
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/device/file_descriptor.hpp>
+#include <boost/iostreams/copy.hpp>
+
+
+using namespace pwiz::util;
+using namespace pwiz::msdata;
+namespace bio = boost::iostreams;
+
+
+ostream* os_ = 0;
+string filenameBase_ = "temp.IndexSidecarTest";
+
+
+void gzip(const string& filename)
+{
+    bio::filtering_istream gz(bio::gzip_compressor() | bio::file_descriptor_source(filename));
+    bio::copy(gz, bio::file_descriptor_sink(filename + ".gz", ios::out|ios::binary));
+}
+
+
+MSDataPtr readWithSidecar(const string& filename)
+{
+    Reader::Config config;
+    config.indexSidecar = true;
+
+    MSDataPtr msd(new MSData);
+    DefaultReaderList readers;
+    readers.read(filename, *msd, 0, config);
+    return msd;
+}
+
+
+void testFormat(MSDataFile::Format format, const string& extension, bool indexed, bool gzipped)
+{
+    if (os_) *os_ << "testFormat: " << extension << (indexed ? " indexed" : "") << (gzipped ? " gzipped" : "") << endl;
+
+    MSData tiny;
+    examples::initializeTiny(tiny);
+    if (format == MSDataFile::Format_mzXML)
+        static_cast<SpectrumListSimple&>(*tiny.run.spectrumListPtr).spectra.pop_back(); // not written to mzXML
+
+    string filename = filenameBase_ + extension;
+    MSDataFile::WriteConfig writeConfig;
+    writeConfig.format = format;
+    writeConfig.indexed = indexed;
+    MSDataFile::write(tiny, filename, writeConfig);
+    if (gzipped)
+    {
+        gzip(filename);
+        bfs::remove(filename);
+        filename += ".gz";
+    }
+
+    IndexSidecar sidecar(filename);
+    bfs::remove(sidecar.path());
+
+    // the sidecar is opt-in
+    MSDataFile plain(filename);
+    unit_assert(!bfs::exists(sidecar.path()));
+
+    // the first read saves the index
+    readWithSidecar(filename);
+    unit_assert(bfs::exists(sidecar.path()));
+
+    vector<SpectrumIdentity> spectra;
+    vector<ChromatogramIdentity> chromatograms;
+    unit_assert(sidecar.read(spectra, chromatograms));
+
+    const SpectrumList& sl = *plain.run.spectrumListPtr;
+    unit_assert_operator_equal(sl.size(), spectra.size());
+    for (size_t i=0; i < sl.size(); ++i)
+    {
+        const SpectrumIdentity& si = sl.spectrumIdentity(i);
+        unit_assert_operator_equal(si.index, spectra[i].index);
+        unit_assert_operator_equal(si.id, spectra[i].id);
+        unit_assert_operator_equal(si.sourceFilePosition, spectra[i].sourceFilePosition);
+        if (format != MSDataFile::Format_MGF) // MGF saves its TITLE in spotID
+            unit_assert_operator_equal(si.spotID, spectra[i].spotID);
+    }
+
+    size_t chromatogramCount = plain.run.chromatogramListPtr.get() ? plain.run.chromatogramListPtr->size() : 0;
+    unit_assert_operator_equal(format == MSDataFile::Format_mzML ? chromatogramCount : 0, chromatograms.size());
+    for (size_t i=0; i < chromatograms.size(); ++i)
+    {
+        const ChromatogramIdentity& ci = plain.run.chromatogramListPtr->chromatogramIdentity(i);
+        unit_assert_operator_equal(ci.id, chromatograms[i].id);
+        unit_assert_operator_equal(ci.sourceFilePosition, chromatograms[i].sourceFilePosition);
+    }
+
+    // later reads use the saved index, and read the same data
+    MSDataPtr second = readWithSidecar(filename);
+    Diff<MSData, DiffConfig> diff(plain, *second);
+    if (diff && os_) *os_ << diff << endl;
+    unit_assert(!diff);
+
+    vector<SpectrumIdentity> renamed(spectra);
+    renamed[0].id = "from the sidecar";
+    unit_assert(sidecar.write(renamed, chromatograms));
+    unit_assert_operator_equal("from the sidecar", readWithSidecar(filename)->run.spectrumListPtr->spectrumIdentity(0).id);
+
+    // a sidecar for a different version of the file is not used, and gets replaced
+    bfs::last_write_time(filename, bfs::last_write_time(filename) - 10);
+    unit_assert(!sidecar.read(spectra, chromatograms));
+    unit_assert(spectra.empty());
+    unit_assert_operator_equal(sl.spectrumIdentity(0).id, readWithSidecar(filename)->run.spectrumListPtr->spectrumIdentity(0).id);
+    unit_assert(sidecar.read(spectra, chromatograms));
+    unit_assert_operator_equal(sl.spectrumIdentity(0).id, spectra[0].id);
+
+    // so is a truncated one
+    string sidecarBytes;
+    {
+        ifstream is(sidecar.path().c_str(), ios::binary);
+        sidecarBytes.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+    }
+    ofstream(sidecar.path().c_str(), ios::binary).write(sidecarBytes.c_str(), sidecarBytes.length() - 1);
+    unit_assert(!sidecar.read(spectra, chromatograms));
+
+    bfs::remove(sidecar.path());
+    bfs::remove(filename);
+}
+
+
+void testSeekIndex()
+{
+    if (os_) *os_ << "testSeekIndex" << endl;
+
+    // several MB of text, so the gzipped file has many access points
+    string filename = filenameBase_ + ".txt";
+    string text;
+    {
+        ostringstream oss;
+        for (size_t i=0; i < 400000; ++i)
+            oss << (i * 2654435761u) % 1000003 << ' ' << i << '\n';
+        text = oss.str();
+        ofstream(filename.c_str(), ios::binary) << text;
+    }
+    gzip(filename);
+
+    string seekIndex;
+    {
+        random_access_compressed_ifstream is((filename + ".gz").c_str());
+        unit_assert(is.getCompressionType() == random_access_compressed_ifstream::GZIP);
+        ostringstream oss;
+        unit_assert(is.write_seek_index(oss));
+        seekIndex = oss.str();
+    }
+    unit_assert(seekIndex.length() > 2 * 32768);
+
+    // a fresh stream seeks with the restored access points
+    random_access_compressed_ifstream is((filename + ".gz").c_str());
+    istringstream iss(seekIndex);
+    unit_assert(is.read_seek_index(iss));
+
+    size_t offsets[] = {text.length() - 100, 0, 1500000, 3333333, 123, text.length() / 2, 1048577, 42};
+    BOOST_FOREACH(size_t offset, offsets)
+    {
+        string buffer(100, '\0');
+        is.seekg(offset);
+        is.read(&buffer[0], buffer.length());
+        unit_assert_operator_equal(text.substr(offset, 100), buffer);
+    }
+
+    // unusable access points are rejected, and the stream builds its own
+    random_access_compressed_ifstream is2((filename + ".gz").c_str());
+    istringstream garbage("not a seek index");
+    unit_assert(!is2.read_seek_index(garbage));
+    string buffer(100, '\0');
+    is2.seekg(3333333);
+    is2.read(&buffer[0], buffer.length());
+    unit_assert_operator_equal(text.substr(3333333, 100), buffer);
+
+    // uncompressed files don't have access points
+    random_access_compressed_ifstream plain(filename.c_str());
+    ostringstream oss;
+    unit_assert(!plain.write_seek_index(oss));
+
+    bfs::remove(filename);
+    bfs::remove(filename + ".gz");
+}
+
+
+void test()
+{
+    testFormat(MSDataFile::Format_mzML, ".mzML", true, false);
+    testFormat(MSDataFile::Format_mzML, ".mzML", false, false);
+    testFormat(MSDataFile::Format_mzML, ".mzML", true, true);
+    testFormat(MSDataFile::Format_mzML, ".mzML", false, true);
+    testFormat(MSDataFile::Format_mzXML, ".mzXML", true, false);
+    testFormat(MSDataFile::Format_mzXML, ".mzXML", false, true);
+    testFormat(MSDataFile::Format_MGF, ".mgf", false, false);
+    testSeekIndex();
+}
+
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(argc, argv)
+
+    try
+    {
+        if (argc>1 && !strcmp(argv[1],"-v")) os_ = &cout;
+        test();
+    }
+    catch (exception& e)
+    {
+        TEST_FAILED(e.what())
+    }
+    catch (...)
+    {
+        TEST_FAILED("Caught unknown exception.")
+    }
+
+    TEST_EPILOG
+}
@@ -38,20 +38,24 @@ namespace msdata {
 
 struct Index_mzML::Impl
 {
-    Impl(const boost::shared_ptr<std::istream>& is, int schemaVersion)
-        : is_(is), schemaVersion_(schemaVersion),
+    Impl(const boost::shared_ptr<std::istream>& is, int schemaVersion, const IndexSidecarPtr& sidecar)
+        : is_(is), schemaVersion_(schemaVersion), sidecar_(sidecar),
           spectrumCount_(0), chromatogramCount_(0)
     {
-        createIndex();
+        if (!readSidecar())
+            createIndex();
     }
 
     void recreate() const;
     void readIndex() const;
     void createIndex() const;
     void createMaps() const;
+    bool readSidecar() const;
+    void writeSidecar() const;
 
     boost::shared_ptr<std::istream> is_;
     int schemaVersion_;
+    IndexSidecarPtr sidecar_;
 
     mutable size_t spectrumCount_;
     mutable vector<SpectrumIdentityFromXML> spectrumIndex_;
@@ -359,6 +363,8 @@ void Index_mzML::Impl::createIndex() const
 
     spectrumIndex_.clear();
     chromatogramIndex_.clear();
+    legacyIdRefToNativeId_.clear();
+    spectrumCount_ = chromatogramCount_ = 0;
 
     // resize the index assuming the count attribute is accurate
     //index_.resize(size_);
@@ -378,9 +384,36 @@ void Index_mzML::Impl::createIndex() const
         SAXParser::parse(*is_, handler);
     }
 
+    writeSidecar();
     createMaps();
 }
 
+bool Index_mzML::Impl::readSidecar() const
+{
+    vector<SpectrumIdentity> spectra;
+    if (!sidecar_ || !sidecar_->read(spectra, chromatogramIndex_, is_.get()))
+        return false;
+
+    spectrumIndex_.resize(spectra.size());
+    for (size_t i=0; i < spectra.size(); ++i)
+        static_cast<SpectrumIdentity&>(spectrumIndex_[i]) = spectra[i];
+    spectrumCount_ = spectrumIndex_.size();
+    chromatogramCount_ = chromatogramIndex_.size();
+
+    createMaps();
+    return true;
+}
+
+void Index_mzML::Impl::writeSidecar() const
+{
+    // mzML 1.0 idRef to nativeID mappings are not saved, so neither is their index
+    if (!sidecar_ || !legacyIdRefToNativeId_.empty())
+        return;
+
+    vector<SpectrumIdentity> spectra(spectrumIndex_.begin(), spectrumIndex_.end());
+    sidecar_->write(spectra, chromatogramIndex_, is_.get());
+}
+
 void Index_mzML::Impl::createMaps() const
 {
     // actually just init - build when/if actually called for
@@ -390,8 +423,8 @@ void Index_mzML::Impl::createMaps() const
 }
 
 
-PWIZ_API_DECL Index_mzML::Index_mzML(boost::shared_ptr<std::istream> is, const MSData& msd)
-: impl_(new Impl(is, bal::starts_with(msd.version(), "1.0") ? 1 : 0))
+PWIZ_API_DECL Index_mzML::Index_mzML(boost::shared_ptr<std::istream> is, const MSData& msd, const IndexSidecarPtr& sidecar)
+: impl_(new Impl(is, bal::starts_with(msd.version(), "1.0") ? 1 : 0, sidecar))
 {}
 
 PWIZ_API_DECL void Index_mzML::recreate() {impl_->createIndex();}
@@ -26,6 +26,7 @@
 
 #include "pwiz/utility/misc/Export.hpp"
 #include "MSData.hpp"
+#include "IndexSidecar.hpp"
 #include <boost/shared_ptr.hpp>
 #include <iosfwd>
 #include <map>
@@ -38,7 +39,9 @@ struct SpectrumIdentityFromXML; // forward ref
 
 struct PWIZ_API_DECL Index_mzML
 {
-    Index_mzML(boost::shared_ptr<std::istream> is, const MSData& msd);
+    /// if sidecar is set, the index is read from it when it is up to date, and saved to it after it is created
+    Index_mzML(boost::shared_ptr<std::istream> is, const MSData& msd,
+               const IndexSidecarPtr& sidecar = IndexSidecarPtr());
 
     void recreate();
 
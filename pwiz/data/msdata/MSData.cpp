@@ -25,6 +25,7 @@
 #include "MSData.hpp"
 #include "pwiz/utility/misc/Std.hpp"
 #include <boost/lexical_cast.hpp>
+#include <boost/math/special_functions/sign.hpp>
 #include "Diff.hpp"
 
 namespace pwiz {
@@ -429,14 +430,202 @@ PWIZ_API_DECL bool ScanList::empty() const
 //
 
 
+namespace {
+
+template <typename value_type>
+bool isRepresentable(double value)
+{
+    // the range check also rejects NaN; the bounds are powers of two, so they are exact as doubles
+    return value >= double(numeric_limits<value_type>::min()) &&
+           value < -double(numeric_limits<value_type>::min()) &&
+           double(value_type(value)) == value &&
+           !(value == 0 && boost::math::signbit(value)); // negative zero would come back positive
+}
+
+template <>
+bool isRepresentable<float>(double value)
+{
+    if (value != value || fabs(value) == numeric_limits<double>::infinity())
+        return true;
+    return fabs(value) <= numeric_limits<float>::max() && double(float(value)) == value;
+}
+
+template <>
+bool isRepresentable<double>(double value)
+{
+    return true;
+}
+
+template <typename value_type>
+bool allRepresentable(const vector<double>& data)
+{
+    for (size_t i=0; i < data.size(); ++i)
+        if (!isRepresentable<value_type>(data[i]))
+            return false;
+    return true;
+}
+
+template <typename value_type>
+void packValues(const vector<double>& data, vector<unsigned char>& packed)
+{
+    packed.resize(data.size() * sizeof(value_type));
+    if (data.empty()) return;
+    value_type* values = reinterpret_cast<value_type*>(&packed[0]);
+    for (size_t i=0; i < data.size(); ++i)
+        values[i] = value_type(data[i]);
+}
+
+template <typename value_type>
+void unpackValues(const vector<unsigned char>& packed, size_t length, vector<double>& data)
+{
+    data.resize(length);
+    if (!length) return;
+    const value_type* values = reinterpret_cast<const value_type*>(&packed[0]);
+    for (size_t i=0; i < length; ++i)
+        data[i] = double(values[i]);
+}
+
+} // namespace
+
+
+PWIZ_API_DECL BinaryDataArray::BinaryDataArray()
+:   packed_(false), packedType_(BinaryDataType_Float64), packedLength_(0)
+{
+}
+
+
 PWIZ_API_DECL bool BinaryDataArray::empty() const
 {
     return (!dataProcessingPtr.get() || dataProcessingPtr->empty()) && 
-           data.empty() && 
+           arrayLength() == 0 && 
            ParamContainer::empty();
 }
 
 
+PWIZ_API_DECL bool BinaryDataArray::canPack(BinaryDataType type) const
+{
+    switch (type)
+    {
+        case BinaryDataType_Float64: return allRepresentable<double>(data);
+        case BinaryDataType_Float32: return allRepresentable<float>(data);
+        case BinaryDataType_Int64: return allRepresentable<long long>(data);
+        case BinaryDataType_Int32: return allRepresentable<int>(data);
+        default: throw runtime_error("[BinaryDataArray::canPack()] Unknown binary data type.");
+    }
+}
+
+
+PWIZ_API_DECL bool BinaryDataArray::pack(BinaryDataType type)
+{
+    if (packed_)
+    {
+        if (type == packedType_)
+            return true;
+
+        // repack from the widened values, restoring the original packing if the new type doesn't fit
+        BinaryDataType originalType = packedType_;
+        unpack();
+        if (pack(type))
+            return true;
+        pack(originalType);
+        return false;
+    }
+
+    if (!canPack(type))
+        return false;
+
+    switch (type)
+    {
+        case BinaryDataType_Float64: packValues<double>(data, packedData_); break;
+        case BinaryDataType_Float32: packValues<float>(data, packedData_); break;
+        case BinaryDataType_Int64: packValues<long long>(data, packedData_); break;
+        case BinaryDataType_Int32: packValues<int>(data, packedData_); break;
+    }
+
+    packed_ = true;
+    packedType_ = type;
+    packedLength_ = data.size();
+    vector<double>().swap(data); // release the memory, not just the values
+    return true;
+}
+
+
+PWIZ_API_DECL void BinaryDataArray::unpack()
+{
+    if (!packed_)
+        return;
+
+    getData(data);
+    packed_ = false;
+    packedType_ = BinaryDataType_Float64;
+    packedLength_ = 0;
+    vector<unsigned char>().swap(packedData_);
+}
+
+
+PWIZ_API_DECL void BinaryDataArray::getData(vector<double>& output) const
+{
+    if (!packed_)
+    {
+        output = data;
+        return;
+    }
+
+    switch (packedType_)
+    {
+        case BinaryDataType_Float64: unpackValues<double>(packedData_, packedLength_, output); break;
+        case BinaryDataType_Float32: unpackValues<float>(packedData_, packedLength_, output); break;
+        case BinaryDataType_Int64: unpackValues<long long>(packedData_, packedLength_, output); break;
+        case BinaryDataType_Int32: unpackValues<int>(packedData_, packedLength_, output); break;
+    }
+}
+
+
+namespace {
+
+// Spectrum and Chromatogram replace their array pointers rather than packing the arrays in place,
+// because the arrays may be shared with other spectra (e.g. a cached copy)
+
+size_t packBinaryDataArrays(vector<BinaryDataArrayPtr>& arrays, BinaryDataType type)
+{
+    size_t packedCount = 0;
+    BOOST_FOREACH(BinaryDataArrayPtr& array, arrays)
+    {
+        if (!array.get() || array->isPacked() || !array->canPack(type))
+            continue;
+
+        BinaryDataArrayPtr packed(new BinaryDataArray(*array));
+        packed->pack(type);
+        array = packed;
+        ++packedCount;
+    }
+    return packedCount;
+}
+
+void unpackBinaryDataArrays(vector<BinaryDataArrayPtr>& arrays)
+{
+    BOOST_FOREACH(BinaryDataArrayPtr& array, arrays)
+    {
+        if (!array.get() || !array->isPacked())
+            continue;
+
+        BinaryDataArrayPtr unpacked(new BinaryDataArray(*array));
+        unpacked->unpack();
+        array = unpacked;
+    }
+}
+
+bool hasPackedBinaryDataArrays(const vector<BinaryDataArrayPtr>& arrays)
+{
+    BOOST_FOREACH(const BinaryDataArrayPtr& array, arrays)
+        if (array.get() && array->isPacked())
+            return true;
+    return false;
+}
+
+} // namespace
+
+
 //
 // MZIntensityPair 
 //
@@ -628,6 +817,24 @@ PWIZ_API_DECL bool Spectrum::empty() const
 }
 
 
+PWIZ_API_DECL size_t Spectrum::packBinaryData(BinaryDataType type)
+{
+    return packBinaryDataArrays(binaryDataArrayPtrs, type);
+}
+
+
+PWIZ_API_DECL void Spectrum::unpackBinaryData()
+{
+    unpackBinaryDataArrays(binaryDataArrayPtrs);
+}
+
+
+PWIZ_API_DECL bool Spectrum::hasPackedBinaryData() const
+{
+    return hasPackedBinaryDataArrays(binaryDataArrayPtrs);
+}
+
+
 namespace {
 
 pair<BinaryDataArrayPtr,BinaryDataArrayPtr> 
@@ -883,6 +1090,24 @@ PWIZ_API_DECL bool Chromatogram::empty() const
 }
 
 
+PWIZ_API_DECL size_t Chromatogram::packBinaryData(BinaryDataType type)
+{
+    return packBinaryDataArrays(binaryDataArrayPtrs, type);
+}
+
+
+PWIZ_API_DECL void Chromatogram::unpackBinaryData()
+{
+    unpackBinaryDataArrays(binaryDataArrayPtrs);
+}
+
+
+PWIZ_API_DECL bool Chromatogram::hasPackedBinaryData() const
+{
+    return hasPackedBinaryDataArrays(binaryDataArrayPtrs);
+}
+
+
 namespace {
 
 pair<BinaryDataArrayPtr,BinaryDataArrayPtr> 
@@ -1126,7 +1351,13 @@ PWIZ_API_DECL void SpectrumList::warn_once(const char *msg) const
 
 PWIZ_API_DECL const SpectrumIdentity& SpectrumListSimple::spectrumIdentity(size_t index) const
 {
-    return *spectrum(index, false);
+    if (index >= size())
+        throw runtime_error("[MSData::SpectrumListSimple::spectrumIdentity()] Invalid index.");
+
+    if (!spectra[index].get())
+        throw runtime_error("[MSData::SpectrumListSimple::spectrumIdentity()] Null SpectrumPtr.");
+
+    return *spectra[index];
 }
 
 
@@ -1140,6 +1371,14 @@ PWIZ_API_DECL SpectrumPtr SpectrumListSimple::spectrum(size_t index, bool getBin
     if (!spectra[index].get())
         throw runtime_error("[MSData::SpectrumListSimple::spectrum()] Null SpectrumPtr.");
 
+    // packed arrays are widened for the caller without unpacking the stored spectrum
+    if (spectra[index]->hasPackedBinaryData())
+    {
+        SpectrumPtr result(new Spectrum(*spectra[index]));
+        result->unpackBinaryData();
+        return result;
+    }
+
     return spectra[index];
 }
 
@@ -1183,7 +1422,13 @@ PWIZ_API_DECL const shared_ptr<const DataProcessing> ChromatogramList::dataProce
 
 PWIZ_API_DECL const ChromatogramIdentity& ChromatogramListSimple::chromatogramIdentity(size_t index) const
 {
-    return *chromatogram(index, false);
+    if (index >= size())
+        throw runtime_error("[MSData::ChromatogramListSimple::chromatogramIdentity()] Invalid index.");
+
+    if (!chromatograms[index].get())
+        throw runtime_error("[MSData::ChromatogramListSimple::chromatogramIdentity()] Null ChromatogramPtr.");
+
+    return *chromatograms[index];
 }
 
 
@@ -1197,6 +1442,14 @@ PWIZ_API_DECL ChromatogramPtr ChromatogramListSimple::chromatogram(size_t index,
     if (!chromatograms[index].get())
         throw runtime_error("[MSData::ChromatogramListSimple::chromatogram()] Null ChromatogramPtr.");
 
+    // packed arrays are widened for the caller without unpacking the stored chromatogram
+    if (chromatograms[index]->hasPackedBinaryData())
+    {
+        ChromatogramPtr result(new Chromatogram(*chromatograms[index]));
+        result->unpackBinaryData();
+        return result;
+    }
+
     return chromatograms[index];
 }
 
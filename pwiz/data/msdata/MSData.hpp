@@ -399,7 +399,20 @@ struct PWIZ_API_DECL ScanList : public ParamContainer
 };
 
 
+/// native value types a BinaryDataArray can be packed into
+enum PWIZ_API_DECL BinaryDataType
+{
+    BinaryDataType_Float64,
+    BinaryDataType_Float32,
+    BinaryDataType_Int64,
+    BinaryDataType_Int32
+};
+
+
 /// The structure into which encoded binary data goes. Byte ordering is always little endian (Intel style). Computers using a different endian style MUST convert to/from little endian when writing/reading mzML
+/// note: the values are normally held as doubles in data; an array can instead be packed into a narrower
+/// native type (e.g. the 32-bit floats most intensities are acquired as) to hold it at a fraction of the
+/// memory, in which case data is empty until the array is unpacked again
 struct PWIZ_API_DECL BinaryDataArray : public ParamContainer
 {
     /// this optional attribute may reference the 'id' attribute of the appropriate dataProcessing.
@@ -408,8 +421,41 @@ struct PWIZ_API_DECL BinaryDataArray : public ParamContainer
     /// the binary data.
     std::vector<double> data;
 
+    BinaryDataArray();
+
     /// returns true iff the element contains no params and all members are empty or null
     bool empty() const;
+
+    /// returns true iff every value in data is exactly representable in the given type
+    bool canPack(BinaryDataType type) const;
+
+    /// moves data into packed storage of the given type if every value is exactly representable in it;
+    /// otherwise returns false and leaves the array unchanged
+    bool pack(BinaryDataType type);
+
+    /// moves packed values back into data; does nothing if the array is not packed
+    void unpack();
+
+    /// returns true iff the values are held in packed storage instead of in data
+    bool isPacked() const {return packed_;}
+
+    /// returns the type of the packed values
+    BinaryDataType packedType() const {return packedType_;}
+
+    /// returns the packed values, which are of packedType() (e.g. const float* for BinaryDataType_Float32)
+    const void* packedData() const {return packedData_.empty() ? 0 : &packedData_[0];}
+
+    /// returns the number of values, whether packed or not
+    size_t arrayLength() const {return packed_ ? packedLength_ : data.size();}
+
+    /// copies the values into output as doubles, whether packed or not
+    void getData(std::vector<double>& output) const;
+
+    private:
+    bool packed_;
+    BinaryDataType packedType_;
+    size_t packedLength_;
+    std::vector<unsigned char> packedData_;
 };
 
 
@@ -534,9 +580,19 @@ struct PWIZ_API_DECL Spectrum : public SpectrumIdentity, public ParamContainer
     bool hasBinaryData() const {
         return binaryDataArrayPtrs.size() && 
                binaryDataArrayPtrs[0] &&
-              !binaryDataArrayPtrs[0]->data.empty();
+               binaryDataArrayPtrs[0]->arrayLength() > 0;
     };
 
+    /// replaces each binary data array that can be packed losslessly into the given type with a packed copy;
+    /// returns the number of arrays packed (the original arrays are not modified, so they may be shared)
+    size_t packBinaryData(BinaryDataType type = BinaryDataType_Float32);
+
+    /// replaces each packed binary data array with an unpacked copy (the packed arrays are not modified)
+    void unpackBinaryData();
+
+    /// returns true iff any binary data array is packed
+    bool hasPackedBinaryData() const;
+
     /// copy binary data arrays into m/z-intensity pair array
     void getMZIntensityPairs(std::vector<MZIntensityPair>& output) const;
 
@@ -592,6 +648,16 @@ struct PWIZ_API_DECL Chromatogram : public ChromatogramIdentity, public ParamCon
     /// returns true iff the element contains no params and all members are empty or null
     bool empty() const;
 
+    /// replaces each binary data array that can be packed losslessly into the given type with a packed copy;
+    /// returns the number of arrays packed (the original arrays are not modified, so they may be shared)
+    size_t packBinaryData(BinaryDataType type = BinaryDataType_Float32);
+
+    /// replaces each packed binary data array with an unpacked copy (the packed arrays are not modified)
+    void unpackBinaryData();
+
+    /// returns true iff any binary data array is packed
+    bool hasPackedBinaryData() const;
+
     /// copy binary data arrays into time-intensity pair array
     void getTimeIntensityPairs(std::vector<TimeIntensityPair>& output) const;
 
@@ -708,7 +774,8 @@ typedef boost::shared_ptr<SpectrumList> SpectrumListPtr;
 
 
 /// Simple writeable in-memory implementation of SpectrumList.
-/// Note:  This spectrum() implementation returns internal SpectrumPtrs.
+/// Note:  This spectrum() implementation returns internal SpectrumPtrs, except for spectra with packed
+///        binary data arrays (see Spectrum::packBinaryData()), which are returned as unpacked copies.
 struct PWIZ_API_DECL SpectrumListSimple : public SpectrumList
 {
     std::vector<SpectrumPtr> spectra;
@@ -782,7 +849,8 @@ typedef boost::shared_ptr<ChromatogramList> ChromatogramListPtr;
 
 
 /// Simple writeable in-memory implementation of ChromatogramList.
-/// Note:  This chromatogram() implementation returns internal ChromatogramPtrs.
+/// Note:  This chromatogram() implementation returns internal ChromatogramPtrs, except for chromatograms with
+///        packed binary data arrays (see Chromatogram::packBinaryData()), which are returned as unpacked copies.
 struct PWIZ_API_DECL ChromatogramListSimple : public ChromatogramList
 {
     std::vector<ChromatogramPtr> chromatograms;
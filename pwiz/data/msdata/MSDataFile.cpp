@@ -36,6 +36,7 @@
 #include "pwiz/utility/misc/Filesystem.hpp"
 #include "pwiz/utility/misc/Std.hpp"
 #include "pwiz/utility/misc/SHA1Calculator.hpp"
+#include "pwiz/utility/misc/block_gzip_compressor.hpp"
 #include "pwiz/utility/minimxml/XMLWriter.hpp" // for charcounter defn
 #include "boost/iostreams/device/file.hpp"
 #include "boost/iostreams/filtering_stream.hpp" 
@@ -117,7 +118,7 @@ void MSDataFile::write(ostream& os,
 namespace {
 
 
-shared_ptr<ostream> openFile(const string& filename, bool gzipped)
+shared_ptr<ostream> openFile(const string& filename, bool gzipped, bool blockGzipped)
 {
     if (gzipped) 
     {   // use boost's filter stack to count outgoing bytes, and gzip them
@@ -126,7 +127,10 @@ shared_ptr<ostream> openFile(const string& filename, bool gzipped)
         if (filt)
         {
         filt->push(pwiz::minimxml::charcounter()); // for counting bytes before compression
-        filt->push(boost::iostreams::gzip_compressor(9)); // max compression
+        if (blockGzipped)
+            filt->push(block_gzip_compressor(9)); // max compression, in parallel
+        else
+            filt->push(boost::iostreams::gzip_compressor(9)); // max compression
         filt->push(boost::iostreams::file_sink(filename.c_str(), ios::binary));
         }
         if (!result.get() || !*result || !filt->good())
@@ -159,6 +163,7 @@ void writeStream(ostream& os, const MSData& msd, const MSDataFile::WriteConfig&
             Serializer_mzML::Config serializerConfig;
             serializerConfig.binaryDataEncoderConfig = config.binaryDataEncoderConfig;
             serializerConfig.indexed = config.indexed;
+            serializerConfig.spectrumWorkerThreadsConfig = config.spectrumWorkerThreadsConfig;
             Serializer_mzML serializer(serializerConfig);
             serializer.write(os, msd, iterationListenerRegistry);
             break;
@@ -168,37 +173,38 @@ void writeStream(ostream& os, const MSData& msd, const MSDataFile::WriteConfig&
             Serializer_mzXML::Config serializerConfig;
             serializerConfig.binaryDataEncoderConfig = config.binaryDataEncoderConfig;
             serializerConfig.indexed = config.indexed;
+            serializerConfig.spectrumWorkerThreadsConfig = config.spectrumWorkerThreadsConfig;
             Serializer_mzXML serializer(serializerConfig);
             serializer.write(os, msd, iterationListenerRegistry);
             break;
         }
         case MSDataFile::Format_MGF:
         {
-            Serializer_MGF serializer;
+            Serializer_MGF serializer(config.spectrumWorkerThreadsConfig);
             serializer.write(os, msd, iterationListenerRegistry);
             break;
         }
         case MSDataFile::Format_MS1:
         {
-            Serializer_MSn serializer(MSn_Type_MS1);
+            Serializer_MSn serializer(MSn_Type_MS1, config.spectrumWorkerThreadsConfig);
             serializer.write(os, msd, iterationListenerRegistry);
             break;
         }
         case MSDataFile::Format_CMS1:
         {
-            Serializer_MSn serializer(MSn_Type_CMS1);
+            Serializer_MSn serializer(MSn_Type_CMS1, config.spectrumWorkerThreadsConfig);
             serializer.write(os, msd, iterationListenerRegistry);
             break;
         }
         case MSDataFile::Format_MS2:
         {
-            Serializer_MSn serializer(MSn_Type_MS2);
+            Serializer_MSn serializer(MSn_Type_MS2, config.spectrumWorkerThreadsConfig);
             serializer.write(os, msd, iterationListenerRegistry);
             break;
         }
         case MSDataFile::Format_CMS2:
         {
-            Serializer_MSn serializer(MSn_Type_CMS2);
+            Serializer_MSn serializer(MSn_Type_CMS2, config.spectrumWorkerThreadsConfig);
             serializer.write(os, msd, iterationListenerRegistry);
             break;
         }
@@ -233,7 +239,7 @@ void MSDataFile::write(const MSData& msd,
         }
         default:
         {
-            shared_ptr<ostream> os = openFile(filename,config.gzipped);
+            shared_ptr<ostream> os = openFile(filename,config.gzipped,config.blockGzipped);
             writeStream(*os, msd, config, iterationListenerRegistry);
         }
     }
@@ -29,6 +29,7 @@
 #include "MSData.hpp"
 #include "Reader.hpp"
 #include "BinaryDataEncoder.hpp"
+#include "SpectrumWorkerThreads.hpp"
 #include "pwiz/utility/misc/IterationListener.hpp"
 
 
@@ -55,9 +56,11 @@ struct PWIZ_API_DECL MSDataFile : public MSData
         BinaryDataEncoder::Config binaryDataEncoderConfig;
         bool indexed;
 		bool gzipped; // if true, file is written as .gz
+        bool blockGzipped; // if true (with gzipped), the .gz is independent blocks, compressed in parallel and seekable without a decompression pass
+        SpectrumWorkerThreads::Config spectrumWorkerThreadsConfig; // threads that fetch spectra ahead of the writer (numThreads 0 = hardware_concurrency, useThreads false = none)
 
         WriteConfig(Format _format = Format_mzML,bool _gzipped = false)
-        :   format(_format), indexed(true), gzipped(_gzipped)
+        :   format(_format), indexed(true), gzipped(_gzipped), blockGzipped(false)
         {}
     };
 
@@ -169,6 +169,18 @@ void validateWriteRead(const MSDataFile::WriteConfig& writeConfig,
         if (diff && os_) *os_ << diff << endl;
         unit_assert(!diff);
 
+        // and the block gzip writer, which the reader seeks in with the block headers
+        MSDataFile::WriteConfig blockGzipConfig(writeConfig);
+        blockGzipConfig.gzipped = blockGzipConfig.blockGzipped = true;
+        msd1.write(filename2 + ".gz", blockGzipConfig);
+
+        MSDataFile msd6(filename2 + ".gz");
+        hackInMemoryMSData(msd6);
+
+        diff(tiny, msd6);
+        if (diff && os_) *os_ << diff << endl;
+        unit_assert(!diff);
+
         // test writing to a stream
         ostringstream oss;
         msd1.write(oss, writeConfig);
@@ -217,6 +229,7 @@ void validateWriteRead(const MSDataFile::WriteConfig& writeConfig,
     boost::filesystem::remove(filename1);
     boost::filesystem::remove(filename2);
     boost::filesystem::remove(filename1 + ".gz");
+    boost::filesystem::remove(filename2 + ".gz");
     boost::filesystem::remove(filename3);
     boost::filesystem::remove(filename4);
     //boost::filesystem::remove(filename5);
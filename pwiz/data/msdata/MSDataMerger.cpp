@@ -26,8 +26,13 @@
 #include "MSDataMerger.hpp"
 #include "pwiz/utility/misc/Std.hpp"
 #include "pwiz/utility/misc/DateTime.hpp"
+#include "pwiz/utility/misc/sharded_cache.hpp"
 #include "Diff.hpp"
 #include "References.hpp"
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/locks.hpp>
+#include <queue>
+#include <functional>
 
 
 using boost::shared_ptr;
@@ -53,61 +58,103 @@ void mergeParamContainers(ParamContainer& target, const ParamContainer& source)
 
 class SpectrumListMerger : public SpectrumList
 {
+    public:
+
+    // one input run: either resident, or read from its file when its spectra are asked for
+    struct Run
+    {
+        MSDataPtr msd;
+        string filename;
+        int runIndex;
+        size_t spectrumCount;
+    };
+
     struct IndexEntry : public SpectrumIdentity
     {
-        SpectrumListPtr spectrumListPtr;
-        SourceFilePtr sourceFilePtr;
+        size_t run;
         size_t originalIndex;
+        double scanTime;
     };
 
-    const MSData& msd_;
-    vector<MSDataPtr> inputMSDataPtrs_;
-    vector<IndexEntry> index_;
-    map<string, IndexList> idToIndexes_;
-
-    public:
-    SpectrumListMerger(const MSData& msd, const vector<MSDataPtr>& inputs)
-    : msd_(msd), inputMSDataPtrs_(inputs)
+    // a run that has been read but not yet added
+    struct PendingRun
     {
-        BOOST_FOREACH(const MSDataPtr& input, inputs)
-            for (size_t i=0; i < input->run.spectrumListPtr->size(); ++i)
-            {
-                SpectrumPtr s = input->run.spectrumListPtr->spectrum(i);
-                Spectrum& oldIdentity = *s;
-
-                idToIndexes_[oldIdentity.id].push_back(index_.size());
+        shared_ptr<Run> run;
+        shared_ptr<vector<IndexEntry> > entries;
+    };
 
-                IndexEntry ie;
-                ie.id = oldIdentity.id;
-                ie.index = index_.size();
-                ie.originalIndex = i;
-                ie.spectrumListPtr = input->run.spectrumListPtr;
+    SpectrumListMerger(const MSData& msd, const MSDataMerger::Config& config, const ReaderList* readers)
+    :   msd_(msd), config_(config), readers_(readers), indexed_(true),
+        openRuns_(cache_config(config.maxOpenRuns))
+    {}
 
-                // because of the high chance of duplicate ids, sourceFilePtrs are always explicit
-                SourceFilePtr oldSourceFilePtr = oldIdentity.sourceFilePtr.get() ? oldIdentity.sourceFilePtr : input->run.defaultSourceFilePtr;
-                if (oldSourceFilePtr.get())
-                    ie.sourceFilePtr = SourceFilePtr(new SourceFile(input->run.id + "_" + oldSourceFilePtr->id));
+    // notes the run's ids (and scan times, if interleaving) for addRun(), which can't fail
+    PendingRun prepareRun(const MSDataPtr& msd, const string& filename, int runIndex) const
+    {
+        const SpectrumList& sl = *msd->run.spectrumListPtr;
+
+        PendingRun pending;
+        pending.run.reset(new Run);
+        pending.run->filename = filename;
+        pending.run->runIndex = runIndex;
+        pending.run->spectrumCount = sl.size();
+        if (filename.empty())
+            pending.run->msd = msd;
+
+        pending.entries.reset(new vector<IndexEntry>(sl.size()));
+        double scanTime = 0;
+        for (size_t i=0; i < sl.size(); ++i)
+        {
+            IndexEntry& ie = (*pending.entries)[i];
+            ie.id = sl.spectrumIdentity(i).id;
+            ie.originalIndex = i;
 
-                index_.push_back(ie);
+            // a spectrum without a time stays next to the one before it
+            if (config_.interleaveByScanTime)
+            {
+                SpectrumPtr s = sl.spectrum(i, false);
+                if (!s->scanList.scans.empty())
+                {
+                    CVParam scanStartTime = s->scanList.scans[0].cvParam(MS_scan_start_time);
+                    if (!scanStartTime.empty())
+                        scanTime = scanStartTime.timeInSeconds();
+                }
             }
+            ie.scanTime = scanTime;
+        }
+        return pending;
+    }
+
+    // the merged index is made at first use; a run read from a file is not kept, so the file is closed
+    // when the caller lets go of it, and reopened when its spectra are asked for
+    void addRun(const PendingRun& pending)
+    {
+        boost::lock_guard<boost::mutex> lock(mutex_);
+        BOOST_FOREACH(IndexEntry& ie, *pending.entries)
+            ie.run = runs_.size();
+
+        runs_.push_back(pending.run);
+        runEntries_.push_back(pending.entries);
+        indexed_ = false;
     }
 
-    virtual size_t size() const {return index_.size();}
+    virtual size_t size() const {return index().size();}
 
     virtual const SpectrumIdentity& spectrumIdentity(size_t index) const
     {
         if (index >= size())
             throw runtime_error("[SpectrumListMerger::spectrumIdentity()] Bad index: " + lexical_cast<string>(index));
 
-        return index_[index];
+        return *index_[index];
     }
 
     virtual size_t find(const string& id) const
     {
-        map<string, IndexList>::const_iterator itr = idToIndexes_.find(id);
-        if (itr == idToIndexes_.end())
+        index();
+        map<string, size_t>::const_iterator itr = idToIndex_.find(id);
+        if (itr == idToIndex_.end())
             return size();
-        return itr->second[0]; // TODO: address duplicate ids when sourceFilePtr is disregarded...
+        return itr->second; // TODO: address duplicate ids when sourceFilePtr is disregarded...
     }
 
     virtual SpectrumPtr spectrum(size_t index, bool getBinaryData) const
@@ -115,106 +162,263 @@ class SpectrumListMerger : public SpectrumList
         if (index >= size())
             throw runtime_error("[SpectrumListMerger::spectrum()] Bad index: " + lexical_cast<string>(index));
 
-        const IndexEntry& ie = index_[index];
-        SpectrumPtr result = ie.spectrumListPtr->spectrum(ie.originalIndex, getBinaryData);
+        const IndexEntry& ie = *index_[index];
+        MSDataPtr input = open(ie.run);
+        SpectrumPtr result = input->run.spectrumListPtr->spectrum(ie.originalIndex, getBinaryData);
         result->index = ie.index;
 
         // because of the high chance of duplicate ids, sourceFilePtrs are always explicit
-        result->sourceFilePtr = ie.sourceFilePtr;
+        SourceFilePtr oldSourceFilePtr = result->sourceFilePtr.get() ? result->sourceFilePtr : input->run.defaultSourceFilePtr;
+        if (oldSourceFilePtr.get())
+            result->sourceFilePtr = SourceFilePtr(new SourceFile(input->run.id + "_" + oldSourceFilePtr->id));
+        else
+            result->sourceFilePtr.reset();
 
         // resolve references into MSData::*Ptrs that may be invalidated after merging
         References::resolve(*result, msd_);
 
         return result;
     }
+
+    private:
+
+    struct OpenRun
+    {
+        size_t run;
+        MSDataPtr msd;
+    };
+
+    typedef sharded_cache<OpenRun, boost::multi_index::member<OpenRun, size_t, &OpenRun::run> > OpenRunCache;
+
+    const MSData& msd_;
+    MSDataMerger::Config config_;
+    const ReaderList* readers_;
+    vector<shared_ptr<Run> > runs_;
+    vector<shared_ptr<vector<IndexEntry> > > runEntries_;
+
+    mutable boost::mutex mutex_;
+    mutable bool indexed_;
+    mutable vector<IndexEntry*> index_;
+    mutable map<string, size_t> idToIndex_;
+    mutable OpenRunCache openRuns_;
+
+    // the runs' spectra in merged order
+    const vector<IndexEntry*>& index() const
+    {
+        boost::lock_guard<boost::mutex> lock(mutex_);
+        if (indexed_)
+            return index_;
+
+        index_.clear();
+        if (!config_.interleaveByScanTime)
+        {
+            BOOST_FOREACH(const shared_ptr<vector<IndexEntry> >& entries, runEntries_)
+                BOOST_FOREACH(IndexEntry& ie, *entries)
+                    index_.push_back(&ie);
+        }
+        else
+        {
+            // k-way merge: always take the earliest of the runs' next spectra (the first run wins a tie)
+            typedef pair<double, size_t> RunHead;
+            std::priority_queue<RunHead, vector<RunHead>, std::greater<RunHead> > heads;
+            vector<size_t> next(runEntries_.size(), 0);
+            for (size_t i=0; i < runEntries_.size(); ++i)
+                if (!runEntries_[i]->empty())
+                    heads.push(make_pair(runEntries_[i]->front().scanTime, i));
+
+            while (!heads.empty())
+            {
+                size_t run = heads.top().second;
+                heads.pop();
+
+                vector<IndexEntry>& entries = *runEntries_[run];
+                index_.push_back(&entries[next[run]++]);
+                if (next[run] < entries.size())
+                    heads.push(make_pair(entries[next[run]].scanTime, run));
+            }
+        }
+
+        idToIndex_.clear();
+        for (size_t i=0; i < index_.size(); ++i)
+        {
+            index_[i]->index = i;
+            idToIndex_.insert(make_pair(index_[i]->id, i));
+        }
+
+        indexed_ = true;
+        return index_;
+    }
+
+    // a resident run, or its file reopened (closing the least recently used run if there are too many open)
+    MSDataPtr open(size_t runNumber) const
+    {
+        const Run& run = *runs_[runNumber];
+        if (run.msd.get())
+            return run.msd;
+
+        OpenRun openRun;
+        if (openRuns_.get(runNumber, openRun))
+            return openRun.msd;
+
+        openRun.run = runNumber;
+        openRun.msd.reset(new MSData);
+        readers_->read(run.filename, *openRun.msd, run.runIndex, config_.readerConfig);
+        if (!openRun.msd->run.spectrumListPtr.get() || openRun.msd->run.spectrumListPtr->size() != run.spectrumCount)
+            throw runtime_error("[SpectrumListMerger::open()] " + run.filename + " has changed since it was merged");
+
+        openRuns_.put(openRun);
+        return openRun.msd;
+    }
 };
 
+
+typedef shared_ptr<SpectrumListMerger> SpectrumListMergerPtr;
+
 } // namespace
 
 
-PWIZ_API_DECL MSDataMerger::MSDataMerger(const vector<MSDataPtr>& inputs)
-: inputMSDataPtrs_(inputs)
+class MSDataMerger::Impl
 {
+    public:
+
+    Impl(MSDataMerger& merger, const Config& config, const ReaderList* readers)
+    :   merger_(merger), readers_(readers), config_(config),
+        spectrumListMergerPtr_(new SpectrumListMerger(merger, config, readers))
+    {
+        merger_.run.spectrumListPtr = spectrumListMergerPtr_;
+        updateRunId();
+    }
+
+    // merges the metadata of the runs, and appends their spectra; a filename means the runs can be reopened
+    // from it, and don't need to be kept
+    void addRuns(const vector<MSDataPtr>& inputs, const string& filename)
+    {
+        vector<SpectrumListMerger::PendingRun> pendingRuns;
+        for (size_t i=0; i < inputs.size(); ++i)
+        {
+            if (!inputs[i]->run.spectrumListPtr.get())
+                inputs[i]->run.spectrumListPtr.reset(new SpectrumListSimple);
+            pendingRuns.push_back(spectrumListMergerPtr_->prepareRun(inputs[i], filename, (int) i));
+        }
+
+        for (size_t i=0; i < inputs.size(); ++i)
+        {
+            spectrumListMergerPtr_->addRun(pendingRuns[i]);
+            mergeMetadata(*inputs[i]);
+        }
+        updateRunId();
+    }
+
+    void addFile(const string& filename)
+    {
+        vector<MSDataPtr> inputs;
+        readers_->read(filename, inputs, config_.readerConfig);
+        addRuns(inputs, filename);
+    }
+
+    private:
+    MSDataMerger& merger_;
+    const ReaderList* readers_;
+    Config config_;
+    SpectrumListMergerPtr spectrumListMergerPtr_;
+
     // MSData::id and Run::id are set to the longest common prefix of all inputs' Run::ids,
     // or if there is no common prefix, to a concatenation of all inputs' Run::ids
-    vector<string> runIds;
+    vector<string> runIds_;
 
     // Run::startTimeStamp is set to the earliest timestamp
-    vector<blt::local_date_time> runTimestamps;
+    vector<blt::local_date_time> runTimestamps_;
 
-    BOOST_FOREACH(const MSDataPtr& input, inputs)
+    void mergeMetadata(const MSData& msd)
     {
-        const MSData& msd = *input;
-
         // merge fileDescription/sourceFilePtrs (prepend each source file with its source run id)
         BOOST_FOREACH(const SourceFilePtr& sourceFilePtr, msd.fileDescription.sourceFilePtrs)
         {
-            this->fileDescription.sourceFilePtrs.push_back(SourceFilePtr(new SourceFile(*sourceFilePtr)));
-            SourceFile& sf = *this->fileDescription.sourceFilePtrs.back();
+            merger_.fileDescription.sourceFilePtrs.push_back(SourceFilePtr(new SourceFile(*sourceFilePtr)));
+            SourceFile& sf = *merger_.fileDescription.sourceFilePtrs.back();
             sf.id = msd.run.id + "_" + sf.id;
         }
 
-        runIds.push_back(msd.run.id);
+        runIds_.push_back(msd.run.id);
 
         if (!msd.run.startTimeStamp.empty())
-            runTimestamps.push_back(decode_xml_datetime(msd.run.startTimeStamp));
+            runTimestamps_.push_back(decode_xml_datetime(msd.run.startTimeStamp));
 
         DiffConfig config;
         config.ignoreSpectra = config.ignoreChromatograms = true;
-        Diff<MSData, msdata::DiffConfig> diff(*this, msd, config);
+        Diff<MSData, msdata::DiffConfig> diff(merger_, msd, config);
 
         // merge cvs
-        this->cvs.insert(this->cvs.end(),
-                         diff.b_a.cvs.begin(),
-                         diff.b_a.cvs.end());
+        merger_.cvs.insert(merger_.cvs.end(),
+                           diff.b_a.cvs.begin(),
+                           diff.b_a.cvs.end());
 
         // merge fileDescription/fileContent
-        mergeParamContainers(this->fileDescription.fileContent, diff.b_a.fileDescription.fileContent);
+        mergeParamContainers(merger_.fileDescription.fileContent, diff.b_a.fileDescription.fileContent);
 
         // merge fileDescription/contacts
-        this->fileDescription.contacts.insert(this->fileDescription.contacts.end(),
-                                              diff.b_a.fileDescription.contacts.begin(),
-                                              diff.b_a.fileDescription.contacts.end());
+        merger_.fileDescription.contacts.insert(merger_.fileDescription.contacts.end(),
+                                                diff.b_a.fileDescription.contacts.begin(),
+                                                diff.b_a.fileDescription.contacts.end());
 
         // merge file-level shared *Ptrs
 
-        this->paramGroupPtrs.insert(this->paramGroupPtrs.end(),
-                                    diff.b_a.paramGroupPtrs.begin(),
-                                    diff.b_a.paramGroupPtrs.end());
+        merger_.paramGroupPtrs.insert(merger_.paramGroupPtrs.end(),
+                                      diff.b_a.paramGroupPtrs.begin(),
+                                      diff.b_a.paramGroupPtrs.end());
 
-        this->samplePtrs.insert(this->samplePtrs.end(),
-                                diff.b_a.samplePtrs.begin(),
-                                diff.b_a.samplePtrs.end());
+        merger_.samplePtrs.insert(merger_.samplePtrs.end(),
+                                  diff.b_a.samplePtrs.begin(),
+                                  diff.b_a.samplePtrs.end());
 
-        this->softwarePtrs.insert(this->softwarePtrs.end(),
-                                  diff.b_a.softwarePtrs.begin(),
-                                  diff.b_a.softwarePtrs.end());
+        merger_.softwarePtrs.insert(merger_.softwarePtrs.end(),
+                                    diff.b_a.softwarePtrs.begin(),
+                                    diff.b_a.softwarePtrs.end());
 
-        this->instrumentConfigurationPtrs.insert(this->instrumentConfigurationPtrs.end(),
-                                                 diff.b_a.instrumentConfigurationPtrs.begin(),
-                                                 diff.b_a.instrumentConfigurationPtrs.end());
+        merger_.instrumentConfigurationPtrs.insert(merger_.instrumentConfigurationPtrs.end(),
+                                                   diff.b_a.instrumentConfigurationPtrs.begin(),
+                                                   diff.b_a.instrumentConfigurationPtrs.end());
 
-        this->dataProcessingPtrs.insert(this->dataProcessingPtrs.end(),
-                                        diff.b_a.dataProcessingPtrs.begin(),
-                                        diff.b_a.dataProcessingPtrs.end());
+        merger_.dataProcessingPtrs.insert(merger_.dataProcessingPtrs.end(),
+                                          diff.b_a.dataProcessingPtrs.begin(),
+                                          diff.b_a.dataProcessingPtrs.end());
 
         // merge run?
     }
 
-    string lcp = pwiz::util::longestCommonPrefix(runIds);
+    void updateRunId()
+    {
+        string lcp = pwiz::util::longestCommonPrefix(runIds_);
+
+        // trim typical separator characters from the end of the LCP
+        bal::trim_right_if(lcp, bal::is_any_of(" _-."));
 
-    // trim typical separator characters from the end of the LCP
-    bal::trim_right_if(lcp, bal::is_any_of(" _-."));
+        if (lcp.empty())
+            merger_.id = merger_.run.id = "merged-spectra";
+        else
+            merger_.id = merger_.run.id = lcp;
 
-    if (lcp.empty())
-        this->id = this->run.id = "merged-spectra";
-    else
-        this->id = this->run.id = lcp;
+        if (!runTimestamps_.empty())
+            merger_.run.startTimeStamp = encode_xml_datetime(*std::min_element(runTimestamps_.begin(), runTimestamps_.end()));
+    }
+};
 
-    if (!runTimestamps.empty())
-        this->run.startTimeStamp = encode_xml_datetime(*std::min_element(runTimestamps.begin(), runTimestamps.end()));
 
-    this->run.spectrumListPtr = SpectrumListPtr(new SpectrumListMerger(*this, inputMSDataPtrs_));
+PWIZ_API_DECL MSDataMerger::MSDataMerger(const vector<MSDataPtr>& inputs)
+:   impl_(new Impl(*this, Config(), 0))
+{
+    impl_->addRuns(inputs, "");
+}
+
+
+PWIZ_API_DECL MSDataMerger::MSDataMerger(const ReaderList& readers, const Config& config)
+:   impl_(new Impl(*this, config, &readers))
+{}
+
+
+PWIZ_API_DECL void MSDataMerger::addFile(const string& filename)
+{
+    impl_->addFile(filename);
 }
 
 
@@ -25,18 +25,48 @@
 
 
 #include "MSData.hpp"
+#include "Reader.hpp"
 
 
 namespace pwiz {
 namespace msdata {
 
 
+/// MSData that merges the file-level metadata of several runs and concatenates (or interleaves) their spectra
 struct PWIZ_API_DECL MSDataMerger : public MSData
 {
+    /// merges runs that are already in memory
     MSDataMerger(const std::vector<MSDataPtr>& inputs);
 
+    /// configuration for merging runs read from files
+    struct PWIZ_API_DECL Config
+    {
+        /// at most this many runs are kept open at once; the least recently used is closed to open another
+        /// (0 means no limit); when interleaving, runs that overlap in time should fit, or they are reopened often
+        size_t maxOpenRuns;
+
+        /// when true, the spectra of all runs are interleaved in order of scan start time (a k-way merge, so each
+        /// run's own order is kept); when false, each run's spectra follow the previous run's
+        bool interleaveByScanTime;
+
+        /// used to open the files
+        Reader::Config readerConfig;
+
+        Config() : maxOpenRuns(16), interleaveByScanTime(false) {}
+    };
+
+    /// merges runs from files added with addFile(), which are read with readers (which must outlive the merger);
+    /// each file is read through once when it is added, for its metadata and spectrum ids, and then closed;
+    /// spectra are read by reopening the file when they are asked for, so writing the merger streams through
+    /// its inputs without keeping every run open and indexed at once
+    MSDataMerger(const ReaderList& readers, const Config& config = Config());
+
+    /// adds every run in filename; throws if the file can't be read, leaving the merger as it was
+    void addFile(const std::string& filename);
+
     private:
-    std::vector<MSDataPtr> inputMSDataPtrs_;
+    class Impl;
+    boost::shared_ptr<Impl> impl_;
 };
 
 
@@ -24,6 +24,9 @@
 #include "MSDataMerger.hpp"
 #include "examples.hpp"
 #include "TextWriter.hpp"
+#include "MSDataFile.hpp"
+#include "DefaultReaderList.hpp"
+#include "pwiz/utility/misc/Filesystem.hpp"
 #include "pwiz/utility/misc/Std.hpp"
 
 using namespace pwiz::msdata;
@@ -31,6 +34,7 @@ using namespace pwiz::util;
 
 
 ostream* os_ = 0;
+string filenameBase_ = "temp.MSDataMergerTest";
 
 
 void test()
@@ -101,6 +105,125 @@ void test()
 }
 
 
+double scanTime(const Spectrum& spectrum)
+{
+    if (spectrum.scanList.scans.empty())
+        return 0;
+    return spectrum.scanList.scans[0].cvParam(MS_scan_start_time).timeInSeconds();
+}
+
+
+void testFiles()
+{
+    if (os_) *os_ << "testFiles" << endl;
+
+    // copy i of tiny is i seconds later than copy 0
+    const size_t tinyCopyCount = 3;
+    vector<string> filenames;
+    for (size_t i=0; i < tinyCopyCount; ++i)
+    {
+        MSData tiny;
+        examples::initializeTiny(tiny);
+        tiny.id = tiny.run.id = "tiny" + lexical_cast<string>(i);
+
+        SpectrumListSimple& sl = static_cast<SpectrumListSimple&>(*tiny.run.spectrumListPtr);
+        BOOST_FOREACH(SpectrumPtr& s, sl.spectra)
+            BOOST_FOREACH(Scan& scan, s->scanList.scans)
+                BOOST_FOREACH(CVParam& cvParam, scan.cvParams)
+                    if (cvParam.cvid == MS_scan_start_time)
+                    {
+                        cvParam.value = lexical_cast<string>(cvParam.timeInSeconds() + i);
+                        cvParam.units = UO_second;
+                    }
+
+        filenames.push_back(filenameBase_ + lexical_cast<string>(i) + ".mzML");
+        MSDataFile::write(tiny, filenames.back());
+    }
+
+    MSData tinyReference;
+    examples::initializeTiny(tinyReference);
+    const SpectrumList& referenceList = *tinyReference.run.spectrumListPtr;
+    size_t tinySize = referenceList.size();
+
+    DefaultReaderList readers;
+
+    // appended, as with merging in memory, with only one file open at a time
+    {
+        MSDataMerger::Config config;
+        config.maxOpenRuns = 1;
+        MSDataMerger merged(readers, config);
+        BOOST_FOREACH(const string& filename, filenames)
+            merged.addFile(filename);
+
+        unit_assert_operator_equal("tiny", merged.run.id);
+        // reading adds the mzML file to each run's source files
+        unit_assert_operator_equal((tinyReference.fileDescription.sourceFilePtrs.size() + 1) * tinyCopyCount, merged.fileDescription.sourceFilePtrs.size());
+
+        // a file that can't be read leaves the merger as it was
+        unit_assert_throws(merged.addFile(filenameBase_ + ".missing.mzML"), runtime_error);
+
+        const SpectrumList& sl = *merged.run.spectrumListPtr;
+        unit_assert_operator_equal(tinySize * tinyCopyCount, sl.size());
+
+        // going back and forth between the files reopens them
+        for (size_t pass=0; pass < 2; ++pass)
+            for (size_t index=0; index < sl.size(); ++index)
+            {
+                size_t i = pass == 0 ? index : sl.size() - 1 - index;
+                SpectrumPtr spectrum = sl.spectrum(i, true);
+                unit_assert_operator_equal(i, spectrum->index);
+                unit_assert_operator_equal(referenceList.spectrumIdentity(i % tinySize).id, spectrum->id);
+                unit_assert_operator_equal(referenceList.spectrum(i % tinySize, true)->defaultArrayLength, spectrum->defaultArrayLength);
+                unit_assert(find(merged.fileDescription.sourceFilePtrs.begin(),
+                                 merged.fileDescription.sourceFilePtrs.end(),
+                                 spectrum->sourceFilePtr) != merged.fileDescription.sourceFilePtrs.end());
+            }
+
+        // written by streaming through the inputs
+        string mergedFilename = filenameBase_ + ".merged.mzML";
+        MSDataFile::write(merged, mergedFilename);
+        MSDataFile mergedFile(mergedFilename);
+        unit_assert_operator_equal(sl.size(), mergedFile.run.spectrumListPtr->size());
+        bfs::remove(mergedFilename);
+    }
+
+    // interleaved by scan time; each run keeps its own order (the last spectrum of tiny is earlier than the others)
+    {
+        MSDataMerger::Config config;
+        config.maxOpenRuns = 2;
+        config.interleaveByScanTime = true;
+        MSDataMerger merged(readers, config);
+        BOOST_FOREACH(const string& filename, filenames)
+            merged.addFile(filename);
+
+        size_t expectedOrder[][2] = {{0,0}, {1,0}, {2,0},
+                                     {0,1}, {0,2}, {1,1}, {1,2}, {2,1}, {2,2}, // 2 has no scan time, so it follows 1
+                                     {0,3}, {0,4}, {1,3}, {1,4}, {2,3}, {2,4}};
+        const SpectrumList& sl = *merged.run.spectrumListPtr;
+        unit_assert_operator_equal(sizeof(expectedOrder) / sizeof(expectedOrder[0]), sl.size());
+        for (size_t i=0; i < sl.size(); ++i)
+        {
+            size_t copy = expectedOrder[i][0], referenceIndex = expectedOrder[i][1];
+            SpectrumPtr spectrum = sl.spectrum(i);
+            SpectrumPtr referenceSpectrum = referenceList.spectrum(referenceIndex);
+            if (os_) *os_ << i << ": " << spectrum->id << " " << scanTime(*spectrum) << endl;
+
+            unit_assert_operator_equal(i, sl.spectrumIdentity(i).index);
+            unit_assert_operator_equal(referenceSpectrum->id, spectrum->id);
+            if (!referenceSpectrum->scanList.scans.empty() && referenceSpectrum->scanList.scans[0].hasCVParam(MS_scan_start_time))
+                unit_assert_equal(scanTime(*referenceSpectrum) + copy, scanTime(*spectrum), 1e-6);
+            SourceFilePtr referenceSourceFile = referenceSpectrum->sourceFilePtr.get() ? referenceSpectrum->sourceFilePtr
+                                                                                       : tinyReference.run.defaultSourceFilePtr;
+            if (referenceSourceFile.get())
+                unit_assert_operator_equal("tiny" + lexical_cast<string>(copy) + "_" + referenceSourceFile->id, spectrum->sourceFilePtr->id);
+        }
+    }
+
+    BOOST_FOREACH(const string& filename, filenames)
+        bfs::remove(filename);
+}
+
+
 int main(int argc, char* argv[])
 {
     TEST_PROLOG(argc, argv)
@@ -109,6 +232,7 @@ int main(int argc, char* argv[])
     {
         if (argc>1 && !strcmp(argv[1],"-v")) os_ = &cout;
         test();
+        testFiles();
     }
     catch (exception& e)
     {
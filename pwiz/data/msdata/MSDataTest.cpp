@@ -22,6 +22,7 @@
 
 
 #include "MSData.hpp"
+#include "Diff.hpp"
 #include "pwiz/utility/misc/unit.hpp"
 #include "pwiz/utility/misc/Std.hpp"
 
@@ -267,6 +268,133 @@ void testAllDataProcessing()
 }
 
 
+void testBinaryDataPacking()
+{
+    BinaryDataArray a;
+    a.set(MS_intensity_array);
+    a.data.push_back(0);
+    a.data.push_back(1.5);
+    a.data.push_back(-2);
+    a.data.push_back(12345.25);
+    a.data.push_back(1e30); // representable as float (1e30f is not the double 1e30)
+    unit_assert(!a.canPack(BinaryDataType_Float32));
+    a.data[4] = double(1e30f);
+
+    vector<double> original = a.data;
+    unit_assert(a.canPack(BinaryDataType_Float32));
+    unit_assert(!a.canPack(BinaryDataType_Int32)); // 1.5
+    unit_assert(!a.isPacked());
+    unit_assert_operator_equal(5, a.arrayLength());
+
+    // a failed pack leaves the array alone
+    unit_assert(!a.pack(BinaryDataType_Int64));
+    unit_assert(!a.isPacked());
+    unit_assert(a.data == original);
+
+    unit_assert(a.pack(BinaryDataType_Float32));
+    unit_assert(a.isPacked());
+    unit_assert_operator_equal(BinaryDataType_Float32, a.packedType());
+    unit_assert(a.data.empty());
+    unit_assert_operator_equal(5, a.arrayLength());
+    unit_assert(!a.empty());
+    unit_assert_operator_equal(-2.0f, static_cast<const float*>(a.packedData())[2]);
+
+    vector<double> values;
+    a.getData(values);
+    unit_assert(values == original);
+
+    // repacking into a type that doesn't fit keeps the current packing
+    unit_assert(!a.pack(BinaryDataType_Int32));
+    unit_assert_operator_equal(BinaryDataType_Float32, a.packedType());
+
+    a.unpack();
+    unit_assert(!a.isPacked());
+    unit_assert(a.data == original);
+    unit_assert(a.packedData() == 0);
+
+    // integer packing is exact or refused
+    BinaryDataArray b;
+    b.data.push_back(0);
+    b.data.push_back(-2147483648.0);
+    b.data.push_back(2147483647.0);
+    unit_assert(b.canPack(BinaryDataType_Int32));
+    b.data.push_back(2147483648.0);
+    unit_assert(!b.canPack(BinaryDataType_Int32));
+    unit_assert(b.canPack(BinaryDataType_Int64));
+    b.data.push_back(-0.0);
+    unit_assert(!b.canPack(BinaryDataType_Int64));
+    b.data.back() = numeric_limits<double>::quiet_NaN();
+    unit_assert(!b.canPack(BinaryDataType_Int64));
+    unit_assert(b.canPack(BinaryDataType_Float64));
+    b.data.pop_back();
+
+    original = b.data;
+    unit_assert(b.pack(BinaryDataType_Int64));
+    unit_assert(!b.pack(BinaryDataType_Float32)); // 2^31-1 is not a float
+    unit_assert_operator_equal(BinaryDataType_Int64, b.packedType());
+    b.getData(values);
+    unit_assert(values == original);
+
+    // diff compares the values, not the storage
+    BinaryDataArray c;
+    c.data = original;
+    Diff<BinaryDataArray, DiffConfig> diff(b, c);
+    unit_assert(!diff);
+    c.data[2] = 1;
+    unit_assert(diff(b, c));
+}
+
+
+void testPackedSpectra()
+{
+    SpectrumListSimplePtr sl(new SpectrumListSimple);
+    vector<double> mz, intensity;
+    for (int i=0; i < 10; ++i)
+    {
+        mz.push_back(100 + 0.1 * i); // not representable as float
+        intensity.push_back(i * 10);
+    }
+
+    SpectrumPtr spectrum(new Spectrum);
+    spectrum->id = "scan=1";
+    spectrum->setMZIntensityArrays(mz, intensity, MS_number_of_detector_counts);
+    sl->spectra.push_back(spectrum);
+
+    // packing replaces the packable arrays without touching the originals
+    BinaryDataArrayPtr originalIntensityArray = spectrum->getIntensityArray();
+    SpectrumPtr packed(new Spectrum(*spectrum));
+    unit_assert_operator_equal(1, packed->packBinaryData());
+    unit_assert(packed->hasPackedBinaryData());
+    unit_assert(packed->hasBinaryData());
+    unit_assert(!packed->getMZArray()->isPacked());
+    unit_assert(packed->getMZArray() == spectrum->getMZArray());
+    unit_assert(packed->getIntensityArray()->isPacked());
+    unit_assert(!originalIntensityArray->isPacked());
+    unit_assert(!spectrum->hasPackedBinaryData());
+
+    // the list returns the stored spectrum until it is packed, then returns unpacked copies
+    unit_assert(sl->spectrum(0, true) == spectrum);
+    sl->spectra[0] = packed;
+    SpectrumPtr result = sl->spectrum(0, true);
+    unit_assert(result != packed);
+    unit_assert(!result->hasPackedBinaryData());
+    unit_assert(result->getIntensityArray()->data == intensity);
+    unit_assert(result->getMZArray()->data == mz);
+    unit_assert(packed->getIntensityArray()->isPacked());
+    unit_assert_operator_equal("scan=1", sl->spectrumIdentity(0).id);
+
+    ChromatogramListSimplePtr cl(new ChromatogramListSimple);
+    ChromatogramPtr chromatogram(new Chromatogram);
+    chromatogram->setTimeIntensityArrays(intensity, intensity, UO_second, MS_number_of_detector_counts);
+    unit_assert_operator_equal(2, chromatogram->packBinaryData(BinaryDataType_Int32));
+    cl->chromatograms.push_back(chromatogram);
+    ChromatogramPtr chromatogramResult = cl->chromatogram(0, true);
+    unit_assert(!chromatogramResult->hasPackedBinaryData());
+    unit_assert(chromatogramResult->getTimeArray()->data == intensity);
+    unit_assert(chromatogram->hasPackedBinaryData());
+}
+
+
 int main(int argc, char* argv[])
 {
     TEST_PROLOG(argc, argv)
@@ -277,6 +405,8 @@ int main(int argc, char* argv[])
         testChromatograms();
         testIDParsing();
         testAllDataProcessing();
+        testBinaryDataPacking();
+        testPackedSpectra();
     }
     catch (exception& e)
     {
@@ -29,6 +29,10 @@
 #include <algorithm>
 #include "MSNumpress.hpp"
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 namespace pwiz {
 namespace msdata {
 namespace MSNumpress {
@@ -194,6 +198,127 @@ void decodeInt(
 
 
 
+namespace {
+
+/**
+ * Number of leading zero bits in x, which must not be 0
+ */
+inline unsigned int leadingZeroBits(unsigned int x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clz(x);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse(&index, x);
+    return 31 - index;
+#else
+    unsigned int n = 0;
+    for (; !(x & 0x80000000u); x <<= 1) n++;
+    return n;
+#endif
+}
+
+/**
+ * Reverses the order of the 8 half bytes in x
+ */
+inline unsigned int reverseHalfBytes(unsigned int x) {
+    x = (x >> 16) | (x << 16);
+    x = ((x & 0xff00ff00u) >> 8) | ((x & 0x00ff00ffu) << 8);
+    return ((x & 0xf0f0f0f0u) >> 4) | ((x & 0x0f0f0f0fu) << 4);
+}
+
+/**
+ * Writes the same half bytes as encodeInt, packed the same way as the reference 
+ * encoders pack them (first half byte in the high bits), but a whole int at a time 
+ * instead of one half byte at a time.
+ */
+class HalfByteWriter {
+public:
+    HalfByteWriter(unsigned char *out) : out_(out), bits_(0), bitCount_(0) {}
+
+    void putInt(const int x) {
+        unsigned int ux = (unsigned int)x;
+        unsigned int l, head;
+        if ((ux & 0xf0000000u) == 0) {
+            l = ux == 0 ? 8 : leadingZeroBits(ux) / 4; // leading zero half bytes
+            head = l;
+        } else if ((ux & 0xf0000000u) == 0xf0000000u) {
+            l = ~ux == 0 ? 7 : leadingZeroBits(~ux) / 4; // leading 0xf half bytes
+            head = l + 8;
+        } else {
+            l = 0;
+            head = 0;
+        }
+
+        // the head, then the remaining half bytes from least to most significant
+        unsigned int count = 8 - l;
+        unsigned long long tail = (unsigned long long)reverseHalfBytes(ux) >> (4*l);
+        bits_ = (bits_ << (4*(count+1))) | ((unsigned long long)head << (4*count)) | tail;
+        bitCount_ += 4*(count+1);
+
+        while (bitCount_ >= 8) {
+            bitCount_ -= 8;
+            *out_++ = (unsigned char)(bits_ >> bitCount_);
+        }
+    }
+
+    /**
+     * Writes a final odd half byte padded with a zero, returns the end of the output
+     */
+    unsigned char *finish() {
+        if (bitCount_ > 0) {
+            *out_++ = (unsigned char)(bits_ << 4);
+            bitCount_ = 0;
+        }
+        return out_;
+    }
+
+private:
+    unsigned char *out_;
+    unsigned long long bits_; // pending half bytes in the low bitCount_ bits
+    int bitCount_;
+};
+
+/**
+ * Same as decodeInt, but reads the half bytes 8 bytes at a time. 
+ * Needs at least 8 readable bytes at data[*di].
+ */
+inline void decodeIntFast(
+        const unsigned char *data,
+        size_t *di,
+        int *half,
+        int *res
+) {
+    const unsigned char *p = data + *di;
+    unsigned long long w = 
+        ((unsigned long long)p[0] << 56) | ((unsigned long long)p[1] << 48) |
+        ((unsigned long long)p[2] << 40) | ((unsigned long long)p[3] << 32) |
+        ((unsigned long long)p[4] << 24) | ((unsigned long long)p[5] << 16) |
+        ((unsigned long long)p[6] << 8) | (unsigned long long)p[7];
+    w <<= 4 * (*half); // next half byte in the top bits
+
+    unsigned int head = (unsigned int)(w >> 60);
+    unsigned int n = head <= 8 ? head : head - 8;
+    unsigned int count = 8 - n;
+    unsigned int x = 0;
+
+    if (count > 0) {
+        // the following count half bytes, least significant first
+        unsigned int tail = (unsigned int)((w << 4) >> 32);
+        x = reverseHalfBytes(tail & (0xffffffffu << (4*(8-count))));
+    }
+    if (head > 8) { // leading ones
+        x |= 0xffffffffu << (4*(8-n));
+    }
+    *res = (int)x;
+
+    size_t position = 2*(*di) + (*half) + 1 + count;
+    *di = position / 2;
+    *half = (int)(position % 2);
+}
+
+} // namespace
+
+
 /////////////////////////////////////////////////////////////
 
 PWIZ_API_DECL
@@ -236,13 +361,12 @@ size_t encodeLinear(
         const double *data, 
         size_t dataSize, 
         unsigned char *result,
-        double fixedPoint
+        double fixedPoint,
+        double *decoded
 ) {
     unsigned long long ints[3];
-    size_t i, ri;
-    unsigned char halfBytes[10];
-    size_t halfByteCount;
-    size_t hbi;
+    long long decodedInts[3]; // what decodeLinear will see
+    size_t i;
     long long extrapol;
     int diff;
 
@@ -259,6 +383,8 @@ size_t encodeLinear(
     for (i=0; i<4; i++) {
         result[8+i] = (ints[1] >> (i*8)) & 0xff;
     }
+    decodedInts[1] = ints[1] & 0xffffffff; // only 4 bytes are stored
+    if (decoded) decoded[0] = decodedInts[1] / fixedPoint;
 
     if (dataSize == 1) return 12;
 
@@ -266,9 +392,10 @@ size_t encodeLinear(
     for (i=0; i<4; i++) {
         result[12+i] = (ints[2] >> (i*8)) & 0xff;
     }
+    decodedInts[2] = ints[2] & 0xffffffff;
+    if (decoded) decoded[1] = decodedInts[2] / fixedPoint;
 
-    halfByteCount = 0;
-    ri = 16;
+    HalfByteWriter writer(result + 16);
 
     for (i=2; i<dataSize; i++) {
         ints[0] = ints[1];
@@ -277,33 +404,16 @@ size_t encodeLinear(
         extrapol = ints[1] + (ints[1] - ints[0]);
         diff = ints[2] - extrapol;
         //printf("%lu %lu %lu,   extrapol: %ld    diff: %d \n", ints[0], ints[1], ints[2], extrapol, diff);
-        encodeInt(diff, &halfBytes[halfByteCount], &halfByteCount);
-        /*
-        printf("%d (%d):  ", diff, (int)halfByteCount);
-        for (size_t j=0; j<halfByteCount; j++) {
-            printf("%x ", halfBytes[j] & 0xf);
-        }
-        printf("\n");
-        */
-        
-        
-        for (hbi=1; hbi < halfByteCount; hbi+=2) {
-            result[ri] = (halfBytes[hbi-1] << 4) | (halfBytes[hbi] & 0xf);
-            //printf("%x \n", result[ri]);
-            ri++;
-        }
-        if (halfByteCount % 2 != 0) {
-            halfBytes[0] = halfBytes[halfByteCount-1];
-            halfByteCount = 1;
-        } else {
-            halfByteCount = 0;
+        writer.putInt(diff);
+
+        if (decoded) { // same arithmetic as decodeLinear
+            decodedInts[0] = decodedInts[1];
+            decodedInts[1] = decodedInts[2];
+            decodedInts[2] = decodedInts[1] + (decodedInts[1] - decodedInts[0]) + diff;
+            decoded[i] = decodedInts[2] / fixedPoint;
         }
     }
-    if (halfByteCount == 1) {
-        result[ri] = halfBytes[0] << 4;
-        ri++;
-    }
-    return ri;
+    return writer.finish() - result;
 }
 
 
@@ -362,7 +472,11 @@ size_t decodeLinear(
                     break;
                 }
             }
-            decodeInt(data, &di, &half, &diff);
+            if (di + 8 <= dataSize) {
+                decodeIntFast(data, &di, &half, &diff);
+            } else {
+                decodeInt(data, &di, &half, &diff);
+            }
             
             extrapol = ints[1] + (ints[1] - ints[0]);
             y = extrapol + diff;
@@ -419,47 +533,20 @@ PWIZ_API_DECL
 size_t encodePic(
         const double *data, 
         size_t dataSize, 
-        unsigned char *result
+        unsigned char *result,
+        double *decoded
 ) {
-    size_t i, ri, count;
-    unsigned char halfBytes[10];
-    size_t halfByteCount;
-    size_t hbi;
+    size_t i, count;
+    HalfByteWriter writer(result);
 
     //printf("Encoding %d doubles\n", (int)dataSize);
 
-    halfByteCount = 0;
-    ri = 0;
-
     for (i=0; i<dataSize; i++) {
         count = data[i] + 0.5;
-        //printf("%d %d %d,   extrapol: %d    diff: %d \n", ints[0], ints[1], ints[2], extrapol, diff);
-        encodeInt(count, &halfBytes[halfByteCount], &halfByteCount);
-        /*
-        printf("%d (%d):  ", count, (int)halfByteCount);
-        for (j=0; j<halfByteCount; j++) {
-            printf("%x ", halfBytes[j] & 0xf);
-        }
-        printf("\n");
-        */
-        
-        for (hbi=1; hbi < halfByteCount; hbi+=2) {
-            result[ri] = (halfBytes[hbi-1] << 4) | (halfBytes[hbi] & 0xf);
-            //printf("%x \n", result[ri]);
-            ri++;
-        }
-        if (halfByteCount % 2 != 0) {
-            halfBytes[0] = halfBytes[halfByteCount-1];
-            halfByteCount = 1;
-        } else {
-            halfByteCount = 0;
-        }
-    }
-    if (halfByteCount == 1) {
-        result[ri] = halfBytes[0] << 4;
-        ri++;
+        writer.putInt(count);
+        if (decoded) decoded[i] = (int)count; // decodePic restores the int
     }
-    return ri;
+    return writer.finish() - result;
 }
 
 
@@ -488,7 +575,11 @@ size_t decodePic(
                     break;
                 }
             }
-            decodeInt(&data[0], &di, &half, &count);
+            if (di + 8 <= dataSize) {
+                decodeIntFast(data, &di, &half, &count);
+            } else {
+                decodeInt(&data[0], &di, &half, &count);
+            }
             
             //printf("count: %d \n", count);
             result[ri++]     = count;
@@ -564,7 +655,8 @@ size_t encodeSlof(
         const double *data, 
         size_t dataSize, 
         unsigned char *result,
-        double fixedPoint
+        double fixedPoint,
+        double *decoded
 ) {
     size_t i, ri;
     unsigned short x;
@@ -577,6 +669,7 @@ size_t encodeSlof(
         x = log(data[i]+1) * fixedPoint + 0.5;
         result[ri++] = x & 0xff;
         result[ri++] = x >> 8;
+        if (decoded) decoded[i] = exp(x / fixedPoint) - 1; // same as decodeSlof
     }
     return ri;
 }
@@ -78,13 +78,16 @@ namespace MSNumpress {
 	 * @fixedPoint	the scaling factor used for getting the fixed point repr. 
 	 * 				This is stored in the binary and automatically extracted
 	 * 				on decoding.  Automatically (and maybe slowly) determined if 0.
+	 * @decoded		if not NULL, receives the dataSize values decodeLinear will return
+	 *				for the result, so the loss can be checked without decoding
 	 * @return		the number of encoded bytes
 	 */
 	size_t PWIZ_API_DECL encodeLinear(
 		const double *data, 
 		const size_t dataSize, 
 		unsigned char *result,
-		double fixedPoint);
+		double fixedPoint,
+		double *decoded = NULL);
 	
 	/**
 	 * Calls lower level encodeLinear while handling vector sizes appropriately
@@ -141,12 +144,14 @@ namespace MSNumpress {
 	 * @data		pointer to array of double to be encoded (need memorycont. repr.)
 	 * @dataSize	number of doubles from *data to encode
 	 * @result		pointer to were resulting bytes should be stored
+	 * @decoded		if not NULL, receives the dataSize values decodePic will return for the result
 	 * @return		the number of encoded bytes
 	 */
 	size_t PWIZ_API_DECL encodePic(
 		const double *data, 
 		const size_t dataSize, 
-		unsigned char *result);
+		unsigned char *result,
+		double *decoded = NULL);
 		
 	/**
 	 * Calls lower level encodePic while handling vector sizes appropriately
@@ -205,13 +210,15 @@ namespace MSNumpress {
 	 * @dataSize	number of doubles from *data to encode
 	 * @result		pointer to were resulting bytes should be stored
 	 * &fixedPoint  automatically (and maybe slowly) determined if 0.
+	 * @decoded		if not NULL, receives the dataSize values decodeSlof will return for the result
 	 * @return		the number of encoded bytes
 	 */
 	size_t PWIZ_API_DECL encodeSlof(
 		const double *data, 
 		const size_t dataSize, 
 		unsigned char *result,
-		double fixedPoint);
+		double fixedPoint,
+		double *decoded = NULL);
 		
 	/**
 	 * Calls lower level encodeSlof while handling vector sizes appropriately
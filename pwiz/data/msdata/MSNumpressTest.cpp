@@ -0,0 +1,270 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); 
+// you may not use this file except in compliance with the License. 
+// You may obtain a copy of the License at 
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software 
+// distributed under the License is distributed on an "AS IS" BASIS, 
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. 
+// See the License for the specific language governing permissions and 
+// limitations under the License.
+//
+
+
+#include "MSNumpress.hpp"
+#include "pwiz/utility/misc/unit.hpp"
+#include "pwiz/utility/misc/Std.hpp"
+
+
+using namespace pwiz::util;
+using namespace pwiz::msdata;
+
+
+ostream* os_ = 0;
+
+
+// the reference implementation's half byte encoding and packing, one half byte at a time
+namespace reference {
+
+void encodeInt(const int x, unsigned char* res, size_t *res_length)
+{
+    int i, l, m;
+    int mask = 0xf0000000;
+    int init = x & mask;
+
+    if (init == 0) {
+        l = 8;
+        for (i=0; i<8; i++) {
+            m = mask >> (4*i);
+            if ((x & m) != 0) {
+                l = i;
+                break;
+            }
+        }
+        res[0] = l;
+        for (i=l; i<8; i++) {
+            res[1+i-l] = x >> (4*(i-l));
+        }
+        *res_length += 1+8-l;
+    } else if (init == mask) {
+        l = 7;
+        for (i=0; i<8; i++) {
+            m = mask >> (4*i);
+            if ((x & m) != m) {
+                l = i;
+                break;
+            }
+        }
+        res[0] = l + 8;
+        for (i=l; i<8; i++) {
+            res[1+i-l] = x >> (4*(i-l));
+        }
+        *res_length += 1+8-l;
+    } else {
+        res[0] = 0;
+        for (i=0; i<8; i++) {
+            res[1+i] = x >> (4*i);
+        }
+        *res_length += 9;
+    }
+}
+
+// packs the half bytes of each int like encodeLinear and encodePic
+vector<unsigned char> pack(const vector<int>& ints)
+{
+    vector<unsigned char> result;
+    unsigned char halfBytes[10];
+    size_t halfByteCount = 0;
+
+    for (size_t i=0; i < ints.size(); i++) {
+        encodeInt(ints[i], &halfBytes[halfByteCount], &halfByteCount);
+        for (size_t hbi=1; hbi < halfByteCount; hbi+=2)
+            result.push_back((unsigned char) ((halfBytes[hbi-1] << 4) | (halfBytes[hbi] & 0xf)));
+        if (halfByteCount % 2 != 0) {
+            halfBytes[0] = halfBytes[halfByteCount-1];
+            halfByteCount = 1;
+        } else {
+            halfByteCount = 0;
+        }
+    }
+    if (halfByteCount == 1)
+        result.push_back((unsigned char) (halfBytes[0] << 4));
+    return result;
+}
+
+} // namespace reference
+
+
+// ints with every length of half byte encoding, both signs
+vector<int> testInts()
+{
+    vector<int> ints;
+    for (int shift=0; shift < 32; ++shift)
+    {
+        int x = (int) (1u << shift);
+        ints.push_back(x);
+        ints.push_back(x - 1);
+        ints.push_back(-x);
+        ints.push_back(-x + 1);
+        ints.push_back((int) ((0x9e3779b9u * (shift + 1)) >> (31 - shift)));
+    }
+    ints.push_back(0);
+    ints.push_back(-1);
+    ints.push_back(numeric_limits<int>::max());
+    ints.push_back(numeric_limits<int>::min());
+    return ints;
+}
+
+
+void testPic()
+{
+    if (os_) *os_ << "testPic()\n";
+
+    vector<int> ints = testInts();
+    for (size_t size=0; size <= ints.size(); ++size) // odd and even half byte counts, and every tail length
+    {
+        vector<int> counts;
+        vector<double> data;
+        for (size_t i=0; i < size; ++i)
+        {
+            int count = abs(ints[i] / 2);
+            counts.push_back(count);
+            data.push_back(count + (i % 3) * 0.2);
+        }
+
+        vector<unsigned char> encoded(size * 5 + 1);
+        vector<double> predicted(size + 1);
+        size_t byteCount = MSNumpress::encodePic(data.empty() ? 0 : &data[0], size, &encoded[0], &predicted[0]);
+        encoded.resize(byteCount);
+        unit_assert(encoded == reference::pack(counts));
+
+        vector<double> decoded;
+        MSNumpress::decodePic(encoded, decoded);
+        unit_assert_operator_equal(size, decoded.size());
+        for (size_t i=0; i < size; ++i)
+        {
+            unit_assert_operator_equal(counts[i], decoded[i]);
+            unit_assert_operator_equal(decoded[i], predicted[i]);
+        }
+    }
+}
+
+
+void testLinear()
+{
+    if (os_) *os_ << "testLinear()\n";
+
+    // smooth data, then jumps that give residuals of every size
+    vector<double> data;
+    for (size_t i=0; i < 500; ++i)
+        data.push_back(100 + i * 0.0123 + (i % 7) * 1e-6);
+    vector<int> ints = testInts();
+    for (size_t i=0; i < ints.size(); ++i)
+        data.push_back(data.back() + (ints[i] % 100000) / 1e5);
+
+    for (size_t size=0; size <= data.size(); size += size < 20 ? 1 : 7)
+    {
+        const double fixedPoint = MSNumpress::optimalLinearFixedPoint(&data[0], size);
+
+        vector<unsigned char> encoded(size * 5 + 16);
+        vector<double> predicted(size + 1);
+        size_t byteCount = MSNumpress::encodeLinear(&data[0], size, &encoded[0], fixedPoint, &predicted[0]);
+        encoded.resize(byteCount);
+
+        if (size < 2)
+        {
+            unit_assert_operator_equal(8 + 4 * size, byteCount);
+        }
+        else
+        {
+            // residuals from the linear prediction
+            vector<int> residuals;
+            unsigned long long ints[3];
+            ints[1] = data[0] * fixedPoint + 0.5;
+            ints[2] = data[1] * fixedPoint + 0.5;
+            for (size_t i=2; i < size; ++i)
+            {
+                ints[0] = ints[1];
+                ints[1] = ints[2];
+                ints[2] = data[i] * fixedPoint + 0.5;
+                long long extrapol = ints[1] + (ints[1] - ints[0]);
+                residuals.push_back((int) (ints[2] - extrapol));
+            }
+            vector<unsigned char> packed = reference::pack(residuals);
+            unit_assert_operator_equal(16 + packed.size(), byteCount);
+            unit_assert(equal(packed.begin(), packed.end(), encoded.begin() + 16));
+        }
+
+        if (size == 0)
+            continue; // decodeLinear rejects a bare header
+
+        vector<double> decoded;
+        MSNumpress::decodeLinear(encoded, decoded);
+        unit_assert_operator_equal(size, decoded.size());
+        for (size_t i=0; i < size; ++i)
+        {
+            unit_assert_equal(data[i], decoded[i], 1e-4);
+            unit_assert_operator_equal(decoded[i], predicted[i]);
+        }
+    }
+}
+
+
+void testSlof()
+{
+    if (os_) *os_ << "testSlof()\n";
+
+    vector<double> data;
+    for (size_t i=0; i < 1000; ++i)
+        data.push_back((i * 7919) % 100000 + 0.37);
+
+    vector<unsigned char> encoded(data.size() * 2 + 8);
+    vector<double> predicted(data.size());
+    size_t byteCount = MSNumpress::encodeSlof(&data[0], data.size(), &encoded[0], 0, &predicted[0]);
+    unit_assert_operator_equal(encoded.size(), byteCount);
+
+    vector<double> decoded;
+    MSNumpress::decodeSlof(encoded, decoded);
+    unit_assert_operator_equal(data.size(), decoded.size());
+    for (size_t i=0; i < data.size(); ++i)
+        unit_assert_operator_equal(decoded[i], predicted[i]);
+}
+
+
+void test()
+{
+    testPic();
+    testLinear();
+    testSlof();
+}
+
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(argc, argv)
+
+    try
+    {
+        if (argc>1 && !strcmp(argv[1],"-v")) os_ = &cout;
+        test();
+    }
+    catch (exception& e)
+    {
+        TEST_FAILED(e.what())
+    }
+    catch (...)
+    {
+        TEST_FAILED("Caught unknown exception.")
+    }
+
+    TEST_EPILOG
+}
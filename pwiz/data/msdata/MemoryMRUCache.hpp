@@ -24,7 +24,7 @@
 
 
 #include "pwiz/utility/misc/Export.hpp"
-#include "pwiz/utility/misc/mru_list.hpp"
+#include "pwiz/utility/misc/sharded_cache.hpp"
 
 
 namespace pwiz {
@@ -40,13 +40,22 @@ enum PWIZ_API_DECL MemoryMRUCacheMode
 };
 
 
-/// an MRU cache for SpectrumPtrs or ChromatogramPtrs
-template <typename PtrType, typename KeyExtractor = boost::multi_index::identity<PtrType> >
-class MemoryMRUCache : public pwiz::util::mru_list<PtrType, KeyExtractor>
+/// a thread-safe cache for SpectrumPtrs or ChromatogramPtrs, limited by count and/or a Weigher (e.g. bytes)
+template <typename PtrType,
+          typename KeyExtractor = boost::multi_index::identity<PtrType>,
+          typename Weigher = pwiz::util::unit_weight<PtrType> >
+class MemoryMRUCache : public pwiz::util::sharded_cache<PtrType, KeyExtractor, Weigher>
 {
     public:
+    typedef pwiz::util::sharded_cache<PtrType, KeyExtractor, Weigher> base_type;
+
+    /// an LRU cache holding up to size items
     MemoryMRUCache(MemoryMRUCacheMode mode, size_t size)
-    : pwiz::util::mru_list<PtrType, KeyExtractor>(size), mode_(mode)
+    : base_type(size), mode_(mode)
+    {}
+
+    MemoryMRUCache(MemoryMRUCacheMode mode, const pwiz::util::cache_config& config)
+    : base_type(config), mode_(mode)
     {}
 
     /// set the caching mode
@@ -54,7 +63,7 @@ class MemoryMRUCache : public pwiz::util::mru_list<PtrType, KeyExtractor>
     void setMode(MemoryMRUCacheMode mode)
     {
         if (mode != mode_)
-            pwiz::util::mru_list<PtrType, KeyExtractor>::clear();
+            base_type::clear();
         mode_ = mode;
     }
 
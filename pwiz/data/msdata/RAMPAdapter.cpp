@@ -136,7 +136,7 @@ void RAMPAdapter::Impl::getScanHeader(size_t index, ScanHeaderStruct& result, bo
 
     result.seqNum = static_cast<int>(index + 1);
     result.acquisitionNum = getScanNumber(index);
-    result.msLevel = spectrum->cvParam(MS_ms_level).valueAs<int>();
+    result.msLevel = spectrum->cvParamValueOrDefault(MS_ms_level, 0);
     if (result.msLevel>1)
     {
         CVParam dissociationMethod = spectrum->precursors[0].activation.cvParamChild(MS_dissociation_method);
@@ -153,14 +153,14 @@ void RAMPAdapter::Impl::getScanHeader(size_t index, ScanHeaderStruct& result, bo
     }
 
     result.peaksCount = static_cast<int>(spectrum->defaultArrayLength);
-    result.totIonCurrent = spectrum->cvParam(MS_total_ion_current).valueAs<double>();
+    result.totIonCurrent = spectrum->cvParamValueOrDefault(MS_total_ion_current, 0.0);
     result.retentionTime = scan.cvParam(MS_scan_start_time).timeInSeconds();
-    result.basePeakMZ = spectrum->cvParam(MS_base_peak_m_z).valueAs<double>();    
-    result.basePeakIntensity = spectrum->cvParam(MS_base_peak_intensity).valueAs<double>();    
+    result.basePeakMZ = spectrum->cvParamValueOrDefault(MS_base_peak_m_z, 0.0);    
+    result.basePeakIntensity = spectrum->cvParamValueOrDefault(MS_base_peak_intensity, 0.0);    
     result.collisionEnergy = 0;
-    result.ionisationEnergy = spectrum->cvParam(MS_ionization_energy_OBSOLETE).valueAs<double>();
-    result.lowMZ = spectrum->cvParam(MS_lowest_observed_m_z).valueAs<double>();        
-    result.highMZ = spectrum->cvParam(MS_highest_observed_m_z).valueAs<double>();        
+    result.ionisationEnergy = spectrum->cvParamValueOrDefault(MS_ionization_energy_OBSOLETE, 0.0);
+    result.lowMZ = spectrum->cvParamValueOrDefault(MS_lowest_observed_m_z, 0.0);        
+    result.highMZ = spectrum->cvParamValueOrDefault(MS_highest_observed_m_z, 0.0);        
     result.precursorScanNum = 0;
     result.precursorMZ = 0;
     result.precursorCharge = 0;
@@ -188,7 +188,7 @@ void RAMPAdapter::Impl::getScanHeader(size_t index, ScanHeaderStruct& result, bo
     if (!spectrum->precursors.empty())
     {
         const Precursor& precursor = spectrum->precursors[0];
-        result.collisionEnergy = precursor.activation.cvParam(MS_collision_energy).valueAs<double>();
+        result.collisionEnergy = precursor.activation.cvParamValueOrDefault(MS_collision_energy, 0.0);
         size_t precursorIndex = msd_.run.spectrumListPtr->find(precursor.spectrumID);
 
         if (precursorIndex < msd_.run.spectrumListPtr->size())
@@ -208,13 +208,13 @@ void RAMPAdapter::Impl::getScanHeader(size_t index, ScanHeaderStruct& result, bo
         }
         if (!precursor.selectedIons.empty())
         {
-            result.precursorMZ = precursor.selectedIons[0].cvParam(MS_selected_ion_m_z).valueAs<double>();
+            result.precursorMZ = precursor.selectedIons[0].cvParamValueOrDefault(MS_selected_ion_m_z, 0.0);
             if (!result.precursorMZ)
             { // mzML 1.0?
-                result.precursorMZ = precursor.selectedIons[0].cvParam(MS_m_z).valueAs<double>();
+                result.precursorMZ = precursor.selectedIons[0].cvParamValueOrDefault(MS_m_z, 0.0);
             }
-            result.precursorCharge = precursor.selectedIons[0].cvParam(MS_charge_state).valueAs<int>();
-            result.precursorIntensity = precursor.selectedIons[0].cvParam(MS_peak_intensity).valueAs<double>();
+            result.precursorCharge = precursor.selectedIons[0].cvParamValueOrDefault(MS_charge_state, 0);
+            result.precursorIntensity = precursor.selectedIons[0].cvParamValueOrDefault(MS_peak_intensity, 0.0);
         }
     }
 
@@ -44,6 +44,7 @@ Reader::Config::Config()
     , combineIonMobilitySpectra(false)
     , unknownInstrumentIsError(false)
     , adjustUnknownTimeZonesToHostTimeZone(true)
+    , indexSidecar(false)
 {
 }
 
@@ -57,6 +58,7 @@ Reader::Config::Config(const Config& rhs)
     combineIonMobilitySpectra = rhs.combineIonMobilitySpectra;
     unknownInstrumentIsError = rhs.unknownInstrumentIsError;
     adjustUnknownTimeZonesToHostTimeZone = rhs.adjustUnknownTimeZonesToHostTimeZone;
+    indexSidecar = rhs.indexSidecar;
 }
 
 // default implementation; most Readers don't need to worry about multi-run input files
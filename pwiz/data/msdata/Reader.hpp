@@ -64,6 +64,10 @@ class PWIZ_API_DECL Reader
         /// when false, the reader will treat times with unknown time zone as UTC
         bool adjustUnknownTimeZonesToHostTimeZone;
 
+        /// when true, the mzML, mzXML and MGF readers save the spectrum index of a file next to it (see IndexSidecar)
+        /// and read it back on later reads instead of scanning the file again
+        bool indexSidecar;
+
         Config();
         Config(const Config& rhs);
     };
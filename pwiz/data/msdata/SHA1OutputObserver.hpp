@@ -38,6 +38,7 @@ class PWIZ_API_DECL SHA1OutputObserver : public minimxml::XMLWriter::OutputObser
 {
     public:
     virtual void update(const std::string& output) {sha1Calculator_.update(output);}
+    virtual void update(const char* output, size_t length) {sha1Calculator_.update(reinterpret_cast<const unsigned char*>(output), length);}
     std::string hash() {return sha1Calculator_.hashProjected();}
 
     private:
@@ -42,13 +42,17 @@ class Serializer_MGF::Impl
 {
     public:
 
-    Impl()
+    Impl(const SpectrumWorkerThreads::Config& spectrumWorkerThreadsConfig)
+    :   spectrumWorkerThreadsConfig_(spectrumWorkerThreadsConfig)
     {}
 
     void write(ostream& os, const MSData& msd,
                const pwiz::util::IterationListenerRegistry* iterationListenerRegistry) const;
 
-    void read(shared_ptr<istream> is, MSData& msd) const;
+    void read(shared_ptr<istream> is, MSData& msd, const IndexSidecarPtr& sidecar) const;
+
+    private:
+    SpectrumWorkerThreads::Config spectrumWorkerThreadsConfig_;
 };
 
 template <typename T>
@@ -72,14 +76,14 @@ void Serializer_MGF::Impl::write(ostream& os, const MSData& msd,
 
     os << std::setprecision(10); // 1234.567890
     SpectrumList& sl = *msd.run.spectrumListPtr;
-    SpectrumWorkerThreads spectrumWorkers(sl);
+    SpectrumWorkerThreads spectrumWorkers(sl, spectrumWorkerThreadsConfig_);
     for (size_t i=0, end=sl.size(); i < end; ++i)
     {
         //SpectrumPtr s = sl.spectrum(i, true);
         SpectrumPtr s = spectrumWorkers.processBatch(i);
         Scan* scan = !s->scanList.empty() ? &s->scanList.scans[0] : 0;
 
-        if (s->cvParam(MS_ms_level).valueAs<int>() > 1 &&
+        if (s->cvParamValueOrDefault(MS_ms_level, 0) > 1 &&
             !s->precursors.empty() &&
             !s->precursors[0].selectedIons.empty())
         {
@@ -157,7 +161,7 @@ void Serializer_MGF::Impl::write(ostream& os, const MSData& msd,
 }
 
 
-void Serializer_MGF::Impl::read(shared_ptr<istream> is, MSData& msd) const
+void Serializer_MGF::Impl::read(shared_ptr<istream> is, MSData& msd, const IndexSidecarPtr& sidecar) const
 {
     if (!is.get() || !*is)
         throw runtime_error("[Serializer_MGF::read()] Bad istream.");
@@ -181,7 +185,7 @@ void Serializer_MGF::Impl::read(shared_ptr<istream> is, MSData& msd) const
     // we treat all MGF data is MSn (PMF MGFs not currently supported)
     msd.fileDescription.fileContent.set(MS_MSn_spectrum);
     msd.fileDescription.fileContent.set(MS_centroid_spectrum);
-    msd.run.spectrumListPtr = SpectrumList_MGF::create(is, msd);
+    msd.run.spectrumListPtr = SpectrumList_MGF::create(is, msd, sidecar);
     msd.run.chromatogramListPtr.reset(new ChromatogramListSimple);
 }
 
@@ -191,8 +195,8 @@ void Serializer_MGF::Impl::read(shared_ptr<istream> is, MSData& msd) const
 //
 
 
-PWIZ_API_DECL Serializer_MGF::Serializer_MGF()
-:   impl_(new Impl())
+PWIZ_API_DECL Serializer_MGF::Serializer_MGF(const SpectrumWorkerThreads::Config& spectrumWorkerThreadsConfig)
+:   impl_(new Impl(spectrumWorkerThreadsConfig))
 {}
 
 
@@ -204,9 +208,9 @@ PWIZ_API_DECL void Serializer_MGF::write(ostream& os, const MSData& msd,
 }
 
 
-PWIZ_API_DECL void Serializer_MGF::read(shared_ptr<istream> is, MSData& msd) const
+PWIZ_API_DECL void Serializer_MGF::read(shared_ptr<istream> is, MSData& msd, const IndexSidecarPtr& sidecar) const
 {
-    return impl_->read(is, msd);
+    return impl_->read(is, msd, sidecar);
 }
 
 
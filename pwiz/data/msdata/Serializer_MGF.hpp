@@ -25,7 +25,9 @@
 
 #include "pwiz/utility/misc/Export.hpp"
 #include "MSData.hpp"
+#include "IndexSidecar.hpp"
 #include "BinaryDataEncoder.hpp"
+#include "SpectrumWorkerThreads.hpp"
 #include "pwiz/utility/misc/IterationListener.hpp"
 
 
@@ -38,8 +40,8 @@ class PWIZ_API_DECL Serializer_MGF
 {
     public:
 
-    /// constructor
-    Serializer_MGF();
+    /// constructor; spectrumWorkerThreadsConfig sets the worker threads that fetch spectra ahead of write()
+    Serializer_MGF(const SpectrumWorkerThreads::Config& spectrumWorkerThreadsConfig = SpectrumWorkerThreads::Config());
 
     /// write MSData object to ostream as MGF;
     /// iterationListenerRegistry may be used to receive progress updates
@@ -48,8 +50,10 @@ class PWIZ_API_DECL Serializer_MGF
 
     /// read in MSData object from an MGF istream 
     /// note: istream may be managed by MSData's SpectrumList, to allow for 
-    /// lazy evaluation of Spectrum data
-    void read(boost::shared_ptr<std::istream> is, MSData& msd) const;
+    /// lazy evaluation of Spectrum data;
+    /// if sidecar is set, the spectrum index is read from it when it is up to date, and saved to it otherwise
+    void read(boost::shared_ptr<std::istream> is, MSData& msd,
+              const IndexSidecarPtr& sidecar = IndexSidecarPtr()) const;
 
     private:
     class Impl;
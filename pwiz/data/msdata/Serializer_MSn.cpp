@@ -54,7 +54,8 @@ using namespace pwiz::chemistry;
 class Serializer_MSn::Impl
 {
     public:
-        Impl(MSn_Type filetype) : _filetype(filetype) {}
+        Impl(MSn_Type filetype, const SpectrumWorkerThreads::Config& spectrumWorkerThreadsConfig)
+        :   _filetype(filetype), _spectrumWorkerThreadsConfig(spectrumWorkerThreadsConfig) {}
         
         void write(ostream& os, const MSData& msd, 
                    const pwiz::util::IterationListenerRegistry* iterationListenerRegistry) const;
@@ -63,6 +64,7 @@ class Serializer_MSn::Impl
 
     private: 
         MSn_Type _filetype; // .ms1, .cms1, .bms1, .ms2, .cms2, .bms2
+        SpectrumWorkerThreads::Config _spectrumWorkerThreadsConfig;
 };
 
 namespace 
@@ -109,7 +111,7 @@ namespace
         int startingChargesCount = charges.size();
         CVParam chargeParam = si.cvParam(MS_charge_state);
         CVParam massParam = si.cvParam(MS_accurate_mass_OBSOLETE);
-        double mz = si.cvParam(MS_selected_ion_m_z).valueAs<double>();
+        double mz = si.cvParamValueOrDefault(MS_selected_ion_m_z, 0.0);
         if (!chargeParam.empty())
         {
             charges.push_back(chargeParam.valueAs<int>());
@@ -152,7 +154,7 @@ namespace
     void writeSpectrumText(SpectrumPtr s, ostream& os)
     {
         os << std::setprecision(7); // 123.4567
-        bool ms1File = s->cvParam(MS_ms_level).valueAs<int>() == 1;
+        bool ms1File = s->cvParamValueOrDefault(MS_ms_level, 0) == 1;
         
         // Write the scan numbers 
         os << "S\t";
@@ -163,7 +165,7 @@ namespace
         {
             // Write the precursor mz
             Precursor& precur = s->precursors[0];
-            double mz = precur.isolationWindow.cvParam(MS_isolation_window_target_m_z).valueAs<double>();
+            double mz = precur.isolationWindow.cvParamValueOrDefault(MS_isolation_window_target_m_z, 0.0);
             os << "\t" << mz;
         }
         os << "\n";
@@ -177,19 +179,19 @@ namespace
             // Write the base peak intensity and base peak m/z
             if (s->hasCVParam(MS_base_peak_intensity))
             {
-                double bpi = s->cvParam(MS_base_peak_intensity).valueAs<double>();
+                double bpi = s->cvParamValueOrDefault(MS_base_peak_intensity, 0.0);
                 os << "I\tBPI\t" << bpi << "\n";
             }
             if (s->hasCVParam(MS_base_peak_m_z))
             {
-                double bpm = s->cvParam(MS_base_peak_m_z).valueAs<double>();
+                double bpm = s->cvParamValueOrDefault(MS_base_peak_m_z, 0.0);
                 os << "I\tBPM\t" << bpm << "\n";
             }
 
             // Write the total ion current
             if (s->hasCVParam(MS_total_ion_current))
             {
-                double tic = s->cvParam(MS_total_ion_current).valueAs<double>();
+                double tic = s->cvParamValueOrDefault(MS_total_ion_current, 0.0);
                 os << "I\tTIC\t" << tic << "\n";
             }
         }
@@ -294,7 +296,7 @@ namespace
 
     void writeSpectrumBinary(SpectrumPtr s, int version, bool compress, ostream& os)
     {
-        bool ms1File = s->cvParam(MS_ms_level).valueAs<int>() == 1;
+        bool ms1File = s->cvParamValueOrDefault(MS_ms_level, 0) == 1;
 
         int scanNum = getScanNumber(s);
         os.write(reinterpret_cast<char *>(&scanNum), sizeIntMSn);
@@ -306,7 +308,7 @@ namespace
         {
             precur = s->precursors[0];
             si = precur.selectedIons[0];
-            double mz = precur.isolationWindow.cvParam(MS_isolation_window_target_m_z).valueAs<double>();
+            double mz = precur.isolationWindow.cvParamValueOrDefault(MS_isolation_window_target_m_z, 0.0);
             os.write(reinterpret_cast<char *>(&mz), sizeDoubleMSn);
         }
         else
@@ -325,10 +327,10 @@ namespace
         
         if (version >= 2)
         {
-            float basePeakIntensity = s->cvParam(MS_base_peak_intensity).valueAs<float>();
+            float basePeakIntensity = s->cvParamValueOrDefault(MS_base_peak_intensity, 0.0f);
             os.write(reinterpret_cast<char *>(&basePeakIntensity), sizeFloatMSn);
 
-            double basePeakMZ = s->cvParam(MS_base_peak_m_z).valueAs<double>();
+            double basePeakMZ = s->cvParamValueOrDefault(MS_base_peak_m_z, 0.0);
             os.write(reinterpret_cast<char *>(&basePeakMZ), sizeDoubleMSn);
             
             // We don't have this information, but we need to write something,
@@ -338,7 +340,7 @@ namespace
             double conversionFactorB = (double)0;
             os.write(reinterpret_cast<char *>(&conversionFactorB), sizeDoubleMSn); 
 
-            double tic = s->cvParam(MS_total_ion_current).valueAs<double>();
+            double tic = s->cvParamValueOrDefault(MS_total_ion_current, 0.0);
             os.write(reinterpret_cast<char *>(&tic), sizeDoubleMSn);
 
             // TODO
@@ -438,12 +440,12 @@ void Serializer_MSn::Impl::write(ostream& os, const MSData& msd,
     // Go through the spectrum list and write each spectrum
     bool ms1File = MSn_Type_MS1 == _filetype || MSn_Type_BMS1 == _filetype || MSn_Type_CMS1 == _filetype;
     SpectrumList& sl = *msd.run.spectrumListPtr;
-    SpectrumWorkerThreads spectrumWorkers(sl);
+    SpectrumWorkerThreads spectrumWorkers(sl, _spectrumWorkerThreadsConfig);
     for (size_t i=0, end=sl.size(); i < end; ++i)
     {
         //SpectrumPtr s = sl.spectrum(i, true);
         SpectrumPtr s = spectrumWorkers.processBatch(i);
-        int msLevel = s->cvParam(MS_ms_level).valueAs<int>();
+        int msLevel = s->cvParamValueOrDefault(MS_ms_level, 0);
         if ((ms1File && msLevel == 1) ||
             (!ms1File && msLevel == 2 && !s->precursors.empty() && !s->precursors[0].selectedIons.empty()))
         {
@@ -509,8 +511,8 @@ void Serializer_MSn::Impl::read(shared_ptr<istream> is, MSData& msd) const
 // Serializer_MSn
 //
 
-PWIZ_API_DECL Serializer_MSn::Serializer_MSn(MSn_Type filetype)
-:   impl_(new Impl(filetype))
+PWIZ_API_DECL Serializer_MSn::Serializer_MSn(MSn_Type filetype, const SpectrumWorkerThreads::Config& spectrumWorkerThreadsConfig)
+:   impl_(new Impl(filetype, spectrumWorkerThreadsConfig))
 {}
 
 PWIZ_API_DECL void Serializer_MSn::write(ostream& os, const MSData& msd,
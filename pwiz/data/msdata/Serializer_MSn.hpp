@@ -25,6 +25,7 @@
 #include "pwiz/utility/misc/Export.hpp"
 #include "MSData.hpp"
 #include "BinaryDataEncoder.hpp"
+#include "SpectrumWorkerThreads.hpp"
 #include "pwiz/utility/misc/IterationListener.hpp"
 #include "SpectrumList_MSn.hpp"
 
@@ -38,8 +39,9 @@ class PWIZ_API_DECL Serializer_MSn
 {
     public:
 
-    /// constructor
-    Serializer_MSn(MSn_Type filetype);
+    /// constructor; spectrumWorkerThreadsConfig sets the worker threads that fetch spectra ahead of write()
+    Serializer_MSn(MSn_Type filetype,
+                   const SpectrumWorkerThreads::Config& spectrumWorkerThreadsConfig = SpectrumWorkerThreads::Config());
 
     /// write MSData object to ostream as MSn;
     /// iterationListenerRegistry may be used to receive progress updates
@@ -53,7 +53,7 @@ class Serializer_mzML::Impl
     void write(ostream& os, const MSData& msd,
                const pwiz::util::IterationListenerRegistry* iterationListenerRegistry) const;
 
-    void read(shared_ptr<istream> is, MSData& msd) const;
+    void read(shared_ptr<istream> is, MSData& msd, const IndexSidecarPtr& sidecar) const;
 
     private:
     Config config_; 
@@ -159,7 +159,8 @@ void Serializer_mzML::Impl::write(ostream& os, const MSData& msd,
     vector<stream_offset> chromatogramPositions;
     BinaryDataEncoder::Config bdeConfig = config_.binaryDataEncoderConfig;
     bdeConfig.byteOrder = BinaryDataEncoder::ByteOrder_LittleEndian; // mzML always little endian
-    IO::write(xmlWriter, msd, bdeConfig, &spectrumPositions, &chromatogramPositions, iterationListenerRegistry);
+    IO::write(xmlWriter, msd, bdeConfig, &spectrumPositions, &chromatogramPositions, iterationListenerRegistry,
+              config_.spectrumWorkerThreadsConfig);
 
     // <indexedmzML> end
 
@@ -207,7 +208,7 @@ struct HandlerIndexedMZML : public SAXParser::Handler
 };
 
 
-void Serializer_mzML::Impl::read(shared_ptr<istream> is, MSData& msd) const
+void Serializer_mzML::Impl::read(shared_ptr<istream> is, MSData& msd, const IndexSidecarPtr& sidecar) const
 {
     if (!is.get() || !*is)
         throw runtime_error("[Serializer_mzML::read()] Bad istream.");
@@ -221,7 +222,7 @@ void Serializer_mzML::Impl::read(shared_ptr<istream> is, MSData& msd) const
     }
 
     IO::read(*is, msd, IO::IgnoreSpectrumList);
-    Index_mzML_Ptr indexPtr(new Index_mzML(is, msd));
+    Index_mzML_Ptr indexPtr(new Index_mzML(is, msd, sidecar));
     msd.run.spectrumListPtr = SpectrumList_mzML::create(is, msd, indexPtr);
     msd.run.chromatogramListPtr = ChromatogramList_mzML::create(is, msd, indexPtr);
 }
@@ -245,9 +246,9 @@ PWIZ_API_DECL void Serializer_mzML::write(ostream& os, const MSData& msd,
 }
 
 
-PWIZ_API_DECL void Serializer_mzML::read(shared_ptr<istream> is, MSData& msd) const
+PWIZ_API_DECL void Serializer_mzML::read(shared_ptr<istream> is, MSData& msd, const IndexSidecarPtr& sidecar) const
 {
-    return impl_->read(is, msd);
+    return impl_->read(is, msd, sidecar);
 }
 
 
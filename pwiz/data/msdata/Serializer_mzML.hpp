@@ -27,7 +27,9 @@
 
 #include "pwiz/utility/misc/Export.hpp"
 #include "MSData.hpp"
+#include "IndexSidecar.hpp"
 #include "BinaryDataEncoder.hpp"
+#include "SpectrumWorkerThreads.hpp"
 #include "pwiz/utility/misc/IterationListener.hpp"
 
 
@@ -50,6 +52,9 @@ class PWIZ_API_DECL Serializer_mzML
         /// (indexed==true): read/write with <indexedmzML> wrapper
         bool indexed;
 
+        /// worker threads that fetch spectra ahead of write()
+        SpectrumWorkerThreads::Config spectrumWorkerThreadsConfig;
+
         Config() : indexed(true) {}
     };
 
@@ -63,8 +68,10 @@ class PWIZ_API_DECL Serializer_mzML
 
     /// read in MSData object from an mzML istream 
     /// note: istream may be managed by MSData's SpectrumList, to allow for 
-    /// lazy evaluation of Spectrum data
-    void read(boost::shared_ptr<std::istream> is, MSData& msd) const;
+    /// lazy evaluation of Spectrum data;
+    /// if sidecar is set, the spectrum index is read from it when it is up to date, and saved to it otherwise
+    void read(boost::shared_ptr<std::istream> is, MSData& msd,
+              const IndexSidecarPtr& sidecar = IndexSidecarPtr()) const;
 
     private:
     class Impl;
@@ -56,7 +56,7 @@ class Serializer_mzXML::Impl
     void write(ostream& os, const MSData& msd,
                const pwiz::util::IterationListenerRegistry* iterationListenerRegistry) const;
 
-    void read(shared_ptr<istream> is, MSData& msd) const;
+    void read(shared_ptr<istream> is, MSData& msd, const IndexSidecarPtr& sidecar) const;
 
     private:
     Config config_; 
@@ -701,7 +701,7 @@ void write_scans(XMLWriter& xmlWriter, const MSData& msd,
     if (!sl.get()) return;
 
     CVID defaultNativeIdFormat = id::getDefaultNativeIDFormat(msd);
-    SpectrumWorkerThreads spectrumWorkers(*sl);
+    SpectrumWorkerThreads spectrumWorkers(*sl, config.spectrumWorkerThreadsConfig);
 
     for (size_t i=0; i<sl->size(); i++)
     {
@@ -1352,7 +1352,7 @@ class Handler_mzXML : public SAXParser::Handler
 } // namespace
 
 
-void Serializer_mzXML::Impl::read(shared_ptr<istream> is, MSData& msd) const
+void Serializer_mzXML::Impl::read(shared_ptr<istream> is, MSData& msd, const IndexSidecarPtr& sidecar) const
 {
     if (!is.get() || !*is)
         throw runtime_error("[Serializer_mzXML::read()] Bad istream.");
@@ -1361,7 +1361,7 @@ void Serializer_mzXML::Impl::read(shared_ptr<istream> is, MSData& msd) const
     Handler_mzXML handler(msd, cvTranslator_);
     SAXParser::parse(*is, handler);
 
-    msd.run.spectrumListPtr = SpectrumList_mzXML::create(is, msd, config_.indexed);
+    msd.run.spectrumListPtr = SpectrumList_mzXML::create(is, msd, config_.indexed, sidecar);
 
     HandlerScanFileContent handlerScanFileContent(msd, handler.hasCentroidDataProcessing);
     for (size_t i=0; i < msd.run.spectrumListPtr->size(); ++i)
@@ -1391,9 +1391,9 @@ PWIZ_API_DECL void Serializer_mzXML::write(ostream& os, const MSData& msd,
 }
 
 
-PWIZ_API_DECL void Serializer_mzXML::read(shared_ptr<istream> is, MSData& msd) const
+PWIZ_API_DECL void Serializer_mzXML::read(shared_ptr<istream> is, MSData& msd, const IndexSidecarPtr& sidecar) const
 {
-    return impl_->read(is, msd);
+    return impl_->read(is, msd, sidecar);
 }
 
 
@@ -72,17 +72,18 @@ PWIZ_API_DECL void SpectrumInfo::update(const Spectrum& spectrum, bool getBinary
             // ignore out-of-range exception
         }
 
-    scanEvent = scan.cvParam(MS_preset_scan_configuration).valueAs<int>(); 
-    msLevel = spectrum.cvParam(MS_ms_level).valueAs<int>();
+    scanEvent = scan.cvParamValueOrDefault(MS_preset_scan_configuration, 0); 
+    msLevel = spectrum.cvParamValueOrDefault(MS_ms_level, 0);
     isZoomScan = spectrum.hasCVParam(MS_zoom_scan);
-    retentionTime = scan.cvParam(MS_scan_start_time).timeInSeconds();
+    const CVParam* scanStartTime = scan.findCVParam(MS_scan_start_time);
+    retentionTime = scanStartTime ? scanStartTime->timeInSeconds() : 0;
     filterString = scan.cvParam(MS_filter_string).value;
-    mzLow = spectrum.cvParam(MS_lowest_observed_m_z).valueAs<double>();        
-    mzHigh = spectrum.cvParam(MS_highest_observed_m_z).valueAs<double>();        
-    basePeakMZ = spectrum.cvParam(MS_base_peak_m_z).valueAs<double>();    
-    basePeakIntensity = spectrum.cvParam(MS_base_peak_intensity).valueAs<double>();    
-    totalIonCurrent = spectrum.cvParam(MS_total_ion_current).valueAs<double>();  
-    ionInjectionTime = scan.cvParam(MS_ion_injection_time).valueAs<double>();
+    mzLow = spectrum.cvParamValueOrDefault(MS_lowest_observed_m_z, 0.0);        
+    mzHigh = spectrum.cvParamValueOrDefault(MS_highest_observed_m_z, 0.0);        
+    basePeakMZ = spectrum.cvParamValueOrDefault(MS_base_peak_m_z, 0.0);    
+    basePeakIntensity = spectrum.cvParamValueOrDefault(MS_base_peak_intensity, 0.0);    
+    totalIonCurrent = spectrum.cvParamValueOrDefault(MS_total_ion_current, 0.0);  
+    ionInjectionTime = scan.cvParamValueOrDefault(MS_ion_injection_time, 0.0);
 
     UserParam userParamMonoisotopicMZ = scan.userParam("[Thermo Trailer Extra]Monoisotopic M/Z:");
     if (!userParamMonoisotopicMZ.name.empty())
@@ -94,9 +95,9 @@ PWIZ_API_DECL void SpectrumInfo::update(const Spectrum& spectrum, bool getBinary
         precursorInfo.index = 0; // TODO
         if (!it->selectedIons.empty())
         {
-            precursorInfo.mz = it->selectedIons[0].cvParam(MS_selected_ion_m_z).valueAs<double>();
-            precursorInfo.charge = it->selectedIons[0].cvParam(MS_charge_state).valueAs<int>();
-            precursorInfo.intensity = it->selectedIons[0].cvParam(MS_peak_intensity).valueAs<double>();
+            precursorInfo.mz = it->selectedIons[0].cvParamValueOrDefault(MS_selected_ion_m_z, 0.0);
+            precursorInfo.charge = it->selectedIons[0].cvParamValueOrDefault(MS_charge_state, 0);
+            precursorInfo.intensity = it->selectedIons[0].cvParamValueOrDefault(MS_peak_intensity, 0.0);
         }
         precursors.push_back(precursorInfo);
     }
@@ -30,10 +30,30 @@ namespace pwiz {
 namespace msdata {
     
 
+PWIZ_API_DECL SpectrumListCache::Config::Config()
+:   mode(MemoryMRUCacheMode_MetaDataAndBinaryData),
+    maxSpectra(0),
+    maxBytes(256 * 1024 * 1024),
+    shardCount(16),
+    evictionPolicy(util::cache_eviction_lru),
+    packBinaryData(false)
+{
+}
+
+
 PWIZ_API_DECL SpectrumListCache::SpectrumListCache(const SpectrumListPtr& inner,
                                                    MemoryMRUCacheMode cacheMode,
-                                                   size_t cacheSize)
-: SpectrumListWrapper(inner), spectrumCache_(cacheMode, cacheSize)
+                                                   size_t cacheSize,
+                                                   bool packBinaryData)
+: SpectrumListWrapper(inner), spectrumCache_(cacheMode, cacheSize), packBinaryData_(packBinaryData)
+{
+}
+
+
+PWIZ_API_DECL SpectrumListCache::SpectrumListCache(const SpectrumListPtr& inner, const Config& config)
+: SpectrumListWrapper(inner),
+  spectrumCache_(config.mode, util::cache_config(config.maxSpectra, config.maxBytes, config.shardCount, config.evictionPolicy)),
+  packBinaryData_(config.packBinaryData)
 {
 }
 
@@ -53,22 +73,84 @@ void clearSpectrumMetadata(Spectrum& spectrum)
 }
 
 
-struct modifyCachedSpectrumPtr
+// returns a copy of a cached spectrum with its packed arrays widened, or the cached spectrum itself if none are packed
+SpectrumPtr unpackedSpectrum(const SpectrumPtr& cached)
 {
-    modifyCachedSpectrumPtr(const SpectrumPtr& newSpectrumPtr)
-        : newSpectrumPtr_(newSpectrumPtr) {}
+    if (!cached->hasPackedBinaryData())
+        return cached;
+
+    SpectrumPtr result(new Spectrum(*cached));
+    result->unpackBinaryData();
+    return result;
+}
+
+
+size_t paramBytes(const ParamContainer& pc)
+{
+    size_t bytes = pc.paramGroupPtrs.capacity() * sizeof(ParamGroupPtr) +
+                   pc.cvParams.capacity() * sizeof(CVParam) +
+                   pc.userParams.capacity() * sizeof(UserParam);
+    BOOST_FOREACH(const CVParam& cvParam, pc.cvParams)
+        bytes += cvParam.value.capacity();
+    BOOST_FOREACH(const UserParam& userParam, pc.userParams)
+        bytes += userParam.name.capacity() + userParam.value.capacity() + userParam.type.capacity();
+    return bytes;
+}
+
+
+size_t binaryDataBytes(const BinaryDataArray& array)
+{
+    size_t bytes = sizeof(BinaryDataArray) + paramBytes(array) + array.data.capacity() * sizeof(double);
+    if (array.isPacked())
+        switch (array.packedType())
+        {
+            case BinaryDataType_Float32: case BinaryDataType_Int32: bytes += array.arrayLength() * 4; break;
+            case BinaryDataType_Float64: case BinaryDataType_Int64: bytes += array.arrayLength() * 8; break;
+        }
+    return bytes;
+}
+
+
+} // namespace
+
+
+PWIZ_API_DECL size_t SpectrumListCache::CacheEntryBytes::operator()(const CacheEntry& entry) const
+{
+    size_t bytes = sizeof(CacheEntry);
+    if (!entry.spectrum.get())
+        return bytes;
+
+    const Spectrum& s = *entry.spectrum;
+    bytes += sizeof(Spectrum) + s.id.capacity() + s.spotID.capacity() + paramBytes(s);
 
-    void operator() (SpectrumListCache::CacheType::value_type& indexSpectrumPtrPair)
+    bytes += paramBytes(s.scanList) + s.scanList.scans.capacity() * sizeof(Scan);
+    BOOST_FOREACH(const Scan& scan, s.scanList.scans)
     {
-        indexSpectrumPtrPair.spectrum = newSpectrumPtr_;
+        bytes += paramBytes(scan) + scan.spectrumID.capacity() + scan.scanWindows.capacity() * sizeof(ScanWindow);
+        BOOST_FOREACH(const ScanWindow& window, scan.scanWindows)
+            bytes += paramBytes(window);
     }
 
-    private:
-    SpectrumPtr newSpectrumPtr_;
-};
+    bytes += s.precursors.capacity() * sizeof(Precursor);
+    BOOST_FOREACH(const Precursor& precursor, s.precursors)
+    {
+        bytes += paramBytes(precursor) + paramBytes(precursor.isolationWindow) + paramBytes(precursor.activation) +
+                 precursor.spectrumID.capacity() + precursor.selectedIons.capacity() * sizeof(SelectedIon);
+        BOOST_FOREACH(const SelectedIon& selectedIon, precursor.selectedIons)
+            bytes += paramBytes(selectedIon);
+    }
 
+    bytes += s.products.capacity() * sizeof(Product);
+    BOOST_FOREACH(const Product& product, s.products)
+        bytes += paramBytes(product.isolationWindow);
 
-} // namespace
+    bytes += s.binaryDataArrayPtrs.capacity() * sizeof(BinaryDataArrayPtr);
+    BOOST_FOREACH(const BinaryDataArrayPtr& array, s.binaryDataArrayPtrs)
+        if (array.get())
+            bytes += binaryDataBytes(*array);
+
+    return bytes;
+}
 
 
 // There are two kinds of spectrum requests: metadata and metadata+binary;
@@ -85,10 +167,17 @@ struct modifyCachedSpectrumPtr
 // - If cache metadata: get spectrum, make a copy, remove binary data, then cache the copy and return original
 // - If cache binary data: if spectrum cached, get spectrum without binary data, add cached binary data to it and return it; otherwise get full spectrum, make a copy, remove metadata, cache it, then return original spectrum
 // - If cache all: if spectrum not cached, cache it; return cached spectrum
+//
+// When packing binary data, the cached copy's arrays are packed, and spectra returned from the cache
+// are copies with the arrays unpacked.
+//
+// The inner list is never called with a cache lock held; if two threads miss on the same spectrum
+// at once, both get it from the inner list and the second result replaces the first in the cache.
 
 PWIZ_API_DECL SpectrumPtr SpectrumListCache::spectrum(size_t index, bool getBinaryData) const
 {
     SpectrumPtr original, copy;
+    CacheEntry cached(index, SpectrumPtr());
     if (getBinaryData)
     {
         switch (spectrumCache_.mode())
@@ -98,45 +187,51 @@ PWIZ_API_DECL SpectrumPtr SpectrumListCache::spectrum(size_t index, bool getBina
                 return inner_->spectrum(index, true);
 
             case MemoryMRUCacheMode_MetaDataAndBinaryData:
-                // if insert returns true, spectrum was not in cache
-                if (spectrumCache_.insert(CacheEntry(index, SpectrumPtr())))
-                    spectrumCache_.modify(spectrumCache_.begin(), modifyCachedSpectrumPtr(inner_->spectrum(index, true)));
-                return spectrumCache_.mru().spectrum;
+                if (spectrumCache_.get(index, cached))
+                    return unpackedSpectrum(cached.spectrum);
 
-            case MemoryMRUCacheMode_MetaDataOnly:
-
-                // if insert returns true, spectrum was not in cache
-                if (spectrumCache_.insert(CacheEntry(index, SpectrumPtr())))
+                original = inner_->spectrum(index, true);
+                if (packBinaryData_)
                 {
-                    original = inner_->spectrum(index, true);
                     copy.reset(new Spectrum(*original));
-                    copy->binaryDataArrayPtrs.clear();
-                    spectrumCache_.modify(spectrumCache_.begin(), modifyCachedSpectrumPtr(copy));
+                    copy->packBinaryData();
+                    spectrumCache_.put(CacheEntry(index, copy));
                 }
-                else {
+                else
+                    spectrumCache_.put(CacheEntry(index, original));
+                return original;
+
+            case MemoryMRUCacheMode_MetaDataOnly:
+                if (spectrumCache_.get(index, cached))
+                {
                     // we have cached metadata, hopefully this format knows how 
                     // to jump to binary data without rescanning metadata
-                    original = inner_->spectrum(spectrumCache_.mru().spectrum, true); // copy and add binary data
+                    return inner_->spectrum(cached.spectrum, true); // copy and add binary data
                 }
+
+                original = inner_->spectrum(index, true);
+                copy.reset(new Spectrum(*original));
+                copy->binaryDataArrayPtrs.clear();
+                spectrumCache_.put(CacheEntry(index, copy));
                 return original;
 
             case MemoryMRUCacheMode_BinaryDataOnly:
-                // if insert returns true, spectrum was not in cache
-                if (spectrumCache_.insert(CacheEntry(index, SpectrumPtr())))
-                {
-                    original = inner_->spectrum(index, true);
-                    copy.reset(new Spectrum(*original));
-                    clearSpectrumMetadata(*copy);
-                    spectrumCache_.modify(spectrumCache_.begin(), modifyCachedSpectrumPtr(copy));
-                    return original;
-                }
-                else
+                if (spectrumCache_.get(index, cached))
                 {
                     // get spectrum metadata, add cached binary data to it
                     original = inner_->spectrum(index, false);
-                    original->binaryDataArrayPtrs = spectrumCache_.mru().spectrum->binaryDataArrayPtrs;
+                    original->binaryDataArrayPtrs = cached.spectrum->binaryDataArrayPtrs;
+                    original->unpackBinaryData();
                     return original;
                 }
+
+                original = inner_->spectrum(index, true);
+                copy.reset(new Spectrum(*original));
+                clearSpectrumMetadata(*copy);
+                if (packBinaryData_)
+                    copy->packBinaryData();
+                spectrumCache_.put(CacheEntry(index, copy));
+                return original;
         }
     }
     else // !getBinaryData
@@ -150,10 +245,12 @@ PWIZ_API_DECL SpectrumPtr SpectrumListCache::spectrum(size_t index, bool getBina
                 return inner_->spectrum(index, false);
 
             case MemoryMRUCacheMode_MetaDataOnly:
-                // if insert returns true, spectrum was not in cache
-                if (spectrumCache_.insert(CacheEntry(index, SpectrumPtr())))
-                    spectrumCache_.modify(spectrumCache_.begin(), modifyCachedSpectrumPtr(inner_->spectrum(index, false)));
-                return spectrumCache_.mru().spectrum;
+                if (spectrumCache_.get(index, cached))
+                    return cached.spectrum;
+
+                original = inner_->spectrum(index, false);
+                spectrumCache_.put(CacheEntry(index, original));
+                return original;
         }
     }
 }
@@ -168,6 +265,11 @@ PWIZ_API_DECL const SpectrumListCache::CacheType& SpectrumListCache::spectrumCac
     return spectrumCache_;
 }
 
+PWIZ_API_DECL util::cache_statistics SpectrumListCache::statistics() const
+{
+    return spectrumCache_.statistics();
+}
+
 
 } // namespace msdata
 } // namespace pwiz
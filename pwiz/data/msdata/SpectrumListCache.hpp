@@ -33,18 +33,43 @@ namespace pwiz {
 namespace msdata {
 
 
-/// adds a level of flexible MRU caching to a SpectrumList processor chain
+/// adds a level of flexible caching to a SpectrumList processor chain;
+/// the cache is thread-safe, so it may be shared by concurrent callers (e.g. SpectrumWorkerThreads)
 class PWIZ_API_DECL SpectrumListCache : public SpectrumListWrapper
 {
     public:
 
     /// a cache mapping spectrum indices to SpectrumPtrs
     struct CacheEntry { CacheEntry(size_t i, SpectrumPtr s) : index(i), spectrum(s) {}; size_t index; SpectrumPtr spectrum; };
-    typedef MemoryMRUCache<CacheEntry, BOOST_MULTI_INDEX_MEMBER(CacheEntry, size_t, index) > CacheType;
 
+    /// estimates the memory held by a cached spectrum (metadata and binary data), in bytes
+    struct PWIZ_API_DECL CacheEntryBytes { size_t operator()(const CacheEntry& entry) const; };
+
+    typedef MemoryMRUCache<CacheEntry, BOOST_MULTI_INDEX_MEMBER(CacheEntry, size_t, index), CacheEntryBytes> CacheType;
+
+    /// cache limits and policy; a limit of 0 means unlimited
+    struct PWIZ_API_DECL Config
+    {
+        MemoryMRUCacheMode mode;
+        size_t maxSpectra;
+        size_t maxBytes;    // as estimated by CacheEntryBytes
+        size_t shardCount;  // number of separately locked parts, each with an equal share of the limits
+        util::cache_eviction_policy evictionPolicy;
+        bool packBinaryData; // see below
+
+        Config();
+    };
+
+    /// caches up to cacheSize spectra, evicting the least recently used;
+    /// if packBinaryData is true, cached binary data arrays are held as 32-bit floats when that is lossless
+    /// (see Spectrum::packBinaryData()), roughly halving the cache's memory; cache hits then return copies
+    /// of the cached spectra with the arrays widened back to doubles
     SpectrumListCache(const SpectrumListPtr& inner,
                       MemoryMRUCacheMode cacheMode,
-                      size_t cacheSize);
+                      size_t cacheSize,
+                      bool packBinaryData = false);
+
+    SpectrumListCache(const SpectrumListPtr& inner, const Config& config);
 
     /// returns the requested spectrum which may or may not be cached depending on
     /// the current cache mode
@@ -56,8 +81,12 @@ class PWIZ_API_DECL SpectrumListCache : public SpectrumListWrapper
     /// returns a const-reference to the cache
     const CacheType& spectrumCache() const;
 
+    /// returns the cache's hit and miss counts and its current size in spectra and (estimated) bytes
+    util::cache_statistics statistics() const;
+
     protected:
     mutable CacheType spectrumCache_;
+    bool packBinaryData_;
 
     private:
     SpectrumListCache(SpectrumListCache&);
@@ -26,6 +26,9 @@
 #include "SpectrumListCache.hpp"
 #include "pwiz/utility/misc/Std.hpp"
 #include "Serializer_MGF.hpp"
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include <numeric>
 
 
 using namespace pwiz::util;
@@ -396,6 +399,117 @@ void testModeMetaDataAndBinaryData()
     unit_assert(spectrumHasBinaryData(*cache.lru().spectrum));
 }
 
+void testPackedBinaryData(MemoryMRUCacheMode mode)
+{
+    shared_ptr<SpectrumListSimple> sl(new SpectrumListSimple);
+    sl->spectra.push_back(makeSpectrumPtr(0, "S1"));
+    sl->spectra.push_back(makeSpectrumPtr(1, "S2"));
+    sl->spectra.push_back(makeSpectrumPtr(2, "S3"));
+
+    // the arrays in the cache are packed, but spectra come back with plain double arrays
+
+    SpectrumListCache slc(sl, mode, 2, true);
+    SpectrumListCache::CacheType& cache = slc.spectrumCache();
+
+    for (size_t pass=0; pass < 2; ++pass)
+    for (size_t i=0; i < sl->size(); ++i)
+    {
+        SpectrumPtr s = slc.spectrum(i, true);
+        unit_assert_operator_equal(i, s->index);
+        unit_assert(!s->hasPackedBinaryData());
+        unit_assert(s->getMZArray()->data == sl->spectra[i]->getMZArray()->data);
+        unit_assert(s->getIntensityArray()->data == sl->spectra[i]->getIntensityArray()->data);
+
+        unit_assert_operator_equal(i, cache.mru().index);
+        unit_assert(cache.mru().spectrum->hasPackedBinaryData());
+        unit_assert(cache.mru().spectrum->hasBinaryData());
+    }
+
+    // the inner list's spectra are not modified
+    for (size_t i=0; i < sl->size(); ++i)
+        unit_assert(!sl->spectra[i]->hasPackedBinaryData());
+}
+
+
+void testByteLimit()
+{
+    shared_ptr<SpectrumListSimple> sl(new SpectrumListSimple);
+    for (size_t i=0; i < 20; ++i)
+        sl->spectra.push_back(makeSpectrumPtr(i, "S" + lexical_cast<string>(i+1)));
+
+    // spectrum i has 10*(i+1) points, so larger spectra take more of the budget
+    SpectrumListCache::CacheEntryBytes entryBytes;
+    size_t smallBytes = entryBytes(SpectrumListCache::CacheEntry(0, sl->spectra[0]));
+    size_t largeBytes = entryBytes(SpectrumListCache::CacheEntry(19, sl->spectra[19]));
+    unit_assert(largeBytes > smallBytes + 190 * 2 * sizeof(double));
+
+    SpectrumListCache::Config config;
+    config.maxBytes = largeBytes * 2;
+    config.shardCount = 1;
+    SpectrumListCache slc(sl, config);
+
+    for (size_t i=0; i < sl->size(); ++i)
+        slc.spectrum(i, true);
+
+    cache_statistics stats = slc.statistics();
+    unit_assert_operator_equal(0, stats.hits);
+    unit_assert_operator_equal(20, stats.misses);
+    unit_assert(stats.weight <= config.maxBytes);
+    unit_assert(stats.items >= 2 && stats.items < 20);
+    unit_assert_operator_equal(stats.insertions - stats.evictions, stats.items);
+
+    // the most recent spectra are still cached
+    unit_assert(slc.spectrum(19, true) == sl->spectra[19]);
+    unit_assert_operator_equal(1, slc.statistics().hits);
+
+    // packing halves the binary data, so more spectra fit in the same budget
+    config.packBinaryData = true;
+    SpectrumListCache packedCache(sl, config);
+    for (size_t i=0; i < sl->size(); ++i)
+        packedCache.spectrum(i, true);
+    unit_assert(packedCache.statistics().items > stats.items);
+}
+
+
+void fetchSpectra(const SpectrumListCache* slc, size_t seed, size_t* mismatches)
+{
+    for (size_t i=0; i < 2000; ++i)
+    {
+        // mostly a small hot set, with the occasional scan over everything
+        size_t index = i % 4 == 0 ? (i * 31 + seed * 17) % slc->size() : (i * 7 + seed) % 10;
+        SpectrumPtr s = slc->spectrum(index, (i + seed) % 3 != 0);
+        if (s->index != index)
+            ++*mismatches;
+    }
+}
+
+
+void testConcurrentAccess(cache_eviction_policy policy, MemoryMRUCacheMode mode)
+{
+    shared_ptr<SpectrumListSimple> sl(new SpectrumListSimple);
+    for (size_t i=0; i < 50; ++i)
+        sl->spectra.push_back(makeSpectrumPtr(i, "S" + lexical_cast<string>(i+1)));
+
+    SpectrumListCache::Config config;
+    config.mode = mode;
+    config.maxSpectra = 20;
+    config.shardCount = 4;
+    config.evictionPolicy = policy;
+    SpectrumListCache slc(sl, config);
+
+    const size_t threadCount = 4;
+    vector<size_t> mismatches(threadCount, 0);
+    boost::thread_group threads;
+    for (size_t i=0; i < threadCount; ++i)
+        threads.create_thread(boost::bind(&fetchSpectra, &slc, i, &mismatches[i]));
+    threads.join_all();
+
+    unit_assert_operator_equal(0, accumulate(mismatches.begin(), mismatches.end(), (size_t) 0));
+    unit_assert(slc.spectrumCache().size() <= 20);
+    unit_assert(slc.statistics().hits > 0);
+}
+
+
 void testFileReads(const char *filename) {
     std::string srcparent(__FILE__); // locate test data relative to this source file
     // something like \ProteoWizard\pwiz\pwiz\data\msdata\SpectrumListCacheTest.cpp
@@ -435,6 +549,12 @@ void test()
     testModeMetaDataOnly();
     testModeBinaryDataOnly();
     testModeMetaDataAndBinaryData();
+    testPackedBinaryData(MemoryMRUCacheMode_BinaryDataOnly);
+    testPackedBinaryData(MemoryMRUCacheMode_MetaDataAndBinaryData);
+    testByteLimit();
+    testConcurrentAccess(cache_eviction_lru, MemoryMRUCacheMode_MetaDataAndBinaryData);
+    testConcurrentAccess(cache_eviction_clock, MemoryMRUCacheMode_MetaDataAndBinaryData);
+    testConcurrentAccess(cache_eviction_lfu, MemoryMRUCacheMode_MetaDataOnly);
     // check the delayed-binary-read
     // logic for mzML and mzXML readers
     testFileReads("tiny.pwiz.mzXML");
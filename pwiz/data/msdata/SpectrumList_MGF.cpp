@@ -43,10 +43,14 @@ class SpectrumList_MGFImpl : public SpectrumList_MGF
 {
     public:
 
-    SpectrumList_MGFImpl(shared_ptr<std::istream> is, const MSData& msd)
+    SpectrumList_MGFImpl(shared_ptr<std::istream> is, const MSData& msd, const IndexSidecarPtr& sidecar)
         :   is_(is), msd_(msd)
     {
-        createIndex();
+        if (!readSidecar(sidecar))
+        {
+            createIndex();
+            writeSidecar(sidecar);
+        }
     }
 
     size_t size() const {return index_.size();}
@@ -441,6 +445,36 @@ class SpectrumList_MGFImpl : public SpectrumList_MGF
         is_->clear();
         is_->seekg(0);
     }
+
+    // the TITLE of each spectrum is saved as its spotID
+    bool readSidecar(const IndexSidecarPtr& sidecar)
+    {
+        vector<ChromatogramIdentity> chromatograms;
+        if (!sidecar || !sidecar->read(index_, chromatograms, is_.get()))
+            return false;
+
+        BOOST_FOREACH(SpectrumIdentity& si, index_)
+        {
+            idToIndex_[si.id] = si.index;
+            if (!si.spotID.empty())
+                titleIDToIndexList_[si.spotID].push_back(si.index);
+            si.spotID.clear();
+        }
+        return true;
+    }
+
+    void writeSidecar(const IndexSidecarPtr& sidecar) const
+    {
+        if (!sidecar)
+            return;
+
+        vector<SpectrumIdentity> spectra(index_);
+        for (map<string, IndexList>::const_iterator itr = titleIDToIndexList_.begin(); itr != titleIDToIndexList_.end(); ++itr)
+            BOOST_FOREACH(size_t index, itr->second)
+                if (index < spectra.size())
+                    spectra[index].spotID = itr->first;
+        sidecar->write(spectra, vector<ChromatogramIdentity>(), is_.get());
+    }
 };
 
 
@@ -448,9 +482,10 @@ class SpectrumList_MGFImpl : public SpectrumList_MGF
 
 
 SpectrumListPtr SpectrumList_MGF::create(boost::shared_ptr<std::istream> is,
-                         const MSData& msd)
+                         const MSData& msd,
+                         const IndexSidecarPtr& sidecar)
 {
-    return SpectrumListPtr(new SpectrumList_MGFImpl(is, msd));
+    return SpectrumListPtr(new SpectrumList_MGFImpl(is, msd, sidecar));
 }
 
 
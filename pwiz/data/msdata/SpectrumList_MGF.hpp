@@ -28,6 +28,7 @@
 
 #include "pwiz/utility/misc/Export.hpp"
 #include "SpectrumListBase.hpp"
+#include "IndexSidecar.hpp"
 #include <iosfwd>
 #include <stdexcept>
 
@@ -41,8 +42,10 @@ class PWIZ_API_DECL SpectrumList_MGF : public SpectrumListBase
 {
     public:
 
+    /// if sidecar is set, the index is read from it when it is up to date, and saved to it otherwise
     static SpectrumListPtr create(boost::shared_ptr<std::istream> is,
-                                  const MSData& msd);
+                                  const MSData& msd,
+                                  const IndexSidecarPtr& sidecar = IndexSidecarPtr());
 };
 
 
@@ -125,7 +125,12 @@ private:
     mutable std::map<std::string, IndexList> spotMap_;
     size_t numberOfSpectra_;
     mutable bool initSpectra_;
+    /**
+     * Guards the lazy initialization and rref_, which caches lookups as it goes;
+     * the binary data is read without it, so threads can read spectra concurrently.
+     */
     mutable boost::mutex readMutex;
+    mutable boost::mutex initMutex_;
 
     void initSpectra() const;
 };
@@ -170,6 +175,7 @@ SpectrumList_mz5Impl::SpectrumList_mz5Impl(boost::shared_ptr<ReferenceRead_mz5>
 
 void SpectrumList_mz5Impl::initSpectra() const
 {
+    boost::lock_guard<boost::mutex> lock(initMutex_);
     if (!initSpectra_)
     {
         if (numberOfSpectra_ > 0)
@@ -247,11 +253,14 @@ SpectrumPtr SpectrumList_mz5Impl::spectrum(size_t index, DetailLevel detailLevel
 
 SpectrumPtr SpectrumList_mz5Impl::spectrum(size_t index, bool getBinaryData) const
 {
-    boost::lock_guard<boost::mutex> lock(readMutex);  // lock_guard will unlock mutex when out of scope or when exception thrown (during destruction)
     initSpectra();
     if (index >= 0 && index < numberOfSpectra_)
     {
-        SpectrumPtr ptr(spectrumData_[index].getSpectrum(*rref_));
+        SpectrumPtr ptr;
+        {
+            boost::lock_guard<boost::mutex> lock(readMutex);  // lock_guard will unlock mutex when out of scope or when exception thrown (during destruction)
+            ptr.reset(spectrumData_[index].getSpectrum(*rref_));
+        }
         std::pair<hsize_t, hsize_t> bounds = spectrumRanges_.find(index)->second;
         hsize_t start = bounds.first;
         hsize_t end = bounds.second;
@@ -264,6 +273,7 @@ SpectrumPtr SpectrumList_mz5Impl::spectrum(size_t index, bool getBinaryData) con
                 conn_->getData(inten, Configuration_mz5::SpectrumIntensity, start, end);
                 ptr->setMZIntensityArrays(mz, inten, CVID_Unknown);
                 // intensity unit will be set by the following command
+                boost::lock_guard<boost::mutex> lock(readMutex);
                 binaryParamsData_[index].fill(*ptr->getMZArray(), *ptr->getIntensityArray(), *rref_);
             }
         }
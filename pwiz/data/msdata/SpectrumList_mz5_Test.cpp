@@ -28,6 +28,7 @@
 #include "pwiz/utility/minimxml/XMLWriter.hpp"
 #include "pwiz/utility/misc/Std.hpp"
 #include "pwiz/utility/misc/Filesystem.hpp"
+#include "boost/thread/thread.hpp"
 
 
 using namespace pwiz::cv;
@@ -168,6 +169,106 @@ void test()
     bfs::remove(testFilename);
 }
 
+
+const size_t manySpectraCount = 2000;
+
+// spectrum i has 10 + i % 50 peaks
+void checkManySpectraSpectrum(const SpectrumList& sl, size_t index)
+{
+    SpectrumPtr s = sl.spectrum(index, true);
+    unit_assert_operator_equal("scan=" + lexical_cast<string>(index + 1), s->id);
+
+    vector<MZIntensityPair> pairs;
+    s->getMZIntensityPairs(pairs);
+    unit_assert_operator_equal(10 + index % 50, pairs.size());
+    for (size_t j = 0; j < pairs.size(); ++j)
+    {
+        unit_assert_equal(index + j * 0.25, pairs[j].mz, 1e-8);
+        unit_assert_operator_equal(double(index * j), pairs[j].intensity);
+    }
+}
+
+// every thread reads every spectrum, starting at a different one
+void readManySpectraWorker(const SpectrumList* sl, size_t first, bool* failed)
+{
+    try
+    {
+        for (size_t i = 0; i < manySpectraCount; ++i)
+            checkManySpectraSpectrum(*sl, (first + i) % manySpectraCount);
+    }
+    catch (exception& e)
+    {
+        cerr << "Exception in worker thread: " << e.what() << endl;
+        *failed = true;
+    }
+}
+
+// enough peaks for the m/z and intensity datasets to span many chunks, so spectra are
+// read from the block cache, across block boundaries, and from blocks read ahead
+void testManySpectra()
+{
+    if (os_) *os_ << "testManySpectra()" << endl;
+
+    const char* filename = "SpectrumList_mz5_Test.many.mz5";
+    {
+        MSData msd;
+        msd.id = "many";
+        boost::shared_ptr<SpectrumListSimple> slSimple(new SpectrumListSimple);
+        for (size_t i = 0; i < manySpectraCount; ++i)
+        {
+            SpectrumPtr s(new Spectrum);
+            s->index = i;
+            s->id = "scan=" + lexical_cast<string>(i + 1);
+            s->set(MS_ms_level, 1);
+            vector<double> mz, intensity;
+            for (size_t j = 0; j < 10 + i % 50; ++j)
+            {
+                mz.push_back(i + j * 0.25);
+                intensity.push_back(double(i * j));
+            }
+            s->setMZIntensityArrays(mz, intensity, MS_number_of_detector_counts);
+            slSimple->spectra.push_back(s);
+        }
+        msd.run.spectrumListPtr = slSimple;
+
+        MSDataFile::WriteConfig writeConfig;
+        writeConfig.binaryDataEncoderConfig.precision = BinaryDataEncoder::Precision_64;
+        Serializer_mz5 serializer(writeConfig);
+        serializer.write(filename, msd);
+    }
+
+    {
+        MSData msd;
+        Serializer_mz5 serializer;
+        serializer.read(filename, msd);
+        const SpectrumList& sl = *msd.run.spectrumListPtr;
+        unit_assert_operator_equal(manySpectraCount, sl.size());
+
+        // sequential, then backward, then scattered
+        for (size_t i = 0; i < manySpectraCount; ++i)
+            checkManySpectraSpectrum(sl, i);
+        for (size_t i = manySpectraCount; i > 0; --i)
+            checkManySpectraSpectrum(sl, i - 1);
+        for (size_t i = 0; i < manySpectraCount; ++i)
+            checkManySpectraSpectrum(sl, (i * 769) % manySpectraCount);
+    }
+
+    {
+        MSData msd;
+        Serializer_mz5 serializer;
+        serializer.read(filename, msd);
+
+        bool failed = false;
+        boost::thread_group threads;
+        for (size_t i = 0; i < 4; ++i)
+            threads.create_thread(boost::bind(&readManySpectraWorker, msd.run.spectrumListPtr.get(), i * manySpectraCount / 4, &failed));
+        threads.join_all();
+        unit_assert(!failed);
+    }
+
+    bfs::remove(filename);
+}
+
 int main(int argc, char* argv[])
 {
     TEST_PROLOG(argc, argv)
@@ -176,6 +277,7 @@ int main(int argc, char* argv[])
     {
         if (argc > 1 && !strcmp(argv[1], "-v")) os_ = &cout;
         test();
+        testManySpectra();
     }
     catch (exception& e)
     {
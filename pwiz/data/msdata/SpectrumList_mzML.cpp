@@ -27,6 +27,8 @@
 #include "IO.hpp"
 #include "References.hpp"
 #include "pwiz/utility/minimxml/SAXParser.hpp"
+#include "pwiz/utility/misc/random_access_compressed_ifstream.hpp"
+#include "pwiz/utility/misc/memory_streambuf.hpp"
 #include "pwiz/utility/misc/Std.hpp"
 #include <boost/bind.hpp>
 #include <boost/thread.hpp>
@@ -37,7 +39,9 @@ namespace msdata {
 
 
 using namespace pwiz::minimxml;
+using namespace pwiz::util;
 using boost::iostreams::offset_to_position;
+using boost::iostreams::stream_offset;
 
 
 namespace {
@@ -65,7 +69,19 @@ class SpectrumList_mzMLImpl : public SpectrumList_mzML
     const MSData& msd_;
     int schemaVersion_;
     mutable bool indexed_;
-    mutable boost::mutex readMutex;
+
+    // the stream is only locked while the raw bytes of a spectrum are copied out of it;
+    // parsing and binary decoding happen outside the lock so several spectra can be read concurrently
+    mutable boost::mutex streamMutex_;
+
+    // if the source file is memory-mapped, spectra are parsed straight from the mapping without locking or copying
+    const char* mappedData_;
+    stream_offset mappedSize_;
+
+    // held shared by readers and exclusively while the index is being recreated
+    mutable boost::shared_mutex indexMutex_;
+
+    void readSpectrumBytes(stream_offset begin, stream_offset endHint, vector<char>& bytes) const;
 
     Index_mzML_Ptr index_;
 };
@@ -75,6 +91,10 @@ SpectrumList_mzMLImpl::SpectrumList_mzMLImpl(shared_ptr<istream> is, const MSDat
 :   is_(is), msd_(msd), index_(index)
 {
     schemaVersion_ = bal::starts_with(msd_.version(), "1.0") ? 1 : 0;
+
+    random_access_compressed_ifstream* fs = dynamic_cast<random_access_compressed_ifstream*>(is_.get());
+    mappedData_ = fs ? fs->mapped_data() : 0;
+    mappedSize_ = mappedData_ ? (stream_offset) fs->mapped_size() : 0;
 }
 
 
@@ -125,10 +145,50 @@ SpectrumPtr SpectrumList_mzMLImpl::spectrum(const SpectrumPtr &seed, bool getBin
     return spectrum(seed->index, getBinaryData ? IO::ReadBinaryDataOnly: IO::IgnoreBinaryData, &seed);
 }
 
+// copies the bytes from begin up to and including the next </spectrum> tag;
+// endHint is the expected end of the spectrum (e.g. the start of the next one) or 0 if unknown
+void SpectrumList_mzMLImpl::readSpectrumBytes(stream_offset begin, stream_offset endHint, vector<char>& bytes) const
+{
+    static const string endTag("</spectrum>");
+
+    boost::lock_guard<boost::mutex> lock(streamMutex_);
+
+    is_->clear();
+    is_->seekg(offset_to_position(begin));
+    if (!*is_)
+        throw runtime_error("[SpectrumList_mzML::spectrum()] Error seeking to <spectrum>.");
+
+    size_t chunkSize = endHint > begin ? size_t(endHint - begin) : 65536;
+    size_t searchBegin = 0;
+    bytes.clear();
+
+    while (true)
+    {
+        size_t oldSize = bytes.size();
+        bytes.resize(oldSize + chunkSize);
+        is_->read(&bytes[oldSize], chunkSize);
+        bytes.resize(oldSize + (size_t) is_->gcount());
+
+        vector<char>::iterator itr = std::search(bytes.begin() + searchBegin, bytes.end(), endTag.begin(), endTag.end());
+        if (itr != bytes.end())
+        {
+            bytes.erase(itr + endTag.length(), bytes.end());
+            break;
+        }
+
+        if (!*is_)
+            break; // end of file; let the parser report the truncated element
+
+        searchBegin = bytes.size() < endTag.length() ? 0 : bytes.size() - endTag.length() + 1;
+        chunkSize = max<size_t>(chunkSize, 65536) * 2;
+    }
+
+    is_->clear();
+}
+
+
 SpectrumPtr SpectrumList_mzMLImpl::spectrum(size_t index, IO::BinaryDataFlag binaryDataFlag, const SpectrumPtr *defaults) const
 {
-    boost::lock_guard<boost::mutex> lock(readMutex);  // lock_guard will unlock mutex when out of scope or when exception thrown (during destruction)
-    //boost::call_once(indexInitialized_.flag, boost::bind(&SpectrumList_mzMLImpl::createIndex, this));
     if (index >= index_->spectrumCount())
         throw runtime_error("[SpectrumList_mzML::spectrum()] Index out of bounds.");
 
@@ -143,34 +203,75 @@ SpectrumPtr SpectrumList_mzMLImpl::spectrum(size_t index, IO::BinaryDataFlag bin
 
     try
     {
-        // we may just be here to get binary data of otherwise previously read spectrum
-        const SpectrumIdentityFromXML &id = index_->spectrumIdentity(index);
-        boost::iostreams::stream_offset seekto =
+        boost::shared_lock<boost::shared_mutex> indexLock(indexMutex_);
+
+        // we may just be here to get binary data of otherwise previously read spectrum;
+        // the parser notes the binary data's position in a copy of the identity, because
+        // other threads may be reading the same one
+        const SpectrumIdentityFromXML &sharedId = index_->spectrumIdentity(index);
+        SpectrumIdentityFromXML id = sharedId;
+        stream_offset seekto =
             binaryDataFlag==IO::ReadBinaryDataOnly ? 
             id.sourceFilePositionForBinarySpectrumData : // might be set, might be -1
-            (boost::iostreams::stream_offset)-1;
-        if (seekto == (boost::iostreams::stream_offset)-1) {
+            (stream_offset)-1;
+        if (seekto == (stream_offset)-1) {
             seekto = id.sourceFilePosition;
         }
-        is_->seekg(offset_to_position(seekto));
-        if (!*is_) 
-            throw runtime_error("[SpectrumList_mzML::spectrum()] Error seeking to <spectrum>.");
 
-        IO::read(*is_, *result, binaryDataFlag, schemaVersion_, &index_->legacyIdRefToNativeId(), &msd_, &id);
+        vector<char> bytes;
+        const char* begin;
+        const char* end;
+        if (mappedData_)
+        {
+            if (seekto < 0 || seekto >= mappedSize_)
+                throw runtime_error("[SpectrumList_mzML::spectrum()] Error seeking to <spectrum>.");
+            begin = mappedData_ + seekto;
+            end = mappedData_ + mappedSize_;
+        }
+        else
+        {
+            stream_offset endHint = 0;
+            if (index+1 < index_->spectrumCount())
+                endHint = index_->spectrumIdentity(index+1).sourceFilePosition;
+
+            readSpectrumBytes(seekto, endHint, bytes);
+            begin = bytes.empty() ? 0 : &bytes[0];
+            end = begin + bytes.size();
+        }
+
+        memory_streambuf buffer(begin, end, seekto);
+        istream bytesStream(&buffer);
+        IO::read(bytesStream, *result, binaryDataFlag, schemaVersion_, &index_->legacyIdRefToNativeId(), &msd_, &id);
 
         // test for reading the wrong spectrum
         if (result->index != index)
             throw runtime_error("[SpectrumList_mzML::spectrum()] Index entry points to the wrong spectrum.");
+
+        // remember the binary data's position for the next ReadBinaryDataOnly call
+        if (id.sourceFilePositionForBinarySpectrumData != (stream_offset)-1 &&
+            sharedId.sourceFilePositionForBinarySpectrumData == (stream_offset)-1)
+        {
+            indexLock.unlock();
+            boost::unique_lock<boost::shared_mutex> exclusiveIndexLock(indexMutex_);
+            index_->spectrumIdentity(index).sourceFilePositionForBinarySpectrumData = id.sourceFilePositionForBinarySpectrumData;
+        }
     }
     catch (runtime_error&)
     {
         // TODO: log warning about missing/corrupt index
 
         // recreate index
+        boost::unique_lock<boost::shared_mutex> indexLock(indexMutex_);
+        boost::lock_guard<boost::mutex> streamLock(streamMutex_);
         indexed_ = false;
         index_->recreate();
         const SpectrumIdentityFromXML &id = index_->spectrumIdentity(index);
+        is_->clear();
         is_->seekg(offset_to_position(id.sourceFilePosition));
+        if (defaults)
+            result = *defaults;
+        else
+            result.reset(new Spectrum);
         IO::read(*is_, *result, binaryDataFlag, schemaVersion_, &index_->legacyIdRefToNativeId(), &msd_, &id);
     }
 
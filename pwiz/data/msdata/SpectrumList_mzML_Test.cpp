@@ -24,14 +24,21 @@
 #include "SpectrumList_mzML.hpp"
 #include "Serializer_mzML.hpp" // depends on Serializer_mzML::write() only
 #include "examples.hpp"
+#include "Diff.hpp"
 #include "pwiz/utility/minimxml/XMLWriter.hpp"
+#include "pwiz/utility/misc/random_access_compressed_ifstream.hpp"
+#include "pwiz/utility/misc/Filesystem.hpp"
 #include "pwiz/utility/misc/unit.hpp"
 #include "pwiz/utility/misc/Std.hpp"
+#include <boost/thread.hpp>
 
 using namespace pwiz::cv;
 using namespace pwiz::msdata;
 using namespace pwiz::util;
 using namespace pwiz::minimxml;
+using std::exception_ptr;
+using std::current_exception;
+using std::rethrow_exception;
 
 
 ostream* os_ = 0;
@@ -170,13 +177,137 @@ void test(bool indexed)
 }
 
 
+void readAllSpectra(const SpectrumList& sl, const vector<SpectrumPtr>& expected, size_t stride, exception_ptr& error)
+{
+    try
+    {
+        for (size_t pass=0; pass < 3; ++pass)
+            for (size_t i=0, j=pass; i < sl.size(); ++i, j += stride)
+            {
+                size_t index = j % sl.size();
+                SpectrumPtr s = sl.spectrum(index, true);
+                Diff<Spectrum, DiffConfig> diff(*expected[index], *s);
+                if (diff) throw runtime_error("spectrum " + lexical_cast<string>(index) + " differs");
+
+                // binary data only, seeded with the metadata
+                SpectrumPtr seed = sl.spectrum(index, false);
+                s = sl.spectrum(seed, true);
+                diff(*expected[index], *s);
+                if (diff) throw runtime_error("spectrum " + lexical_cast<string>(index) + " differs (binary only)");
+            }
+    }
+    catch (...)
+    {
+        error = current_exception();
+    }
+}
+
+
+void testConcurrentReads(bool indexed, bool mapped)
+{
+    if (os_) *os_ << "testConcurrentReads(): indexed=\"" << boolalpha << indexed << "\" mapped=\"" << mapped << "\"\n";
+
+    MSData tiny;
+    examples::initializeTiny(tiny);
+
+    // add some bigger spectra so reads span several chunks
+    SpectrumListSimple& slSimple = dynamic_cast<SpectrumListSimple&>(*tiny.run.spectrumListPtr);
+    for (size_t i=0; i < 20; ++i)
+    {
+        SpectrumPtr s(new Spectrum(*slSimple.spectra[i % 2]));
+        s->index = slSimple.spectra.size();
+        s->id = "scan=" + lexical_cast<string>(100 + i);
+        s->binaryDataArrayPtrs.clear();
+        vector<double> mz, intensity;
+        for (size_t j=0; j < 1000 * (i+1); ++j)
+        {
+            mz.push_back(100 + j * 0.01);
+            intensity.push_back(double((j * 7919) % 1000));
+        }
+        s->setMZIntensityArrays(mz, intensity, MS_number_of_detector_counts);
+        slSimple.spectra.push_back(s);
+    }
+
+    Serializer_mzML::Config config;
+    config.indexed = indexed;
+    ostringstream oss;
+    Serializer_mzML(config).write(oss, tiny);
+
+    // a file opened with random_access_compressed_ifstream asking for a mapping is parsed without copying
+    const string filename = "SpectrumList_mzML_Test.mzML";
+    shared_ptr<istream> is;
+    if (mapped)
+    {
+        ofstream(filename.c_str(), ios::binary) << oss.str();
+        random_access_compressed_ifstream* fs = new random_access_compressed_ifstream(filename.c_str());
+        is.reset(fs);
+        unit_assert(fs->is_open());
+        unit_assert(fs->mapped_data() == 0); // only mapped when asked for
+
+        // reopening, mapped or not, replaces the open file's buffer
+        string head(10, '\0');
+        for (int i=0; i < 3; ++i)
+        {
+            fs->open(filename.c_str(), i % 2 == 0);
+            unit_assert(fs->is_open());
+            unit_assert((fs->mapped_data() != 0) == (i % 2 == 0));
+            fs->read(&head[0], head.length());
+            unit_assert_operator_equal(oss.str().substr(0, head.length()), head);
+        }
+        fs->close();
+        unit_assert(!fs->is_open());
+
+        fs->open(filename.c_str(), true);
+        unit_assert(fs->mapped_data() != 0);
+        unit_assert_operator_equal(oss.str().length(), (size_t) fs->mapped_size());
+    }
+    else
+        is.reset(new istringstream(oss.str()));
+
+    MSData msd;
+    Serializer_mzML(config).read(is, msd);
+    const SpectrumList& sl = *msd.run.spectrumListPtr;
+    unit_assert_operator_equal(slSimple.size(), sl.size());
+
+    vector<SpectrumPtr> expected;
+    for (size_t i=0; i < sl.size(); ++i)
+        expected.push_back(sl.spectrum(i, true));
+    unit_assert_operator_equal(20000, expected.back()->defaultArrayLength);
+
+    // read from several threads at once in different orders
+    const size_t threadCount = 4;
+    vector<exception_ptr> errors(threadCount);
+    boost::thread_group threads;
+    for (size_t i=0; i < threadCount; ++i)
+        threads.create_thread(boost::bind(&readAllSpectra, boost::cref(sl), boost::cref(expected), i*2+1, boost::ref(errors[i])));
+    threads.join_all();
+
+    BOOST_FOREACH(const exception_ptr& error, errors)
+        if (error)
+            rethrow_exception(error);
+
+    if (mapped)
+    {
+        // release the mapping before removing the file
+        msd.run.spectrumListPtr.reset();
+        msd.run.chromatogramListPtr.reset();
+        is.reset();
+        bfs::remove(filename);
+    }
+}
+
+
 void test()
 {
     bool indexed = true;
     test(indexed);
+    testConcurrentReads(indexed, false);
+    testConcurrentReads(indexed, true);
 
     indexed = false;
     test(indexed);
+    testConcurrentReads(indexed, false);
+    testConcurrentReads(indexed, true);
 }
 
 
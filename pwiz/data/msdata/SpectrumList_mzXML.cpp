@@ -45,7 +45,7 @@ class SpectrumList_mzXMLImpl : public SpectrumList_mzXML
 {
     public:
 
-    SpectrumList_mzXMLImpl(shared_ptr<istream> is, const MSData& msd, bool indexed);
+    SpectrumList_mzXMLImpl(shared_ptr<istream> is, const MSData& msd, bool indexed, const IndexSidecarPtr& sidecar);
 
     // SpectrumList implementation
     virtual size_t size() const {return index_.size();}
@@ -68,25 +68,32 @@ class SpectrumList_mzXMLImpl : public SpectrumList_mzXML
 
     bool readIndex(); // return false if index is not present
     void createIndex();
+    bool readSidecar(const IndexSidecarPtr& sidecar);
+    void writeSidecar(const IndexSidecarPtr& sidecar);
     void createMaps();
     string getPrecursorID(int precursorMsLevel, size_t index) const;
 };
 
 
-SpectrumList_mzXMLImpl::SpectrumList_mzXMLImpl(shared_ptr<istream> is, const MSData& msd, bool indexed)
+SpectrumList_mzXMLImpl::SpectrumList_mzXMLImpl(shared_ptr<istream> is, const MSData& msd, bool indexed, const IndexSidecarPtr& sidecar)
 :   is_(is), msd_(msd)
 {
-    bool gotIndex = false;
-    try
+    if (!readSidecar(sidecar))
     {
-      if (indexed)
-        gotIndex = readIndex(); 
-    } catch (index_not_found e){
-      is_->clear();
-    }
+        bool gotIndex = false;
+        try
+        {
+          if (indexed)
+            gotIndex = readIndex(); 
+        } catch (index_not_found e){
+          is_->clear();
+        }
 
-    if (!gotIndex)
-        createIndex();
+        if (!gotIndex)
+            createIndex();
+
+        writeSidecar(sidecar);
+    }
 
     scanMsLevelCache_.resize(index_.size());
 
@@ -628,7 +635,7 @@ SpectrumPtr SpectrumList_mzXMLImpl::spectrum(size_t index, IO::BinaryDataFlag bi
         id.peaksCount = handler.getPeaksCount();
     }
 
-    int msLevel = result->cvParam(MS_ms_level).valueAs<int>();
+    int msLevel = result->cvParamValueOrDefault(MS_ms_level, 0);
     scanMsLevelCache_[index] = msLevel;
 
     if (detailLevel >= DetailLevel_FullMetadata)
@@ -875,6 +882,27 @@ void SpectrumList_mzXMLImpl::createIndex()
 }
 
 
+bool SpectrumList_mzXMLImpl::readSidecar(const IndexSidecarPtr& sidecar)
+{
+    vector<SpectrumIdentity> spectra;
+    vector<ChromatogramIdentity> chromatograms;
+    if (!sidecar || !sidecar->read(spectra, chromatograms, is_.get()))
+        return false;
+
+    index_.resize(spectra.size());
+    for (size_t i=0; i < spectra.size(); ++i)
+        static_cast<SpectrumIdentity&>(index_[i]) = spectra[i];
+    return true;
+}
+
+
+void SpectrumList_mzXMLImpl::writeSidecar(const IndexSidecarPtr& sidecar)
+{
+    if (sidecar)
+        sidecar->write(vector<SpectrumIdentity>(index_.begin(), index_.end()), vector<ChromatogramIdentity>(), is_.get());
+}
+
+
 void SpectrumList_mzXMLImpl::createMaps()
 {
     vector<SpectrumIdentityFromMzXML>::const_iterator it=index_.begin();
@@ -896,7 +924,7 @@ string SpectrumList_mzXMLImpl::getPrecursorID(int precursorMsLevel, size_t index
             // populate the missing MS level
             SpectrumPtr s = spectrum(index, DetailLevel_FastMetadata); // avoid excessive recursion
 
-            cachedMsLevel = s->cvParam(MS_ms_level).valueAs<int>();
+            cachedMsLevel = s->cvParamValueOrDefault(MS_ms_level, 0);
         }
         if (cachedMsLevel == precursorMsLevel) 
         {
@@ -912,12 +940,12 @@ string SpectrumList_mzXMLImpl::getPrecursorID(int precursorMsLevel, size_t index
 } // namespace
 
 
-PWIZ_API_DECL SpectrumListPtr SpectrumList_mzXML::create(shared_ptr<istream> is, const MSData& msd, bool indexed)
+PWIZ_API_DECL SpectrumListPtr SpectrumList_mzXML::create(shared_ptr<istream> is, const MSData& msd, bool indexed, const IndexSidecarPtr& sidecar)
 {
     if (!is.get() || !*is)
         throw runtime_error("[SpectrumList_mzXML::create()] Bad istream.");
 
-    return SpectrumListPtr(new SpectrumList_mzXMLImpl(is, msd, indexed));
+    return SpectrumListPtr(new SpectrumList_mzXMLImpl(is, msd, indexed, sidecar));
 }
 
 
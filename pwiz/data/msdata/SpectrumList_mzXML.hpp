@@ -27,6 +27,7 @@
 
 #include "pwiz/utility/misc/Export.hpp"
 #include "SpectrumListBase.hpp"
+#include "IndexSidecar.hpp"
 #include <iosfwd>
 #include <stdexcept>
 
@@ -40,9 +41,11 @@ class PWIZ_API_DECL SpectrumList_mzXML : public SpectrumListBase
 {
     public:
 
+    /// if sidecar is set, the index is read from it when it is up to date, and saved to it otherwise
     static SpectrumListPtr create(boost::shared_ptr<std::istream> is,
                                   const MSData& msd,
-                                  bool indexed = true);
+                                  bool indexed = true,
+                                  const IndexSidecarPtr& sidecar = IndexSidecarPtr());
 
     /// exception thrown if create(*,*,true) is called and 
     /// the mzXML index cannot be found
@@ -1,294 +1,402 @@
-//
-// $Id: SpectrumWorkerThreads.cpp 10352 2017-01-11 20:59:11Z chambm $
-//
-//
-// Original author: William French <william.r.french .@. vanderbilt.edu>
-//
-// Copyright 2014 Vanderbilt University - Nashville, TN 37232
-//
-// Licensed under the Apache License, Version 2.0 (the "License"); 
-// you may not use this file except in compliance with the License. 
-// You may obtain a copy of the License at 
-//
-// http://www.apache.org/licenses/LICENSE-2.0
-//
-// Unless required by applicable law or agreed to in writing, software 
-// distributed under the License is distributed on an "AS IS" BASIS, 
-// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. 
-// See the License for the specific language governing permissions and 
-// limitations under the License.
-//
-
-#define PWIZ_SOURCE
-
-#include "pwiz/utility/misc/Std.hpp"
-#include "pwiz/data/msdata/SpectrumWorkerThreads.hpp"
-#include "pwiz/data/msdata/SpectrumListWrapper.hpp"
-#include "pwiz/utility/misc/mru_list.hpp"
-#include <boost/thread.hpp>
-#include <deque>
-
-
-using std::deque;
-using namespace pwiz::util;
-
-
-namespace pwiz {
-namespace msdata {
-
-class SpectrumWorkerThreads::Impl
-{
-    public:
-
-    Impl(const SpectrumList& sl)
-        : sl_(sl)
-        , numThreads_(boost::thread::hardware_concurrency())
-        , maxProcessedTaskCount_(numThreads_ * 4)
-        , taskMRU_(maxProcessedTaskCount_)
-    {
-        InstrumentConfigurationPtr icPtr;
-        if (sl.size() > 0)
-        {
-            SpectrumPtr s0 = sl.spectrum(0, false);
-            if (s0->scanList.scans.size() > 0)
-                icPtr = s0->scanList.scans[0].instrumentConfigurationPtr;
-        }
-
-        bool isBruker = icPtr.get() && icPtr->hasCVParamChild(MS_Bruker_Daltonics_instrument_model);
-
-        bool isDemultiplexed = false;
-        const boost::shared_ptr<const DataProcessing> dp = sl.dataProcessingPtr();
-        if (dp)
-        {
-            BOOST_FOREACH(const ProcessingMethod& pm, dp->processingMethods)
-            {
-                if (!pm.hasCVParam(MS_data_processing)) continue;
-                BOOST_FOREACH(const UserParam& up, pm.userParams)
-                {
-                    if (up.name.find("Demultiplexing") != std::string::npos)
-                    {
-                        isDemultiplexed = true;
-                        break;
-                    }
-                }
-                if (isDemultiplexed) break;
-            }
-        }
-
-        useThreads_ = !(isBruker || isDemultiplexed); // Bruker library is not thread-friendly
-
-        if (sl.size() > 0 && useThreads_)
-        {
-            // create one task per spectrum
-            tasks_.resize(sl.size(), Task());
-
-            // create and start worker threads
-            for (size_t i = 0; i < numThreads_; ++i)
-            {
-                workers_.push_back(TaskWorker());
-                workers_.back().start(this);
-            }
-        }
-    }
-
-    ~Impl()
-    {
-        BOOST_FOREACH(TaskWorker& worker, workers_)
-            if (worker.thread)
-            {
-                worker.thread->interrupt();
-                worker.thread->join();
-            }
-    }
-
-    SpectrumPtr spectrum(size_t index, bool getBinaryData)
-    {
-        if (!useThreads_)
-            return sl_.spectrum(index, getBinaryData);
-
-        boost::unique_lock<boost::mutex> taskLock(taskMutex_);
-
-        // if the task is already finished and has binary data if getBinaryData is true, return it as-is
-        Task& task = tasks_[index];
-        if (task.result && (!getBinaryData || task.getBinaryData))
-            return task.result;
-
-        // otherwise, add this task and the numThreads following tasks to the queue (skipping the tasks that are already processed or being worked on)
-        for (size_t i = index; taskQueue_.size() < numThreads_ && i < tasks_.size(); ++i)
-        {
-            Task& task = tasks_[i];
-
-            // if the task result is already ready
-            if (task.result)
-            {
-                // if it has binary data and getBinaryData is true, the task need not be queued
-                if (task.getBinaryData || !getBinaryData)
-                    continue;
-
-                // otherwise the current result is cleared
-                task.result.reset();
-            }
-            // if the task is already being worked on and the existing task will get binary data or binary data isn't being requested, the task need not be requeued
-            else if (task.worker != NULL && (task.getBinaryData || !getBinaryData))
-                continue;
-
-            // if the task is already queued, set its getBinaryData variable to the logical OR of the current task and the current spectrum request
-            if (!task.isQueued)
-            {
-                taskQueue_.push_back(i);
-                task.isQueued = true;
-            }
-            task.getBinaryData |= getBinaryData;
-        }
-
-        // wait for the result to be set
-        while (!task.result)
-        {
-            // notify workers that tasks are available
-            taskQueuedCondition_.notify_all();
-            taskFinishedCondition_.wait_for(taskLock, boost::chrono::milliseconds(100));
-        }
-
-        return task.result;
-    }
-
-    private:
-
-    struct TaskWorker
-    {
-        void start(Impl* instance)
-        {
-            if (!thread)
-                thread.reset(new boost::thread(boost::bind(&SpectrumWorkerThreads::Impl::work, instance, this)));
-        }
-
-        shared_ptr<boost::thread> thread;
-    };
-
-    // each spectrum in the list is a task
-    struct Task
-    {
-        Task() : worker(NULL), getBinaryData(false), isQueued(false) {}
-
-        TaskWorker* worker; // the thread currently working on this task
-        SpectrumPtr result; // the spectrum produced by this task
-        bool getBinaryData;
-        bool isQueued; // true if the task is currently in the taskQueue
-    };
-
-    friend struct TaskWorker;
-
-    // function executed by worker threads
-    static void work(Impl* instance, TaskWorker* worker)
-    {
-        vector<Task>& tasks = instance->tasks_;
-        TaskQueue& taskQueue = instance->taskQueue_;
-        mru_list<size_t>& taskMRU = instance->taskMRU_;
-
-        // loop until the main thread kills the worker threads; the condition_variable::wait() call is an interruption point
-        try
-        {
-            boost::unique_lock<boost::mutex> taskLock(instance->taskMutex_, boost::defer_lock);
-
-            while (true)
-            {
-                taskLock.lock();
-
-                // wait for a new spectrum to be queued (while the task queue is either empty or the task at the end of the queue already has a worker assigned)
-                while (instance->taskQueue_.empty())
-                    instance->taskQueuedCondition_.wait(taskLock);
-
-                // get the next queued Task
-                TaskQueue::value_type queuedTask = taskQueue.front();
-                taskQueue.pop_front();
-
-                // set worker pointer on the Task
-                size_t taskIndex = queuedTask;
-                Task& task = tasks[taskIndex];
-                bool getBinaryData = task.getBinaryData;
-                task.worker = worker;
-                task.isQueued = false;
-                //cout << taskIndex << " " << task.worker << " " << getBinaryData << endl;
-                // unlock taskLock
-                taskLock.unlock();
-
-                // get the spectrum
-                SpectrumPtr result = instance->sl_.spectrum(taskIndex, getBinaryData);
-
-                // lock the taskLock
-                taskLock.lock();
-
-                // set the result on the Task, and set its worker to empty
-                // if not getting binary data, check if another thread already finished this task which did get binary data
-                if (getBinaryData || !task.getBinaryData)
-                {
-                    task.result = result;
-                    task.getBinaryData = getBinaryData;
-                }
-                task.worker = NULL;
-
-                // notify the main thread that a task has finished
-                instance->taskFinishedCondition_.notify_one();
-
-                // add the task to the MRU; if doing so will push an old task off the MRU, then reset the oldest (LRU) task;
-                // to know whether an old task was pushed off, keep a copy of the LRU item before adding the task
-                boost::optional<size_t> lruToReset;
-                if (taskMRU.size() == taskMRU.max_size())
-                {
-                    lruToReset = taskMRU.lru();
-                }
-
-                taskMRU.insert(taskIndex);
-
-                // if the MRU list's LRU is different now, it means the LRU was popped and needs to be reset; if the popped LRU is the current task, don't reset it
-                if (lruToReset.is_initialized() && lruToReset.get() != taskMRU.lru() && lruToReset.get() != taskIndex)
-                {
-                    tasks[lruToReset.get()].result.reset();
-                }
-
-                taskLock.unlock();
-            }
-        }
-        catch (boost::thread_interrupted&)
-        {
-            // return
-        }
-        catch (exception& e)
-        {
-            // TODO: log this
-            cerr << "[SpectrumWorkerThreads::work] error in thread: " << e.what() << endl;
-        }
-        catch (...)
-        {
-            cerr << "[SpectrumWorkerThreads::work] unknown exception in worker thread" << endl;
-        }
-    }
-
-    const SpectrumList& sl_;
-    bool useThreads_;
-    size_t numThreads_;
-
-    const size_t maxProcessedTaskCount_;
-    vector<Task> tasks_;
-    typedef deque<size_t> TaskQueue;
-    TaskQueue taskQueue_;
-    mru_list<size_t> taskMRU_;
-    boost::mutex taskMutex_;
-    boost::condition_variable taskQueuedCondition_, taskFinishedCondition_;
-
-    vector<TaskWorker> workers_;
-};
-
-
-SpectrumWorkerThreads::SpectrumWorkerThreads(const SpectrumList& sl) : impl_(new Impl(sl)) {}
-
-SpectrumWorkerThreads::~SpectrumWorkerThreads() {}
-
-SpectrumPtr SpectrumWorkerThreads::processBatch(size_t index, bool getBinaryData)
-{
-    return impl_->spectrum(index, getBinaryData);
-}
-
-
-} // namespace msdata
-} // namespace pwiz
+//
+// $Id: SpectrumWorkerThreads.cpp 10352 2017-01-11 20:59:11Z chambm $
+//
+//
+// Original author: William French <william.r.french .@. vanderbilt.edu>
+//
+// Copyright 2014 Vanderbilt University - Nashville, TN 37232
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); 
+// you may not use this file except in compliance with the License. 
+// You may obtain a copy of the License at 
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software 
+// distributed under the License is distributed on an "AS IS" BASIS, 
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. 
+// See the License for the specific language governing permissions and 
+// limitations under the License.
+//
+
+#define PWIZ_SOURCE
+
+#include "pwiz/utility/misc/Std.hpp"
+#include "pwiz/data/msdata/SpectrumWorkerThreads.hpp"
+#include "pwiz/data/msdata/SpectrumListWrapper.hpp"
+#include <boost/thread.hpp>
+#include <exception>
+
+
+using std::exception_ptr;
+using std::current_exception;
+using std::rethrow_exception;
+
+
+namespace pwiz {
+namespace msdata {
+
+class SpectrumWorkerThreads::Impl
+{
+    public:
+
+    Impl(const SpectrumList& sl, const SpectrumRenderer& renderer, const Config& config)
+        : sl_(sl)
+        , renderer_(renderer)
+        , numThreads_(config.numThreads > 0 ? config.numThreads : max(1u, boost::thread::hardware_concurrency()))
+        , windowSize_(config.windowSize > 0 ? config.windowSize : numThreads_ * 4)
+        , started_(false)
+        , windowBegin_(0)
+        , nextIndex_(0)
+        , getBinaryData_(true)
+        , slots_(windowSize_)
+    {
+        InstrumentConfigurationPtr icPtr;
+        if (config.useThreads && sl.size() > 0)
+        {
+            SpectrumPtr s0 = sl.spectrum(0, false);
+            if (s0->scanList.scans.size() > 0)
+                icPtr = s0->scanList.scans[0].instrumentConfigurationPtr;
+        }
+
+        bool isBruker = icPtr.get() && icPtr->hasCVParamChild(MS_Bruker_Daltonics_instrument_model);
+
+        bool isDemultiplexed = false;
+        const boost::shared_ptr<const DataProcessing> dp = sl.dataProcessingPtr();
+        if (dp)
+        {
+            BOOST_FOREACH(const ProcessingMethod& pm, dp->processingMethods)
+            {
+                if (!pm.hasCVParam(MS_data_processing)) continue;
+                BOOST_FOREACH(const UserParam& up, pm.userParams)
+                {
+                    if (up.name.find("Demultiplexing") != std::string::npos)
+                    {
+                        isDemultiplexed = true;
+                        break;
+                    }
+                }
+                if (isDemultiplexed) break;
+            }
+        }
+
+        useThreads_ = config.useThreads && !(isBruker || isDemultiplexed); // Bruker library is not thread-friendly
+
+        if (sl.size() > 0 && useThreads_)
+        {
+            // create and start worker threads
+            for (size_t i = 0; i < numThreads_; ++i)
+                workers_.create_thread(boost::bind(&SpectrumWorkerThreads::Impl::work, this));
+        }
+    }
+
+    ~Impl()
+    {
+        workers_.interrupt_all();
+        workers_.join_all();
+    }
+
+    SpectrumPtr spectrum(size_t index, bool getBinaryData, string* rendered = 0)
+    {
+        if (!useThreads_)
+        {
+            SpectrumPtr result = sl_.spectrum(index, getBinaryData);
+            if (rendered)
+                render(*result, *rendered);
+            return result;
+        }
+
+        if (index >= sl_.size())
+            throw out_of_range("[SpectrumWorkerThreads::processBatch] index out of range");
+
+        // slide the window forward to the requested index (or reposition it if the request is outside the window);
+        // the window lock is only held to update the window bounds, never while a spectrum is being fetched
+        {
+            boost::lock_guard<boost::mutex> windowLock(windowMutex_);
+
+            size_t oldNextIndex = nextIndex_, oldWindowEnd = windowEnd();
+
+            if (!started_ || index < windowBegin_ || index >= windowBegin_ + windowSize_ || getBinaryData != getBinaryData_)
+                nextIndex_ = index;
+            else
+                nextIndex_ = max(nextIndex_, index);
+            windowBegin_ = index;
+            started_ = true;
+            getBinaryData_ = getBinaryData;
+
+            // wake other callers waiting for indexes that no worker will claim now
+            for (size_t i = oldNextIndex; i < oldWindowEnd; ++i)
+                if (!isClaimable(i))
+                {
+                    Slot& slot = slotFor(i);
+                    boost::lock_guard<boost::mutex> slotLock(slot.mutex);
+                    slot.readyCondition.notify_all();
+                }
+        }
+        workAvailableCondition_.notify_all();
+
+        // wait for the result in the spectrum's slot; only the owning slot is locked while waiting
+        Slot& slot = slotFor(index);
+        boost::unique_lock<boost::mutex> slotLock(slot.mutex);
+        bool fetchDirectly = false;
+        while (slot.index != index || slot.state != Slot::Ready)
+        {
+            if (slot.index != index || slot.state == Slot::Empty)
+            {
+                // the index is not being fetched: either it is still to be claimed, or another caller moved the window
+                // before it was claimed (or reclaimed its slot before it was ready); the slot is locked again before
+                // the window lock is released, so a window move cannot wake this caller before it waits
+                slotLock.unlock();
+                boost::lock_guard<boost::mutex> windowLock(windowMutex_);
+                bool claimable = isClaimable(index);
+                slotLock.lock();
+
+                if (slot.index == index && slot.state != Slot::Empty)
+                    continue;
+
+                // no worker will fetch it now
+                if (!claimable)
+                {
+                    fetchDirectly = true;
+                    break;
+                }
+            }
+            slot.readyCondition.wait(slotLock);
+        }
+
+        SpectrumPtr result;
+        bool hasBinaryData = false;
+        bool isRendered = false;
+        if (!fetchDirectly)
+        {
+            if (slot.error)
+                rethrow_exception(slot.error);
+
+            result = slot.result;
+            hasBinaryData = slot.getBinaryData;
+            isRendered = slot.isRendered;
+            if (rendered && isRendered)
+            {
+                // the output is handed over rather than copied, so a repeated request renders again
+                rendered->swap(slot.rendered);
+                slot.rendered.clear();
+                slot.isRendered = false;
+            }
+        }
+        slotLock.unlock();
+
+        if (fetchDirectly)
+            result = sl_.spectrum(index, getBinaryData);
+        else if (getBinaryData && !hasBinaryData)
+        {
+            // a metadata-only result does not satisfy a request for binary data; fetch it directly in that (rare) case
+            result = sl_.spectrum(index, true);
+            isRendered = false;
+        }
+
+        if (rendered && !isRendered)
+            render(*result, *rendered);
+
+        return result;
+    }
+
+    private:
+
+    // each index in the lookahead window maps to one slot (index % windowSize);
+    // a slot is reused once the window has moved past the index it holds
+    struct Slot
+    {
+        enum State { Empty, Pending, Ready };
+
+        Slot() : index(0), ticket(0), state(Empty), getBinaryData(false), isRendered(false) {}
+
+        boost::mutex mutex;
+        boost::condition_variable readyCondition;
+        size_t index; // the spectrum index this slot currently holds or is being fetched for
+        size_t ticket; // incremented on every claim so a stale fetch cannot publish into a reclaimed slot
+        State state;
+        bool getBinaryData;
+        SpectrumPtr result;
+        bool isRendered;
+        string rendered; // output of the renderer for result (if isRendered)
+        exception_ptr error; // set instead of result if the spectrum could not be fetched or rendered
+    };
+
+    Slot& slotFor(size_t index) { return slots_[index % windowSize_]; }
+
+    // the end of the indexes workers may claim; the window lock must be held
+    size_t windowEnd() const { return started_ ? min(windowBegin_ + windowSize_, sl_.size()) : 0; }
+
+    // true if a worker will still claim the index; the window lock must be held
+    bool isClaimable(size_t index) const { return nextIndex_ <= index && index < windowEnd(); }
+
+    void render(const Spectrum& spectrum, string& rendered) const
+    {
+        if (!renderer_)
+            throw runtime_error("[SpectrumWorkerThreads::processBatch] no renderer was given");
+        rendered.clear();
+        renderer_(spectrum, rendered);
+    }
+
+    // claims the next unfetched index in the window; blocks while the window is exhausted;
+    // the slot is marked Pending while the window lock is still held so a repositioned window can never
+    // hand the same slot to two different indexes
+    size_t claim(bool& getBinaryData, size_t& ticket)
+    {
+        boost::unique_lock<boost::mutex> windowLock(windowMutex_);
+        while (true)
+        {
+            for (; nextIndex_ < windowEnd(); ++nextIndex_)
+            {
+                Slot& slot = slotFor(nextIndex_);
+                boost::lock_guard<boost::mutex> slotLock(slot.mutex);
+
+                // skip indexes that are already fetched or being fetched with sufficient detail
+                if (slot.index == nextIndex_ && slot.state != Slot::Empty && (slot.getBinaryData || !getBinaryData_))
+                    continue;
+
+                slot.index = nextIndex_;
+                ticket = ++slot.ticket;
+                slot.state = Slot::Pending;
+                slot.getBinaryData = getBinaryData = getBinaryData_;
+                slot.result.reset();
+                slot.isRendered = false;
+                slot.rendered.clear();
+                slot.error = exception_ptr();
+
+                // a caller waiting for the index the slot held before must check whether it still will be fetched
+                slot.readyCondition.notify_all();
+                return nextIndex_++;
+            }
+
+            // wait for the consumer to advance the window; wait() is an interruption point
+            workAvailableCondition_.wait(windowLock);
+        }
+    }
+
+    // function executed by worker threads
+    void work()
+    {
+        // loop until the main thread kills the worker threads
+        try
+        {
+            while (true)
+            {
+                bool getBinaryData;
+                size_t ticket;
+                size_t index = claim(getBinaryData, ticket);
+
+                SpectrumPtr result;
+                string rendered;
+                bool isRendered = false;
+                exception_ptr error;
+                try
+                {
+                    result = sl_.spectrum(index, getBinaryData);
+
+                    if (renderer_ && getBinaryData)
+                    {
+                        render(*result, rendered);
+                        isRendered = true;
+                    }
+                }
+                catch (boost::thread_interrupted&)
+                {
+                    throw;
+                }
+                catch (...)
+                {
+                    error = current_exception();
+                }
+
+                // publish the result unless the slot was reclaimed for another index in the meantime
+                Slot& slot = slotFor(index);
+                {
+                    boost::lock_guard<boost::mutex> slotLock(slot.mutex);
+                    if (slot.ticket != ticket)
+                        continue;
+                    slot.result = result;
+                    slot.rendered.swap(rendered);
+                    slot.isRendered = isRendered;
+                    slot.error = error;
+                    slot.state = Slot::Ready;
+                }
+                slot.readyCondition.notify_all();
+            }
+        }
+        catch (boost::thread_interrupted&)
+        {
+            // return
+        }
+        catch (exception& e)
+        {
+            cerr << "[SpectrumWorkerThreads::work] error in thread: " << e.what() << endl;
+        }
+        catch (...)
+        {
+            cerr << "[SpectrumWorkerThreads::work] unknown exception in worker thread" << endl;
+        }
+    }
+
+    const SpectrumList& sl_;
+    const SpectrumRenderer renderer_;
+    bool useThreads_;
+    const size_t numThreads_;
+    const size_t windowSize_;
+
+    // protected by windowMutex_
+    bool started_; // workers stay idle until the first request opens the window
+    size_t windowBegin_; // the most recently requested index
+    size_t nextIndex_; // the next index for a worker to claim
+    bool getBinaryData_;
+    boost::mutex windowMutex_;
+    boost::condition_variable workAvailableCondition_;
+
+    vector<Slot> slots_;
+    boost::thread_group workers_;
+};
+
+
+namespace {
+
+SpectrumWorkerThreads::Config makeConfig(size_t numThreads, size_t windowSize)
+{
+    SpectrumWorkerThreads::Config config;
+    config.numThreads = numThreads;
+    config.windowSize = windowSize;
+    return config;
+}
+
+} // namespace
+
+SpectrumWorkerThreads::SpectrumWorkerThreads(const SpectrumList& sl, size_t numThreads, size_t windowSize)
+    : impl_(new Impl(sl, SpectrumRenderer(), makeConfig(numThreads, windowSize)))
+{}
+
+SpectrumWorkerThreads::SpectrumWorkerThreads(const SpectrumList& sl, const SpectrumRenderer& renderer, size_t numThreads, size_t windowSize)
+    : impl_(new Impl(sl, renderer, makeConfig(numThreads, windowSize)))
+{}
+
+SpectrumWorkerThreads::SpectrumWorkerThreads(const SpectrumList& sl, const Config& config)
+    : impl_(new Impl(sl, SpectrumRenderer(), config))
+{}
+
+SpectrumWorkerThreads::SpectrumWorkerThreads(const SpectrumList& sl, const SpectrumRenderer& renderer, const Config& config)
+    : impl_(new Impl(sl, renderer, config))
+{}
+
+SpectrumWorkerThreads::~SpectrumWorkerThreads() {}
+
+SpectrumPtr SpectrumWorkerThreads::processBatch(size_t index, bool getBinaryData)
+{
+    return impl_->spectrum(index, getBinaryData);
+}
+
+SpectrumPtr SpectrumWorkerThreads::processBatch(size_t index, string& rendered)
+{
+    return impl_->spectrum(index, true, &rendered);
+}
+
+
+} // namespace msdata
+} // namespace pwiz
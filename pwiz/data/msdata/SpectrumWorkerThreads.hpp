@@ -25,20 +25,61 @@
 
 #include "pwiz/data/msdata/MSData.hpp"
 #include <boost/smart_ptr.hpp>
+#include <boost/function.hpp>
 
 
 namespace pwiz {
 namespace msdata {
 
 
-class SpectrumWorkerThreads
+/// prefetches spectra from a SpectrumList on a pool of worker threads;
+/// results are returned in request order from a fixed-size lookahead window,
+/// so memory use scales with the window size rather than with the list size
+class PWIZ_API_DECL SpectrumWorkerThreads
 {
     public:
 
-    SpectrumWorkerThreads(const SpectrumList& sl);
+    /// optional stage run on the worker thread after a spectrum has been fetched with binary data,
+    /// e.g. to serialize and encode it; its output is handed back in order by processBatch(index, rendered)
+    typedef boost::function<void (const Spectrum& spectrum, std::string& rendered)> SpectrumRenderer;
+
+    /// worker thread settings
+    struct PWIZ_API_DECL Config
+    {
+        /// if false, spectra are fetched (and rendered) on the calling thread when they are requested
+        bool useThreads;
+
+        /// number of worker threads (0 = boost::thread::hardware_concurrency())
+        size_t numThreads;
+
+        /// number of spectra that may be fetched ahead of the last requested index (0 = 4 * numThreads)
+        size_t windowSize;
+
+        Config() : useThreads(true), numThreads(0), windowSize(0) {}
+    };
+
+    /// numThreads: number of worker threads (0 = boost::thread::hardware_concurrency())
+    /// windowSize: number of spectra that may be fetched ahead of the last requested index (0 = 4 * numThreads)
+    SpectrumWorkerThreads(const SpectrumList& sl, size_t numThreads = 0, size_t windowSize = 0);
+
+    /// as above, but each spectrum is also passed to the renderer on the worker thread
+    SpectrumWorkerThreads(const SpectrumList& sl, const SpectrumRenderer& renderer, size_t numThreads = 0, size_t windowSize = 0);
+
+    /// uses the given worker thread settings
+    SpectrumWorkerThreads(const SpectrumList& sl, const Config& config);
+
+    /// as above, but each spectrum is also passed to the renderer on the worker thread
+    SpectrumWorkerThreads(const SpectrumList& sl, const SpectrumRenderer& renderer, const Config& config);
+
     ~SpectrumWorkerThreads();
+
+    /// returns the spectrum at the given index; requests with increasing indexes are served from the lookahead window,
+    /// other requests reposition the window at the requested index
     SpectrumPtr processBatch(size_t index, bool getBinaryData = true);
 
+    /// returns the spectrum at the given index with binary data, and swaps the renderer's output for it into rendered
+    SpectrumPtr processBatch(size_t index, std::string& rendered);
+
     private:
     class Impl;
     boost::scoped_ptr<Impl> impl_;
@@ -0,0 +1,332 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#include "SpectrumWorkerThreads.hpp"
+#include "pwiz/utility/misc/unit.hpp"
+#include "pwiz/utility/misc/Std.hpp"
+#include <boost/thread.hpp>
+
+
+using namespace pwiz::cv;
+using namespace pwiz::msdata;
+using namespace pwiz::util;
+
+
+ostream* os_ = 0;
+
+
+// a SpectrumList that generates spectra on demand, records the highest index requested
+// so far, and throws on a configurable index
+class TestSpectrumList : public SpectrumList
+{
+    public:
+
+    TestSpectrumList(size_t size, size_t badIndex = numeric_limits<size_t>::max())
+    :   size_(size), badIndex_(badIndex), maxRequestedIndex_(0), requestCount_(0)
+    {
+        for (size_t i=0; i < size; ++i)
+        {
+            identities_.push_back(SpectrumIdentity());
+            identities_.back().index = i;
+            identities_.back().id = "scan=" + lexical_cast<string>(i+1);
+        }
+    }
+
+    virtual size_t size() const {return size_;}
+    virtual const SpectrumIdentity& spectrumIdentity(size_t index) const {return identities_.at(index);}
+
+    virtual SpectrumPtr spectrum(size_t index, bool getBinaryData = false) const
+    {
+        {
+            boost::lock_guard<boost::mutex> lock(mutex_);
+            maxRequestedIndex_ = max(maxRequestedIndex_, index);
+            ++requestCount_;
+        }
+
+        if (index == badIndex_)
+            throw runtime_error("bad index");
+
+        SpectrumPtr result(new Spectrum);
+        result->index = index;
+        result->id = identities_[index].id;
+        result->set(MS_ms_level, 1 + index % 2);
+        if (getBinaryData)
+        {
+            vector<double> mz(1, 100.0 + index), intensity(1, 10.0 * index);
+            result->setMZIntensityArrays(mz, intensity, MS_number_of_detector_counts);
+        }
+
+        // vary the time each spectrum takes so results finish out of order
+        boost::this_thread::sleep_for(boost::chrono::microseconds((index * 7919) % 300));
+        return result;
+    }
+
+    size_t maxRequestedIndex() const {boost::lock_guard<boost::mutex> lock(mutex_); return maxRequestedIndex_;}
+    size_t requestCount() const {boost::lock_guard<boost::mutex> lock(mutex_); return requestCount_;}
+
+    private:
+    size_t size_, badIndex_;
+    vector<SpectrumIdentity> identities_;
+    mutable boost::mutex mutex_;
+    mutable size_t maxRequestedIndex_, requestCount_;
+};
+
+
+void testSequential(size_t numThreads, size_t windowSize)
+{
+    if (os_) *os_ << "testSequential: " << numThreads << " threads, window " << windowSize << endl;
+
+    TestSpectrumList sl(500);
+    SpectrumWorkerThreads workers(sl, numThreads, windowSize);
+    size_t effectiveWindow = windowSize > 0 ? windowSize : (numThreads > 0 ? numThreads : max(1u, boost::thread::hardware_concurrency())) * 4;
+
+    for (size_t i=0; i < sl.size(); ++i)
+    {
+        SpectrumPtr s = workers.processBatch(i);
+        unit_assert_operator_equal(i, s->index);
+        unit_assert_operator_equal(sl.spectrumIdentity(i).id, s->id);
+        unit_assert_operator_equal(1, s->binaryDataArrayPtrs[0]->data.size());
+        unit_assert_operator_equal(100.0 + i, s->getMZArray()->data[0]);
+
+        // workers never run further ahead than the lookahead window
+        unit_assert(sl.maxRequestedIndex() < i + effectiveWindow);
+    }
+}
+
+
+void testRandomAccess()
+{
+    if (os_) *os_ << "testRandomAccess" << endl;
+
+    TestSpectrumList sl(200);
+    SpectrumWorkerThreads workers(sl, 4, 8);
+
+    // reverse iteration repositions the window on every request
+    for (size_t i=sl.size(); i > 0; --i)
+        unit_assert_operator_equal(i-1, workers.processBatch(i-1)->index);
+
+    // jumping around
+    size_t indexes[] = {5, 6, 7, 150, 151, 3, 199, 0, 0, 1, 100};
+    BOOST_FOREACH(size_t i, indexes)
+        unit_assert_operator_equal(i, workers.processBatch(i)->index);
+
+    unit_assert_throws(workers.processBatch(sl.size()), out_of_range);
+}
+
+
+void concurrentRandomAccessCaller(SpectrumWorkerThreads& workers, size_t size, size_t seed, size_t& failures)
+{
+    // runs of a few sequential requests starting at pseudo-random indexes, some without binary data
+    size_t index = (seed * 7919) % size;
+    for (size_t i=0; i < 400; ++i)
+    {
+        index = i % 5 == 0 ? (index * 104729 + seed + i) % size : (index + 1) % size;
+        bool getBinaryData = (i + seed) % 7 != 0;
+        SpectrumPtr s = workers.processBatch(index, getBinaryData);
+        if (s->index != index || (getBinaryData && s->binaryDataArrayPtrs.size() != 2))
+            ++failures;
+    }
+}
+
+
+// several callers share the workers, each one repositioning the window for the others
+void testConcurrentRandomAccess(size_t numCallers, size_t numThreads, size_t windowSize)
+{
+    if (os_) *os_ << "testConcurrentRandomAccess: " << numCallers << " callers, " << numThreads << " threads, window " << windowSize << endl;
+
+    TestSpectrumList sl(300);
+    SpectrumWorkerThreads workers(sl, numThreads, windowSize);
+
+    boost::thread_group callers;
+    vector<size_t> failures(numCallers, 0);
+    for (size_t c=0; c < numCallers; ++c)
+        callers.create_thread(boost::bind(&concurrentRandomAccessCaller, boost::ref(workers), sl.size(), c, boost::ref(failures[c])));
+    callers.join_all();
+
+    for (size_t c=0; c < numCallers; ++c)
+        unit_assert_operator_equal(0, failures[c]);
+}
+
+
+void testBinaryData()
+{
+    if (os_) *os_ << "testBinaryData" << endl;
+
+    TestSpectrumList sl(100);
+    SpectrumWorkerThreads workers(sl, 3, 6);
+
+    for (size_t i=0; i < sl.size(); ++i)
+    {
+        SpectrumPtr s = workers.processBatch(i, false);
+        unit_assert_operator_equal(i, s->index);
+        unit_assert(s->binaryDataArrayPtrs.empty());
+    }
+
+    for (size_t i=0; i < sl.size(); ++i)
+    {
+        // a result fetched with binary data also satisfies a metadata-only request
+        SpectrumPtr s = workers.processBatch(i, false);
+        unit_assert_operator_equal(i, s->index);
+
+        // a metadata-only result must be upgraded when binary data is requested
+        s = workers.processBatch(i, true);
+        unit_assert_operator_equal(i, s->index);
+        unit_assert_operator_equal(2, s->binaryDataArrayPtrs.size());
+    }
+}
+
+
+void testError()
+{
+    if (os_) *os_ << "testError" << endl;
+
+    TestSpectrumList sl(50, 20);
+    SpectrumWorkerThreads workers(sl, 4, 8);
+
+    for (size_t i=0; i < 20; ++i)
+        unit_assert_operator_equal(i, workers.processBatch(i)->index);
+
+    // the worker's exception is rethrown to the caller, and the workers are still usable afterwards
+    unit_assert_throws_what(workers.processBatch(20), runtime_error, "bad index");
+    for (size_t i=21; i < sl.size(); ++i)
+        unit_assert_operator_equal(i, workers.processBatch(i)->index);
+}
+
+
+void renderId(const Spectrum& spectrum, string& rendered)
+{
+    rendered = spectrum.id + ":" + lexical_cast<string>(spectrum.binaryDataArrayPtrs.size());
+}
+
+
+void testRenderer()
+{
+    if (os_) *os_ << "testRenderer" << endl;
+
+    TestSpectrumList sl(200);
+    SpectrumWorkerThreads workers(sl, &renderId, 4, 8);
+
+    string rendered;
+    for (size_t i=0; i < sl.size(); ++i)
+    {
+        SpectrumPtr s = workers.processBatch(i, rendered);
+        unit_assert_operator_equal(i, s->index);
+        unit_assert_operator_equal(sl.spectrumIdentity(i).id + ":2", rendered);
+    }
+
+    // repeated and out-of-window requests render again on the calling thread
+    workers.processBatch(5, rendered);
+    unit_assert_operator_equal("scan=6:2", rendered);
+    workers.processBatch(5, rendered);
+    unit_assert_operator_equal("scan=6:2", rendered);
+
+    // no renderer
+    SpectrumWorkerThreads plainWorkers(sl, 2, 4);
+    unit_assert_throws(plainWorkers.processBatch(0, rendered), runtime_error);
+}
+
+
+void testConfig()
+{
+    if (os_) *os_ << "testConfig" << endl;
+
+    TestSpectrumList sl(100);
+    SpectrumWorkerThreads::Config config;
+    config.numThreads = 2;
+    config.windowSize = 4;
+
+    {
+        SpectrumWorkerThreads workers(sl, &renderId, config);
+        string rendered;
+        for (size_t i=0; i < sl.size(); ++i)
+        {
+            unit_assert_operator_equal(i, workers.processBatch(i, rendered)->index);
+            unit_assert_operator_equal(sl.spectrumIdentity(i).id + ":2", rendered);
+            unit_assert(sl.maxRequestedIndex() < i + config.windowSize);
+        }
+    }
+
+    // without threads, each spectrum is fetched only when it is requested
+    TestSpectrumList unthreadedSl(100);
+    config.useThreads = false;
+    SpectrumWorkerThreads workers(unthreadedSl, config);
+    for (size_t i=0; i < unthreadedSl.size(); ++i)
+    {
+        unit_assert_operator_equal(i, workers.processBatch(i)->index);
+        unit_assert_operator_equal(i + 1, unthreadedSl.requestCount());
+    }
+}
+
+
+void testEarlyDestruction()
+{
+    if (os_) *os_ << "testEarlyDestruction" << endl;
+
+    // destroying the workers with fetches in flight must not hang or crash
+    TestSpectrumList sl(1000);
+    {
+        SpectrumWorkerThreads workers(sl, 8, 64);
+        workers.processBatch(0);
+    }
+    unit_assert(sl.requestCount() <= 1 + 64 + 8);
+}
+
+
+void test()
+{
+    testSequential(1, 1);
+    testSequential(1, 10);
+    testSequential(4, 1);
+    testSequential(4, 16);
+    testSequential(0, 0);
+    testRandomAccess();
+    testConcurrentRandomAccess(2, 2, 4);
+    testConcurrentRandomAccess(4, 4, 8);
+    testConcurrentRandomAccess(8, 3, 1);
+    testBinaryData();
+    testError();
+    testRenderer();
+    testConfig();
+    testEarlyDestruction();
+}
+
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(argc, argv)
+
+    try
+    {
+        if (argc>1 && !strcmp(argv[1],"-v")) os_ = &cout;
+        test();
+    }
+    catch (exception& e)
+    {
+        TEST_FAILED(e.what())
+    }
+    catch (...)
+    {
+        TEST_FAILED("Caught unknown exception.")
+    }
+
+    TEST_EPILOG
+}
@@ -399,6 +399,11 @@ const Configuration_mz5::ChromatogramLoadPolicy& Configuration_mz5::getChromatog
     return chromatogramLoadPolicy_;
 }
 
+const SpectrumWorkerThreads::Config& Configuration_mz5::getSpectrumWorkerThreadsConfig() const
+{
+    return config_.spectrumWorkerThreadsConfig;
+}
+
 const bool Configuration_mz5::doTranslating() const
 {
     return doTranslating_;
@@ -282,6 +282,12 @@ public:
      */
     const ChromatogramLoadPolicy& getChromatogramLoadPolicy() const;
 
+    /**
+     * Getter for the worker threads that fetch spectra ahead of the writer.
+     * @return worker thread settings of the WriteConfig
+     */
+    const SpectrumWorkerThreads::Config& getSpectrumWorkerThreadsConfig() const;
+
     /**
      * Getter for translation flag.
      * If this flag is set, mz values of mass spectra are saved as delta mz's. This greatly improves compression rate and significantly reduces file size.
@@ -25,6 +25,7 @@
 #include "ReferenceWrite_mz5.hpp"
 #include "ReferenceRead_mz5.hpp"
 #include "Translator_mz5.hpp"
+#include "pwiz/utility/misc/sharded_cache.hpp"
 #include <algorithm>
 #include "boost/thread/mutex.hpp"
 
@@ -34,7 +35,40 @@ namespace mz5 {
 
 using namespace H5;
 
-namespace {boost::mutex connectionReadMutex_, connectionWriteMutex_;}
+namespace {
+
+boost::mutex connectionReadMutex_, connectionWriteMutex_;
+
+// blocks read after the requested ones when the reads are sequential
+const hsize_t readAheadBlocks_ = 8;
+
+// values per block for a numerical dataset that is not chunked
+const hsize_t defaultBlockSize_ = 4096;
+
+struct Block
+{
+    std::pair<int, hsize_t> key; // dataset and block index
+    boost::shared_ptr<const std::vector<double> > values;
+};
+
+struct BlockWeight
+{
+    size_t operator()(const Block& block) const {return block.values->size() * sizeof(double);}
+};
+
+} // namespace
+
+class Connection_mz5::BlockCache : public pwiz::util::sharded_cache<Block,
+        boost::multi_index::member<Block, std::pair<int, hsize_t>, &Block::key>, BlockWeight>
+{
+public:
+    BlockCache(size_t maxBytes)
+        : pwiz::util::sharded_cache<Block, boost::multi_index::member<Block,
+              std::pair<int, hsize_t>, &Block::key>, BlockWeight>(
+              pwiz::util::cache_config(0, maxBytes, 8))
+    {
+    }
+};
 
 Connection_mz5::Connection_mz5(const std::string filename, const OpenPolicy op,
         const Configuration_mz5 config) :
@@ -83,6 +117,7 @@ Connection_mz5::Connection_mz5(const std::string filename, const OpenPolicy op,
         break;
     }
     closed_ = false;
+    blockCache_.reset(new BlockCache(config_.getBufferInB()));
 }
 
 Connection_mz5::~Connection_mz5()
@@ -158,6 +193,23 @@ void Connection_mz5::readFile()
             v = config_.getVariableFor(oname);
             fields_.insert(std::pair<Configuration_mz5::MZ5DataSets, size_t>(v,
                     dsend));
+            if (v == Configuration_mz5::SpectrumMZ
+                    || v == Configuration_mz5::SpectrumIntensity
+                    || v == Configuration_mz5::ChomatogramTime
+                    || v == Configuration_mz5::ChromatogramIntensity)
+            {
+                // a block is one chunk, which the library decompresses as a whole anyway
+                hsize_t chunk[1] =
+                { defaultBlockSize_ };
+                DSetCreatPropList cparm = dataset.getCreatePlist();
+                if (cparm.getLayout() == H5D_CHUNKED)
+                {
+                    cparm.getChunk(1, chunk);
+                }
+                cparm.close();
+                blockSizes_.insert(std::pair<Configuration_mz5::MZ5DataSets,
+                        hsize_t>(v, std::max<hsize_t>(1, chunk[0])));
+            }
         } catch (std::out_of_range&)
         {
         }
@@ -335,46 +387,144 @@ void Connection_mz5::getData(std::vector<double>& data,
         const Configuration_mz5::MZ5DataSets v, const hsize_t start,
         const hsize_t end)
 {
-    boost::mutex::scoped_lock lock(connectionReadMutex_);
-
     hsize_t scount = end - start;
     data.resize(scount);
-    if (scount > 0)
+    if (scount == 0)
     {
-        std::map<Configuration_mz5::MZ5DataSets, DataSet>::iterator it =
-                bufferMap_.find(v);
-        if (it == bufferMap_.end())
+        return;
+    }
+
+    std::map<Configuration_mz5::MZ5DataSets, hsize_t>::const_iterator bsit =
+            blockSizes_.find(v);
+    if (bsit == blockSizes_.end())
+    {
+        // not a dataset of the file that was read
+        boost::mutex::scoped_lock lock(connectionReadMutex_);
+        readHyperslab(v, start, scount, &data[0]);
+    }
+    else
+    {
+        hsize_t blockSize = bsit->second;
+        hsize_t firstBlock = start / blockSize;
+        hsize_t lastBlock = (end - 1) / blockSize;
+        std::vector<BlockPtr> blocks(lastBlock - firstBlock + 1);
+
+        // blocks between two missing ones are read again rather than splitting the read
+        hsize_t firstMissing = lastBlock + 1, lastMissing = 0;
+        Block block;
+        for (hsize_t b = firstBlock; b <= lastBlock; ++b)
         {
-            DataSet ds = file_->openDataSet(config_.getNameFor(v));
-            bufferMap_.insert(
-                    std::pair<Configuration_mz5::MZ5DataSets, DataSet>(v, ds));
-            it = bufferMap_.find(v);
+            if (blockCache_->get(std::make_pair((int) v, b), block))
+            {
+                blocks[b - firstBlock] = block.values;
+            }
+            else
+            {
+                firstMissing = std::min(firstMissing, b);
+                lastMissing = b;
+            }
         }
-        DataSet dataset = it->second;
-        DataSpace dataspace = dataset.getSpace();
-        hsize_t offset[1];
-        offset[0] = start;
-        hsize_t count[1];
-        count[0] = scount;
-        dataspace.selectHyperslab(H5S_SELECT_SET, count, offset);
-
-        hsize_t dimsm[1];
-        dimsm[0] = scount;
-        DataSpace memspace(1, dimsm);
-
-        dataset.read(&data[0], PredType::NATIVE_DOUBLE, memspace, dataspace);
-        if (v == Configuration_mz5::SpectrumMZ && config_.doTranslating())
+        if (firstMissing <= lastBlock)
         {
-            Translator_mz5::reverseTranslateMZ(data);
+            readBlocks(v, firstMissing, lastMissing, blocks, firstBlock);
         }
-        if (v == Configuration_mz5::SpectrumIntensity
-                && config_.doTranslating())
+
+        for (hsize_t b = firstBlock; b <= lastBlock; ++b)
         {
-            Translator_mz5::reverseTranslateIntensity(data);
+            const std::vector<double>& values = *blocks[b - firstBlock];
+            hsize_t blockStart = b * blockSize;
+            hsize_t from = std::max(start, blockStart) - blockStart;
+            hsize_t to = std::min(end - blockStart, (hsize_t) values.size());
+            if (to < from)
+            {
+                throw std::runtime_error("Connection_mz5::getData(): range is outside of the dataset.");
+            }
+            std::copy(values.begin() + from, values.begin() + to,
+                    data.begin() + (blockStart + from - start));
         }
-        memspace.close();
-        dataspace.close();
     }
+
+    if (v == Configuration_mz5::SpectrumMZ && config_.doTranslating())
+    {
+        Translator_mz5::reverseTranslateMZ(data);
+    }
+    if (v == Configuration_mz5::SpectrumIntensity && config_.doTranslating())
+    {
+        Translator_mz5::reverseTranslateIntensity(data);
+    }
+}
+
+void Connection_mz5::readBlocks(const Configuration_mz5::MZ5DataSets v,
+        const hsize_t firstBlock, const hsize_t lastBlock,
+        std::vector<BlockPtr>& blocks, const hsize_t firstNeeded)
+{
+    boost::mutex::scoped_lock lock(connectionReadMutex_);
+
+    hsize_t blockSize = blockSizes_.find(v)->second;
+    hsize_t size = fields_.find(v)->second;
+    hsize_t blockCount = (size + blockSize - 1) / blockSize;
+
+    hsize_t endBlock = lastBlock + 1;
+    hsize_t& nextBlock = nextBlocks_[v];
+    if (firstBlock == nextBlock)
+    {
+        endBlock += readAheadBlocks_;
+    }
+    endBlock = std::min(endBlock, blockCount);
+    if (endBlock <= lastBlock)
+    {
+        throw std::runtime_error("Connection_mz5::getData(): range is outside of the dataset.");
+    }
+    nextBlock = endBlock;
+
+    hsize_t offset = firstBlock * blockSize;
+    hsize_t count = std::min(endBlock * blockSize, size) - offset;
+    std::vector<double> buffer(count);
+    readHyperslab(v, offset, count, &buffer[0]);
+
+    for (hsize_t b = firstBlock; b < endBlock; ++b)
+    {
+        std::vector<double>::const_iterator begin = buffer.begin()
+                + (b - firstBlock) * blockSize;
+        Block block;
+        block.key = std::make_pair((int) v, b);
+        block.values.reset(new std::vector<double>(begin, begin
+                + std::min(blockSize, (hsize_t) (buffer.end() - begin))));
+        blockCache_->put(block);
+        if (b <= lastBlock)
+        {
+            blocks[b - firstNeeded] = block.values;
+        }
+    }
+}
+
+void Connection_mz5::readHyperslab(const Configuration_mz5::MZ5DataSets v,
+        const hsize_t start, const hsize_t count, double* data)
+{
+    std::map<Configuration_mz5::MZ5DataSets, DataSet>::iterator it =
+            bufferMap_.find(v);
+    if (it == bufferMap_.end())
+    {
+        DataSet ds = file_->openDataSet(config_.getNameFor(v));
+        bufferMap_.insert(
+                std::pair<Configuration_mz5::MZ5DataSets, DataSet>(v, ds));
+        it = bufferMap_.find(v);
+    }
+    DataSet dataset = it->second;
+    DataSpace dataspace = dataset.getSpace();
+    hsize_t offset[1];
+    offset[0] = start;
+    hsize_t scount[1];
+    scount[0] = count;
+    dataspace.selectHyperslab(H5S_SELECT_SET, scount, offset);
+
+    hsize_t dimsm[1];
+    dimsm[0] = count;
+    DataSpace memspace(1, dimsm);
+
+    dataset.read(data, PredType::NATIVE_DOUBLE, memspace, dataspace);
+    memspace.close();
+    dataspace.close();
 }
 
 void Connection_mz5::flush(const Configuration_mz5::MZ5DataSets v)
@@ -28,6 +28,7 @@
 #include "Configuration_mz5.hpp"
 #include <string>
 #include <vector>
+#include <boost/shared_ptr.hpp>
 
 namespace pwiz {
 namespace msdata {
@@ -127,6 +128,10 @@ public:
 
     /**
      * Gets data from a numerical dataset and writes it to the vector. This method is used to get mz,intensity and time.
+     *
+     * When reading a file, the values are read a block (the dataset's chunk) at a time and the decompressed blocks are
+     * kept in a cache shared by all threads, so neighbouring spectra are served by one read; when the blocks are read
+     * in order, the following blocks are read with them. Only reads of blocks not in the cache wait for the HDF5 library.
      * @param data data vector
      * @param v dataset enumeration value
      * @param start start index
@@ -172,6 +177,35 @@ private:
      */
     void readFile();
 
+    /**
+     * Reads a range of a numerical dataset without the block cache.
+     * Must be called with the read lock held.
+     * @param v dataset enumeration value
+     * @param start start index
+     * @param count number of values
+     * @param data pointer where the values are written to
+     */
+    void readHyperslab(const Configuration_mz5::MZ5DataSets v,
+            const hsize_t start, const hsize_t count, double* data);
+
+    /**
+     * Cached block of a numerical dataset.
+     */
+    typedef boost::shared_ptr<const std::vector<double> > BlockPtr;
+
+    /**
+     * Reads the blocks from firstBlock to lastBlock with one hyperslab, plus the following blocks if the reads are sequential,
+     * and adds them to the block cache.
+     * @param v dataset enumeration value
+     * @param firstBlock index of the first block to read
+     * @param lastBlock index of the last block that is needed
+     * @param blocks the needed blocks, starting with block firstNeeded
+     * @param firstNeeded index of the first needed block
+     */
+    void readBlocks(const Configuration_mz5::MZ5DataSets v,
+            const hsize_t firstBlock, const hsize_t lastBlock,
+            std::vector<BlockPtr>& blocks, const hsize_t firstNeeded);
+
     /**
      * Extends and appends data to an existing dataset with no buffer.
      * @param dataset dataset
@@ -225,6 +259,19 @@ private:
      * Flag whether file is closed or not.
      */
     bool closed_;
+    /**
+     * Cache of decompressed blocks of the numerical datasets.
+     */
+    class BlockCache;
+    boost::shared_ptr<BlockCache> blockCache_;
+    /**
+     * Number of values per block for each numerical dataset in the file.
+     */
+    std::map<Configuration_mz5::MZ5DataSets, hsize_t> blockSizes_;
+    /**
+     * Block following the last block read for each dataset; a read starting there is a sequential read.
+     */
+    std::map<Configuration_mz5::MZ5DataSets, hsize_t> nextBlocks_;
 };
 
 }
@@ -363,7 +363,7 @@ pwiz::util::IterationListener::Status ReferenceWrite_mz5::readAndWriteSpectra(
         pwiz::msdata::SpectrumPtr sp;
         pwiz::msdata::BinaryDataArrayPtr bdap;
         std::vector<double> mz;
-        SpectrumWorkerThreads spectrumWorkers(*sl);
+        SpectrumWorkerThreads spectrumWorkers(*sl, connection.getConfiguration().getSpectrumWorkerThreadsConfig());
         for (size_t i = 0; i < sl->size(); i++)
         {
             status = pwiz::util::IterationListener::Status_Ok;
@@ -31,6 +31,7 @@
 #include "pwiz/utility/misc/Exception.hpp"
 #include "pwiz/utility/misc/Std.hpp"
 #include "pwiz/utility/misc/Singleton.hpp"
+#include "pwiz/utility/misc/Once.hpp"
 #include <boost/xpressive/xpressive_dynamic.hpp>
 
 
@@ -351,11 +352,200 @@ string Digestion::disambiguateCleavageAgentRegex(const string& cleavageAgentRege
 }
 
 
+namespace {
+
+// a cleavage rule compiled to a table of residue pairs, for rules made of single-residue lookbehinds
+// and optional lookaheads (which covers nearly all of the PSI-MS cleavage agents): the rule cuts between
+// residues a and b iff bit b of masks_[a] is set; 26 stands for a terminus and 27 for any symbol
+// other than A-Z
+class CleavageRuleTable
+{
+    public:
+
+    CleavageRuleTable() {std::fill(masks_, masks_ + residueCount_, 0);}
+
+    /// returns false (and leaves the table empty) if any alternative of the regex is not a positive
+    /// single-residue lookbehind, optionally followed by a single-residue lookahead; then the regex has to be searched:
+    /// digest() resumes its search at the last site, where a lookbehind can't look back but a lookahead-only
+    /// alternative matches again, so only these rules find exactly the sites the search finds
+    bool compile(const string& cleavageAgentRegex)
+    {
+        vector<string> rules;
+        splitAlternatives(cleavageAgentRegex, rules);
+
+        boost::uint32_t masks[residueCount_];
+        std::fill(masks, masks + residueCount_, 0);
+        BOOST_FOREACH(const string& rule, rules)
+        {
+            bxp::smatch what;
+            if (rule.empty() || !bxp::regex_match(rule, what, simpleRuleRegex_))
+                return false;
+
+            bool hasLookbehind = what[1].matched && what[2].matched;
+            bool hasLookahead = what[3].matched && what[4].matched;
+            if (!hasLookbehind || what[1] != "=")
+                return false;
+
+            boost::uint32_t behind = lookMask(true, what[2].str());
+            boost::uint32_t ahead = hasLookahead ? lookMask(what[3] == "=", what[4].str()) : allResidues_;
+            for (int i=0; i < residueCount_; ++i)
+                if (behind & (1u << i))
+                    masks[i] |= ahead;
+        }
+
+        copy(masks, masks + residueCount_, masks_);
+        return true;
+    }
+
+    /// appends the offsets of the cleavage sites, like searching for the regex does:
+    /// the site between residues i and i+1 is i, and -1 and sequence.length()-1 are the termini
+    void findSites(const string& sequence, vector<int>& sites) const
+    {
+        int previous = terminus_;
+        for (size_t i=0; i < sequence.length(); ++i)
+        {
+            int current = residueIndex(sequence[i]);
+            if (masks_[previous] & (1u << current))
+                sites.push_back(int(i) - 1);
+            previous = current;
+        }
+        if (masks_[previous] & (1u << terminus_))
+            sites.push_back(int(sequence.length()) - 1);
+    }
+
+    private:
+
+    static const int residueCount_ = 28;
+    static const int terminus_ = 26;
+    static const int other_ = 27;
+    static const boost::uint32_t allResidues_ = (1u << residueCount_) - 1;
+
+    static const bxp::sregex simpleRuleRegex_;
+
+    boost::uint32_t masks_[residueCount_];
+
+    static int residueIndex(char residue)
+    {
+        return residue >= 'A' && residue <= 'Z' ? residue - 'A' : other_;
+    }
+
+    // a lookaround needs a residue, so a terminus only matches a negative lookaround
+    static boost::uint32_t lookMask(bool isPositive, const string& residueSet)
+    {
+        boost::uint32_t mask = 0;
+        if (residueSet.length() == 1)
+            mask = 1u << residueIndex(residueSet[0]);
+        else
+        {
+            bool isNegated = residueSet[1] == '^';
+            for (size_t i = isNegated ? 2 : 1; i+1 < residueSet.length(); ++i)
+                if (residueSet[i+1] == '-' && i+2 < residueSet.length()-1)
+                {
+                    for (char c = residueSet[i]; c <= residueSet[i+2]; ++c)
+                        mask |= 1u << residueIndex(c);
+                    i += 2;
+                }
+                else
+                    mask |= 1u << residueIndex(residueSet[i]);
+            if (isNegated)
+                mask = allResidues_ & ~mask & ~(1u << terminus_);
+        }
+        return isPositive ? mask : allResidues_ & ~mask;
+    }
+
+    // splits "((a)|(b))" into a and b, recursively; groups around the whole expression are removed
+    static void splitAlternatives(const string& regex, vector<string>& alternatives)
+    {
+        string expression = regex;
+        while (expression.length() > 1 && expression[0] == '(' && expression[1] != '?' &&
+               matchingParenthesis(expression, 0) == expression.length()-1)
+            expression = expression.substr(1, expression.length()-2);
+
+        vector<size_t> bars;
+        int depth = 0;
+        for (size_t i=0; i < expression.length(); ++i)
+            switch (expression[i])
+            {
+                case '\\': ++i; break;
+                case '(': ++depth; break;
+                case ')': --depth; break;
+                case '|': if (depth == 0) bars.push_back(i); break;
+            }
+
+        if (bars.empty())
+        {
+            alternatives.push_back(expression);
+            return;
+        }
+
+        bars.push_back(expression.length());
+        for (size_t i=0, begin=0; i < bars.size(); begin = bars[i++]+1)
+            splitAlternatives(expression.substr(begin, bars[i]-begin), alternatives);
+    }
+
+    static size_t matchingParenthesis(const string& expression, size_t open)
+    {
+        int depth = 0;
+        for (size_t i=open; i < expression.length(); ++i)
+            if (expression[i] == '\\') ++i;
+            else if (expression[i] == '(') ++depth;
+            else if (expression[i] == ')' && --depth == 0) return i;
+        return string::npos;
+    }
+};
+
+// like cutNoCutRegex, but the residue sets may be negated and have ranges
+const bxp::sregex CleavageRuleTable::simpleRuleRegex_ = bxp::sregex::compile("(?:\\(+\\?<([=!])(\\[\\^?[A-Z-]+\\]|[A-Z])\\)+)?(?:\\(+\\?([=!])(\\[\\^?[A-Z-]+\\]|[A-Z])\\)+)?");
+
+
+// unmodified residue masses by symbol; an unknown symbol makes a peptide's mass 0, as in Peptide
+class ResidueMassTable : public boost::singleton<ResidueMassTable>
+{
+    public:
+    ResidueMassTable(boost::restricted)
+    {
+        for (int c=0; c < 256; ++c)
+        {
+            monoMass_[c] = avgMass_[c] = 0;
+            known_[c] = false;
+            if (c == 0)
+                continue;
+            try
+            {
+                const chemistry::Formula& residueFormula = AminoAcid::Info::record((char) c).residueFormula;
+                monoMass_[c] = residueFormula.monoisotopicMass();
+                avgMass_[c] = residueFormula.molecularWeight();
+                known_[c] = true;
+            }
+            catch (exception&)
+            {
+            }
+        }
+        chemistry::Formula water("H2O1");
+        waterMonoMass_ = water.monoisotopicMass();
+        waterAvgMass_ = water.molecularWeight();
+    }
+
+    double monoMass(char c) const {return monoMass_[(unsigned char) c];}
+    double avgMass(char c) const {return avgMass_[(unsigned char) c];}
+    bool known(char c) const {return known_[(unsigned char) c];}
+    double waterMonoMass() const {return waterMonoMass_;}
+    double waterAvgMass() const {return waterAvgMass_;}
+
+    private:
+    double monoMass_[256], avgMass_[256];
+    bool known_[256];
+    double waterMonoMass_, waterAvgMass_;
+};
+
+} // namespace
+
+
 class Digestion::Impl
 {
     public:
     Impl(const Peptide& peptide, const std::vector<CVID>& cleavageAgents, const Config& config)
-        :   peptide_(peptide), config_(config)
+        :   peptide_(peptide), config_(config), useRuleTable_(false), massSumsInitialized_(util::init_once_flag_proxy)
     {
         if (cleavageAgents.size() == 1)
         {
@@ -363,7 +553,7 @@ class Digestion::Impl
             if (cleavageAgent_ == MS_unspecific_cleavage)
                 config_.minimumSpecificity = Digestion::NonSpecific;
             else if (cleavageAgent_ != MS_no_cleavage)
-                cleavageAgentRegex_ = bxp::sregex::compile(disambiguateCleavageAgentRegex(getCleavageAgentRegex(cleavageAgent_)));
+                compileRule(disambiguateCleavageAgentRegex(getCleavageAgentRegex(cleavageAgent_)));
             return;
         }
 
@@ -373,16 +563,16 @@ class Digestion::Impl
             mergedRegex += ")|(" + disambiguateCleavageAgentRegex(getCleavageAgentRegex(cleavageAgents[i]));
         mergedRegex += "))";
 
-        cleavageAgentRegex_ = bxp::sregex::compile(mergedRegex);
+        compileRule(mergedRegex);
     }
 
     Impl(const Peptide& peptide, const vector<string>& cleavageAgentRegexes, const Config& config)
-        :   peptide_(peptide), config_(config)
+        :   peptide_(peptide), config_(config), useRuleTable_(false), massSumsInitialized_(util::init_once_flag_proxy)
     {
         cleavageAgent_ = CVID_Unknown; // Avoid testing uninitialized value in digest()
         if (cleavageAgentRegexes.size() == 1)
         {
-            cleavageAgentRegex_ = bxp::sregex::compile(cleavageAgentRegexes[0]); //disambiguateCleavageAgentRegex(cleavageAgentRegexes[0].str());
+            compileRule(cleavageAgentRegexes[0]); //disambiguateCleavageAgentRegex(cleavageAgentRegexes[0].str());
             return;
         }
 
@@ -391,7 +581,14 @@ class Digestion::Impl
             mergedRegex += ")|(" + disambiguateCleavageAgentRegex(cleavageAgentRegexes[i]);
         mergedRegex += "))";
 
-        cleavageAgentRegex_ = bxp::sregex::compile(mergedRegex);
+        compileRule(mergedRegex);
+    }
+
+    // the regex is compiled either way, so an invalid one throws the same as before
+    inline void compileRule(const string& cleavageAgentRegex)
+    {
+        cleavageAgentRegex_ = bxp::sregex::compile(cleavageAgentRegex);
+        useRuleTable_ = ruleTable_.compile(cleavageAgentRegex);
     }
 
     inline void digest() const
@@ -420,17 +617,22 @@ class Digestion::Impl
                 //if (cleavageAgentRegex_.empty())
                 //    throw runtime_error("empty cleavage regex");
 
-                std::string::const_iterator start = sequence.begin();
-                std::string::const_iterator end = sequence.end();
-                bxp::smatch what;
-                bxp::regex_constants::match_flag_type flags = bxp::regex_constants::match_default;
-                while (bxp::regex_search(start, end, what, cleavageAgentRegex_, flags))
+                if (useRuleTable_)
+                    ruleTable_.findSites(sequence, sites_);
+                else
                 {
-                    sites_.push_back(int(what[0].first-sequence.begin()-1));
+                    std::string::const_iterator start = sequence.begin();
+                    std::string::const_iterator end = sequence.end();
+                    bxp::smatch what;
+                    bxp::regex_constants::match_flag_type flags = bxp::regex_constants::match_default;
+                    while (bxp::regex_search(start, end, what, cleavageAgentRegex_, flags))
+                    {
+                        sites_.push_back(int(what[0].first-sequence.begin()-1));
 
-                    // update search position and flags
-                    start = max(what[0].second, start+1);
-                    flags = flags | bxp::regex_constants::match_prev_avail | bxp::regex_constants::match_not_bol;
+                        // update search position and flags
+                        start = max(what[0].second, start+1);
+                        flags = flags | bxp::regex_constants::match_prev_avail | bxp::regex_constants::match_not_bol;
+                    }
                 }
 
                 // if regex didn't match n-terminus, insert it
@@ -572,11 +774,36 @@ class Digestion::Impl
                                CTerminusSuffix);
     }
 
+    // fills the prefix sums of the residue masses if necessary
+    inline void sumMasses() const
+    {
+        boost::call_once(massSumsInitialized_.flag, boost::bind(&Digestion::Impl::fillMassSums, this));
+    }
+
     private:
+
+    void fillMassSums() const
+    {
+        const string& sequence = peptide_.sequence();
+        const ResidueMassTable& masses = *get_pointer(ResidueMassTable::instance);
+
+        monoMassSums_.resize(sequence.length()+1, 0);
+        avgMassSums_.resize(sequence.length()+1, 0);
+        unknownResidueSums_.resize(sequence.length()+1, 0);
+        for (size_t i=0; i < sequence.length(); ++i)
+        {
+            monoMassSums_[i+1] = monoMassSums_[i] + masses.monoMass(sequence[i]);
+            avgMassSums_[i+1] = avgMassSums_[i] + masses.avgMass(sequence[i]);
+            unknownResidueSums_[i+1] = unknownResidueSums_[i] + (masses.known(sequence[i]) ? 0 : 1);
+        }
+    }
+
     Peptide peptide_;
     Config config_;
     CVID cleavageAgent_;
     bxp::sregex cleavageAgentRegex_;
+    CleavageRuleTable ruleTable_;
+    bool useRuleTable_;
     friend class Digestion::const_iterator::Impl;
 
     // precalculated offsets to digestion sites in order of occurence;
@@ -585,6 +812,12 @@ class Digestion::Impl
     // peptide_.sequence().length()-1 is the C terminus digestion site
     mutable vector<int> sites_;
     mutable set<int> sitesSet_;
+
+    // sums of the residue masses (and of unknown residues) before each offset, for DigestedPeptideRecord
+    mutable vector<double> monoMassSums_;
+    mutable vector<double> avgMassSums_;
+    mutable vector<int> unknownResidueSums_;
+    mutable util::once_flag_proxy massSumsInitialized_;
 };
 
 
@@ -827,6 +1060,46 @@ class Digestion::const_iterator::Impl
         }
     }
 
+    DigestedPeptideRecord record() const
+    {
+        DigestedPeptideRecord result;
+
+        int missedCleavages = int(end_ - begin_)-1;
+        if (missedCleavages > 0 && config_.clipNTerminalMethionine && begin_ != sites_.end() && *begin_ < 0 && sequence_[0] == 'M')
+            --missedCleavages;
+        result.missedCleavages = missedCleavages;
+
+        switch (config_.minimumSpecificity)
+        {
+            default:
+            case FullySpecific:
+                result.offset = *begin_+1;
+                result.length = *end_ - *begin_;
+                result.NTerminusIsSpecific = result.CTerminusIsSpecific = true;
+                break;
+
+            case SemiSpecific:
+            case NonSpecific:
+                result.offset = beginNonSpecific_+1;
+                result.length = endNonSpecific_ - beginNonSpecific_;
+                result.NTerminusIsSpecific = begin_ != sites_.end() && *begin_ == beginNonSpecific_;
+                result.CTerminusIsSpecific = end_ != sites_.end() && *end_ == endNonSpecific_;
+                break;
+        }
+
+        digestionImpl_.sumMasses();
+        size_t begin = result.offset, end = result.offset + result.length;
+        if (result.length == 0 || digestionImpl_.unknownResidueSums_[end] > digestionImpl_.unknownResidueSums_[begin])
+            result.monoisotopicMass = result.molecularWeight = 0;
+        else
+        {
+            const ResidueMassTable& masses = *get_pointer(ResidueMassTable::instance);
+            result.monoisotopicMass = digestionImpl_.monoMassSums_[end] - digestionImpl_.monoMassSums_[begin] + masses.waterMonoMass();
+            result.molecularWeight = digestionImpl_.avgMassSums_[end] - digestionImpl_.avgMassSums_[begin] + masses.waterAvgMass();
+        }
+        return result;
+    }
+
     inline void nextFullySpecific()
     {
         bool newBegin = (end_ == sites_.end());
@@ -1063,6 +1336,11 @@ PWIZ_API_DECL const DigestedPeptide* Digestion::const_iterator::operator->() con
     return &(impl_->peptide());
 }
 
+PWIZ_API_DECL DigestedPeptideRecord Digestion::const_iterator::record() const
+{
+    return impl_->record();
+}
+
 PWIZ_API_DECL Digestion::const_iterator& Digestion::const_iterator::operator++()
 {
     ++(*impl_);
@@ -107,6 +107,26 @@ class PWIZ_API_DECL DigestedPeptide : public Peptide
 };
 
 
+/// a peptide from digestion described by its place in the polypeptide, without a copy of its sequence
+struct PWIZ_API_DECL DigestedPeptideRecord
+{
+    /// the zero-based offset of the N terminus of the peptide in the polypeptide
+    size_t offset;
+
+    /// the number of residues in the peptide
+    size_t length;
+
+    size_t missedCleavages;
+    bool NTerminusIsSpecific;
+    bool CTerminusIsSpecific;
+
+    /// the unmodified neutral masses of the peptide (residues + water);
+    /// 0 if any of its residues is not a known amino acid, like Peptide
+    double monoisotopicMass;
+    double molecularWeight;
+};
+
+
 /// enumerates the peptides from proteolytic digestion of a polypeptide or protein;
 class PWIZ_API_DECL Digestion
 {
@@ -221,8 +241,14 @@ class PWIZ_API_DECL Digestion
         const_iterator(const const_iterator& rhs);
         ~const_iterator();
 
+        /// the DigestedPeptide is created on the first dereference of each position
         const DigestedPeptide& operator*() const;
         const DigestedPeptide* operator->() const;
+
+        /// returns the current peptide's place, digestion metadata and masses without creating a DigestedPeptide;
+        /// the masses are differences of prefix sums over the polypeptide, so this is cheap for every peptide
+        DigestedPeptideRecord record() const;
+
         const_iterator& operator++();
         const_iterator operator++(int);
         bool operator!=(const const_iterator& that) const; 
@@ -546,6 +546,111 @@ void testBSADigestion()
 }
 
 
+// the records match the materialized peptides
+void testRecords()
+{
+    if (os_) *os_ << "record test" << endl;
+
+    // BSA's first 120 residues, with an unknown residue
+    string sequence = "MKWVTFISLLLLFSSAYSRGVFRRDTHKSEIAHRFKDLGEEHFKGLVLIAFSQYLQQCPF"
+                      "DEHVKLVNELTEFAKTCVADESHAGCEKSLHTLFGDELCKXVASLRETYGDMADCCEKQEP";
+
+    Digestion::Specificity specificities[] = {Digestion::FullySpecific, Digestion::SemiSpecific, Digestion::NonSpecific};
+    BOOST_FOREACH(CVID agentCvid, Digestion::getCleavageAgents())
+    {
+        if (agentCvid == MS_unspecific_cleavage)
+            continue;
+
+        BOOST_FOREACH(Digestion::Specificity specificity, specificities)
+        {
+            Digestion::Config config(2, 4, 30, specificity);
+            Digestion digestion(sequence, agentCvid, config);
+
+            for (Digestion::const_iterator itr = digestion.begin(); itr != digestion.end(); ++itr)
+            {
+                DigestedPeptideRecord record = itr.record();
+                const DigestedPeptide& peptide = *itr;
+                unit_assert_operator_equal(peptide.offset(), record.offset);
+                unit_assert_operator_equal(peptide.sequence().length(), record.length);
+                unit_assert_operator_equal(peptide.missedCleavages(), record.missedCleavages);
+                unit_assert_operator_equal(peptide.NTerminusIsSpecific(), record.NTerminusIsSpecific);
+                unit_assert_operator_equal(peptide.CTerminusIsSpecific(), record.CTerminusIsSpecific);
+                unit_assert_equal(peptide.monoisotopicMass(), record.monoisotopicMass, 1e-8);
+                unit_assert_equal(peptide.molecularWeight(), record.molecularWeight, 1e-8);
+            }
+        }
+    }
+}
+
+
+void testRuleTableDigestion(const string& sequence, const vector<CVID>& agentCvids, const vector<string>& regexes)
+{
+    Digestion::Specificity specificities[] = {Digestion::FullySpecific, Digestion::SemiSpecific, Digestion::NonSpecific};
+    BOOST_FOREACH(Digestion::Specificity specificity, specificities)
+    for (int clipNTerminalMethionine=0; clipNTerminalMethionine < 2; ++clipNTerminalMethionine)
+    {
+        Digestion::Config config(3, 3, 40, specificity, clipNTerminalMethionine == 1);
+        Digestion digestion(sequence, agentCvids, config);
+        Digestion regexDigestion(sequence, regexes, config);
+
+        Digestion::const_iterator itr = digestion.begin(), regexItr = regexDigestion.begin();
+        for (; itr != digestion.end() && regexItr != regexDigestion.end(); ++itr, ++regexItr)
+        {
+            unit_assert_operator_equal(regexItr->sequence(), itr->sequence());
+            unit_assert_operator_equal(regexItr->offset(), itr->offset());
+            unit_assert_operator_equal(regexItr->missedCleavages(), itr->missedCleavages());
+            unit_assert_operator_equal(regexItr->NTerminusIsSpecific(), itr->NTerminusIsSpecific());
+            unit_assert_operator_equal(regexItr->CTerminusIsSpecific(), itr->CTerminusIsSpecific());
+        }
+        unit_assert(itr == digestion.end());
+        unit_assert(regexItr == regexDigestion.end());
+    }
+}
+
+
+// the cleavage rule tables give the same peptides as searching for the regexes
+void testRuleTables()
+{
+    if (os_) *os_ << "rule table test" << endl;
+
+    const char* sequences[] =
+    {
+        "MKWVTFISLLLLFSSAYSRGVFRRDTHKSEIAHRFKDLGEEHFKGLVLIAFSQYLQQCPFDEHVKLVNELTEFAKTCVADESHAGCEKSLHTLFGDELCKXVASLRETYGDMADCCEKQEP",
+        "DDKPRPEEDNDBZQWWMPKKRRPPFFYYLLDE",
+        "KPEPTIDEKRPEPTIDERDXDEEDDKR",
+        "D", "K", "PK", "KP"
+    };
+
+    // a trailing empty group keeps a regex from being compiled to a table
+    BOOST_FOREACH(const char* sequence, sequences)
+    BOOST_FOREACH(CVID agentCvid, Digestion::getCleavageAgents())
+    {
+        if (agentCvid == MS_unspecific_cleavage || agentCvid == MS_no_cleavage)
+            continue;
+
+        if (os_) *os_ << cvTermInfo(agentCvid).name << " " << sequence << endl;
+        vector<string> regex(1, Digestion::disambiguateCleavageAgentRegex(Digestion::getCleavageAgentRegex(agentCvid)) + "(?:)");
+        testRuleTableDigestion(sequence, vector<CVID>(1, agentCvid), regex);
+    }
+
+    // merged agents, merged the same way Digestion merges them
+    vector<CVID> merged;
+    merged.push_back(MS_Lys_C);
+    merged.push_back(MS_Arg_C);
+    merged.push_back(MS_Chymotrypsin);
+    for (size_t i=0; i < 2; ++i, merged.back() = MS_Asp_N)
+    {
+        string mergedRegex;
+        BOOST_FOREACH(CVID agentCvid, merged)
+            mergedRegex += (mergedRegex.empty() ? "((" : ")|(") + Digestion::disambiguateCleavageAgentRegex(Digestion::getCleavageAgentRegex(agentCvid));
+        mergedRegex += "(?:)))";
+
+        BOOST_FOREACH(const char* sequence, sequences)
+            testRuleTableDigestion(sequence, merged, vector<string>(1, mergedRegex));
+    }
+}
+
+
 void testFind()
 {
     Digestion fully("PEPKTIDEKPEPTIDERPEPKTIDEKKKPEPTIDER", MS_Lys_C_P, Digestion::Config(2, 5, 10));
@@ -642,6 +747,8 @@ void testThreadSafetyWorker(boost::barrier* testBarrier, ThreadStatus& status)
     {
         testCleavageAgents();
         testBSADigestion();
+        testRecords();
+        testRuleTables();
         testFind();
     }
     catch (exception& e)
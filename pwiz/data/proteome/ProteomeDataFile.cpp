@@ -30,6 +30,7 @@
 #include "DefaultReaderList.hpp"
 #include "pwiz/utility/misc/Filesystem.hpp"
 #include "pwiz/utility/misc/Std.hpp"
+#include "pwiz/utility/misc/block_gzip_compressor.hpp"
 #include "pwiz/data/common/BinaryIndexStream.hpp"
 #include "boost/iostreams/device/file.hpp"
 #include "boost/iostreams/filtering_stream.hpp" 
@@ -50,7 +51,7 @@ namespace {
 
 void readFile(const string& uri, ProteomeData& pd, const Reader& reader)
 {
-    shared_ptr<istream> uriStreamPtr(new random_access_compressed_ifstream(uri.c_str()));
+    shared_ptr<istream> uriStreamPtr(new random_access_compressed_ifstream(uri.c_str(), true));
     if (!reader.accept(uri, uriStreamPtr))
         throw runtime_error("[ProteomeDataFile::readFile()] Unsupported file format.");
 
@@ -85,7 +86,7 @@ void ProteomeDataFile::write(const string& uri,
 namespace {
 
 
-shared_ptr<ostream> openFile(const string& uri, bool gzipped)
+shared_ptr<ostream> openFile(const string& uri, bool gzipped, bool blockGzipped)
 {
     if (gzipped)
     {   // use boost's filter stack to count outgoing bytes, and gzip them
@@ -94,7 +95,10 @@ shared_ptr<ostream> openFile(const string& uri, bool gzipped)
         if (filt)
         {
             //filt->push(pwiz::minimxml::charcounter()); // for counting bytes before compression
-            filt->push(bio::gzip_compressor(9)); // max compression
+            if (blockGzipped)
+                filt->push(block_gzip_compressor(9)); // max compression, in parallel
+            else
+                filt->push(bio::gzip_compressor(9)); // max compression
             filt->push(bio::file_sink(uri, ios::binary));
         }
         if (!result.get() || !*result || !filt->good())
@@ -121,7 +125,7 @@ void ProteomeDataFile::write(const ProteomeData& pd,
                              const WriteConfig& config,
                              const IterationListenerRegistry* iterationListenerRegistry)
 {
-    shared_ptr<ostream> os = openFile(uri, config.gzipped);
+    shared_ptr<ostream> os = openFile(uri, config.gzipped, config.blockGzipped);
     
     switch (config.format)
     {
@@ -54,9 +54,10 @@ struct PWIZ_API_DECL ProteomeDataFile : public ProteomeData
         Format format;
         bool indexed;
 		bool gzipped; // if true, file is written as .gz
+        bool blockGzipped; // if true (with gzipped), the .gz is independent blocks, compressed in parallel and seekable without a decompression pass
 
         WriteConfig(Format _format = Format_FASTA, bool _gzipped = false)
-        :   format(_format), indexed(true), gzipped(_gzipped)
+        :   format(_format), indexed(true), gzipped(_gzipped), blockGzipped(false)
         {}
     };
 
@@ -25,6 +25,7 @@
 #include "Diff.hpp"
 #include "examples.hpp"
 #include "Reader_FASTA.hpp"
+#include "Serializer_FASTA.hpp"
 #include "pwiz/utility/misc/unit.hpp"
 #include "pwiz/utility/misc/Filesystem.hpp"
 #include "pwiz/utility/misc/Std.hpp"
@@ -135,6 +136,83 @@ void test()
 }
 
 
+// a file big enough to be indexed in several pieces
+string largeFileText(const string& firstDescription)
+{
+    ostringstream oss;
+    for (size_t i=0; i < 40000; ++i)
+    {
+        const char* newline = i % 3 == 0 ? "\r\n" : "\n";
+        oss << ">PROT" << i << " ";
+        if (i == 0) oss << firstDescription; else oss << "protein " << i << " -> " << (i * 7) % 13;
+        oss << newline;
+        for (size_t j=0; j < 1 + i % 4; ++j)
+            oss << string(60, "ACDEFGHIKLMNPQRSTVWY"[(i + j) % 20]) << newline;
+        if (i % 5 == 0)
+            oss << newline; // blank lines are skipped
+    }
+    return oss.str();
+}
+
+
+// the file read from the memory mapping is compared to reading the same text from a stream
+void testLargeFile(const string& filename, const string& text, bool indexed)
+{
+    Reader_FASTA::Config config;
+    config.indexed = indexed;
+    Reader_FASTA reader(config);
+    ProteomeDataFile mapped(filename, reader);
+
+    ProteomeData streamed;
+    Serializer_FASTA().read(shared_ptr<istream>(new istringstream(text)), streamed);
+
+    const ProteinList& mappedList = *mapped.proteinListPtr;
+    const ProteinList& streamedList = *streamed.proteinListPtr;
+    unit_assert_operator_equal(40000, mappedList.size());
+    unit_assert_operator_equal(streamedList.size(), mappedList.size());
+    for (size_t i=0; i < mappedList.size(); ++i)
+    {
+        ProteinPtr p1 = mappedList.protein(i);
+        ProteinPtr p2 = streamedList.protein(i);
+        unit_assert_operator_equal(p2->id, p1->id);
+        unit_assert_operator_equal(p2->description, p1->description);
+        unit_assert_operator_equal(p2->sequence(), p1->sequence());
+        unit_assert_operator_equal(i, mappedList.find(p1->id));
+    }
+    unit_assert_operator_equal("protein 39999 -> 12", mappedList.protein(39999)->description);
+    unit_assert(mappedList.protein(1234, false)->sequence().empty());
+}
+
+
+void testLargeFile(bool indexed)
+{
+    if (os_) *os_ << "testLargeFile()" << (indexed ? " indexed" : "") << endl;
+
+    string filename = filenameBase_ + ".large.fasta";
+    string text = largeFileText("protein 0 -> 0");
+    ofstream(filename.c_str(), ios::binary) << text;
+
+    testLargeFile(filename, text, indexed);
+
+    if (indexed)
+    {
+        // the index written by the first read is read from its memory mapping
+        unit_assert(bfs::file_size(filename + ".index") > 0);
+        testLargeFile(filename, text, indexed);
+
+        // a longer first description moves every other entry, so the mapped index is stale:
+        // it's recreated and written back to the index file
+        text = largeFileText("protein 0 -> 0 with a longer description");
+        ofstream(filename.c_str(), ios::binary) << text;
+        testLargeFile(filename, text, indexed);
+        testLargeFile(filename, text, indexed);
+    }
+
+    bfs::remove(filename);
+    if (bfs::exists(filename + ".index")) bfs::remove(filename + ".index");
+}
+
+
 class TestReader : public Reader
 {
     public:
@@ -199,6 +277,8 @@ int main(int argc, char* argv[])
     {
         if (argc>1 && !strcmp(argv[1],"-v")) os_ = &cout;
         test();
+        testLargeFile(false);
+        testLargeFile(true);
         testReader();
     }
     catch (exception& e)
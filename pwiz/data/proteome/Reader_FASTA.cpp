@@ -25,9 +25,13 @@
 #include "Reader_FASTA.hpp"
 #include "Serializer_FASTA.hpp"
 #include "pwiz/data/common/BinaryIndexStream.hpp"
+#include "pwiz/data/common/MemoryIndex.hpp"
 #include "pwiz/utility/misc/Filesystem.hpp"
+#include "pwiz/utility/misc/memory_streambuf.hpp"
 #include "pwiz/utility/misc/Std.hpp"
-#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/shared_mutex.hpp>
 
 
 using namespace pwiz::util;
@@ -37,6 +41,76 @@ namespace pwiz {
 namespace proteome {
 
 
+namespace {
+
+// a read-only iostream over a memory-mapped file; the mapping lives as long as the stream
+class mapped_iostream : public iostream
+{
+    public:
+
+    mapped_iostream(const string& path)
+    :   iostream(0), file_(path), buf_(file_.data(), file_.data() + file_.size())
+    {
+        rdbuf(&buf_);
+    }
+
+    private:
+    bio::mapped_file_source file_;
+    memory_streambuf buf_;
+};
+
+// a BinaryIndexStream read straight from the memory-mapped index file instead of a copy of it;
+// if the index is stale and has to be recreated, the mapping is released and the new index is
+// written to the file (or kept in memory if the file can't be written)
+class MappedBinaryIndex : public data::Index
+{
+    public:
+
+    MappedBinaryIndex(const string& indexPath)
+    :   indexPath_(indexPath),
+        indexPtr_(new data::BinaryIndexStream(shared_ptr<iostream>(new mapped_iostream(indexPath))))
+    {}
+
+    virtual void create(vector<Entry>& entries)
+    {
+        boost::unique_lock<boost::shared_mutex> lock(mutex_);
+        indexPtr_.reset();
+
+        shared_ptr<iostream> isPtr(new fstream(indexPath_.c_str(), ios::in | ios::out | ios::binary));
+        if (*isPtr)
+            indexPtr_.reset(new data::BinaryIndexStream(isPtr));
+        else
+            indexPtr_.reset(new data::MemoryIndex);
+        indexPtr_->create(entries);
+    }
+
+    virtual size_t size() const
+    {
+        boost::shared_lock<boost::shared_mutex> lock(mutex_);
+        return indexPtr_->size();
+    }
+
+    virtual EntryPtr find(const string& id) const
+    {
+        boost::shared_lock<boost::shared_mutex> lock(mutex_);
+        return indexPtr_->find(id);
+    }
+
+    virtual EntryPtr find(size_t index) const
+    {
+        boost::shared_lock<boost::shared_mutex> lock(mutex_);
+        return indexPtr_->find(index);
+    }
+
+    private:
+    string indexPath_;
+    data::IndexPtr indexPtr_;
+    mutable boost::shared_mutex mutex_;
+};
+
+} // namespace
+
+
 //
 // Reader_FASTA
 //
@@ -87,18 +161,28 @@ PWIZ_API_DECL void Reader_FASTA::read(const std::string& uri, shared_ptr<istream
     if (config_.indexed) // override default MemoryIndex with a BinaryIndexStream
     {
         {ofstream((uri + ".index").c_str(), ios::app);} // make sure the file exists
-        shared_ptr<iostream> isPtr(new fstream((uri + ".index").c_str(), ios::in | ios::out | ios::binary));
 
-        // indexes smaller than 200mb are loaded entirely into memory
-        boost::uintmax_t indexSize = bfs::file_size(uri + ".index");
-        if (indexSize > 0 && indexSize < 200000000)
-        {
-            stringstream* indexFileStream = new stringstream();
-            bio::copy(*isPtr, *indexFileStream);
-            isPtr.reset(indexFileStream);
-        }
+        // an existing index is read from its memory mapping, which costs neither a copy of the index
+        // nor a seek and read through the file for each lookup
+        data::IndexPtr mappedIndexPtr;
+        boost::system::error_code ec;
+        if (bfs::file_size(uri + ".index", ec) > 0 && !ec)
+            try
+            {
+                mappedIndexPtr.reset(new MappedBinaryIndex(uri + ".index"));
+            }
+            catch (std::ios_base::failure&)
+            {
+                // the index couldn't be mapped: read it through the file stream
+            }
+
+        shared_ptr<iostream> isPtr;
+        if (!mappedIndexPtr)
+            isPtr.reset(new fstream((uri + ".index").c_str(), ios::in | ios::out | ios::binary));
 
-        if (!*isPtr) // stream is unavailable or read only
+        if (mappedIndexPtr) // a stale index is rewritten (or kept in memory if read only) when it's recreated
+            config.indexPtr = mappedIndexPtr;
+        else if (!*isPtr) // stream is unavailable or read only
         {
             isPtr.reset(new fstream((uri + ".index").c_str(), ios::in | ios::binary));
             bool canOpenReadOnly = !!*isPtr;
@@ -24,8 +24,10 @@
 
 #include "Serializer_FASTA.hpp"
 #include "pwiz/data/common/Index.hpp"
+#include "pwiz/utility/misc/random_access_compressed_ifstream.hpp"
 #include "pwiz/utility/misc/Std.hpp"
 #include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
 #include <boost/thread/mutex.hpp>
 #include <boost/xpressive/xpressive_dynamic.hpp>
 
@@ -52,19 +54,35 @@ class ProteinList_FASTA : public ProteinList
 
     vector<bxp::sregex> idAndDescriptionRegexes_;
 
+    // when the stream is a memory-mapped file, entries are found and read straight from the mapping,
+    // without seeking the stream or holding io_mutex
+    const char* data_;
+    size_t dataSize_;
+
     mutable boost::mutex io_mutex;
 
-    void createIndex()
+    string parseId(string& buf) const
+    {
+        bal::trim_right_if(buf, bal::is_any_of(" \r"));
+
+        BOOST_FOREACH(const bxp::sregex& idAndDescriptionRegex, idAndDescriptionRegexes_)
+        {
+            bxp::smatch match;
+            if (bxp::regex_match(buf, match, idAndDescriptionRegex))
+                return match[1].str();
+        }
+
+        throw runtime_error("[ProteinList_FASTA::createIndex] could not parse id from entry \"" + buf + "\"");
+    }
+
+    // find offsets for all entries in the FASTA stream
+    void findEntries(vector<Index::Entry>& entries) const
     {
         fsPtr_->clear();
         fsPtr_->seekg(0);
 
         string buf;
 
-        // find offsets for all entries in the FASTA stream
-        deque<Index::Entry> index;
-        set<string> idSet;
-
         Index::stream_offset indexOffset = 0;
         while (getline(*fsPtr_, buf))
         {
@@ -74,46 +92,204 @@ class ProteinList_FASTA : public ProteinList
             if (buf.empty())
                 continue;
 
-			if (buf[0] == '>') // signifies a new protein record in a FASTA file
-			{
-                index.push_back(Index::Entry());
-                Index::Entry& ie = index.back();
+            if (buf[0] == '>') // signifies a new protein record in a FASTA file
+            {
+                entries.push_back(Index::Entry());
+                Index::Entry& ie = entries.back();
+                ie.id = parseId(buf);
+                ie.offset = indexOffset - bufLength;
+            }
+        }
+    }
 
-                bal::trim_right_if(buf, bal::is_any_of(" \r"));
+    // find the entries whose header lines start in [begin, end) of the mapped file;
+    // only '>' at the start of a line begins a record, so the sequence lines are skipped by memchr
+    void findMappedEntries(size_t begin, size_t end, vector<Index::Entry>* entries, string* error) const
+    {
+        try
+        {
+            string buf;
+            size_t position = begin;
+            while (position < end)
+            {
+                const char* header = static_cast<const char*>(memchr(data_ + position, '>', end - position));
+                if (!header)
+                    break;
 
-                BOOST_FOREACH(bxp::sregex& idAndDescriptionRegex, idAndDescriptionRegexes_)
+                position = header - data_;
+                if (position > 0 && data_[position-1] != '\n')
                 {
-                    bxp::smatch match;
-                    if (bxp::regex_match(buf, match, idAndDescriptionRegex))
-                    {
-                        ie.id = match[1].str();
-                        break;
-                    }
+                    ++position; // a '>' in a description
+                    continue;
                 }
 
-                if (ie.id.empty())
-                    throw runtime_error("[ProteinList_FASTA::createIndex] could not parse id from entry \"" + buf + "\"");
+                const char* lineEnd = static_cast<const char*>(memchr(header, '\n', dataSize_ - position));
+                if (!lineEnd)
+                    lineEnd = data_ + dataSize_;
+                buf.assign(header, lineEnd);
 
-                // note: We could silently skip the duplicates, but that would only be
-                //       reasonable after checking that the sequences are equal.
-                if (!idSet.insert(ie.id).second)
-                    throw runtime_error("[ProteinList_FASTA::createIndex] duplicate protein id \"" + ie.id + "\"");
+                entries->push_back(Index::Entry());
+                Index::Entry& ie = entries->back();
+                ie.id = parseId(buf);
+                ie.offset = position;
 
-                ie.index = index.size()-1;
-                ie.offset = indexOffset - bufLength;
-			}
-		}
+                position = lineEnd - data_ + 1;
+            }
+        }
+        catch (exception& e)
+        {
+            *error = e.what();
+        }
+    }
+
+    // the file is split into pieces of at least 1 MB, which are searched in parallel
+    void findMappedEntries(vector<Index::Entry>& entries) const
+    {
+        size_t threadCount = max(1u, boost::thread::hardware_concurrency());
+        threadCount = min(threadCount, dataSize_ / (1 << 20) + 1);
+
+        vector<vector<Index::Entry> > pieceEntries(threadCount);
+        vector<string> errors(threadCount);
+        if (threadCount == 1)
+            findMappedEntries(0, dataSize_, &pieceEntries[0], &errors[0]);
+        else
+        {
+            boost::thread_group threads;
+            for (size_t i=0; i < threadCount; ++i)
+                threads.create_thread(boost::bind(&ProteinList_FASTA::findMappedEntries, this,
+                                                  dataSize_ / threadCount * i,
+                                                  i + 1 < threadCount ? dataSize_ / threadCount * (i + 1) : dataSize_,
+                                                  &pieceEntries[i], &errors[i]));
+            threads.join_all();
+        }
+
+        for (size_t i=0; i < threadCount; ++i)
+        {
+            if (!errors[i].empty())
+                throw runtime_error(errors[i]);
+            entries.insert(entries.end(), pieceEntries[i].begin(), pieceEntries[i].end());
+            vector<Index::Entry>().swap(pieceEntries[i]);
+        }
+    }
+
+    void createIndex()
+    {
+        vector<Index::Entry> index;
+        if (data_)
+            findMappedEntries(index);
+        else
+            findEntries(index);
+
+        set<string> idSet;
+        for (size_t i=0; i < index.size(); ++i)
+        {
+            Index::Entry& ie = index[i];
+
+            // note: We could silently skip the duplicates, but that would only be
+            //       reasonable after checking that the sequences are equal.
+            if (!idSet.insert(ie.id).second)
+                throw runtime_error("[ProteinList_FASTA::createIndex] duplicate protein id \"" + ie.id + "\"");
+
+            ie.index = i;
+        }
 
         idSet.clear();
-        vector<Index::Entry> tmp(index.begin(), index.end());
-        indexPtr_->create(tmp);
+        indexPtr_->create(index);
+    }
+
+    bool isMappedHeader(Index::stream_offset offset) const
+    {
+        return offset >= 0 && (size_t) offset < dataSize_ && data_[offset] == '>' &&
+               (offset == 0 || data_[offset-1] == '\n');
+    }
+
+    string parseDescription(string& buf) const
+    {
+        // trim whitespace and carriage returns from the end of the line
+        bal::trim_right_if(buf, bal::is_any_of(" \r"));
+
+        BOOST_FOREACH(const bxp::sregex& idAndDescriptionRegex, idAndDescriptionRegexes_)
+        {
+            if (idAndDescriptionRegex.mark_count() == 2)
+            {
+                bxp::smatch match;
+                if (bxp::regex_match(buf, match, idAndDescriptionRegex))
+                    return match[2].str();
+                //else
+                    // TODO: exception is too harsh, log warning if none of the regexes match
+            }
+        }
+        return string();
+    }
+
+    ProteinPtr mappedProtein(size_t index, Index::EntryPtr entryPtr, bool getSequence) const
+    {
+        // test that the index offset is valid
+        if (!isMappedHeader(entryPtr->offset))
+        {
+            boost::mutex::scoped_lock io_lock(io_mutex);
+
+            // another thread may have recreated the index already
+            entryPtr = indexPtr_->find(index);
+            if (!entryPtr.get())
+                throw out_of_range("[ProteinList_FASTA::protein] Index out of range");
+
+            if (!isMappedHeader(entryPtr->offset))
+            {
+                // TODO: log notice about stale index
+
+                // recreate the index
+                const_cast<ProteinList_FASTA&>(*this).createIndex();
+
+                entryPtr = indexPtr_->find(index);
+
+                if (!entryPtr.get())
+                    throw out_of_range("[ProteinList_FASTA::protein] Index out of range");
+
+                // if the offset is still invalid, throw
+                if (!isMappedHeader(entryPtr->offset))
+                    throw runtime_error("[ProteinList_FASTA::protein] Invalid index offset");
+            }
+        }
+
+        const char* end = data_ + dataSize_;
+        const char* header = data_ + entryPtr->offset;
+        const char* lineEnd = static_cast<const char*>(memchr(header, '\n', end - header));
+        if (!lineEnd)
+            lineEnd = end;
+
+        string buf(header, lineEnd);
+        string description = parseDescription(buf);
+
+        string sequence;
+        if (getSequence)
+        {
+            const char* line = lineEnd + (lineEnd < end ? 1 : 0);
+            while (line < end && *line != '>') // '>' signifies the next protein record in a FASTA file
+            {
+                lineEnd = static_cast<const char*>(memchr(line, '\n', end - line));
+                if (!lineEnd)
+                    lineEnd = end;
+                const char* cr = static_cast<const char*>(memchr(line, '\r', lineEnd - line));
+                sequence.append(line, cr ? cr : lineEnd);
+                line = lineEnd + (lineEnd < end ? 1 : 0);
+            }
+        }
+        return ProteinPtr(new Protein(entryPtr->id, index, description, sequence));
     }
 
     public:
 
     ProteinList_FASTA(shared_ptr<istream> fsPtr, IndexPtr indexPtr, const vector<string>& idAndDescriptionRegexes)
-        : fsPtr_(fsPtr), indexPtr_(indexPtr)
+        : fsPtr_(fsPtr), indexPtr_(indexPtr), data_(0), dataSize_(0)
     {
+        random_access_compressed_ifstream* mappedStream = dynamic_cast<random_access_compressed_ifstream*>(fsPtr.get());
+        if (mappedStream && mappedStream->mapped_data())
+        {
+            data_ = mappedStream->mapped_data();
+            dataSize_ = (size_t) mappedStream->mapped_size();
+        }
+
         BOOST_FOREACH(const string& regexString, idAndDescriptionRegexes)
         {
             bxp::sregex idAndDescriptionRegex = bxp::sregex::compile(regexString);
@@ -149,6 +325,9 @@ class ProteinList_FASTA : public ProteinList
         if (!entryPtr.get())
             throw out_of_range("[ProteinList_FASTA::protein] Index out of range");
 
+        if (data_)
+            return mappedProtein(index, entryPtr, getSequence);
+
         boost::mutex::scoped_lock io_lock(io_mutex);
 
         fsPtr_->clear();
@@ -181,24 +360,7 @@ class ProteinList_FASTA : public ProteinList
                 throw runtime_error("[ProteinList_FASTA::protein] Invalid index offset");
         }
 
-        // trim whitespace and carriage returns from the end of the line
-        bal::trim_right_if(buf, bal::is_any_of(" \r"));
-
-        string description;
-        BOOST_FOREACH(const bxp::sregex& idAndDescriptionRegex, idAndDescriptionRegexes_)
-        {
-            if (idAndDescriptionRegex.mark_count() == 2)
-            {
-                bxp::smatch match;
-                if (bxp::regex_match(buf, match, idAndDescriptionRegex))
-                {
-                    description = match[2].str();
-                    break;
-                }
-                //else
-                    // TODO: exception is too harsh, log warning if none of the regexes match
-            }
-        }
+        string description = parseDescription(buf);
 
         string sequence;
         if (getSequence)
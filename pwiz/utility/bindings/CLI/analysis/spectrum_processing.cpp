@@ -443,6 +443,13 @@ ChromatogramList_XICGenerator::ChromatogramList_XICGenerator(msdata::Chromatogra
     msdata::ChromatogramList::base_ = new boost::shared_ptr<pwiz::msdata::ChromatogramList>(base_);
 }
 
+ChromatogramList_XICGenerator::ChromatogramList_XICGenerator(msdata::ChromatogramList^ inner, msdata::SpectrumList^ spectra)
+    : msdata::ChromatogramList(0)
+{
+    base_ = new b::ChromatogramList_XICGenerator(*inner->base_, *spectra->base_);
+    msdata::ChromatogramList::base_ = new boost::shared_ptr<pwiz::msdata::ChromatogramList>(base_);
+}
+
 msdata::Chromatogram^ ChromatogramList_XICGenerator::xic(double startTime, double endTime, System::Collections::Generic::IEnumerable<ContinuousInterval>^ massRanges, int msLevel)
 {
     boost::icl::interval_set<double> massRangesSet;
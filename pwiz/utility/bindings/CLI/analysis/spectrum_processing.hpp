@@ -415,6 +415,11 @@ public ref class ChromatogramList_XICGenerator : public msdata::ChromatogramList
 
     ChromatogramList_XICGenerator(msdata::ChromatogramList^ inner);
 
+    /// <summary>
+    /// unless inner is a ChromatogramList_Thermo, xic() reads the spectra of each MS level into an index the first time it is called for that MS level
+    /// </summary>
+    ChromatogramList_XICGenerator(msdata::ChromatogramList^ inner, msdata::SpectrumList^ spectra);
+
     virtual msdata::Chromatogram^ xic(double startTime, double endTime, System::Collections::Generic::IEnumerable<ContinuousInterval>^ massRanges, int msLevel);
 
     /// <summary>
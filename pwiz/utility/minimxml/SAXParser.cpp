@@ -30,6 +30,14 @@
 #include "pwiz/utility/misc/random_access_compressed_ifstream.hpp"
 #include "boost/xpressive/xpressive_dynamic.hpp"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PWIZ_SAXPARSER_SSE2
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
 
 namespace bxp = boost::xpressive;
 
@@ -65,18 +73,6 @@ size_t count_trail_ws(const char *data,size_t len)
 
 namespace {
 
-inline bool unbalanced_quotes(const saxstring & buffer) 
-{
-    // find next single or double quote
-    for (const char *c=buffer.c_str();(c=strpbrk(c,"\"'"))!=NULL;c++) 
-    {
-        c = strchr(c+1,*c); // find matching quote
-        if (!c) 
-            return true; // unmatched quote
-    }
-    return false;
-}
-
 // returns number of ws chars it had to eat on front end
 // returns -1 if nothing read
 static int eat_whitespace(istream& is) 
@@ -261,6 +257,268 @@ class HandlerWrangler : public SAXParser::Handler
 };
 
 
+inline bool is_ws(char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+
+// returns the first of a, b or c in [p, end), or end if there isn't one
+inline const char* find_first_of(const char* p, const char* end, char a, char b, char c)
+{
+#ifdef PWIZ_SAXPARSER_SSE2
+    const __m128i va = _mm_set1_epi8(a), vb = _mm_set1_epi8(b), vc = _mm_set1_epi8(c);
+    for (; end - p >= 16; p += 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i matches = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, va), _mm_cmpeq_epi8(block, vb)),
+                                       _mm_cmpeq_epi8(block, vc));
+        int mask = _mm_movemask_epi8(matches);
+        if (mask)
+        {
+#ifdef _MSC_VER
+            unsigned long first;
+            _BitScanForward(&first, mask);
+            return p + first;
+#else
+            return p + __builtin_ctz(mask);
+#endif
+        }
+    }
+#endif
+    for (; p < end; ++p)
+        if (*p == a || *p == b || *p == c)
+            return p;
+    return end;
+}
+
+
+//
+// InputBuffer reads the stream a block at a time, so the parser can scan for
+// delimiters with memchr or SIMD instead of reading a tag at a time with
+// istream::get(); indexes are relative to the unconsumed input and stay
+// valid when fill() reads more
+//
+// Streams that can't seek back (or whose positions don't count characters,
+// like text mode files on Windows) are still read a tag at a time, up to the
+// delimiter the parser is looking for, so a handler returning Done leaves the
+// stream just after the last parsed tag and positions come from tellg()
+//
+class InputBuffer
+{
+    public:
+
+    static const size_t npos = size_t(-1);
+
+    InputBuffer(istream& is)
+    :   is_(is), begin_(0), end_(0), eof_(!is)
+    {
+        streampos start = is.tellg();
+        seekable_ = blockwise_ = start != streampos(-1);
+        offset_ = seekable_ ? boost::iostreams::position_to_offset(start) : 0;
+        buffer_.resize(minRead_);
+    }
+
+    const char* data() const {return &buffer_[0] + begin_;}
+    size_t size() const {return end_ - begin_;}
+
+    /// returns the stream offset of index (-1 if the stream doesn't have positions)
+    Handler::stream_offset offset(size_t index) const {return seekable_ ? offset_ + begin_ + index : -1;}
+
+    void consume(size_t count) {begin_ += count;}
+
+    /// reads more input (a tag at a time: up to and including delim); returns false at the end of the stream
+    bool fill(char delim)
+    {
+        if (eof_)
+            return false;
+
+        if (begin_ > 0)
+        {
+            memmove(&buffer_[0], &buffer_[begin_], end_ - begin_);
+            offset_ += begin_;
+            end_ -= begin_;
+            begin_ = 0;
+        }
+
+        if (buffer_.size() - end_ < minRead_)
+            buffer_.resize(max(buffer_.size() * 2, end_ + minRead_));
+
+        if (!blockwise_)
+            return fillTo(delim);
+
+        // only take what the stream has buffered, so putBack() usually seeks within the stream's buffer
+        char* p = &buffer_[end_];
+        streamsize room = buffer_.size() - end_;
+        streamsize count = is_.readsome(p, room);
+        if (count <= 0)
+        {
+            if (is_.peek() == istream::traits_type::eof())
+            {
+                eof_ = true;
+                return false;
+            }
+            count = is_.readsome(p, room);
+            if (count <= 0)
+            {
+                is_.read(p, 1);
+                count = is_.gcount();
+                if (count <= 0)
+                {
+                    eof_ = true;
+                    return false;
+                }
+            }
+        }
+
+        // if the stream's position doesn't match the characters read, go back and read a tag at a time
+        Handler::stream_offset blockOffset = offset_ + end_;
+        if (is_.tellg() != boost::iostreams::offset_to_position(blockOffset + count))
+        {
+            is_.clear();
+            is_.seekg(boost::iostreams::offset_to_position(blockOffset));
+            blockwise_ = false;
+            return fillTo(delim);
+        }
+
+#ifdef _DEBUG_READCOUNT
+        note_read_count(count); // collect some stats
+#endif
+        end_ += count;
+        return true;
+    }
+
+    /// seeks the stream back to the end of the consumed input, as if it had been read a tag at a time
+    void putBack()
+    {
+        if (!blockwise_ || (begin_ == end_ && !eof_))
+            return;
+        is_.clear();
+        is_.seekg(boost::iostreams::offset_to_position(offset(0)));
+    }
+
+    /// returns the index of the first c at or after from
+    size_t find(char c, size_t from)
+    {
+        while (true)
+        {
+            if (from < size())
+            {
+                const char* found = static_cast<const char*>(memchr(data() + from, c, size() - from));
+                if (found)
+                    return found - data();
+                from = size();
+            }
+            if (!fill(c))
+                return npos;
+        }
+    }
+
+    /// returns the index of the last character of the first occurrence of sequence at or after from
+    size_t findSequenceEnd(const string& sequence, size_t from)
+    {
+        for (size_t i = from + sequence.length() - 1; (i = find(sequence[sequence.length()-1], i)) != npos; ++i)
+            if (!memcmp(data() + i + 1 - sequence.length(), sequence.c_str(), sequence.length()))
+                return i;
+        return npos;
+    }
+
+    /// returns the index of the '>' that ends the tag starting at from, skipping over quoted attribute values
+    size_t findTagEnd(size_t from)
+    {
+        char quote = 0;
+        while (true)
+        {
+            const char* end = data() + size();
+            for (const char* p = data() + from; p < end; ++p)
+            {
+                if (quote)
+                {
+                    p = static_cast<const char*>(memchr(p, quote, end - p));
+                    if (!p)
+                        break;
+                    quote = 0;
+                }
+                else
+                {
+                    p = find_first_of(p, end, '>', '"', '\'');
+                    if (p == end)
+                        break;
+                    if (*p == '>')
+                        return p - data();
+                    quote = *p;
+                }
+            }
+
+            from = size();
+            if (!fill('>'))
+                return npos;
+        }
+    }
+
+    /// returns the index of the first non-whitespace character at or after from (in a tag)
+    size_t skipWhitespace(size_t from)
+    {
+        while ((from < size() || fill('>')) && is_ws(data()[from]))
+            ++from;
+        return from;
+    }
+
+    /// true iff the input at index (in a tag) starts with prefix
+    bool startsWith(size_t index, const string& prefix)
+    {
+        // only read more while what there is matches, so a short tag isn't read past
+        for (size_t i=0; i < prefix.length(); ++i)
+        {
+            if (index + i >= size() && !fill('>'))
+                return false;
+            if (data()[index + i] != prefix[i])
+                return false;
+        }
+        return true;
+    }
+
+    private:
+    istream& is_;
+    vector<char> buffer_;
+    size_t begin_, end_; // the unconsumed input
+    Handler::stream_offset offset_; // of buffer_[0]
+    bool seekable_, blockwise_, eof_;
+
+    // reads up to and including the next delim like istream::get() did, taking the position from the stream
+    bool fillTo(char delim)
+    {
+        if (seekable_ && end_ == 0)
+            offset_ = boost::iostreams::position_to_offset(is_.tellg());
+
+        char* p = &buffer_[end_];
+        streamsize room = buffer_.size() - end_;
+        is_.get(p, room, delim); // reads at most room-1 characters, so the delim still fits
+        streamsize count = is_.gcount();
+        if (!count && !is_.eof())
+            is_.clear(); // nothing before the delim
+        if (is_.peek() == istream::traits_type::to_int_type(delim))
+        {
+            is_.ignore();
+            p[count++] = delim;
+        }
+        if (!count)
+        {
+            eof_ = true;
+            return false;
+        }
+
+#ifdef _DEBUG_READCOUNT
+        note_read_count(count); // collect some stats
+#endif
+        end_ += count;
+        return true;
+    }
+
+    static const size_t minRead_ = 65536;
+};
+
+
 } // namespace
 
 void Handler::Attributes::parseAttributes(string::size_type& index) const
@@ -379,47 +637,6 @@ void unescapeXML(char *str)
     }
 }
 
-// (nearly)zero-copy getline
-static bool getline(istream& is, saxstring &vec, char delim, bool append = false) 
-{
-    const size_t minbuf = 1024;
-    size_t begin = append?vec.length():0;
-    size_t end = begin;
-    while (is.good()) 
-    {
-        if (vec.capacity() < minbuf + (begin+3)) 
-        {
-            size_t newsize = 2* ( vec.capacity() ? vec.capacity() : minbuf );
-            vec.resize(newsize);
-        }
-        char *buffer = &vec[0];
-        // always guarantee room for readahead and nullterm at end of buffer
-        is.get(buffer+begin, vec.capacity()-(begin+3), delim); // keeps delim if read
-        size_t nread = (size_t)is.gcount();
-        if (!nread && !is.eof()) // empty line?
-            is.clear(); // clear the failbit
-        end += nread;
-#ifdef _DEBUG_READCOUNT
-        note_read_count(nread+1); // collect some stats
-#endif
-        // did we stop reading because we hit delimiter?
-        char c=0;
-        is.get(c);
-        if (delim == c) 
-        { // full read
-            vec.resize(end); // so we don't copy more than we need
-            return true;
-        } 
-        else if (c) 
-        { // ran out of room
-            buffer[end++] = c;
-            buffer[end] = 0;
-            begin = end;
-        }
-    }
-    return false;
-}
-
 //
 // parse() responsibilities: 
 // - stream parsing
@@ -430,71 +647,72 @@ static bool getline(istream& is, saxstring &vec, char delim, bool append = false
 //
 PWIZ_API_DECL void parse(istream& is, Handler& handler)
 {
-    using boost::iostreams::position_to_offset;
-
     HandlerWrangler wrangler(handler);
-    Handler::stream_offset position = position_to_offset(is.tellg());
+    InputBuffer input(is);
     saxstring buffer(16384); // hopefully big enough to avoid realloc
 
-    while (is)
+    while (true)
     {
-
-        // read text up to next tag (may be empty)
-        buffer.clear();
-        if (!getline(is, buffer, '<')) break;
-        size_t lead_ws = buffer.trim_lead_ws(); 
-        // remove trailing ws
-        buffer.trim_trail_ws();
-        // position == beginning of characters
-
-        position += lead_ws; 
+        // find text up to next tag (may be empty)
+        size_t tagBegin = input.find('<', 0);
+        if (tagBegin == InputBuffer::npos) break;
 
         // TODO: is it possible to detect when Handler::characters() has been overridden?
         const Handler& topHandler = wrangler.topHandler();
-        if (buffer.length() && topHandler.parseCharacters)
+        const char* text = input.data();
+        size_t textBegin = 0, textEnd = tagBegin;
+
+        // trim whitespace
+        while (textBegin < textEnd && is_ws(text[textBegin])) ++textBegin;
+        while (textEnd > textBegin && is_ws(text[textEnd-1])) --textEnd;
+
+        if (textBegin < textEnd && topHandler.parseCharacters)
         {
+            // position == beginning of characters
+            Handler::stream_offset position = input.offset(textBegin);
+            buffer.assign(text+textBegin, textEnd-textBegin);
+            input.consume(tagBegin+1);
+
             if (topHandler.autoUnescapeCharacters)
                 buffer.unescapeXML();
             Handler::Status status = wrangler.characters(buffer, position);
-            if (status.flag == Handler::Status::Done) return;
+            if (status.flag == Handler::Status::Done) {input.putBack(); return;}
         }
+        else
+            input.consume(tagBegin+1);
 
-        // position == beginning of tag
+        // find the end of the tag
+        size_t nameBegin = input.skipWhitespace(0);
 
-        position = position_to_offset(is.tellg());
+        // position == beginning of tag
+        Handler::stream_offset position = input.offset(0);
         if (position > 0) position--;
 
-        // read tag
-
-        bool inCDATA;
-        buffer.clear();
-
-        while (true)
-        {
-            bool firstpass = (!buffer.length());
-            if (!getline(is,buffer, '>',true))  // append
-                break;
-            if (firstpass) 
-                buffer.trim_lead_ws();
-            inCDATA = buffer.starts_with(CDATA_begin.c_str());
-
-            // If in CDATA, fetch more until the section is ended;
-            // else deal with the unlikely but still legal case
+        size_t tagEnd;
+        bool inCDATA = input.startsWith(nameBegin, CDATA_begin);
+        if (inCDATA)
+            tagEnd = input.findSequenceEnd(CDATA_end + ">", nameBegin + CDATA_begin.length());
+        else if (input.startsWith(nameBegin, comment_begin))
+            tagEnd = input.findSequenceEnd(comment_end + ">", nameBegin + comment_begin.length());
+        else
+            // deal with the unlikely but still legal case
             // <FifthElement leeloo='>Leeloo > mul"-ti-pass'>
             //        You're a monster, Zorg.>I know.
             //     </FifthElement>
-            if (inCDATA ? !buffer.ends_with(CDATA_end.c_str()) :
-                   unbalanced_quotes(buffer)) 
-                buffer += ">"; // put back that char we ate, go for more
-             else 
-                break;
-        }
-        
+            tagEnd = input.findTagEnd(nameBegin);
+
+        if (tagEnd == InputBuffer::npos) break;
+
         // remove trailing ws
-        buffer.trim_trail_ws();
-        if (!buffer.length())
+        const char* tag = input.data() + nameBegin;
+        size_t tagLength = tagEnd - nameBegin;
+        while (tagLength && is_ws(tag[tagLength-1])) --tagLength;
+        if (!tagLength)
             throw runtime_error("[SAXParser::parse()] Empty tag at offset " + lexical_cast<string>(position) + "."); 
 
+        buffer.assign(tag, tagLength);
+        input.consume(tagEnd+1);
+
         // switch on tag type
 
         switch (buffer[0])
@@ -503,13 +721,13 @@ PWIZ_API_DECL void parse(istream& is, Handler& handler)
             {
                 ProcessingInstruction pi(buffer.c_str());
                 Handler::Status status = wrangler.processingInstruction(pi.name, pi.value, position);
-                if (status.flag == Handler::Status::Done) return;
+                if (status.flag == Handler::Status::Done) {input.putBack(); return;}
                 break; 
             }
             case '/':
             {
                 Handler::Status status = wrangler.endElement(buffer.c_str()+1, position);
-                if (status.flag == Handler::Status::Done) return;
+                if (status.flag == Handler::Status::Done) {input.putBack(); return;}
                 break;
             }
             case '!':
@@ -518,7 +736,7 @@ PWIZ_API_DECL void parse(istream& is, Handler& handler)
                 {
                     std::string buf(buffer.c_str());
                     Handler::Status status = wrangler.characters(buf.substr(CDATA_begin.length(), buffer.length()-CDATA_begin.length()-CDATA_end.length()), position);
-                    if (status.flag == Handler::Status::Done) return;
+                    if (status.flag == Handler::Status::Done) {input.putBack(); return;}
                 }
                 else if (!buffer.starts_with(DOCTYPE_begin.c_str()) && (!buffer.starts_with("!--") || !buffer.ends_with("--")))
                     throw runtime_error("[SAXParser::parse()] Illegal comment \"" + string(buffer.c_str()) + "\" at offset " + lexical_cast<string>(position) + ".");
@@ -529,18 +747,15 @@ PWIZ_API_DECL void parse(istream& is, Handler& handler)
                 StartTag tag(buffer, handler.autoUnescapeAttributes);
 
                 Handler::Status status = wrangler.startElement(tag.getName(), tag.attributes, position);
-                if (status.flag == Handler::Status::Done) return;
+                if (status.flag == Handler::Status::Done) {input.putBack(); return;}
                 
                 if (tag.end) 
                 {
                     status = wrangler.endElement(tag.getName(), position);
-                    if (status.flag == Handler::Status::Done) return;
+                    if (status.flag == Handler::Status::Done) {input.putBack(); return;}
                 }
             }
         }
-
-        // position == after tag end
-        position = position_to_offset(is.tellg());
     }
 }
 
@@ -110,6 +110,13 @@ public:
         return *this;
     }
 
+    saxstring & assign(const char *rhs, size_t length) {
+        clear();
+        resize(length);
+        memcpy(data(),rhs,length);
+        return *this;
+    }
+
     saxstring & operator += (const SAXParser::saxstring &rhs) {
         if (rhs.length()) {
             size_t oldsize = length();
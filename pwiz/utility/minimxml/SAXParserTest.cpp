@@ -26,6 +26,7 @@
 #include "pwiz/utility/misc/Std.hpp"
 #include "pwiz/utility/misc/Filesystem.hpp"
 #include <cstring>
+#include <boost/algorithm/string/replace.hpp>
 
 
 using namespace pwiz::util;
@@ -582,6 +583,240 @@ void testSaxParserString()
     unit_assert_operator_equal(xstr3.c_str(),std::string());
 }
 
+struct RecordHandler : public SAXParser::Handler
+{
+    vector<string> values;
+    vector<string> texts;
+    vector<stream_offset> positions;
+
+    RecordHandler() {parseCharacters = true;}
+
+    virtual Status startElement(const string& name, const Attributes& attributes, stream_offset position)
+    {
+        if (name == "record")
+        {
+            values.push_back(string());
+            getAttribute(attributes, "value", values.back());
+            positions.push_back(position);
+        }
+        return Status::Ok;
+    }
+
+    virtual Status characters(const SAXParser::saxstring& text, stream_offset position)
+    {
+        texts.push_back(text.c_str());
+        return Status::Ok;
+    }
+};
+
+
+void testLargeInput()
+{
+    if (os_) *os_ << "testLargeInput()\n";
+
+    // enough records that tags, quoted values and text cross the parser's read blocks
+    ostringstream oss;
+    vector<string> values;
+    vector<size_t> positions;
+    oss << "<?xml version=\"1.0\"?>\n<records>\n";
+    for (int i=0; i < 5000; ++i)
+    {
+        string value = lexical_cast<string>(i) + (i % 7 == 0 ? " > 'quoted' & more" : "");
+        if (i % 1000 == 0) value += string(70000, 'x'); // bigger than a read block
+        values.push_back(value);
+
+        if (i % 100 == 0) oss << "  <!-- a comment with 'quotes' > and -- dashes -->\n";
+        positions.push_back((size_t) oss.tellp() + 2);
+        string escaped = value;
+        boost::replace_all(escaped, "&", "&amp;");
+        oss << "  <record\tvalue=\"" << escaped << "\"\n     >text &lt;" << i << "&gt;</record >\n";
+    }
+    oss << "</records>\n";
+
+    istringstream is(oss.str());
+    RecordHandler handler;
+    parse(is, handler);
+
+    unit_assert_operator_equal(values.size(), handler.values.size());
+    for (size_t i=0; i < values.size(); ++i)
+    {
+        unit_assert_operator_equal(values[i], handler.values[i]);
+        unit_assert_operator_equal(positions[i], (size_t) handler.positions[i]);
+        unit_assert_operator_equal("text <" + lexical_cast<string>(i) + ">", handler.texts[i]);
+    }
+}
+
+
+struct NoCharactersHandler : public SAXParser::Handler
+{
+    int elementCount;
+    int charactersCount;
+
+    NoCharactersHandler() : elementCount(0), charactersCount(0) {parseCharacters = false;}
+
+    virtual Status startElement(const string& name, const Attributes& attributes, stream_offset position)
+    {
+        ++elementCount;
+        return Status::Ok;
+    }
+
+    virtual Status characters(const SAXParser::saxstring& text, stream_offset position)
+    {
+        ++charactersCount;
+        return Status::Ok;
+    }
+};
+
+
+void testNoParseCharacters()
+{
+    if (os_) *os_ << "testNoParseCharacters()\n";
+
+    // text is skipped without being unescaped, so an unknown entity is not an error
+    istringstream is("<a>text<b>more &bogus; text</b>  <c/>tail &lt;</a>");
+    NoCharactersHandler handler;
+    parse(is, handler);
+
+    unit_assert_operator_equal(3, handler.elementCount);
+    unit_assert_operator_equal(0, handler.charactersCount);
+}
+
+
+// reads a string through a one character buffer; with translateCRLF, it reads "\r\n" as "\n"
+// and reports positions in the untranslated string, like a text mode file on Windows;
+// otherwise it can't seek
+class TestStreambuf : public std::streambuf
+{
+    public:
+
+    TestStreambuf(const string& text, bool translateCRLF)
+    :   text_(text), translateCRLF_(translateCRLF), next_(0)
+    {}
+
+    protected:
+
+    virtual int_type underflow()
+    {
+        if (next_ >= text_.length())
+            return traits_type::eof();
+        if (translateCRLF_ && text_[next_] == '\r' && next_ + 1 < text_.length() && text_[next_+1] == '\n')
+            ++next_;
+        c_ = text_[next_++];
+        setg(&c_, &c_, &c_ + 1);
+        return traits_type::to_int_type(c_);
+    }
+
+    virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+    {
+        if (!translateCRLF_ || dir != std::ios_base::cur || off != 0)
+            return pos_type(off_type(-1));
+        return pos_type(off_type(next_ - (egptr() - gptr())));
+    }
+
+    virtual pos_type seekpos(pos_type pos, std::ios_base::openmode which)
+    {
+        if (!translateCRLF_ || off_type(pos) < 0 || size_t(off_type(pos)) > text_.length())
+            return pos_type(off_type(-1));
+        next_ = size_t(off_type(pos));
+        setg(&c_, &c_ + 1, &c_ + 1);
+        return pos;
+    }
+
+    private:
+    string text_;
+    bool translateCRLF_;
+    size_t next_;
+    char c_;
+};
+
+
+// stops after the first element at the top level
+struct TopLevelElementHandler : public SAXParser::Handler
+{
+    int depth;
+    vector<string> names;
+    vector<stream_offset> positions;
+    vector<string> texts;
+
+    TopLevelElementHandler() : depth(0) {parseCharacters = true;}
+
+    virtual Status startElement(const string& name, const Attributes& attributes, stream_offset position)
+    {
+        ++depth;
+        names.push_back(name);
+        positions.push_back(position);
+        return Status::Ok;
+    }
+
+    virtual Status endElement(const string& name, stream_offset position)
+    {
+        return --depth == 0 ? Status::Done : Status::Ok;
+    }
+
+    virtual Status characters(const SAXParser::saxstring& text, stream_offset position)
+    {
+        texts.push_back(text.c_str());
+        return Status::Ok;
+    }
+};
+
+
+void testStreamPositions()
+{
+    if (os_) *os_ << "testStreamPositions()\n";
+
+    const string xml = "<first a='1'>\r\n  <inner>text</inner>\r\n</first>\r\n<second b=\"2\"/>\r\n<third>tail</third>\r\n";
+
+    // a stream that can't seek back is left just after the tag that ended the parse
+    {
+        TestStreambuf buf(xml, false);
+        istream is(&buf);
+
+        TopLevelElementHandler first;
+        parse(is, first);
+        unit_assert_operator_equal(2, first.names.size());
+        unit_assert_operator_equal("first", first.names[0]);
+        unit_assert_operator_equal("inner", first.names[1]);
+        unit_assert_operator_equal(1, first.texts.size());
+        unit_assert_operator_equal("text", first.texts[0]);
+        unit_assert_operator_equal(-1, first.positions[0]); // no positions without tellg()
+
+        TopLevelElementHandler second;
+        parse(is, second);
+        unit_assert_operator_equal(1, second.names.size());
+        unit_assert_operator_equal("second", second.names[0]);
+
+        string rest;
+        getline(is, rest, '\0');
+        unit_assert_operator_equal("\r\n<third>tail</third>\r\n", rest);
+    }
+
+    // positions that don't count the characters read come from the stream, as before
+    {
+        TestStreambuf buf(xml, true);
+        istream is(&buf);
+
+        TopLevelElementHandler first;
+        parse(is, first);
+        unit_assert_operator_equal(2, first.names.size());
+        unit_assert_operator_equal(0, first.positions[0]);
+        unit_assert_operator_equal(xml.find("<inner"), (size_t) first.positions[1]);
+
+        TopLevelElementHandler second;
+        parse(is, second);
+        unit_assert_operator_equal(1, second.names.size());
+        unit_assert_operator_equal(xml.find("<second"), (size_t) second.positions[0]);
+        unit_assert_operator_equal(xml.find("\r\n<third"), (size_t) is.tellg());
+
+        TopLevelElementHandler third;
+        parse(is, third);
+        unit_assert_operator_equal(1, third.names.size());
+        unit_assert_operator_equal(xml.find("<third"), (size_t) third.positions[0]);
+        unit_assert_operator_equal("tail", third.texts[0]);
+    }
+}
+
+
 int main(int argc, char* argv[])
 {
     TEST_PROLOG(argc, argv)
@@ -594,8 +829,11 @@ int main(int argc, char* argv[])
         test();
         testNoAutoUnescape();
         testDone();
+        testStreamPositions();
         testBadXML();
         testNested();
+        testLargeInput();
+        testNoParseCharacters();
         testRootElement();
         testDecoding();
     }
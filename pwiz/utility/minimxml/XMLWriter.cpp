@@ -33,6 +33,8 @@ namespace pwiz {
 namespace minimxml {
 
 
+namespace {
+
 template <typename T>
 struct double12_policy : boost::spirit::karma::real_policies<T>   
 {
@@ -40,10 +42,9 @@ struct double12_policy : boost::spirit::karma::real_policies<T>
     static unsigned int precision(T) { return 12; }
 };
 
-PWIZ_API_DECL void XMLWriter::Attributes::add(const string& name, const double& valueRef)
+// formats value into buffer (256 chars is plenty) and returns the end of the formatted value
+char* formatDouble(char* buffer, double value)
 {
-    double value = valueRef;
-
     // HACK: karma has a stack overflow on subnormal values, so we clamp to normalized values
     if (value > 0)
         value = max(numeric_limits<double>::min(), value);
@@ -53,22 +54,44 @@ PWIZ_API_DECL void XMLWriter::Attributes::add(const string& name, const double&
     using namespace boost::spirit::karma;
     typedef real_generator<double, double12_policy<double> > double12_type;
     static const double12_type double12 = double12_type();
-    char buffer[256];
     char* p = buffer;
     generate(p, double12, value);
-    *p = '\0';
-    push_back(make_pair(name, std::string(&buffer[0], p)));
+    return p;
 }
 
-PWIZ_API_DECL void XMLWriter::Attributes::add(const string& name, const int& value)
+template <typename T>
+char* formatInteger(char* buffer, T value)
+{
+    using namespace boost::spirit::karma;
+    static const int_generator<T> intgen = int_generator<T>();
+    char* p = buffer;
+    generate(p, intgen, value);
+    return p;
+}
+
+template <typename T>
+char* formatUnsigned(char* buffer, T value)
 {
     using namespace boost::spirit::karma;
-    static const int_generator<int> intgen = int_generator<int>();
+    static const uint_generator<T> uintgen = uint_generator<T>();
+    char* p = buffer;
+    generate(p, uintgen, value);
+    return p;
+}
+
+} // namespace
+
+
+PWIZ_API_DECL void XMLWriter::Attributes::add(const string& name, const double& value)
+{
+    char buffer[256];
+    push_back(make_pair(name, std::string(buffer, formatDouble(buffer, value))));
+}
+
+PWIZ_API_DECL void XMLWriter::Attributes::add(const string& name, const int& value)
+{
     char buffer[256];
-    char* p = buffer;
-    generate(p, intgen, value);
-    *p = '\0';
-    push_back(make_pair(name, std::string(&buffer[0], p)));
+    push_back(make_pair(name, std::string(buffer, formatInteger(buffer, value))));
 }
 
 
@@ -77,36 +100,102 @@ class XMLWriter::Impl
     public:
 
     Impl(ostream& os, const Config& config);
+    Impl(string& output, const Config& config);
     void pushStyle(unsigned int flags);
     void popStyle(); 
     void processingInstruction(const string& name, const string& data);
     void startElement(const string& name, 
                       const Attributes& attributes,
                       EmptyElementTag emptyElementTag);
+    void startTag(const boost::string_ref& name);
+    void attribute(const boost::string_ref& name, const boost::string_ref& value);
+    void attribute(const boost::string_ref& name, const char* begin, const char* end); // an unescaped value
+    void endStartTag(EmptyElementTag emptyElementTag);
     void endElement();
     void characters(const string& text, bool autoEscape);
     bio::stream_offset position() const;
     bio::stream_offset positionNext() const;
+    Config fragmentConfig() const;
+    void fragment(const string& xml);
 
     private:
-    ostream& os_;
+    ostream* os_; // null when writing to a string
     Config config_;
-    stack<string> elementStack_;
     stack<unsigned int> styleStack_;
 
-    string indentation() const {return string(elementStack_.size()*config_.indentationStep, ' ');}
-    string indentation(size_t depth) const {return string(depth*config_.indentationStep, ' ');}
+    // names of the open elements; entries past depth_ are kept to reuse their storage
+    vector<string> elementNames_;
+    size_t depth_;
+
+    // output of the current operation is formatted here and then written in one go;
+    // when writing to a string, this is the string itself and the operation's output starts at mark_
+    string ownBuffer_;
+    string* buffer_;
+    size_t mark_;
+
+    size_t attributeCount_; // of the start tag being written
+
+    void appendIndentation() {appendIndentation(depth_);}
+    void appendIndentation(size_t depth) {buffer_->append((config_.initialDepth+depth)*config_.indentationStep, ' ');}
+    size_t indentationSize() const {return (config_.initialDepth+depth_)*config_.indentationStep;}
     bool style(StyleFlag styleFlag) const {return styleStack_.top() & styleFlag ? true : false;}
+
+    // appends the separator before an attribute of the current start tag and its name, up to the opening quote
+    void appendAttributeName(const boost::string_ref& name);
+
+    // sends the buffered output to the observer and the output stream
+    void commit();
+
+    // sends text straight to the observer and the output, after anything buffered
+    void writeThrough(const char* text, size_t length);
 };
 
 
 XMLWriter::Impl::Impl(ostream& os, const Config& config)
-:   os_(os), config_(config)
+:   os_(&os), config_(config), depth_(0), buffer_(&ownBuffer_), mark_(0), attributeCount_(0)
 {
     styleStack_.push(config.initialStyle);
 }
 
 
+XMLWriter::Impl::Impl(string& output, const Config& config)
+:   os_(0), config_(config), depth_(0), buffer_(&output), mark_(output.size()), attributeCount_(0)
+{
+    styleStack_.push(config.initialStyle);
+}
+
+
+void XMLWriter::Impl::commit()
+{
+    if (config_.outputObserver && buffer_->size() > mark_)
+        config_.outputObserver->update(buffer_->data() + mark_, buffer_->size() - mark_);
+
+    if (os_)
+    {
+        os_->write(buffer_->data(), buffer_->size());
+        buffer_->clear();
+    }
+    mark_ = buffer_->size();
+}
+
+
+void XMLWriter::Impl::writeThrough(const char* text, size_t length)
+{
+    commit();
+
+    if (config_.outputObserver)
+        config_.outputObserver->update(text, length);
+
+    if (os_)
+        os_->write(text, length);
+    else
+    {
+        buffer_->append(text, length);
+        mark_ = buffer_->size();
+    }
+}
+
+
 void XMLWriter::Impl::pushStyle(unsigned int flags)
 {
     styleStack_.push(flags);
@@ -123,49 +212,45 @@ void XMLWriter::Impl::popStyle()
 
 void XMLWriter::Impl::processingInstruction(const string& name, const string& data) 
 {
-    ostream* os = &os_;
-    if (config_.outputObserver) os = new ostringstream;
-
-    *os << indentation() << "<?" << name << " " << data << "?>\n"; 
-
-    if (config_.outputObserver)
-    {
-        config_.outputObserver->update(static_cast<ostringstream*>(os)->str());
-        os_ << static_cast<ostringstream*>(os)->str();
-        delete os;
-    }
+    appendIndentation();
+    *buffer_ += "<?";
+    *buffer_ += name;
+    *buffer_ += ' ';
+    *buffer_ += data;
+    *buffer_ += "?>\n";
+    commit();
 }
 
 
-void writeEscapedAttributeXML(ostream& os, const string& str)
+void appendEscapedAttributeXML(string& buffer, const boost::string_ref& str)
 {
     for (size_t i=0, end=str.size(); i < end; ++i)
     {
         const char& c = str[i];
         switch (c)
         {
-            case '&': os << "&amp;"; break;
-            case '"': os << "&quot;"; break;
-            case '\'': os << "&apos;"; break;
-            case '<': os << "&lt;"; break;
-            case '>': os << "&gt;"; break;
-            default: os << c; break;
+            case '&': buffer += "&amp;"; break;
+            case '"': buffer += "&quot;"; break;
+            case '\'': buffer += "&apos;"; break;
+            case '<': buffer += "&lt;"; break;
+            case '>': buffer += "&gt;"; break;
+            default: buffer += c; break;
         }
     }
 }
 
 
-void writeEscapedTextXML(ostream& os, const string& str)
+void appendEscapedTextXML(string& buffer, const string& str)
 {
     for (size_t i=0, end=str.size(); i < end; ++i)
     {
         const char& c = str[i];
         switch (c)
         {
-            case '&': os << "&amp;"; break;
-            case '<': os << "&lt;"; break;
-            case '>': os << "&gt;"; break;
-            default: os << c; break;
+            case '&': buffer += "&amp;"; break;
+            case '<': buffer += "&lt;"; break;
+            case '>': buffer += "&gt;"; break;
+            default: buffer += c; break;
         }
     }
 }
@@ -175,106 +260,146 @@ void XMLWriter::Impl::startElement(const string& name,
                   const Attributes& attributes,
                   EmptyElementTag emptyElementTag)
 {
-    ostream* os = &os_;
-    if (config_.outputObserver) os = new ostringstream;
+    startTag(name);
+    for (Attributes::const_iterator it=attributes.begin(); it!=attributes.end(); ++it)
+        attribute(it->first, it->second);
+    endStartTag(emptyElementTag);
+}
+
 
+void XMLWriter::Impl::startTag(const boost::string_ref& name)
+{
     if (!style(StyleFlag_InlineOuter))
-        *os << indentation();
+        appendIndentation();
 
-    *os << "<" << name;
+    *buffer_ += '<';
+    buffer_->append(name.data(), name.size());
 
-    string attributeIndentation(name.size()+1, ' ');
+    // the tag name is kept at the next depth until endStartTag() knows if the element is empty
+    if (depth_ < elementNames_.size())
+        elementNames_[depth_].assign(name.data(), name.size());
+    else
+        elementNames_.push_back(string(name.data(), name.size()));
+    attributeCount_ = 0;
+}
 
-    for (Attributes::const_iterator it=attributes.begin(); it!=attributes.end(); ++it)
+
+void XMLWriter::Impl::appendAttributeName(const boost::string_ref& name)
+{
+    if (attributeCount_++ > 0 && style(StyleFlag_AttributesOnMultipleLines))
     {
-        *os << " " << it->first << "=\"";
-        writeEscapedAttributeXML(*os, it->second);
-        *os << "\"";
-        if (style(StyleFlag_AttributesOnMultipleLines) && (it+1)!=attributes.end())
-            *os << "\n" << indentation() << attributeIndentation;
+        *buffer_ += '\n';
+        appendIndentation();
+        buffer_->append(elementNames_[depth_].size()+1, ' ');
     }
 
-    *os << (emptyElementTag==EmptyElement ? "/>" : ">");
+    *buffer_ += ' ';
+    buffer_->append(name.data(), name.size());
+    *buffer_ += "=\"";
+}
+
+
+void XMLWriter::Impl::attribute(const boost::string_ref& name, const boost::string_ref& value)
+{
+    appendAttributeName(name);
+    appendEscapedAttributeXML(*buffer_, value);
+    *buffer_ += '"';
+}
+
+
+void XMLWriter::Impl::attribute(const boost::string_ref& name, const char* begin, const char* end)
+{
+    appendAttributeName(name);
+    buffer_->append(begin, end);
+    *buffer_ += '"';
+}
+
+
+void XMLWriter::Impl::endStartTag(EmptyElementTag emptyElementTag)
+{
+    *buffer_ += (emptyElementTag==EmptyElement ? "/>" : ">");
 
     if (!style(StyleFlag_InlineInner) || 
         (!style(StyleFlag_InlineOuter) && emptyElementTag==EmptyElement))
-        *os << "\n";
+        *buffer_ += '\n';
 
     if (emptyElementTag == NotEmptyElement)
-        elementStack_.push(name);
+        ++depth_;
 
-    if (config_.outputObserver)
-    {
-        config_.outputObserver->update(static_cast<ostringstream*>(os)->str());
-        os_ << static_cast<ostringstream*>(os)->str();
-        delete os;
-    }
+    commit();
 }
 
 
 void XMLWriter::Impl::endElement()
 {
-    ostream* os = &os_;
-    if (config_.outputObserver) os = new ostringstream;
-
-    if (elementStack_.empty())
+    if (depth_ == 0)
         throw runtime_error("[XMLWriter] Element stack underflow.");
 
+    --depth_;
+
     if (!style(StyleFlag_InlineInner))
-        *os << indentation(elementStack_.size()-1);
+        appendIndentation();
 
-    *os << "</" << elementStack_.top() << ">";
-    elementStack_.pop();
+    *buffer_ += "</";
+    *buffer_ += elementNames_[depth_];
+    *buffer_ += '>';
 
     if (!style(StyleFlag_InlineOuter))
-        *os << "\n";
-        
-    if (config_.outputObserver)
-    {
-        config_.outputObserver->update(static_cast<ostringstream*>(os)->str());
-        os_ << static_cast<ostringstream*>(os)->str();
-        delete os;
-    }
+        *buffer_ += '\n';
+
+    commit();
 }
 
 
 void XMLWriter::Impl::characters(const string& text, bool autoEscape)
 {
-    ostream* os = &os_;
-    if (config_.outputObserver) os = new ostringstream;
-
     if (!style(StyleFlag_InlineInner))
-        *os << indentation();
+        appendIndentation();
 
+    // unescaped text (e.g. base64 binary data) can be large, so it is not copied into the buffer
     if (autoEscape)
-        writeEscapedTextXML(*os, text);
+        appendEscapedTextXML(*buffer_, text);
     else
-        *os << text;
+        writeThrough(text.c_str(), text.size());
 
     if (!style(StyleFlag_InlineInner))
-        *os << "\n";
+        *buffer_ += '\n';
 
-    if (config_.outputObserver)
-    {
-        config_.outputObserver->update(static_cast<ostringstream*>(os)->str());
-        os_ << static_cast<ostringstream*>(os)->str();
-        delete os;
-    }
+    commit();
+}
+
+
+XMLWriter::Config XMLWriter::Impl::fragmentConfig() const
+{
+    Config config;
+    config.initialStyle = styleStack_.top();
+    config.indentationStep = config_.indentationStep;
+    config.initialDepth = config_.initialDepth + depth_;
+    return config;
+}
+
+
+void XMLWriter::Impl::fragment(const string& xml)
+{
+    writeThrough(xml.c_str(), xml.size());
 }
 
 
 XMLWriter::stream_offset XMLWriter::Impl::position() const
 {
-    os_ << flush;
+    if (!os_)
+        return (stream_offset) buffer_->size();
+
+    *os_ << flush;
 	// check to see if we're actually writing to a gzip file 
-	boost::iostreams::filtering_ostream *zipper = dynamic_cast<boost::iostreams::filtering_ostream *>(&os_);
+	boost::iostreams::filtering_ostream *zipper = dynamic_cast<boost::iostreams::filtering_ostream *>(os_);
 	if (zipper) 
 	{  // os_ is actually a boost::iostreams::filtering_ostream with gzip and a counter
 		return zipper->component<0, pwiz::minimxml::charcounter>()->characters();
 	}
 	else
 	{  // OK to do a simple ftellp because seek is implemented, unlike with gzip
-	    return boost::iostreams::position_to_offset(os_.tellp()); 
+	    return boost::iostreams::position_to_offset(os_->tellp()); 
 	}
 }
 
@@ -283,7 +408,7 @@ XMLWriter::stream_offset XMLWriter::Impl::positionNext() const
 {
     stream_offset offset = position(); 
     if (!style(StyleFlag_InlineOuter))
-        offset += indentation().size();
+        offset += indentationSize();
     return offset;
 }
 
@@ -297,6 +422,10 @@ PWIZ_API_DECL XMLWriter::XMLWriter(ostream& os, const Config& config)
 :   impl_(new Impl(os, config))
 {}
 
+PWIZ_API_DECL XMLWriter::XMLWriter(string& output, const Config& config)
+:   impl_(new Impl(output, config))
+{}
+
 PWIZ_API_DECL void XMLWriter::pushStyle(unsigned int flags) {impl_->pushStyle(flags);}
 
 PWIZ_API_DECL void XMLWriter::popStyle() {impl_->popStyle();}
@@ -313,6 +442,34 @@ PWIZ_API_DECL void XMLWriter::startElement(const string& name,
     impl_->startElement(name, attributes, emptyElementTag);
 }
 
+PWIZ_API_DECL void XMLWriter::startTag(const boost::string_ref& name) {impl_->startTag(name);}
+
+PWIZ_API_DECL void XMLWriter::attribute(const boost::string_ref& name, const boost::string_ref& value) {impl_->attribute(name, value);}
+
+PWIZ_API_DECL void XMLWriter::attribute(const boost::string_ref& name, double value)
+{
+    char buffer[256];
+    impl_->attribute(name, buffer, formatDouble(buffer, value));
+}
+
+#define PWIZ_XMLWRITER_ATTRIBUTE(Type, format) \
+    PWIZ_API_DECL void XMLWriter::attribute(const boost::string_ref& name, Type value) \
+    { \
+        char buffer[32]; \
+        impl_->attribute(name, buffer, format(buffer, value)); \
+    }
+
+PWIZ_XMLWRITER_ATTRIBUTE(int, formatInteger)
+PWIZ_XMLWRITER_ATTRIBUTE(long, formatInteger)
+PWIZ_XMLWRITER_ATTRIBUTE(long long, formatInteger)
+PWIZ_XMLWRITER_ATTRIBUTE(unsigned int, formatUnsigned)
+PWIZ_XMLWRITER_ATTRIBUTE(unsigned long, formatUnsigned)
+PWIZ_XMLWRITER_ATTRIBUTE(unsigned long long, formatUnsigned)
+
+#undef PWIZ_XMLWRITER_ATTRIBUTE
+
+PWIZ_API_DECL void XMLWriter::endStartTag(EmptyElementTag emptyElementTag) {impl_->endStartTag(emptyElementTag);}
+
 PWIZ_API_DECL void XMLWriter::endElement() {impl_->endElement();}
 
 PWIZ_API_DECL void XMLWriter::characters(const string& text, bool autoEscape) {impl_->characters(text, autoEscape);}
@@ -321,6 +478,10 @@ PWIZ_API_DECL XMLWriter::stream_offset XMLWriter::position() const {return impl_
 
 PWIZ_API_DECL XMLWriter::stream_offset XMLWriter::positionNext() const {return impl_->positionNext();}
 
+PWIZ_API_DECL XMLWriter::Config XMLWriter::fragmentConfig() const {return impl_->fragmentConfig();}
+
+PWIZ_API_DECL void XMLWriter::fragment(const string& xml) {impl_->fragment(xml);}
+
 
 namespace {
 
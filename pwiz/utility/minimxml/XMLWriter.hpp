@@ -30,6 +30,7 @@
 #include "boost/shared_ptr.hpp"
 #include "boost/iostreams/positioning.hpp"
 #include "boost/iostreams/filter/counter.hpp"
+#include "boost/utility/string_ref.hpp"
 #include <iosfwd>
 #include <string>
 #include <vector>
@@ -62,6 +63,10 @@ class PWIZ_API_DECL XMLWriter
     {
         public:
         virtual void update(const std::string& output) = 0;
+
+        /// called instead of update(string) by the writer; override to observe output without copying it
+        virtual void update(const char* output, size_t length) {update(std::string(output, length));}
+
         virtual ~OutputObserver(){}
     };
 
@@ -71,9 +76,10 @@ class PWIZ_API_DECL XMLWriter
         unsigned int initialStyle;
         unsigned int indentationStep;
         OutputObserver* outputObserver;
+        size_t initialDepth; // element nesting depth the output starts at (for fragments)
 
         Config()
-        :   initialStyle(0), indentationStep(2), outputObserver(0)
+        :   initialStyle(0), indentationStep(2), outputObserver(0), initialDepth(0)
         {}
     };
 
@@ -93,6 +99,9 @@ class PWIZ_API_DECL XMLWriter
 
     /// constructor
     XMLWriter(std::ostream& os, const Config& config = Config());
+
+    /// constructs a writer that appends its output to a string (e.g. a buffer reused for each fragment)
+    XMLWriter(std::string& output, const Config& config = Config());
     virtual ~XMLWriter() {}
 
     /// pushes style flags onto the internal style stack
@@ -112,6 +121,29 @@ class PWIZ_API_DECL XMLWriter
                       const Attributes& attributes = Attributes(),
                       EmptyElementTag emptyElementTag = NotEmptyElement);
 
+    /// writes an element start tag from attributes given one at a time, without building an Attributes vector:
+    ///
+    /// writer.startTag("cvParam");
+    /// writer.attribute("accession", info.id);
+    /// writer.attribute("value", 42);
+    /// writer.endStartTag(XMLWriter::EmptyElement);
+    ///
+    /// the output is the same as startElement() with the same attributes, including number formatting
+    void startTag(const boost::string_ref& name);
+
+    /// writes an attribute of the start tag begun by startTag(), escaping reserved XML characters
+    void attribute(const boost::string_ref& name, const boost::string_ref& value);
+    void attribute(const boost::string_ref& name, double value);
+    void attribute(const boost::string_ref& name, int value);
+    void attribute(const boost::string_ref& name, unsigned int value);
+    void attribute(const boost::string_ref& name, long value);
+    void attribute(const boost::string_ref& name, unsigned long value);
+    void attribute(const boost::string_ref& name, long long value);
+    void attribute(const boost::string_ref& name, unsigned long long value);
+
+    /// ends the start tag begun by startTag()
+    void endStartTag(EmptyElementTag emptyElementTag = NotEmptyElement);
+
     /// writes element end tag
     void endElement();
 
@@ -128,6 +160,14 @@ class PWIZ_API_DECL XMLWriter
     /// returns stream position of next element start tag 
     stream_offset positionNext() const;
 
+    /// returns a Config for a separate XMLWriter whose output can be passed to fragment():
+    /// the same indentation and current style, starting at the current element depth, without an output observer
+    Config fragmentConfig() const;
+
+    /// writes XML rendered by an XMLWriter constructed with fragmentConfig() as-is;
+    /// allows elements to be rendered on other threads and then written in order
+    void fragment(const std::string& xml);
+
 
     private:
     class Impl;
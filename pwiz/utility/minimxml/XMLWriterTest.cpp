@@ -186,6 +186,138 @@ void test()
     unit_assert(encode_xml_id(crazyId) == "_x0021__x0021__x0021_");
 }
 
+void testFragment()
+{
+    // a record rendered by a fragment writer must be identical to one written directly
+
+    ostringstream oss;
+    TestOutputObserver outputObserver;
+    XMLWriter::Config config;
+    config.indentationStep = 4;
+    config.outputObserver = &outputObserver;
+    XMLWriter writer(oss, config);
+
+    writer.startElement("root");
+    writer.pushStyle(XMLWriter::StyleFlag_AttributesOnMultipleLines);
+
+    XMLWriter::Config fragmentConfig = writer.fragmentConfig();
+    unit_assert_operator_equal(4, fragmentConfig.indentationStep);
+    unit_assert_operator_equal(1, fragmentConfig.initialDepth);
+    unit_assert_operator_equal(XMLWriter::StyleFlag_AttributesOnMultipleLines, fragmentConfig.initialStyle);
+    unit_assert(!fragmentConfig.outputObserver);
+
+    ostringstream fragmentStream;
+    XMLWriter fragmentWriter(fragmentStream, fragmentConfig);
+    XMLWriter::Attributes attributes;
+    attributes.push_back(make_pair("name", "bush"));
+    attributes.push_back(make_pair("color", "red"));
+    attributes.push_back(make_pair("number", "43"));
+    fragmentWriter.startElement("record", attributes);
+        fragmentWriter.pushStyle(XMLWriter::StyleFlag_InlineInner);
+        fragmentWriter.startElement("quote");
+        fragmentWriter.characters("Mission accomplished.");
+        fragmentWriter.endElement();
+        fragmentWriter.popStyle();
+    fragmentWriter.endElement();
+
+    XMLWriter::stream_offset positionNext = writer.positionNext();
+    writer.fragment(fragmentStream.str());
+    writer.popStyle();
+    writer.endElement();
+
+    const char* targetFragmentXML =
+        "<root>\n"
+        "    <record name=\"bush\"\n"
+        "            color=\"red\"\n"
+        "            number=\"43\">\n"
+        "        <quote>Mission accomplished.</quote>\n"
+        "    </record>\n"
+        "</root>\n";
+
+    if (os_) *os_ << "testFragment:\n" << oss.str() << endl;
+
+    unit_assert_operator_equal(targetFragmentXML, oss.str());
+    unit_assert_operator_equal(targetFragmentXML, outputObserver.cache);
+    unit_assert_operator_equal(oss.str().find("<record"), (size_t) positionNext);
+}
+
+
+void testStreamingAttributes()
+{
+    // startTag()/attribute()/endStartTag() must write what startElement() writes with the same attributes
+
+    XMLWriter::Config config;
+    config.indentationStep = 2;
+    config.initialDepth = 1;
+
+    ostringstream expected;
+    {
+        XMLWriter writer(expected, config);
+        XMLWriter::Attributes attributes;
+        attributes.add("id", "scan=\"1\" & <more>");
+        attributes.add("mz", 445.34);
+        attributes.add("tiny", 1.5e-20);
+        attributes.add("intensity", 120053.0);
+        attributes.add("negative", -42);
+        attributes.add("count", (size_t) 1234567);
+        attributes.add("big", 9000000000LL);
+        writer.startElement("spectrum", attributes);
+        writer.pushStyle(XMLWriter::StyleFlag_AttributesOnMultipleLines);
+        writer.startElement("cvParam", attributes, XMLWriter::EmptyElement);
+        writer.popStyle();
+        writer.startElement("binary");
+        writer.characters("AAAA<notEscaped>", false);
+        writer.endElement();
+        writer.endElement();
+    }
+
+    TestOutputObserver outputObserver;
+    config.outputObserver = &outputObserver;
+
+    ostringstream oss;
+    string rendered = "already here\n";
+    XMLWriter writer(oss, config);
+    XMLWriter stringWriter(rendered, config);
+    for (int i=0; i < 2; ++i)
+    {
+        XMLWriter& w = i == 0 ? writer : stringWriter;
+
+        w.startTag("spectrum");
+        w.attribute("id", "scan=\"1\" & <more>");
+        w.attribute("mz", 445.34);
+        w.attribute("tiny", 1.5e-20);
+        w.attribute("intensity", 120053.0);
+        w.attribute("negative", -42);
+        w.attribute("count", (size_t) 1234567);
+        w.attribute("big", 9000000000LL);
+        w.endStartTag();
+        w.pushStyle(XMLWriter::StyleFlag_AttributesOnMultipleLines);
+        unit_assert_operator_equal(w.position() + 4, w.positionNext());
+        w.startTag("cvParam");
+        w.attribute("id", string("scan=\"1\" & <more>"));
+        w.attribute("mz", 445.34);
+        w.attribute("tiny", 1.5e-20);
+        w.attribute("intensity", 120053.0f);
+        w.attribute("negative", -42L);
+        w.attribute("count", 1234567u);
+        w.attribute("big", 9000000000ULL);
+        w.endStartTag(XMLWriter::EmptyElement);
+        w.popStyle();
+        w.startElement("binary");
+        w.characters("AAAA<notEscaped>", false);
+        w.endElement();
+        w.endElement();
+    }
+
+    if (os_) *os_ << "testStreamingAttributes:\n" << oss.str() << endl;
+
+    unit_assert_operator_equal(expected.str(), oss.str());
+    unit_assert_operator_equal("already here\n" + expected.str(), rendered);
+    unit_assert_operator_equal((XMLWriter::stream_offset) rendered.size(), stringWriter.position());
+    unit_assert_operator_equal(expected.str() + expected.str(), outputObserver.cache);
+}
+
+
 void testNormalization()
 {
 #ifndef __APPLE__ // TODO: how to test that this works with Darwin's compiler?
@@ -207,6 +339,8 @@ int main(int argc, char* argv[])
     {
         if (argc>1 && !strcmp(argv[1],"-v")) os_ = &cout;
         test();
+        testFragment();
+        testStreamingAttributes();
         testNormalization();
     }
     catch (exception& e)
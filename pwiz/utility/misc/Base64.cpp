@@ -24,7 +24,26 @@
 
 #include "Base64.hpp"
 #include "pwiz/utility/misc/Std.hpp"
-#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define PWIZ_BASE64_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define PWIZ_BASE64_NEON
+#include <arm_neon.h>
+#endif
+
+// the SIMD kernels are compiled for their instruction set regardless of the target architecture flags;
+// they are only called after checking that the CPU supports them
+#if defined(__GNUC__) || defined(__clang__)
+#define PWIZ_BASE64_TARGET(isa) __attribute__((target(isa)))
+#else
+#define PWIZ_BASE64_TARGET(isa)
+#endif
 
 
 namespace pwiz {
@@ -49,32 +68,28 @@ char charTable[64] =
 };
 
 
-char byteTable[256];
-bool byteTableInitialized = false;
-
-
-void initializeByteTable()
+struct ByteTable
 {
-    for (size_t i=0; i<64; i++)
-        byteTable[static_cast<int>(charTable[i])] = static_cast<char>(i);
-
-    byteTableInitialized = true;
-}
-
+    char values[256];
 
-} // namespace
+    ByteTable()
+    {
+        memset(values, 0, sizeof(values));
+        for (size_t i=0; i<64; i++)
+            values[static_cast<int>(charTable[i])] = static_cast<char>(i);
+    }
+};
 
 
-PWIZ_API_DECL size_t Base64::binaryToTextSize(size_t byteCount)
+const char* getByteTable()
 {
-    return (size_t)ceil(byteCount/3.) * 4;
+    static const ByteTable table; // initialization is thread-safe
+    return table.values;
 }
 
 
-PWIZ_API_DECL size_t Base64::binaryToText(const void* from, size_t byteCount, char* to)
+size_t scalarBinaryToText(const byte* it, const byte* end, char* to)
 {
-    byte* it = (byte*)from;
-    byte* end = it + byteCount;
     size_t written = 0;
 
     while (it!=end)
@@ -112,20 +127,9 @@ PWIZ_API_DECL size_t Base64::binaryToText(const void* from, size_t byteCount, ch
 }
 
 
-PWIZ_API_DECL size_t Base64::textToBinarySize(size_t charCount)
-{
-    return (size_t)ceil(charCount/4.) * 3;
-}
-
-
-PWIZ_API_DECL size_t Base64::textToBinary(const char* from, size_t charCount, void* to)
+size_t scalarTextToBinary(const byte* it, const byte* end, byte* result)
 {
-    if (!byteTableInitialized)
-        initializeByteTable();
-
-    byte* it = (byte*)from;
-    byte* end = it + charCount;
-    byte* result = (byte*)to;
+    const char* byteTable = getByteTable();
     size_t written = 0;
 
     while (it!=end)
@@ -157,5 +161,370 @@ PWIZ_API_DECL size_t Base64::textToBinary(const char* from, size_t charCount, vo
     return written;
 }
 
+
+// The SIMD kernels convert as much of the input as they can in whole blocks and return the number of input
+// bytes/chars they consumed (always a multiple of 3/4); the scalar code converts the rest. The decoders stop
+// at the first block containing anything but the 64 base64 characters (i.e. padding), so unusual input
+// is always handled by the scalar code.
+typedef size_t (*EncodeKernel)(const byte* from, size_t byteCount, char* to);
+typedef size_t (*DecodeKernel)(const byte* from, size_t charCount, byte* to);
+
+
+#ifdef PWIZ_BASE64_X86
+
+// encoding: 12 bytes -> 16 chars per 128-bit lane
+// (W. Mula, D. Lemire, "Faster Base64 Encoding and Decoding Using AVX2 Instructions", 2018)
+
+PWIZ_BASE64_TARGET("ssse3")
+inline __m128i encodeBlock(__m128i in)
+{
+    // split each 3 byte group into 4 6-bit indexes, one per byte
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+    __m128i t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+    __m128i indexes = _mm_or_si128(t0, t1);
+
+    // map each index range to the offset from the index to its character
+    __m128i range = _mm_subs_epu8(indexes, _mm_set1_epi8(51));
+    range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indexes), _mm_set1_epi8(13)));
+    const __m128i offsets = _mm_setr_epi8('a'-26, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52,
+                                          '0'-52, '0'-52, '0'-52, '+'-62, '/'-63, 'A', 0, 0);
+    return _mm_add_epi8(indexes, _mm_shuffle_epi8(offsets, range));
+}
+
+PWIZ_BASE64_TARGET("ssse3")
+size_t encodeSSSE3(const byte* from, size_t byteCount, char* to)
+{
+    const byte* it = from;
+    for (; byteCount - (it - from) >= 16; it += 12, to += 16) // each load reads 4 bytes past the block
+        _mm_storeu_si128((__m128i*) to, encodeBlock(_mm_loadu_si128((const __m128i*) it)));
+    return it - from;
+}
+
+// decoding: 16 chars -> 12 bytes per 128-bit lane; returns false if any char is not in the base64 alphabet
+
+PWIZ_BASE64_TARGET("ssse3")
+inline bool decodeBlock(__m128i c, __m128i& out)
+{
+    __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('A'-1)), _mm_cmplt_epi8(c, _mm_set1_epi8('Z'+1)));
+    __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('a'-1)), _mm_cmplt_epi8(c, _mm_set1_epi8('z'+1)));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0'-1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9'+1)));
+    __m128i plus = _mm_cmpeq_epi8(c, _mm_set1_epi8('+'));
+    __m128i slash = _mm_cmpeq_epi8(c, _mm_set1_epi8('/'));
+    __m128i valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, plus)), slash);
+    if (_mm_movemask_epi8(valid) != 0xFFFF)
+        return false;
+
+    // add the offset from each character to its 6-bit value
+    __m128i shift = _mm_or_si128(_mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')),
+                                              _mm_and_si128(lower, _mm_set1_epi8(26-'a'))),
+                                 _mm_or_si128(_mm_or_si128(_mm_and_si128(digit, _mm_set1_epi8(52-'0')),
+                                                           _mm_and_si128(plus, _mm_set1_epi8(62-'+'))),
+                                              _mm_and_si128(slash, _mm_set1_epi8(63-'/'))));
+    __m128i values = _mm_add_epi8(c, shift);
+
+    // pack each 4 6-bit values into 3 bytes
+    __m128i merged = _mm_madd_epi16(_mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+    out = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    return true;
+}
+
+PWIZ_BASE64_TARGET("ssse3")
+size_t decodeSSSE3(const byte* from, size_t charCount, byte* to)
+{
+    const byte* it = from;
+    __m128i out;
+    for (; charCount - (it - from) >= 16; it += 16, to += 12)
+    {
+        if (!decodeBlock(_mm_loadu_si128((const __m128i*) it), out))
+            break;
+
+        // write exactly 12 bytes; the caller's buffer may end right after them
+        _mm_storel_epi64((__m128i*) to, out);
+        int last = _mm_cvtsi128_si32(_mm_srli_si128(out, 8));
+        memcpy(to + 8, &last, 4);
+    }
+    return it - from;
+}
+
+
+// the AVX2 kernels run the same steps on two lanes at once
+
+PWIZ_BASE64_TARGET("avx2")
+size_t encodeAVX2(const byte* from, size_t byteCount, char* to)
+{
+    const __m256i shuffle = _mm256_broadcastsi128_si256(_mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    const __m256i offsets = _mm256_broadcastsi128_si256(_mm_setr_epi8('a'-26, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52,
+                                                                      '0'-52, '0'-52, '0'-52, '+'-62, '/'-63, 'A', 0, 0));
+    const byte* it = from;
+    for (; byteCount - (it - from) >= 28; it += 24, to += 32) // the second load reads 4 bytes past the block
+    {
+        __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*) it)),
+                                             _mm_loadu_si128((const __m128i*) (it + 12)), 1);
+        in = _mm256_shuffle_epi8(in, shuffle);
+        __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+        __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+        __m256i indexes = _mm256_or_si256(t0, t1);
+
+        __m256i range = _mm256_subs_epu8(indexes, _mm256_set1_epi8(51));
+        range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indexes), _mm256_set1_epi8(13)));
+        _mm256_storeu_si256((__m256i*) to, _mm256_add_epi8(indexes, _mm256_shuffle_epi8(offsets, range)));
+    }
+    return it - from;
+}
+
+PWIZ_BASE64_TARGET("avx2")
+size_t decodeAVX2(const byte* from, size_t charCount, byte* to)
+{
+    const __m256i pack = _mm256_broadcastsi128_si256(_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    const byte* it = from;
+    for (; charCount - (it - from) >= 32; it += 32, to += 24)
+    {
+        __m256i c = _mm256_loadu_si256((const __m256i*) it);
+        __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('A'-1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z'+1), c));
+        __m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('a'-1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z'+1), c));
+        __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('0'-1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9'+1), c));
+        __m256i plus = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('+'));
+        __m256i slash = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('/'));
+        __m256i valid = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, plus)), slash);
+        if (_mm256_movemask_epi8(valid) != -1)
+            break;
+
+        __m256i shift = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(upper, _mm256_set1_epi8(-'A')),
+                                                        _mm256_and_si256(lower, _mm256_set1_epi8(26-'a'))),
+                                        _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(digit, _mm256_set1_epi8(52-'0')),
+                                                                        _mm256_and_si256(plus, _mm256_set1_epi8(62-'+'))),
+                                                        _mm256_and_si256(slash, _mm256_set1_epi8(63-'/'))));
+        __m256i values = _mm256_add_epi8(c, shift);
+
+        __m256i merged = _mm256_madd_epi16(_mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+        merged = _mm256_shuffle_epi8(merged, pack);
+
+        // move the 12 bytes from each lane together and write exactly 24 bytes
+        merged = _mm256_permutevar8x32_epi32(merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        _mm_storeu_si128((__m128i*) to, _mm256_castsi256_si128(merged));
+        _mm_storel_epi64((__m128i*) (to + 16), _mm256_extracti128_si256(merged, 1));
+    }
+    return it - from;
+}
+
+
+bool cpuSupports(Base64::Implementation impl)
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    __cpuid(info, 1);
+    if (impl == Base64::Implementation_SSSE3)
+        return (info[2] & (1 << 9)) != 0;
+
+    // AVX2 also needs the OS to save the YMM registers
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (impl != Base64::Implementation_AVX2 || maxLeaf < 7 || !osxsave || !avx || (_xgetbv(0) & 6) != 6)
+        return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    switch (impl)
+    {
+        case Base64::Implementation_SSSE3: return __builtin_cpu_supports("ssse3") != 0;
+        case Base64::Implementation_AVX2: return __builtin_cpu_supports("avx2") != 0;
+        default: return false;
+    }
+#endif
+}
+
+#endif // PWIZ_BASE64_X86
+
+
+#ifdef PWIZ_BASE64_NEON
+
+// encoding: 48 bytes -> 64 chars, deinterleaved by the structured loads and stores
+size_t encodeNEON(const byte* from, size_t byteCount, char* to)
+{
+    uint8x16x4_t table;
+    for (int i=0; i < 4; ++i)
+        table.val[i] = vld1q_u8((const uint8_t*) charTable + i*16);
+    const uint8x16_t mask = vdupq_n_u8(0x3f);
+
+    const byte* it = from;
+    for (; byteCount - (it - from) >= 48; it += 48, to += 64)
+    {
+        uint8x16x3_t in = vld3q_u8(it);
+        uint8x16x4_t out;
+        out.val[0] = vshrq_n_u8(in.val[0], 2);
+        out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask);
+        out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask);
+        out.val[3] = vandq_u8(in.val[2], mask);
+        for (int i=0; i < 4; ++i)
+            out.val[i] = vqtbl4q_u8(table, out.val[i]);
+        vst4q_u8((uint8_t*) to, out);
+    }
+    return it - from;
+}
+
+inline uint8x16_t decodeValues(uint8x16_t c, uint8x16_t& valid)
+{
+    uint8x16_t upper = vandq_u8(vcgeq_u8(c, vdupq_n_u8('A')), vcleq_u8(c, vdupq_n_u8('Z')));
+    uint8x16_t lower = vandq_u8(vcgeq_u8(c, vdupq_n_u8('a')), vcleq_u8(c, vdupq_n_u8('z')));
+    uint8x16_t digit = vandq_u8(vcgeq_u8(c, vdupq_n_u8('0')), vcleq_u8(c, vdupq_n_u8('9')));
+    uint8x16_t plus = vceqq_u8(c, vdupq_n_u8('+'));
+    uint8x16_t slash = vceqq_u8(c, vdupq_n_u8('/'));
+    valid = vandq_u8(valid, vorrq_u8(vorrq_u8(vorrq_u8(upper, lower), vorrq_u8(digit, plus)), slash));
+
+    uint8x16_t shift = vorrq_u8(vorrq_u8(vandq_u8(upper, vdupq_n_u8((uint8_t) -'A')),
+                                         vandq_u8(lower, vdupq_n_u8((uint8_t) (26-'a')))),
+                                vorrq_u8(vorrq_u8(vandq_u8(digit, vdupq_n_u8((uint8_t) (52-'0'))),
+                                                  vandq_u8(plus, vdupq_n_u8((uint8_t) (62-'+')))),
+                                         vandq_u8(slash, vdupq_n_u8((uint8_t) (63-'/')))));
+    return vaddq_u8(c, shift);
+}
+
+// decoding: 64 chars -> 48 bytes
+size_t decodeNEON(const byte* from, size_t charCount, byte* to)
+{
+    const byte* it = from;
+    for (; charCount - (it - from) >= 64; it += 64, to += 48)
+    {
+        uint8x16x4_t in = vld4q_u8(it);
+        uint8x16_t valid = vdupq_n_u8(0xff);
+        uint8x16_t v0 = decodeValues(in.val[0], valid);
+        uint8x16_t v1 = decodeValues(in.val[1], valid);
+        uint8x16_t v2 = decodeValues(in.val[2], valid);
+        uint8x16_t v3 = decodeValues(in.val[3], valid);
+        if (vminvq_u8(valid) != 0xff)
+            break;
+
+        uint8x16x3_t out;
+        out.val[0] = vorrq_u8(vshlq_n_u8(v0, 2), vshrq_n_u8(v1, 4));
+        out.val[1] = vorrq_u8(vshlq_n_u8(v1, 4), vshrq_n_u8(v2, 2));
+        out.val[2] = vorrq_u8(vshlq_n_u8(v2, 6), v3);
+        vst3q_u8(to, out);
+    }
+    return it - from;
+}
+
+bool cpuSupports(Base64::Implementation impl)
+{
+    return impl == Base64::Implementation_NEON; // always present on AArch64
+}
+
+#endif // PWIZ_BASE64_NEON
+
+
+#if !defined(PWIZ_BASE64_X86) && !defined(PWIZ_BASE64_NEON)
+bool cpuSupports(Base64::Implementation impl) {return false;}
+#endif
+
+
+struct Kernels
+{
+    Base64::Implementation implementation;
+    EncodeKernel encode;
+    DecodeKernel decode;
+};
+
+
+bool getKernels(Base64::Implementation impl, Kernels& kernels)
+{
+    kernels.implementation = impl;
+    kernels.encode = 0;
+    kernels.decode = 0;
+
+    if (impl == Base64::Implementation_Scalar)
+        return true;
+    if (!cpuSupports(impl))
+        return false;
+
+    switch (impl)
+    {
+#ifdef PWIZ_BASE64_X86
+        case Base64::Implementation_SSSE3: kernels.encode = &encodeSSSE3; kernels.decode = &decodeSSSE3; break;
+        case Base64::Implementation_AVX2: kernels.encode = &encodeAVX2; kernels.decode = &decodeAVX2; break;
+#endif
+#ifdef PWIZ_BASE64_NEON
+        case Base64::Implementation_NEON: kernels.encode = &encodeNEON; kernels.decode = &decodeNEON; break;
+#endif
+        default: return false;
+    }
+    return true;
+}
+
+
+Kernels bestKernels()
+{
+    const Base64::Implementation preference[] = {Base64::Implementation_AVX2, Base64::Implementation_NEON, Base64::Implementation_SSSE3};
+    Kernels kernels;
+    for (size_t i=0; i < sizeof(preference)/sizeof(preference[0]); ++i)
+        if (getKernels(preference[i], kernels))
+            return kernels;
+    getKernels(Base64::Implementation_Scalar, kernels);
+    return kernels;
+}
+
+
+Kernels& currentKernels()
+{
+    static Kernels kernels = bestKernels(); // initialization is thread-safe
+    return kernels;
+}
+
+
+} // namespace
+
+
+PWIZ_API_DECL Base64::Implementation Base64::implementation()
+{
+    return currentKernels().implementation;
+}
+
+
+PWIZ_API_DECL bool Base64::setImplementation(Implementation impl)
+{
+    Kernels kernels;
+    if (!getKernels(impl, kernels))
+        return false;
+    currentKernels() = kernels;
+    return true;
+}
+
+
+PWIZ_API_DECL size_t Base64::binaryToTextSize(size_t byteCount)
+{
+    return (byteCount + 2) / 3 * 4;
+}
+
+
+PWIZ_API_DECL size_t Base64::binaryToText(const void* from, size_t byteCount, char* to)
+{
+    const byte* it = (const byte*)from;
+    const Kernels& kernels = currentKernels();
+
+    size_t consumed = kernels.encode ? kernels.encode(it, byteCount, to) : 0;
+    size_t written = consumed / 3 * 4;
+    return written + scalarBinaryToText(it + consumed, it + byteCount, to + written);
+}
+
+
+PWIZ_API_DECL size_t Base64::textToBinarySize(size_t charCount)
+{
+    return (charCount + 3) / 4 * 3;
+}
+
+
+PWIZ_API_DECL size_t Base64::textToBinary(const char* from, size_t charCount, void* to)
+{
+    const byte* it = (const byte*)from;
+    byte* result = (byte*)to;
+    const Kernels& kernels = currentKernels();
+
+    size_t consumed = kernels.decode ? kernels.decode(it, charCount, result) : 0;
+    size_t written = consumed / 4 * 3;
+    return written + scalarTextToBinary(it + consumed, it + charCount, result + written);
+}
+
 } // namespace util
 } // namespace pwiz
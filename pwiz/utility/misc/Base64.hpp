@@ -54,6 +54,23 @@ namespace Base64
     /// - Returns the actual number of bytes written
     PWIZ_API_DECL size_t textToBinary(const char* from, size_t charCount, void* to);
 
+    /// Instruction sets the conversions can be vectorized with
+    enum Implementation
+    {
+        Implementation_Scalar,
+        Implementation_SSSE3,
+        Implementation_AVX2,
+        Implementation_NEON
+    };
+
+    /// Returns the implementation in use; by default the fastest one the CPU supports
+    PWIZ_API_DECL Implementation implementation();
+
+    /// Selects the implementation to use (e.g. to compare them in tests and benchmarks)
+    /// - Not thread-safe: no conversions may be running concurrently
+    /// - Returns false and leaves the current implementation in place if the CPU does not support it
+    PWIZ_API_DECL bool setImplementation(Implementation impl);
+
 } // namespace Base64
 
 
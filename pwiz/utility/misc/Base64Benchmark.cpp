@@ -0,0 +1,90 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); 
+// you may not use this file except in compliance with the License. 
+// You may obtain a copy of the License at 
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software 
+// distributed under the License is distributed on an "AS IS" BASIS, 
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. 
+// See the License for the specific language governing permissions and 
+// limitations under the License.
+//
+
+
+#include "Std.hpp"
+#include "Base64.hpp"
+#include <chrono>
+
+
+using namespace pwiz::util;
+typedef std::chrono::steady_clock Clock;
+
+
+// throughput of each supported Base64 implementation, in GB/s of text (encoded size)
+// usage: Base64Benchmark [megabytes of binary data per pass] [passes]
+int main(int argc, char* argv[])
+{
+    try
+    {
+        size_t byteCount = (argc > 1 ? lexical_cast<size_t>(argv[1]) : 64) * 1024 * 1024;
+        size_t passes = argc > 2 ? lexical_cast<size_t>(argv[2]) : 10;
+
+        vector<char> binary(byteCount), decoded(byteCount);
+        for (size_t i=0; i < byteCount; ++i)
+            binary[i] = (char) ((i * 7919 + i / 13) % 256);
+        vector<char> text(Base64::binaryToTextSize(byteCount));
+
+        const Base64::Implementation implementations[] = {Base64::Implementation_Scalar,
+                                                          Base64::Implementation_SSSE3,
+                                                          Base64::Implementation_AVX2,
+                                                          Base64::Implementation_NEON};
+        const char* names[] = {"scalar", "SSSE3", "AVX2", "NEON"};
+        Base64::Implementation defaultImplementation = Base64::implementation();
+
+        cout << "text size: " << text.size() << " bytes, " << passes << " passes, default: " << names[defaultImplementation] << endl;
+
+        for (size_t i=0; i < sizeof(implementations)/sizeof(implementations[0]); ++i)
+        {
+            if (!Base64::setImplementation(implementations[i]))
+                continue;
+
+            Clock::time_point start = Clock::now();
+            for (size_t pass=0; pass < passes; ++pass)
+                Base64::binaryToText(&binary[0], byteCount, &text[0]);
+            double encodeSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+            start = Clock::now();
+            for (size_t pass=0; pass < passes; ++pass)
+                Base64::textToBinary(&text[0], text.size(), &decoded[0]);
+            double decodeSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+            if (decoded != binary)
+                throw runtime_error(string("round trip failed with ") + names[i]);
+
+            double gigabytes = double(text.size()) * passes / 1e9;
+            cout << names[i] << ": encode " << gigabytes / encodeSeconds << " GB/s, decode " << gigabytes / decodeSeconds << " GB/s" << endl;
+        }
+
+        Base64::setImplementation(defaultImplementation);
+        return 0;
+    }
+    catch (exception& e)
+    {
+        cerr << e.what() << endl;
+    }
+    catch (...)
+    {
+        cerr << "Caught unknown exception.\n";
+    }
+
+    return 1;
+}
@@ -119,10 +119,72 @@ void test256()
 }
 
 
+// compares the current implementation with the scalar one on every length around the SIMD block sizes,
+// including text with padding or unexpected characters at any position
+void testAgainstScalar()
+{
+    if (os_) *os_ << "testAgainstScalar()\n" << flush;
+
+    Base64::Implementation impl = Base64::implementation();
+
+    vector<char> binary(1000);
+    for (size_t i=0; i < binary.size(); ++i)
+        binary[i] = (char) ((i * 7919 + i / 13) % 256);
+
+    for (size_t byteCount=0; byteCount < binary.size(); byteCount += byteCount < 200 ? 1 : 37)
+    {
+        vector<char> text(Base64::binaryToTextSize(byteCount) + 1, '\0'), scalarText(text);
+        size_t textCount = Base64::binaryToText(&binary[0], byteCount, &text[0]);
+        unit_assert(Base64::setImplementation(Base64::Implementation_Scalar));
+        unit_assert_operator_equal(textCount, Base64::binaryToText(&binary[0], byteCount, &scalarText[0]));
+        unit_assert(text == scalarText);
+        Base64::setImplementation(impl);
+
+        // round trip
+        vector<char> decoded(Base64::textToBinarySize(textCount) + 1);
+        unit_assert_operator_equal(byteCount, Base64::textToBinary(&text[0], textCount, &decoded[0]));
+        unit_assert(equal(binary.begin(), binary.begin() + byteCount, decoded.begin()));
+
+        // text the SIMD decoders must leave to the scalar code
+        if (byteCount % 53 != 0)
+            continue;
+        const string unexpected = "=\n-\x80";
+        for (size_t pos=0; pos < textCount; ++pos)
+            for (size_t i=0; i < unexpected.size(); ++i)
+            {
+                vector<char> badText(text);
+                badText[pos] = unexpected[i];
+                vector<char> result(decoded.size()), scalarResult(decoded.size());
+                size_t resultCount = Base64::textToBinary(&badText[0], textCount, &result[0]);
+                unit_assert(Base64::setImplementation(Base64::Implementation_Scalar));
+                unit_assert_operator_equal(resultCount, Base64::textToBinary(&badText[0], textCount, &scalarResult[0]));
+                unit_assert(result == scalarResult);
+                Base64::setImplementation(impl);
+            }
+    }
+}
+
+
 void test()
 {
-    for_each(testPairs_, testPairs_+testPairCount_, checkTestPair);
-    test256();
+    const Base64::Implementation implementations[] = {Base64::Implementation_Scalar,
+                                                      Base64::Implementation_SSSE3,
+                                                      Base64::Implementation_AVX2,
+                                                      Base64::Implementation_NEON};
+    Base64::Implementation defaultImplementation = Base64::implementation();
+
+    BOOST_FOREACH(Base64::Implementation impl, implementations)
+    {
+        if (!Base64::setImplementation(impl))
+            continue;
+        if (os_) *os_ << "implementation " << impl << endl;
+
+        for_each(testPairs_, testPairs_+testPairCount_, checkTestPair);
+        test256();
+        testAgainstScalar();
+    }
+
+    unit_assert(Base64::setImplementation(defaultImplementation));
 }
 
 
@@ -0,0 +1,236 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#define PWIZ_SOURCE
+
+#include "block_gzip_compressor.hpp"
+#include "Std.hpp"
+#include "zlib.h"
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include <boost/cstdint.hpp>
+
+
+namespace pwiz {
+namespace util {
+
+
+namespace {
+
+// each member is an 18 byte header, the raw deflate data, and an 8 byte trailer
+const size_t headerSize_ = 18;
+const size_t trailerSize_ = 8;
+const size_t maxMemberSize_ = 0x10000;
+
+// each thread compresses this many blocks per batch
+const size_t blocksPerThread_ = 16;
+
+// the empty member that ends a BGZF file
+const unsigned char eofMember_[] =
+{
+    0x1f, 0x8b, 0x08, 0x04, 0, 0, 0, 0, 0, 0xff, 0x06, 0, 'B', 'C', 0x02, 0,
+    0x1b, 0, 0x03, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+void putLittleEndian(string& s, size_t offset, boost::uint32_t value, size_t bytes)
+{
+    for (size_t i=0; i < bytes; ++i, value >>= 8)
+        s[offset + i] = (char) (value & 0xff);
+}
+
+
+// compresses blocks with one deflate stream that is reset between them
+class BlockDeflater
+{
+    public:
+
+    explicit BlockDeflater(int level) : storedInitialized_(false)
+    {
+        init(stream_, level);
+    }
+
+    ~BlockDeflater()
+    {
+        deflateEnd(&stream_);
+        if (storedInitialized_)
+            deflateEnd(&storedStream_);
+    }
+
+    void compress(const char* data, size_t size, string& member)
+    {
+        // stored (level 0) blocks always fit, if the requested level doesn't
+        if (!deflateBlock(stream_, data, size, member))
+        {
+            if (!storedInitialized_)
+            {
+                init(storedStream_, 0);
+                storedInitialized_ = true;
+            }
+            if (!deflateBlock(storedStream_, data, size, member))
+                throw runtime_error("[block_gzip_compressor] block does not fit in a member");
+        }
+
+        size_t memberSize = member.length();
+        member.replace(0, headerSize_, reinterpret_cast<const char*>(eofMember_), headerSize_);
+        putLittleEndian(member, 16, (boost::uint32_t) (memberSize - 1), 2);
+
+        boost::uint32_t crc = crc32(crc32(0L, Z_NULL, 0), reinterpret_cast<const Bytef*>(data), (uInt) size);
+        putLittleEndian(member, memberSize - trailerSize_, crc, 4);
+        putLittleEndian(member, memberSize - 4, (boost::uint32_t) size, 4);
+    }
+
+    private:
+    z_stream stream_;
+    z_stream storedStream_;
+    bool storedInitialized_;
+
+    static void init(z_stream& stream, int level)
+    {
+        memset(&stream, 0, sizeof(stream));
+        if (deflateInit2(&stream, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+            throw runtime_error("[block_gzip_compressor] deflateInit2 failed");
+    }
+
+    // leaves room for the header and trailer around the deflate data; false if the member would be too big
+    static bool deflateBlock(z_stream& stream, const char* data, size_t size, string& member)
+    {
+        member.resize(maxMemberSize_);
+        deflateReset(&stream);
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+        stream.avail_in = (uInt) size;
+        stream.next_out = reinterpret_cast<Bytef*>(&member[headerSize_]);
+        stream.avail_out = (uInt) (maxMemberSize_ - headerSize_ - trailerSize_);
+        if (deflate(&stream, Z_FINISH) != Z_STREAM_END)
+            return false;
+        member.resize(headerSize_ + stream.total_out + trailerSize_);
+        return true;
+    }
+};
+
+} // namespace
+
+
+class block_gzip_compressor::Impl
+{
+    public:
+
+    Impl(int level, size_t threadCount)
+    :   level_(level),
+        threadCount_(threadCount > 0 ? threadCount : max(1u, boost::thread::hardware_concurrency()))
+    {
+        BlockDeflater test(level); // fail early for a bad level
+    }
+
+    void append(const char* s, size_t n)
+    {
+        pending_.append(s, n);
+
+        size_t batchSize = threadCount_ * blocksPerThread_ * max_block_size;
+        if (pending_.length() >= batchSize)
+        {
+            size_t fullBlocks = pending_.length() / max_block_size;
+            compressBlocks(fullBlocks);
+            pending_.erase(0, fullBlocks * max_block_size);
+        }
+    }
+
+    void finish()
+    {
+        compressBlocks((pending_.length() + max_block_size - 1) / max_block_size);
+        pending_.clear();
+        compressed_.append(reinterpret_cast<const char*>(eofMember_), sizeof(eofMember_));
+    }
+
+    string& compressed() {return compressed_;}
+
+    private:
+    int level_;
+    size_t threadCount_;
+    string pending_;
+    string compressed_;
+    vector<string> members_;
+    boost::mutex errorMutex_;
+    string error_;
+
+    void compressBlocks(size_t blockCount)
+    {
+        if (blockCount == 0)
+            return;
+
+        members_.resize(blockCount);
+        size_t threadCount = min(threadCount_, blockCount);
+        if (threadCount == 1)
+            compressEvery(0, 1);
+        else
+        {
+            boost::thread_group threads;
+            for (size_t i=0; i < threadCount; ++i)
+                threads.create_thread(boost::bind(&Impl::compressEvery, this, i, threadCount));
+            threads.join_all();
+        }
+        if (!error_.empty())
+        {
+            string error;
+            error.swap(error_);
+            throw runtime_error(error);
+        }
+
+        for (size_t i=0; i < blockCount; ++i)
+            compressed_ += members_[i];
+        members_.clear();
+    }
+
+    // compresses every stride'th block, starting with first; an error is saved for the calling thread to throw
+    void compressEvery(size_t first, size_t stride)
+    {
+        try
+        {
+            BlockDeflater deflater(level_);
+            for (size_t i=first; i < members_.size(); i += stride)
+            {
+                size_t offset = i * max_block_size;
+                deflater.compress(pending_.c_str() + offset, min(max_block_size, pending_.length() - offset), members_[i]);
+            }
+        }
+        catch (exception& e)
+        {
+            boost::mutex::scoped_lock lock(errorMutex_);
+            error_ = e.what();
+        }
+    }
+};
+
+
+const size_t block_gzip_compressor::max_block_size;
+
+
+PWIZ_API_DECL block_gzip_compressor::block_gzip_compressor(int level, size_t threadCount)
+:   impl_(new Impl(level, threadCount))
+{}
+
+PWIZ_API_DECL void block_gzip_compressor::append(const char* s, size_t n) {impl_->append(s, n);}
+PWIZ_API_DECL void block_gzip_compressor::finish() {impl_->finish();}
+PWIZ_API_DECL string& block_gzip_compressor::compressed() {return impl_->compressed();}
+
+
+} // namespace util
+} // namespace pwiz
@@ -0,0 +1,96 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#ifndef _BLOCK_GZIP_COMPRESSOR_HPP_
+#define _BLOCK_GZIP_COMPRESSOR_HPP_
+
+
+#include "pwiz/utility/misc/Export.hpp"
+#include <string>
+#include <iosfwd>
+#include <boost/shared_ptr.hpp>
+#include <boost/iostreams/categories.hpp>
+#include <boost/iostreams/write.hpp>
+
+
+namespace pwiz {
+namespace util {
+
+
+/// a boost::iostreams output filter that writes gzip as a series of independent members of at most
+/// 64 KB each, in the BGZF layout used by samtools: every member's header has a "BC" extra subfield with
+/// the member's compressed size, and the file ends with an empty member; the members are compressed in
+/// parallel, the output is the same for any number of threads, and it is still an ordinary gzip file;
+/// random_access_compressed_ifstream recognizes the layout and seeks with the member headers instead of
+/// making a decompression pass through the whole file
+class PWIZ_API_DECL block_gzip_compressor
+{
+    public:
+
+    typedef char char_type;
+    struct category : boost::iostreams::multichar_output_filter_tag, boost::iostreams::closable_tag {};
+
+    /// the largest amount of uncompressed data in a member
+    static const size_t max_block_size = 0xff00;
+
+    /// level is the zlib compression level; threadCount == 0 uses one thread per hardware thread
+    explicit block_gzip_compressor(int level = 6, size_t threadCount = 0);
+
+    template <typename Sink>
+    std::streamsize write(Sink& sink, const char* s, std::streamsize n)
+    {
+        append(s, (size_t) n);
+        writeCompressed(sink);
+        return n;
+    }
+
+    template <typename Sink>
+    void close(Sink& sink)
+    {
+        finish();
+        writeCompressed(sink);
+    }
+
+    private:
+    class Impl;
+    boost::shared_ptr<Impl> impl_;
+
+    void append(const char* s, size_t n);
+    void finish();
+    std::string& compressed();
+
+    template <typename Sink>
+    void writeCompressed(Sink& sink)
+    {
+        std::string& bytes = compressed();
+        if (!bytes.empty())
+            boost::iostreams::write(sink, bytes.c_str(), (std::streamsize) bytes.length());
+        bytes.clear();
+    }
+};
+
+
+} // namespace util
+} // namespace pwiz
+
+
+#endif // _BLOCK_GZIP_COMPRESSOR_HPP_
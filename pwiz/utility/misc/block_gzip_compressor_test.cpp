@@ -0,0 +1,250 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#include "Std.hpp"
+#include "block_gzip_compressor.hpp"
+#include "random_access_compressed_ifstream.hpp"
+#include "Filesystem.hpp"
+#include "pwiz/utility/misc/unit.hpp"
+#include "zlib.h"
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+
+using namespace pwiz::util;
+namespace bio = boost::iostreams;
+
+
+ostream* os_ = 0;
+const string filename_ = "block_gzip_compressor_test.gz";
+
+
+string testText()
+{
+    ostringstream oss;
+    for (size_t i=0; i < 300000; ++i)
+        oss << "<spectrum index=\"" << i << "\">" << (i * 2654435761u) % 1000003 << "</spectrum>\n";
+    return oss.str();
+}
+
+
+string compress(const string& text, size_t threadCount)
+{
+    string result;
+    bio::filtering_ostream os;
+    os.push(block_gzip_compressor(6, threadCount));
+    os.push(bio::back_inserter(result));
+
+    // written in pieces that don't line up with the blocks
+    for (size_t i=0; i < text.length(); i += 10007)
+        os.write(text.c_str() + i, min<size_t>(10007, text.length() - i));
+    os.reset();
+    return result;
+}
+
+
+void writeFile(const string& bytes)
+{
+    ofstream(filename_.c_str(), ios::binary).write(bytes.c_str(), bytes.length());
+}
+
+
+// zlib's gzip reader, i.e. what gunzip would see
+string gunzip()
+{
+    gzFile gz = gzopen(filename_.c_str(), "rb");
+    unit_assert(gz);
+    string result;
+    char buffer[65536];
+    int bytesRead;
+    while ((bytesRead = gzread(gz, buffer, sizeof(buffer))) > 0)
+        result.append(buffer, bytesRead);
+    unit_assert(bytesRead == 0);
+    gzclose(gz);
+    return result;
+}
+
+
+string readAll(istream& is)
+{
+    return string(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+}
+
+
+void testSeeks(random_access_compressed_ifstream& is, const string& text)
+{
+    size_t offsets[] = {text.length() - 100, 0, 1500000, 65279, 65280, 65281, text.length() / 2, 123, 42};
+    BOOST_FOREACH(size_t offset, offsets)
+    {
+        if (os_) *os_ << "seek " << offset << endl;
+        string buffer(100, '\0');
+        is.clear();
+        is.seekg(offset);
+        is.read(&buffer[0], buffer.length());
+        unit_assert_operator_equal(text.substr(offset, 100), buffer);
+    }
+
+    is.clear();
+    is.seekg(0, ios::end);
+    unit_assert_operator_equal(text.length(), (size_t) is.tellg());
+}
+
+
+void testBlocks()
+{
+    if (os_) *os_ << "testBlocks" << endl;
+
+    string text = testText();
+    string compressed = compress(text, 1);
+
+    // the output doesn't depend on the number of threads
+    unit_assert(compressed == compress(text, 4));
+    unit_assert(compressed.length() < text.length() / 2);
+
+    // every member is a BGZF block with the right size, ending with the empty one
+    size_t memberCount = 0, uncompressedSize = 0;
+    for (size_t offset=0; offset < compressed.length(); ++memberCount)
+    {
+        const unsigned char* member = reinterpret_cast<const unsigned char*>(compressed.c_str() + offset);
+        unit_assert(member[0] == 0x1f && member[1] == 0x8b && member[3] == 4);
+        unit_assert(member[12] == 'B' && member[13] == 'C');
+        size_t memberSize = (member[16] | (member[17] << 8)) + 1;
+        unit_assert(offset + memberSize <= compressed.length());
+        size_t isize = member[memberSize - 4] | (member[memberSize - 3] << 8) | (member[memberSize - 2] << 16);
+        unit_assert(isize <= block_gzip_compressor::max_block_size);
+        uncompressedSize += isize;
+        offset += memberSize;
+        if (offset == compressed.length())
+            unit_assert_operator_equal(0, isize);
+    }
+    unit_assert_operator_equal(text.length(), uncompressedSize);
+    unit_assert_operator_equal((text.length() + block_gzip_compressor::max_block_size - 1) / block_gzip_compressor::max_block_size + 1, memberCount);
+
+    writeFile(compressed);
+    unit_assert(text == gunzip());
+
+    {
+        random_access_compressed_ifstream is(filename_.c_str());
+        unit_assert(is.getCompressionType() == random_access_compressed_ifstream::GZIP);
+        unit_assert(text == readAll(is));
+    }
+
+    // the access points come from the block headers, one per block and without windows
+    string seekIndex;
+    {
+        random_access_compressed_ifstream is(filename_.c_str());
+        testSeeks(is, text);
+        ostringstream oss;
+        unit_assert(is.write_seek_index(oss));
+        seekIndex = oss.str();
+    }
+    unit_assert(seekIndex.length() < memberCount * 32);
+
+    random_access_compressed_ifstream is(filename_.c_str());
+    istringstream iss(seekIndex);
+    unit_assert(is.read_seek_index(iss));
+    testSeeks(is, text);
+
+    bfs::remove(filename_);
+}
+
+
+void testEmpty()
+{
+    if (os_) *os_ << "testEmpty" << endl;
+
+    // just the end-of-file block
+    string compressed = compress("", 0);
+    unit_assert_operator_equal(28, compressed.length());
+
+    writeFile(compressed);
+    unit_assert(gunzip().empty());
+    random_access_compressed_ifstream is(filename_.c_str());
+    unit_assert(readAll(is).empty());
+    bfs::remove(filename_);
+}
+
+
+// ordinary gzip members one after another are read as one file, like gunzip does
+void testConcatenatedMembers()
+{
+    if (os_) *os_ << "testConcatenatedMembers" << endl;
+
+    string text = testText();
+    string compressed;
+    for (size_t i=0; i < 3; ++i)
+    {
+        size_t begin = i * text.length() / 3, end = (i + 1) * text.length() / 3;
+        bio::filtering_ostream os;
+        os.push(bio::gzip_compressor());
+        os.push(bio::back_inserter(compressed));
+        os.write(text.c_str() + begin, end - begin);
+    }
+    writeFile(compressed);
+
+    {
+        random_access_compressed_ifstream is(filename_.c_str());
+        unit_assert(text == readAll(is));
+
+        // rewinding starts over at the first member
+        is.clear();
+        is.seekg(0);
+        string buffer(100, '\0');
+        is.read(&buffer[0], buffer.length());
+        unit_assert_operator_equal(text.substr(0, 100), buffer);
+    }
+
+    random_access_compressed_ifstream is(filename_.c_str());
+    testSeeks(is, text);
+    bfs::remove(filename_);
+}
+
+
+void test()
+{
+    testBlocks();
+    testEmpty();
+    testConcatenatedMembers();
+}
+
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(argc, argv)
+
+    try
+    {
+        if (argc>1 && !strcmp(argv[1],"-v")) os_ = &cout;
+        test();
+    }
+    catch (exception& e)
+    {
+        TEST_FAILED(e.what())
+    }
+    catch (...)
+    {
+        TEST_FAILED("Caught unknown exception.")
+    }
+
+    TEST_EPILOG
+}
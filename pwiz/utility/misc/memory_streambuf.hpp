@@ -0,0 +1,88 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#ifndef _MEMORY_STREAMBUF_HPP_
+#define _MEMORY_STREAMBUF_HPP_
+
+
+#include "boost/iostreams/positioning.hpp"
+#include <streambuf>
+
+
+namespace pwiz {
+namespace util {
+
+
+/// read-only streambuf over a range of memory that is not owned or copied (e.g. a memory-mapped file
+/// or an in-memory copy of part of one); stream positions are reported relative to baseOffset,
+/// so a range taken from the middle of a file reports the same offsets as the file itself would
+class memory_streambuf : public std::streambuf
+{
+    public:
+
+    memory_streambuf(const char* begin, const char* end, boost::iostreams::stream_offset baseOffset = 0)
+    :   baseOffset_(baseOffset)
+    {
+        char* first = const_cast<char*>(begin);
+        setg(first, first, first + (end - begin));
+    }
+
+    /// the stream offset of the first byte in the range
+    boost::iostreams::stream_offset baseOffset() const {return baseOffset_;}
+
+    protected:
+
+    virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in)
+    {
+        if (!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+
+        boost::iostreams::stream_offset newpos;
+        if (dir == std::ios_base::beg)
+            newpos = off - baseOffset_;
+        else if (dir == std::ios_base::cur)
+            newpos = (gptr() - eback()) + off;
+        else
+            newpos = (egptr() - eback()) + off;
+
+        if (newpos < 0 || newpos > egptr() - eback())
+            return pos_type(off_type(-1));
+
+        setg(eback(), eback() + newpos, egptr());
+        return boost::iostreams::offset_to_position(baseOffset_ + newpos);
+    }
+
+    virtual pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in)
+    {
+        return seekoff(off_type(boost::iostreams::position_to_offset(pos)), std::ios_base::beg, which);
+    }
+
+    private:
+    boost::iostreams::stream_offset baseOffset_;
+};
+
+
+} // namespace util
+} // namespace pwiz
+
+
+#endif // _MEMORY_STREAMBUF_HPP_
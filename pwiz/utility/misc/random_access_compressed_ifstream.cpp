@@ -11,6 +11,13 @@
 // every 1MB or so.  Further seeks are then quite efficient since they don't
 // have to begin at the head of the file.
 //
+// Files made of several gzip members (as gzip itself reads them) are read
+// through to the end.  If the members are BGZF blocks (each header has a "BC"
+// extra subfield with the compressed size of the member, as block_gzip_compressor
+// and samtools write them), the snapshots are taken from the member headers
+// instead: every block starts a fresh deflate stream, so finding them takes
+// no decompression at all.
+//
 // It also features threaded readahead with adaptive buffering - it will read 
 // increasingly larger chunks of the raw file as it perceives a sequential read 
 // in progress, and will launch a thread to grab the next probable chunk of the 
@@ -73,6 +80,8 @@ Version 1.0  29 May 2005  Mark Adler */
 #include <netinet/in.h>
 #endif
 #include <boost/iostreams/device/file_descriptor.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include "pwiz/utility/misc/memory_streambuf.hpp"
 #include <sys/stat.h>
 #include <vector>
 #include <cassert>
@@ -81,6 +90,7 @@ Version 1.0  29 May 2005  Mark Adler */
 #include <cstring>
 #include "pwiz/utility/misc/Std.hpp"
 #include <boost/thread.hpp>
+#include <boost/cstdint.hpp>
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem/detail/utf8_codecvt_facet.hpp>
 
@@ -122,7 +132,8 @@ class synchpoint {
 public:
     random_access_compressed_ifstream_off_t out;          /* corresponding offset in uncompressed data */
     random_access_compressed_ifstream_off_t in;           /* offset in input file of first full byte */
-    z_stream *state; // stream state
+    int bits;                                             /* number of bits (1-7) from byte at in - 1, or 0 */
+    std::vector<unsigned char> window;                    /* preceding uncompressed data (up to WINSIZE bytes) */
 };
 //
 // here's where the real customization of the stream happens
@@ -147,6 +158,7 @@ private:
     z_stream stream;
     int      z_err;   /* error code for last stream operation */
     int      z_eof;   /* set if end of input file */
+    bool     bgzf;    /* set if the last gzip header read had a BGZF block size subfield */
     std::istream *infile;   /* raw .gz file we're reading */
     Byte     *inbuf;  /* input buffer */
     Byte     *outbuf; /* output buffer */
@@ -158,16 +170,21 @@ private:
     std::streamoff	outbuf_len; /* length of outbuf last time we populated it */
     std::vector<synchpoint *> index; // index for random access
     /* Add an entry to the access point list. */
-   synchpoint *addIndexEntry(random_access_compressed_ifstream_off_t in, random_access_compressed_ifstream_off_t out);
+   synchpoint *addIndexEntry(random_access_compressed_ifstream_off_t in, random_access_compressed_ifstream_off_t out,
+                             int bits, const unsigned char *window, unsigned window_end);
 
     // gzip stuff
     int do_flush(int flush);
     int get_byte();
     int  get_buf(int len);
     void  check_header();
+    bool  next_member();
     int    destroy();
     uLong  getLong();
     int build_index();
+    bool build_bgzf_index();
+    bool write_index(std::ostream &os); // save the access points for a later read_index()
+    bool read_index(std::istream &is); // restore saved access points instead of building them
     void update_istream_ptrs(std::streampos new_headpos,int new_buflen,int new_posoffset=0) {
         outbuf_headpos = new_headpos; // note the decompressed filepos corresponding to buf head
         outbuf_len = new_buflen; // how many bytes in the buffer are consumable?
@@ -390,6 +407,32 @@ public:
 
 
 
+// streambuf over a read-only memory mapping of an entire uncompressed file
+class mapped_streambuf : public memory_streambuf {
+public:
+    static mapped_streambuf *open(const char *path) {
+        boost::iostreams::mapped_file_source file;
+        try {
+            boost::filesystem::detail::utf8_codecvt_facet utf8;
+            file.open(boost::filesystem::path(path, utf8));
+        } catch (std::exception&) {
+            return NULL; // e.g. empty file, or not enough address space: caller falls back to buffered reads
+        }
+        if (!file.is_open() || (file.size() == 0)) {
+            return NULL;
+        }
+        return new mapped_streambuf(file);
+    }
+    const char *data() const { return file.data(); }
+    random_access_compressed_ifstream_off_t size() const { return (random_access_compressed_ifstream_off_t) file.size(); }
+private:
+    mapped_streambuf(const boost::iostreams::mapped_file_source &file) :
+    memory_streambuf(file.data(), file.data() + file.size()), file(file) {
+    }
+    boost::iostreams::mapped_file_source file; // shares the mapping, which is released with the last copy
+};
+
+
 #define gzio_raw_readerror(s) (s->infile->bad())
 
 // default ctor
@@ -397,18 +440,26 @@ PWIZ_API_DECL
 random_access_compressed_ifstream::random_access_compressed_ifstream() :
 std::istream(new chunky_streambuf()) {
     compressionType = NONE;
+    mapped = false;
 }
 
 // constructor
 PWIZ_API_DECL
-random_access_compressed_ifstream::random_access_compressed_ifstream(const char *path) :
+random_access_compressed_ifstream::random_access_compressed_ifstream(const char *path, bool memoryMap) :
 std::istream(new chunky_streambuf()) 
 {
-    open(path);
+    compressionType = NONE;
+    mapped = false;
+    open(path, memoryMap);
 }
 
 PWIZ_API_DECL
-void random_access_compressed_ifstream::open(const char *path) {
+void random_access_compressed_ifstream::open(const char *path, bool memoryMap) {
+    // rdbuf() is only a chunky_streambuf when the file is neither mapped nor gzipped
+    if (mapped || (NONE != compressionType) || ((chunky_streambuf *)rdbuf())->is_open()) {
+        close(); // puts the chunky_streambuf back in place of the mapping or gzip handler
+        clear();
+    }
     chunky_streambuf *fb = (chunky_streambuf *)rdbuf();
     // cout << "opening "<<path<<"\n";
     bool gzipped = false;
@@ -420,6 +471,14 @@ void random_access_compressed_ifstream::open(const char *path) {
         if (gzipped) { // replace streambuf with gzip handler (handing it current rdbuf)
             rdbuf( new random_access_compressed_streambuf( (chunky_streambuf *)rdbuf() ));
             compressionType = GZIP;
+        } else if (memoryMap) {
+            mapped_streambuf *mb = mapped_streambuf::open(path);
+            if (mb) { // replace buffered reads with the mapping
+                fb->close();
+                delete fb;
+                rdbuf(mb);
+                mapped = true;
+            }
         }
     } else {
         this->setstate(std::ios::failbit); // could not open, set the fail flag
@@ -428,7 +487,9 @@ void random_access_compressed_ifstream::open(const char *path) {
 
 PWIZ_API_DECL
 bool random_access_compressed_ifstream::is_open() const { // for ease of use as ifstream replacement
-    if (NONE == compressionType) {
+    if (mapped) {
+        return true; // only mapped while open
+    } else if (NONE == compressionType) {
         return ((chunky_streambuf *)rdbuf())->is_open();
     } else {
         return ((random_access_compressed_streambuf *)rdbuf())->is_open();
@@ -438,7 +499,10 @@ bool random_access_compressed_ifstream::is_open() const { // for ease of use as
 PWIZ_API_DECL
 void random_access_compressed_ifstream::close() {
     // cout << "close\n";
-    if (rdbuf()) {
+    if (mapped) {
+        delete rdbuf(new chunky_streambuf()); // unmap, and be ready for another open()
+        mapped = false;
+    } else if (rdbuf()) {
         if (NONE != compressionType) {
             // retrieve rdbuf from gzip handler
             rdbuf(((random_access_compressed_streambuf *)rdbuf())->close());
@@ -448,6 +512,26 @@ void random_access_compressed_ifstream::close() {
     }
 }
 
+PWIZ_API_DECL
+const char *random_access_compressed_ifstream::mapped_data() const {
+    return mapped ? ((mapped_streambuf *)rdbuf())->data() : NULL;
+}
+
+PWIZ_API_DECL
+random_access_compressed_ifstream_off_t random_access_compressed_ifstream::mapped_size() const {
+    return mapped ? ((mapped_streambuf *)rdbuf())->size() : 0;
+}
+
+PWIZ_API_DECL
+bool random_access_compressed_ifstream::write_seek_index(std::ostream &os) {
+    return (GZIP == compressionType) && ((random_access_compressed_streambuf *)rdbuf())->write_index(os);
+}
+
+PWIZ_API_DECL
+bool random_access_compressed_ifstream::read_seek_index(std::istream &is) {
+    return (GZIP == compressionType) && ((random_access_compressed_streambuf *)rdbuf())->read_index(is);
+}
+
 PWIZ_API_DECL
 random_access_compressed_ifstream::~random_access_compressed_ifstream()
 {
@@ -468,6 +552,7 @@ random_access_compressed_streambuf::random_access_compressed_streambuf(chunky_st
     this->infile = new istream(rawbuf); // dynamic disk buffer size
     this->z_err = Z_OK;
     this->z_eof = 0;
+    this->bgzf = false;
     this->crc = crc32(0L, Z_NULL, 0);
 
     if ((this->infile->fail())) {
@@ -607,10 +692,24 @@ void random_access_compressed_streambuf::check_header()
         this->get_byte();
     }
 
-    if ((flags & EXTRA_FIELD) != 0) { /* skip the extra field */
+    this->bgzf = false;
+    if ((flags & EXTRA_FIELD) != 0) { /* skip the extra field, noting a BGZF block size subfield */
         len  =  (uInt)this->get_byte();
         len += ((uInt)this->get_byte())<<8;
-        /* len is garbage if EOF but the loop below will quit anyway */
+        /* len is garbage if EOF but the loops below will quit anyway */
+        while (len >= 4 && !this->z_eof) {
+            int si1 = this->get_byte();
+            int si2 = this->get_byte();
+            uInt slen  =  (uInt)this->get_byte();
+            slen += ((uInt)this->get_byte())<<8;
+            len -= 4;
+            if (si1 == 'B' && si2 == 'C' && slen == 2) {
+                this->bgzf = true;
+            }
+            slen = std::min(slen, len);
+            len -= slen;
+            while (slen-- != 0 && this->get_byte() != EOF) ;
+        }
         while (len-- != 0 && this->get_byte() != EOF) ;
     }
     if ((flags & ORIG_NAME) != 0) { /* skip the original file name */
@@ -627,6 +726,29 @@ void random_access_compressed_streambuf::check_header()
     this->z_err = this->z_eof ? Z_DATA_ERROR : Z_OK;
 }
 
+/* ===========================================================================
+At the end of a gzip member, skip its trailer and start on the next member, if
+there is one (concatenated .gz files decompress to the concatenated data, as with
+gzip). Returns false, with z_err set to Z_STREAM_END, if there isn't; anything
+other than a gzip header after the last member is ignored, as gzip does.
+*/
+bool random_access_compressed_streambuf::next_member()
+{
+    this->getLong(); /* crc32 */
+    this->getLong(); /* uncompressed length */
+    if (this->z_err != Z_DATA_ERROR) {
+        this->z_err = Z_STREAM_END;
+        this->check_header();
+    }
+    this->infile->clear(); // clear eof flag
+    if (this->z_err != Z_OK) {
+        this->z_err = Z_STREAM_END;
+        return false;
+    }
+    (void)inflateReset(&this->stream);
+    return true;
+}
+
 /* ===========================================================================
 * Cleanup then free the given random_access_gzstream. Return a zlib error code.
 Try freeing in the reverse order of allocations.
@@ -645,8 +767,6 @@ int random_access_compressed_streambuf::destroy ()
     }
     // clean up the seek index list if any
     for (int i=(int)this->index.size();i--;) {
-        inflateEnd(this->index[i]->state);
-        delete this->index[i]->state;
         delete this->index[i];
     }
     this->index.clear(); // set length 0
@@ -694,14 +814,24 @@ random_access_compressed_streambuf::int_type random_access_compressed_streambuf:
         // first locate the index entry which will get us at or just before target
         size_t ind = this->index.size();
         while (--ind && this->index[ind]->out > offset);
-        // and prepare to decompress
+        // and prepare to decompress: an access point is at a deflate block boundary,
+        // so a raw inflate primed with its leftover bits and window can start there
         synchpoint *synch = this->index[ind];
-        inflateEnd(&this->stream); // tidy up old ptrs
-        inflateCopy(&this->stream,synch->state);
         z_stream &strm = this->stream;
-      assert(strm.total_in == synch->in-this->start);
+        (void)inflateReset(&strm);
         this->infile->clear(); // clear eof flag if any
-        this->infile->seekg(boost::iostreams::offset_to_position(synch->in));
+        this->infile->seekg(boost::iostreams::offset_to_position(synch->in - (synch->bits ? 1 : 0)));
+        if (synch->bits) {
+            int c = this->infile->get();
+            if (c == EOF) {
+                ret = Z_DATA_ERROR;
+                goto perform_seek_ret;
+            }
+            (void)inflatePrime(&strm, synch->bits, c >> (8 - synch->bits));
+        }
+        if (synch->window.size()) {
+            (void)inflateSetDictionary(&strm, &synch->window[0], (uInt)synch->window.size());
+        }
 
         /* skip uncompressed bytes until offset reached */
         offset -= synch->out;  // now offset is the number of uncompressed bytes we need to skip
@@ -748,7 +878,10 @@ random_access_compressed_streambuf::int_type random_access_compressed_streambuf:
                 if (ret == Z_MEM_ERROR || ret == Z_DATA_ERROR)
                     goto perform_seek_ret;
                 if (ret == Z_STREAM_END) {
-                    break;
+                    if (!this->next_member()) {
+                        break;
+                    }
+                    ret = Z_OK;
                 }
             } while (strm.avail_out != 0);
 
@@ -796,6 +929,9 @@ perform_seek_ret:
                 this->stream.next_in = this->inbuf;
             }
             this->z_err = inflate(&(this->stream), Z_NO_FLUSH);
+            if (this->z_err == Z_STREAM_END && this->next_member()) {
+                continue;
+            }
 
             if (this->z_err != Z_OK || this->z_eof) {
                 break;
@@ -848,6 +984,8 @@ std::streampos random_access_compressed_streambuf::my_seekg(std::streampos offse
                 this->stream.total_out = 0;
                 this->stream.next_in = this->inbuf;
                 this->crc = crc32(0L, Z_NULL, 0);
+                this->z_err = Z_OK;
+                this->z_eof = 0;
                 (void)inflateReset(&this->stream);
                 this->last_seek_pos = -1; // no need to seek
                 this->infile->seekg(boost::iostreams::offset_to_position(this->start));
@@ -910,16 +1048,23 @@ uLong random_access_compressed_streambuf::getLong ()
 // from here we're stealing from zran.c
 //
 
-/* Add an entry to the access point list. */
-synchpoint *random_access_compressed_streambuf::addIndexEntry(random_access_compressed_ifstream_off_t in, random_access_compressed_ifstream_off_t out)
+/* Add an entry to the access point list; window is the circular sliding window,
+whose newest byte is just before window_end. */
+synchpoint *random_access_compressed_streambuf::addIndexEntry(random_access_compressed_ifstream_off_t in, random_access_compressed_ifstream_off_t out,
+                                                              int bits, const unsigned char *window, unsigned window_end)
 {
     /* fill in entry and increment how many we have */
     synchpoint *next = new synchpoint();
     if (next) {
         next->in = in;
         next->out = out;
-        next->state = new z_stream;
-        inflateCopy(next->state,&this->stream);
+        next->bits = bits;
+        /* copy the last WINSIZE (or fewer, near the start) bytes of output, oldest first */
+        unsigned have = (unsigned)std::min<random_access_compressed_ifstream_off_t>(out, WINSIZE);
+        next->window.resize(have);
+        for (unsigned i = 0; i < have; ++i) {
+            next->window[i] = window[(window_end + WINSIZE - have + i) % WINSIZE];
+        }
         this->index.push_back(next);
     }
     return next;
@@ -928,18 +1073,22 @@ synchpoint *random_access_compressed_streambuf::addIndexEntry(random_access_comp
 /* Make one entire pass through the compressed stream and build an index, with
 access points about every span bytes of uncompressed output -- span is
 chosen to balance the speed of random access against the memory requirements
-of the list, about 32K bytes per access point.  Note that data after the end
-of the first zlib or gzip stream in the file is ignored.  build_index()
+of the list, about 32K bytes per access point.  Later gzip members are indexed
+along with the first; BGZF files are indexed from their block headers instead
+(see build_bgzf_index()).  build_index()
 returns 0 on success, Z_MEM_ERROR for out of memory, Z_DATA_ERROR for an error in 
 the input file, or Z_ERRNO for a file read error.  
 On success, *built points to the resulting index. */
 int random_access_compressed_streambuf::build_index()
 {
+    if (this->bgzf && this->build_bgzf_index()) {
+        return Z_OK;
+    }
+
     int ret;
     random_access_compressed_ifstream_off_t span=SPAN;
     random_access_compressed_ifstream_off_t totin, totout;        /* our own total counters to avoid 4GB limit */
     random_access_compressed_ifstream_off_t last;                 /* totout value of last access point */
-    unsigned char *input = new unsigned char[CHUNK];
     unsigned char *window = new unsigned char[WINSIZE];
     z_stream &strm = this->stream;
 
@@ -950,6 +1099,8 @@ int random_access_compressed_streambuf::build_index()
    this->stream.total_out = 0;
    this->stream.next_in = this->inbuf;
    this->crc = crc32(0L, Z_NULL, 0);
+   this->z_err = Z_OK;
+   this->z_eof = 0;
    ret = inflateReset(&strm); 
    this->infile->clear(); // clear stale eof bit if any
    this->infile->seekg((std::streamoff)this->start); // rewind
@@ -962,11 +1113,11 @@ int random_access_compressed_streambuf::build_index()
     information at the end of the gzip or zlib stream */
    totout = last = 0;
    totin = this->start;
-   this->addIndexEntry(totin,totout); // note head of file
+   this->addIndexEntry(totin,totout,0,window,0); // note head of file
 
     do {
         /* get some compressed data from input file */
-        this->infile->read((char *)input, CHUNK);
+        this->infile->read((char *)this->inbuf, CHUNK);
         strm.avail_in = this->infile->gcount();
         if (gzio_raw_readerror(this)) {
             ret = Z_ERRNO;
@@ -976,7 +1127,7 @@ int random_access_compressed_streambuf::build_index()
             ret = Z_DATA_ERROR;
             goto build_index_error;
         }
-        strm.next_in = input;
+        strm.next_in = this->inbuf;
 
         /* process all of that, or until end of stream */
         do {
@@ -998,14 +1149,21 @@ int random_access_compressed_streambuf::build_index()
             if (ret == Z_MEM_ERROR || ret == Z_DATA_ERROR)
                 goto build_index_error;
             if (ret == Z_STREAM_END) {
-                // reached end successfully
-                this->infile->clear(); // clear the fail bit
-                break;
+                if (!this->next_member()) {
+                    // reached end successfully
+                    this->infile->clear(); // clear the fail bit
+                    break;
+                }
+                // the next member's header may have taken more input
+                totin = this->infile->tellg() - (std::streamoff)strm.avail_in;
+                ret = Z_OK;
+                continue;
             }
 
-         /* add an index entry every 'span' bytes   */
-         if (( totout - last) > span) {
-            if (!this->addIndexEntry(totin,totout)) {
+         /* add an index entry every 'span' bytes, at the end of a deflate block
+            (but not the last one) so the entry can be restored without the inflate state */
+         if ((strm.data_type & 128) && !(strm.data_type & 64) && (totout - last) > span) {
+            if (!this->addIndexEntry(totin,totout,strm.data_type & 7,window,WINSIZE - strm.avail_out)) {
                             ret = Z_MEM_ERROR;
                             goto build_index_error;
                     }
@@ -1020,10 +1178,175 @@ int random_access_compressed_streambuf::build_index()
     /* return error */
 build_index_error:
     delete[] window;
-    delete[] input;
     return ret;
 }
 
+/* Index a BGZF file from its block headers: each block is a gzip member whose
+header gives its compressed size and whose trailer gives its uncompressed size,
+so an access point at the start of each block's deflate data needs no window
+and no decompression to find.  Returns false, leaving the index empty, if any
+member is not a BGZF block, so build_index() can make a decompression pass. */
+bool random_access_compressed_streambuf::build_bgzf_index()
+{
+    random_access_compressed_ifstream_off_t blockStart = 0, totout = 0;
+    unsigned char header[12];
+    std::vector<unsigned char> extra;
+    bool ok = true;
+
+    this->infile->clear();
+    while (ok) {
+        this->infile->seekg((std::streamoff)blockStart);
+        this->infile->read((char *)header, sizeof(header));
+        if (this->infile->gcount() == 0) {
+            break; // end of file
+        }
+        ok = this->infile->gcount() == sizeof(header) &&
+             header[0] == gz_magic[0] && header[1] == gz_magic[1] && header[2] == Z_DEFLATED &&
+             (header[3] & EXTRA_FIELD) && !(header[3] & (ORIG_NAME | COMMENT | HEAD_CRC | RESERVED));
+        if (!ok) {
+            break;
+        }
+
+        /* find the block size subfield */
+        unsigned xlen = header[10] | (header[11] << 8);
+        extra.resize(xlen);
+        if (xlen) {
+            this->infile->read((char *)&extra[0], xlen);
+        }
+        ok = (unsigned)this->infile->gcount() == xlen;
+        random_access_compressed_ifstream_off_t blockSize = 0;
+        for (unsigned i = 0; ok && i + 4 <= xlen; ) {
+            unsigned slen = extra[i + 2] | (extra[i + 3] << 8);
+            if (extra[i] == 'B' && extra[i + 1] == 'C' && slen == 2 && i + 6 <= xlen) {
+                blockSize = (extra[i + 4] | (extra[i + 5] << 8)) + 1;
+            }
+            i += 4 + slen;
+        }
+        random_access_compressed_ifstream_off_t dataStart = blockStart + sizeof(header) + xlen;
+        ok = ok && blockSize >= (random_access_compressed_ifstream_off_t)(sizeof(header) + xlen + 8);
+        if (!ok) {
+            break;
+        }
+
+        /* the uncompressed size is the last 4 bytes of the block */
+        unsigned char isize[4];
+        this->infile->seekg((std::streamoff)(blockStart + blockSize - 4));
+        this->infile->read((char *)isize, sizeof(isize));
+        ok = this->infile->gcount() == sizeof(isize);
+        if (!ok) {
+            break;
+        }
+
+        if (!this->index.size() || totout > this->index.back()->out) {
+            synchpoint *point = new synchpoint();
+            point->in = dataStart;
+            point->out = totout;
+            point->bits = 0;
+            this->index.push_back(point);
+        }
+        totout += (random_access_compressed_ifstream_off_t)isize[0] | ((random_access_compressed_ifstream_off_t)isize[1] << 8) |
+                  ((random_access_compressed_ifstream_off_t)isize[2] << 16) | ((random_access_compressed_ifstream_off_t)isize[3] << 24);
+        blockStart += blockSize;
+    }
+    this->infile->clear(); // clear the eof bit
+
+    if (!ok || !this->index.size()) {
+        for (size_t i = 0; i < this->index.size(); ++i) {
+            delete this->index[i];
+        }
+        this->index.clear();
+        return false;
+    }
+    this->uncompressedLength = totout;
+    return true;
+}
+
+/* Save the access points, building them first if no seek has done so yet;
+returns false if the index can't be built (e.g. a corrupt file). */
+bool random_access_compressed_streambuf::write_index(std::ostream &os)
+{
+    if (!this->index.size()) {
+        std::streampos pos = this->last_seek_pos >= 0 ? this->last_seek_pos : get_next_read_pos();
+        if (this->build_index() < 0) {
+            return false;
+        }
+        // build_index() consumed the stream, so pick up from the same place at the next read
+        this->last_seek_pos = pos;
+        update_istream_ptrs(outbuf_headpos,0); // blow the cache
+    }
+
+    boost::uint64_t count = this->index.size();
+    boost::int64_t length = this->uncompressedLength;
+    os.write((const char *)&count, sizeof(count));
+    os.write((const char *)&length, sizeof(length));
+    for (size_t i = 0; i < this->index.size(); ++i) {
+        const synchpoint *point = this->index[i];
+        boost::int64_t in = point->in, out = point->out;
+        boost::int32_t bits = point->bits;
+        boost::uint32_t windowSize = (boost::uint32_t)point->window.size();
+        os.write((const char *)&in, sizeof(in));
+        os.write((const char *)&out, sizeof(out));
+        os.write((const char *)&bits, sizeof(bits));
+        os.write((const char *)&windowSize, sizeof(windowSize));
+        if (windowSize) {
+            os.write((const char *)&point->window[0], windowSize);
+        }
+    }
+    return !!os;
+}
+
+/* Restore access points saved by write_index() for the same file, so the first seek
+doesn't have to make a pass through the whole file; if the access points are already
+built, they are kept. Returns false if the saved access points aren't usable. */
+bool random_access_compressed_streambuf::read_index(std::istream &is)
+{
+    boost::uint64_t count = 0;
+    boost::int64_t length = 0;
+    is.read((char *)&count, sizeof(count));
+    is.read((char *)&length, sizeof(length));
+    if (!is || !count || length < 0) {
+        return false;
+    }
+
+    std::vector<synchpoint *> points;
+    bool ok = true;
+    for (boost::uint64_t i = 0; ok && i < count; ++i) {
+        boost::int64_t in = 0, out = 0;
+        boost::int32_t bits = 0;
+        boost::uint32_t windowSize = 0;
+        is.read((char *)&in, sizeof(in));
+        is.read((char *)&out, sizeof(out));
+        is.read((char *)&bits, sizeof(bits));
+        is.read((char *)&windowSize, sizeof(windowSize));
+        ok = is && in >= this->start && out >= 0 && out <= length && bits >= 0 && bits < 8 &&
+             windowSize <= std::min<boost::int64_t>(out, WINSIZE) && // BGZF access points have no window
+             (windowSize > 0 || bits == 0) &&
+             (points.empty() ? out == 0 : out > points.back()->out);
+        if (ok) {
+            synchpoint *point = new synchpoint();
+            point->in = in;
+            point->out = out;
+            point->bits = bits;
+            point->window.resize(windowSize);
+            if (windowSize) {
+                is.read((char *)&point->window[0], windowSize);
+            }
+            points.push_back(point);
+            ok = !!is;
+        }
+    }
+
+    if (!ok || this->index.size()) {
+        for (size_t i = 0; i < points.size(); ++i) {
+            delete points[i];
+        }
+        return ok;
+    }
+    this->index.swap(points);
+    this->uncompressedLength = length;
+    return true;
+}
+
 //
 // stuff for an ifstream with a really big buffer and smarter seek
 //
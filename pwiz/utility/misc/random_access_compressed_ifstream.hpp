@@ -81,17 +81,29 @@ typedef boost::iostreams::stream_offset random_access_compressed_ifstream_off_t;
 class PWIZ_API_DECL random_access_compressed_ifstream : public std::istream {
 public:
 	random_access_compressed_ifstream(); // default ctor
-	random_access_compressed_ifstream(const char *fname); // optional arg to learn compression state
+	random_access_compressed_ifstream(const char *fname, bool memoryMap = false); // optional arg to learn compression state
 	virtual ~random_access_compressed_ifstream(); // destructor
-	void open(const char *fname); // for ease of use as ifstream replacement
+	void open(const char *fname, bool memoryMap = false); // for ease of use as ifstream replacement; reopening closes the open file first
 	bool is_open() const; // for ease of use as ifstream replacement
 	void close(); // for ease of use as ifstream replacement
 	enum eCompressionType {NONE, GZIP}; // maybe add bz2 etc later?
 	eCompressionType getCompressionType() const {
 		return compressionType;
 	}
+	// with memoryMap, an uncompressed file is memory-mapped when possible (otherwise it is read through a buffer as usual),
+	// so seeks are free and reads come straight from the mapped pages;
+	// mapped_data() returns the start of the mapping (valid until close()), or NULL if the file is not mapped
+	const char *mapped_data() const;
+	random_access_compressed_ifstream_off_t mapped_size() const; // 0 if not mapped
+	// gzipped files get a set of access points for random access on their first seek, which takes a pass through the
+	// whole file (or, for BGZF files like block_gzip_compressor writes, just a hop through the block headers);
+	// write_seek_index() saves them (building them if needed) and read_seek_index() restores them for the
+	// same file later on; both return false if the file is not gzipped or the access points can't be saved/restored
+	bool write_seek_index(std::ostream &os);
+	bool read_seek_index(std::istream &is);
 private:
 	eCompressionType compressionType;
+	bool mapped;
 };
 
 
@@ -0,0 +1,475 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#ifndef _SHARDED_CACHE_HPP_
+#define _SHARDED_CACHE_HPP_
+
+
+#include <boost/config.hpp> /* keep it first to prevent nasty warns in MSVC */
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/identity.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/mem_fun.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/locks.hpp>
+
+
+namespace pwiz {
+namespace util {
+
+
+/// how a sharded_cache chooses the item to evict when a shard is over its limits
+enum cache_eviction_policy
+{
+    cache_eviction_lru,   ///< least recently used
+    cache_eviction_clock, ///< CLOCK (second chance): close to LRU, but a hit only sets a flag instead of reordering
+    cache_eviction_lfu    ///< least frequently used; the least recently used of those if there is a tie
+};
+
+
+/// limits and layout of a sharded_cache; a limit of 0 means unlimited
+struct cache_config
+{
+    std::size_t max_items;
+    std::size_t max_weight;
+    std::size_t shard_count;
+    cache_eviction_policy policy;
+
+    cache_config(std::size_t max_items = 0,
+                 std::size_t max_weight = 0,
+                 std::size_t shard_count = 1,
+                 cache_eviction_policy policy = cache_eviction_lru)
+    :   max_items(max_items), max_weight(max_weight), shard_count(shard_count), policy(policy)
+    {}
+};
+
+
+/// usage counters and current contents of a sharded_cache
+struct cache_statistics
+{
+    std::size_t hits;       ///< get() calls that found the key
+    std::size_t misses;     ///< get() calls that did not
+    std::size_t insertions; ///< items added
+    std::size_t evictions;  ///< items removed to stay within the limits
+    std::size_t items;      ///< items currently held
+    std::size_t weight;     ///< total weight of the items currently held
+
+    cache_statistics() : hits(0), misses(0), insertions(0), evictions(0), items(0), weight(0) {}
+};
+
+
+/// the default weigher: every item weighs 1
+template <typename Item>
+struct unit_weight
+{
+    std::size_t operator()(const Item&) const {return 1;}
+};
+
+
+/// A thread-safe cache of items looked up by key, limited by item count and/or the total weight of the
+/// items (e.g. their size in bytes as measured by Weigher). Items are spread over separately locked shards
+/// by the hash of their key, so concurrent callers rarely wait on each other; each shard gets an equal share
+/// of the limits and evicts on its own. With a single shard and LRU eviction it behaves like an mru_list.
+///
+/// Note: iteration and mru()/lru() are for inspecting the cache and must not race with changes to it;
+///       across several shards, iteration is in no particular order and mru()/lru() are approximate.
+template <typename Item,
+          typename KeyExtractor = boost::multi_index::identity<Item>,
+          typename Weigher = unit_weight<Item> >
+class sharded_cache
+{
+    public:
+
+    typedef Item item_type;
+    typedef typename KeyExtractor::result_type key_type;
+
+    private:
+
+    struct node
+    {
+        node(const Item& item, std::size_t weight, std::size_t tick)
+        :   item(item), weight(weight), frequency(1), rankTick(tick), lastAccess(tick), referenced(false)
+        {}
+
+        Item item;
+        std::size_t weight;
+        std::size_t frequency;          // LFU rank, only changed through modify()
+        std::size_t rankTick;           // LFU tie-breaker, only changed through modify()
+        mutable std::size_t lastAccess; // not indexed, so it may be updated in place
+        mutable bool referenced;        // CLOCK reference bit
+
+        std::pair<std::size_t, std::size_t> lfuRank() const {return std::make_pair(frequency, rankTick);}
+    };
+
+    struct node_key
+    {
+        typedef key_type result_type;
+        const result_type& operator()(const node& n) const {return KeyExtractor()(n.item);}
+    };
+
+    typedef boost::multi_index::multi_index_container
+    <
+        node,
+        boost::multi_index::indexed_by
+        <
+            boost::multi_index::sequenced<>, // recency order for LRU and LFU, the CLOCK ring otherwise
+            boost::multi_index::hashed_unique<node_key>,
+            boost::multi_index::ordered_non_unique<boost::multi_index::const_mem_fun<node, std::pair<std::size_t, std::size_t>, &node::lfuRank> >
+        >
+    > node_list;
+
+    typedef typename node_list::iterator node_iterator;
+
+    struct shard
+    {
+        boost::mutex mutex;
+        node_list nodes;
+        node_iterator hand; // CLOCK hand
+        std::size_t weight;
+        std::size_t tick;
+        cache_statistics stats;
+
+        shard() : hand(nodes.end()), weight(0), tick(0) {}
+    };
+
+    struct bump_frequency
+    {
+        bump_frequency(std::size_t tick) : tick_(tick) {}
+        void operator()(node& n) {++n.frequency; n.rankTick = tick_;}
+        private: std::size_t tick_;
+    };
+
+    struct replace_item
+    {
+        replace_item(const Item& item, std::size_t weight) : item_(item), weight_(weight) {}
+        void operator()(node& n) {n.item = item_; n.weight = weight_;}
+        private: const Item& item_; std::size_t weight_;
+    };
+
+    public:
+
+    /// an iterator over the cached items
+    class const_iterator : public boost::iterator_facade<const_iterator, const Item, boost::forward_traversal_tag>
+    {
+        public:
+        const_iterator() : cache_(0), shard_(0) {}
+
+        private:
+        friend class sharded_cache;
+        friend class boost::iterator_core_access;
+
+        const_iterator(const sharded_cache* cache, std::size_t shard)
+        :   cache_(cache), shard_(shard)
+        {
+            if (shard_ < cache_->shards_.size())
+                position_ = cache_->shards_[shard_]->nodes.begin();
+            skipEmpty();
+        }
+
+        void skipEmpty()
+        {
+            while (shard_ < cache_->shards_.size() && position_ == cache_->shards_[shard_]->nodes.end())
+                if (++shard_ < cache_->shards_.size())
+                    position_ = cache_->shards_[shard_]->nodes.begin();
+        }
+
+        void increment() {++position_; skipEmpty();}
+        const Item& dereference() const {return position_->item;}
+
+        bool equal(const const_iterator& that) const
+        {
+            return shard_ == that.shard_ && (shard_ == cache_->shards_.size() || position_ == that.position_);
+        }
+
+        const sharded_cache* cache_;
+        std::size_t shard_;
+        typename node_list::const_iterator position_;
+    };
+
+    typedef const_iterator iterator;
+
+
+    /// creates a single-shard LRU cache holding up to max_items items
+    sharded_cache(std::size_t max_items) {configure(cache_config(max_items));}
+
+    sharded_cache(const cache_config& config) {configure(config);}
+
+    /// adds the item if its key is not cached, otherwise only marks the cached item as used;
+    /// returns true iff the item was added (like mru_list::insert)
+    bool insert(const item_type& item)
+    {
+        shard& s = shardFor(KeyExtractor()(item));
+        boost::lock_guard<boost::mutex> lock(s.mutex);
+
+        typename node_list::template nth_index<1>::type::iterator itr = s.nodes.template get<1>().find(KeyExtractor()(item));
+        if (itr != s.nodes.template get<1>().end())
+        {
+            touch(s, s.nodes.template project<0>(itr));
+            return false;
+        }
+
+        add(s, item);
+        return true;
+    }
+
+    /// adds the item, replacing any cached item with the same key
+    void put(const item_type& item)
+    {
+        shard& s = shardFor(KeyExtractor()(item));
+        boost::lock_guard<boost::mutex> lock(s.mutex);
+
+        typename node_list::template nth_index<1>::type::iterator itr = s.nodes.template get<1>().find(KeyExtractor()(item));
+        if (itr == s.nodes.template get<1>().end())
+        {
+            add(s, item);
+            return;
+        }
+
+        node_iterator position = s.nodes.template project<0>(itr);
+        std::size_t weight = weigher_(item);
+        s.weight = s.weight - position->weight + weight;
+        s.nodes.modify(position, replace_item(item, weight));
+        touch(s, position);
+        evict(s);
+    }
+
+    /// copies the cached item with the given key to result and marks it as used;
+    /// returns false if the key is not cached
+    bool get(const key_type& key, item_type& result)
+    {
+        shard& s = shardFor(key);
+        boost::lock_guard<boost::mutex> lock(s.mutex);
+
+        typename node_list::template nth_index<1>::type::iterator itr = s.nodes.template get<1>().find(key);
+        if (itr == s.nodes.template get<1>().end())
+        {
+            ++s.stats.misses;
+            return false;
+        }
+
+        ++s.stats.hits;
+        result = itr->item;
+        touch(s, s.nodes.template project<0>(itr));
+        return true;
+    }
+
+    /// removes the item with the given key; returns false if the key is not cached
+    bool erase(const key_type& key)
+    {
+        shard& s = shardFor(key);
+        boost::lock_guard<boost::mutex> lock(s.mutex);
+
+        typename node_list::template nth_index<1>::type::iterator itr = s.nodes.template get<1>().find(key);
+        if (itr == s.nodes.template get<1>().end())
+            return false;
+
+        remove(s, s.nodes.template project<0>(itr));
+        return true;
+    }
+
+    /// removes all items; the statistics are kept
+    void clear()
+    {
+        for (std::size_t i=0; i < shards_.size(); ++i)
+        {
+            shard& s = *shards_[i];
+            boost::lock_guard<boost::mutex> lock(s.mutex);
+            s.nodes.clear();
+            s.hand = s.nodes.end();
+            s.weight = 0;
+        }
+    }
+
+    bool empty() const {return size() == 0;}
+    std::size_t size() const {return statistics().items;}
+    std::size_t weight() const {return statistics().weight;}
+    std::size_t max_size() const {return config_.max_items > 0 ? config_.max_items : shards_[0]->nodes.max_size();}
+    std::size_t max_weight() const {return config_.max_weight;}
+    const cache_config& config() const {return config_;}
+
+    /// returns the counters summed over all shards
+    cache_statistics statistics() const
+    {
+        cache_statistics result;
+        for (std::size_t i=0; i < shards_.size(); ++i)
+        {
+            shard& s = *shards_[i];
+            boost::lock_guard<boost::mutex> lock(s.mutex);
+            result.hits += s.stats.hits;
+            result.misses += s.stats.misses;
+            result.insertions += s.stats.insertions;
+            result.evictions += s.stats.evictions;
+            result.items += s.nodes.size();
+            result.weight += s.weight;
+        }
+        return result;
+    }
+
+    /// the most recently used item (the cache must not be empty)
+    const item_type& mru() const {return mostOrLeastRecent(true);}
+
+    /// the least recently used item (the cache must not be empty)
+    const item_type& lru() const {return mostOrLeastRecent(false);}
+
+    const_iterator begin() const {return const_iterator(this, 0);}
+    const_iterator end() const {return const_iterator(this, shards_.size());}
+
+    private:
+
+    cache_config config_;
+    std::size_t shardMaxItems_, shardMaxWeight_;
+    std::vector<boost::shared_ptr<shard> > shards_;
+    Weigher weigher_;
+
+    void configure(const cache_config& config)
+    {
+        config_ = config;
+
+        // no more shards than items, so a small cache is not spread thinner than one item per shard
+        std::size_t shardCount = std::max<std::size_t>(1, config.shard_count);
+        if (config.max_items > 0)
+            shardCount = std::min(shardCount, config.max_items);
+        config_.shard_count = shardCount;
+
+        shardMaxItems_ = (config.max_items + shardCount - 1) / shardCount;
+        shardMaxWeight_ = (config.max_weight + shardCount - 1) / shardCount;
+        for (std::size_t i=0; i < shardCount; ++i)
+            shards_.push_back(boost::shared_ptr<shard>(new shard));
+    }
+
+    shard& shardFor(const key_type& key) const
+    {
+        if (shards_.size() == 1)
+            return *shards_[0];
+        return *shards_[boost::hash<key_type>()(key) % shards_.size()];
+    }
+
+    void touch(shard& s, node_iterator position)
+    {
+        position->lastAccess = ++s.tick;
+        switch (config_.policy)
+        {
+            case cache_eviction_lru:
+                s.nodes.relocate(s.nodes.begin(), position);
+                break;
+
+            case cache_eviction_clock:
+                position->referenced = true;
+                break;
+
+            case cache_eviction_lfu:
+                s.nodes.relocate(s.nodes.begin(), position);
+                s.nodes.modify(position, bump_frequency(s.tick));
+                break;
+        }
+    }
+
+    void add(shard& s, const item_type& item)
+    {
+        node n(item, weigher_(item), ++s.tick);
+
+        // a new CLOCK item goes just behind the hand, so it is the last one the hand reaches
+        if (config_.policy == cache_eviction_clock)
+            s.nodes.insert(s.hand, n);
+        else
+            s.nodes.push_front(n);
+
+        s.weight += n.weight;
+        ++s.stats.insertions;
+        evict(s);
+    }
+
+    void remove(shard& s, node_iterator position)
+    {
+        if (position == s.hand)
+            ++s.hand;
+        s.weight -= position->weight;
+        s.nodes.erase(position);
+    }
+
+    void evict(shard& s)
+    {
+        while (!s.nodes.empty() &&
+               ((shardMaxItems_ > 0 && s.nodes.size() > shardMaxItems_) ||
+                (shardMaxWeight_ > 0 && s.weight > shardMaxWeight_)))
+        {
+            node_iterator victim;
+            switch (config_.policy)
+            {
+                default:
+                case cache_eviction_lru:
+                    victim = --s.nodes.end();
+                    break;
+
+                case cache_eviction_lfu:
+                    victim = s.nodes.template project<0>(s.nodes.template get<2>().begin());
+                    break;
+
+                case cache_eviction_clock:
+                    // give each referenced item a second chance
+                    for (;;)
+                    {
+                        if (s.hand == s.nodes.end())
+                            s.hand = s.nodes.begin();
+                        if (!s.hand->referenced)
+                            break;
+                        s.hand->referenced = false;
+                        ++s.hand;
+                    }
+                    victim = s.hand;
+                    break;
+            }
+
+            remove(s, victim);
+            ++s.stats.evictions;
+        }
+    }
+
+    const item_type& mostOrLeastRecent(bool most) const
+    {
+        const node* result = 0;
+        for (std::size_t i=0; i < shards_.size(); ++i)
+            for (typename node_list::const_iterator itr = shards_[i]->nodes.begin(); itr != shards_[i]->nodes.end(); ++itr)
+                if (!result || (most ? itr->lastAccess > result->lastAccess : itr->lastAccess < result->lastAccess))
+                    result = &*itr;
+        return result->item;
+    }
+
+    sharded_cache(const sharded_cache&);
+    sharded_cache& operator=(const sharded_cache&);
+};
+
+
+} // namespace util
+} // namespace pwiz
+
+
+#endif // _SHARDED_CACHE_HPP_
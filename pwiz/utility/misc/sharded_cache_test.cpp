@@ -0,0 +1,270 @@
+//
+// $Id$
+//
+//
+// Original author: agent <agent <a.t> local>
+//
+// Copyright 2026 agent
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#include "Std.hpp"
+#include "sharded_cache.hpp"
+#include "pwiz/utility/misc/unit.hpp"
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include <numeric>
+
+using namespace pwiz::util;
+
+
+struct KeyValue
+{
+    KeyValue(int key = 0, const string& value = "") : key(key), value(value) {}
+    int key;
+    string value;
+};
+
+struct ValueLength
+{
+    size_t operator()(const KeyValue& kv) const {return kv.value.length();}
+};
+
+typedef sharded_cache<KeyValue, boost::multi_index::member<KeyValue, int, &KeyValue::key>, ValueLength> KeyValueCache;
+
+
+set<int> keys(const KeyValueCache& cache)
+{
+    set<int> result;
+    for (KeyValueCache::const_iterator itr = cache.begin(); itr != cache.end(); ++itr)
+        result.insert(itr->key);
+    return result;
+}
+
+set<int> keys(int a, int b, int c)
+{
+    set<int> result;
+    result.insert(a); result.insert(b); result.insert(c);
+    return result;
+}
+
+
+// with one shard and LRU eviction, it behaves like mru_list
+void testLRU()
+{
+    sharded_cache<string> cache(5);
+
+    cache.insert("Fighting");
+    cache.insert("Fu");
+    cache.insert("Kung");
+    cache.insert("Was");
+    cache.insert("Everybody");
+
+    unit_assert_operator_equal(5, cache.size());
+    unit_assert_operator_equal("Everybody", *cache.begin());
+    unit_assert_operator_equal("Everybody", cache.mru());
+    unit_assert_operator_equal("Fighting", cache.lru());
+
+    // set "Fighting" as MRU item
+    unit_assert(!cache.insert("Fighting"));
+
+    unit_assert_operator_equal(5, cache.size());
+    unit_assert_operator_equal("Fighting", cache.mru());
+    unit_assert_operator_equal("Fu", cache.lru());
+
+    // pop LRU item "Fu"
+    unit_assert(cache.insert("Wax on, wax off"));
+
+    unit_assert_operator_equal(5, cache.size());
+    unit_assert_operator_equal("Wax on, wax off", cache.mru());
+    unit_assert_operator_equal("Kung", cache.lru());
+
+    string result;
+    unit_assert(!cache.get("Fu", result));
+    unit_assert(cache.get("Kung", result));
+    unit_assert_operator_equal("Kung", result);
+    unit_assert_operator_equal("Kung", cache.mru());
+    unit_assert_operator_equal("Was", cache.lru());
+
+    unit_assert(cache.erase("Was"));
+    unit_assert(!cache.erase("Was"));
+    unit_assert_operator_equal(4, cache.size());
+
+    cache.clear();
+    unit_assert(cache.empty());
+}
+
+
+void testWeight()
+{
+    KeyValueCache cache(cache_config(0, 10));
+
+    cache.put(KeyValue(1, "aaaa"));
+    cache.put(KeyValue(2, "bbbb"));
+    unit_assert_operator_equal(8, cache.weight());
+
+    // replacing an item updates its weight
+    cache.put(KeyValue(1, "a"));
+    unit_assert_operator_equal(5, cache.weight());
+    KeyValue result;
+    unit_assert(cache.get(1, result));
+    unit_assert_operator_equal("a", result.value);
+
+    // over the limit, the least recently used go first
+    cache.put(KeyValue(3, "cccccc"));
+    unit_assert_operator_equal(2, cache.size());
+    unit_assert(!cache.get(2, result));
+    unit_assert_operator_equal(7, cache.weight());
+
+    // an item heavier than the whole cache is not kept
+    cache.put(KeyValue(4, "dddddddddddd"));
+    unit_assert(cache.empty());
+    unit_assert_operator_equal(0, cache.weight());
+
+    cache_statistics stats = cache.statistics();
+    unit_assert_operator_equal(1, stats.hits);
+    unit_assert_operator_equal(1, stats.misses);
+    unit_assert_operator_equal(4, stats.insertions);
+    unit_assert_operator_equal(4, stats.evictions);
+    unit_assert_operator_equal(0, stats.items);
+}
+
+
+void testClock()
+{
+    KeyValueCache cache(cache_config(3, 0, 1, cache_eviction_clock));
+    KeyValue result;
+
+    cache.put(KeyValue(1, "a"));
+    cache.put(KeyValue(2, "b"));
+    cache.put(KeyValue(3, "c"));
+    unit_assert(cache.get(1, result));
+
+    // 1 was referenced, so it gets a second chance and 2 is evicted
+    cache.put(KeyValue(4, "d"));
+    unit_assert(keys(cache) == keys(1, 3, 4));
+
+    // the hand moves on from where it stopped
+    cache.put(KeyValue(5, "e"));
+    unit_assert(keys(cache) == keys(1, 4, 5));
+}
+
+
+void testLFU()
+{
+    KeyValueCache cache(cache_config(3, 0, 1, cache_eviction_lfu));
+    KeyValue result;
+
+    cache.put(KeyValue(1, "a"));
+    cache.put(KeyValue(2, "b"));
+    cache.put(KeyValue(3, "c"));
+    cache.get(1, result);
+    cache.get(1, result);
+    cache.get(2, result);
+
+    // 3 and 4 are both used once, and 3 is older
+    cache.put(KeyValue(4, "d"));
+    unit_assert(keys(cache) == keys(1, 2, 4));
+
+    cache.put(KeyValue(5, "e"));
+    unit_assert(keys(cache) == keys(1, 2, 5));
+}
+
+
+void testShards()
+{
+    // limits are split between the shards
+    KeyValueCache cache(cache_config(100, 0, 8));
+    unit_assert_operator_equal(8, cache.config().shard_count);
+
+    for (int i=0; i < 1000; ++i)
+        cache.put(KeyValue(i, "x"));
+    unit_assert(cache.size() <= 8 * ((100 + 7) / 8));
+    unit_assert(cache.size() >= 50);
+    unit_assert_operator_equal(cache.size(), (size_t) std::distance(cache.begin(), cache.end()));
+    unit_assert_operator_equal(cache.size(), cache.weight());
+
+    // never more shards than items
+    KeyValueCache smallCache(cache_config(2, 0, 8));
+    unit_assert_operator_equal(2, smallCache.config().shard_count);
+}
+
+
+void hammer(KeyValueCache* cache, int seed, size_t* gets)
+{
+    for (int i=0; i < 20000; ++i)
+    {
+        int key = (i * 7919 + seed * 104729) % 500;
+        KeyValue result;
+        if (cache->get(key, result))
+            unit_assert_operator_equal(lexical_cast<string>(key), result.value);
+        else
+            cache->put(KeyValue(key, lexical_cast<string>(key)));
+        ++*gets;
+    }
+}
+
+
+void testConcurrency(cache_eviction_policy policy)
+{
+    KeyValueCache cache(cache_config(200, 0, 8, policy));
+
+    const int threadCount = 4;
+    vector<size_t> gets(threadCount, 0);
+    boost::thread_group threads;
+    for (int i=0; i < threadCount; ++i)
+        threads.create_thread(boost::bind(&hammer, &cache, i, &gets[i]));
+    threads.join_all();
+
+    cache_statistics stats = cache.statistics();
+    unit_assert_operator_equal(accumulate(gets.begin(), gets.end(), (size_t) 0), stats.hits + stats.misses);
+    unit_assert(stats.hits > 0);
+    unit_assert(cache.size() <= 200);
+    unit_assert_operator_equal(stats.insertions - stats.evictions, cache.size());
+}
+
+
+void test()
+{
+    testLRU();
+    testWeight();
+    testClock();
+    testLFU();
+    testShards();
+    testConcurrency(cache_eviction_lru);
+    testConcurrency(cache_eviction_clock);
+    testConcurrency(cache_eviction_lfu);
+}
+
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(argc, argv)
+
+    try
+    {
+        test();
+    }
+    catch (exception& e)
+    {
+        TEST_FAILED(e.what())
+    }
+    catch (...)
+    {
+        TEST_FAILED("Caught unknown exception.")
+    }
+
+    TEST_EPILOG
+}
@@ -37,6 +37,7 @@
 #include "boost/atomic.hpp"
 #include "boost/thread.hpp"
 #include "boost/make_shared.hpp"
+#include "boost/unordered_map.hpp"
 #include <deque>
 #include <algorithm>
 
@@ -62,13 +63,8 @@ static bool isPathOnFixedDrive(const std::string& path)
 
 namespace {
 
+// ProteinMergeMap is filled from MergeTargetState::proteinIdByAccession
 boost::format mergeProteinsSql(
-    "DROP TABLE IF EXISTS ProteinMergeMap;\n"
-    "CREATE TABLE ProteinMergeMap(BeforeMergeId INTEGER PRIMARY KEY, AfterMergeId INT);\n"
-    "INSERT INTO ProteinMergeMap\n"
-    "    SELECT newPro.Id, IFNULL(oldPro.Id, newPro.Id + %1%)\n"
-    "    FROM %2%.Protein newPro\n"
-    "    LEFT JOIN merged.Protein oldPro ON newPro.Accession = oldPro.Accession;\n"
     "CREATE UNIQUE INDEX ProteinMergeMap_Index2 ON ProteinMergeMap(AfterMergeId);\n"
     "\n"
     "DROP TABLE IF EXISTS NewProteins;\n"
@@ -90,13 +86,13 @@ boost::format mergePeptideInstancesSql(
     "    AND newInstance.Length = oldInstance.Length\n"
     "    AND newInstance.Offset = oldInstance.Offset;\n"
     "INSERT INTO PeptideInstanceMergeMap\n"
-    "    SELECT newInstance.Id, MIN(IFNULL(oldInstance.Id, newInstance.Id + %1%)), IFNULL(oldInstance.Protein, proMerge.AfterMergeId), newInstance.Peptide, MIN(IFNULL(oldPeptide.Id, newInstance.Peptide + %2%))\n"
+    "    SELECT newInstance.Id, MIN(IFNULL(oldInstance.Id, newInstance.Id + %1%)), IFNULL(oldInstance.Protein, proMerge.AfterMergeId), newInstance.Peptide, MIN(IFNULL(dpMerge.AfterMergePeptide, newInstance.Peptide + %2%))\n"
     "    FROM ProteinMergeMap proMerge\n"
     "    JOIN %3%.PeptideInstance newInstance ON proMerge.BeforeMergeId = newInstance.Protein\n"
     "    AND newInstance.Offset IS NULL\n"
     "    JOIN %3%.Peptide newPeptide ON newInstance.Peptide = newPeptide.Id\n"
-    "    LEFT JOIN merged.Peptide oldPeptide ON newPeptide.DecoySequence = oldPeptide.DecoySequence\n"
-    "    LEFT JOIN merged.PeptideInstance oldInstance ON oldPeptide.Id = oldInstance.Peptide\n"
+    "    LEFT JOIN DecoyPeptideMergeMap dpMerge ON newPeptide.Id = dpMerge.BeforeMergePeptide\n"
+    "    LEFT JOIN merged.PeptideInstance oldInstance ON dpMerge.AfterMergePeptide = oldInstance.Peptide\n"
     "    AND proMerge.AfterMergeId = oldInstance.Protein\n"
     "    GROUP BY newInstance.Id;\n"
     "\n"
@@ -318,6 +314,59 @@ boost::format getNewMaxIdsSql(
     "       (SELECT IFNULL(MAX(Id), 0) FROM %1%.Analysis)\n");
 
 
+// the indexes on the merge target that the merge-map queries use; other indexes can be dropped while merging
+const char* mergeLookupIndexes[] =
+{
+    "PeptideInstance_PeptideProtein",
+    "PeptideInstance_ProteinOffsetLength",
+    "SpectrumSourceGroupLink_SourceGroup",
+    "Spectrum_SourceNativeID"
+};
+
+
+/// what a merge knows about its target, kept with a temporary target for the next merge into it
+struct MergeTargetState
+{
+    MergeTargetState(bool deferIndexes = false) : initialized(false), deferIndexes(deferIndexes) {}
+
+    /// the target's schema is updated and its filters, gene metadata and quantitation are dropped
+    bool initialized;
+
+    /// if true, indexes not in mergeLookupIndexes are dropped from the target and must be created by createDeferredIndexes()
+    bool deferIndexes;
+
+    /// CREATE statements of the dropped indexes, by name
+    map<string, string> deferredIndexes;
+
+    /// merged proteins and decoy peptides by their merge keys
+    boost::unordered_map<string, sqlite3_int64> proteinIdByAccession;
+    boost::unordered_map<string, vector<sqlite3_int64> > peptideIdsByDecoySequence;
+};
+
+
+void createDeferredIndexes(const string& idpDbFilepath, const map<string, string>& deferredIndexes)
+{
+    if (deferredIndexes.empty())
+        return;
+
+    sqlite3pp::database db(idpDbFilepath);
+    db.execute("PRAGMA journal_mode=OFF; PRAGMA synchronous=OFF; PRAGMA cache_size=30000");
+
+    set<string> existingIndexes;
+    {
+        sqlite3pp::query indexQuery(db, "SELECT name FROM sqlite_master WHERE type='index'");
+        BOOST_FOREACH(sqlite3pp::query::rows row, indexQuery)
+            existingIndexes.insert(row.get<string>(0));
+    }
+
+    sqlite3pp::transaction transaction(db);
+    BOOST_FOREACH_FIELD((const string& name)(const string& sql), deferredIndexes)
+        if (!existingIndexes.count(name))
+            db.execute(sql);
+    transaction.commit();
+}
+
+
 class TemporaryFile
 {
     public:
@@ -352,21 +401,25 @@ struct Merger::Impl
     static int mergedCacheSize;
     static int newCacheSize;
 
-    /// Merge one or more idpDBs into a target idpDB.
-    Impl(const string& mergeTargetFilepath, const vector<string>& mergeSourceFilepaths)
-        : tempMergeTargetFile(".idpDB")
+    /// Merge one or more idpDBs into a target idpDB; if the target was merged into before, pass the state of that merge.
+    Impl(const string& mergeTargetFilepath, const vector<string>& mergeSourceFilepaths,
+         const boost::shared_ptr<MergeTargetState>& targetState = boost::shared_ptr<MergeTargetState>())
+        : tempMergeTargetFile(".idpDB"), targetState(targetState)
     {
         this->mergeTargetFilepath = mergeTargetFilepath;
         this->mergeSourceFilepaths = mergeSourceFilepaths;
         this->mergeSourceConnection = NULL;
         totalSourceFiles = mergeSourceFilepaths.size();
 
+        if (!this->targetState)
+            this->targetState.reset(new MergeTargetState);
+
         initializeSqlFormats();
     }
 
     /// Merge an idpDB connection (either file or in-memory) to a target idpDB file.
     Impl(const string& mergeTargetFilepath, sqlite3* mergeSourceConnection)
-        : tempMergeTargetFile(".idpDB")
+        : tempMergeTargetFile(".idpDB"), targetState(new MergeTargetState)
     {
         this->mergeTargetFilepath = mergeTargetFilepath;
         this->mergeSourceConnection = mergeSourceConnection;
@@ -521,11 +574,15 @@ struct Merger::Impl
             bfs::copy_file(mergeTargetFilepath, tempMergeTargetFilepath);
         }
 
-        // update target database schema
-        SchemaUpdater::update(tempMergeTargetFilepath, ilr);
+        // a target that was merged into before is already prepared
+        if (!targetState->initialized)
+        {
+            // update target database schema
+            SchemaUpdater::update(tempMergeTargetFilepath, ilr);
 
-        Qonverter::dropFilters(tempMergeTargetFilepath);
-        Embedder::dropGeneMetadata(tempMergeTargetFilepath);
+            Qonverter::dropFilters(tempMergeTargetFilepath);
+            Embedder::dropGeneMetadata(tempMergeTargetFilepath);
+        }
 
         string sqliteSafeMergeTargetFilepath = bal::replace_all_copy(tempMergeTargetFilepath, "'", "''");
 
@@ -533,6 +590,28 @@ struct Merger::Impl
         db.executef("PRAGMA journal_mode=OFF; PRAGMA synchronous=OFF; PRAGMA page_size=32768; PRAGMA cache_size=%d", tempCacheSize);
         db.executef("PRAGMA merged.journal_mode=OFF; PRAGMA merged.synchronous=OFF; PRAGMA merged.cache_size=%d", mergedCacheSize);
 
+        if (!targetState->initialized)
+            prepareTarget(db, biggestSourceFilepath);
+
+        string sql = (getNewMaxIdsSql % "merged").str();
+        sqlite3pp::query maxIdRowQuery(db, sql.c_str());
+        sqlite3pp::query::rows maxIdRow = *maxIdRowQuery.begin();
+        MaxProteinId = maxIdRow.get<sqlite3_int64>(0);
+        MaxPeptideInstanceId = maxIdRow.get<sqlite3_int64>(1);
+        MaxPeptideId = maxIdRow.get<sqlite3_int64>(2);
+        MaxPeptideSpectrumMatchId = maxIdRow.get<sqlite3_int64>(3);
+        MaxPeptideSpectrumMatchScoreNameId = maxIdRow.get<sqlite3_int64>(4);
+        MaxPeptideModificationId = maxIdRow.get<sqlite3_int64>(5);
+        MaxModificationId = maxIdRow.get<sqlite3_int64>(6);
+        MaxSpectrumSourceGroupId = maxIdRow.get<sqlite3_int64>(7);
+        MaxSpectrumSourceId = maxIdRow.get<sqlite3_int64>(8);
+        MaxSpectrumSourceGroupLinkId = maxIdRow.get<sqlite3_int64>(9);
+        MaxSpectrumId = maxIdRow.get<sqlite3_int64>(10);
+        MaxAnalysisId = maxIdRow.get<sqlite3_int64>(11);
+    }
+
+    void prepareTarget(sqlite3pp::database& db, const string& biggestSourceFilepath)
+    {
         if (!biggestSourceFilepath.empty()) // if there is a biggest source, it means the target filepath did not exist
         {
             try
@@ -560,21 +639,48 @@ struct Merger::Impl
         db.execute("UPDATE SpectrumSource SET QuantitationMethod = 0");
         db.execute("DELETE FROM SpectrumQuantitation");
 
-        string sql = (getNewMaxIdsSql % "merged").str();
-        sqlite3pp::query maxIdRowQuery(db, sql.c_str());
-        sqlite3pp::query::rows maxIdRow = *maxIdRowQuery.begin();
-        MaxProteinId = maxIdRow.get<sqlite3_int64>(0);
-        MaxPeptideInstanceId = maxIdRow.get<sqlite3_int64>(1);
-        MaxPeptideId = maxIdRow.get<sqlite3_int64>(2);
-        MaxPeptideSpectrumMatchId = maxIdRow.get<sqlite3_int64>(3);
-        MaxPeptideSpectrumMatchScoreNameId = maxIdRow.get<sqlite3_int64>(4);
-        MaxPeptideModificationId = maxIdRow.get<sqlite3_int64>(5);
-        MaxModificationId = maxIdRow.get<sqlite3_int64>(6);
-        MaxSpectrumSourceGroupId = maxIdRow.get<sqlite3_int64>(7);
-        MaxSpectrumSourceId = maxIdRow.get<sqlite3_int64>(8);
-        MaxSpectrumSourceGroupLinkId = maxIdRow.get<sqlite3_int64>(9);
-        MaxSpectrumId = maxIdRow.get<sqlite3_int64>(10);
-        MaxAnalysisId = maxIdRow.get<sqlite3_int64>(11);
+        if (targetState->deferIndexes)
+            dropDeferredIndexes(db);
+
+        updateKeyMaps(db, 0, 0);
+        targetState->initialized = true;
+    }
+
+    // drops the target's indexes that the merge-map queries don't use; they are created again by createDeferredIndexes()
+    void dropDeferredIndexes(sqlite3pp::database& db)
+    {
+        vector<pair<string, string> > indexes;
+        {
+            sqlite3pp::query indexQuery(db, "SELECT name, sql FROM merged.sqlite_master WHERE type='index' AND sql IS NOT NULL");
+            BOOST_FOREACH(sqlite3pp::query::rows row, indexQuery)
+            {
+                string name = row.get<string>(0);
+                if (std::find(mergeLookupIndexes, mergeLookupIndexes + sizeof(mergeLookupIndexes) / sizeof(char*), name) == mergeLookupIndexes + sizeof(mergeLookupIndexes) / sizeof(char*))
+                    indexes.push_back(make_pair(name, row.get<string>(1)));
+            }
+        }
+
+        typedef pair<string, string> IndexPair;
+        BOOST_FOREACH(const IndexPair& index, indexes)
+        {
+            targetState->deferredIndexes[index.first] = index.second;
+            db.execute("DROP INDEX merged." + index.first);
+        }
+    }
+
+    // adds the target's proteins and decoy peptides with Ids above the given ones to the key maps
+    void updateKeyMaps(sqlite3pp::database& db, sqlite3_int64 maxOldProteinId, sqlite3_int64 maxOldPeptideId)
+    {
+        string sql = "SELECT Id, Accession FROM merged.Protein WHERE Id > " + lexical_cast<string>(maxOldProteinId);
+        sqlite3pp::query proteinQuery(db, sql.c_str());
+        BOOST_FOREACH(sqlite3pp::query::rows row, proteinQuery)
+            if (row.column_type(1) != SQLITE_NULL)
+                targetState->proteinIdByAccession.insert(make_pair(row.get<string>(1), row.get<sqlite3_int64>(0)));
+
+        sql = "SELECT Id, DecoySequence FROM merged.Peptide WHERE Id > " + lexical_cast<string>(maxOldPeptideId) + " AND DecoySequence IS NOT NULL ORDER BY Id";
+        sqlite3pp::query peptideQuery(db, sql.c_str());
+        BOOST_FOREACH(sqlite3pp::query::rows row, peptideQuery)
+            targetState->peptideIdsByDecoySequence[row.get<string>(1)].push_back(row.get<sqlite3_int64>(0));
     }
 
     void mergeFiles()
@@ -665,6 +771,7 @@ struct Merger::Impl
                 throw runtime_error("Error merging " + mergeSourceFilepath + ": " + e.what());
             }
 
+            updateKeyMaps(inMemoryDb, MaxProteinId, MaxPeptideId);
             getNewMaxIds(inMemoryDb);
             transaction.commit();
             inMemoryDb.execute("DETACH DATABASE new");
@@ -738,8 +845,59 @@ struct Merger::Impl
             bfs::copy_file(tempMergeTargetFilepath, mergeTargetFilepath);
     }
 
-    void mergeProteins(sqlite3pp::database& db) { db.execute((mergeProteinsSql % MaxProteinId % mergeSourceDatabase).str()); }
-    void mergePeptideInstances(sqlite3pp::database& db) { db.execute((mergePeptideInstancesSql % MaxPeptideInstanceId % MaxPeptideId % mergeSourceDatabase).str()); }
+    void mergeProteins(sqlite3pp::database& db)
+    {
+        // map source proteins to target proteins with the same accession, or to new Ids
+        db.execute("DROP TABLE IF EXISTS ProteinMergeMap;"
+                   "CREATE TABLE ProteinMergeMap (BeforeMergeId INTEGER PRIMARY KEY, AfterMergeId INT)");
+        {
+            sqlite3pp::command insertMapping(db, "INSERT INTO ProteinMergeMap VALUES (?,?)");
+            sqlite3pp::query proteinQuery(db, ("SELECT Id, Accession FROM " + mergeSourceDatabase + ".Protein").c_str());
+            BOOST_FOREACH(sqlite3pp::query::rows row, proteinQuery)
+            {
+                sqlite3_int64 id = row.get<sqlite3_int64>(0);
+                sqlite3_int64 afterMergeId = id + MaxProteinId;
+                if (row.column_type(1) != SQLITE_NULL)
+                {
+                    boost::unordered_map<string, sqlite3_int64>::const_iterator findItr = targetState->proteinIdByAccession.find(row.get<string>(1));
+                    if (findItr != targetState->proteinIdByAccession.end())
+                        afterMergeId = findItr->second;
+                }
+                insertMapping.binder() << id << afterMergeId;
+                insertMapping.execute();
+                insertMapping.reset();
+            }
+        }
+        db.execute((mergeProteinsSql % MaxProteinId).str());
+    }
+
+    void mergePeptideInstances(sqlite3pp::database& db)
+    {
+        // map source decoy peptides to the target decoy peptides with the same sequence
+        db.execute("DROP TABLE IF EXISTS DecoyPeptideMergeMap;"
+                   "CREATE TABLE DecoyPeptideMergeMap (BeforeMergePeptide INT, AfterMergePeptide INT)");
+        {
+            sqlite3pp::command insertMapping(db, "INSERT INTO DecoyPeptideMergeMap VALUES (?,?)");
+            sqlite3pp::query peptideQuery(db, ("SELECT Id, DecoySequence FROM " + mergeSourceDatabase + ".Peptide WHERE DecoySequence IS NOT NULL").c_str());
+            BOOST_FOREACH(sqlite3pp::query::rows row, peptideQuery)
+            {
+                boost::unordered_map<string, vector<sqlite3_int64> >::const_iterator findItr = targetState->peptideIdsByDecoySequence.find(row.get<string>(1));
+                if (findItr == targetState->peptideIdsByDecoySequence.end())
+                    continue;
+
+                sqlite3_int64 id = row.get<sqlite3_int64>(0);
+                BOOST_FOREACH(sqlite3_int64 afterMergeId, findItr->second)
+                {
+                    insertMapping.binder() << id << afterMergeId;
+                    insertMapping.execute();
+                    insertMapping.reset();
+                }
+            }
+        }
+        db.execute("CREATE INDEX DecoyPeptideMergeMap_Index1 ON DecoyPeptideMergeMap (BeforeMergePeptide)");
+        db.execute((mergePeptideInstancesSql % MaxPeptideInstanceId % MaxPeptideId % mergeSourceDatabase).str());
+    }
+
     void mergeAnalyses(sqlite3pp::database& db) { db.execute((mergeAnalysesSql % MaxAnalysisId % mergeSourceDatabase).str()); }
     void mergeSpectrumSourceGroups(sqlite3pp::database& db) { db.execute((mergeSpectrumSourceGroupsSql % MaxSpectrumSourceGroupId % mergeSourceDatabase).str()); }
     void mergeSpectrumSources(sqlite3pp::database& db) { db.execute((mergeSpectrumSourcesSql % MaxSpectrumSourceId % mergeSourceDatabase).str()); }
@@ -836,6 +994,7 @@ struct Merger::Impl
     vector<string> mergeSourceFilepaths;
     sqlite3* mergeSourceConnection;
     string mergeSourceDatabase;
+    boost::shared_ptr<MergeTargetState> targetState;
 
     sqlite3_int64 MaxProteinId;
     sqlite3_int64 MaxPeptideInstanceId;
@@ -866,7 +1025,8 @@ Merger::~Merger()
 struct MergeTask
 {
     MergeTask() {};
-    MergeTask(const string& sourceFilepath, bool isTemporary) : mergeSourceFilepath(sourceFilepath), isTemporary(isTemporary) {}
+    MergeTask(const string& sourceFilepath, bool isTemporary, const boost::shared_ptr<MergeTargetState>& targetState = boost::shared_ptr<MergeTargetState>())
+        : mergeSourceFilepath(sourceFilepath), isTemporary(isTemporary), targetState(targetState) {}
     ~MergeTask()
     {
         if (isTemporary && bfs::exists(mergeSourceFilepath))
@@ -875,6 +1035,7 @@ struct MergeTask
 
     string mergeSourceFilepath;
     bool isTemporary;
+    boost::shared_ptr<MergeTargetState> targetState; // set for temporary files, which keep their key maps between merges
 };
 
 struct ThreadStatus
@@ -897,6 +1058,7 @@ void executePairwiseFileMergerTask(std::deque<shared_ptr<MergeTask> >& sourceQue
         while (true)
         {
             string tempMergeTargetFilepath;
+            boost::shared_ptr<MergeTargetState> targetState;
             bool newTemporaryCreated = false;
 
             // pop two sources from the queue; return if the queue only has one source
@@ -917,19 +1079,21 @@ void executePairwiseFileMergerTask(std::deque<shared_ptr<MergeTask> >& sourceQue
                 sourceFilepaths[0] = mergeTasks[0]->mergeSourceFilepath;
                 sourceFilepaths[1] = mergeTasks[1]->mergeSourceFilepath;
                 tempMergeTargetFilepath = (bfs::temp_directory_path() / bfs::unique_path("%%%%%%%%%%%%%%%%.idpDB")).string();
+                targetState = boost::make_shared<MergeTargetState>(true);
                 newTemporaryCreated = true;
             }
-            else if (mergeTasks[0]->isTemporary)
-            {
-                sourceFilepaths.resize(1);
-                sourceFilepaths[0] = mergeTasks[1]->mergeSourceFilepath;
-                tempMergeTargetFilepath = mergeTasks[0]->mergeSourceFilepath;
-            }
-            else // mergeTasks[1]->isTemporary
+            else
             {
+                const shared_ptr<MergeTask>& targetTask = mergeTasks[0]->isTemporary ? mergeTasks[0] : mergeTasks[1];
+                const shared_ptr<MergeTask>& sourceTask = mergeTasks[0]->isTemporary ? mergeTasks[1] : mergeTasks[0];
                 sourceFilepaths.resize(1);
-                sourceFilepaths[0] = mergeTasks[0]->mergeSourceFilepath;
-                tempMergeTargetFilepath = mergeTasks[1]->mergeSourceFilepath;
+                sourceFilepaths[0] = sourceTask->mergeSourceFilepath;
+                tempMergeTargetFilepath = targetTask->mergeSourceFilepath;
+                targetState = targetTask->targetState;
+
+                // a temporary source's deferred indexes are still needed in the final file
+                if (sourceTask->targetState)
+                    targetState->deferredIndexes.insert(sourceTask->targetState->deferredIndexes.begin(), sourceTask->targetState->deferredIndexes.end());
             }
 
             /*{
@@ -937,7 +1101,7 @@ void executePairwiseFileMergerTask(std::deque<shared_ptr<MergeTask> >& sourceQue
                 cout << "Thread " << boost::this_thread::get_id() << " starts merging " << bal::join(sourceFilepaths, " and ") << " to " << tempMergeTargetFilepath << endl;
             }*/
 
-            Merger::Impl impl(tempMergeTargetFilepath, sourceFilepaths);
+            Merger::Impl impl(tempMergeTargetFilepath, sourceFilepaths, targetState);
             impl.merge();
 
             /*{
@@ -958,7 +1122,7 @@ void executePairwiseFileMergerTask(std::deque<shared_ptr<MergeTask> >& sourceQue
                     ++filesMerged;
 
                 if (newTemporaryCreated)
-                    sourceQueue.push_front(boost::make_shared<MergeTask>(tempMergeTargetFilepath, true));
+                    sourceQueue.push_front(boost::make_shared<MergeTask>(tempMergeTargetFilepath, true, targetState));
                 else if (mergeTasks[0]->isTemporary)
                     sourceQueue.push_front(mergeTasks[0]);
                 else // mergeTasks[1]->isTemporary
@@ -1032,6 +1196,10 @@ void Merger::merge(const string& mergeTargetFilepath, const std::vector<string>&
         if (sourceQueue.size() > 1)
             throw runtime_error("[Merger::merge] there is more than one file left in the queue: something went wrong with the multi-threaded merge");
 
+        // the temporary files were merged without their indexes, so create them once at the end
+        if (sourceQueue.front()->targetState)
+            createDeferredIndexes(sourceQueue.front()->mergeSourceFilepath, sourceQueue.front()->targetState->deferredIndexes);
+
         sourceQueue.front()->isTemporary = false;
         try
         {
@@ -40,9 +40,12 @@
 #include "boost/foreach_field.hpp"
 #include "boost/thread/thread.hpp"
 #include "boost/thread/mutex.hpp"
+#include "boost/thread/condition_variable.hpp"
 #include "boost/atomic.hpp"
 #include "boost/exception/all.hpp"
 #include "boost/range/algorithm/set_algorithm.hpp"
+#include "boost/variant.hpp"
+#include "boost/scoped_ptr.hpp"
 #include "Logger.hpp"
 
 
@@ -364,6 +367,106 @@ void findDistinctAnalyses(const vector<string>& inputFilepaths,
 }
 
 
+// buffers the rows of an INSERT and writes them with a prepared multi-row INSERT (many rows per statement step)
+// instead of stepping a statement for every row; call flush() after the last row (before the transaction commits)
+class BulkInsertCommand : boost::noncopyable
+{
+    public:
+
+    typedef boost::variant<sqlite::null_type, int, sqlite3_int64, double, string> Value;
+
+    /// insertPrefix is e.g. "INSERT INTO Foo (Id, Bar, Baz) VALUES " and rowValues is e.g. "(?,1,?)"
+    BulkInsertCommand(sqlite::database& db, const string& insertPrefix, const string& rowValues)
+    :   db_(db), insertPrefix_(insertPrefix), rowValues_(rowValues),
+        parameterCount_((int) std::count(rowValues.begin(), rowValues.end(), '?'))
+    {
+        if (parameterCount_ == 0)
+            throw runtime_error("[BulkInsertCommand] no parameters in row values: " + rowValues);
+
+        // stay under SQLite's default limit of 999 parameters per statement
+        rowsPerInsert_ = max(1, min(500, 999 / parameterCount_));
+        values_.reserve(rowsPerInsert_ * parameterCount_);
+        fullInsert_.reset(new sqlite::command(db_, sql(rowsPerInsert_).c_str()));
+    }
+
+    template <typename T>
+    BulkInsertCommand& operator<< (const T& value) { values_.push_back(Value(value)); return *this; }
+    BulkInsertCommand& operator<< (sqlite::null_type) { values_.push_back(Value()); return *this; }
+    BulkInsertCommand& operator<< (bool value) { values_.push_back(Value((int) value)); return *this; }
+    BulkInsertCommand& operator<< (char value) { values_.push_back(Value(string(1, value))); return *this; }
+    BulkInsertCommand& operator<< (const char* value) { values_.push_back(Value(string(value))); return *this; }
+
+    /// ends the current row; the buffered rows are inserted when there are enough for a full statement
+    void endRow()
+    {
+        if (values_.size() % parameterCount_ != 0)
+            throw runtime_error("[BulkInsertCommand] wrong number of values for row: " + insertPrefix_ + rowValues_);
+
+        if (values_.size() == (size_t) rowsPerInsert_ * parameterCount_)
+            flush();
+    }
+
+    /// inserts the buffered rows
+    void flush()
+    {
+        int rowCount = (int) values_.size() / parameterCount_;
+        if (rowCount == 0)
+            return;
+
+        // the last, partial batch gets its own statement
+        boost::scoped_ptr<sqlite::command> partialInsert;
+        sqlite::command* insert = fullInsert_.get();
+        if (rowCount < rowsPerInsert_)
+        {
+            partialInsert.reset(new sqlite::command(db_, sql(rowCount).c_str()));
+            insert = partialInsert.get();
+        }
+
+        for (size_t i=0; i < values_.size(); ++i)
+            boost::apply_visitor(ValueBinder(*insert, (int) i + 1), values_[i]);
+
+        if (insert->execute() != SQLITE_OK)
+        {
+            // resetting the statement gets the specific error (and keeps its destructor from throwing)
+            insert->reset();
+            throw sqlite::database_error(db_);
+        }
+        insert->reset();
+        values_.clear();
+    }
+
+    private:
+
+    struct ValueBinder : public boost::static_visitor<>
+    {
+        ValueBinder(sqlite::command& insert, int index) : insert(insert), index(index) {}
+
+        template <typename T>
+        void operator() (const T& value) const { insert.binder(index) << value; }
+
+        sqlite::command& insert;
+        int index;
+    };
+
+    string sql(int rowCount) const
+    {
+        string result = insertPrefix_;
+        result.reserve(insertPrefix_.length() + rowCount * (rowValues_.length() + 1));
+        for (int i=0; i < rowCount; ++i)
+            result += (i > 0 ? "," : "") + rowValues_;
+        return result;
+    }
+
+    sqlite::database& db_;
+    string insertPrefix_;
+    string rowValues_;
+    int parameterCount_;
+    int rowsPerInsert_;
+    boost::scoped_ptr<sqlite::command> fullInsert_;
+    vector<Value> values_;
+};
+
+
 struct ParserImpl
 {
     const string& inputFilepath;
@@ -559,17 +662,17 @@ struct ParserImpl
         if (mzid.dataCollection.analysisData.spectrumIdentificationList.empty())
             throw runtime_error("no spectrum identification list");
 
-        // create commands for inserting results
-        sqlite::command insertSpectrum(idpDb, "INSERT INTO Spectrum (Id, Source, Index_, NativeID, PrecursorMZ, ScanTimeInSeconds) VALUES (?,1,?,?,?,?)");
-        sqlite::command insertPeptide(idpDb, "INSERT INTO Peptide (Id, MonoisotopicMass, MolecularWeight, PeptideGroup, DecoySequence) VALUES (?,?,?,0,?)");
-        sqlite::command insertPSM(idpDb, "INSERT INTO PeptideSpectrumMatch (Id, Spectrum, Analysis, Peptide, QValue, ObservedNeutralMass, MonoisotopicMassError, MolecularWeightError, Rank, Charge) VALUES (?,?,?,?,?,?,?,?,?,?)");
-        sqlite::command insertPeptideModification(idpDb, "INSERT INTO PeptideModification (Id, PeptideSpectrumMatch, Modification, Offset, Site) VALUES (?,?,?,?,?)");
-        sqlite::command insertModification(idpDb, "INSERT INTO Modification (Id, MonoMassDelta, AvgMassDelta, Formula, Name) VALUES (?,?,?,?,?)");
-        sqlite::command insertScore(idpDb, "INSERT INTO PeptideSpectrumMatchScore (PsmId, Value, ScoreNameId) VALUES (?,?,?)");
+        // create commands for inserting results; rows are buffered and inserted many at a time
+        BulkInsertCommand insertSpectrum(idpDb, "INSERT INTO Spectrum (Id, Source, Index_, NativeID, PrecursorMZ, ScanTimeInSeconds) VALUES ", "(?,1,?,?,?,?)");
+        BulkInsertCommand insertPeptide(idpDb, "INSERT INTO Peptide (Id, MonoisotopicMass, MolecularWeight, PeptideGroup, DecoySequence) VALUES ", "(?,?,?,0,?)");
+        BulkInsertCommand insertPSM(idpDb, "INSERT INTO PeptideSpectrumMatch (Id, Spectrum, Analysis, Peptide, QValue, ObservedNeutralMass, MonoisotopicMassError, MolecularWeightError, Rank, Charge) VALUES ", "(?,?,1,?,2,?,?,?,?,?)");
+        BulkInsertCommand insertPeptideModification(idpDb, "INSERT INTO PeptideModification (Id, PeptideSpectrumMatch, Modification, Offset, Site) VALUES ", "(?,?,?,?,?)");
+        BulkInsertCommand insertModification(idpDb, "INSERT INTO Modification (Id, MonoMassDelta, AvgMassDelta, Formula, Name) VALUES ", "(?,?,?,NULL,NULL)");
+        BulkInsertCommand insertScore(idpDb, "INSERT INTO PeptideSpectrumMatchScore (PsmId, Value, ScoreNameId) VALUES ", "(?,?,?)");
 
         // only decoy proteins and peptide instances are inserted with these commands
-        sqlite::command insertProtein(idpDb, "INSERT INTO Protein (Id, Accession, IsDecoy, Cluster, ProteinGroup, Length) VALUES (?,?,1,0,0,NULL)");
-        sqlite::command insertPeptideInstance(idpDb, "INSERT INTO PeptideInstance (Id, Protein, Peptide, Offset, Length, NTerminusIsSpecific, CTerminusIsSpecific, MissedCleavages) VALUES (?,?,?,NULL,?,?,?,?)");
+        BulkInsertCommand insertProtein(idpDb, "INSERT INTO Protein (Id, Accession, IsDecoy, Cluster, ProteinGroup, Length) VALUES ", "(?,?,1,0,0,NULL)");
+        BulkInsertCommand insertPeptideInstance(idpDb, "INSERT INTO PeptideInstance (Id, Protein, Peptide, Offset, Length, NTerminusIsSpecific, CTerminusIsSpecific, MissedCleavages) VALUES ", "(?,?,?,NULL,?,?,?,?)");
 
         map<string, sqlite3_int64> distinctSpectra;
         map<string, sqlite3_int64> proteinIdByAccession;
@@ -607,9 +710,8 @@ struct ParserImpl
 
                 double firstPrecursorMZ = sir->spectrumIdentificationItem[0]->experimentalMassToCharge;
                 double scanTimeInSeconds = sir->cvParam(MS_scan_start_time).timeInSeconds();
-                insertSpectrum.binder() << nextSpectrumId << nextSpectrumId << sir->spectrumID << firstPrecursorMZ << scanTimeInSeconds;
-                insertSpectrum.execute();
-                insertSpectrum.reset();
+                insertSpectrum << nextSpectrumId << nextSpectrumId << sir->spectrumID << firstPrecursorMZ << scanTimeInSeconds;
+                insertSpectrum.endRow();
 
                 BOOST_FOREACH(SpectrumIdentificationItemPtr& sii, sir->spectrumIdentificationItem)
                 {
@@ -652,19 +754,18 @@ struct ParserImpl
                                 decoyPeptideEvidence.push_back(pe);
                         }
 
-                        insertPeptide.binder() << nextPeptideId << pwizPeptide.monoisotopicMass() << pwizPeptide.molecularWeight();
+                        insertPeptide << nextPeptideId << pwizPeptide.monoisotopicMass() << pwizPeptide.molecularWeight();
 
                         if (hasTarget)
                             targetPeptides.insert(sharedSequence);
 
                         // if the peptide comes from only target proteins, leave the DecoySequence null
                         if (!hasDecoy)
-                            insertPeptide.binder(4) << sqlite::ignore;
+                            insertPeptide << sqlite::ignore;
                         else
-                            insertPeptide.binder(4) << *sharedSequence;
+                            insertPeptide << *sharedSequence;
 
-                        insertPeptide.execute();
-                        insertPeptide.reset();
+                        insertPeptide.endRow();
 
                         // some bogus files may repeat the same decoy peptide
                         set<shared_string> decoyPeptides;
@@ -685,9 +786,8 @@ struct ParserImpl
                             {
                                 itr->second = ++nextProteinId;
 
-                                insertProtein.binder() << nextProteinId << dbs.accession;
-                                insertProtein.execute();
-                                insertProtein.reset();
+                                insertProtein << nextProteinId << dbs.accession;
+                                insertProtein.endRow();
                             }
 
                             set<shared_string>::iterator itr2; bool wasInserted2;
@@ -698,15 +798,14 @@ struct ParserImpl
                                 sqlite3_int64 curProteinId = itr->second;
                                 proteome::DigestedPeptide peptide = digestedPeptide(sip, *pe);
 
-                                insertPeptideInstance.binder() << ++nextPeptideInstanceId
-                                                               << curProteinId
-                                                               << nextPeptideId
-                                                               << (int) peptide.sequence().length()
-                                                               << peptide.NTerminusIsSpecific()
-                                                               << peptide.CTerminusIsSpecific()
-                                                               << (int) peptide.missedCleavages();
-                                insertPeptideInstance.execute();
-                                insertPeptideInstance.reset();
+                                insertPeptideInstance << ++nextPeptideInstanceId
+                                                      << curProteinId
+                                                      << nextPeptideId
+                                                      << (int) peptide.sequence().length()
+                                                      << peptide.NTerminusIsSpecific()
+                                                      << peptide.CTerminusIsSpecific()
+                                                      << (int) peptide.missedCleavages();
+                                insertPeptideInstance.endRow();
                             }
                         }
                     }
@@ -745,11 +844,10 @@ struct ParserImpl
                         if (insertResult.second)
                         {
                             insertResult.first->second = ++nextModId;
-                            insertModification.binder() << nextModId
-                                                        << massPair.first
-                                                        << massPair.second;
-                            insertModification.execute();
-                            insertModification.reset();
+                            insertModification << nextModId
+                                               << massPair.first
+                                               << massPair.second;
+                            insertModification.endRow();
                         }
 
                         char site;
@@ -760,13 +858,12 @@ struct ParserImpl
                         else
                             site = sequence[offset];
 
-                        insertPeptideModification.binder() << nextPMId
-                                                           << nextPSMId
-                                                           << insertResult.first->second // mod id
-                                                           << offset
-                                                           << site;
-                        insertPeptideModification.execute();
-                        insertPeptideModification.reset();
+                        insertPeptideModification << nextPMId
+                                                  << nextPSMId
+                                                  << insertResult.first->second // mod id
+                                                  << offset
+                                                  << site;
+                        insertPeptideModification.endRow();
 
                         pwizPeptide.modifications()[offset].push_back(proteome::Modification(massPair.first, massPair.second));
                     }
@@ -774,18 +871,15 @@ struct ParserImpl
                     double precursorMass = Ion::neutralMass(sii->experimentalMassToCharge, sii->chargeState);
 
                     // insert peptide spectrum match
-                    insertPSM.binder() << nextPSMId
-                                       << nextSpectrumId
-                                       << 1 // analysis
-                                       << nextPeptideId
-                                       << 2 // q value
-                                       << precursorMass
-                                       << (precursorMass - pwizPeptide.monoisotopicMass())
-                                       << (precursorMass - pwizPeptide.molecularWeight())
-                                       << sii->rank
-                                       << sii->chargeState;
-                    insertPSM.execute();
-                    insertPSM.reset();
+                    insertPSM << nextPSMId
+                              << nextSpectrumId
+                              << nextPeptideId
+                              << precursorMass
+                              << (precursorMass - pwizPeptide.monoisotopicMass())
+                              << (precursorMass - pwizPeptide.molecularWeight())
+                              << sii->rank
+                              << sii->chargeState;
+                    insertPSM.endRow();
 
                     if (!hasScoreNames)
                     {
@@ -800,16 +894,14 @@ struct ParserImpl
 
                     BOOST_FOREACH(const CVParam& cvParam, sii->cvParams)
                     {
-                        insertScore.binder() << nextPSMId << cvParam.value << ++nextScoreId;
-                        insertScore.execute();
-                        insertScore.reset();
+                        insertScore << nextPSMId << cvParam.value << ++nextScoreId;
+                        insertScore.endRow();
                     }
 
                     BOOST_FOREACH(const UserParam& userParam, sii->userParams)
                     {
-                        insertScore.binder() << nextPSMId << userParam.value << ++nextScoreId;
-                        insertScore.execute();
-                        insertScore.reset();
+                        insertScore << nextPSMId << userParam.value << ++nextScoreId;
+                        insertScore.endRow();
                     }
                 }
             }
@@ -823,6 +915,15 @@ struct ParserImpl
             throw runtime_error("unknown error parsing spectrum result " + lexical_cast<string>(iterationIndex) + " (" + sil.spectrumIdentificationResult[iterationIndex]->id + ")");
         }
 
+        insertSpectrum.flush();
+        insertPeptide.flush();
+        insertPSM.flush();
+        insertPeptideModification.flush();
+        insertModification.flush();
+        insertScore.flush();
+        insertProtein.flush();
+        insertPeptideInstance.flush();
+
         if (targetPeptides.size() == distinctPeptideIdBySequence.size())
             throw runtime_error("no peptides found mapping to a decoy protein; is the decoy prefix set correctly?");
 
@@ -1104,7 +1205,18 @@ struct ProteinReaderTask
     vector<PeptideFinderTaskWeakPtr> peptideFinderTasks;
     string decoyPrefix;
     boost::mutex queueMutex;
+    boost::condition_variable proteinsQueued; // signaled when proteins are queued or the tasks are canceled
+    boost::condition_variable proteinsDequeued; // signaled when proteins are dequeued or a peptide finder task is done
     boost::atomic_uint32_t done;
+
+    // stops the protein reader and wakes up the peptide finders so they stop too
+    void cancel()
+    {
+        boost::mutex::scoped_lock lock(queueMutex);
+        done.store(peptideFinderTasks.size());
+        proteinsQueued.notify_all();
+        proteinsDequeued.notify_all();
+    }
 };
 
 typedef boost::shared_ptr<ProteinReaderTask> ProteinReaderTaskPtr;
@@ -1160,6 +1272,8 @@ void executeProteinReaderTask(ProteinReaderTaskPtr proteinReaderTask, ThreadStat
                 }
                 i += batchSize - 1;
 
+                lock.lock();
+
                 while (true)
                 {
                     // check for early cancellation
@@ -1169,8 +1283,6 @@ void executeProteinReaderTask(ProteinReaderTaskPtr proteinReaderTask, ThreadStat
                         return; // ~scoped_lock calls unlock()
                     }
 
-                    lock.lock();
-
                     size_t maxQueueSize = 0;
                     BOOST_FOREACH(const PeptideFinderTaskWeakPtr& taskPtr, proteinReaderTask->peptideFinderTasks)
                     {
@@ -1178,15 +1290,10 @@ void executeProteinReaderTask(ProteinReaderTaskPtr proteinReaderTask, ThreadStat
                         maxQueueSize = max(maxQueueSize, task.get() ? task->proteinQueue.size() : 0);
                     }
 
-                    // keep at most 100 batches in the queue
-                    if (maxQueueSize > batchSize * 100)
-                    {
-                        lock.unlock();
-                        boost::this_thread::sleep(bpt::milliseconds(100));
-                        continue;
-                    }
-                    else
+                    // keep at most 100 batches in the queue; wait for the slowest peptide finder to catch up
+                    if (maxQueueSize <= batchSize * 100)
                         break;
+                    proteinReaderTask->proteinsDequeued.wait(lock);
                 }
 
                 // lock is still locked
@@ -1197,18 +1304,19 @@ void executeProteinReaderTask(ProteinReaderTaskPtr proteinReaderTask, ThreadStat
                     if (task.get() && !task->done)
                         task->proteinQueue.insert(task->proteinQueue.end(), proteinBatch.begin(), proteinBatch.end());
                 }
+                proteinReaderTask->proteinsQueued.notify_all();
                 lock.unlock();
             }
         }
     }
     catch (exception& e)
     {
-        proteinReaderTask->done.store(proteinReaderTask->peptideFinderTasks.size());
+        proteinReaderTask->cancel();
         status = boost::copy_exception(runtime_error("[executeProteinReaderTask] error reading proteins: " + string(e.what())));
     }
     catch (...)
     {
-        proteinReaderTask->done.store(proteinReaderTask->peptideFinderTasks.size());
+        proteinReaderTask->cancel();
         status = boost::copy_exception(runtime_error("[executeProteinReaderTask] unknown error reading proteins"));
     }
 }
@@ -1230,13 +1338,15 @@ void executePeptideFinderTask(PeptideFinderTaskPtr peptideFinderTask, ThreadStat
 
     try
     {
-        sqlite::command insertProtein(idpDb, "INSERT INTO Protein (Id, Accession, IsDecoy, Cluster, ProteinGroup, Length) VALUES (?,?,0,0,0,?)");
-        sqlite::command insertProteinData(idpDb, "INSERT INTO ProteinData (Id, Sequence) VALUES (?,?)");
-        sqlite::command insertProteinMetadata(idpDb, "INSERT INTO ProteinMetadata (Id, Description) VALUES (?,?)");
-        sqlite::command insertPeptideInstance(idpDb, "INSERT INTO PeptideInstance (Id, Protein, Peptide, Offset, Length, NTerminusIsSpecific, CTerminusIsSpecific, MissedCleavages) VALUES (?,?,?,?,?,?,?,?)");
-
         sqlite3_int64 nextProteinId = sqlite::query(idpDb, "SELECT MAX(Id) FROM Protein").begin()->get<int>(0);
         sqlite3_int64 nextPeptideInstanceId = sqlite::query(idpDb, "SELECT MAX(Id) FROM PeptideInstance").begin()->get<int>(0);
+
+        // the target proteins and peptide instances are inserted in one transaction, many rows at a time
+        sqlite::transaction transaction(idpDb);
+        BulkInsertCommand insertProtein(idpDb, "INSERT INTO Protein (Id, Accession, IsDecoy, Cluster, ProteinGroup, Length) VALUES ", "(?,?,0,0,0,?)");
+        BulkInsertCommand insertProteinData(idpDb, "INSERT INTO ProteinData (Id, Sequence) VALUES ", "(?,?)");
+        BulkInsertCommand insertProteinMetadata(idpDb, "INSERT INTO ProteinMetadata (Id, Description) VALUES ", "(?,?)");
+        BulkInsertCommand insertPeptideInstance(idpDb, "INSERT INTO PeptideInstance (Id, Protein, Peptide, Offset, Length, NTerminusIsSpecific, CTerminusIsSpecific, MissedCleavages) VALUES ", "(?,?,?,?,?,?,?,?)");
         int maxProteinLength = 0;
 
         const string& decoyPrefix = parserTask.analysis->importSettings.qonverterSettings.decoyPrefix;
@@ -1285,7 +1395,7 @@ void executePeptideFinderTask(PeptideFinderTaskPtr peptideFinderTask, ThreadStat
             peptideQueries += (int) peptideBatch.size();
             if (ilr && ilr->broadcastUpdateMessage(UpdateMessage(peptideQueries-1, peptides.size(), parserTask.inputFilepath + "*building peptide trie")) == IterationListener::Status_Cancel)
             {
-                proteinReaderTask.done.store(proteinReaderTask.peptideFinderTasks.size());
+                proteinReaderTask.cancel();
                 status = IterationListener::Status_Cancel;
                 return;
             }
@@ -1297,24 +1407,18 @@ void executePeptideFinderTask(PeptideFinderTaskPtr peptideFinderTask, ThreadStat
 
             while (true)
             {
-                // dequeue a batch of proteins, or sleep if none are available
+                // dequeue a batch of proteins, or wait until some are available
                 vector<proteome::ProteinPtr> proteinBatch;
 
                 lock.lock();
+                while (proteinQueue.empty() && proteinReaderTask.done < proteinReaderTask.peptideFinderTasks.size())
+                    proteinReaderTask.proteinsQueued.wait(lock);
+
                 size_t queueSize = proteinQueue.size();
                 if (queueSize == 0)
                 {
-                    if (proteinReaderTask.done == proteinReaderTask.peptideFinderTasks.size())
-                    {
-                        lock.unlock();
-                        break;
-                    }
-                    else
-                    {
-                        lock.unlock();
-                        boost::this_thread::sleep(bpt::milliseconds(100));
-                        continue;
-                    }
+                    lock.unlock();
+                    break;
                 }
 
                 const size_t maxBatchSize = 50;
@@ -1323,6 +1427,7 @@ void executePeptideFinderTask(PeptideFinderTaskPtr peptideFinderTask, ThreadStat
 
                 proteinBatch.assign(proteinQueue.begin(), proteinQueue.begin() + batchSize);
                 proteinQueue.erase(proteinQueue.begin(), proteinQueue.begin() + batchSize);
+                proteinReaderTask.proteinsDequeued.notify_one();
                 lock.unlock();
 
                 // move to the next peptide batch
@@ -1333,7 +1438,7 @@ void executePeptideFinderTask(PeptideFinderTaskPtr peptideFinderTask, ThreadStat
 
                 if (ilr && ilr->broadcastUpdateMessage(UpdateMessage(proteinsDigested-1, proteinReaderTask.proteinCount, parserTask.inputFilepath + "*finding peptides in proteins")) == IterationListener::Status_Cancel)
                 {
-                    proteinReaderTask.done.store(proteinReaderTask.peptideFinderTasks.size());
+                    proteinReaderTask.cancel();
                     status = IterationListener::Status_Cancel;
                     return;
                 }
@@ -1370,17 +1475,14 @@ void executePeptideFinderTask(PeptideFinderTaskPtr peptideFinderTask, ThreadStat
                     {
                         itr->second = ++nextProteinId;
 
-                        insertProtein.binder() << nextProteinId << protein->id << (int) protein->sequence().length();
-                        insertProtein.execute();
-                        insertProtein.reset();
+                        insertProtein << nextProteinId << protein->id << (int) protein->sequence().length();
+                        insertProtein.endRow();
 
-                        insertProteinData.binder() << nextProteinId << protein->sequence();
-                        insertProteinData.execute();
-                        insertProteinData.reset();
+                        insertProteinData << nextProteinId << protein->sequence();
+                        insertProteinData.endRow();
 
-                        insertProteinMetadata.binder() << nextProteinId << protein->description;
-                        insertProteinMetadata.execute();
-                        insertProteinMetadata.reset();
+                        insertProteinMetadata << nextProteinId << protein->description;
+                        insertProteinMetadata.endRow();
                     }
 
                     sqlite3_int64 curProteinId = itr->second;
@@ -1402,16 +1504,15 @@ void executePeptideFinderTask(PeptideFinderTaskPtr peptideFinderTask, ThreadStat
 
                         mappedPeptides.insert(instance.keyword());
 
-                        insertPeptideInstance.binder() << ++nextPeptideInstanceId
-                                                       << curProteinId
-                                                       << distinctPeptideIdBySequence[instance.keyword()]
-                                                       << (int) instance.offset()
-                                                       << (int) instance.keyword()->length()
-                                                       << bestPeptide.NTerminusIsSpecific()
-                                                       << bestPeptide.CTerminusIsSpecific()
-                                                       << (int) bestPeptide.missedCleavages();
-                        insertPeptideInstance.execute();
-                        insertPeptideInstance.reset();
+                        insertPeptideInstance << ++nextPeptideInstanceId
+                                              << curProteinId
+                                              << distinctPeptideIdBySequence[instance.keyword()]
+                                              << (int) instance.offset()
+                                              << (int) instance.keyword()->length()
+                                              << bestPeptide.NTerminusIsSpecific()
+                                              << bestPeptide.CTerminusIsSpecific()
+                                              << (int) bestPeptide.missedCleavages();
+                        insertPeptideInstance.endRow();
                     }
                 }
             }
@@ -1446,23 +1547,32 @@ void executePeptideFinderTask(PeptideFinderTaskPtr peptideFinderTask, ThreadStat
 
         if (ilr && ilr->broadcastUpdateMessage(UpdateMessage(proteinReaderTask.proteinCount-1, proteinReaderTask.proteinCount, parserTask.inputFilepath + "*finding peptides in proteins")) == IterationListener::Status_Cancel)
         {
-            proteinReaderTask.done.store(proteinReaderTask.peptideFinderTasks.size());
+            proteinReaderTask.cancel();
             status = IterationListener::Status_Cancel;
             return;
         }
 
         // the protein reader task stops when done == proteinReaderTask.peptideFinderTasks.size()
+        lock.lock();
         ++proteinReaderTask.done;
         peptideFinderTask->done.store(true);
         proteinQueue.clear();
+        proteinReaderTask.proteinsDequeued.notify_one();
+        lock.unlock();
+
+        insertProtein.flush();
+        insertProteinData.flush();
+        insertProteinMetadata.flush();
+        insertPeptideInstance.flush();
 
-        sqlite::command insertIntegerSet(idpDb, "INSERT INTO IntegerSet (Value) VALUES (?)");
+        BulkInsertCommand insertIntegerSet(idpDb, "INSERT INTO IntegerSet (Value) VALUES ", "(?)");
         for (int i=1; i <= maxProteinLength; ++i)
         {
-            insertIntegerSet.binder() << i;
-            insertIntegerSet.execute();
-            insertIntegerSet.reset();
+            insertIntegerSet << i;
+            insertIntegerSet.endRow();
         }
+        insertIntegerSet.flush();
+        transaction.commit();
 
         try
         {
@@ -1500,14 +1610,12 @@ void executePeptideFinderTask(PeptideFinderTaskPtr peptideFinderTask, ThreadStat
     }
     catch (exception& e)
     {
-        boost::mutex::scoped_lock lock(proteinReaderTask.queueMutex);
-        proteinReaderTask.done.store(proteinReaderTask.peptideFinderTasks.size());
+        proteinReaderTask.cancel();
         status = boost::copy_exception(runtime_error("[executePeptideFinderTask] error finding peptides for \"" + parserTask.inputFilepath + "\": " + e.what()));
     }
     catch (...)
     {
-        boost::mutex::scoped_lock lock(proteinReaderTask.queueMutex);
-        proteinReaderTask.done.store(proteinReaderTask.peptideFinderTasks.size());
+        proteinReaderTask.cancel();
         status = boost::copy_exception(runtime_error("[executePeptideFinderTask] unknown error finding peptides for \"" + parserTask.inputFilepath + "\""));
     }
 }
@@ -39,6 +39,7 @@
 #include "crawdad/SimpleCrawdad.h"
 
 #include <algorithm>
+#include <functional>
 #include <boost/icl/interval_set.hpp>
 #include <boost/icl/continuous_interval.hpp>
 #include <boost/accumulators/accumulators.hpp>
@@ -60,6 +61,8 @@
 #include <boost/range/algorithm/lower_bound.hpp>
 #include <boost/range/algorithm/upper_bound.hpp>
 #include <boost/math/distributions/normal.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
 #include "boost/foreach_field.hpp"
 #include "boost/throw_exception.hpp"
 #include "boost/xpressive/xpressive.hpp"
@@ -302,6 +305,193 @@ struct ModifyPrecursorMZ
     void operator() (MS2ScanInfo& info) const {info.precursorMZ = newMZ;}
 };
 
+/// Sums the intensities of the XIC windows and regression defined precursors in MS1 spectra.
+/// A sweep over the windows sorted by scan time start finds the windows each MS1 scan is in,
+/// and a binary search on the scan's m/z array finds the peaks in each window's m/z ranges.
+/// Queued scans are summed in parallel; the sums are added to the chromatograms in scan order.
+class MS1XICExtractor
+{
+    public:
+
+    MS1XICExtractor(const XICWindowList& windows, const vector<RegDefinedPrecursorInfo>& regDefinedPrecursors)
+        : nextTarget(0), lastScanTime(-numeric_limits<double>::max()),
+          numThreads(max(1u, boost::thread::hardware_concurrency()))
+    {
+        BOOST_FOREACH(const XICWindow& window, windows)
+        {
+            if (window.preRT.empty())
+                continue;
+            Target target = { hull(window.preRT), &window.preMZ, &window, NULL };
+            targets.push_back(target);
+        }
+
+        BOOST_FOREACH(const RegDefinedPrecursorInfo& info, regDefinedPrecursors)
+        {
+            if (info.scanTimeWindow.empty())
+                continue;
+            Target target = { hull(info.scanTimeWindow), &info.mzWindow, NULL, &info.chromatogram };
+            targets.push_back(target);
+        }
+
+        stable_sort(targets.begin(), targets.end(), TargetStartsBefore());
+    }
+
+    /// queues an MS1 scan with the windows its scan time is in; extracts the queue when it is full
+    void add(const SpectrumPtr& spectrum, double scanTime)
+    {
+        // scans are usually in time order; if not, restart the sweep
+        if (scanTime < lastScanTime)
+        {
+            nextTarget = 0;
+            activeTargets.clear();
+        }
+        lastScanTime = scanTime;
+
+        for (; nextTarget < targets.size() && lower(targets[nextTarget].scanTimeWindow) <= scanTime; ++nextTarget)
+            activeTargets.push_back(nextTarget);
+
+        jobs.push_back(Job());
+        Job& job = jobs.back();
+        job.spectrum = spectrum;
+        job.scanTime = scanTime;
+
+        size_t stillActive = 0;
+        BOOST_FOREACH(size_t i, activeTargets)
+        {
+            if (upper(targets[i].scanTimeWindow) < scanTime)
+                continue; // the sweep is past this window
+            activeTargets[stillActive++] = i;
+            if (boost::icl::contains(targets[i].scanTimeWindow, scanTime))
+                job.targets.push_back(i);
+        }
+        activeTargets.resize(stillActive);
+
+        if (jobs.size() >= numThreads * 8)
+            flush();
+    }
+
+    /// extracts the queued scans and adds their sums to the chromatograms
+    void flush()
+    {
+        if (jobs.empty())
+            return;
+
+        if (numThreads == 1 || jobs.size() == 1)
+            extract(0, 1);
+        else
+        {
+            boost::thread_group threads;
+            for (size_t i = 0; i < numThreads && i < jobs.size(); ++i)
+                threads.create_thread(boost::bind(&MS1XICExtractor::extract, this, i, numThreads));
+            threads.join_all();
+        }
+
+        BOOST_FOREACH(const Job& job, jobs)
+        {
+            typedef pair<size_t, double> TargetIntensity;
+            BOOST_FOREACH(const TargetIntensity& sum, job.sums)
+            {
+                const Target& target = targets[sum.first];
+                if (target.window)
+                    target.window->AddMS1(sum.second, job.scanTime);
+                else
+                    target.chromatogram->AddMS1(sum.second, job.scanTime);
+            }
+        }
+        jobs.clear();
+    }
+
+    private:
+
+    struct Target
+    {
+        continuous_interval<double> scanTimeWindow;
+        const interval_set<double>* mzWindow;
+        const XICWindow* window; // either window or chromatogram is set
+        const LocalChromatogram* chromatogram;
+    };
+
+    struct TargetStartsBefore
+    {
+        bool operator() (const Target& lhs, const Target& rhs) const {return lower(lhs.scanTimeWindow) < lower(rhs.scanTimeWindow);}
+    };
+
+    struct Job
+    {
+        SpectrumPtr spectrum;
+        double scanTime;
+        vector<size_t> targets;
+        vector<pair<size_t, double> > sums; // summed intensity by target, for targets overlapping the scan's m/z range
+    };
+
+    // sums the intensities of every stride'th job starting at firstJob
+    void extract(size_t firstJob, size_t stride)
+    {
+        vector<double> sortedMZ, sortedIntensity;
+        for (size_t i = firstJob; i < jobs.size(); i += stride)
+        {
+            Job& job = jobs[i];
+            const vector<double>* mzV = &job.spectrum->getMZArray()->data;
+            const vector<double>* intensV = &job.spectrum->getIntensityArray()->data;
+            if (mzV->empty() || job.targets.empty())
+                continue;
+
+            // the binary search needs the m/z array sorted
+            if (adjacent_find(mzV->begin(), mzV->end(), std::greater<double>()) != mzV->end())
+            {
+                vector<pair<double, double> > peaks;
+                for (size_t j = 0; j < mzV->size(); ++j)
+                    peaks.push_back(make_pair((*mzV)[j], (*intensV)[j]));
+                stable_sort(peaks.begin(), peaks.end(), PeakMzLessThan());
+                sortedMZ.clear(); sortedIntensity.clear();
+                BOOST_FOREACH_FIELD((double mz)(double intensity), peaks)
+                {
+                    sortedMZ.push_back(mz);
+                    sortedIntensity.push_back(intensity);
+                }
+                mzV = &sortedMZ;
+                intensV = &sortedIntensity;
+            }
+
+            continuous_interval<double> spectrumMzRange = continuous_interval<double>::closed(mzV->front(), mzV->back());
+
+            BOOST_FOREACH(size_t t, job.targets)
+            {
+                const interval_set<double>& mzWindow = *targets[t].mzWindow;
+
+                // if the m/z window and the MS1 spectrum's m/z range do not overlap, skip this window
+                if (disjoint(mzWindow, interval_set<double>(spectrumMzRange)))
+                    continue;
+
+                // the window's m/z ranges are disjoint and ascending, so peaks are summed in m/z order
+                double sumIntensities = 0;
+                BOOST_FOREACH(const continuous_interval<double>& mzRange, mzWindow)
+                {
+                    vector<double>::const_iterator itr = lower_bound(mzV->begin(), mzV->end(), lower(mzRange));
+                    vector<double>::const_iterator end = upper_bound(itr, mzV->end(), upper(mzRange));
+                    for (; itr != end; ++itr)
+                        if (boost::icl::contains(mzRange, *itr))
+                            sumIntensities += (*intensV)[itr - mzV->begin()];
+                }
+                job.sums.push_back(make_pair(t, sumIntensities));
+            }
+        }
+    }
+
+    struct PeakMzLessThan
+    {
+        bool operator() (const pair<double, double>& lhs, const pair<double, double>& rhs) const {return lhs.first < rhs.first;}
+    };
+
+    vector<Target> targets; // sorted by scan time window start
+    size_t nextTarget; // the next target to enter the sweep
+    vector<size_t> activeTargets; // targets the sweep entered and hasn't passed yet
+    double lastScanTime;
+
+    vector<Job> jobs;
+    size_t numThreads;
+};
+
 } // namespace
 
 
@@ -1049,8 +1239,8 @@ int EmbedMS1ForFile(sqlite::database& idpDb, const string& idpDBFilePath, const
         }
         // Going through all spectra once more to get intensities/retention times to build chromatograms
         ITERATION_UPDATE(ilr, currentFile, totalFiles, "Reading " + lexical_cast<string>(spectrumList.size()) + " peaks... ");
-        map<double, double > peakMap;
-        
+        MS1XICExtractor ms1Extractor(pepWindow, RegDefinedPrecursors);
+
         for( size_t curIndex = 0; curIndex < spectrumList.size(); ++curIndex )
         {
 
@@ -1067,61 +1257,7 @@ int EmbedMS1ForFile(sqlite::database& idpDb, const string& idpDBFilePath, const
             if (msLevel == 1)
             {
                 Scan& scan = spectrum->scanList.scans[0];
-
-                // all m/z and intensity data for a spectrum
-                const vector<double>& mzV = spectrum->getMZArray()->data;
-                const vector<double>& intensV = spectrum->getIntensityArray()->data;
-                size_t arraySize = mzV.size();
-                double curRT = scan.cvParam(MS_scan_start_time).timeInSeconds();
-
-                accs::accumulator_set<double, accs::stats<accs::tag::min, accs::tag::max> > mzMinMax;
-                mzMinMax = std::for_each(mzV.begin(), mzV.end(), mzMinMax);
-                boost::icl::interval_set<double> spectrumMzRange(continuous_interval<double>::closed(accs::min(mzMinMax), accs::max(mzMinMax)));
-
-                BOOST_FOREACH(const XICWindow& window, pepWindow)
-                {
-                    // if the MS1 retention time is not in the RT window constructed for this peptide, skip this window
-                    if (!boost::icl::contains(hull(window.preRT), curRT))
-                        continue;
-
-                    // if the m/z window and the MS1 spectrum's m/z range do not overlap, skip this window
-                    if (disjoint(window.preMZ, spectrumMzRange))
-                        continue;
-
-                    double sumIntensities = 0;
-                    for (size_t iMZ = 0; iMZ < arraySize; ++iMZ)
-                    {
-                        // if this m/z is in the window, record its intensity and retention time
-                        if (boost::icl::contains(window.preMZ, mzV[iMZ]))
-                            sumIntensities += intensV[iMZ];
-                    }
-                    window.AddMS1(sumIntensities, curRT);
-
-                } // done searching through all unique peptide windows for this MS1 scan
-
-                //loop through all regression defined precursors
-
-                      BOOST_FOREACH(RegDefinedPrecursorInfo& info, RegDefinedPrecursors)
-                {
-
-                    if (!boost::icl::contains(info.scanTimeWindow, curRT))
-                        continue;
-
-                    // if the PSM's m/z window and the MS1 spectrum's m/z range do not overlap, skip this window
-                    if (disjoint(info.mzWindow, spectrumMzRange))
-                        continue;
-
-                    double sumIntensities = 0;
-                    for (size_t iMZ = 0; iMZ < arraySize; ++iMZ)
-                    {
-                        // if this m/z is in the window, record its intensity and retention time
-                        if (boost::icl::contains(info.mzWindow, mzV[iMZ]))
-                            sumIntensities += intensV[iMZ];
-                    }
-
-                    info.chromatogram.AddMS1(sumIntensities,curRT);
-                } // done with regression defined precursor scan
-
+                ms1Extractor.add(spectrum, scan.cvParam(MS_scan_start_time).timeInSeconds());
             }
             else if (msLevel == 2)
             {
@@ -1134,6 +1270,7 @@ int EmbedMS1ForFile(sqlite::database& idpDb, const string& idpDBFilePath, const
                 }
             }
         } // end of spectra loop
+        ms1Extractor.flush();
         
         //finalize ms1 vectors
         BOOST_FOREACH(const XICWindow& window, pepWindow)
@@ -29,6 +29,7 @@
 #include "pwiz/data/proteome/Version.hpp"
 #include "pwiz/utility/misc/DateTime.hpp"
 #include "PTMVariantList.h"
+#include "myrimatchFragmentIndex.h"
 #include "myrimatchVersion.hpp"
 
 namespace freicore
@@ -473,6 +474,87 @@ namespace myrimatch
     }
 
 
+    /**
+        Scores a candidate against one of a spectrum's precursor mass hypotheses (with charge state z+1)
+        and adds the result to the spectrum if it scores well enough. The sequence ions are calculated
+        if sequenceIons is empty, so they can be reused for the next spectrum with the same charge state.
+    */
+    void ScoreCandidate( const DigestedPeptide& candidate,
+                         const string& sequence,
+                         vector<double>& sequenceIons,
+                         int z,
+                         Spectrum* spectrum,
+                         const PrecursorMassHypothesis& p,
+                         const string& protein,
+                         bool isDecoy,
+                         bool countComparison )
+    {
+        int fragmentChargeState = min( z, g_rtConfig->maxFragmentChargeState-1 );
+
+        boost::shared_ptr<SearchResult> resultPtr(new SearchResult(candidate));
+        SearchResult& result = *resultPtr;
+
+        START_PROFILER(2);
+        if( sequenceIons.empty() )
+        {
+            CalculateSequenceIons( candidate,
+                                   fragmentChargeState+1,
+                                   &sequenceIons,
+                                   spectrum->fragmentTypes,
+                                   g_rtConfig->UseSmartPlusThreeModel,
+                                   0,
+                                   0 );
+        }
+        STOP_PROFILER(2);
+        START_PROFILER(3);
+        spectrum->ScoreSequenceVsSpectrum( result, sequence, sequenceIons );
+        STOP_PROFILER(3);
+
+        if( result.mvh >= g_rtConfig->MinResultScore )
+        {
+            START_PROFILER(5);
+            result.proteins.insert(protein);
+            result._isDecoy = isDecoy;
+            STOP_PROFILER(5);
+        }
+
+        START_PROFILER(4);
+        {
+            boost::mutex::scoped_lock guard(spectrum->mutex);
+
+            if( countComparison )
+            {
+                if( isDecoy )
+                    ++ spectrum->numDecoyComparisons;
+                else
+                    ++ spectrum->numTargetComparisons;
+            }
+
+            if( result.mvh >= g_rtConfig->MinResultScore )
+            {
+                if( g_rtConfig->KeepUnadjustedPrecursorMz )
+                {
+                    PrecursorMassHypothesis unadjustedHypothesis(p);
+                    unadjustedHypothesis.mass = Ion::neutralMass(spectrum->mzOfPrecursor, p.charge);
+                    result.precursorMassHypothesis = unadjustedHypothesis;
+                }
+                else
+                    result.precursorMassHypothesis = p;
+
+                //result.massError = p.massType == MassType_Monoisotopic ? monoCalculatedMass - p.mass
+                //                                                       : avgCalculatedMass - p.mass;
+
+                // Accumulate score distributions for the spectrum
+                //++ spectrum->mvhScoreDistribution[ (int) (result.mvh+0.5) ];
+                //++ spectrum->mzFidelityDistribution[ (int) (result.mzFidelity+0.5)];
+
+                spectrum->resultsByCharge[z].add( resultPtr );         
+            }
+        }
+        STOP_PROFILER(4);
+    }
+
+
     boost::int64_t QuerySequence( const DigestedPeptide& candidate, const string& protein, bool isDecoy, bool estimateComparisonsOnly = false )
     {
         boost::int64_t numComparisonsDone = 0;
@@ -483,7 +565,6 @@ namespace myrimatch
 
         for( int z = 0; z < g_rtConfig->maxChargeStateFromSpectra; ++z )
         {
-            int fragmentChargeState = min( z, g_rtConfig->maxFragmentChargeState-1 );
             vector< double > sequenceIons;
 
             // Look up the spectra that have precursor mass hypotheses between mass + massError and mass - massError
@@ -500,88 +581,35 @@ namespace myrimatch
 
             BOOST_FOREACH(SpectraMassMap::iterator spectrumHypothesisPair, candidateHypotheses)
             {
-                Spectrum* spectrum = spectrumHypothesisPair->second.first;
-                PrecursorMassHypothesis& p = spectrumHypothesisPair->second.second;
-
-                boost::shared_ptr<SearchResult> resultPtr(new SearchResult(candidate));
-                SearchResult& result = *resultPtr;
-
-                if( !estimateComparisonsOnly )
-                {
-                    START_PROFILER(2);
-                    if( sequenceIons.empty() )
-                    {
-                        CalculateSequenceIons( candidate,
-                                               fragmentChargeState+1,
-                                               &sequenceIons,
-                                               spectrum->fragmentTypes,
-                                               g_rtConfig->UseSmartPlusThreeModel,
-                                               0,
-                                               0 );
-                    }
-                    STOP_PROFILER(2);
-                    START_PROFILER(3);
-                    spectrum->ScoreSequenceVsSpectrum( result, sequence, sequenceIons );
-                    STOP_PROFILER(3);
-
-                    if( result.mvh >= g_rtConfig->MinResultScore )
-                    {
-                        START_PROFILER(5);
-                        result.proteins.insert(protein);
-                        result._isDecoy = isDecoy;
-                        STOP_PROFILER(5);
-                    }
-                }
-
                 ++ numComparisonsDone;
 
                 if( estimateComparisonsOnly )
                     continue;
 
-                START_PROFILER(4);
-                {
-                    boost::mutex::scoped_lock guard(spectrum->mutex);
-
-                    if( isDecoy )
-                        ++ spectrum->numDecoyComparisons;
-                    else
-                        ++ spectrum->numTargetComparisons;
-
-                    if( result.mvh >= g_rtConfig->MinResultScore )
-                    {
-                        if( g_rtConfig->KeepUnadjustedPrecursorMz )
-                        {
-                            PrecursorMassHypothesis unadjustedHypothesis(p);
-                            unadjustedHypothesis.mass = Ion::neutralMass(spectrum->mzOfPrecursor, p.charge);
-                            result.precursorMassHypothesis = unadjustedHypothesis;
-                        }
-                        else
-                            result.precursorMassHypothesis = p;
-
-                        //result.massError = p.massType == MassType_Monoisotopic ? monoCalculatedMass - p.mass
-                        //                                                       : avgCalculatedMass - p.mass;
-
-                        // Accumulate score distributions for the spectrum
-                        //++ spectrum->mvhScoreDistribution[ (int) (result.mvh+0.5) ];
-                        //++ spectrum->mzFidelityDistribution[ (int) (result.mzFidelity+0.5)];
-
-                        spectrum->resultsByCharge[z].add( resultPtr );         
-                    }
-                }
-                STOP_PROFILER(4);
+                ScoreCandidate( candidate, sequence, sequenceIons, z,
+                                spectrumHypothesisPair->second.first, spectrumHypothesisPair->second.second,
+                                protein, isDecoy, true );
             }
         }
 
         return numComparisonsDone;
     }
 
-    int ExecuteSearchThread()
+    /**
+        Digests proteins from proteinTasks and searches their peptide variants against the spectra;
+        with a fragment index, the variants are added to the index instead, until it is full.
+    */
+    int ExecuteSearchThread( FragmentIndex* fragmentIndex = NULL )
     {
         try
         {
             size_t proteinTask;
+            FragmentIndex::ProteinCandidates proteinCandidates;
             while( true )
             {
+                if (fragmentIndex && fragmentIndex->full())
+                    break;
+
                 if (!proteinTasks.pop(proteinTask))
                     break;
 
@@ -596,6 +624,7 @@ namespace myrimatch
                 }
 
                 Peptide protein(p.getSequence());
+                const string& proteinSequence = protein.sequence();
                 bool isDecoy = p.isDecoy();
 
                 // BXZ are allowed to be in the prefix/suffix but not in the peptide sequence
@@ -613,17 +642,20 @@ namespace myrimatch
                 {
                     ++searchStatistics.numPeptidesGenerated;
 
-                    if (itr->sequence().find_first_not_of(validSequenceResidues) != string::npos ||
-                        itr->NTerminusPrefix().find_first_not_of(validResidues) != string::npos ||
-                        itr->CTerminusSuffix().find_first_not_of(validResidues) != string::npos)
+                    // filter with the peptide's record so that most peptides are never materialized
+                    DigestedPeptideRecord record = itr.record();
+                    size_t end = record.offset + record.length;
+                    if (proteinSequence.find_first_not_of(validSequenceResidues, record.offset) < end ||
+                        (record.offset > 0 && validResidues.find(proteinSequence[record.offset-1]) == string::npos) ||
+                        (end < proteinSequence.length() && validResidues.find(proteinSequence[end]) == string::npos))
                     {
                         ++itr;
                         continue;
                     }
 
                     // a selenopeptide's molecular weight can be lower than its monoisotopic mass!
-                    double minMass = min(itr->monoisotopicMass(), itr->molecularWeight());
-                    double maxMass = max(itr->monoisotopicMass(), itr->molecularWeight());
+                    double minMass = min(record.monoisotopicMass, record.molecularWeight);
+                    double maxMass = max(record.monoisotopicMass, record.molecularWeight);
 
                     if( minMass > g_rtConfig->curMaxPeptideMass ||
                         maxMass < g_rtConfig->curMinPeptideMass )
@@ -642,6 +674,18 @@ namespace myrimatch
 
                     searchStatistics.numVariantsGenerated += variantIterator.numVariants;
 
+                    if (fragmentIndex)
+                    {
+                        do
+                        {
+                            proteinCandidates.add(record, variantIterator.ptmVariant);
+                        }
+                        while (variantIterator.next());
+
+                        ++itr;
+                        continue;
+                    }
+
                     // query each variant
                     do
                     {
@@ -653,6 +697,12 @@ namespace myrimatch
 
                     ++itr;
                 }
+
+                if (fragmentIndex && !proteinCandidates.empty())
+                {
+                    fragmentIndex->add(p, proteinCandidates);
+                    proteinCandidates.clear();
+                }
             }
         } catch( std::exception& e )
         {
@@ -665,8 +715,139 @@ namespace myrimatch
         return 0;
     }
 
+    /**
+        Searches spectra (taken in turn with nextSpectrum) against the fragment index: for each
+        precursor mass hypothesis, the candidates sharing the most peaks with the spectrum are scored.
+    */
+    int ExecuteFragmentIndexSearchThread( const FragmentIndex& fragmentIndex, const vector<Spectrum*>& spectraToSearch, boost::atomic<size_t>* nextSpectrum )
+    {
+        try
+        {
+            FragmentIndex::SharedPeakCounts sharedPeakCounts;
+            vector< pair<size_t, boost::uint16_t> > candidates;
+            vector<double> sequenceIons;
+            size_t targetsInWindow, decoysInWindow;
+
+            for (size_t i = (*nextSpectrum)++; i < spectraToSearch.size(); i = (*nextSpectrum)++)
+            {
+                Spectrum* spectrum = spectraToSearch[i];
+                BOOST_FOREACH(const PrecursorMassHypothesis& p, spectrum->precursorMassHypotheses)
+                {
+                    int z = p.charge - 1;
+                    if (z < 0 || z >= g_rtConfig->maxChargeStateFromSpectra)
+                        continue;
+
+                    // the same choice of mass type as for monoSpectraByChargeState and avgSpectraByChargeState
+                    bool isMono = g_rtConfig->precursorMzToleranceRule == MzToleranceRule_Mono ||
+                                  (p.massType == MassType_Monoisotopic && g_rtConfig->precursorMzToleranceRule != MzToleranceRule_Avg);
+                    const MZTolerance& tolerance = isMono ? g_rtConfig->monoPrecursorMassTolerance[z] : g_rtConfig->avgPrecursorMassTolerance[z];
+
+                    // the highest fragment charge CalculateSequenceIons makes for this charge state in ScoreCandidate
+                    int maxIonCharge = min(z, g_rtConfig->maxFragmentChargeState-1) + 1;
+                    int maxFragmentCharge = maxIonCharge > 2 ? maxIonCharge - 1 : 1;
+
+                    fragmentIndex.findCandidates(spectrum->peakData,
+                                                 maxFragmentCharge,
+                                                 isMono ? MassType_Monoisotopic : MassType_Average,
+                                                 p.mass - tolerance,
+                                                 p.mass + tolerance,
+                                                 (size_t) g_rtConfig->FragmentIndexCandidatesPerSpectrum,
+                                                 candidates,
+                                                 targetsInWindow,
+                                                 decoysInWindow,
+                                                 sharedPeakCounts);
+
+                    for (size_t c = 0; c < candidates.size(); ++c)
+                    {
+                        DigestedPeptide candidate = fragmentIndex.peptide(candidates[c].first);
+                        const proteinData& protein = fragmentIndex.protein(candidates[c].first);
+                        string sequence = PEPTIDE_N_TERMINUS_STRING + candidate.sequence() + PEPTIDE_C_TERMINUS_STRING;
+                        sequenceIons.clear();
+                        ScoreCandidate(candidate, sequence, sequenceIons, z, spectrum, p, protein.getName(), protein.isDecoy(), false);
+                    }
+                    searchStatistics.numComparisonsDone += candidates.size();
+
+                    // every candidate in the precursor mass window counts as a comparison, as without the index
+                    boost::mutex::scoped_lock guard(spectrum->mutex);
+                    spectrum->numTargetComparisons += targetsInWindow;
+                    spectrum->numDecoyComparisons += decoysInWindow;
+                }
+            }
+        } catch( std::exception& e )
+        {
+            cerr << " terminated with an error: " << e.what() << endl;
+        } catch(...)
+        {
+            cerr << " terminated with an unknown error." << endl;
+        }
+
+        return 0;
+    }
+
+    /**
+        Searches the proteins a part at a time: the peptide variants of each part are put in a fragment index,
+        and then each spectrum is looked up in the index and scored against its best candidates.
+    */
+    void ExecuteFragmentIndexSearch()
+    {
+        size_t numProcessors = (size_t) g_numWorkers;
+        boost::uint32_t numProteins = (boost::uint32_t) proteins.size();
+
+        for (size_t i=0; i < numProteins; ++i)
+            proteinTasks.push(i);
+
+        // index the fragment types of all the spectra
+        FragmentTypesBitset fragmentTypes;
+        BOOST_FOREACH(Spectrum* s, spectra)
+            fragmentTypes |= s->fragmentTypes;
+
+        vector<Spectrum*> spectraToSearch(spectra.begin(), spectra.end());
+        FragmentIndex fragmentIndex((size_t) g_rtConfig->FragmentIndexMaxCandidates);
+
+        while (!proteinTasks.empty())
+        {
+            Timer indexTime(true);
+            {
+                boost::thread_group workerThreadGroup;
+                for (size_t i = 0; i < numProcessors; ++i)
+                    workerThreadGroup.create_thread(boost::bind(&ExecuteSearchThread, &fragmentIndex));
+                workerThreadGroup.join_all();
+            }
+            fragmentIndex.build(fragmentTypes, g_rtConfig->FragmentMzTolerance, numProcessors);
+
+            if (g_numChildren == 0)
+                cout << "Indexed " << fragmentIndex.size() << " candidates from " << searchStatistics.numProteinsDigested << " of "
+                     << numProteins << " proteins; " << indexTime.End() << " seconds elapsed." << endl;
+
+            Timer scoreTime(true);
+            boost::atomic<size_t> nextSpectrum(0);
+            {
+                boost::thread_group workerThreadGroup;
+                for (size_t i = 0; i < numProcessors; ++i)
+                    workerThreadGroup.create_thread(boost::bind(&ExecuteFragmentIndexSearchThread, boost::cref(fragmentIndex), boost::cref(spectraToSearch), &nextSpectrum));
+                workerThreadGroup.join_all();
+            }
+
+            if (g_numChildren == 0)
+                cout << "Searched " << spectraToSearch.size() << " spectra against the index; " << scoreTime.End() << " seconds elapsed." << endl;
+
+            fragmentIndex.clear();
+        }
+
+        // compute xcorr for top ranked results
+        if( g_numChildren == 0 && g_rtConfig->ComputeXCorr )
+            ComputeXCorrs();
+    }
+
     void ExecuteSearch()
     {
+        // estimating the search time counts the comparisons of the search without an index
+        if (g_rtConfig->UseFragmentIndex && !g_rtConfig->EstimateSearchTimeOnly)
+        {
+            ExecuteFragmentIndexSearch();
+            return;
+        }
+
         size_t numProcessors = (size_t) g_numWorkers;
         boost::uint32_t numProteins = (boost::uint32_t) proteins.size();
 
@@ -679,7 +860,7 @@ namespace myrimatch
         vector<boost::thread*> workerThreads;
 
         for (size_t i = 0; i < numProcessors; ++i)
-            workerThreads.push_back(workerThreadGroup.create_thread(&ExecuteSearchThread));
+            workerThreads.push_back(workerThreadGroup.create_thread(boost::bind(&ExecuteSearchThread, (FragmentIndex*) NULL)));
 
         if (g_numChildren > 0)
         {
@@ -76,7 +76,10 @@ using namespace freicore;
     RTCONFIG_VARIABLE( string,          DynamicMods,                    ""                      ) \
     RTCONFIG_VARIABLE( int,             MaxDynamicMods,                 2                       ) \
     RTCONFIG_VARIABLE( int,             MaxPeptideVariants,             1000000                 ) \
-    RTCONFIG_VARIABLE( bool,            KeepUnadjustedPrecursorMz,      false                   )
+    RTCONFIG_VARIABLE( bool,            KeepUnadjustedPrecursorMz,      false                   ) \
+    RTCONFIG_VARIABLE( bool,            UseFragmentIndex,               false                   ) \
+    RTCONFIG_VARIABLE( int,             FragmentIndexMaxCandidates,     2000000                 ) \
+    RTCONFIG_VARIABLE( int,             FragmentIndexCandidatesPerSpectrum, 100                 )
 
 
 namespace freicore
@@ -259,6 +262,9 @@ namespace myrimatch
                     m_warnings << "Invalid mode \"" << mode << "\" for FragmentationRule.\n";
             }
 
+            if( UseFragmentIndex && FragmentIndexMaxCandidates < 1 )
+                m_warnings << "FragmentIndexMaxCandidates must be at least 1.\n";
+
             if( ProteinSamplingTime == 0 )
             {
                 if( EstimateSearchTimeOnly )
@@ -0,0 +1,438 @@
+//
+// $Id$
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// The Original Code is the MyriMatch search engine.
+//
+// The Initial Developer of the Original Code is Matt Chambers.
+//
+// Copyright 2009 Vanderbilt University
+//
+// Contributor(s): agent
+//
+
+#include "stdafx.h"
+#include "myrimatchFragmentIndex.h"
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+
+using namespace freicore;
+
+namespace freicore
+{
+namespace myrimatch
+{
+    namespace
+    {
+        // a peptide's average mass is within this fraction of its monoisotopic mass
+        // (about 0.06% for ordinary peptides, and a little less than the monoisotopic mass for selenopeptides)
+        const double maxAverageMassDifference = 0.002;
+
+        // singly charged fragment ions are at most this much heavier than their precursor (a y ion, or a z ion with extra protons)
+        const double maxFragmentMassExcess = 50.0;
+
+        struct CandidateMassLessThan
+        {
+            CandidateMassLessThan( const vector<FragmentIndex::Candidate>& candidates, const vector<proteinData>& proteins )
+            :   candidates( candidates ), proteins( proteins )
+            {}
+
+            // ties keep the protein's variant order, so the order doesn't depend on the digestion threads
+            bool operator() ( size_t lhs, size_t rhs ) const
+            {
+                const FragmentIndex::Candidate& l = candidates[lhs];
+                const FragmentIndex::Candidate& r = candidates[rhs];
+                if( l.monoMass != r.monoMass )
+                    return l.monoMass < r.monoMass;
+                return l.protein != r.protein && proteins[l.protein].getName() < proteins[r.protein].getName();
+            }
+
+            const vector<FragmentIndex::Candidate>& candidates;
+            const vector<proteinData>& proteins;
+        };
+
+        bool candidateMonoMassLessThan( const FragmentIndex::Candidate& lhs, double rhs ) { return lhs.monoMass < rhs; }
+        bool monoMassCandidateLessThan( double lhs, const FragmentIndex::Candidate& rhs ) { return lhs < rhs.monoMass; }
+
+        // more shared peaks first, then lighter candidates first
+        bool sharedPeakCountGreaterThan( const pair<size_t, boost::uint16_t>& lhs, const pair<size_t, boost::uint16_t>& rhs )
+        {
+            return lhs.second > rhs.second || (lhs.second == rhs.second && lhs.first < rhs.first);
+        }
+
+        /**
+            The singly charged m/z of the fragments that CalculateSequenceIons can make of a peptide with any
+            maxIonCharge: every m/z of charge z it makes is (m - Proton) * z + Proton for one of these.
+        */
+        void getFragments( const DigestedPeptide& peptide, const FragmentTypesBitset& fragmentTypes, vector<double>& fragments )
+        {
+            fragments.clear();
+            Fragmentation fragmentation = peptide.fragmentation( true, true );
+            size_t length = peptide.sequence().length();
+            for( size_t i=1; i <= length; ++i )
+            {
+                if( fragmentTypes[FragmentType_A] ) fragments.push_back( fragmentation.a( i, 1 ) );
+                if( fragmentTypes[FragmentType_B] ) fragments.push_back( fragmentation.b( i, 1 ) );
+                if( fragmentTypes[FragmentType_Y] ) fragments.push_back( fragmentation.y( i, 1 ) );
+
+                if( fragmentTypes[FragmentType_Z] )
+                {
+                    fragments.push_back( fragmentation.z( i, 1 ) );
+                    fragments.push_back( fragmentation.z( i, 1 ) + 2*Proton ); // with UseSmartPlusThreeModel
+                }
+
+                if( fragmentTypes[FragmentType_Z_Radical] )
+                {
+                    fragments.push_back( fragmentation.zRadical( i, 1 ) );
+                    fragments.push_back( fragmentation.zRadical( i, 1 ) + Proton ); // z+1
+                }
+
+                if( i == length )
+                    continue;
+
+                if( fragmentTypes[FragmentType_C] )
+                {
+                    fragments.push_back( fragmentation.c( i, 1 ) );
+                    fragments.push_back( fragmentation.c( i, 1 ) - Proton ); // c-1
+                }
+
+                if( fragmentTypes[FragmentType_X] ) fragments.push_back( fragmentation.x( i, 1 ) );
+            }
+        }
+    }
+
+
+    void FragmentIndex::ProteinCandidates::add( const DigestedPeptideRecord& record, const DigestedPeptide& variant )
+    {
+        if( record.length > numeric_limits<boost::uint16_t>::max() )
+            throw runtime_error( "[FragmentIndex::ProteinCandidates::add] peptide is too long" );
+
+        Candidate c;
+        c.protein = 0;
+        c.offset = (boost::uint32_t) record.offset;
+        c.length = (boost::uint16_t) record.length;
+        c.missedCleavages = (boost::uint16_t) min( record.missedCleavages, (size_t) numeric_limits<boost::uint16_t>::max() );
+        c.NTerminusIsSpecific = record.NTerminusIsSpecific;
+        c.CTerminusIsSpecific = record.CTerminusIsSpecific;
+        c.monoMass = variant.monoisotopicMass();
+        c.avgMass = variant.molecularWeight();
+        c.modsBegin = (boost::uint32_t) modifications.size();
+
+        const ModificationMap& modMap = variant.modifications();
+        for( ModificationMap::const_iterator itr = modMap.begin(); itr != modMap.end(); ++itr )
+            BOOST_FOREACH(const Modification& mod, itr->second)
+                modifications.push_back( make_pair( itr->first, mod ) );
+        c.modCount = (boost::uint16_t) ( modifications.size() - c.modsBegin );
+
+        candidates.push_back( c );
+    }
+
+
+    FragmentIndex::FragmentIndex( size_t maxCandidates )
+    :   maxCandidates( maxCandidates ), binWidth( 0 )
+    {}
+
+
+    void FragmentIndex::add( const proteinData& protein, const ProteinCandidates& proteinCandidates )
+    {
+        boost::mutex::scoped_lock lock( candidatesMutex );
+
+        boost::uint32_t proteinIndex = (boost::uint32_t) proteins.size();
+        proteins.push_back( protein );
+
+        // the modifications come from the configured static and dynamic mods, so there are only a few distinct ones
+        boost::uint32_t modsBegin = (boost::uint32_t) modificationEntries.size();
+        for( size_t i=0; i < proteinCandidates.modifications.size(); ++i )
+        {
+            const pair<int, Modification>& entry = proteinCandidates.modifications[i];
+            size_t m = find( modifications.begin(), modifications.end(), entry.second ) - modifications.begin();
+            if( m == modifications.size() )
+            {
+                if( m > (size_t) numeric_limits<boost::uint16_t>::max() )
+                    throw runtime_error( "[FragmentIndex::add] too many distinct modifications" );
+                modifications.push_back( entry.second );
+            }
+            modificationEntries.push_back( make_pair( entry.first, (boost::uint16_t) m ) );
+        }
+
+        BOOST_FOREACH(Candidate c, proteinCandidates.candidates)
+        {
+            c.protein = proteinIndex;
+            c.modsBegin += modsBegin;
+            candidates.push_back( c );
+        }
+    }
+
+
+    bool FragmentIndex::full() const
+    {
+        boost::mutex::scoped_lock lock( candidatesMutex );
+        return candidates.size() >= maxCandidates;
+    }
+
+
+    DigestedPeptide FragmentIndex::peptide( size_t i ) const
+    {
+        const Candidate& c = candidates[i];
+        const string& sequence = proteins[c.protein].getSequence();
+        size_t end = c.offset + c.length;
+
+        // the prefix and suffix are the residues next to the peptide, as Digestion makes them
+        DigestedPeptide result( sequence.begin() + c.offset,
+                                sequence.begin() + end,
+                                c.offset,
+                                c.missedCleavages,
+                                c.NTerminusIsSpecific,
+                                c.CTerminusIsSpecific,
+                                c.offset > 0 ? sequence.substr( c.offset-1, 1 ) : "",
+                                end < sequence.length() ? sequence.substr( end, 1 ) : "" );
+
+        if( c.modCount > 0 )
+        {
+            ModificationMap& modMap = result.modifications();
+            for( size_t m = c.modsBegin; m < (size_t) c.modsBegin + c.modCount; ++m )
+                modMap[modificationEntries[m].first].push_back( modifications[modificationEntries[m].second] );
+        }
+        return result;
+    }
+
+
+    double FragmentIndex::binOf( double mz ) const
+    {
+        if( fragmentMzTolerance.units == MZTolerance::PPM )
+            return mz > 1 ? log( mz ) / binWidth : 0;
+        return max( 0.0, mz / binWidth );
+    }
+
+
+    void FragmentIndex::build( const FragmentTypesBitset& fragmentTypes, const MZTolerance& fragmentMzTolerance, size_t numThreads )
+    {
+        if( candidates.size() > (size_t) numeric_limits<boost::uint32_t>::max() )
+            throw runtime_error( "[FragmentIndex::build] too many candidates" );
+
+        // sort the candidates by mass
+        vector<size_t> order( candidates.size() );
+        for( size_t i=0; i < order.size(); ++i )
+            order[i] = i;
+        stable_sort( order.begin(), order.end(), CandidateMassLessThan( candidates, proteins ) );
+
+        vector<Candidate> sortedCandidates;
+        sortedCandidates.reserve( candidates.size() );
+        BOOST_FOREACH(size_t i, order)
+            sortedCandidates.push_back( candidates[i] );
+        candidates.swap( sortedCandidates );
+        vector<Candidate>().swap( sortedCandidates );
+
+        // bins are as wide as the fragment tolerance: a fixed m/z width, or a fixed m/z ratio for a PPM tolerance
+        this->fragmentMzTolerance = fragmentMzTolerance;
+        if( fragmentMzTolerance.value <= 0 )
+            throw runtime_error( "[FragmentIndex::build] the fragment tolerance must be positive" );
+        if( fragmentMzTolerance.units == MZTolerance::PPM )
+            binWidth = log1p( fragmentMzTolerance.value * 1e-6 );
+        else
+            binWidth = fragmentMzTolerance.value;
+
+        double maxMass = 0;
+        BOOST_FOREACH(const Candidate& c, candidates)
+            maxMass = max( maxMass, max( c.monoMass, c.avgMass ) );
+        size_t binCount = (size_t) binOf( maxMass + maxFragmentMassExcess ) + 1;
+
+        // each thread indexes a contiguous range of candidates, so every bin stays sorted by candidate
+        numThreads = max( (size_t) 1, min( numThreads, candidates.size() / 1000 + 1 ) );
+        vector< vector<size_t> > binCounts( numThreads, vector<size_t>( binCount, 0 ) );
+        vector<size_t> rangeBegins;
+        for( size_t t=0; t <= numThreads; ++t )
+            rangeBegins.push_back( candidates.size() * t / numThreads );
+
+        {
+            boost::thread_group threads;
+            for( size_t t=0; t < numThreads; ++t )
+                threads.create_thread( boost::bind( &FragmentIndex::countFragments, this, rangeBegins[t], rangeBegins[t+1], boost::cref( fragmentTypes ), &binCounts[t] ) );
+            threads.join_all();
+        }
+
+        // turn the counts into the position where each thread writes its next candidate in each bin
+        binOffsets.assign( binCount + 1, 0 );
+        size_t offset = 0;
+        for( size_t b=0; b < binCount; ++b )
+        {
+            binOffsets[b] = offset;
+            for( size_t t=0; t < numThreads; ++t )
+            {
+                size_t count = binCounts[t][b];
+                binCounts[t][b] = offset;
+                offset += count;
+            }
+        }
+        binOffsets[binCount] = offset;
+        binCandidates.resize( offset );
+
+        {
+            boost::thread_group threads;
+            for( size_t t=0; t < numThreads; ++t )
+                threads.create_thread( boost::bind( &FragmentIndex::indexFragments, this, rangeBegins[t], rangeBegins[t+1], boost::cref( fragmentTypes ), &binCounts[t] ) );
+            threads.join_all();
+        }
+    }
+
+
+    void FragmentIndex::getFragmentBins( size_t i, const FragmentTypesBitset& fragmentTypes, size_t binCount,
+                                         vector<double>& fragments, vector<size_t>& bins ) const
+    {
+        getFragments( peptide( i ), fragmentTypes, fragments );
+        bins.clear();
+        BOOST_FOREACH(double fragment, fragments)
+        {
+            size_t bin = (size_t) binOf( fragment );
+            if( fragment > 0 && bin < binCount )
+                bins.push_back( bin );
+        }
+        sort( bins.begin(), bins.end() );
+        bins.erase( unique( bins.begin(), bins.end() ), bins.end() );
+    }
+
+
+    void FragmentIndex::countFragments( size_t begin, size_t end, const FragmentTypesBitset& fragmentTypes, vector<size_t>* binCounts ) const
+    {
+        vector<double> fragments;
+        vector<size_t> bins;
+        for( size_t i=begin; i < end; ++i )
+        {
+            getFragmentBins( i, fragmentTypes, binCounts->size(), fragments, bins );
+            BOOST_FOREACH(size_t bin, bins)
+                ++ (*binCounts)[bin];
+        }
+    }
+
+
+    void FragmentIndex::indexFragments( size_t begin, size_t end, const FragmentTypesBitset& fragmentTypes, vector<size_t>* binPositions )
+    {
+        vector<double> fragments;
+        vector<size_t> bins;
+        for( size_t i=begin; i < end; ++i )
+        {
+            getFragmentBins( i, fragmentTypes, binPositions->size(), fragments, bins );
+            BOOST_FOREACH(size_t bin, bins)
+                binCandidates[ (*binPositions)[bin]++ ] = (boost::uint32_t) i;
+        }
+    }
+
+
+    void FragmentIndex::findCandidates( const PeakData& peakData,
+                                        int maxFragmentCharge,
+                                        MassType massType,
+                                        double minMass,
+                                        double maxMass,
+                                        size_t maxResults,
+                                        vector< pair<size_t, boost::uint16_t> >& result,
+                                        size_t& targetsInWindow,
+                                        size_t& decoysInWindow,
+                                        SharedPeakCounts& counts ) const
+    {
+        result.clear();
+        targetsInWindow = decoysInWindow = 0;
+
+        // the candidates are sorted by monoisotopic mass, so an average mass window is widened to cover them
+        double minMonoMass = minMass, maxMonoMass = maxMass;
+        if( massType != MassType_Monoisotopic )
+        {
+            minMonoMass -= minMass * maxAverageMassDifference;
+            maxMonoMass += maxMass * maxAverageMassDifference;
+        }
+
+        size_t first = lower_bound( candidates.begin(), candidates.end(), minMonoMass, candidateMonoMassLessThan ) - candidates.begin();
+        size_t last = upper_bound( candidates.begin(), candidates.end(), maxMonoMass, monoMassCandidateLessThan ) - candidates.begin();
+        if( first >= last )
+            return;
+
+        counts.counts.assign( last - first, 0 );
+        counts.lastPeak.assign( last - first, 0 );
+        size_t binCount = binOffsets.size() - 1;
+        double ppm = fragmentMzTolerance.value * 1e-6;
+        boost::uint32_t peak = 0;
+        for( PeakData::const_iterator itr = peakData.begin(); itr != peakData.end(); ++itr )
+        {
+            if( itr->second.intenClass <= 0 )
+                continue;
+            ++peak;
+
+            // the m/z of the fragments this peak matches (for PeakData::findNear with the fragment's m/z)
+            double minMz, maxMz;
+            if( fragmentMzTolerance.units == MZTolerance::PPM )
+            {
+                minMz = itr->first / ( 1 + ppm );
+                maxMz = itr->first / ( 1 - ppm );
+            }
+            else
+            {
+                minMz = itr->first - fragmentMzTolerance.value;
+                maxMz = itr->first + fragmentMzTolerance.value;
+            }
+
+            // look up the singly charged m/z of each fragment charge the peak can be
+            for( int z=1; z <= maxFragmentCharge; ++z )
+            {
+                size_t firstBin = (size_t) binOf( ( minMz - Proton ) * z + Proton );
+                size_t lastBin = min( (size_t) binOf( ( maxMz - Proton ) * z + Proton ), binCount - 1 );
+                for( size_t b=firstBin; b <= lastBin; ++b )
+                {
+                    if( binOffsets[b] == binOffsets[b+1] )
+                        continue;
+
+                    const boost::uint32_t* binEnd = &binCandidates[0] + binOffsets[b+1];
+                    const boost::uint32_t* id = lower_bound( &binCandidates[0] + binOffsets[b], binEnd, (boost::uint32_t) first );
+                    for( ; id != binEnd && *id < last; ++id )
+                    {
+                        size_t c = *id - first;
+                        if( counts.lastPeak[c] == peak )
+                            continue;
+                        counts.lastPeak[c] = peak;
+                        if( counts.counts[c] < numeric_limits<boost::uint16_t>::max() )
+                            ++counts.counts[c];
+                    }
+                }
+            }
+        }
+
+        for( size_t i=first; i < last; ++i )
+        {
+            if( massType != MassType_Monoisotopic &&
+                ( candidates[i].avgMass < minMass || candidates[i].avgMass > maxMass ) )
+                continue;
+
+            if( proteins[candidates[i].protein].isDecoy() )
+                ++ decoysInWindow;
+            else
+                ++ targetsInWindow;
+            if( counts.counts[i - first] > 0 )
+                result.push_back( make_pair( i, counts.counts[i - first] ) );
+        }
+
+        size_t resultCount = min( maxResults, result.size() );
+        partial_sort( result.begin(), result.begin() + resultCount, result.end(), sharedPeakCountGreaterThan );
+        result.resize( resultCount );
+    }
+
+
+    void FragmentIndex::clear()
+    {
+        vector<Candidate>().swap( candidates );
+        vector<proteinData>().swap( proteins );
+        modifications.clear();
+        vector< pair<int, boost::uint16_t> >().swap( modificationEntries );
+        binOffsets.clear();
+        binCandidates.clear();
+    }
+}
+}
@@ -0,0 +1,164 @@
+//
+// $Id$
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// The Original Code is the MyriMatch search engine.
+//
+// The Initial Developer of the Original Code is Matt Chambers.
+//
+// Copyright 2009 Vanderbilt University
+//
+// Contributor(s): agent
+//
+
+#ifndef _MYRIMATCHFRAGMENTINDEX_H
+#define _MYRIMATCHFRAGMENTINDEX_H
+
+#include "stdafx.h"
+#include "freicore.h"
+#include "myrimatchSpectrum.h"
+#include <boost/thread/mutex.hpp>
+#include <boost/cstdint.hpp>
+
+namespace freicore
+{
+namespace myrimatch
+{
+    /**
+        An inverted index from fragment m/z bins to the candidates (peptide variants) of a part of the
+        protein database. Instead of scoring every candidate in a spectrum's precursor mass window, the
+        spectrum's peaks are looked up in the index to count the fragments each candidate shares with it,
+        and only the candidates sharing the most are scored. The index is built once per part of the
+        database and then searched by all the spectra.
+    */
+    class FragmentIndex
+    {
+    public:
+
+        /**
+            A peptide variant of one of the index's proteins, without a copy of its sequence or its modifications:
+            the variant is recreated with peptide() for the few candidates that are scored.
+        */
+        struct Candidate
+        {
+            boost::uint32_t protein;    // the index of the protein in the FragmentIndex
+            boost::uint32_t offset;     // the offset of the peptide in the protein
+            boost::uint32_t modsBegin;  // the index of the first of the candidate's modification entries
+            boost::uint16_t length;
+            boost::uint16_t modCount;
+            boost::uint16_t missedCleavages;
+            bool NTerminusIsSpecific;
+            bool CTerminusIsSpecific;
+            double monoMass;
+            double avgMass;
+        };
+
+        /// the candidates from one protein, collected by a digestion thread and then added to the index at once
+        class ProteinCandidates
+        {
+        public:
+            /// adds a variant of the peptide described by record
+            void add( const DigestedPeptideRecord& record, const DigestedPeptide& variant );
+
+            bool empty() const { return candidates.empty(); }
+            void clear() { candidates.clear(); modifications.clear(); }
+
+        private:
+            friend class FragmentIndex;
+            vector<Candidate> candidates;
+            vector< pair<int, Modification> > modifications;
+        };
+
+        /// the index is full when it has at least maxCandidates candidates
+        explicit FragmentIndex( size_t maxCandidates );
+
+        /// adds the candidates from one protein; thread-safe
+        void add( const proteinData& protein, const ProteinCandidates& proteinCandidates );
+
+        bool full() const;
+        size_t size() const { return candidates.size(); }
+        const Candidate& operator[]( size_t i ) const { return candidates[i]; }
+
+        /// returns the protein the i'th candidate was digested from
+        const proteinData& protein( size_t i ) const { return proteins[candidates[i].protein]; }
+
+        /// recreates the i'th candidate's peptide variant, with its digestion metadata and modifications
+        DigestedPeptide peptide( size_t i ) const;
+
+        /**
+            Sorts the candidates by monoisotopic mass and indexes the singly charged m/z of their fragments of the
+            given types in bins as wide as the fragment tolerance (in its units); the bins also include the
+            neighbouring ions that CalculateSequenceIons adds to some fragment types.
+        */
+        void build( const FragmentTypesBitset& fragmentTypes, const MZTolerance& fragmentMzTolerance, size_t numThreads );
+
+        /// working space for findCandidates, one per thread
+        struct SharedPeakCounts
+        {
+            vector<boost::uint16_t> counts;
+            vector<boost::uint32_t> lastPeak; // the last peak (numbered from 1) that counted for each candidate
+        };
+
+        /**
+            Finds the candidates with precursor masses (of the given type) in [minMass, maxMass] and
+            returns, best first, up to maxCandidates of them with the number of peaks they share with the spectrum;
+            a peak is shared if it is within the fragment tolerance of one of the candidate's fragments with a charge
+            from 1 to maxFragmentCharge, and each peak counts at most once for a candidate. The counts are at least
+            the exact counts; they can be higher because whole bins are matched.
+            targetsInWindow and decoysInWindow are set to the number of candidates in the window.
+        */
+        void findCandidates( const PeakData& peakData,
+                             int maxFragmentCharge,
+                             MassType massType,
+                             double minMass,
+                             double maxMass,
+                             size_t maxCandidates,
+                             vector< pair<size_t, boost::uint16_t> >& result,
+                             size_t& targetsInWindow,
+                             size_t& decoysInWindow,
+                             SharedPeakCounts& counts ) const;
+
+        void clear();
+
+    private:
+
+        size_t maxCandidates;
+        vector<Candidate> candidates;
+        vector<proteinData> proteins;
+        mutable boost::mutex candidatesMutex;
+
+        // the distinct modifications of the candidates, and each candidate's modifications as (position, modification index)
+        vector<Modification> modifications;
+        vector< pair<int, boost::uint16_t> > modificationEntries;
+
+        MZTolerance fragmentMzTolerance;
+        double binWidth; // in m/z, or the log of the bins' m/z ratio for a PPM tolerance
+
+        // the candidates with fragments in bin b are binCandidates[binOffsets[b]] to binCandidates[binOffsets[b+1]-1],
+        // in ascending order, i.e. ordered by mass
+        vector<size_t> binOffsets;
+        vector<boost::uint32_t> binCandidates;
+
+        double binOf( double mz ) const;
+
+        // the distinct bins of the i'th candidate's fragments
+        void getFragmentBins( size_t i, const FragmentTypesBitset& fragmentTypes, size_t binCount, vector<double>& fragments, vector<size_t>& bins ) const;
+
+        void countFragments( size_t begin, size_t end, const FragmentTypesBitset& fragmentTypes, vector<size_t>* binCounts ) const;
+        void indexFragments( size_t begin, size_t end, const FragmentTypesBitset& fragmentTypes, vector<size_t>* binPositions );
+    };
+}
+}
+
+#endif
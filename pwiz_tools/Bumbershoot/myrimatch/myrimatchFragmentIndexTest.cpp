@@ -0,0 +1,267 @@
+//
+// $Id$
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// The Original Code is the MyriMatch search engine.
+//
+// The Initial Developer of the Original Code is Matt Chambers.
+//
+// Copyright 2009 Vanderbilt University
+//
+// Contributor(s): agent
+//
+
+
+#include "pwiz/utility/misc/unit.hpp"
+#include "pwiz/utility/misc/Std.hpp"
+#include "myrimatchFragmentIndex.h"
+#include <boost/foreach.hpp>
+
+
+using namespace pwiz::util;
+using namespace pwiz::proteome;
+using namespace freicore;
+using namespace freicore::myrimatch;
+
+
+namespace {
+
+const char* testProteins[][2] =
+{
+    {"PRO1", "MKWVTFISLLLLFSSAYSRGVFRRDTHKSEIAHRFKDLGEEHFKGLVLIAFSQYLQQCPFDEHVKLVNELTEFAKTCVADESHAGCEK"},
+    {"PRO2", "MDQNNSLPPYAQGLASPQGAMTPGIPIFSPMMPYGTGLTPQPIQNTNSLSILEEQQRQQQQQQQQQQQQQQQQQQQQQQQK"},
+    {"rev_PRO1", "KECGAHSEDAVCTKAFETLENVLKVHEDFPCQQLYQSFAILVLGKFHEEGLDKFRHAIESKHTDRRFVGRSYASSFLLLLSIFTVWKM"},
+    {"PRO3", "MAEPRQEFEVMEDHAGTYGLGDRKDQGGYTMHQDQEGDTDAGLKESPLQTPTEDGSEEPGSETSDAKSTPTAEDVTAPLVDEGAPGKQAAAQPHTEIPEGTTAEEAGIGDTPSLEDEAAGHVTQARMVSKSKDGTGSDDKKAKGADGKTKIATPRGAAPPGQKGQANATRIPAKTPPAPKTPPSSGEPPKSGDRSGYSSPGSPGTPGSRSRTPSLPTPPTREPKKVAVVRTPPKSPSSAKSRLQTAPVPMPDLKNVKSKIGSTENLKHQPGGGK"}
+};
+
+const MZTolerance fragmentTolerances[] = { MZTolerance(0.5), MZTolerance(20, MZTolerance::PPM) };
+
+
+// the index's candidates: the tryptic peptides of the test proteins, and each of them with carbamidomethyl cysteines
+void addCandidates(FragmentIndex& index, vector<DigestedPeptide>& peptides)
+{
+    Modification carbamidomethyl(57.021464, 57.0513);
+    for (size_t i=0; i < sizeof(testProteins) / sizeof(testProteins[0]); ++i)
+    {
+        ProteinPtr protein(new Protein(testProteins[i][0], i, "", testProteins[i][1]));
+        proteinData p(protein, bal::starts_with(protein->id, "rev_"));
+
+        FragmentIndex::ProteinCandidates proteinCandidates;
+        Digestion digestion(*protein, MS_Trypsin_P, Digestion::Config(2, 5, 40));
+        for (Digestion::const_iterator itr = digestion.begin(); itr != digestion.end(); ++itr)
+        {
+            DigestedPeptideRecord record = itr.record();
+            proteinCandidates.add(record, *itr);
+            peptides.push_back(*itr);
+
+            size_t c = itr->sequence().find('C');
+            if (c == string::npos)
+                continue;
+
+            DigestedPeptide variant = *itr;
+            for (; c != string::npos; c = itr->sequence().find('C', c+1))
+                variant.modifications()[c].push_back(carbamidomethyl);
+            variant.modifications()[ModificationMap::NTerminus()].push_back(Modification(42.010565, 42.0367));
+            proteinCandidates.add(record, variant);
+            peptides.push_back(variant);
+        }
+        index.add(p, proteinCandidates);
+    }
+}
+
+
+bool sameModifications(const DigestedPeptide& lhs, const DigestedPeptide& rhs)
+{
+    const ModificationMap& l = lhs.modifications();
+    const ModificationMap& r = rhs.modifications();
+    if (l.size() != r.size())
+        return false;
+    for (ModificationMap::const_iterator li = l.begin(), ri = r.begin(); li != l.end(); ++li, ++ri)
+        if (li->first != ri->first || !(li->second == ri->second))
+            return false;
+    return true;
+}
+
+
+void testPeptides(const FragmentIndex& index, const vector<DigestedPeptide>& peptides)
+{
+    unit_assert_operator_equal(peptides.size(), index.size());
+
+    // every candidate is recreated with its digestion metadata and modifications
+    vector<bool> found(peptides.size(), false);
+    for (size_t i=0; i < index.size(); ++i)
+    {
+        DigestedPeptide peptide = index.peptide(i);
+        if (i > 0) unit_assert(index[i-1].monoMass <= index[i].monoMass);
+        unit_assert_equal(peptide.monoisotopicMass(), index[i].monoMass, 1e-8);
+
+        size_t j = 0;
+        for (; j < peptides.size(); ++j)
+            if (!found[j] && peptide == peptides[j] && sameModifications(peptide, peptides[j]) &&
+                index.protein(i).getSequence().compare(peptide.offset(), peptide.sequence().length(), peptide.sequence()) == 0)
+                break;
+        unit_assert(j < peptides.size());
+        found[j] = true;
+    }
+}
+
+
+// the peaks at the fragments of the given charge of a peptide, and a few peaks that don't match it
+PeakData makePeaks(const DigestedPeptide& peptide, int fragmentCharge)
+{
+    PeakData peakData;
+    PeakInfo info;
+    info.intenClass = 1;
+    info.normalizedIntensity = 1;
+
+    Fragmentation fragmentation = peptide.fragmentation(true, true);
+    size_t length = peptide.sequence().length();
+    for (size_t i=1; i < length; ++i)
+    {
+        peakData[fragmentation.b(i, fragmentCharge) * (1 + 5e-6)] = info;
+        peakData[fragmentation.y(i, fragmentCharge) * (1 - 5e-6)] = info;
+    }
+
+    for (double mz = 201.3; mz < 1500; mz += 97.7)
+        peakData[mz] = info;
+    return peakData;
+}
+
+
+// the number of peaks within the tolerance of a fragment that ScoreCandidate could match with the peptide
+size_t countSharedPeaks(const PeakData& peakData, const DigestedPeptide& peptide, int maxIonCharge,
+                        const FragmentTypesBitset& fragmentTypes, const MZTolerance& tolerance)
+{
+    vector<double> ions, smartIons;
+    CalculateSequenceIons(peptide, maxIonCharge, &ions, fragmentTypes, false, 0, 0);
+    CalculateSequenceIons(peptide, maxIonCharge, &smartIons, fragmentTypes, true, 0, 0);
+    ions.insert(ions.end(), smartIons.begin(), smartIons.end());
+
+    size_t count = 0;
+    for (PeakData::const_iterator itr = peakData.begin(); itr != peakData.end(); ++itr)
+        BOOST_FOREACH(double ion, ions)
+            if (itr->first >= ion - tolerance && itr->first < ion + tolerance)
+            {
+                ++count;
+                break;
+            }
+    return count;
+}
+
+
+void testFindCandidates(const FragmentIndex& index, const FragmentTypesBitset& fragmentTypes, const MZTolerance& tolerance,
+                        const DigestedPeptide& target, int precursorCharge)
+{
+    // as in ExecuteFragmentIndexSearchThread with MaxFragmentChargeState = 3
+    int z = precursorCharge - 1;
+    int maxIonCharge = min(z, 3) + 1;
+    int maxFragmentCharge = maxIonCharge > 2 ? maxIonCharge - 1 : 1;
+
+    PeakData peakData = makePeaks(target, maxFragmentCharge);
+    double minMass = target.monoisotopicMass() - 3.5, maxMass = target.monoisotopicMass() + 3.5;
+
+    FragmentIndex::SharedPeakCounts counts;
+    vector< pair<size_t, boost::uint16_t> > result;
+    size_t targets, decoys;
+    index.findCandidates(peakData, maxFragmentCharge, MassType_Monoisotopic, minMass, maxMass, index.size(), result, targets, decoys, counts);
+
+    unit_assert(!result.empty());
+    unit_assert(index.peptide(result[0].first) == target);
+    for (size_t i=1; i < result.size(); ++i)
+        unit_assert(result[i-1].second >= result[i].second);
+
+    // the index counts every peak the exact count does, each peak at most once, and only peaks near the candidate's fragments
+    MZTolerance looseTolerance(tolerance.value * 3, tolerance.units);
+    size_t windowTargets = 0, windowDecoys = 0;
+    for (size_t i=0; i < index.size(); ++i)
+    {
+        if (index[i].monoMass < minMass || index[i].monoMass > maxMass)
+            continue;
+        ++(index.protein(i).isDecoy() ? windowDecoys : windowTargets);
+
+        size_t count = 0;
+        for (size_t j=0; j < result.size(); ++j)
+            if (result[j].first == i)
+                count = result[j].second;
+
+        DigestedPeptide peptide = index.peptide(i);
+        unit_assert(count >= countSharedPeaks(peakData, peptide, maxIonCharge, fragmentTypes, tolerance));
+        unit_assert(count <= countSharedPeaks(peakData, peptide, maxIonCharge, fragmentTypes, looseTolerance));
+    }
+    unit_assert_operator_equal(windowTargets, targets);
+    unit_assert_operator_equal(windowDecoys, decoys);
+
+    // a smaller result has the best candidates
+    vector< pair<size_t, boost::uint16_t> > top;
+    index.findCandidates(peakData, maxFragmentCharge, MassType_Monoisotopic, minMass, maxMass, 2, top, targets, decoys, counts);
+    unit_assert(top.size() == min((size_t) 2, result.size()));
+    for (size_t i=0; i < top.size(); ++i)
+        unit_assert(top[i] == result[i]);
+}
+
+
+void test()
+{
+    FragmentTypesBitset fragmentTypes;
+    fragmentTypes.set(FragmentType_B);
+    fragmentTypes.set(FragmentType_Y);
+
+    BOOST_FOREACH(const MZTolerance& tolerance, fragmentTolerances)
+    {
+        FragmentIndex index(1000000);
+        vector<DigestedPeptide> peptides;
+        addCandidates(index, peptides);
+        index.build(fragmentTypes, tolerance, 2);
+
+        testPeptides(index, peptides);
+
+        for (size_t i=0; i < index.size(); i += 7)
+        {
+            DigestedPeptide target = index.peptide(i);
+            if (target.sequence().length() < 6)
+                continue;
+
+            testFindCandidates(index, fragmentTypes, tolerance, target, 2);
+
+            // doubly charged fragments are only found if the index looks them up for a triply charged spectrum
+            testFindCandidates(index, fragmentTypes, tolerance, target, 3);
+        }
+
+        index.clear();
+        unit_assert_operator_equal(0, index.size());
+    }
+}
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(argc, argv)
+
+    try
+    {
+        test();
+    }
+    catch (exception& e)
+    {
+        TEST_FAILED(e.what())
+    }
+    catch (...)
+    {
+        TEST_FAILED("Caught unknown exception.")
+    }
+
+    TEST_EPILOG
+}
@@ -58,9 +58,10 @@ struct Config : public Reader::Config
     MSDataFile::WriteConfig writeConfig;
     string contactFilename;
     bool merge;
+    bool mergeByScanTime;
 
     Config()
-        : outputPath("."), verbose(false), merge(false)
+        : outputPath("."), verbose(false), merge(false), mergeByScanTime(false)
     {
         simAsSpectra = false;
         srmAsSpectra = false;
@@ -183,6 +184,8 @@ Config parseCommandLine(int argc, char** argv)
     bool noindex = false;
     bool zlib = false;
     bool gzip = false;
+    bool gzipBlocks = false;
+    bool noWorkerThreads = false;
     bool ms_numpress_all = false; // if true, use this numpress compression with default tolerance
     double ms_numpress_linear = -1; // if >= 0, use this numpress linear compression with this tolerance
 	std::string ms_numpress_linear_str; // input as text, to help with the "msconvert --numpresslinear foo.raw" case
@@ -294,12 +297,24 @@ Config parseCommandLine(int argc, char** argv)
         ("gzip,g",
             po::value<bool>(&gzip)->zero_tokens(),
             ": gzip entire output file (adds .gz to filename)")
+        ("gzipBlocks",
+            po::value<bool>(&gzipBlocks)->zero_tokens(),
+            ": same as --gzip, but compress in parallel as independent blocks (BGZF) that readers can seek in; still readable by gunzip")
+        ("workerThreads",
+            po::value<size_t>(&config.writeConfig.spectrumWorkerThreadsConfig.numThreads),
+            ": number of threads that read spectra ahead of the writer (default 0 = one per processor core)")
+        ("noWorkerThreads",
+            po::value<bool>(&noWorkerThreads)->zero_tokens(),
+            ": read spectra on the writing thread instead of on worker threads")
         ("filter",
             po::value< vector<string> >(&config.filters),
             ": add a spectrum list filter")
         ("merge",
             po::value<bool>(&config.merge)->zero_tokens(),
             ": create a single output file from multiple input files by merging file-level metadata and concatenating spectrum lists")
+        ("mergeByScanTime",
+            po::value<bool>(&config.mergeByScanTime)->zero_tokens(),
+            ": same as --merge, but interleave the spectra of the input files by scan start time")
         ("simAsSpectra",
             po::value<bool>(&config.simAsSpectra)->zero_tokens(),
             ": write selected ion monitoring as spectra, not chromatograms")
@@ -309,6 +324,9 @@ Config parseCommandLine(int argc, char** argv)
         ("combineIonMobilitySpectra",
             po::value<bool>(&config.combineIonMobilitySpectra)->zero_tokens(),
             ": write all drift bins/scans in a frame/block as one spectrum instead of individual spectra")
+        ("indexSidecar",
+            po::value<bool>(&config.indexSidecar)->zero_tokens(),
+            ": save the spectrum index of mzML, mzXML and MGF inputs next to them (as <input>.index) and reuse it instead of scanning the input again the next time it is read")
         ("acceptZeroLengthSpectra",
             po::value<bool>(&config.acceptZeroLengthSpectra)->zero_tokens(),
             ": some vendor readers have an efficient way of filtering out empty spectra, but it takes more time to open the file")
@@ -515,7 +533,9 @@ Config parseCommandLine(int argc, char** argv)
     if (format_CMS2) config.writeConfig.format = MSDataFile::Format_CMS2;
     if (format_mz5) config.writeConfig.format = MSDataFile::Format_MZ5;
 
-    config.writeConfig.gzipped = gzip; // if true, file is written as .gz
+    config.writeConfig.gzipped = gzip || gzipBlocks; // if true, file is written as .gz
+    config.writeConfig.blockGzipped = gzipBlocks;
+    config.writeConfig.spectrumWorkerThreadsConfig.useThreads = !noWorkerThreads;
 
     if (config.extension.empty())
     {
@@ -680,18 +700,21 @@ void calculateSourceFilePtrSHA1(const SourceFilePtr& sourceFilePtr)
 /// when the --merge argument is present on the command line.
 int mergeFiles(const vector<string>& filenames, const Config& config, const ReaderList& readers)
 {
-    vector<MSDataPtr> msdList;
     int failedFileCount = 0;
 
-    ReaderList::Config readerConfig(config);
+    // MSDataMerger handles combining all files into a single MSData object; each file is
+    // read through once for its metadata and spectrum ids, and reopened while writing
+    MSDataMerger::Config mergerConfig;
+    mergerConfig.readerConfig = config;
+    mergerConfig.interleaveByScanTime = config.mergeByScanTime;
+    MSDataMerger msd(readers, mergerConfig);
 
-    // Each file is read in separately in MSData objects in the msdList list.
     BOOST_FOREACH(const string& filename, filenames)
     {
         try
         {
             *os_ << "processing file: " << filename << endl;
-            readers.read(filename, msdList, readerConfig);
+            msd.addFile(filename);
         }
         catch (exception& e)
         {
@@ -708,11 +731,8 @@ int mergeFiles(const vector<string>& filenames, const Config& config, const Read
     iterationListenerRegistry.addListener(IterationListenerPtr(new UserFeedbackIterationListener), iterationPeriod);
     IterationListenerRegistry* pILR = config.verbose ? &iterationListenerRegistry : 0;
 
-    // MSDataMerger handles combining all files in msdList into a single MSDataFile object.
     try
     {
-        MSDataMerger msd(msdList);
-
         *os_ << "calculating source file checksums" << endl;
         calculateSHA1Checksums(msd);
 
@@ -812,7 +832,7 @@ int go(const Config& config)
 
     int failedFileCount = 0;
 
-    if (config.merge)
+    if (config.merge || config.mergeByScanTime)
         failedFileCount = mergeFiles(config.filenames, config, readers);
     else
     {